@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Compare the Simplex solver with and without the floating-point phase
+# (parameter simplex-float) on the shewanella LP examples.
+#
+# Usage: ./simplex_float_bench.sh <path to yices> [input files]
+#
+# For each input, the script runs yices twice and prints the runtime of
+# (check), the number of exact and floating-point pivots, and the
+# number of exact pivots per second. The inputs are the yices versions
+# of the .lp files (yices can't read the .lp format directly).
+#
+
+if test $# -lt 1 ; then
+  echo "Usage: $0 <path to yices> [input files]"
+  exit 1
+fi
+
+yices=$1
+shift
+
+if test $# -eq 0 ; then
+  dir=`dirname $0`
+  set -- $dir/shewanella-compact.txt $dir/shewanella-compact2.txt
+fi
+
+tmp=`mktemp -d`
+trap 'rm -rf $tmp' EXIT
+
+printf "%-28s %-6s %10s %10s %10s %12s\n" "input" "float" "time (s)" "pivots" "f-pivots" "pivots/s"
+
+for input in "$@" ; do
+  name=`basename $input`
+  for flag in false true ; do
+    file=$tmp/$name-$flag.ys
+    echo "(set-param simplex-float $flag)" > $file
+    sed -e '/^(show-model)/d' $input >> $file
+    echo "(show-stats)" >> $file
+    $yices $file 2> /dev/null | awk -v name=$name -v flag=$flag '
+      /^ pivots /                 { pivots = $3 }
+      /^ float pivots /           { fpivots = $4 }
+      /^Runtime of .\(check\)./   { time = $5 }
+      END {
+        if (fpivots == "") fpivots = 0;
+        rate = (time > 0) ? pivots/time : 0;
+        printf "%-28s %-6s %10.3f %10d %10d %12.0f\n", name, flag, time, pivots, fpivots, rate
+      }'
+  done
+done
@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "yices.h"
+#include "mt/threads.h"
+
+// Throughput of the read-only term-exploration API for 1 to N threads.
+//
+// build yices with enable-thread-safety and MODE=release
+// the cd into examples and do:
+//gcc -O2 -I../src/ term_exploration_mt.c -o term_exploration_mt -lyices -pthread ../build/x86_64-pc-linux-gnu-release/obj/mt/threads.o
+//./term_exploration_mt 64
+//
+// Each thread first builds its own terms then walks them with the
+// term-exploration API. Only the walks are timed: they take the global
+// lock in read mode so they can run in parallel. Term construction
+// takes the lock in write mode and is serialized.
+
+#define NUM_VARS   64
+#define NUM_ROUNDS 5000
+#define NUM_VISITS 200000
+
+typedef struct bench_s {
+  term_t root;        // last term built
+  uint64_t visited;   // number of exploration calls
+} bench_t;
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Construction: fresh variables then arithmetic and Boolean terms on
+ * top of them. The terms are distinct in each thread.
+ */
+static void build(bench_t *b) {
+  type_t bv = yices_bv_type(32);
+  term_t x[NUM_VARS];
+  term_t t, a;
+  uint32_t i, r;
+
+  for (i=0; i<NUM_VARS; i++) {
+    x[i] = yices_new_uninterpreted_term(bv);
+  }
+
+  t = yices_true();
+  for (r=0; r<NUM_ROUNDS; r++) {
+    i = r % NUM_VARS;
+    a = yices_bvadd(x[i], x[(i + r + 1) % NUM_VARS]);
+    a = yices_bvmul(a, yices_bvconst_uint32(32, r + 3));
+    a = yices_bvlt_atom(a, x[(i + 7) % NUM_VARS]);
+    t = yices_or2(yices_and2(t, a), yices_not(a));
+  }
+  b->root = t;
+}
+
+/*
+ * Exploration: depth-first walks from the root with a small explicit
+ * stack. Each walk is cut when the stack is full; we restart from the
+ * root until NUM_VISITS calls have been made.
+ */
+static void explore(bench_t *b) {
+  term_t stack[256];
+  uint32_t top, i, n;
+  uint64_t visited;
+  term_t t;
+
+  visited = 0;
+  top = 0;
+  while (visited < NUM_VISITS) {
+    if (top == 0) {
+      stack[top++] = b->root;
+    }
+    t = stack[--top];
+    (void) yices_type_of_term(t);
+    visited += 2; // type_of_term + term_is_composite
+    if (yices_term_is_composite(t)) {
+      n = yices_term_num_children(t);
+      visited ++;
+      for (i=0; i<n && top < 256; i++) {
+        stack[top++] = yices_term_child(t, i);
+        visited ++;
+      }
+    }
+  }
+  b->visited += visited;
+}
+
+static bool exploring;
+
+yices_thread_result_t YICES_THREAD_ATTR thread_main(void *td) {
+  thread_data_t *tdata = (thread_data_t *) td;
+  bench_t *b = (bench_t *) tdata->extra;
+
+  if (exploring) {
+    explore(b);
+  } else {
+    build(b);
+  }
+  return yices_thread_exit();
+}
+
+static void run(int32_t nthreads) {
+  bench_t *b;
+  uint64_t visited;
+  double start, t_explore;
+  int32_t i;
+
+  b = (bench_t *) calloc(nthreads, sizeof(bench_t));
+  if (b == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  exploring = false;
+  launch_threads(nthreads, b, sizeof(bench_t), "term_exploration_mt", thread_main, false);
+
+  exploring = true;
+  start = now();
+  launch_threads(nthreads, b, sizeof(bench_t), "term_exploration_mt", thread_main, false);
+  t_explore = now() - start;
+
+  visited = 0;
+  for (i=0; i<nthreads; i++) {
+    visited += b[i].visited;
+  }
+  printf("%8"PRId32" %14.0f\n", nthreads, visited/t_explore);
+  fflush(stdout);
+
+  free(b);
+}
+
+int main(int argc, char* argv[]){
+  int32_t n, maxthreads;
+
+  if(argc != 2){
+    mt_test_usage(argc, argv);
+    return 0;
+  }
+
+  maxthreads = strtol(argv[1], NULL, 10);
+  if(maxthreads <= 0){
+    fprintf(stderr, "thread number must be positive!\n");
+    exit(EXIT_FAILURE);
+  }
+
+  yices_init();
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  printf("%8s %14s\n", "threads", "calls/s");
+  for (n=1; n<=maxthreads; n *= 2) {
+    run(n);
+    // start each round from a clean term table
+    yices_reset();
+  }
+  yices_exit();
+
+  return 0;
+}
@@ -62,6 +62,7 @@ static const char * const solver_code_names[NUM_SOLVER_CODES] = {
   "auto",
   "default",
   "ifw",
+  "isdl",
   "none",
   "rfw",
   "simplex",
@@ -71,6 +72,7 @@ static const int32_t solver_code[NUM_SOLVER_CODES] = {
   CTX_CONFIG_AUTO,
   CTX_CONFIG_DEFAULT,
   CTX_CONFIG_ARITH_IFW,
+  CTX_CONFIG_ARITH_ISDL,
   CTX_CONFIG_NONE,
   CTX_CONFIG_ARITH_RFW,
   CTX_CONFIG_ARITH_SIMPLEX,
@@ -540,6 +542,16 @@ static int32_t arch_add_rfw(int32_t a) {
   return a;
 }
 
+// add the sparse IDL solver
+static int32_t arch_add_isdl(int32_t a) {
+  if (a == CTX_ARCH_NOSOLVERS) {
+    a = CTX_ARCH_ISDL;
+  } else {
+    a = -1;
+  }
+  return a;
+}
+
 
 // add solver identified by code c to a
 static int32_t arch_add_arith(int32_t a, solver_code_t c) {
@@ -560,6 +572,10 @@ static int32_t arch_add_arith(int32_t a, solver_code_t c) {
   case CTX_CONFIG_ARITH_RFW:
     a = arch_add_rfw(a);
     break;
+
+  case CTX_CONFIG_ARITH_ISDL:
+    a = arch_add_isdl(a);
+    break;
   }
   return a;
 }
@@ -567,10 +583,10 @@ static int32_t arch_add_arith(int32_t a, solver_code_t c) {
 
 /*
  * Check whether the architecture code a is compatible with mode
- * - current restriction: IFW and RFW don't support PUSH/POP or MULTIPLE CHECKS
+ * - current restriction: IFW, RFW, and ISDL don't support PUSH/POP or MULTIPLE CHECKS
  */
 static bool arch_supports_mode(context_arch_t a, context_mode_t mode) {
-  return (a != CTX_ARCH_IFW && a != CTX_ARCH_RFW) || mode == CTX_MODE_ONECHECK;
+  return (a != CTX_ARCH_IFW && a != CTX_ARCH_RFW && a != CTX_ARCH_ISDL) || mode == CTX_MODE_ONECHECK;
 }
 
 
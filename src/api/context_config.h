@@ -87,9 +87,10 @@ typedef enum solver_code {
   CTX_CONFIG_ARITH_SIMPLEX,   // simplex solver
   CTX_CONFIG_ARITH_IFW,       // integer Floyd-Warshall solver
   CTX_CONFIG_ARITH_RFW,       // real Floyd-Warshall solver
+  CTX_CONFIG_ARITH_ISDL,      // sparse integer difference logic solver
 } solver_code_t;
 
-#define NUM_SOLVER_CODES (CTX_CONFIG_ARITH_RFW+1)
+#define NUM_SOLVER_CODES (CTX_CONFIG_ARITH_ISDL+1)
 
 
 
@@ -209,7 +210,7 @@ extern void delete_config(ctx_config_t *config);
  *
  * Function arch_for_logic returns -1 if we don't support the logic.
  * For IDL and RDL, arch_for_logic returns CTX_ARCH_SPLX (because the
- * alternative solvers IFW and RFW don't support push and pop).
+ * alternative solvers IFW, RFW, and ISDL don't support push and pop).
  */
 extern int32_t arch_for_logic(smt_logic_t code);
 
@@ -67,12 +67,16 @@
  * - VAR_RANDOM_FACTOR = 0.02
  * - CLAUSE_DECAY_FACTOR = 0.999
  * - clause caching is disabled
+ * - inprocessing is disabled
+ * - chronological backtracking is disabled
  */
 #define DEFAULT_VAR_DECAY      VAR_DECAY_FACTOR
 #define DEFAULT_RANDOMNESS     VAR_RANDOM_FACTOR
 #define DEFAULT_CLAUSE_DECAY   CLAUSE_DECAY_FACTOR
 #define DEFAULT_CACHE_TCLAUSES false
 #define DEFAULT_TCLAUSE_SIZE   0
+#define DEFAULT_INPROCESSING   false
+#define DEFAULT_CHRONO_LEVELS  0
 
 
 /*
@@ -110,17 +114,32 @@
  * - SIMPLEX_DEFAULT_CHECK_PERIOD = infinity
  * - propagation is disabled by default
  * - model adjustment is also disabled
+ * - the floating-point phase is disabled
  * - integer check is disabled too
  */
 #define DEFAULT_SIMPLEX_PROP_FLAG     false
 #define DEFAULT_SIMPLEX_ADJUST_FLAG   false
+#define DEFAULT_SIMPLEX_FLOAT_FLAG    false
 #define DEFAULT_SIMPLEX_ICHECK_FLAG   false
 
+/*
+ * Sparse IDL solver: propagation is disabled by default
+ */
+#define DEFAULT_ISDL_PROP_FLAG  false
+
 /*
  * Default parameters for the array solver (defined in fun_solver.h
  * - MAX_UPDATE_CONFLICTS = 20
  * - MAX_EXTENSIONALITY = 1
+ * Eager update lemmas are disabled by default.
+ */
+#define DEFAULT_EAGER_ARRAY_LEMMAS false
+
+
+/*
+ * Bitvector solver: lazy bit-blasting is disabled by default
  */
+#define DEFAULT_BV_LAZY_BLAST  false
 
 
 /*
@@ -144,6 +163,8 @@ static const param_t default_settings = {
   DEFAULT_CLAUSE_DECAY,
   DEFAULT_CACHE_TCLAUSES,
   DEFAULT_TCLAUSE_SIZE,
+  DEFAULT_INPROCESSING,
+  DEFAULT_CHRONO_LEVELS,
 
   DEFAULT_USE_DYN_ACK,
   DEFAULT_USE_BOOL_DYN_ACK,
@@ -158,13 +179,19 @@ static const param_t default_settings = {
 
   DEFAULT_SIMPLEX_PROP_FLAG,
   DEFAULT_SIMPLEX_ADJUST_FLAG,
+  DEFAULT_SIMPLEX_FLOAT_FLAG,
   DEFAULT_SIMPLEX_ICHECK_FLAG,
   SIMPLEX_DEFAULT_PROP_ROW_SIZE,
   SIMPLEX_DEFAULT_BLAND_THRESHOLD,
   SIMPLEX_DEFAULT_CHECK_PERIOD,
 
+  DEFAULT_ISDL_PROP_FLAG,
+
   DEFAULT_MAX_UPDATE_CONFLICTS,
   DEFAULT_MAX_EXTENSIONALITY,
+  DEFAULT_EAGER_ARRAY_LEMMAS,
+
+  DEFAULT_BV_LAZY_BLAST,
 };
 
 
@@ -200,6 +227,8 @@ typedef enum param_key {
   PARAM_CLAUSE_DECAY,
   PARAM_CACHE_TCLAUSES,
   PARAM_TCLAUSE_SIZE,
+  PARAM_INPROCESSING,
+  PARAM_CHRONO_LEVELS,
   // egraph parameters
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
@@ -214,16 +243,22 @@ typedef enum param_key {
   // simplex parameters
   PARAM_SIMPLEX_PROP,
   PARAM_SIMPLEX_ADJUST,
+  PARAM_SIMPLEX_FLOAT,
   PARAM_SIMPLEX_ICHECK,
   PARAM_PROP_THRESHOLD,
   PARAM_BLAND_THRESHOLD,
   PARAM_ICHECK_PERIOD,
+  // sparse idl solver
+  PARAM_ISDL_PROP,
   // array solver
   PARAM_MAX_UPDATE_CONFLICTS,
   PARAM_MAX_EXTENSIONALITY,
+  PARAM_EAGER_ARRAY_LEMMAS,
+  // bitvector solver
+  PARAM_BV_LAZY_BLAST,
 } param_key_t;
 
-#define NUM_PARAM_KEYS (PARAM_MAX_EXTENSIONALITY+1)
+#define NUM_PARAM_KEYS (PARAM_BV_LAZY_BLAST+1)
 
 // parameter names in lexicographic ordering
 static const char *const param_key_names[NUM_PARAM_KEYS] = {
@@ -231,9 +266,11 @@ static const char *const param_key_names[NUM_PARAM_KEYS] = {
   "aux-eq-ratio",
   "bland-threshold",
   "branching",
+  "bv-lazy-blast",
   "c-factor",
   "c-threshold",
   "cache-tclauses",
+  "chrono-levels",
   "clause-decay",
   "d-factor",
   "d-threshold",
@@ -241,9 +278,12 @@ static const char *const param_key_names[NUM_PARAM_KEYS] = {
   "dyn-ack-threshold",
   "dyn-bool-ack",
   "dyn-bool-ack-threshold",
+  "eager-array-lemmas",
   "fast-restarts",
   "icheck",
   "icheck-period",
+  "inprocessing",
+  "isdl-prop",
   "max-ack",
   "max-bool-ack",
   "max-extensionality",
@@ -257,6 +297,7 @@ static const char *const param_key_names[NUM_PARAM_KEYS] = {
   "random-seed",
   "randomness",
   "simplex-adjust",
+  "simplex-float",
   "simplex-prop",
   "tclause-size",
   "var-decay",
@@ -268,9 +309,11 @@ static const int32_t param_code[NUM_PARAM_KEYS] = {
   PARAM_AUX_EQ_RATIO,
   PARAM_BLAND_THRESHOLD,
   PARAM_BRANCHING,
+  PARAM_BV_LAZY_BLAST,
   PARAM_C_FACTOR,
   PARAM_C_THRESHOLD,
   PARAM_CACHE_TCLAUSES,
+  PARAM_CHRONO_LEVELS,
   PARAM_CLAUSE_DECAY,
   PARAM_D_FACTOR,
   PARAM_D_THRESHOLD,
@@ -278,9 +321,12 @@ static const int32_t param_code[NUM_PARAM_KEYS] = {
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
+  PARAM_EAGER_ARRAY_LEMMAS,
   PARAM_FAST_RESTART,
   PARAM_SIMPLEX_ICHECK,
   PARAM_ICHECK_PERIOD,
+  PARAM_INPROCESSING,
+  PARAM_ISDL_PROP,
   PARAM_MAX_ACK,
   PARAM_MAX_BOOL_ACK,
   PARAM_MAX_EXTENSIONALITY,
@@ -294,6 +340,7 @@ static const int32_t param_code[NUM_PARAM_KEYS] = {
   PARAM_RANDOM_SEED,
   PARAM_RANDOMNESS,
   PARAM_SIMPLEX_ADJUST,
+  PARAM_SIMPLEX_FLOAT,
   PARAM_SIMPLEX_PROP,
   PARAM_TCLAUSE_SIZE,
   PARAM_VAR_DECAY,
@@ -575,6 +622,17 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     }
     break;
 
+  case PARAM_INPROCESSING:
+    r = set_bool_param(value, &parameters->inprocessing);
+    break;
+
+  case PARAM_CHRONO_LEVELS:
+    r = set_int32_param(value, &z, 0, INT32_MAX);
+    if (r == 0) {
+      parameters->chrono_levels = (uint32_t) z;
+    }
+    break;
+
   case PARAM_DYN_ACK:
     r = set_bool_param(value, &parameters->use_dyn_ack);
     break;
@@ -649,6 +707,10 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     r = set_bool_param(value, &parameters->adjust_simplex_model);
     break;
 
+  case PARAM_SIMPLEX_FLOAT:
+    r = set_bool_param(value, &parameters->simplex_float_first);
+    break;
+
   case PARAM_SIMPLEX_ICHECK:
     r = set_bool_param(value, &parameters->integer_check);
     break;
@@ -671,6 +733,10 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     r = set_int32_param(value, &parameters->integer_check_period, 1, INT32_MAX);
     break;
 
+  case PARAM_ISDL_PROP:
+    r = set_bool_param(value, &parameters->isdl_prop);
+    break;
+
   case PARAM_MAX_UPDATE_CONFLICTS:
     r = set_int32_param(value, &z, 1, INT32_MAX);
     if (r == 0) {
@@ -685,6 +751,14 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     }
     break;
 
+  case PARAM_EAGER_ARRAY_LEMMAS:
+    r = set_bool_param(value, &parameters->eager_array_lemmas);
+    break;
+
+  case PARAM_BV_LAZY_BLAST:
+    r = set_bool_param(value, &parameters->bv_lazy_blast);
+    break;
+
   default:
     assert(k == -1);
     r = -1;
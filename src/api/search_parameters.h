@@ -95,6 +95,16 @@ struct param_s {
    *   in a conflict resolution
    * - parameter tclause_size controls the lemma size: only theory lemmas
    *   of size <= tclause_size are turned into learned clauses
+   *
+   * SMT Core inprocessing:
+   * - if inprocessing is true, the core periodically removes subsumed
+   *   learned clauses and shortens learned clauses by vivification
+   *
+   * SMT Core chronological backtracking:
+   * - if chrono_levels is positive, the core backtracks one level
+   *   only when conflict resolution would undo more than chrono_levels
+   *   decision levels
+   * - chrono_levels = 0 disables chronological backtracking
    */
   double   var_decay;       // decay factor for variable activity
   float    randomness;      // probability of a random pick in select_unassigned_literal
@@ -103,6 +113,8 @@ struct param_s {
   float    clause_decay;    // decay factor for learned-clause activity
   bool     cache_tclauses;
   uint32_t tclause_size;
+  bool     inprocessing;
+  uint32_t chrono_levels;
 
   /*
    * EGRAPH PARAMETERS
@@ -148,6 +160,8 @@ struct param_s {
    * - simplex_prop: if true enable propagation via propagation table
    * - adjust_simplex_model: if true, enable adjustment in
    *   reconciliation of the egraph and simplex models
+   * - simplex_float_first: if true, search for a feasible basis in
+   *   floating point before running the exact simplex
    * - integer_check: if true, periodically call the integer solver
    * - max_prop_row_size: limit on the size of the propagation rows
    * - bland_threshold: threshold that triggers switching to Bland's rule
@@ -155,20 +169,39 @@ struct param_s {
    */
   bool     use_simplex_prop;
   bool     adjust_simplex_model;
+  bool     simplex_float_first;
   bool     integer_check;
   uint32_t max_prop_row_size;
   uint32_t bland_threshold;
   int32_t  integer_check_period;
 
+  /*
+   * SPARSE IDL SOLVER PARAMETERS
+   * - isdl_prop: if true, enable theory propagation in the sparse
+   *   difference-logic solver
+   */
+  bool     isdl_prop;
+
   /*
    * ARRAY SOLVER PARAMETERS
    * - max_update_conflicts: limit on the number of update axioms generated
    *   per call to final_check
    * - max_extensionality: limit on the number of extensionality axioms
    *   generated per call to reconcile_model
+   * - eager_array_lemmas: if true, update axioms are also generated
+   *   during propagation (not only in final_check)
    */
   uint32_t max_update_conflicts;
   uint32_t max_extensionality;
+  bool     eager_array_lemmas;
+
+  /*
+   * BITVECTOR SOLVER PARAMETERS
+   * - bv_lazy_blast: if true, wide multiplications and divisions
+   *   are bit-blasted on demand (when the current assignment is
+   *   inconsistent with their definition)
+   */
+  bool     bv_lazy_blast;
 
 };
 
@@ -70,6 +70,8 @@
 #include "api/yval.h"
 
 #include "context/context.h"
+#include "context/context_portfolio.h"
+#include "context/context_snapshot.h"
 
 #include "exists_forall/ef_client.h"
 
@@ -77,9 +79,11 @@
 
 #include "io/model_printer.h"
 #include "io/term_printer.h"
+#include "io/term_snapshot.h"
 #include "io/type_printer.h"
 #include "io/yices_pp.h"
 
+#include "model/bv_local_search.h"
 #include "model/generalization.h"
 #include "model/literal_collector.h"
 #include "model/map_to_model.h"
@@ -125,10 +129,10 @@ typedef void lp_algebraic_number_t;
  ***************************/
 
 
-// rational for building terms: protected by ownership of global lock.
+// rational for building terms: protected by ownership of global lock (write mode).
 static rational_t r0;
 
-// buffer for building bitvector constants: protected by ownership of global lock.
+// buffer for building bitvector constants: protected by ownership of global lock (write mode).
 static bvconstant_t bv0;
 
 /*
@@ -148,6 +152,17 @@ yices_globals_t __yices_globals = {
 
 /*
  * SYNCHRONIZING ACCESS TO GLOBAL TABLE.
+ *
+ * In thread-safe mode, __yices_globals.lock is a reader/writer lock.
+ * Functions that only inspect existing terms or types (e.g., term
+ * exploration, yices_type_of_term, yices_get_term_name) take it in read
+ * mode, so several threads can run them in parallel. Everything else,
+ * including all term constructors, takes it in write mode.
+ *
+ * A function protected by MT_PROTECT_READ must not modify anything
+ * shared. For example, yices_get_term_by_name is not a reader since
+ * symbol-table lookups can reorganize the table, and
+ * yices_term_is_ground updates the free-variable cache.
  */
 
 /*
@@ -159,7 +174,7 @@ yices_globals_t __yices_globals = {
  */
 int32_t yices_obtain_mutex(void){
 #ifdef THREAD_SAFE
-  return get_yices_lock(&__yices_globals.lock);
+  return get_yices_write_lock(&__yices_globals.lock);
 #else
   return 0;
 #endif
@@ -172,7 +187,7 @@ int32_t yices_obtain_mutex(void){
  */
 int32_t yices_release_mutex(void){
 #ifdef THREAD_SAFE
-  return release_yices_lock(&__yices_globals.lock);
+  return release_yices_write_lock(&__yices_globals.lock);
 #else
   return 0;
 #endif
@@ -1020,7 +1035,7 @@ static void init_globals(yices_globals_t *glob) {
   glob->fvars = NULL;
 
 #ifdef THREAD_SAFE
-  create_yices_lock(&(glob->lock));
+  create_yices_rwlock(&(glob->lock));
 #endif
 
 }
@@ -1040,7 +1055,7 @@ static void clear_globals(yices_globals_t *glob) {
   glob->manager = NULL;
 
 #ifdef THREAD_SAFE
-  destroy_yices_lock(&(glob->lock));
+  destroy_yices_rwlock(&(glob->lock));
 #endif
 
 }
@@ -1157,7 +1172,7 @@ static void _o_enable_bvite_offset(void) {
 }
 
 void yices_enable_bvite_offset(void) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_enable_bvite_offset());
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_enable_bvite_offset());
 }
 
 
@@ -1275,7 +1290,7 @@ static void _o_yices_set_out_of_mem_callback(void (*callback)(void)) {
 }
 
 EXPORTED void yices_set_out_of_mem_callback(void (*callback)(void)) {
-  MT_PROTECT_VOID(__yices_globals.lock,_o_yices_set_out_of_mem_callback(callback));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock,_o_yices_set_out_of_mem_callback(callback));
 }
 
 
@@ -2833,7 +2848,7 @@ static bool check_child_idx(term_table_t *terms, term_t t, int32_t i) {
  **********************/
 
 EXPORTED type_t yices_bool_type(void) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_bool_type());
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_bool_type());
 }
 
 type_t _o_yices_bool_type(void) {
@@ -2841,7 +2856,7 @@ type_t _o_yices_bool_type(void) {
 }
 
 EXPORTED type_t yices_int_type(void) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_int_type());
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_int_type());
 }
 
 type_t _o_yices_int_type(void) {
@@ -2849,7 +2864,7 @@ type_t _o_yices_int_type(void) {
 }
 
 EXPORTED type_t yices_real_type(void) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_real_type());
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_real_type());
 }
 
 type_t _o_yices_real_type(void) {
@@ -2857,7 +2872,7 @@ type_t _o_yices_real_type(void) {
 }
 
 EXPORTED type_t yices_bv_type(uint32_t size) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_bv_type(size));
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_bv_type(size));
 }
 
 type_t _o_yices_bv_type(uint32_t size) {
@@ -2878,7 +2893,7 @@ type_t _o_yices_ff_type(mpz_t order) {
 }
 
 EXPORTED type_t yices_new_uninterpreted_type(void) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_new_uninterpreted_type());
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_new_uninterpreted_type());
 }
 
 type_t _o_yices_new_uninterpreted_type(void) {
@@ -2886,7 +2901,7 @@ type_t _o_yices_new_uninterpreted_type(void) {
 }
 
 EXPORTED type_t yices_new_scalar_type(uint32_t card) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_new_scalar_type(card));
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_new_scalar_type(card));
 }
 
 type_t _o_yices_new_scalar_type(uint32_t card) {
@@ -2897,7 +2912,7 @@ type_t _o_yices_new_scalar_type(uint32_t card) {
 }
 
 EXPORTED type_t yices_tuple_type(uint32_t n, const type_t elem[]) {
-  MT_PROTECT(type_t, __yices_globals.lock, _o_yices_tuple_type(n, elem));
+  MT_PROTECT_WRITE(type_t, __yices_globals.lock, _o_yices_tuple_type(n, elem));
 }
 
 type_t _o_yices_tuple_type(uint32_t n, const type_t elem[]) {
@@ -2910,7 +2925,7 @@ type_t _o_yices_tuple_type(uint32_t n, const type_t elem[]) {
 }
 
 EXPORTED type_t yices_function_type(uint32_t n, const type_t dom[], type_t range) {
-  MT_PROTECT( type_t, __yices_globals.lock, _o_yices_function_type(n, dom, range));
+  MT_PROTECT_WRITE( type_t, __yices_globals.lock, _o_yices_function_type(n, dom, range));
 }
 
 type_t _o_yices_function_type(uint32_t n, const type_t dom[], type_t range) {
@@ -3107,7 +3122,7 @@ EXPORTED term_t yices_false(void) {
 }
 
 EXPORTED term_t yices_constant(type_t tau, int32_t index) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_constant(tau, index));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_constant(tau, index));
 }
 
 term_t _o_yices_constant(type_t tau, int32_t index) {
@@ -3119,7 +3134,7 @@ term_t _o_yices_constant(type_t tau, int32_t index) {
 }
 
 EXPORTED term_t yices_new_uninterpreted_term(type_t tau) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_new_uninterpreted_term(tau));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_new_uninterpreted_term(tau));
 }
 
 term_t _o_yices_new_uninterpreted_term(type_t tau) {
@@ -3131,7 +3146,7 @@ term_t _o_yices_new_uninterpreted_term(type_t tau) {
 }
 
 EXPORTED term_t yices_new_variable(type_t tau) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_new_variable(tau));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_new_variable(tau));
 }
 
 term_t _o_yices_new_variable(type_t tau) {
@@ -3148,7 +3163,7 @@ term_t _o_yices_new_variable(type_t tau) {
  * - we apply beta-reduction eagerly here
  */
 EXPORTED term_t yices_application(term_t fun, uint32_t n, const term_t arg[]) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_application(fun, n, arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_application(fun, n, arg));
 }
 
 term_t _o_yices_application(term_t fun, uint32_t n, const term_t arg[]) {
@@ -3205,7 +3220,7 @@ EXPORTED term_t yices_application3(term_t fun, term_t arg1, term_t arg2, term_t
 
 
 EXPORTED term_t yices_ite(term_t cond, term_t then_term, term_t else_term) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_ite(cond, then_term, else_term));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_ite(cond, then_term, else_term));
 }
 
 term_t _o_yices_ite(term_t cond, term_t then_term, term_t else_term) {
@@ -3239,7 +3254,7 @@ term_t _o_yices_ite(term_t cond, term_t then_term, term_t else_term) {
 }
 
 EXPORTED term_t yices_eq(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_eq(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_eq(left, right));
 }
 
 term_t _o_yices_eq(term_t left, term_t right) {
@@ -3251,7 +3266,7 @@ term_t _o_yices_eq(term_t left, term_t right) {
 }
 
 EXPORTED term_t yices_neq(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_neq(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_neq(left, right));
 }
 
 term_t _o_yices_neq(term_t left, term_t right) {
@@ -3267,7 +3282,7 @@ term_t _o_yices_neq(term_t left, term_t right) {
  * BOOLEAN NEGATION
  */
 EXPORTED term_t yices_not(term_t arg) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_not(arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_not(arg));
 }
 
 term_t _o_yices_not(term_t arg) {
@@ -3284,7 +3299,7 @@ term_t _o_yices_not(term_t arg) {
  * OR, AND, and XOR may modify arg
  */
 EXPORTED term_t yices_or(uint32_t n, term_t arg[]) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_or(n, arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_or(n, arg));
 }
 
 term_t _o_yices_or(uint32_t n, term_t arg[]) {
@@ -3307,7 +3322,7 @@ term_t _o_yices_or(uint32_t n, term_t arg[]) {
 }
 
 EXPORTED term_t yices_and(uint32_t n, term_t arg[]) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_and(n, arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_and(n, arg));
 }
 
 term_t _o_yices_and(uint32_t n, term_t arg[]) {
@@ -3330,7 +3345,7 @@ term_t _o_yices_and(uint32_t n, term_t arg[]) {
 }
 
 EXPORTED term_t yices_xor(uint32_t n, term_t arg[]) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_xor(n, arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_xor(n, arg));
 }
 
 term_t _o_yices_xor(uint32_t n, term_t arg[]) {
@@ -3391,7 +3406,7 @@ EXPORTED term_t yices_xor3(term_t t1, term_t t2, term_t t3) {
  * BINARY VERSIONS OF OR/AND/XOR
  */
 EXPORTED term_t yices_or2(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_or2(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_or2(left, right));
 }
 
 term_t _o_yices_or2(term_t left, term_t right) {
@@ -3406,7 +3421,7 @@ term_t _o_yices_or2(term_t left, term_t right) {
 }
 
 EXPORTED term_t yices_and2(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_and2(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_and2(left, right));
 }
 
 term_t _o_yices_and2(term_t left, term_t right) {
@@ -3421,7 +3436,7 @@ term_t _o_yices_and2(term_t left, term_t right) {
 }
 
 EXPORTED term_t yices_xor2(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_xor2(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_xor2(left, right));
 }
 
 term_t _o_yices_xor2(term_t left, term_t right) {
@@ -3437,7 +3452,7 @@ term_t _o_yices_xor2(term_t left, term_t right) {
 
 
 EXPORTED term_t yices_iff(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_iff(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_iff(left, right));
 }
 
 term_t _o_yices_iff(term_t left, term_t right) {
@@ -3452,7 +3467,7 @@ term_t _o_yices_iff(term_t left, term_t right) {
 }
 
 EXPORTED term_t yices_implies(term_t left, term_t right) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_implies(left, right));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_implies(left, right));
 }
 
 term_t _o_yices_implies(term_t left, term_t right) {
@@ -3468,7 +3483,7 @@ term_t _o_yices_implies(term_t left, term_t right) {
 
 
 EXPORTED term_t yices_tuple(uint32_t n, const term_t arg[]) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_tuple(n, arg));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_tuple(n, arg));
 }
 
 term_t _o_yices_tuple(uint32_t n, const term_t arg[]) {
@@ -3488,7 +3503,7 @@ EXPORTED term_t yices_pair(term_t arg1, term_t arg2) {
   aux[0] = arg1;
   aux[1] = arg2;
 
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_tuple(2, aux));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_tuple(2, aux));
 }
 
 EXPORTED term_t yices_triple(term_t arg1, term_t arg2, term_t arg3) {
@@ -3498,13 +3513,13 @@ EXPORTED term_t yices_triple(term_t arg1, term_t arg2, term_t arg3) {
   aux[1] = arg2;
   aux[2] = arg3;
 
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_tuple(3, aux));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_tuple(3, aux));
 }
 
 
 
 EXPORTED term_t yices_select(uint32_t index, term_t tuple) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_select(index, tuple));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_select(index, tuple));
 }
 
 term_t _o_yices_select(uint32_t index, term_t tuple) {
@@ -3517,7 +3532,7 @@ term_t _o_yices_select(uint32_t index, term_t tuple) {
 }
 
 EXPORTED term_t yices_update(term_t fun, uint32_t n, const term_t arg[], term_t new_v) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_update(fun, n, arg, new_v));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_update(fun, n, arg, new_v));
 }
 
 term_t _o_yices_update(term_t fun, uint32_t n, const term_t arg[], term_t new_v) {
@@ -3553,7 +3568,7 @@ EXPORTED term_t yices_update3(term_t fun, term_t arg1, term_t arg2, term_t arg3,
 
 
 EXPORTED term_t yices_distinct(uint32_t n, term_t arg[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_distinct(n, arg));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_distinct(n, arg));
 }
 
 term_t _o_yices_distinct(uint32_t n, term_t arg[]) {
@@ -3567,7 +3582,7 @@ term_t _o_yices_distinct(uint32_t n, term_t arg[]) {
 }
 
 EXPORTED term_t yices_tuple_update(term_t tuple, uint32_t index, term_t new_v) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_tuple_update(tuple, index, new_v));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_tuple_update(tuple, index, new_v));
 }
 
 term_t _o_yices_tuple_update(term_t tuple, uint32_t index, term_t new_v) {
@@ -3580,7 +3595,7 @@ term_t _o_yices_tuple_update(term_t tuple, uint32_t index, term_t new_v) {
 }
 
 EXPORTED term_t yices_forall(uint32_t n, term_t var[], term_t body) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_forall(n, var, body));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_forall(n, var, body));
 }
 
 term_t _o_yices_forall(uint32_t n, term_t var[], term_t body) {
@@ -3596,7 +3611,7 @@ term_t _o_yices_forall(uint32_t n, term_t var[], term_t body) {
 }
 
 EXPORTED term_t yices_exists(uint32_t n, term_t var[], term_t body) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_exists(n, var, body));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_exists(n, var, body));
 }
 
 term_t _o_yices_exists(uint32_t n, term_t var[], term_t body) {
@@ -3612,7 +3627,7 @@ term_t _o_yices_exists(uint32_t n, term_t var[], term_t body) {
 }
 
 EXPORTED term_t yices_lambda(uint32_t n, const term_t var[], term_t body) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_lambda(n, var, body));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_lambda(n, var, body));
 }
 
 term_t _o_yices_lambda(uint32_t n, const term_t var[], term_t body) {
@@ -3638,7 +3653,7 @@ EXPORTED term_t yices_zero(void) {
 }
 
 EXPORTED term_t yices_int32(int32_t val) {
-  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_int32(val));
+  MT_PROTECT_WRITE(term_t, __yices_globals.lock, _o_yices_int32(val));
 }
 
 term_t _o_yices_int32(int32_t val) {
@@ -3648,7 +3663,7 @@ term_t _o_yices_int32(int32_t val) {
 
 
 EXPORTED term_t yices_int64(int64_t val) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_int64(val));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_int64(val));
 }
 
 term_t _o_yices_int64(int64_t val) {
@@ -3661,7 +3676,7 @@ term_t _o_yices_int64(int64_t val) {
  * Rational constants
  */
 EXPORTED term_t yices_rational32(int32_t num, uint32_t den) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_rational32(num, den));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_rational32(num, den));
 }
 
 term_t _o_yices_rational32(int32_t num, uint32_t den) {
@@ -3676,7 +3691,7 @@ term_t _o_yices_rational32(int32_t num, uint32_t den) {
 
 
 EXPORTED term_t yices_rational64(int64_t num, uint64_t den) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_rational64(num, den));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_rational64(num, den));
 }
 
 term_t _o_yices_rational64(int64_t num, uint64_t den) {
@@ -3694,7 +3709,7 @@ term_t _o_yices_rational64(int64_t num, uint64_t den) {
  * Constant from GMP integers or rationals
  */
 EXPORTED term_t yices_mpz(const mpz_t z) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_mpz(z));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_mpz(z));
 }
 
 term_t _o_yices_mpz(const mpz_t z) {
@@ -3708,7 +3723,7 @@ term_t _o_yices_mpz(const mpz_t z) {
 }
 
 EXPORTED term_t yices_mpq(const mpq_t q) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_mpq(q));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_mpq(q));
 }
 
 term_t _o_yices_mpq(const mpq_t q) {
@@ -3738,7 +3753,7 @@ term_t _o_yices_mpq(const mpq_t q) {
  */
 
 EXPORTED term_t yices_parse_rational(const char *s) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_parse_rational(s));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_parse_rational(s));
 }
 
 term_t _o_yices_parse_rational(const char *s) {
@@ -3778,7 +3793,7 @@ term_t _o_yices_parse_rational(const char *s) {
  * code = INVALID_FLOAT_FORMAT
  */
 EXPORTED term_t yices_parse_float(const char *s) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_parse_float(s));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_parse_float(s));
 }
 
 term_t _o_yices_parse_float(const char *s) {
@@ -3805,7 +3820,7 @@ term_t _o_yices_parse_float(const char *s) {
  * Add t1 and t2
  */
 EXPORTED term_t yices_add(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_add(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_add(t1, t2));
 }
 
 term_t _o_yices_add(term_t t1, term_t t2) {
@@ -3830,7 +3845,7 @@ term_t _o_yices_add(term_t t1, term_t t2) {
  * Subtract t2 from t1
  */
 EXPORTED term_t yices_sub(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_sub(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_sub(t1, t2));
 }
 
 term_t _o_yices_sub(term_t t1, term_t t2) {
@@ -3855,7 +3870,7 @@ term_t _o_yices_sub(term_t t1, term_t t2) {
  * Negate t1
  */
 EXPORTED term_t yices_neg(term_t t1) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_neg(t1));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_neg(t1));
 }
 
 term_t _o_yices_neg(term_t t1) {
@@ -3880,7 +3895,7 @@ term_t _o_yices_neg(term_t t1) {
  * Multiply t1 and t2
  */
 EXPORTED term_t yices_mul(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_mul(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_mul(t1, t2));
 }
 
 term_t _o_yices_mul(term_t t1, term_t t2) {
@@ -3906,7 +3921,7 @@ term_t _o_yices_mul(term_t t1, term_t t2) {
  * Compute the square of t1
  */
 EXPORTED term_t yices_square(term_t t1) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_square(t1));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_square(t1));
 }
 
 term_t _o_yices_square(term_t t1) {
@@ -3933,7 +3948,7 @@ term_t _o_yices_square(term_t t1) {
  * Compute t1 ^ d
  */
 EXPORTED term_t yices_power(term_t t1, uint32_t d) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_power(t1, d));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_power(t1, d));
 }
 
 term_t _o_yices_power(term_t t1, uint32_t d) {
@@ -3959,7 +3974,7 @@ term_t _o_yices_power(term_t t1, uint32_t d) {
  * Sum of n terms t[0] ... t[n-1]
  */
 EXPORTED term_t yices_sum(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_sum(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_sum(n, t));
 }
 
 term_t _o_yices_sum(uint32_t n, const term_t t[]) {
@@ -3987,7 +4002,7 @@ term_t _o_yices_sum(uint32_t n, const term_t t[]) {
  * Product of n terms t[0] ... t[n-1]
  */
 EXPORTED term_t yices_product(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_product(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_product(n, t));
 }
 
 term_t _o_yices_product(uint32_t n, const term_t t[]) {
@@ -4031,7 +4046,7 @@ term_t _o_yices_product(uint32_t n, const term_t t[]) {
  * DIVISION
  */
 EXPORTED term_t yices_division(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_division(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_division(t1, t2));
 }
 
 term_t _o_yices_division(term_t t1, term_t t2) {
@@ -4052,7 +4067,7 @@ term_t _o_yices_division(term_t t1, term_t t2) {
  **************************/
 
 EXPORTED term_t yices_idiv(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_idiv(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_idiv(t1, t2));
 }
 
 term_t _o_yices_idiv(term_t t1, term_t t2) {
@@ -4068,7 +4083,7 @@ term_t _o_yices_idiv(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_imod(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_imod(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_imod(t1, t2));
 }
 
 term_t _o_yices_imod(term_t t1, term_t t2) {
@@ -4086,7 +4101,7 @@ term_t _o_yices_imod(term_t t1, term_t t2) {
  * Divisibility test: check whether t1 divides t2
  */
 EXPORTED term_t yices_divides_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_divides_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_divides_atom(t1, t2));
 }
 
 term_t _o_yices_divides_atom(term_t t1, term_t t2) {
@@ -4104,7 +4119,7 @@ term_t _o_yices_divides_atom(term_t t1, term_t t2) {
  * Integer test
  */
 EXPORTED term_t yices_is_int_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_is_int_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_is_int_atom(t));
 }
 
 term_t _o_yices_is_int_atom(term_t t) {
@@ -4121,7 +4136,7 @@ term_t _o_yices_is_int_atom(term_t t) {
  * ABS/FLOOR/CEIL
  */
 EXPORTED term_t yices_abs(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_abs(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_abs(t));
 }
 
 term_t _o_yices_abs(term_t t) {
@@ -4134,7 +4149,7 @@ term_t _o_yices_abs(term_t t) {
 }
 
 EXPORTED term_t yices_floor(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_floor(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_floor(t));
 }
 
 term_t _o_yices_floor(term_t t) {
@@ -4147,7 +4162,7 @@ term_t _o_yices_floor(term_t t) {
 }
 
 EXPORTED term_t yices_ceil(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_ceil(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_ceil(t));
 }
 
 term_t _o_yices_ceil(term_t t) {
@@ -4168,7 +4183,7 @@ term_t _o_yices_ceil(term_t t) {
  * integer coefficients
  */
 EXPORTED term_t yices_poly_int32(uint32_t n, const int32_t a[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_int32(n, a, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_int32(n, a, t));
 }
 
 term_t _o_yices_poly_int32(uint32_t n, const int32_t a[], const term_t t[]) {
@@ -4193,7 +4208,7 @@ term_t _o_yices_poly_int32(uint32_t n, const int32_t a[], const term_t t[]) {
 }
 
 EXPORTED term_t yices_poly_int64(uint32_t n, const int64_t a[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_int64(n, a, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_int64(n, a, t));
 }
 
 term_t _o_yices_poly_int64(uint32_t n, const int64_t a[], const term_t t[]) {
@@ -4229,7 +4244,7 @@ term_t _o_yices_poly_int64(uint32_t n, const int64_t a[], const term_t t[]) {
  *   code = DIVISION_BY_ZERO
  */
 EXPORTED term_t yices_poly_rational32(uint32_t n, const int32_t num[], const uint32_t den[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_rational32(n, num, den, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_rational32(n, num, den, t));
 }
 
 term_t _o_yices_poly_rational32(uint32_t n, const int32_t num[], const uint32_t den[], const term_t t[]) {
@@ -4255,7 +4270,7 @@ term_t _o_yices_poly_rational32(uint32_t n, const int32_t num[], const uint32_t
 }
 
 EXPORTED term_t yices_poly_rational64(uint32_t n, const int64_t num[], const uint64_t den[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_rational64(n, num, den, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_rational64(n, num, den, t));
 }
 
 term_t _o_yices_poly_rational64(uint32_t n, const int64_t num[], const uint64_t den[], const term_t t[]) {
@@ -4285,7 +4300,7 @@ term_t _o_yices_poly_rational64(uint32_t n, const int64_t num[], const uint64_t
  * GMP integers and rationals
  */
 EXPORTED term_t yices_poly_mpz(uint32_t n, const mpz_t z[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_mpz(n, z, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_mpz(n, z, t));
 }
 
 term_t _o_yices_poly_mpz(uint32_t n, const mpz_t z[], const term_t t[]) {
@@ -4314,7 +4329,7 @@ term_t _o_yices_poly_mpz(uint32_t n, const mpz_t z[], const term_t t[]) {
 
 
 EXPORTED term_t yices_poly_mpq(uint32_t n, const mpq_t q[], const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_poly_mpq(n, q, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_poly_mpq(n, q, t));
 }
 
 term_t _o_yices_poly_mpq(uint32_t n, const mpq_t q[], const term_t t[]) {
@@ -4350,7 +4365,7 @@ term_t _o_yices_poly_mpq(uint32_t n, const mpq_t q[], const term_t t[]) {
  *********************/
 
 EXPORTED term_t yices_arith_eq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_eq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_eq_atom(t1, t2));
 }
 
 term_t _o_yices_arith_eq_atom(term_t t1, term_t t2) {
@@ -4361,7 +4376,7 @@ term_t _o_yices_arith_eq_atom(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_arith_neq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_neq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_neq_atom(t1, t2));
 }
 
 term_t _o_yices_arith_neq_atom(term_t t1, term_t t2) {
@@ -4372,7 +4387,7 @@ term_t _o_yices_arith_neq_atom(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_arith_geq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_geq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_geq_atom(t1, t2));
 }
 
 term_t _o_yices_arith_geq_atom(term_t t1, term_t t2) {
@@ -4383,7 +4398,7 @@ term_t _o_yices_arith_geq_atom(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_arith_lt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_lt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_lt_atom(t1, t2));
 }
 
 term_t _o_yices_arith_lt_atom(term_t t1, term_t t2) {
@@ -4394,7 +4409,7 @@ term_t _o_yices_arith_lt_atom(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_arith_gt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_gt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_gt_atom(t1, t2));
 }
 
 term_t _o_yices_arith_gt_atom(term_t t1, term_t t2) {
@@ -4405,7 +4420,7 @@ term_t _o_yices_arith_gt_atom(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_arith_leq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_leq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_leq_atom(t1, t2));
 }
 
 term_t _o_yices_arith_leq_atom(term_t t1, term_t t2) {
@@ -4420,7 +4435,7 @@ term_t _o_yices_arith_leq_atom(term_t t1, term_t t2) {
  * Comparison with zero
  */
 EXPORTED term_t yices_arith_eq0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_eq0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_eq0_atom(t));
 }
 
 term_t _o_yices_arith_eq0_atom(term_t t) {
@@ -4432,7 +4447,7 @@ term_t _o_yices_arith_eq0_atom(term_t t) {
 }
 
 EXPORTED term_t yices_arith_neq0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_neq0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_neq0_atom(t));
 }
 
 term_t _o_yices_arith_neq0_atom(term_t t) {
@@ -4444,7 +4459,7 @@ term_t _o_yices_arith_neq0_atom(term_t t) {
 }
 
 EXPORTED term_t yices_arith_geq0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_geq0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_geq0_atom(t));
 }
 
 term_t _o_yices_arith_geq0_atom(term_t t) {
@@ -4456,7 +4471,7 @@ term_t _o_yices_arith_geq0_atom(term_t t) {
 }
 
 EXPORTED term_t yices_arith_leq0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_leq0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_leq0_atom(t));
 }
 
 term_t _o_yices_arith_leq0_atom(term_t t) {
@@ -4468,7 +4483,7 @@ term_t _o_yices_arith_leq0_atom(term_t t) {
 }
 
 EXPORTED term_t yices_arith_gt0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_gt0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_gt0_atom(t));
 }
 
 term_t _o_yices_arith_gt0_atom(term_t t) {
@@ -4480,7 +4495,7 @@ term_t _o_yices_arith_gt0_atom(term_t t) {
 }
 
 EXPORTED term_t yices_arith_lt0_atom(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_arith_lt0_atom(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_arith_lt0_atom(t));
 }
 
 term_t _o_yices_arith_lt0_atom(term_t t) {
@@ -4498,7 +4513,7 @@ term_t _o_yices_arith_lt0_atom(term_t t) {
  *************************/
 
 EXPORTED term_t yices_bvconst_uint32(uint32_t n, uint32_t x) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_uint32(n,x));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_uint32(n,x));
 }
 
 term_t _o_yices_bvconst_uint32(uint32_t n, uint32_t x) {
@@ -4513,7 +4528,7 @@ term_t _o_yices_bvconst_uint32(uint32_t n, uint32_t x) {
 }
 
 EXPORTED term_t yices_bvconst_uint64(uint32_t n, uint64_t x) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_uint64(n,x));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_uint64(n,x));
 }
 
 term_t _o_yices_bvconst_uint64(uint32_t n, uint64_t x) {
@@ -4528,7 +4543,7 @@ term_t _o_yices_bvconst_uint64(uint32_t n, uint64_t x) {
 }
 
 EXPORTED term_t yices_bvconst_int32(uint32_t n, int32_t x) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_int32(n,x));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_int32(n,x));
 }
 
 term_t _o_yices_bvconst_int32(uint32_t n, int32_t x) {
@@ -4543,7 +4558,7 @@ term_t _o_yices_bvconst_int32(uint32_t n, int32_t x) {
 }
 
 EXPORTED term_t yices_bvconst_int64(uint32_t n, int64_t x) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_int64(n,x));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_int64(n,x));
 }
 
 term_t _o_yices_bvconst_int64(uint32_t n, int64_t x) {
@@ -4558,7 +4573,7 @@ term_t _o_yices_bvconst_int64(uint32_t n, int64_t x) {
 }
 
 EXPORTED term_t yices_bvconst_mpz(uint32_t n, const mpz_t x) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_mpz(n,x));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_mpz(n,x));
 }
 
 term_t _o_yices_bvconst_mpz(uint32_t n, const mpz_t x) {
@@ -4594,7 +4609,7 @@ term_t _o_yices_bvconst_mpz(uint32_t n, const mpz_t x) {
  * bvconst_minus_one: set all bits to 1
  */
 EXPORTED term_t yices_bvconst_zero(uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_zero(n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_zero(n));
 }
 
 term_t _o_yices_bvconst_zero(uint32_t n) {
@@ -4608,7 +4623,7 @@ term_t _o_yices_bvconst_zero(uint32_t n) {
 }
 
 EXPORTED term_t yices_bvconst_one(uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_one(n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_one(n));
 }
 
 term_t _o_yices_bvconst_one(uint32_t n) {
@@ -4623,7 +4638,7 @@ term_t _o_yices_bvconst_one(uint32_t n) {
 }
 
 EXPORTED term_t yices_bvconst_minus_one(uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_minus_one(n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_minus_one(n));
 }
 
 term_t _o_yices_bvconst_minus_one(uint32_t n) {
@@ -4643,7 +4658,7 @@ term_t _o_yices_bvconst_minus_one(uint32_t n) {
  * - a[i] != 0 --> bit i = 1
  */
 EXPORTED term_t yices_bvconst_from_array(uint32_t n, const int32_t a[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconst_from_array(n,a));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconst_from_array(n,a));
 }
 
 term_t _o_yices_bvconst_from_array(uint32_t n, const int32_t a[]) {
@@ -4666,7 +4681,7 @@ term_t _o_yices_bvconst_from_array(uint32_t n, const int32_t a[]) {
  *   is the high-order bit.
  */
 EXPORTED term_t yices_parse_bvbin(const char *s) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_parse_bvbin(s));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_parse_bvbin(s));
 }
 
 term_t _o_yices_parse_bvbin(const char *s) {
@@ -4707,7 +4722,7 @@ term_t _o_yices_parse_bvbin(const char *s) {
  *   the four high-order bits).
  */
 EXPORTED term_t yices_parse_bvhex(const char *s) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_parse_bvhex(s));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_parse_bvhex(s));
 }
 
 term_t _o_yices_parse_bvhex(const char *s) {
@@ -4779,7 +4794,7 @@ term_t mk_bvadd(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvadd(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvadd(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvadd(t1, t2));
 }
 
 term_t _o_yices_bvadd(term_t t1, term_t t2) {
@@ -4820,7 +4835,7 @@ term_t mk_bvsub(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvsub(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsub(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsub(t1, t2));
 }
 
 term_t _o_yices_bvsub(term_t t1, term_t t2) {
@@ -4861,7 +4876,7 @@ term_t mk_bvneg(term_t t1) {
 }
 
 EXPORTED term_t yices_bvneg(term_t t1) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvneg(t1));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvneg(t1));
 }
 
 term_t _o_yices_bvneg(term_t t1) {
@@ -4903,7 +4918,7 @@ term_t mk_bvmul(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvmul(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvmul(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvmul(t1, t2));
 }
 
 term_t _o_yices_bvmul(term_t t1, term_t t2) {
@@ -4951,7 +4966,7 @@ static term_t mk_bvsquare(term_t t1) {
 }
 
 EXPORTED term_t yices_bvsquare(term_t t1) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsquare(t1));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsquare(t1));
 }
 
 term_t _o_yices_bvsquare(term_t t1) {
@@ -5004,7 +5019,7 @@ static term_t mk_bvpower(term_t t1, uint32_t d) {
 }
 
 EXPORTED term_t yices_bvpower(term_t t1, uint32_t d) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvpower(t1, d));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvpower(t1, d));
 }
 
 term_t _o_yices_bvpower(term_t t1, uint32_t d) {
@@ -5061,7 +5076,7 @@ static term_t mk_bvsum(uint32_t n, const term_t t[]) {
 }
 
 EXPORTED term_t yices_bvsum(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsum(n,t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsum(n,t));
 }
 
 term_t _o_yices_bvsum(uint32_t n, const term_t t[]) {
@@ -5111,7 +5126,7 @@ static term_t mk_bvproduct(uint32_t n, const term_t t[]) {
 }
 
 EXPORTED term_t yices_bvproduct(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvproduct(n,t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvproduct(n,t));
 }
 
 term_t _o_yices_bvproduct(uint32_t n, const term_t t[]) {
@@ -5157,7 +5172,7 @@ term_t _o_yices_bvproduct(uint32_t n, const term_t t[]) {
 
 
 EXPORTED term_t yices_bvnot(term_t t1) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvnot(t1));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvnot(t1));
 }
 
 term_t _o_yices_bvnot(term_t t1) {
@@ -5180,7 +5195,7 @@ term_t _o_yices_bvnot(term_t t1) {
 
 
 EXPORTED term_t yices_bvnand(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvnand(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvnand(t1, t2));
 }
 
 term_t _o_yices_bvnand(term_t t1, term_t t2) {
@@ -5201,7 +5216,7 @@ term_t _o_yices_bvnand(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvnor(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvnor(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvnor(t1, t2));
 }
 
 term_t _o_yices_bvnor(term_t t1, term_t t2) {
@@ -5222,7 +5237,7 @@ term_t _o_yices_bvnor(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvxnor(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvxnor(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvxnor(t1, t2));
 }
 
 term_t _o_yices_bvxnor(term_t t1, term_t t2) {
@@ -5248,7 +5263,7 @@ term_t _o_yices_bvxnor(term_t t1, term_t t2) {
  ***********************************/
 
 EXPORTED term_t yices_bvand(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvand(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvand(n, t));
 }
 
 term_t _o_yices_bvand(uint32_t n, const term_t t[]) {
@@ -5274,7 +5289,7 @@ term_t _o_yices_bvand(uint32_t n, const term_t t[]) {
 }
 
 EXPORTED term_t yices_bvor(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvor(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvor(n, t));
 }
 
 term_t _o_yices_bvor(uint32_t n, const term_t t[]) {
@@ -5300,7 +5315,7 @@ term_t _o_yices_bvor(uint32_t n, const term_t t[]) {
 }
 
 EXPORTED term_t yices_bvxor(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvxor(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvxor(n, t));
 }
 
 term_t _o_yices_bvxor(uint32_t n, const term_t t[]) {
@@ -5327,7 +5342,7 @@ term_t _o_yices_bvxor(uint32_t n, const term_t t[]) {
 
 
 EXPORTED term_t yices_bvand2(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvand2(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvand2(t1, t2));
 }
 
 term_t _o_yices_bvand2(term_t t1, term_t t2) {
@@ -5347,7 +5362,7 @@ term_t _o_yices_bvand2(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvor2(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvor2(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvor2(t1, t2));
 }
 
 term_t _o_yices_bvor2(term_t t1, term_t t2) {
@@ -5367,7 +5382,7 @@ term_t _o_yices_bvor2(term_t t1, term_t t2) {
 }
 
 EXPORTED term_t yices_bvxor2(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvxor2(t1,t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvxor2(t1,t2));
 }
 
 term_t _o_yices_bvxor2(term_t t1, term_t t2) {
@@ -5450,7 +5465,7 @@ EXPORTED term_t yices_bvxor3(term_t t1, term_t t2, term_t t3) {
  *   badval = n
  */
 EXPORTED term_t yices_shift_left0(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_shift_left0(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_shift_left0(t, n));
 }
 
 term_t _o_yices_shift_left0(term_t t, uint32_t n) {
@@ -5473,7 +5488,7 @@ term_t _o_yices_shift_left0(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_shift_left1(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_shift_left1(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_shift_left1(t, n));
 }
 
 term_t _o_yices_shift_left1(term_t t, uint32_t n) {
@@ -5496,7 +5511,7 @@ term_t _o_yices_shift_left1(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_shift_right0(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_shift_right0(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_shift_right0(t, n));
 }
 
 term_t _o_yices_shift_right0(term_t t, uint32_t n) {
@@ -5519,7 +5534,7 @@ term_t _o_yices_shift_right0(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_shift_right1(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_shift_right1(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_shift_right1(t, n));
 }
 
 term_t _o_yices_shift_right1(term_t t, uint32_t n) {
@@ -5542,7 +5557,7 @@ term_t _o_yices_shift_right1(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_ashift_right(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_ashift_right(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_ashift_right(t, n));
 }
 
 term_t _o_yices_ashift_right(term_t t, uint32_t n) {
@@ -5565,7 +5580,7 @@ term_t _o_yices_ashift_right(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_rotate_left(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_rotate_left(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_rotate_left(t, n));
 }
 
 term_t _o_yices_rotate_left(term_t t, uint32_t n) {
@@ -5590,7 +5605,7 @@ term_t _o_yices_rotate_left(term_t t, uint32_t n) {
 }
 
 EXPORTED term_t yices_rotate_right(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_rotate_right(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_rotate_right(t, n));
 }
 
 term_t _o_yices_rotate_right(term_t t, uint32_t n) {
@@ -5639,7 +5654,7 @@ term_t _o_yices_rotate_right(term_t t, uint32_t n) {
  *   code = INVALID_BVEXTRACT
  */
 EXPORTED term_t yices_bvextract(term_t t, uint32_t i, uint32_t j) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvextract(t, i, j));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvextract(t, i, j));
 }
 
 term_t _o_yices_bvextract(term_t t, uint32_t i, uint32_t j) {
@@ -5686,7 +5701,7 @@ term_t _o_yices_bvextract(term_t t, uint32_t i, uint32_t j) {
  *   badval = n1 + n2 (n1 = size of t1, n2 = size of t2)
  */
 EXPORTED term_t yices_bvconcat2(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconcat2(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconcat2(t1, t2));
 }
 
 term_t _o_yices_bvconcat2(term_t t1, term_t t2) {
@@ -5715,7 +5730,7 @@ term_t _o_yices_bvconcat2(term_t t1, term_t t2) {
  * Generic form
  */
 EXPORTED term_t yices_bvconcat(uint32_t n, const term_t t[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvconcat(n, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvconcat(n, t));
 }
 
 term_t _o_yices_bvconcat(uint32_t n, const term_t t[]) {
@@ -5775,7 +5790,7 @@ term_t _o_yices_bvconcat(uint32_t n, const term_t t[]) {
  *   badval = n * bitsize of t
  */
 EXPORTED term_t yices_bvrepeat(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvrepeat(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvrepeat(t, n));
 }
 
 term_t _o_yices_bvrepeat(term_t t, uint32_t n) {
@@ -5826,7 +5841,7 @@ term_t _o_yices_bvrepeat(term_t t, uint32_t n) {
  *   badval = n + bitsize of t
  */
 EXPORTED term_t yices_sign_extend(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock,_o_yices_sign_extend(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock,_o_yices_sign_extend(t, n));
 }
 
 term_t _o_yices_sign_extend(term_t t, uint32_t n) {
@@ -5877,7 +5892,7 @@ term_t _o_yices_sign_extend(term_t t, uint32_t n) {
  *   badval = n + bitsize of t
  */
 EXPORTED term_t yices_zero_extend(term_t t, uint32_t n) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_zero_extend(t, n));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_zero_extend(t, n));
 }
 
 term_t _o_yices_zero_extend(term_t t, uint32_t n) {
@@ -5927,7 +5942,7 @@ term_t _o_yices_zero_extend(term_t t, uint32_t n) {
  *   term1 = t
  */
 EXPORTED term_t yices_redand(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_redand(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_redand(t));
 }
 
 term_t _o_yices_redand(term_t t) {
@@ -5948,7 +5963,7 @@ term_t _o_yices_redand(term_t t) {
 }
 
 EXPORTED term_t yices_redor(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_redor(t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_redor(t));
 }
 
 term_t _o_yices_redor(term_t t) {
@@ -5991,7 +6006,7 @@ term_t _o_yices_redor(term_t t) {
  *   type2 = type of t2
  */
 EXPORTED term_t yices_redcomp(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_redcomp(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_redcomp(t1, t2));
 }
 
 term_t _o_yices_redcomp(term_t t1, term_t t2) {
@@ -6019,7 +6034,7 @@ term_t _o_yices_redcomp(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvshl(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvshl(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvshl(t1, t2));
 }
 
 term_t _o_yices_bvshl(term_t t1, term_t t2) {
@@ -6032,7 +6047,7 @@ term_t _o_yices_bvshl(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvlshr(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvlshr(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvlshr(t1, t2));
 }
 
 term_t _o_yices_bvlshr(term_t t1, term_t t2) {
@@ -6045,7 +6060,7 @@ term_t _o_yices_bvlshr(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvashr(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvashr(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvashr(t1, t2));
 }
 
 term_t _o_yices_bvashr(term_t t1, term_t t2) {
@@ -6065,7 +6080,7 @@ term_t _o_yices_bvashr(term_t t1, term_t t2) {
  *********************************/
 
 EXPORTED term_t yices_bvdiv(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvdiv(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvdiv(t1, t2));
 }
 
 term_t _o_yices_bvdiv(term_t t1, term_t t2) {
@@ -6077,7 +6092,7 @@ term_t _o_yices_bvdiv(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvrem(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvrem(t1,t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvrem(t1,t2));
 }
 
 term_t _o_yices_bvrem(term_t t1, term_t t2) {
@@ -6089,7 +6104,7 @@ term_t _o_yices_bvrem(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsdiv(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock,  _o_yices_bvsdiv(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock,  _o_yices_bvsdiv(t1, t2));
 }
 
 term_t _o_yices_bvsdiv(term_t t1, term_t t2) {
@@ -6101,7 +6116,7 @@ term_t _o_yices_bvsdiv(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsrem(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsrem(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsrem(t1, t2));
 }
 
 term_t _o_yices_bvsrem(term_t t1, term_t t2) {
@@ -6113,7 +6128,7 @@ term_t _o_yices_bvsrem(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsmod(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsmod(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsmod(t1, t2));
 }
 
 term_t _o_yices_bvsmod(term_t t1, term_t t2) {
@@ -6147,7 +6162,7 @@ term_t _o_yices_bvsmod(term_t t1, term_t t2) {
  *    index = i
  */
 EXPORTED term_t yices_bvarray(uint32_t n, const term_t arg[]) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvarray(n, arg));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvarray(n, arg));
 }
 
 term_t _o_yices_bvarray(uint32_t n, const term_t arg[]) {
@@ -6177,7 +6192,7 @@ term_t _o_yices_bvarray(uint32_t n, const term_t arg[]) {
  *    code = INVALID_BVEXTRACT
  */
 EXPORTED term_t yices_bitextract(term_t t, uint32_t i) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bitextract(t, i));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bitextract(t, i));
 }
 
 term_t _o_yices_bitextract(term_t t, uint32_t i) {
@@ -6197,7 +6212,7 @@ term_t _o_yices_bitextract(term_t t, uint32_t i) {
  ********************/
 
 EXPORTED term_t yices_bveq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bveq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bveq_atom(t1, t2));
 }
 
 term_t _o_yices_bveq_atom(term_t t1, term_t t2) {
@@ -6209,7 +6224,7 @@ term_t _o_yices_bveq_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvneq_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvneq_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvneq_atom(t1, t2));
 }
 
 term_t _o_yices_bvneq_atom(term_t t1, term_t t2) {
@@ -6221,7 +6236,7 @@ term_t _o_yices_bvneq_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvge_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvge_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvge_atom(t1, t2));
 }
 
 term_t _o_yices_bvge_atom(term_t t1, term_t t2) {
@@ -6233,7 +6248,7 @@ term_t _o_yices_bvge_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvgt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvgt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvgt_atom(t1, t2));
 }
 
 term_t _o_yices_bvgt_atom(term_t t1, term_t t2) {
@@ -6245,7 +6260,7 @@ term_t _o_yices_bvgt_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvle_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvle_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvle_atom(t1, t2));
 }
 
 term_t _o_yices_bvle_atom(term_t t1, term_t t2) {
@@ -6257,7 +6272,7 @@ term_t _o_yices_bvle_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvlt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock,  _o_yices_bvlt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock,  _o_yices_bvlt_atom(t1, t2));
 }
 
 term_t _o_yices_bvlt_atom(term_t t1, term_t t2) {
@@ -6269,7 +6284,7 @@ term_t _o_yices_bvlt_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsge_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsge_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsge_atom(t1, t2));
 }
 
 term_t _o_yices_bvsge_atom(term_t t1, term_t t2) {
@@ -6281,7 +6296,7 @@ term_t _o_yices_bvsge_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsgt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsgt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsgt_atom(t1, t2));
 }
 
 term_t _o_yices_bvsgt_atom(term_t t1, term_t t2) {
@@ -6293,7 +6308,7 @@ term_t _o_yices_bvsgt_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvsle_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvsle_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvsle_atom(t1, t2));
 }
 
 term_t _o_yices_bvsle_atom(term_t t1, term_t t2) {
@@ -6305,7 +6320,7 @@ term_t _o_yices_bvsle_atom(term_t t1, term_t t2) {
 
 
 EXPORTED term_t yices_bvslt_atom(term_t t1, term_t t2) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_bvslt_atom(t1, t2));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_bvslt_atom(t1, t2));
 }
 
 term_t _o_yices_bvslt_atom(term_t t1, term_t t2) {
@@ -6327,7 +6342,7 @@ term_t _o_yices_bvslt_atom(term_t t1, term_t t2) {
  * - width, height, offset = print area
  */
 EXPORTED int32_t yices_pp_type(FILE *f, type_t tau, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_pp_type(f, tau, width, height, offset));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_pp_type(f, tau, width, height, offset));
 }
 
 int32_t _o_yices_pp_type(FILE *f, type_t tau, uint32_t width, uint32_t height, uint32_t offset) {
@@ -6387,7 +6402,7 @@ EXPORTED int32_t yices_pp_type_fd(int fd, type_t tau, uint32_t width, uint32_t h
  * - width, height, offset = print area
  */
 EXPORTED int32_t yices_pp_term(FILE *f, term_t t, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_pp_term(f, t, width, height, offset));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_pp_term(f, t, width, height, offset));
 }
 
 int32_t _o_yices_pp_term(FILE *f, term_t t, uint32_t width, uint32_t height, uint32_t offset) {
@@ -6445,7 +6460,7 @@ EXPORTED int32_t yices_pp_term_fd(int fd, term_t t, uint32_t width, uint32_t hei
  * - width, height, offset = print area
  */
 EXPORTED int32_t yices_pp_term_array(FILE *f, uint32_t n, const term_t a[], uint32_t width, uint32_t height, uint32_t offset, int32_t horiz) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_pp_term_array(f, n, a, width, height, offset, horiz));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_pp_term_array(f, n, a, width, height, offset, horiz));
 }
 
 int32_t _o_yices_pp_term_array(FILE *f, uint32_t n, const term_t a[], uint32_t width, uint32_t height, uint32_t offset, int32_t horiz) {
@@ -6511,7 +6526,7 @@ EXPORTED int32_t yices_pp_term_array_fd(int fd, uint32_t n, const term_t a[], ui
  * Conversion to strings
  */
 EXPORTED char *yices_type_to_string(type_t tau, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(char*,  __yices_globals.lock, _o_yices_type_to_string(tau, width, height, offset));
+  MT_PROTECT_WRITE(char*,  __yices_globals.lock, _o_yices_type_to_string(tau, width, height, offset));
 }
 
 char *_o_yices_type_to_string(type_t tau, uint32_t width, uint32_t height, uint32_t offset) {
@@ -6544,7 +6559,7 @@ char *_o_yices_type_to_string(type_t tau, uint32_t width, uint32_t height, uint3
 }
 
 EXPORTED char *yices_term_to_string(term_t t, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(char*,  __yices_globals.lock, _o_yices_term_to_string(t, width, height, offset));
+  MT_PROTECT_WRITE(char*,  __yices_globals.lock, _o_yices_term_to_string(t, width, height, offset));
 }
 
 char *_o_yices_term_to_string(term_t t, uint32_t width, uint32_t height, uint32_t offset) {
@@ -6599,7 +6614,7 @@ EXPORTED void yices_free_string(char *s) {
  *   type1 = tau
  */
 EXPORTED int32_t yices_type_is_bool(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_bool(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_bool(tau));
 }
 
 int32_t _o_yices_type_is_bool(type_t tau) {
@@ -6607,7 +6622,7 @@ int32_t _o_yices_type_is_bool(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_int(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_int(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_int(tau));
 }
 
 int32_t _o_yices_type_is_int(type_t tau) {
@@ -6615,7 +6630,7 @@ int32_t _o_yices_type_is_int(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_real(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_real(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_real(tau));
 }
 
 int32_t _o_yices_type_is_real(type_t tau) {
@@ -6623,7 +6638,7 @@ int32_t _o_yices_type_is_real(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_arithmetic(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_arithmetic(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_arithmetic(tau));
 }
 
 int32_t _o_yices_type_is_arithmetic(type_t tau) {
@@ -6631,7 +6646,7 @@ int32_t _o_yices_type_is_arithmetic(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_bitvector(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_bitvector(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_bitvector(tau));
 }
 
 int32_t _o_yices_type_is_bitvector(type_t tau) {
@@ -6639,7 +6654,7 @@ int32_t _o_yices_type_is_bitvector(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_tuple(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_tuple(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_tuple(tau));
 }
 
 int32_t _o_yices_type_is_tuple(type_t tau) {
@@ -6647,7 +6662,7 @@ int32_t _o_yices_type_is_tuple(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_function(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_function(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_function(tau));
 }
 
 int32_t _o_yices_type_is_function(type_t tau) {
@@ -6655,7 +6670,7 @@ int32_t _o_yices_type_is_function(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_scalar(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_scalar(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_scalar(tau));
 }
 
 int32_t _o_yices_type_is_scalar(type_t tau) {
@@ -6663,7 +6678,7 @@ int32_t _o_yices_type_is_scalar(type_t tau) {
 }
 
 EXPORTED int32_t yices_type_is_uninterpreted(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_is_uninterpreted(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_is_uninterpreted(tau));
 }
 
 int32_t _o_yices_type_is_uninterpreted(type_t tau) {
@@ -6681,7 +6696,7 @@ int32_t _o_yices_type_is_uninterpreted(type_t tau) {
  *   type1 = tau or sigma
  */
 EXPORTED int32_t yices_test_subtype(type_t tau, type_t sigma) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_test_subtype(tau, sigma));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_test_subtype(tau, sigma));
 }
 
 int32_t _o_yices_test_subtype(type_t tau, type_t sigma) {
@@ -6699,7 +6714,7 @@ int32_t _o_yices_test_subtype(type_t tau, type_t sigma) {
  *   type1 = tau or sigma
  */
 EXPORTED int32_t yices_compatible_types(type_t tau, type_t sigma) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_compatible_types(tau, sigma));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_compatible_types(tau, sigma));
 }
 
 int32_t _o_yices_compatible_types(type_t tau, type_t sigma) {
@@ -6721,7 +6736,7 @@ int32_t _o_yices_compatible_types(type_t tau, type_t sigma) {
  *    type1 = tau
  */
 EXPORTED uint32_t yices_bvtype_size(type_t tau) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_bvtype_size(tau));
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_bvtype_size(tau));
 }
 
 uint32_t _o_yices_bvtype_size(type_t tau) {
@@ -6738,7 +6753,7 @@ uint32_t _o_yices_bvtype_size(type_t tau) {
  * - return 0 if there's an error
  */
 EXPORTED uint32_t yices_scalar_type_card(type_t tau) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_scalar_type_card(tau));
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_scalar_type_card(tau));
 }
 
 uint32_t _o_yices_scalar_type_card(type_t tau) {
@@ -6764,7 +6779,7 @@ uint32_t _o_yices_scalar_type_card(type_t tau) {
  *   type1 = tau
  */
 EXPORTED int32_t yices_type_num_children(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_num_children(tau));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_num_children(tau));
 }
 
 int32_t _o_yices_type_num_children(type_t tau) {
@@ -6792,7 +6807,7 @@ int32_t _o_yices_type_num_children(type_t tau) {
  * - return NULL_TYPE if there's an error
  */
 EXPORTED type_t yices_type_child(type_t tau, int32_t i) {
-  MT_PROTECT(type_t,  __yices_globals.lock, _o_yices_type_child(tau, i));
+  MT_PROTECT_READ(type_t,  __yices_globals.lock, _o_yices_type_child(tau, i));
 }
 
 type_t _o_yices_type_child(type_t tau, int32_t i) {
@@ -6831,7 +6846,7 @@ type_t _o_yices_type_child(type_t tau, int32_t i) {
  * - returns -1 for error, 0 if all fine.
  */
 EXPORTED int32_t yices_type_children(type_t tau, type_vector_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_type_children(tau, v));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_type_children(tau, v));
 }
 
 int32_t _o_yices_type_children(type_t tau, type_vector_t *v) {
@@ -6878,7 +6893,7 @@ int32_t _o_yices_type_children(type_t tau, type_vector_t *v) {
  *   index = -1
  */
 EXPORTED type_t yices_type_of_term(term_t t) {
-  MT_PROTECT(type_t,  __yices_globals.lock, _o_yices_type_of_term(t));
+  MT_PROTECT_READ(type_t,  __yices_globals.lock, _o_yices_type_of_term(t));
 }
 
 type_t _o_yices_type_of_term(term_t t) {
@@ -6898,7 +6913,7 @@ type_t _o_yices_type_of_term(term_t t) {
  * and set the error report as above.
  */
 EXPORTED int32_t yices_term_is_bool(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_bool(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_bool(t));
 }
 
 int32_t _o_yices_term_is_bool(term_t t) {
@@ -6906,7 +6921,7 @@ int32_t _o_yices_term_is_bool(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_int(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_int(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_int(t));
 }
 
 int32_t _o_yices_term_is_int(term_t t) {
@@ -6914,7 +6929,7 @@ int32_t _o_yices_term_is_int(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_real(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_real(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_real(t));
 }
 
 int32_t _o_yices_term_is_real(term_t t) {
@@ -6922,7 +6937,7 @@ int32_t _o_yices_term_is_real(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_arithmetic(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_arithmetic(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_arithmetic(t));
 }
 
 int32_t _o_yices_term_is_arithmetic(term_t t) {
@@ -6930,7 +6945,7 @@ int32_t _o_yices_term_is_arithmetic(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_bitvector(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_bitvector(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_bitvector(t));
 }
 
 int32_t _o_yices_term_is_bitvector(term_t t) {
@@ -6938,7 +6953,7 @@ int32_t _o_yices_term_is_bitvector(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_tuple(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_tuple(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_tuple(t));
 }
 
 int32_t _o_yices_term_is_tuple(term_t t) {
@@ -6946,7 +6961,7 @@ int32_t _o_yices_term_is_tuple(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_function(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_function(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_function(t));
 }
 
 int32_t _o_yices_term_is_function(term_t t) {
@@ -6954,7 +6969,7 @@ int32_t _o_yices_term_is_function(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_scalar(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_scalar(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_scalar(t));
 }
 
 int32_t _o_yices_term_is_scalar(term_t t) {
@@ -6970,7 +6985,7 @@ int32_t _o_yices_term_is_scalar(term_t t) {
  * return 0 if t is not a bitvector
  */
 EXPORTED uint32_t yices_term_bitsize(term_t t) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_term_bitsize(t));
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_term_bitsize(t));
 }
 
 uint32_t _o_yices_term_bitsize(term_t t) {
@@ -6986,7 +7001,7 @@ uint32_t _o_yices_term_bitsize(term_t t) {
  * - return false if t is not valid and set the error report
  */
 EXPORTED int32_t yices_term_is_ground(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_ground(t));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_term_is_ground(t));
 }
 
 int32_t _o_yices_term_is_ground(term_t t) {
@@ -7011,7 +7026,7 @@ harray_t *yices_free_vars_of_term(term_t t) {
  * - return false if t is not valid
  */
 EXPORTED int32_t yices_term_is_atomic(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_atomic(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_atomic(t));
 }
 
 int32_t _o_yices_term_is_atomic(term_t t) {
@@ -7019,7 +7034,7 @@ int32_t _o_yices_term_is_atomic(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_composite(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_composite(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_composite(t));
 }
 
 int32_t _o_yices_term_is_composite(term_t t) {
@@ -7027,7 +7042,7 @@ int32_t _o_yices_term_is_composite(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_projection(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_projection(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_projection(t));
 }
 
 int32_t _o_yices_term_is_projection(term_t t) {
@@ -7036,7 +7051,7 @@ int32_t _o_yices_term_is_projection(term_t t) {
 
 
 EXPORTED int32_t yices_term_is_sum(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_sum(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_sum(t));
 }
 
 int32_t _o_yices_term_is_sum(term_t t) {
@@ -7044,7 +7059,7 @@ int32_t _o_yices_term_is_sum(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_bvsum(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_bvsum(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_bvsum(t));
 }
 
 int32_t _o_yices_term_is_bvsum(term_t t) {
@@ -7052,7 +7067,7 @@ int32_t _o_yices_term_is_bvsum(term_t t) {
 }
 
 EXPORTED int32_t yices_term_is_product(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_is_product(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_is_product(t));
 }
 
 int32_t _o_yices_term_is_product(term_t t) {
@@ -7065,7 +7080,7 @@ int32_t _o_yices_term_is_product(term_t t) {
  * - the return code is defined in yices_types.h
  */
 EXPORTED term_constructor_t yices_term_constructor(term_t t) {
-  MT_PROTECT(term_constructor_t,  __yices_globals.lock, _o_yices_term_constructor(t));
+  MT_PROTECT_READ(term_constructor_t,  __yices_globals.lock, _o_yices_term_constructor(t));
 }
 
 term_constructor_t _o_yices_term_constructor(term_t t) {
@@ -7088,7 +7103,7 @@ term_constructor_t _o_yices_term_constructor(term_t t) {
  * - returns -1 if t is not a valid term
  */
 EXPORTED int32_t yices_term_num_children(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_num_children(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_term_num_children(t));
 }
 
 int32_t _o_yices_term_num_children(term_t t) {
@@ -7103,7 +7118,7 @@ int32_t _o_yices_term_num_children(term_t t) {
  * Get i-th child of a composite term
  */
 EXPORTED term_t yices_term_child(term_t t, int32_t i) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_term_child(t, i));
+  MT_PROTECT_READ(term_t,  __yices_globals.lock, _o_yices_term_child(t, i));
 }
 
 term_t _o_yices_term_child(term_t t, int32_t i) {
@@ -7120,7 +7135,7 @@ term_t _o_yices_term_child(term_t t, int32_t i) {
  * Store all children of a composite term t in vector v
  */
 EXPORTED int32_t yices_term_children(term_t t, term_vector_t *v) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_term_children(t, v));
+  MT_PROTECT_READ(int32_t, __yices_globals.lock, _o_yices_term_children(t, v));
 }
 
 int32_t _o_yices_term_children(term_t t, term_vector_t *v) {
@@ -7140,7 +7155,7 @@ int32_t _o_yices_term_children(term_t t, term_vector_t *v) {
  * Get the argument and index of a projection
  */
 EXPORTED int32_t yices_proj_index(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_proj_index(t));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_proj_index(t));
 }
 
 int32_t _o_yices_proj_index(term_t t) {
@@ -7161,7 +7176,7 @@ int32_t _o_yices_proj_index(term_t t) {
 }
 
 EXPORTED term_t yices_proj_arg(term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_proj_arg(t));
+  MT_PROTECT_READ(term_t,  __yices_globals.lock, _o_yices_proj_arg(t));
 }
 
 term_t _o_yices_proj_arg(term_t t) {
@@ -7177,7 +7192,7 @@ term_t _o_yices_proj_arg(term_t t) {
  * Value of a constant term
  */
 EXPORTED int32_t yices_bool_const_value(term_t t, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_bool_const_value(t, val));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_bool_const_value(t, val));
 }
 
 int32_t _o_yices_bool_const_value(term_t t, int32_t *val) {
@@ -7191,7 +7206,7 @@ int32_t _o_yices_bool_const_value(term_t t, int32_t *val) {
 
 
 EXPORTED int32_t yices_bv_const_value(term_t t, int32_t val[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_bv_const_value(t, val));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_bv_const_value(t, val));
 }
 
 int32_t _o_yices_bv_const_value(term_t t, int32_t val[]) {
@@ -7204,7 +7219,7 @@ int32_t _o_yices_bv_const_value(term_t t, int32_t val[]) {
 }
 
 EXPORTED int32_t yices_scalar_const_value(term_t t, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_scalar_const_value(t, val));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_scalar_const_value(t, val));
 }
 
 int32_t _o_yices_scalar_const_value(term_t t, int32_t *val) {
@@ -7217,7 +7232,7 @@ int32_t _o_yices_scalar_const_value(term_t t, int32_t *val) {
 }
 
 EXPORTED int32_t yices_rational_const_value(term_t t, mpq_t q) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_rational_const_value(t, q));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_rational_const_value(t, q));
 }
 
 int32_t _o_yices_rational_const_value(term_t t, mpq_t q) {
@@ -7230,7 +7245,7 @@ int32_t _o_yices_rational_const_value(term_t t, mpq_t q) {
 }
 
 EXPORTED int32_t yices_finitefield_const_value(term_t t, mpz_t z) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_finitefield_const_value(t, z));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_finitefield_const_value(t, z));
 }
 
 int32_t _o_yices_finitefield_const_value(term_t t, mpz_t z) {
@@ -7251,7 +7266,7 @@ int32_t _o_yices_finitefield_const_value(term_t t, mpz_t z) {
  * - the number of bits in the bvconstant is the same as in t
  */
 EXPORTED int32_t yices_sum_component(term_t t, int32_t i, mpq_t coeff, term_t *term) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_sum_component(t, i, coeff, term));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_sum_component(t, i, coeff, term));
 }
 
 int32_t _o_yices_sum_component(term_t t, int32_t i, mpq_t coeff, term_t *term) {
@@ -7266,7 +7281,7 @@ int32_t _o_yices_sum_component(term_t t, int32_t i, mpq_t coeff, term_t *term) {
 }
 
 EXPORTED int32_t yices_bvsum_component(term_t t, int32_t i, int32_t val[], term_t *term) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_bvsum_component(t, i, val, term));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_bvsum_component(t, i, val, term));
 }
 
 int32_t _o_yices_bvsum_component(term_t t, int32_t i, int32_t val[], term_t *term) {
@@ -7287,7 +7302,7 @@ int32_t _o_yices_bvsum_component(term_t t, int32_t i, int32_t val[], term_t *ter
  *   (where exponent is a positive integer)
  */
 EXPORTED int32_t yices_product_component(term_t t, int32_t i, term_t *term, uint32_t *exp) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_product_component(t, i, term, exp));
+  MT_PROTECT_READ(int32_t,  __yices_globals.lock, _o_yices_product_component(t, i, term, exp));
 }
 
 int32_t _o_yices_product_component(term_t t, int32_t i, term_t *term, uint32_t *exp) {
@@ -7780,7 +7795,7 @@ bool yices_arith_buffer_is_int(rba_buffer_t *b) {
  * - DEGREE_OVERFLOW if the substitution causes an overflow
  */
 EXPORTED term_t yices_subst_term(uint32_t n, const term_t var[], const term_t map[], term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_subst_term(n, var, map, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_subst_term(n, var, map, t));
 }
 
 term_t _o_yices_subst_term(uint32_t n, const term_t var[], const term_t map[], term_t t) {
@@ -7817,7 +7832,7 @@ term_t _o_yices_subst_term(uint32_t n, const term_t var[], const term_t map[], t
  * Variant: apply the substitution to m terms t[0 .. m-1]
  */
 EXPORTED int32_t yices_subst_term_array(uint32_t n, const term_t var[], const term_t map[], uint32_t m, term_t t[]) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_subst_term_array(n, var, map, m, t));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_subst_term_array(n, var, map, m, t));
 }
 
 int32_t _o_yices_subst_term_array(uint32_t n, const term_t var[], const term_t map[], uint32_t m, term_t t[]) {
@@ -7866,7 +7881,7 @@ int32_t _o_yices_subst_term_array(uint32_t n, const term_t var[], const term_t m
  * Return NULL_TYPE if there's an error.
  */
 EXPORTED type_t yices_parse_type(const char *s) {
-  MT_PROTECT(type_t,  __yices_globals.lock, _o_yices_parse_type(s));
+  MT_PROTECT_WRITE(type_t,  __yices_globals.lock, _o_yices_parse_type(s));
 }
 
 type_t _o_yices_parse_type(const char *s) {
@@ -7882,7 +7897,7 @@ type_t _o_yices_parse_type(const char *s) {
  * Return NULL_TERM if there's an error.
  */
 EXPORTED term_t yices_parse_term(const char *s) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_parse_term(s));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_parse_term(s));
 }
 
 term_t _o_yices_parse_term(const char *s) {
@@ -7909,7 +7924,7 @@ term_t _o_yices_parse_term(const char *s) {
  * return 0 otherwise.
  */
 EXPORTED int32_t yices_set_type_name(type_t tau, const char *name) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_set_type_name(tau, name));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_set_type_name(tau, name));
 }
 
 int32_t _o_yices_set_type_name(type_t tau, const char *name) {
@@ -7936,7 +7951,7 @@ int32_t _o_yices_set_type_name(type_t tau, const char *name) {
  * return 0 otherwise.
  */
 EXPORTED int32_t yices_set_term_name(term_t t, const char *name) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_set_term_name(t, name));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_set_term_name(t, name));
 }
 
 int32_t _o_yices_set_term_name(term_t t, const char *name) {
@@ -7959,7 +7974,7 @@ int32_t _o_yices_set_term_name(term_t t, const char *name) {
  * - return NULL if tau has no name (or if tau is not a valid type)
  */
 EXPORTED const char *yices_get_type_name(type_t tau) {
-  MT_PROTECT(const char *,  __yices_globals.lock, _o_yices_get_type_name(tau));
+  MT_PROTECT_READ(const char *,  __yices_globals.lock, _o_yices_get_type_name(tau));
 }
 
 const char *_o_yices_get_type_name(type_t tau) {
@@ -7975,7 +7990,7 @@ const char *_o_yices_get_type_name(type_t tau) {
  * - return NULL is t has no name (or if t is not a valid term)
  */
 EXPORTED const char *yices_get_term_name(term_t t) {
-  MT_PROTECT(const char *,  __yices_globals.lock, _o_yices_get_term_name(t));
+  MT_PROTECT_READ(const char *,  __yices_globals.lock, _o_yices_get_term_name(t));
 }
 
 const char *_o_yices_get_term_name(term_t t) {
@@ -7991,7 +8006,7 @@ const char *_o_yices_get_term_name(term_t t) {
  * Remove name from the type table.
  */
 EXPORTED void yices_remove_type_name(const char *name) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_remove_type_name(name));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_remove_type_name(name));
 }
 
 void _o_yices_remove_type_name(const char *name) {
@@ -8003,7 +8018,7 @@ void _o_yices_remove_type_name(const char *name) {
  * Remove name from the term table.
  */
 EXPORTED void yices_remove_term_name(const char *name) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_remove_term_name(name));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_remove_term_name(name));
 }
 
 void _o_yices_remove_term_name(const char *name) {
@@ -8015,7 +8030,7 @@ void _o_yices_remove_term_name(const char *name) {
  * Get type of the given name or return NULL_TYPE (-1)
  */
 EXPORTED type_t yices_get_type_by_name(const char *name) {
-  MT_PROTECT(type_t,  __yices_globals.lock, _o_yices_get_type_by_name(name));
+  MT_PROTECT_WRITE(type_t,  __yices_globals.lock, _o_yices_get_type_by_name(name));
 }
 
 type_t _o_yices_get_type_by_name(const char *name) {
@@ -8027,7 +8042,7 @@ type_t _o_yices_get_type_by_name(const char *name) {
  * Get term of the given name or return NULL_TERM
  */
 EXPORTED term_t yices_get_term_by_name(const char *name) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_get_term_by_name(name));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_get_term_by_name(name));
 }
 
 term_t _o_yices_get_term_by_name(const char *name) {
@@ -8041,7 +8056,7 @@ term_t _o_yices_get_term_by_name(const char *name) {
  * Return 0 otherwise.
  */
 EXPORTED int32_t yices_clear_type_name(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_clear_type_name(tau));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_clear_type_name(tau));
 }
 
 int32_t _o_yices_clear_type_name(type_t tau) {
@@ -8061,7 +8076,7 @@ int32_t _o_yices_clear_type_name(type_t tau) {
  * Return 0 otherwise.
  */
 EXPORTED int32_t yices_clear_term_name(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_clear_term_name(t));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_clear_term_name(t));
 }
 
 int32_t _o_yices_clear_term_name(term_t t) {
@@ -8163,9 +8178,10 @@ typedef enum ctx_option {
   CTX_OPTION_KEEP_ITE,
   CTX_OPTION_EAGER_ARITH_LEMMAS,
   CTX_OPTION_ASSERT_ITE_BOUNDS,
+  CTX_OPTION_PACKED_ARITH_MATRIX,
 } ctx_option_t;
 
-#define NUM_CTX_OPTIONS (CTX_OPTION_ASSERT_ITE_BOUNDS+1)
+#define NUM_CTX_OPTIONS (CTX_OPTION_PACKED_ARITH_MATRIX+1)
 
 
 /*
@@ -8180,6 +8196,7 @@ static const char * const ctx_option_names[NUM_CTX_OPTIONS] = {
   "flatten",
   "keep-ite",
   "learn-eq",
+  "packed-arith-matrix",
   "var-elim",
 };
 
@@ -8196,6 +8213,7 @@ static const int32_t ctx_option_key[NUM_CTX_OPTIONS] = {
   CTX_OPTION_FLATTEN,
   CTX_OPTION_KEEP_ITE,
   CTX_OPTION_LEARN_EQ,
+  CTX_OPTION_PACKED_ARITH_MATRIX,
   CTX_OPTION_VAR_ELIM,
 };
 
@@ -8245,6 +8263,10 @@ EXPORTED int32_t yices_context_enable_option(context_t *ctx, const char *option)
     enable_assert_ite_bounds(ctx);
     break;
 
+  case CTX_OPTION_PACKED_ARITH_MATRIX:
+    enable_splx_packed_matrix(ctx);
+    break;
+
   default:
     assert(k == -1);
     // not recognized
@@ -8302,6 +8324,10 @@ EXPORTED int32_t yices_context_disable_option(context_t *ctx, const char *option
     disable_assert_ite_bounds(ctx);
     break;
 
+  case CTX_OPTION_PACKED_ARITH_MATRIX:
+    disable_splx_packed_matrix(ctx);
+    break;
+
   default:
     set_error_code(CTX_UNKNOWN_PARAMETER);
     r = -1;
@@ -8454,7 +8480,7 @@ static context_t *_o_yices_create_context(smt_logic_t logic, context_arch_t arch
 }
 
 context_t *yices_create_context(smt_logic_t logic, context_arch_t arch, context_mode_t mode, bool iflag, bool qflag) {
-  MT_PROTECT(context_t *, __yices_globals.lock, _o_yices_create_context(logic, arch, mode, iflag, qflag));
+  MT_PROTECT_WRITE(context_t *, __yices_globals.lock, _o_yices_create_context(logic, arch, mode, iflag, qflag));
 }
 
 
@@ -8465,7 +8491,7 @@ context_t *yices_create_context(smt_logic_t logic, context_arch_t arch, context_
  * - otherwise, if the configuration is not supported, the function returns NULL.
  */
 EXPORTED context_t *yices_new_context(const ctx_config_t *config) {
-  MT_PROTECT(context_t *, __yices_globals.lock, _o_yices_new_context(config));
+  MT_PROTECT_WRITE(context_t *, __yices_globals.lock, _o_yices_new_context(config));
 }
 
 context_t *_o_yices_new_context(const ctx_config_t *config) {
@@ -8528,7 +8554,7 @@ context_t *_o_yices_new_context(const ctx_config_t *config) {
  * Delete ctx
  */
 EXPORTED void yices_free_context(context_t *ctx) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_free_context(ctx));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_free_context(ctx));
 }
 
 void _o_yices_free_context(context_t *ctx) {
@@ -8744,7 +8770,7 @@ static inline bool _o_yices_assert_formula_checks(term_t t) {
 }
 
 static inline bool yices_assert_formula_checks(term_t t) {
-  MT_PROTECT(bool,  __yices_globals.lock, _o_yices_assert_formula_checks(t));
+  MT_PROTECT_WRITE(bool,  __yices_globals.lock, _o_yices_assert_formula_checks(t));
 }
 
 int32_t _o_yices_assert_formula(context_t *ctx, term_t t) {
@@ -8801,7 +8827,7 @@ int32_t _o_yices_assert_formula(context_t *ctx, term_t t) {
 }
 
 EXPORTED int32_t yices_assert_formula(context_t *ctx, term_t t) {
-  MT_PROTECT(int32_t, __yices_globals.lock,
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock,
 	     _o_yices_assert_formula(ctx, t));
 }
 
@@ -8818,7 +8844,7 @@ static inline bool _o_yices_assert_formulas_checks(uint32_t n, const term_t t[])
 }
 
 static inline bool yices_assert_formulas_checks(uint32_t n, const term_t t[]) {
-  MT_PROTECT(bool,  __yices_globals.lock, _o_yices_assert_formulas_checks(n, t));
+  MT_PROTECT_WRITE(bool,  __yices_globals.lock, _o_yices_assert_formulas_checks(n, t));
 }
 
 EXPORTED int32_t yices_assert_formulas(context_t *ctx, uint32_t n, const term_t t[]) {
@@ -9011,6 +9037,7 @@ void yices_set_default_params(param_t *params, smt_logic_t logic, context_arch_t
 
   case CTX_ARCH_IFW:
   case CTX_ARCH_RFW:
+  case CTX_ARCH_ISDL:
     params->cache_tclauses = true;
     params->tclause_size = 20;
     params->fast_restart = true;
@@ -9225,7 +9252,7 @@ smt_status_t _o_yices_check_context_with_assumptions(context_t *ctx, const param
 }
 
 EXPORTED smt_status_t yices_check_context_with_assumptions(context_t *ctx, const param_t *params, uint32_t n, const term_t a[]) {
-  MT_PROTECT(smt_status_t, __yices_globals.lock, _o_yices_check_context_with_assumptions(ctx, params, n, a));
+  MT_PROTECT_WRITE(smt_status_t, __yices_globals.lock, _o_yices_check_context_with_assumptions(ctx, params, n, a));
 }
 
 /*
@@ -9241,7 +9268,7 @@ static bool _o_good_terms_for_check_with_model(uint32_t n, const term_t t[]) {
 }
 
 static bool good_terms_for_check_with_model(uint32_t n, const term_t t[]) {
-  MT_PROTECT(bool, __yices_globals.lock, _o_good_terms_for_check_with_model(n, t));
+  MT_PROTECT_WRITE(bool, __yices_globals.lock, _o_good_terms_for_check_with_model(n, t));
 }
 
 /*
@@ -9660,7 +9687,7 @@ EXPORTED term_t yices_get_model_interpolant(context_t *ctx) {
  *
  */
 EXPORTED model_t *yices_get_model(context_t *ctx, int32_t keep_subst) {
-  MT_PROTECT(model_t *,  __yices_globals.lock, _o_yices_get_model(ctx, keep_subst));
+  MT_PROTECT_WRITE(model_t *,  __yices_globals.lock, _o_yices_get_model(ctx, keep_subst));
 }
 
 model_t *_o_yices_get_model(context_t *ctx, int32_t keep_subst) {
@@ -9703,7 +9730,7 @@ model_t *yices_new_model_internal(bool keep_subst) {
  * Delete mdl
  */
 EXPORTED void yices_free_model(model_t *mdl) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_free_model(mdl));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_free_model(mdl));
 }
 
 void _o_yices_free_model(model_t *mdl) {
@@ -9716,7 +9743,7 @@ void _o_yices_free_model(model_t *mdl) {
  * - f must be open/writable
  */
 EXPORTED void yices_print_model(FILE *f, model_t *mdl) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_print_model(f, mdl));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_print_model(f, mdl));
 }
 
 void _o_yices_print_model(FILE *f, model_t *mdl) {
@@ -9724,7 +9751,7 @@ void _o_yices_print_model(FILE *f, model_t *mdl) {
 }
 
 EXPORTED int32_t yices_print_model_fd(int fd, model_t *mdl) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_print_model_fd(fd, mdl));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_print_model_fd(fd, mdl));
 }
 
 int32_t _o_yices_print_model_fd(int fd, model_t *mdl) {
@@ -9748,7 +9775,7 @@ int32_t _o_yices_print_model_fd(int fd, model_t *mdl) {
  * - width, height, offset = print area
  */
 EXPORTED int32_t yices_pp_model(FILE *f, model_t *mdl, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_pp_model(f, mdl, width, height, offset));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_pp_model(f, mdl, width, height, offset));
 }
 
 int32_t _o_yices_pp_model(FILE *f, model_t *mdl, uint32_t width, uint32_t height, uint32_t offset) {
@@ -9800,7 +9827,7 @@ EXPORTED int32_t yices_pp_model_fd(int fd, model_t *mdl, uint32_t width, uint32_
  * Convert mdl to a string
  */
 EXPORTED char *yices_model_to_string(model_t *mdl, uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(char *,  __yices_globals.lock, _o_yices_model_to_string(mdl, width, height, offset));
+  MT_PROTECT_WRITE(char *,  __yices_globals.lock, _o_yices_model_to_string(mdl, width, height, offset));
 }
 
 char *_o_yices_model_to_string(model_t *mdl, uint32_t width, uint32_t height, uint32_t offset) {
@@ -9844,7 +9871,7 @@ char *_o_yices_model_to_string(model_t *mdl, uint32_t width, uint32_t height, ui
  *   term1 = a[i]
  */
 EXPORTED int32_t yices_print_term_values(FILE *f, model_t *mdl, uint32_t n, const term_t a[]) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_print_term_values(f, mdl, n, a));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_print_term_values(f, mdl, n, a));
 }
 
 int32_t _o_yices_print_term_values(FILE *f, model_t *mdl, uint32_t n, const term_t a[]) {
@@ -9896,7 +9923,7 @@ EXPORTED int32_t yices_print_term_values_fd(int fd, model_t *mdl, uint32_t n, co
  */
 EXPORTED int32_t yices_pp_term_values(FILE *f, model_t *mdl, uint32_t n, const term_t a[],
 				      uint32_t width, uint32_t height, uint32_t offset) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_pp_term_values(f, mdl, n, a, width, height, offset));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_pp_term_values(f, mdl, n, a, width, height, offset));
 }
 
 int32_t _o_yices_pp_term_values(FILE *f, model_t *mdl, uint32_t n, const term_t a[],
@@ -9981,7 +10008,7 @@ EXPORTED int32_t yices_pp_term_values_fd(int fd, model_t *mdl, uint32_t n, const
  * - code = MDL_CONSTRUCTION_FAILED: something else went wrong
  */
 EXPORTED model_t *yices_model_from_map(uint32_t n, const term_t var[], const term_t map[]) {
-  MT_PROTECT(model_t *,  __yices_globals.lock, _o_yices_model_from_map(n, var, map));
+  MT_PROTECT_WRITE(model_t *,  __yices_globals.lock, _o_yices_model_from_map(n, var, map));
 }
 
 model_t *_o_yices_model_from_map(uint32_t n, const term_t var[], const term_t map[]) {
@@ -10002,7 +10029,7 @@ model_t *_o_yices_model_from_map(uint32_t n, const term_t var[], const term_t ma
  * Create an empty model.
  */
 EXPORTED extern model_t *yices_new_model() {
-  MT_PROTECT(model_t *,  __yices_globals.lock, _o_yices_new_model());
+  MT_PROTECT_WRITE(model_t *,  __yices_globals.lock, _o_yices_new_model());
 }
 
 model_t *_o_yices_new_model() {
@@ -10026,7 +10053,7 @@ model_t *_o_yices_new_model() {
  * - code = TYPE_MISMATCH if var is not Boolean
  */
 EXPORTED int32_t yices_model_set_bool(model_t* model, term_t var, int32_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_model_set_bool(model, var, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_model_set_bool(model, var, val));
 }
 
 int32_t _o_yices_model_set_bool(model_t* model, term_t var, int32_t val) {
@@ -10072,7 +10099,7 @@ static int32_t yices_model_set_q(model_t *model, term_t var, rational_t *q) {
  * API functions
  */
 EXPORTED int32_t yices_model_set_int32(model_t *model, term_t var, int32_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_int32(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_int32(model, var, val));
 }
 
 int32_t _o_yices_model_set_int32(model_t *model, term_t var, int32_t val) {
@@ -10081,7 +10108,7 @@ int32_t _o_yices_model_set_int32(model_t *model, term_t var, int32_t val) {
 }
 
 EXPORTED int32_t yices_model_set_int64(model_t *model, term_t var, int64_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_int64(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_int64(model, var, val));
 }
 
 int32_t _o_yices_model_set_int64(model_t *model, term_t var, int64_t val) {
@@ -10090,7 +10117,7 @@ int32_t _o_yices_model_set_int64(model_t *model, term_t var, int64_t val) {
 }
 
 EXPORTED int32_t yices_model_set_rational32(model_t *model, term_t var, int32_t num, uint32_t den) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_rational32(model, var, num, den));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_rational32(model, var, num, den));
 }
 
 int32_t _o_yices_model_set_rational32(model_t *model, term_t var, int32_t num, uint32_t den) {
@@ -10103,7 +10130,7 @@ int32_t _o_yices_model_set_rational32(model_t *model, term_t var, int32_t num, u
 }
 
 EXPORTED int32_t yices_model_set_rational64(model_t *model, term_t var, int64_t num, uint64_t den) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_rational64(model, var, num, den));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_rational64(model, var, num, den));
 }
 
 int32_t _o_yices_model_set_rational64(model_t *model, term_t var, int64_t num, uint64_t den) {
@@ -10116,7 +10143,7 @@ int32_t _o_yices_model_set_rational64(model_t *model, term_t var, int64_t num, u
 }
 
 EXPORTED int32_t yices_model_set_mpz(model_t *model, term_t var, mpz_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_model_set_mpz(model, var, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_model_set_mpz(model, var, val));
 }
 
 int32_t _o_yices_model_set_mpz(model_t *model, term_t var, mpz_t val) {
@@ -10125,7 +10152,7 @@ int32_t _o_yices_model_set_mpz(model_t *model, term_t var, mpz_t val) {
 }
 
 EXPORTED int32_t yices_model_set_mpq(model_t *model, term_t var, mpq_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_model_set_mpq(model, var, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_model_set_mpq(model, var, val));
 }
 
 int32_t _o_yices_model_set_mpq(model_t *model, term_t var, mpq_t val) {
@@ -10135,7 +10162,7 @@ int32_t _o_yices_model_set_mpq(model_t *model, term_t var, mpq_t val) {
 
 
 EXPORTED int32_t yices_model_set_algebraic_number(model_t *model, term_t var, const lp_algebraic_number_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_model_set_algebraic_number(model, var, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_model_set_algebraic_number(model, var, val));
 }
 
 int32_t _o_yices_model_set_algebraic_number(model_t *model, term_t var, const lp_algebraic_number_t *val) {
@@ -10182,7 +10209,7 @@ static inline void yices_model_set_bvconstant(model_t *model, term_t var, bvcons
 }
 
 EXPORTED int32_t yices_model_set_bv_int32(model_t *model, term_t var, int32_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_int32(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_int32(model, var, val));
 }
 
 int32_t _o_yices_model_set_bv_int32(model_t *model, term_t var, int32_t val) {
@@ -10199,7 +10226,7 @@ int32_t _o_yices_model_set_bv_int32(model_t *model, term_t var, int32_t val) {
 
 
 EXPORTED int32_t yices_model_set_bv_int64(model_t *model, term_t var, int64_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_int64(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_int64(model, var, val));
 }
 
 int32_t _o_yices_model_set_bv_int64(model_t *model, term_t var, int64_t val) {
@@ -10216,7 +10243,7 @@ int32_t _o_yices_model_set_bv_int64(model_t *model, term_t var, int64_t val) {
 
 
 EXPORTED int32_t yices_model_set_bv_uint32(model_t *model, term_t var, uint32_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_uint32(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_uint32(model, var, val));
 }
 
 int32_t _o_yices_model_set_bv_uint32(model_t *model, term_t var, uint32_t val) {
@@ -10233,7 +10260,7 @@ int32_t _o_yices_model_set_bv_uint32(model_t *model, term_t var, uint32_t val) {
 
 
 EXPORTED int32_t yices_model_set_bv_uint64(model_t *model, term_t var, uint64_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_uint64(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_uint64(model, var, val));
 }
 
 int32_t _o_yices_model_set_bv_uint64(model_t *model, term_t var, uint64_t val) {
@@ -10249,7 +10276,7 @@ int32_t _o_yices_model_set_bv_uint64(model_t *model, term_t var, uint64_t val) {
 }
 
 EXPORTED int32_t yices_model_set_bv_mpz(model_t *model, term_t var, mpz_t val) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_mpz(model, var, val));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_mpz(model, var, val));
 }
 
 int32_t _o_yices_model_set_bv_mpz(model_t *model, term_t var, mpz_t val) {
@@ -10295,7 +10322,7 @@ int32_t _o_yices_model_set_bv_mpz(model_t *model, term_t var, mpz_t val) {
  * - a[n-1] is the high-order bit
  */
 EXPORTED int32_t yices_model_set_bv_from_array(model_t *model, term_t var, uint32_t n, const int32_t a[]) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_set_bv_from_array(model, var, n, a));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_set_bv_from_array(model, var, n, a));
 }
 
 int32_t _o_yices_model_set_bv_from_array(model_t *model, term_t var, uint32_t n, const int32_t a[]) {
@@ -10323,7 +10350,7 @@ int32_t _o_yices_model_set_bv_from_array(model_t *model, term_t var, uint32_t n,
  * - the variables are stored in term_vector v
  */
 EXPORTED void yices_model_collect_defined_terms(model_t *mdl, term_vector_t *v) {
-  MT_PROTECT_VOID(__yices_globals.lock, model_get_relevant_vars(mdl, (ivector_t *) v));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, model_get_relevant_vars(mdl, (ivector_t *) v));
 }
 
 
@@ -10333,7 +10360,7 @@ EXPORTED void yices_model_collect_defined_terms(model_t *mdl, term_vector_t *v)
  * - the support is a set of uninterpreted returned in *v
  */
 EXPORTED int32_t yices_model_term_support(model_t *mdl, term_t t, term_vector_t *v) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_term_support(mdl, t, v));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_term_support(mdl, t, v));
 }
 
 int32_t _o_yices_model_term_support(model_t *mdl, term_t t, term_vector_t *v) {
@@ -10350,7 +10377,7 @@ int32_t _o_yices_model_term_support(model_t *mdl, term_t t, term_vector_t *v) {
  * - the support is a set of uninterpreted returned in *v
  */
 EXPORTED int32_t yices_model_term_array_support(model_t *mdl, uint32_t n, const term_t a[], term_vector_t *v) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_model_term_array_support(mdl, n, a, v));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_model_term_array_support(mdl, n, a, v));
 }
 
 int32_t _o_yices_model_term_array_support(model_t *mdl, uint32_t n, const term_t a[], term_vector_t *v) {
@@ -10409,6 +10436,55 @@ bool trivially_true_assertions(const term_t *a, uint32_t n, model_t **model) {
 }
 
 
+/*
+ * Search for a model of a[0 ... n-1] by local search, using at most
+ * max_moves moves. Return true if a model is found and store it in
+ * *model. Return false otherwise (including when the assertions
+ * contain terms other than Booleans and bitvectors of at most 64 bits).
+ *
+ * The model is checked by the evaluator before it's returned.
+ */
+bool local_search_assertions(const term_t *a, uint32_t n, uint32_t max_moves, model_t **model) {
+  bv_local_search_t search;
+  model_t *mdl;
+  evaluator_t evaluator;
+  uint32_t i;
+  bool result;
+
+  yices_obtain_mutex();
+
+  result = false;
+  init_bv_local_search(&search, __yices_globals.terms, BVLS_DEFAULT_SEED);
+  if (bv_local_search_add_assertions(&search, n, a) &&
+      bv_local_search_run(&search, max_moves)) {
+    mdl = yices_new_model_internal(true);
+    bv_local_search_build_model(&search, mdl);
+    init_evaluator(&evaluator, mdl);
+    result = true;
+    for (i=0; i<n; i++) {
+      if (!eval_to_true_in_model(&evaluator, a[i])) {
+        result = false;
+        break;
+      }
+    }
+
+    if (result) {
+      eval_record_useful_terms(&evaluator);
+      delete_evaluator(&evaluator);
+      *model = mdl;
+    } else {
+      delete_evaluator(&evaluator);
+      _o_yices_free_model(mdl);
+    }
+  }
+  delete_bv_local_search(&search);
+
+  yices_release_mutex();
+
+  return result;
+}
+
+
 /*
  * Check whether one of the terms a[0 .. n-1] is false.
  */
@@ -10558,6 +10634,39 @@ static smt_status_t yices_ef_check_formulas(const term_t f[], uint32_t n, smt_lo
 }
 
 
+/*
+ * Get the logic code and context configuration for logic_name
+ * - if logic_name is NULL, use the default configuration
+ * - return false and set the error code if logic_name is not a
+ *   supported logic
+ */
+static bool check_formulas_config(const char *logic_name, smt_logic_t *logic, context_arch_t *arch, bool *iflag, bool *qflag) {
+  if (logic_name == NULL) {
+    *logic = SMT_UNKNOWN;
+    *arch = CTX_ARCH_EGFUNSPLXBV;
+    *iflag = true;
+    *qflag = false;
+  } else {
+    *logic = smt_logic_code(logic_name);
+    if (*logic == SMT_UNKNOWN) {
+      set_error_code(CTX_UNKNOWN_LOGIC);
+      return false;
+    }
+    if (! logic_is_supported_by_ef(*logic) &&
+	(! logic_is_supported(*logic) ||
+	 (! yices_has_mcsat() && logic_requires_mcsat(*logic)))) {
+      set_error_code(CTX_LOGIC_NOT_SUPPORTED);
+      return false;
+    }
+
+    *arch = arch_for_logic(*logic);
+    *iflag = iflag_for_logic(*logic);
+    *qflag = qflag_for_logic(*logic);
+  }
+
+  return true;
+}
+
 /*
  * Check satisfiability of n formulas f[0 ... n-1]
  * - f[0 ... n-1] are known to be boolean terms
@@ -10573,30 +10682,11 @@ static smt_status_t yices_do_check_formulas(const term_t f[], uint32_t n, const
   smt_status_t status;
 
   // check the logic first
-  if (logic_name == NULL) {
-    logic = SMT_UNKNOWN;
-    arch = CTX_ARCH_EGFUNSPLXBV;
-    iflag = true;
-    qflag = false;
-  } else {
-    logic = smt_logic_code(logic_name);
-    if (logic == SMT_UNKNOWN) {
-      set_error_code(CTX_UNKNOWN_LOGIC);
-      return STATUS_ERROR;
-    }
-    if (logic_is_supported_by_ef(logic)) {
-      return yices_ef_check_formulas(f, n, logic, result);
-    }
-
-    if (! logic_is_supported(logic) ||
-	(! yices_has_mcsat() && logic_requires_mcsat(logic))) {
-      set_error_code(CTX_LOGIC_NOT_SUPPORTED);
-      return STATUS_ERROR;
-    }
-
-    arch = arch_for_logic(logic);
-    iflag = iflag_for_logic(logic);
-    qflag = qflag_for_logic(logic);
+  if (! check_formulas_config(logic_name, &logic, &arch, &iflag, &qflag)) {
+    return STATUS_ERROR;
+  }
+  if (logic != SMT_UNKNOWN && logic_is_supported_by_ef(logic)) {
+    return yices_ef_check_formulas(f, n, logic, result);
   }
 
   // validate the delegate if given
@@ -10651,6 +10741,95 @@ static smt_status_t yices_do_check_formulas(const term_t f[], uint32_t n, const
 
 
 
+/*
+ * Portfolio version: race nworkers contexts on f[0 ... n-1]
+ * - f[0 ... n-1] are known to be boolean terms
+ * - nworkers is between 1 and PORTFOLIO_MAX_WORKERS
+ * - if the logic requires MCSAT, quantifiers, or the exists/forall
+ *   solver, we use a single context
+ */
+static smt_status_t yices_do_check_formulas_portfolio(const term_t f[], uint32_t n, const char *logic_name,
+						      model_t **result, uint32_t nworkers) {
+  context_t *context;
+  portfolio_t portfolio;
+  param_t default_params;
+  model_t *model;
+  smt_logic_t logic;
+  context_arch_t arch;
+  bool iflag, qflag;
+  int32_t code;
+  uint32_t i, k;
+  smt_status_t status;
+
+  if (! check_formulas_config(logic_name, &logic, &arch, &iflag, &qflag)) {
+    return STATUS_ERROR;
+  }
+  if ((logic != SMT_UNKNOWN && logic_is_supported_by_ef(logic)) || arch == CTX_ARCH_MCSAT || qflag || nworkers == 1) {
+    return yices_do_check_formulas(f, n, logic_name, result, NULL);
+  }
+
+  if (trivially_false_assertions(f, n)) {
+    return STATUS_UNSAT;
+  }
+
+  if (trivially_true_assertions(f, n, result)) {
+    return STATUS_SAT;
+  }
+
+  /*
+   * Build one context per worker. The internalization must be done
+   * with the lock held but the search doesn't need it.
+   */
+  context = (context_t *) safe_malloc(nworkers * sizeof(context_t));
+  code = CTX_NO_ERROR;
+  yices_obtain_mutex();
+  for (k=0; k<nworkers; k++) {
+    init_context(context + k, __yices_globals.terms, logic, CTX_MODE_ONECHECK, arch, qflag);
+    context_set_default_options(context + k, logic, arch, iflag, qflag);
+    code = _o_assert_formulas(context + k, n, f);
+    if (code < 0 || code == TRIVIALLY_UNSAT) {
+      k ++;
+      break;
+    }
+  }
+  yices_release_mutex();
+
+  if (code < 0) {
+    convert_internalization_error(code);
+    status = STATUS_ERROR;
+    goto cleanup;
+  }
+
+  if (code == TRIVIALLY_UNSAT) {
+    status = STATUS_UNSAT;
+    goto cleanup;
+  }
+
+  init_portfolio(&portfolio, nworkers);
+  for (i=0; i<nworkers; i++) {
+    portfolio_set_context(&portfolio, i, context + i);
+  }
+  yices_default_params_for_context(context, &default_params);
+  portfolio_diversify_params(&portfolio, &default_params);
+  status = portfolio_check(&portfolio);
+
+  if (status == STATUS_SAT && result != NULL) {
+    model = yices_get_model(portfolio_winner(&portfolio), true);
+    assert(model != NULL);
+    *result = model;
+  }
+  delete_portfolio(&portfolio);
+
+ cleanup:
+  for (i=0; i<k; i++) {
+    delete_context(context + i);
+  }
+  safe_free(context);
+
+  return status;
+}
+
+
 /*
  * Check whether a formula is satisfiable
  * - f = formula
@@ -10677,12 +10856,12 @@ static smt_status_t yices_do_check_formulas(const term_t f[], uint32_t n, const
  * The delegate is an optional argument used only when logic is "QF_BV".
  * If is ignored otherwise.   It must be the name of a third-party SAT solver
  * to use after bit-blasting. Currently, the delegate can be either "cadical",
- * "cryptominisat",  "y2sat", or NULL.
+ * "cryptominisat",  "y2sat", "y2sat-cubes", or NULL.
  * If delegate is NULL, the default SAT solver is used.
  *
  * Support for "cadical" and "cryptominisat" must be enabled at compilation
- * time. The "y2sat" solver is always available. The function will return STATUS_ERROR
- * and store an error code if the requested delegate is not available.
+ * time. The "y2sat" and "y2sat-cubes" solvers are always available. The function
+ * will return STATUS_ERROR and store an error code if the requested delegate is not available.
  *
  * Error codes:
  *
@@ -10701,7 +10880,7 @@ static smt_status_t yices_do_check_formulas(const term_t f[], uint32_t n, const
  * if the logic is known but not supported by Yices
  *   code = CTX_LOGIC_NOT_SUPPORTED
  *
- * if delegate is not one of "cadical", "cryptominisat", "y2sat"
+ * if delegate is not one of "cadical", "cryptominisat", "y2sat", "y2sat-cubes"
  *   code = CTX_UNKNOWN_DELEGATE
  *
  * if delegate is "cadical" or "cryptominisat" but support for these SAT solvers
@@ -10732,6 +10911,32 @@ EXPORTED smt_status_t yices_check_formulas(const term_t f[], uint32_t n, const c
   return yices_do_check_formulas(f, n, logic, model, delegate);
 }
 
+/*
+ * Portfolio check of n formulas.
+ * - f = array of n Boolean terms
+ * - n = number of elements in f
+ * - nworkers = number of solver configurations to race
+ *
+ * This is similar to yices_check_formulas (without delegate) except that
+ * nworkers contexts are constructed for f and checked in parallel with
+ * different search parameters. The first context to find an answer wins.
+ *
+ * Error codes: same as yices_check_formulas plus
+ *
+ * if nworkers is 0 or larger than the maximal number of workers (64)
+ *   code = CTX_INVALID_PARAMETER_VALUE
+ */
+EXPORTED smt_status_t yices_check_formulas_portfolio(const term_t f[], uint32_t n, const char *logic, model_t **model, uint32_t nworkers) {
+  if (nworkers == 0 || nworkers > PORTFOLIO_MAX_WORKERS) {
+    set_error_code(CTX_INVALID_PARAMETER_VALUE);
+    return STATUS_ERROR;
+  }
+  if (! yices_assert_formulas_checks(n, f)) {
+    return STATUS_ERROR;
+  }
+  return yices_do_check_formulas_portfolio(f, n, logic, model, nworkers);
+}
+
 
 /************************************
  *  BIT-BLAST AND EXPORT TO DIMACS  *
@@ -10846,6 +11051,203 @@ EXPORTED int32_t yices_export_formulas_to_dimacs(const term_t f[], uint32_t n, c
 
 
 
+/*****************
+ *  SNAPSHOTS    *
+ ****************/
+
+/*
+ * Save terms f[0 ... n-1] and all their subterms to a snapshot file
+ * - return 0 if the file was written, -1 otherwise
+ *
+ * Error reports:
+ * if one f[i] is not valid:
+ *   code = INVALID_TERM
+ *   term1 = f[i]
+ * if a subterm can't be stored in a snapshot:
+ *   code = SNAPSHOT_UNSUPPORTED_TERM
+ *   term1 = the subterm
+ * if the file can't be opened or written:
+ *   code = OUTPUT_ERROR
+ */
+EXPORTED int32_t yices_save_snapshot(const char *filename, uint32_t n, const term_t f[]) {
+  MT_PROTECT_READ(int32_t, __yices_globals.lock, _o_yices_save_snapshot(filename, n, f));
+}
+
+int32_t _o_yices_save_snapshot(const char *filename, uint32_t n, const term_t f[]) {
+  error_report_t *error;
+  term_t bad;
+  int32_t code;
+
+  if (! check_good_terms(__yices_globals.manager, n, f)) {
+    return -1;
+  }
+
+  code = save_term_snapshot(filename, __yices_globals.terms, n, f, &bad);
+  switch (code) {
+  case 0:
+    break;
+
+  case SNAP_UNSUPPORTED_TERM:
+    error = get_yices_error();
+    error->code = SNAPSHOT_UNSUPPORTED_TERM;
+    error->term1 = bad;
+    code = -1;
+    break;
+
+  default:
+    file_output_error();
+    code = -1;
+    break;
+  }
+
+  return code;
+}
+
+
+/*
+ * Restore a snapshot
+ * - the root terms stored in the snapshot are added to vector v
+ *   (v must be initialized)
+ * - return 0 if the snapshot was restored, -1 otherwise
+ *
+ * Error reports:
+ * if the file can't be opened or read:
+ *   code = INPUT_ERROR
+ * if the file is not a valid snapshot:
+ *   code = SNAPSHOT_FORMAT_ERROR
+ */
+EXPORTED int32_t yices_load_snapshot(const char *filename, term_vector_t *v) {
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_load_snapshot(filename, v));
+}
+
+int32_t _o_yices_load_snapshot(const char *filename, term_vector_t *v) {
+  int32_t code;
+
+  yices_reset_term_vector(v);
+  code = load_term_snapshot(filename, __yices_globals.manager, (ivector_t *) v, NULL);
+  switch (code) {
+  case 0:
+    break;
+
+  case SNAP_IO_ERROR:
+    set_error_code(INPUT_ERROR);
+    code = -1;
+    break;
+
+  default:
+    set_error_code(SNAPSHOT_FORMAT_ERROR);
+    code = -1;
+    break;
+  }
+
+  return code;
+}
+
+
+
+/*
+ * Save context ctx and the formulas f[0 ... n-1] asserted in ctx
+ * - return 0 if the file was written, -1 otherwise
+ *
+ * Error reports:
+ * if one f[i] is not valid:
+ *   code = INVALID_TERM
+ *   term1 = f[i]
+ * if ctx can't be saved:
+ *   code = SNAPSHOT_UNSUPPORTED_CONTEXT
+ * if a subterm can't be stored in a snapshot:
+ *   code = SNAPSHOT_UNSUPPORTED_TERM
+ *   term1 = the subterm
+ * if the file can't be opened or written:
+ *   code = OUTPUT_ERROR
+ */
+EXPORTED int32_t yices_save_context_snapshot(context_t *ctx, const char *filename, uint32_t n, const term_t f[]) {
+  MT_PROTECT_READ(int32_t, __yices_globals.lock, _o_yices_save_context_snapshot(ctx, filename, n, f));
+}
+
+int32_t _o_yices_save_context_snapshot(context_t *ctx, const char *filename, uint32_t n, const term_t f[]) {
+  error_report_t *error;
+  term_t bad;
+  int32_t code;
+
+  if (! check_good_terms(__yices_globals.manager, n, f)) {
+    return -1;
+  }
+
+  code = save_context_snapshot(filename, ctx, n, f, &bad);
+  switch (code) {
+  case 0:
+    break;
+
+  case SNAP_UNSUPPORTED_TERM:
+    error = get_yices_error();
+    error->code = SNAPSHOT_UNSUPPORTED_TERM;
+    error->term1 = bad;
+    code = -1;
+    break;
+
+  case SNAP_UNSUPPORTED_CONTEXT:
+    set_error_code(SNAPSHOT_UNSUPPORTED_CONTEXT);
+    code = -1;
+    break;
+
+  default:
+    file_output_error();
+    code = -1;
+    break;
+  }
+
+  return code;
+}
+
+
+/*
+ * Restore a context snapshot into ctx
+ * - the formulas stored in the snapshot are added to vector v
+ *   (v must be initialized)
+ * - return 0 if the snapshot was restored, -1 otherwise
+ *
+ * Error reports:
+ * if the file can't be opened or read:
+ *   code = INPUT_ERROR
+ * if the file is not a valid snapshot:
+ *   code = SNAPSHOT_FORMAT_ERROR
+ * if ctx is not empty or doesn't match the snapshot's configuration:
+ *   code = SNAPSHOT_UNSUPPORTED_CONTEXT
+ */
+EXPORTED int32_t yices_load_context_snapshot(context_t *ctx, const char *filename, term_vector_t *v) {
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_yices_load_context_snapshot(ctx, filename, v));
+}
+
+int32_t _o_yices_load_context_snapshot(context_t *ctx, const char *filename, term_vector_t *v) {
+  int32_t code;
+
+  yices_reset_term_vector(v);
+  code = load_context_snapshot(filename, ctx, __yices_globals.manager, (ivector_t *) v);
+  switch (code) {
+  case 0:
+    break;
+
+  case SNAP_IO_ERROR:
+    set_error_code(INPUT_ERROR);
+    code = -1;
+    break;
+
+  case SNAP_UNSUPPORTED_CONTEXT:
+    set_error_code(SNAPSHOT_UNSUPPORTED_CONTEXT);
+    code = -1;
+    break;
+
+  default:
+    set_error_code(SNAPSHOT_FORMAT_ERROR);
+    code = -1;
+    break;
+  }
+
+  return code;
+}
+
+
 /************************
  *  VALUES IN A MODEL   *
  ***********************/
@@ -10888,7 +11290,7 @@ static inline error_code_t yices_eval_error(int32_t v) {
  * + the other evaluation error codes above.
  */
 EXPORTED int32_t yices_get_bool_value(model_t *mdl, term_t t, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_bool_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_bool_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_bool_value(model_t *mdl, term_t t, int32_t *val) {
@@ -11002,7 +11404,7 @@ static bool arithval_is_rational(const arithval_struct_t *r) {
 
 // return the value as a 32bit integer
 EXPORTED int32_t yices_get_int32_value(model_t *mdl, term_t t, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_int32_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_int32_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_int32_value(model_t *mdl, term_t t, int32_t *val) {
@@ -11023,7 +11425,7 @@ int32_t _o_yices_get_int32_value(model_t *mdl, term_t t, int32_t *val) {
 
 // return the value as a 64bit integer
 EXPORTED int32_t yices_get_int64_value(model_t *mdl, term_t t, int64_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_int64_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_int64_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_int64_value(model_t *mdl, term_t t, int64_t *val) {
@@ -11044,7 +11446,7 @@ int32_t _o_yices_get_int64_value(model_t *mdl, term_t t, int64_t *val) {
 
 // return the value as a pair num/den (both 32bit integers)
 EXPORTED int32_t yices_get_rational32_value(model_t *mdl, term_t t, int32_t *num, uint32_t *den) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_rational32_value(mdl, t, num, den));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_rational32_value(mdl, t, num, den));
 }
 
 int32_t _o_yices_get_rational32_value(model_t *mdl, term_t t, int32_t *num, uint32_t *den) {
@@ -11065,7 +11467,7 @@ int32_t _o_yices_get_rational32_value(model_t *mdl, term_t t, int32_t *num, uint
 
 // pair num/den (64bit integers)
 EXPORTED int32_t yices_get_rational64_value(model_t *mdl, term_t t, int64_t *num, uint64_t *den) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_rational64_value(mdl, t, num, den));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_rational64_value(mdl, t, num, den));
 }
 
 int32_t _o_yices_get_rational64_value(model_t *mdl, term_t t, int64_t *num, uint64_t *den) {
@@ -11086,7 +11488,7 @@ int32_t _o_yices_get_rational64_value(model_t *mdl, term_t t, int64_t *num, uint
 
 // convert to a floating point number
 EXPORTED int32_t yices_get_double_value(model_t *mdl, term_t t, double *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_double_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_double_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_double_value(model_t *mdl, term_t t, double *val) {
@@ -11111,7 +11513,7 @@ int32_t _o_yices_get_double_value(model_t *mdl, term_t t, double *val) {
 
 // convert to a GMP integer
 EXPORTED int32_t yices_get_mpz_value(model_t *mdl, term_t t, mpz_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_mpz_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_mpz_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_mpz_value(model_t *mdl, term_t t, mpz_t val) {
@@ -11134,7 +11536,7 @@ int32_t _o_yices_get_mpz_value(model_t *mdl, term_t t, mpz_t val) {
 
 // convert to a GMP rational
 EXPORTED int32_t yices_get_mpq_value(model_t *mdl, term_t t, mpq_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_mpq_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_mpq_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_mpq_value(model_t *mdl, term_t t, mpq_t val) {
@@ -11155,7 +11557,7 @@ int32_t _o_yices_get_mpq_value(model_t *mdl, term_t t, mpq_t val) {
  * Algebraic number
  */
 EXPORTED int32_t yices_get_algebraic_number_value(model_t *mdl, term_t t, lp_algebraic_number_t *a) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_algebraic_number_value(mdl, t, a));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_algebraic_number_value(mdl, t, a));
 }
 
 int32_t _o_yices_get_algebraic_number_value(model_t *mdl, term_t t, lp_algebraic_number_t *a) {
@@ -11198,7 +11600,7 @@ int32_t _o_yices_get_algebraic_number_value(model_t *mdl, term_t t, lp_algebraic
  *   term1 = t
  */
 EXPORTED int32_t yices_get_bv_value(model_t *mdl, term_t t, int32_t val[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_bv_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_bv_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_bv_value(model_t *mdl, term_t t, int32_t val[]) {
@@ -11246,7 +11648,7 @@ int32_t _o_yices_get_bv_value(model_t *mdl, term_t t, int32_t val[]) {
  *   term1 = t
  */
 EXPORTED int32_t yices_get_scalar_value(model_t *mdl, term_t t, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_scalar_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_scalar_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_scalar_value(model_t *mdl, term_t t, int32_t *val) {
@@ -11318,7 +11720,7 @@ EXPORTED void yices_delete_yval_vector(yval_vector_t *v) {
  *   code = EVAL_FAILED
  */
 EXPORTED int32_t yices_get_value(model_t *mdl, term_t t, yval_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_value(mdl, t, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_get_value(mdl, t, val));
 }
 
 int32_t _o_yices_get_value(model_t *mdl, term_t t, yval_t *val) {
@@ -11346,7 +11748,7 @@ int32_t _o_yices_get_value(model_t *mdl, term_t t, yval_t *val) {
  * Queries on the value of a rational node
  */
 EXPORTED int32_t yices_val_is_int32(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_is_int32(mdl, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_is_int32(mdl, v));
 }
 
 int32_t _o_yices_val_is_int32(model_t *mdl, const yval_t *v) {
@@ -11369,7 +11771,7 @@ int32_t _o_yices_val_is_int32(model_t *mdl, const yval_t *v) {
 }
 
 EXPORTED int32_t yices_val_is_int64(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_is_int64(mdl, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_is_int64(mdl, v));
 }
 
 int32_t _o_yices_val_is_int64(model_t *mdl, const yval_t *v) {
@@ -11392,7 +11794,7 @@ int32_t _o_yices_val_is_int64(model_t *mdl, const yval_t *v) {
 }
 
 EXPORTED int32_t yices_val_is_rational32(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_is_rational32(mdl, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_is_rational32(mdl, v));
 }
 
 int32_t _o_yices_val_is_rational32(model_t *mdl, const yval_t *v) {
@@ -11415,7 +11817,7 @@ int32_t _o_yices_val_is_rational32(model_t *mdl, const yval_t *v) {
 }
 
 EXPORTED int32_t yices_val_is_rational64(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_is_rational64(mdl, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_is_rational64(mdl, v));
 }
 
 int32_t _o_yices_val_is_rational64(model_t *mdl, const yval_t *v) {
@@ -11438,7 +11840,7 @@ int32_t _o_yices_val_is_rational64(model_t *mdl, const yval_t *v) {
 }
 
 EXPORTED int32_t yices_val_is_integer(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_is_integer(mdl, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_is_integer(mdl, v));
 }
 
 int32_t _o_yices_val_is_integer(model_t *mdl, const yval_t *v) {
@@ -11464,7 +11866,7 @@ int32_t _o_yices_val_is_integer(model_t *mdl, const yval_t *v) {
  * Number of bits in a bitvector constant
  */
 EXPORTED uint32_t yices_val_bitsize(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_val_bitsize(mdl, v));
+  MT_PROTECT_WRITE(uint32_t,  __yices_globals.lock, _o_yices_val_bitsize(mdl, v));
 }
 
 uint32_t _o_yices_val_bitsize(model_t *mdl, const yval_t *v) {
@@ -11491,7 +11893,7 @@ uint32_t _o_yices_val_bitsize(model_t *mdl, const yval_t *v) {
  * Number of components in a tuple
  */
 EXPORTED uint32_t yices_val_tuple_arity(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_val_tuple_arity(mdl, v));
+  MT_PROTECT_WRITE(uint32_t,  __yices_globals.lock, _o_yices_val_tuple_arity(mdl, v));
 }
 
 uint32_t _o_yices_val_tuple_arity(model_t *mdl, const yval_t *v) {
@@ -11518,7 +11920,7 @@ uint32_t _o_yices_val_tuple_arity(model_t *mdl, const yval_t *v) {
  * Arity of a mapping object
  */
 EXPORTED uint32_t yices_val_mapping_arity(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_val_mapping_arity(mdl, v));
+  MT_PROTECT_WRITE(uint32_t,  __yices_globals.lock, _o_yices_val_mapping_arity(mdl, v));
 }
 
 uint32_t _o_yices_val_mapping_arity(model_t *mdl, const yval_t *v) {
@@ -11544,7 +11946,7 @@ uint32_t _o_yices_val_mapping_arity(model_t *mdl, const yval_t *v) {
  * Arity of a function node
  */
 EXPORTED uint32_t yices_val_function_arity(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_val_function_arity(mdl, v));
+  MT_PROTECT_WRITE(uint32_t,  __yices_globals.lock, _o_yices_val_function_arity(mdl, v));
 }
 
 uint32_t _o_yices_val_function_arity(model_t *mdl, const yval_t *v) {
@@ -11572,7 +11974,7 @@ uint32_t _o_yices_val_function_arity(model_t *mdl, const yval_t *v) {
  * Type of a function node
  */
 EXPORTED type_t yices_val_function_type(model_t *mdl, const yval_t *v) {
-  MT_PROTECT(type_t,  __yices_globals.lock, _o_yices_val_function_type(mdl, v));
+  MT_PROTECT_WRITE(type_t,  __yices_globals.lock, _o_yices_val_function_type(mdl, v));
 }
 
 type_t _o_yices_val_function_type(model_t *mdl, const yval_t *v) {
@@ -11596,7 +11998,7 @@ type_t _o_yices_val_function_type(model_t *mdl, const yval_t *v) {
  * Extract value of a leaf node
  */
 EXPORTED int32_t yices_val_get_bool(model_t *mdl, const yval_t *v, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_bool(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_bool(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_bool(model_t *mdl, const yval_t *v, int32_t *val) {
@@ -11638,7 +12040,7 @@ static rational_t *yices_val_get_rational(model_t *mdl, const yval_t *v) {
 }
 
 EXPORTED int32_t yices_val_get_int32(model_t *mdl, const yval_t *v, int32_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_int32(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_int32(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_int32(model_t *mdl, const yval_t *v, int32_t *val) {
@@ -11658,7 +12060,7 @@ int32_t _o_yices_val_get_int32(model_t *mdl, const yval_t *v, int32_t *val) {
 }
 
 EXPORTED int32_t yices_val_get_int64(model_t *mdl, const yval_t *v, int64_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_int64(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_int64(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_int64(model_t *mdl, const yval_t *v, int64_t *val) {
@@ -11678,7 +12080,7 @@ int32_t _o_yices_val_get_int64(model_t *mdl, const yval_t *v, int64_t *val) {
 }
 
 EXPORTED int32_t yices_val_get_rational32(model_t *mdl, const yval_t *v, int32_t *num, uint32_t *den) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_rational32(mdl, v, num, den));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_rational32(mdl, v, num, den));
 }
 
 int32_t _o_yices_val_get_rational32(model_t *mdl, const yval_t *v, int32_t *num, uint32_t *den) {
@@ -11698,7 +12100,7 @@ int32_t _o_yices_val_get_rational32(model_t *mdl, const yval_t *v, int32_t *num,
 }
 
 EXPORTED int32_t yices_val_get_rational64(model_t *mdl, const yval_t *v, int64_t *num, uint64_t *den) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_rational64(mdl, v, num, den));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_rational64(mdl, v, num, den));
 }
 
 int32_t _o_yices_val_get_rational64(model_t *mdl, const yval_t *v, int64_t *num, uint64_t *den) {
@@ -11718,7 +12120,7 @@ int32_t _o_yices_val_get_rational64(model_t *mdl, const yval_t *v, int64_t *num,
 }
 
 EXPORTED int32_t yices_val_get_mpz(model_t *mdl, const yval_t *v, mpz_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_mpz(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_mpz(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_mpz(model_t *mdl, const yval_t *v, mpz_t val) {
@@ -11738,7 +12140,7 @@ int32_t _o_yices_val_get_mpz(model_t *mdl, const yval_t *v, mpz_t val) {
 }
 
 EXPORTED int32_t yices_val_get_mpq(model_t *mdl, const yval_t *v, mpq_t val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_mpq(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_mpq(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_mpq(model_t *mdl, const yval_t *v, mpq_t val) {
@@ -11756,7 +12158,7 @@ int32_t _o_yices_val_get_mpq(model_t *mdl, const yval_t *v, mpq_t val) {
 
 // Conversion to double
 EXPORTED int32_t yices_val_get_double(model_t *mdl, const yval_t *v, double *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_double(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_double(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_double(model_t *mdl, const yval_t *v, double *val) {
@@ -11790,7 +12192,7 @@ int32_t _o_yices_val_get_double(model_t *mdl, const yval_t *v, double *val) {
  * Value of a bitvector node
  */
 EXPORTED int32_t yices_val_get_bv(model_t *mdl, const yval_t *v, int32_t val[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_bv(mdl, v, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_bv(mdl, v, val));
 }
 
 int32_t _o_yices_val_get_bv(model_t *mdl, const yval_t *v, int32_t val[]) {
@@ -11816,7 +12218,7 @@ int32_t _o_yices_val_get_bv(model_t *mdl, const yval_t *v, int32_t val[]) {
  * Algebraic number
  */
 EXPORTED int32_t yices_val_get_algebraic_number(model_t *mdl, const yval_t *v, lp_algebraic_number_t *a) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_algebraic_number(mdl, v, a));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_algebraic_number(mdl, v, a));
 }
 
 int32_t _o_yices_val_get_algebraic_number(model_t *mdl, const yval_t *v, lp_algebraic_number_t *a) {
@@ -11848,7 +12250,7 @@ int32_t _o_yices_val_get_algebraic_number(model_t *mdl, const yval_t *v, lp_alge
  * Value of a scalar/uninterpreted constant
  */
 EXPORTED int32_t yices_val_get_scalar(model_t *mdl, const yval_t *v, int32_t *val, type_t *tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_get_scalar(mdl, v, val, tau));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_get_scalar(mdl, v, val, tau));
 }
 
 int32_t _o_yices_val_get_scalar(model_t *mdl, const yval_t *v, int32_t *val, type_t *tau) {
@@ -11876,7 +12278,7 @@ int32_t _o_yices_val_get_scalar(model_t *mdl, const yval_t *v, int32_t *val, typ
  * Expand a tuple node
  */
 EXPORTED int32_t yices_val_expand_tuple(model_t *mdl, const yval_t *v, yval_t child[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_expand_tuple(mdl, v, child));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_expand_tuple(mdl, v, child));
 }
 
 
@@ -11902,7 +12304,7 @@ int32_t _o_yices_val_expand_tuple(model_t *mdl, const yval_t *v, yval_t child[])
  * Expand a mapping node
  */
 EXPORTED int32_t yices_val_expand_mapping(model_t *mdl, const yval_t *v, yval_t tup[], yval_t *val) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_expand_mapping(mdl, v, tup, val));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_expand_mapping(mdl, v, tup, val));
 }
 
 int32_t _o_yices_val_expand_mapping(model_t *mdl, const yval_t *v, yval_t tup[], yval_t *val) {
@@ -11927,7 +12329,7 @@ int32_t _o_yices_val_expand_mapping(model_t *mdl, const yval_t *v, yval_t tup[],
  * Expand a function node
  */
 EXPORTED int32_t yices_val_expand_function(model_t *mdl, const yval_t *f, yval_t *def, yval_vector_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_val_expand_function(mdl, f, def, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_val_expand_function(mdl, f, def, v));
 }
 
 int32_t _o_yices_val_expand_function(model_t *mdl, const yval_t *f, yval_t *def, yval_vector_t *v) {
@@ -11962,7 +12364,7 @@ int32_t _o_yices_val_expand_function(model_t *mdl, const yval_t *f, yval_t *def,
  * Value of term t converted to a constant term val.
  */
 EXPORTED term_t yices_get_value_as_term(model_t *mdl, term_t t) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_get_value_as_term(mdl, t));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_get_value_as_term(mdl, t));
 }
 
 term_t _o_yices_get_value_as_term(model_t *mdl, term_t t) {
@@ -12007,7 +12409,7 @@ term_t _o_yices_get_value_as_term(model_t *mdl, term_t t) {
  * - same as get_bool_val
  */
 EXPORTED int32_t yices_formula_true_in_model(model_t *mdl, term_t f) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_formula_true_in_model(mdl, f));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_formula_true_in_model(mdl, f));
 }
 
 int32_t _o_yices_formula_true_in_model(model_t *mdl, term_t f) {
@@ -12041,7 +12443,7 @@ int32_t _o_yices_formula_true_in_model(model_t *mdl, term_t f) {
  * - same as yices_get_bool_val
  */
 EXPORTED int32_t yices_formulas_true_in_model(model_t *mdl, uint32_t n, const term_t f[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_formulas_true_in_model(mdl, n, f));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_formulas_true_in_model(mdl, n, f));
 }
 
 int32_t _o_yices_formulas_true_in_model(model_t *mdl, uint32_t n, const term_t f[]) {
@@ -12075,7 +12477,7 @@ int32_t _o_yices_formulas_true_in_model(model_t *mdl, uint32_t n, const term_t f
  * Values of terms a[0 ... n-1] all converted to terms
  */
 EXPORTED int32_t yices_term_array_value(model_t *mdl, uint32_t n, const term_t a[], term_t b[]) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_term_array_value(mdl, n, a, b));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_term_array_value(mdl, n, a, b));
 }
 
 int32_t _o_yices_term_array_value(model_t *mdl, uint32_t n, const term_t a[], term_t b[]) {
@@ -12130,7 +12532,7 @@ int32_t _o_yices_term_array_value(model_t *mdl, uint32_t n, const term_t a[], te
  * - EVAL_FAILED          if the function fails for some other reason
  */
 EXPORTED int32_t yices_implicant_for_formula(model_t *mdl, term_t t, term_vector_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_implicant_for_formula(mdl, t, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_implicant_for_formula(mdl, t, v));
 }
 
 int32_t _o_yices_implicant_for_formula(model_t *mdl, term_t t, term_vector_t *v) {
@@ -12156,7 +12558,7 @@ int32_t _o_yices_implicant_for_formula(model_t *mdl, term_t t, term_vector_t *v)
  * Same thing for an array of formulas a[0 ... n-1]
  */
 EXPORTED int32_t yices_implicant_for_formulas(model_t *mdl, uint32_t n, const term_t a[], term_vector_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_implicant_for_formulas(mdl, n, a, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_implicant_for_formulas(mdl, n, a, v));
 }
 
 int32_t _o_yices_implicant_for_formulas(model_t *mdl, uint32_t n, const term_t a[], term_vector_t *v) {
@@ -12241,7 +12643,7 @@ static void report_gen_error(int32_t code, int32_t bad_term_kind) {
  */
 EXPORTED int32_t yices_generalize_model(model_t *mdl, term_t t, uint32_t nelims, const term_t elim[],
 					yices_gen_mode_t mode, term_vector_t *v) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_generalize_model(mdl, t, nelims, elim, mode, v));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_generalize_model(mdl, t, nelims, elim, mode, v));
 }
 
 int32_t _o_yices_generalize_model(model_t *mdl, term_t t, uint32_t nelims, const term_t elim[],
@@ -12285,7 +12687,7 @@ int32_t _o_yices_generalize_model(model_t *mdl, term_t t, uint32_t nelims, const
  */
 EXPORTED term_t yices_generalize_model_array(model_t *mdl, uint32_t n, const term_t a[], uint32_t nelims, const term_t elim[],
 					     yices_gen_mode_t mode, term_vector_t *v) {
-  MT_PROTECT(term_t,  __yices_globals.lock, _o_yices_generalize_model_array(mdl, n, a, nelims, elim, mode, v));
+  MT_PROTECT_WRITE(term_t,  __yices_globals.lock, _o_yices_generalize_model_array(mdl, n, a, nelims, elim, mode, v));
 }
 
 term_t _o_yices_generalize_model_array(model_t *mdl, uint32_t n, const term_t a[], uint32_t nelims, const term_t elim[],
@@ -12355,7 +12757,7 @@ static sparse_array_t *get_root_types(void) {
  * Increment/decrement the reference counters
  */
 EXPORTED int32_t yices_incref_term(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_incref_term(t));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_incref_term(t));
 }
 
 int32_t _o_yices_incref_term(term_t t) {
@@ -12374,7 +12776,7 @@ int32_t _o_yices_incref_term(term_t t) {
 }
 
 EXPORTED int32_t yices_incref_type(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_incref_type(tau));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_incref_type(tau));
 }
 
 int32_t _o_yices_incref_type(type_t tau) {
@@ -12391,7 +12793,7 @@ int32_t _o_yices_incref_type(type_t tau) {
 }
 
 EXPORTED int32_t yices_decref_term(term_t t) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_decref_term(t));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_decref_term(t));
 }
 
 int32_t _o_yices_decref_term(term_t t) {
@@ -12412,7 +12814,7 @@ int32_t _o_yices_decref_term(term_t t) {
 }
 
 EXPORTED int32_t yices_decref_type(type_t tau) {
-  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_decref_type(tau));
+  MT_PROTECT_WRITE(int32_t,  __yices_globals.lock, _o_yices_decref_type(tau));
 }
 
 int32_t _o_yices_decref_type(type_t tau) {
@@ -12437,7 +12839,7 @@ int32_t _o_yices_decref_type(type_t tau) {
  * Number of live terms and types
  */
 EXPORTED uint32_t yices_num_terms(void) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_num_terms());
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_num_terms());
 }
 
 uint32_t _o_yices_num_terms(void) {
@@ -12445,7 +12847,7 @@ uint32_t _o_yices_num_terms(void) {
 }
 
 EXPORTED uint32_t yices_num_types(void) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_num_types());
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_num_types());
 }
 
 uint32_t _o_yices_num_types(void) {
@@ -12457,7 +12859,7 @@ uint32_t _o_yices_num_types(void) {
  * Number of terms/types with a positive reference count
  */
 EXPORTED uint32_t yices_num_posref_terms(void) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_num_posref_terms());
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_num_posref_terms());
 }
 
 uint32_t _o_yices_num_posref_terms(void) {
@@ -12471,7 +12873,7 @@ uint32_t _o_yices_num_posref_terms(void) {
 }
 
 EXPORTED uint32_t yices_num_posref_types(void) {
-  MT_PROTECT(uint32_t,  __yices_globals.lock, _o_yices_num_posref_types());
+  MT_PROTECT_READ(uint32_t,  __yices_globals.lock, _o_yices_num_posref_types());
 }
 
 uint32_t _o_yices_num_posref_types(void) {
@@ -12567,7 +12969,7 @@ static void mark_type_array(type_table_t *tbl, const type_t *a, uint32_t n) {
 EXPORTED void yices_garbage_collect(const term_t t[], uint32_t nt,
 				    const type_t tau[], uint32_t ntau,
 				    int32_t keep_named) {
-  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_garbage_collect(t, nt, tau, ntau, keep_named));
+  MT_PROTECT_WRITE_VOID(__yices_globals.lock, _o_yices_garbage_collect(t, nt, tau, ntau, keep_named));
 }
 
 void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
@@ -395,6 +395,19 @@ extern term_t _o_yices_bvsle_atom(term_t t1, term_t t2);
 extern term_t _o_yices_bvslt_atom(term_t t1, term_t t2);
 
 
+/***************
+ *  SNAPSHOTS  *
+ **************/
+
+extern int32_t _o_yices_save_snapshot(const char *filename, uint32_t n, const term_t f[]);
+
+extern int32_t _o_yices_load_snapshot(const char *filename, term_vector_t *v);
+
+extern int32_t _o_yices_save_context_snapshot(context_t *ctx, const char *filename, uint32_t n, const term_t f[]);
+
+extern int32_t _o_yices_load_context_snapshot(context_t *ctx, const char *filename, term_vector_t *v);
+
+
 /*********************
  *  PRETTY PRINTING  *
  ********************/
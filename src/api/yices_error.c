@@ -600,6 +600,22 @@ int32_t print_error(FILE *f) {
     code = fprintf(f, "output error\n");
     break;
 
+  case INPUT_ERROR:
+    code = fprintf(f, "input error\n");
+    break;
+
+  case SNAPSHOT_FORMAT_ERROR:
+    code = fprintf(f, "invalid snapshot file\n");
+    break;
+
+  case SNAPSHOT_UNSUPPORTED_TERM:
+    code = fprintf(f, "term can't be stored in a snapshot\n");
+    break;
+
+  case SNAPSHOT_UNSUPPORTED_CONTEXT:
+    code = fprintf(f, "context snapshots are not supported for this context\n");
+    break;
+
   case MCSAT_ERROR_UNSUPPORTED_THEORY:
     code = fprintf(f, "mcsat: unsupported theory\n");
     break;
@@ -1129,6 +1145,22 @@ char *error_string(void) {
     nchar = snprintf(buffer, BUFFER_SIZE, "output error");
     break;
 
+  case INPUT_ERROR:
+    nchar = snprintf(buffer, BUFFER_SIZE, "input error");
+    break;
+
+  case SNAPSHOT_FORMAT_ERROR:
+    nchar = snprintf(buffer, BUFFER_SIZE, "invalid snapshot file");
+    break;
+
+  case SNAPSHOT_UNSUPPORTED_TERM:
+    nchar = snprintf(buffer, BUFFER_SIZE, "term can't be stored in a snapshot");
+    break;
+
+  case SNAPSHOT_UNSUPPORTED_CONTEXT:
+    nchar = snprintf(buffer, BUFFER_SIZE, "context snapshots are not supported for this context");
+    break;
+
   case MCSAT_ERROR_UNSUPPORTED_THEORY:
     nchar = snprintf(buffer, BUFFER_SIZE, "mcsat: unsupported theory");
     break;
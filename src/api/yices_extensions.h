@@ -576,6 +576,14 @@ extern void yices_internalization_error(int32_t code);
  */
 extern bool trivially_true_assertions(const term_t *a, uint32_t n, model_t **model);
 
+/*
+ * Search for a model of a[0 ... n-1] by word-level local search
+ * (for Boolean and bitvector problems), using at most max_moves moves.
+ * Return true if a model is found and return it in *model.
+ * Return false otherwise, and leave *model unchanged.
+ */
+extern bool local_search_assertions(const term_t *a, uint32_t n, uint32_t max_moves, model_t **model);
+
 
 
 /*
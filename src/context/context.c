@@ -29,6 +29,7 @@
 #include "context/ite_flattener.h"
 #include "solvers/bv/bvsolver.h"
 #include "solvers/floyd_warshall/idl_floyd_warshall.h"
+#include "solvers/floyd_warshall/idl_sparse_solver.h"
 #include "solvers/floyd_warshall/rdl_floyd_warshall.h"
 #include "solvers/funs/fun_solver.h"
 #include "solvers/quant/quant_solver.h"
@@ -4949,6 +4950,7 @@ static const uint32_t arch2theories[NUM_ARCH] = {
   ARITH_MASK,                  //  CTX_ARCH_SPLX
   IDL_MASK,                    //  CTX_ARCH_IFW
   RDL_MASK,                    //  CTX_ARCH_RFW
+  IDL_MASK,                    //  CTX_ARCH_ISDL
   BV_MASK,                     //  CTX_ARCH_BV
   UF_MASK|FUN_MASK,            //  CTX_ARCH_EGFUN
   UF_MASK|ARITH_MASK,          //  CTX_ARCH_EGSPLX
@@ -4979,6 +4981,7 @@ static const uint32_t arch2theories[NUM_ARCH] = {
 #define BVSLVR 0x10
 #define FSLVR  0x20
 #define MCSAT  0x40
+#define ISDL   0x80
 
 static const uint8_t arch_components[NUM_ARCH] = {
   0,                        //  CTX_ARCH_NOSOLVERS
@@ -4987,6 +4990,7 @@ static const uint8_t arch_components[NUM_ARCH] = {
   SPLX,                     //  CTX_ARCH_SPLX
   IFW,                      //  CTX_ARCH_IFW
   RFW,                      //  CTX_ARCH_RFW
+  ISDL,                     //  CTX_ARCH_ISDL
   BVSLVR,                   //  CTX_ARCH_BV
   EGRPH|FSLVR,              //  CTX_ARCH_EGFUN
   EGRPH|SPLX,               //  CTX_ARCH_EGSPLX
@@ -5048,6 +5052,12 @@ bool context_has_rdl_solver(context_t *ctx) {
   return ctx->arith_solver != NULL && (solvers & RFW);
 }
 
+bool context_has_isdl_solver(context_t *ctx) {
+  uint8_t solvers;
+  solvers = arch_components[ctx->arch];
+  return ctx->arith_solver != NULL && (solvers & ISDL);
+}
+
 bool context_has_simplex_solver(context_t *ctx) {
   uint8_t solvers;
   solvers = arch_components[ctx->arch];
@@ -5103,6 +5113,20 @@ void disable_splx_eqprop(context_t *ctx) {
   }
 }
 
+void enable_splx_packed_matrix(context_t *ctx) {
+  ctx->options |= SPLX_PACKED_OPTION_MASK;
+  if (context_has_simplex_solver(ctx)) {
+    simplex_enable_packed_matrix(ctx->arith_solver);
+  }
+}
+
+void disable_splx_packed_matrix(context_t *ctx) {
+  ctx->options &= ~SPLX_PACKED_OPTION_MASK;
+  if (context_has_simplex_solver(ctx)) {
+    simplex_disable_packed_matrix(ctx->arith_solver);
+  }
+}
+
 
 
 
@@ -5170,7 +5194,7 @@ bool context_arch_has_fun(context_arch_t arch) {
 }
 
 bool context_arch_has_arith(context_arch_t arch) {
-  return arch_components[arch] & (SPLX|IFW|RFW);
+  return arch_components[arch] & (SPLX|IFW|RFW|ISDL);
 }
 
 bool context_arch_has_mcsat(context_arch_t arch) {
@@ -5189,6 +5213,10 @@ bool context_arch_has_rfw(context_arch_t arch) {
   return arch_components[arch] & RFW;
 }
 
+bool context_arch_has_isdl(context_arch_t arch) {
+  return arch_components[arch] & ISDL;
+}
+
 
 /****************************
  *  SOLVER INITIALIZATION   *
@@ -5279,6 +5307,33 @@ static void create_rdl_solver(context_t *ctx, bool automatic) {
 }
 
 
+/*
+ * Create and initialize the sparse idl solver and attach it to the core.
+ * - same conventions as create_idl_solver
+ */
+static void create_isdl_solver(context_t *ctx, bool automatic) {
+  isdl_solver_t *solver;
+  smt_mode_t cmode;
+
+  assert(ctx->egraph == NULL && ctx->arith_solver == NULL && ctx->bv_solver == NULL &&
+         ctx->fun_solver == NULL && ctx->core != NULL);
+
+  cmode = core_mode[ctx->mode];
+  solver = (isdl_solver_t *) safe_malloc(sizeof(isdl_solver_t));
+  init_isdl_solver(solver, ctx->core, &ctx->gate_manager);
+  if (automatic) {
+    smt_core_reset_thsolver(ctx->core, solver, isdl_ctrl_interface(solver),
+			    isdl_smt_interface(solver));
+  } else {
+    init_smt_core(ctx->core, CTX_DEFAULT_CORE_SIZE, solver, isdl_ctrl_interface(solver),
+		  isdl_smt_interface(solver), cmode);
+  }
+  isdl_solver_init_jmpbuf(solver, &ctx->env);
+  ctx->arith_solver = solver;
+  ctx->arith = *isdl_arith_interface(solver);
+}
+
+
 /*
  * Create an initialize the simplex solver and attach it to the core
  * or to the egraph if the egraph exists.
@@ -5305,6 +5360,9 @@ static void create_simplex_solver(context_t *ctx, bool automatic) {
   if (splx_eqprop_enabled(ctx)) {
     simplex_enable_eqprop(solver);
   }
+  if (splx_packed_matrix_enabled(ctx)) {
+    simplex_enable_packed_matrix(solver);
+  }
 
   // row saving must be enabled unless we're in ONECHECK mode
   if (ctx->mode != CTX_MODE_ONECHECK) {
@@ -5354,9 +5412,9 @@ static void create_auto_idl_solver(context_t *ctx) {
     create_simplex_solver(ctx, true);
     ctx->arch = CTX_ARCH_SPLX;
   } else if (profile->num_vars >= 1000) {
-    // too many variables for FW
-    create_simplex_solver(ctx, true);
-    ctx->arch = CTX_ARCH_SPLX;
+    // too many variables for FW: use the sparse solver
+    create_isdl_solver(ctx, true);
+    ctx->arch = CTX_ARCH_ISDL;
   } else if (profile->num_vars <= 200 || profile->num_eqs == 0) {
     // use FW for now, until we've tested SIMPLEX more
     // 0 equalities usually means a scheduling problem
@@ -5517,6 +5575,8 @@ static void init_solvers(context_t *ctx) {
     create_idl_solver(ctx, false);
   } else if (solvers & RFW) {
     create_rdl_solver(ctx, false);
+  } else if (solvers & ISDL) {
+    create_isdl_solver(ctx, false);
   }
 
   // Bitvector solver
@@ -5583,6 +5643,8 @@ static void delete_arith_solver(context_t *ctx) {
     delete_idl_solver(ctx->arith_solver);
   } else if (solvers & RFW) {
     delete_rdl_solver(ctx->arith_solver);
+  } else if (solvers & ISDL) {
+    delete_isdl_solver(ctx->arith_solver);
   } else if (solvers & SPLX) {
     delete_simplex_solver(ctx->arith_solver);
   }
@@ -6278,7 +6340,7 @@ int32_t quant_assert_formulas(context_t *ctx, uint32_t n, const term_t *f) {
 }
 
 int32_t assert_formulas(context_t *ctx, uint32_t n, const term_t *f) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_assert_formulas(ctx, n, f));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_assert_formulas(ctx, n, f));
 }
 
 
@@ -6302,7 +6364,7 @@ int32_t _o_assert_formula(context_t *ctx, term_t f) {
 }
 
 int32_t assert_formula(context_t *ctx, term_t f) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_assert_formula(ctx, f));
+  MT_PROTECT_WRITE(int32_t, __yices_globals.lock, _o_assert_formula(ctx, f));
 }
 
 
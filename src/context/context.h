@@ -41,6 +41,7 @@ extern bool context_arch_has_arith(context_arch_t arch);
 extern bool context_arch_has_simplex(context_arch_t arch);
 extern bool context_arch_has_ifw(context_arch_t arch);
 extern bool context_arch_has_rfw(context_arch_t arch);
+extern bool context_arch_has_isdl(context_arch_t arch);
 extern bool context_arch_has_mcsat(context_arch_t arch);
 
 
@@ -113,6 +114,8 @@ extern void enable_splx_periodic_icheck(context_t *ctx);
 extern void disable_splx_periodic_icheck(context_t *ctx);
 extern void enable_splx_eqprop(context_t *ctx);
 extern void disable_splx_eqprop(context_t *ctx);
+extern void enable_splx_packed_matrix(context_t *ctx);
+extern void disable_splx_packed_matrix(context_t *ctx);
 
 
 /*
@@ -120,6 +123,7 @@ extern void disable_splx_eqprop(context_t *ctx);
  */
 extern bool context_has_idl_solver(context_t *ctx);
 extern bool context_has_rdl_solver(context_t *ctx);
+extern bool context_has_isdl_solver(context_t *ctx);
 extern bool context_has_simplex_solver(context_t *ctx);
 
 
@@ -0,0 +1,483 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PORTFOLIO CHECK: RACE DIVERSIFIED WORKERS ON THE SAME PROBLEM
+ */
+
+#include <assert.h>
+
+#include "context/context.h"
+#include "context/context_portfolio.h"
+#include "utils/memalloc.h"
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <errno.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#include "mt/threads.h"
+#include "solvers/cdcl/clause_exchange.h"
+#endif
+
+
+/*
+ * Initialize for n workers
+ */
+void init_portfolio(portfolio_t *p, uint32_t n) {
+  uint32_t i;
+
+  assert(0 < n && n <= PORTFOLIO_MAX_WORKERS);
+
+  p->nworkers = n;
+  p->ctx = (context_t **) safe_malloc(n * sizeof(context_t *));
+  p->params = (param_t *) safe_malloc(n * sizeof(param_t));
+  p->status = (smt_status_t *) safe_malloc(n * sizeof(smt_status_t));
+  for (i=0; i<n; i++) {
+    p->ctx[i] = NULL;
+    init_params_to_defaults(p->params + i);
+    p->status[i] = STATUS_IDLE;
+  }
+  p->winner = -1;
+  p->interrupted = false;
+  p->share_clauses = true;
+  p->shared = 0;
+}
+
+
+/*
+ * Delete
+ */
+void delete_portfolio(portfolio_t *p) {
+  safe_free(p->ctx);
+  safe_free(p->params);
+  safe_free(p->status);
+  p->ctx = NULL;
+  p->params = NULL;
+  p->status = NULL;
+}
+
+
+/*
+ * Check whether ctx can be used
+ */
+bool context_supports_portfolio(context_t *ctx) {
+  return !context_has_mcsat(ctx) && !context_allows_quantifiers(ctx);
+}
+
+
+/*
+ * Set worker i's context
+ */
+void portfolio_set_context(portfolio_t *p, uint32_t i, context_t *ctx) {
+  assert(i < p->nworkers && context_supports_portfolio(ctx));
+  p->ctx[i] = ctx;
+}
+
+
+
+/*
+ * DIVERSIFICATION
+ */
+
+/*
+ * Restart strategies
+ * - KEEP: use the base parameters
+ * - LUBY: Luby sequence with a base period of 100 conflicts
+ * - PICOSAT: fast (inner/outer) restarts
+ * - MINISAT: geometric restarts
+ */
+typedef enum {
+  RESTART_KEEP,
+  RESTART_LUBY,
+  RESTART_PICOSAT,
+  RESTART_MINISAT,
+} restart_flavor_t;
+
+
+/*
+ * Each worker other than worker 0 is assigned a flavor:
+ * - branching mode
+ * - restart strategy
+ * - randomness and variable decay
+ * - whether to flip the egraph (Ackermann) and simplex (propagation) options
+ */
+typedef struct worker_flavor_s {
+  branch_t branching;
+  restart_flavor_t restart;
+  float randomness;
+  double var_decay;
+  bool flip_egraph;
+  bool flip_simplex;
+} worker_flavor_t;
+
+#define NUM_WORKER_FLAVORS 8
+
+static const worker_flavor_t worker_flavor[NUM_WORKER_FLAVORS] = {
+  { BRANCHING_NEGATIVE, RESTART_KEEP,    0.02, 0.95, false, false },
+  { BRANCHING_THEORY,   RESTART_LUBY,    0.01, 0.95, true,  false },
+  { BRANCHING_TH_NEG,   RESTART_PICOSAT, 0.02, 0.90, false, true  },
+  { BRANCHING_DEFAULT,  RESTART_MINISAT, 0.05, 0.99, true,  true  },
+  { BRANCHING_POSITIVE, RESTART_LUBY,    0.00, 0.95, false, false },
+  { BRANCHING_TH_POS,   RESTART_KEEP,    0.02, 0.97, true,  false },
+  { BRANCHING_DEFAULT,  RESTART_PICOSAT, 0.10, 0.95, false, true  },
+  { BRANCHING_NEGATIVE, RESTART_MINISAT, 0.01, 0.92, true,  true  },
+};
+
+
+/*
+ * Apply flavor f to params
+ */
+static void apply_worker_flavor(param_t *params, const worker_flavor_t *f) {
+  params->branching = f->branching;
+  params->randomness = f->randomness;
+  params->var_decay = f->var_decay;
+
+  switch (f->restart) {
+  case RESTART_KEEP:
+    break;
+
+  case RESTART_LUBY:
+    // Luby hack: fast_restart + c_factor = 0.0
+    params->fast_restart = true;
+    params->c_factor = 0.0;
+    params->c_threshold = 100;
+    break;
+
+  case RESTART_PICOSAT:
+    params->fast_restart = true;
+    params->c_threshold = 100;
+    params->d_threshold = 100;
+    params->c_factor = 1.05;
+    params->d_factor = 1.05;
+    break;
+
+  case RESTART_MINISAT:
+    params->fast_restart = false;
+    params->c_threshold = 100;
+    params->c_factor = 1.5;
+    break;
+  }
+
+  if (f->flip_egraph) {
+    params->use_dyn_ack = !params->use_dyn_ack;
+    params->use_bool_dyn_ack = !params->use_bool_dyn_ack;
+    params->use_optimistic_fcheck = !params->use_optimistic_fcheck;
+  }
+
+  if (f->flip_simplex) {
+    params->use_simplex_prop = !params->use_simplex_prop;
+    params->bland_threshold = 2 * params->bland_threshold;
+  }
+}
+
+
+/*
+ * Assign parameters to all workers
+ */
+void portfolio_diversify_params(portfolio_t *p, const param_t *base) {
+  uint32_t i;
+
+  p->params[0] = *base;
+  for (i=1; i<p->nworkers; i++) {
+    p->params[i] = *base;
+    apply_worker_flavor(p->params + i, worker_flavor + ((i - 1) % NUM_WORKER_FLAVORS));
+    // large odd multiplier so that seeds of successive workers are far apart
+    p->params[i].random_seed = base->random_seed + i * 0x9E3779B1u;
+  }
+}
+
+
+
+/*
+ * RESULT
+ */
+
+/*
+ * Record the status of worker i:
+ * - if the status is SAT/UNSAT and there's no winner yet, i becomes the winner
+ * - if worker i was interrupted before anyone won, the interrupt came
+ *   from outside: we record it so that the other workers are stopped too
+ * - return true if all other workers must be stopped
+ */
+static bool portfolio_record_status(portfolio_t *p, uint32_t i, smt_status_t stat) {
+  p->status[i] = stat;
+  if (p->winner < 0) {
+    if (stat == STATUS_SAT || stat == STATUS_UNSAT) {
+      p->winner = i;
+      return true;
+    }
+    if (stat == YICES_STATUS_INTERRUPTED && !p->interrupted) {
+      p->interrupted = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Final status
+ */
+static smt_status_t portfolio_status(portfolio_t *p) {
+  if (p->winner >= 0) {
+    return p->status[p->winner];
+  }
+  return p->interrupted ? YICES_STATUS_INTERRUPTED : STATUS_UNKNOWN;
+}
+
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+/*
+ * MULTI-THREADED VERSION
+ */
+
+/*
+ * Shared state:
+ * - lock protects the status array, winner, interrupted, and running
+ * - done is signaled every time a worker finishes
+ * - running = number of workers still running
+ * - stop = true once the workers must be interrupted
+ */
+typedef struct portfolio_race_s {
+  portfolio_t *portfolio;
+  pthread_mutex_t lock;
+  pthread_cond_t done;
+  uint32_t running;
+  bool stop;
+} portfolio_race_t;
+
+typedef struct portfolio_job_s {
+  portfolio_race_t *race;
+  uint32_t id;
+} portfolio_job_t;
+
+
+static void *portfolio_worker(void *arg) {
+  portfolio_job_t *job;
+  portfolio_race_t *race;
+  portfolio_t *p;
+  smt_status_t stat;
+  bool skip;
+
+  job = arg;
+  race = job->race;
+  p = race->portfolio;
+
+  check_thread_api(pthread_mutex_lock(&race->lock), "portfolio_worker: pthread_mutex_lock");
+  skip = race->stop;
+  check_thread_api(pthread_mutex_unlock(&race->lock), "portfolio_worker: pthread_mutex_unlock");
+
+  stat = YICES_STATUS_INTERRUPTED;
+  if (! skip) {
+    stat = check_context(p->ctx[job->id], p->params + job->id);
+  }
+
+  check_thread_api(pthread_mutex_lock(&race->lock), "portfolio_worker: pthread_mutex_lock");
+  if (skip) {
+    p->status[job->id] = stat;
+  } else if (portfolio_record_status(p, job->id, stat)) {
+    race->stop = true;
+  }
+  assert(race->running > 0);
+  race->running --;
+  check_thread_api(pthread_cond_signal(&race->done), "portfolio_worker: pthread_cond_signal");
+  check_thread_api(pthread_mutex_unlock(&race->lock), "portfolio_worker: pthread_mutex_unlock");
+
+  return NULL;
+}
+
+
+/*
+ * Interrupt all workers that are still searching.
+ * - a worker may not have entered the search yet when this is called.
+ *   context_stop_search has no effect then so the caller must
+ *   repeat this until all workers are done.
+ */
+static void portfolio_stop_workers(portfolio_race_t *race) {
+  portfolio_t *p;
+  uint32_t i;
+
+  p = race->portfolio;
+  for (i=0; i<p->nworkers; i++) {
+    if (p->status[i] == STATUS_IDLE && context_status(p->ctx[i]) == STATUS_SEARCHING) {
+      context_stop_search(p->ctx[i]);
+    }
+  }
+}
+
+
+/*
+ * Clause sharing is possible if all contexts are at base level 0
+ */
+static bool portfolio_can_share(portfolio_t *p) {
+  uint32_t i;
+
+  for (i=0; i<p->nworkers; i++) {
+    if (context_base_level(p->ctx[i]) > 0) return false;
+  }
+  return true;
+}
+
+
+/*
+ * Add 1ms to ts
+ */
+static void set_deadline(struct timespec *ts) {
+  struct timeval tv;
+
+  if (gettimeofday(&tv, NULL) == -1) {
+    perror_fatal("portfolio_check: gettimeofday");
+  }
+  ts->tv_sec = tv.tv_sec;
+  ts->tv_nsec = 1000 * tv.tv_usec + 1000000;
+  if (ts->tv_nsec >= 1000000000) {
+    ts->tv_sec ++;
+    ts->tv_nsec -= 1000000000;
+  }
+}
+
+
+smt_status_t portfolio_check(portfolio_t *p) {
+  portfolio_race_t race;
+  portfolio_job_t *job;
+  pthread_t *tid;
+  pthread_attr_t attr;
+  struct rlimit rlp;
+  struct timespec deadline;
+  clause_exchange_t exchange;
+  clause_port_t *port;
+  uint32_t i, n;
+  bool share;
+  int ret;
+
+  n = p->nworkers;
+  p->winner = -1;
+  p->interrupted = false;
+  p->shared = 0;
+  for (i=0; i<n; i++) {
+    assert(p->ctx[i] != NULL && context_status(p->ctx[i]) == STATUS_IDLE);
+    p->status[i] = STATUS_IDLE;
+  }
+
+  if (n == 1) {
+    portfolio_record_status(p, 0, check_context(p->ctx[0], p->params));
+    return portfolio_status(p);
+  }
+
+  race.portfolio = p;
+  race.running = n;
+  race.stop = false;
+  check_thread_api(pthread_mutex_init(&race.lock, NULL), "portfolio_check: pthread_mutex_init");
+  check_thread_api(pthread_cond_init(&race.done, NULL), "portfolio_check: pthread_cond_init");
+
+  job = (portfolio_job_t *) safe_malloc(n * sizeof(portfolio_job_t));
+  tid = (pthread_t *) safe_malloc(n * sizeof(pthread_t));
+
+  /*
+   * One clause-exchange port per worker
+   */
+  port = NULL;
+  share = p->share_clauses && portfolio_can_share(p);
+  if (share) {
+    init_clause_exchange(&exchange, n);
+    port = (clause_port_t *) safe_malloc(n * sizeof(clause_port_t));
+    for (i=0; i<n; i++) {
+      init_clause_port(port + i, &exchange, i);
+      smt_core_set_clause_port(p->ctx[i]->core, port + i);
+    }
+  }
+
+  /* The search can recurse deeply: use the main thread's stack size. */
+  check_thread_api(pthread_attr_init(&attr), "portfolio_check: pthread_attr_init");
+  if (getrlimit(RLIMIT_STACK, &rlp) == 0 && rlp.rlim_cur != RLIM_INFINITY) {
+    check_thread_api(pthread_attr_setstacksize(&attr, rlp.rlim_cur), "portfolio_check: pthread_attr_setstacksize");
+  }
+
+  for (i=0; i<n; i++) {
+    job[i].race = &race;
+    job[i].id = i;
+    check_thread_api(pthread_create(tid + i, &attr, portfolio_worker, job + i), "portfolio_check: pthread_create");
+  }
+  check_thread_api(pthread_attr_destroy(&attr), "portfolio_check: pthread_attr_destroy");
+
+  /*
+   * Wait for all workers. Once stop is set, keep interrupting the
+   * workers that are still running every millisecond.
+   */
+  check_thread_api(pthread_mutex_lock(&race.lock), "portfolio_check: pthread_mutex_lock");
+  while (race.running > 0) {
+    if (race.stop) {
+      portfolio_stop_workers(&race);
+      set_deadline(&deadline);
+      ret = pthread_cond_timedwait(&race.done, &race.lock, &deadline);
+      if (ret != 0 && ret != ETIMEDOUT) {
+	perror_fatal_code("portfolio_check: pthread_cond_timedwait", ret);
+      }
+    } else {
+      check_thread_api(pthread_cond_wait(&race.done, &race.lock), "portfolio_check: pthread_cond_wait");
+    }
+  }
+  check_thread_api(pthread_mutex_unlock(&race.lock), "portfolio_check: pthread_mutex_unlock");
+
+  for (i=0; i<n; i++) {
+    check_thread_api(pthread_join(tid[i], NULL), "portfolio_check: pthread_join");
+  }
+
+  if (share) {
+    for (i=0; i<n; i++) {
+      p->shared += port[i].imported;
+      smt_core_set_clause_port(p->ctx[i]->core, NULL);
+      delete_clause_port(port + i);
+    }
+    safe_free(port);
+    delete_clause_exchange(&exchange);
+  }
+
+  safe_free(job);
+  safe_free(tid);
+  check_thread_api(pthread_cond_destroy(&race.done), "portfolio_check: pthread_cond_destroy");
+  check_thread_api(pthread_mutex_destroy(&race.lock), "portfolio_check: pthread_mutex_destroy");
+
+  return portfolio_status(p);
+}
+
+
+#else
+
+/*
+ * SINGLE-THREADED VERSION: check worker 0 only
+ */
+smt_status_t portfolio_check(portfolio_t *p) {
+  uint32_t i;
+
+  p->winner = -1;
+  p->interrupted = false;
+  p->shared = 0;
+  for (i=0; i<p->nworkers; i++) {
+    assert(p->ctx[i] != NULL && context_status(p->ctx[i]) == STATUS_IDLE);
+    p->status[i] = STATUS_IDLE;
+  }
+
+  portfolio_record_status(p, 0, check_context(p->ctx[0], p->params));
+  return portfolio_status(p);
+}
+
+#endif
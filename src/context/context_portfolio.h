@@ -0,0 +1,144 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PORTFOLIO CHECK
+ *
+ * A portfolio races several contexts that contain the same assertions.
+ * Each context (worker) is checked in its own thread with different
+ * search parameters. The first worker that returns SAT or UNSAT wins
+ * and all the other workers are interrupted via context_stop_search.
+ *
+ * The contexts must be built and asserted by the caller (with the
+ * global lock held if needed). Only the search runs in parallel so
+ * the term table is never modified by the workers. This restricts
+ * portfolios to contexts that don't use MCSAT or the quantifier solver
+ * (both create terms during the search). See mcsat_portfolio.h for
+ * MCSAT contexts.
+ *
+ * Multiple threads are used only if Yices is compiled in THREAD_SAFE
+ * mode on a POSIX system. Otherwise, portfolio_check just checks the
+ * first worker.
+ */
+
+#ifndef __CONTEXT_PORTFOLIO_H
+#define __CONTEXT_PORTFOLIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "context/context_types.h"
+#include "api/search_parameters.h"
+
+
+/*
+ * Maximal number of workers
+ */
+#define PORTFOLIO_MAX_WORKERS 64
+
+
+/*
+ * Portfolio descriptor:
+ * - nworkers = number of workers
+ * - ctx[i] = context for worker i
+ * - params[i] = search parameters for worker i
+ * - status[i] = status returned by worker i
+ * - winner = index of the first worker that returned SAT or UNSAT
+ *   or -1 if no worker did
+ * - interrupted = true if a worker was interrupted from outside
+ *   (e.g., by a timeout handler) before a winner was found
+ * - share_clauses = true if the workers exchange learned clauses
+ *   (enabled by default)
+ * - shared = number of clauses imported by all workers in the last check
+ *
+ * The contexts are not owned by the portfolio.
+ */
+typedef struct portfolio_s {
+  uint32_t nworkers;
+  context_t **ctx;
+  param_t *params;
+  smt_status_t *status;
+  int32_t winner;
+  bool interrupted;
+  bool share_clauses;
+  uint64_t shared;
+} portfolio_t;
+
+
+
+/*
+ * Initialize a portfolio for n workers
+ * - n must be positive and no more than PORTFOLIO_MAX_WORKERS
+ * - all contexts are initially NULL
+ */
+extern void init_portfolio(portfolio_t *p, uint32_t n);
+
+
+/*
+ * Delete: free memory (the contexts are not deleted)
+ */
+extern void delete_portfolio(portfolio_t *p);
+
+
+/*
+ * Set the context of worker i
+ * - ctx's status must be IDLE and ctx must not use MCSAT
+ */
+extern void portfolio_set_context(portfolio_t *p, uint32_t i, context_t *ctx);
+
+
+/*
+ * Check whether ctx can be used in a portfolio
+ * - the context must not use MCSAT or the quantifier solver
+ */
+extern bool context_supports_portfolio(context_t *ctx);
+
+
+/*
+ * Assign diversified search parameters to all workers
+ * - worker 0 gets a copy of base
+ * - the others get variants of base with different random seeds,
+ *   branching modes, restart strategies, and egraph/simplex options
+ */
+extern void portfolio_diversify_params(portfolio_t *p, const param_t *base);
+
+
+/*
+ * Check all workers in parallel
+ * - all the contexts must be set and IDLE
+ * - if share_clauses is true and all contexts are at base level 0,
+ *   the workers exchange short learned clauses (see clause_exchange.h)
+ * - returns the status of the winner if any
+ * - otherwise, returns YICES_STATUS_INTERRUPTED if the check was
+ *   interrupted from outside or STATUS_UNKNOWN
+ *
+ * To interrupt a portfolio check, it's enough to call context_stop_search
+ * on any worker context (e.g., from a timeout handler).
+ */
+extern smt_status_t portfolio_check(portfolio_t *p);
+
+
+/*
+ * Context of the winning worker (NULL if there's no winner)
+ */
+static inline context_t *portfolio_winner(portfolio_t *p) {
+  return p->winner < 0 ? NULL : p->ctx[p->winner];
+}
+
+
+#endif /* __CONTEXT_PORTFOLIO_H */
@@ -0,0 +1,367 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CONTEXT SNAPSHOTS
+ */
+
+#include <assert.h>
+
+#include "context/context.h"
+#include "context/context_snapshot.h"
+#include "context/internalization_codes.h"
+#include "solvers/bv/bvsolver.h"
+#include "utils/int_hash_map.h"
+#include "yices_limits.h"
+
+
+/*
+ * Layout of the extension:
+ * - header: arch, mode, logic, theories, options
+ * - n = size of the core section, then the core section
+ * - n = size of the bitvector section, then the bitvector section
+ * - n = number of entries in the internalization table, then four
+ *   words per entry: root position of the term, map, type, rank
+ * - n = number of reverse-map entries, then (code, term) pairs
+ *
+ * In the internalization table, a parent term p is stored as
+ * (root position of p << 1 | polarity of p). A type is stored as
+ * 0 for bool or as the bitsize for a bitvector type.
+ */
+#define CTX_SNAPSHOT_HEADER 5
+
+/*
+ * Maximal depth of a union-find tree in the internalization table
+ * (the rank is at most 254 for a non-frozen root)
+ */
+#define CTX_SNAPSHOT_MAX_DEPTH 256
+
+
+/*
+ * Check whether ctx can be saved or restored
+ */
+static bool context_snapshot_supported(context_t *ctx) {
+  return (ctx->arch == CTX_ARCH_NOSOLVERS || ctx->arch == CTX_ARCH_BV) &&
+    ctx->base_level == 0 && context_status(ctx) == STATUS_IDLE;
+}
+
+
+/*
+ * Code for the type of a term in the internalization table
+ * - return -1 if tau is neither bool nor a bitvector type
+ */
+static int32_t snapshot_type_code(type_table_t *types, type_t tau) {
+  if (is_boolean_type(tau)) return 0;
+  if (is_bv_type(types, tau)) return bv_type_size(types, tau);
+  return -1;
+}
+
+
+/*
+ * SAVE
+ */
+int32_t save_context_snapshot(const char *filename, context_t *ctx, uint32_t n, const term_t *a, term_t *bad) {
+  intern_tbl_t *intern;
+  int_hmap_t pos;
+  int_hmap_pair_t *p, *r;
+  ivector_t extra, ext;
+  uint32_t i, k, top;
+  int32_t x, tcode, code;
+
+  if (! context_snapshot_supported(ctx)) {
+    return SNAP_UNSUPPORTED_CONTEXT;
+  }
+
+  intern = &ctx->intern;
+  init_int_hmap(&pos, 0);
+  init_ivector(&extra, 0);
+  init_ivector(&ext, 0);
+
+  // extra roots: all the terms in the internalization table
+  top = intern->type.top;
+  for (i=0; i<top; i++) {
+    if (ai32_read(&intern->type, i) != NULL_TYPE) {
+      int_hmap_add(&pos, i, n + extra.size);
+      ivector_push(&extra, pos_term(i));
+    }
+  }
+
+  ivector_push(&ext, ctx->arch);
+  ivector_push(&ext, ctx->mode);
+  ivector_push(&ext, ctx->logic);
+  ivector_push(&ext, ctx->theories);
+  ivector_push(&ext, ctx->options);
+
+  k = ext.size;
+  ivector_push(&ext, 0);
+  smt_core_snapshot(ctx->core, &ext);
+  ext.data[k] = ext.size - k - 1;
+
+  k = ext.size;
+  ivector_push(&ext, 0);
+  if (ctx->bv_solver != NULL && !bv_solver_snapshot(ctx->bv_solver, &ext)) {
+    code = SNAP_UNSUPPORTED_CONTEXT;
+    goto done;
+  }
+  ext.data[k] = ext.size - k - 1;
+
+  ivector_push(&ext, extra.size);
+  for (i=0; i<extra.size; i++) {
+    k = index_of(extra.data[i]);
+    x = ai32_read(&intern->map, k);
+    if (x >= 0) {
+      // parent term
+      p = int_hmap_find(&pos, index_of(x));
+      assert(p != NULL);
+      x = (p->val << 1) | polarity_of(x);
+    }
+    tcode = snapshot_type_code(ctx->types, ai32_read(&intern->type, k));
+    if (tcode < 0) {
+      code = SNAP_UNSUPPORTED_CONTEXT;
+      goto done;
+    }
+    ivector_push(&ext, n + i);
+    ivector_push(&ext, x);
+    ivector_push(&ext, tcode);
+    ivector_push(&ext, au8_read(&intern->rank, k));
+  }
+
+  k = ext.size;
+  ivector_push(&ext, 0);
+  for (r = int_hmap_first_record(&intern->reverse_map);
+       r != NULL;
+       r = int_hmap_next_record(&intern->reverse_map, r)) {
+    p = int_hmap_find(&pos, index_of(r->val));
+    if (p != NULL) {
+      ivector_push(&ext, r->key);
+      ivector_push(&ext, (p->val << 1) | polarity_of(r->val));
+      ext.data[k] ++;
+    }
+  }
+
+  code = save_term_snapshot_ext(filename, ctx->terms, n, a, extra.size, extra.data, &ext, bad);
+
+ done:
+  delete_ivector(&ext);
+  delete_ivector(&extra);
+  delete_int_hmap(&pos);
+
+  return code;
+}
+
+
+
+/*
+ * LOAD
+ */
+
+/*
+ * Check whether ctx is empty: no variables other than true in the
+ * core and nothing other than true_term in the internalization table.
+ */
+static bool context_is_empty(context_t *ctx) {
+  intern_tbl_t *intern;
+  uint32_t i, top;
+
+  if (num_vars(ctx->core) != 1) return false;
+
+  intern = &ctx->intern;
+  top = intern->type.top;
+  for (i=0; i<top; i++) {
+    if (i != index_of(true_term) && ai32_read(&intern->type, i) != NULL_TYPE) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/*
+ * Check whether code is a valid internalization code for a term of
+ * type tcode (encoded as in snapshot_type_code).
+ */
+static bool good_snapshot_code(context_t *ctx, int32_t code, int32_t tcode) {
+  bv_solver_t *solver;
+  thvar_t x;
+
+  if (tcode == 0) {
+    if (code_is_var(code)) {
+      return var_of(code2literal(code)) < num_vars(ctx->core);
+    }
+    return code == bool2code(true) || code == bool2code(false);
+  }
+
+  solver = ctx->bv_solver;
+  if (solver == NULL || ! code_is_var(code)) return false;
+  x = code2thvar(code);
+  return 0 < x && x < solver->vtbl.nvars && bvvar_bitsize(&solver->vtbl, x) == tcode;
+}
+
+
+/*
+ * Restore the internalization table: entries a[0 ... 4n-1]
+ */
+static bool restore_intern_tbl(context_t *ctx, const term_t *roots, uint32_t nroots, const int32_t *a, uint32_t n) {
+  intern_tbl_t *intern;
+  term_t t, p;
+  type_t tau;
+  uint32_t i, k;
+  int32_t map, tcode, rank;
+
+  intern = &ctx->intern;
+  for (i=0; i<n; i++) {
+    if (a[0] < 0 || a[0] >= nroots) return false;
+    t = roots[a[0]];
+    map = a[1];
+    tcode = a[2];
+    rank = a[3];
+    a += 4;
+
+    if (! is_pos_term(t) || tcode < 0 || tcode > YICES_MAX_BVSIZE || rank < 0 || rank > 255) return false;
+    tau = (tcode == 0) ? bool_type(ctx->types) : bv_type(ctx->types, tcode);
+    if (term_type(ctx->terms, t) != tau) return false;
+
+    if (map >= 0) {
+      // parent term: checked below
+      if (term_kind(ctx->terms, t) != UNINTERPRETED_TERM || (map >> 1) >= nroots) return false;
+      if ((map & 1) != 0 && tcode != 0) return false;
+      map = roots[map >> 1] ^ (map & 1);
+    } else if (map != NULL_MAP && ! good_snapshot_code(ctx, map & INT32_MAX, tcode)) {
+      return false;
+    }
+
+    if (intern_tbl_term_present(intern, t)) {
+      // predefined entry (for true_term)
+      if (ai32_read(&intern->map, index_of(t)) != map || ai32_read(&intern->type, index_of(t)) != tau ||
+          au8_read(&intern->rank, index_of(t)) != rank) {
+        return false;
+      }
+    } else {
+      intern_tbl_restore_entry(intern, index_of(t), map, tau, rank);
+    }
+  }
+
+  /*
+   * All parents must be present and the union-find trees must be
+   * acyclic. We check this by following the parent links of all
+   * non-root terms.
+   */
+  a -= 4 * n;
+  for (i=0; i<n; i++) {
+    t = roots[a[4 * i]];
+    for (k=0; k<CTX_SNAPSHOT_MAX_DEPTH; k++) {
+      p = ai32_read(&intern->map, index_of(t));
+      if (p < 0) break;
+      if (! intern_tbl_term_present(intern, p) ||
+          ai32_read(&intern->type, index_of(p)) != ai32_read(&intern->type, index_of(t))) {
+        return false;
+      }
+      t = p;
+    }
+    if (k == CTX_SNAPSHOT_MAX_DEPTH) return false;
+  }
+
+  return true;
+}
+
+
+/*
+ * Restore the reverse map: pairs a[0 ... 2n-1]
+ */
+static bool restore_reverse_map(context_t *ctx, const term_t *roots, uint32_t nroots, const int32_t *a, uint32_t n) {
+  term_t t;
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[0] < 0 || a[1] < 0 || (a[1] >> 1) >= nroots) return false;
+    t = roots[a[1] >> 1] ^ (a[1] & 1);
+    if (! good_term(ctx->terms, t) || ! intern_tbl_term_present(&ctx->intern, t)) return false;
+    intern_tbl_restore_reverse_map(&ctx->intern, a[0], t);
+    a += 2;
+  }
+
+  return true;
+}
+
+
+/*
+ * Read a section size at position k in ext[0 ... size-1]
+ * - each element of the section uses w words
+ * - return false if the section doesn't fit
+ */
+static bool read_section(const int32_t *ext, uint32_t size, uint32_t k, uint32_t w, uint32_t *n) {
+  if (k >= size || ext[k] < 0 || (uint64_t) ext[k] * w > size - k - 1) return false;
+  *n = ext[k];
+  return true;
+}
+
+
+/*
+ * Function called by load_term_snapshot_ext
+ */
+static int32_t restore_context(void *aux, const term_t *roots, uint32_t nroots, const uint32_t *ext, uint32_t size) {
+  context_t *ctx;
+  const int32_t *a;
+  uint32_t k, ncore, nbv, nentries, nrev;
+
+  ctx = aux;
+  a = (const int32_t *) ext;
+
+  if (size < CTX_SNAPSHOT_HEADER) return SNAP_FORMAT_ERROR;
+  if (a[0] != ctx->arch || a[1] != ctx->mode || a[2] != ctx->logic ||
+      a[3] != ctx->theories || a[4] != ctx->options) {
+    return SNAP_UNSUPPORTED_CONTEXT;
+  }
+
+  k = CTX_SNAPSHOT_HEADER;
+  if (! read_section(a, size, k, 1, &ncore)) return SNAP_FORMAT_ERROR;
+  k += ncore + 1;
+  if (! read_section(a, size, k, 1, &nbv)) return SNAP_FORMAT_ERROR;
+  k += nbv + 1;
+  if (! read_section(a, size, k, 4, &nentries)) return SNAP_FORMAT_ERROR;
+  k += 4 * nentries + 1;
+  if (! read_section(a, size, k, 2, &nrev) || k + 2 * nrev + 1 != size) return SNAP_FORMAT_ERROR;
+
+  k = CTX_SNAPSHOT_HEADER;
+  if (! smt_core_restore_snapshot(ctx->core, a + k + 1, ncore)) goto fail;
+  k += ncore + 1;
+  if (ctx->bv_solver != NULL) {
+    if (! bv_solver_restore_snapshot(ctx->bv_solver, a + k + 1, nbv)) goto fail;
+  } else if (nbv > 0) {
+    goto fail;
+  }
+  k += nbv + 1;
+  if (! restore_intern_tbl(ctx, roots, nroots, a + k + 1, nentries)) goto fail;
+  k += 4 * nentries + 1;
+  if (! restore_reverse_map(ctx, roots, nroots, a + k + 1, nrev)) goto fail;
+
+  return 0;
+
+ fail:
+  reset_context(ctx);
+  return SNAP_FORMAT_ERROR;
+}
+
+
+int32_t load_context_snapshot(const char *filename, context_t *ctx, term_manager_t *manager, ivector_t *v) {
+  if (! context_snapshot_supported(ctx) || ! context_is_empty(ctx)) {
+    return SNAP_UNSUPPORTED_CONTEXT;
+  }
+
+  return load_term_snapshot_ext(filename, manager, v, NULL, restore_context, ctx);
+}
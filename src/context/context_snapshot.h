@@ -0,0 +1,91 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CONTEXT SNAPSHOTS
+ *
+ * A context snapshot extends a term snapshot (see io/term_snapshot.h)
+ * with the state of a context after its assertions are internalized:
+ * the internalization table, the clauses and gates of the smt_core,
+ * and the state of the bitvector solver. Restoring a context snapshot
+ * rebuilds the terms then restores this state directly, so the
+ * assertions are neither parsed nor internalized again.
+ *
+ * Restrictions:
+ * - only contexts with architecture CTX_ARCH_NOSOLVERS (pure
+ *   Boolean) or CTX_ARCH_BV are supported. The egraph and the
+ *   arithmetic solvers keep too much derived state (congruence
+ *   table, tableau, difference-logic graphs) to be saved this way.
+ * - the context must be idle and at base level 0 (no push)
+ * - the bitvector solver must not have started bit-blasting, i.e.,
+ *   the context must not have been checked yet.
+ * - learned clauses and heuristic data (activities, polarities) are
+ *   not saved.
+ *
+ * The extension of the term snapshot contains:
+ * - a header: architecture, mode, logic, theories, options
+ * - the core state (cf. smt_core_snapshot)
+ * - the bitvector solver state (cf. bv_solver_snapshot)
+ * - the internalization table and its reverse map
+ * Terms in the internalization table are stored as extra roots of
+ * the term snapshot.
+ */
+
+#ifndef __CONTEXT_SNAPSHOT_H
+#define __CONTEXT_SNAPSHOT_H
+
+#include <stdint.h>
+
+#include "context/context_types.h"
+#include "io/term_snapshot.h"
+
+
+/*
+ * Save ctx and the assertions a[0 ... n-1] to filename
+ * - the assertions must be the formulas asserted in ctx: they are
+ *   restored by load_context_snapshot but not asserted again
+ * - return 0 if the snapshot was written
+ * - return SNAP_UNSUPPORTED_CONTEXT if ctx can't be saved (see
+ *   the restrictions above)
+ * - return SNAP_IO_ERROR or SNAP_UNSUPPORTED_TERM otherwise
+ *   as in save_term_snapshot (*bad is set if the error is
+ *   SNAP_UNSUPPORTED_TERM)
+ */
+extern int32_t save_context_snapshot(const char *filename, context_t *ctx, uint32_t n, const term_t *a, term_t *bad);
+
+
+/*
+ * Restore a snapshot created by save_context_snapshot into ctx
+ * - ctx must be a new context (or a context that was just reset),
+ *   with the same architecture, mode, logic, and options as the
+ *   context that was saved
+ * - the terms are rebuilt using manager
+ * - the assertions are added to v
+ * - return 0 if the snapshot was restored
+ * - return SNAP_IO_ERROR or SNAP_FORMAT_ERROR if the file can't be
+ *   read or is not a valid snapshot
+ * - return SNAP_UNSUPPORTED_CONTEXT if ctx is not empty or if its
+ *   configuration doesn't match the snapshot
+ *
+ * If the snapshot is valid but not consistent with ctx, ctx is
+ * reset and SNAP_FORMAT_ERROR is returned.
+ */
+extern int32_t load_context_snapshot(const char *filename, context_t *ctx, term_manager_t *manager, ivector_t *v);
+
+
+#endif /* __CONTEXT_SNAPSHOT_H */
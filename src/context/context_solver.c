@@ -32,8 +32,10 @@
 #include "context/context.h"
 #include "context/internalization_codes.h"
 #include "model/models.h"
+#include "solvers/bv/bvsolver.h"
 #include "solvers/bv/dimacs_printer.h"
 #include "solvers/cdcl/delegate.h"
+#include "solvers/floyd_warshall/idl_sparse_solver.h"
 #include "solvers/funs/fun_solver.h"
 #include "solvers/simplex/simplex.h"
 
@@ -487,6 +489,17 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
   } else {
     disable_theory_cache(core);
   }
+  if (params->inprocessing) {
+    enable_inprocessing(core);
+  } else {
+    disable_inprocessing(core);
+  }
+
+  if (params->chrono_levels > 0) {
+    enable_chrono_backtracking(core, params->chrono_levels);
+  } else {
+    disable_chrono_backtracking(core);
+  }
 
   /*
    * Set egraph parameters
@@ -530,6 +543,9 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     if (params->adjust_simplex_model) {
       simplex_enable_adjust_model(simplex);
     }
+    if (params->simplex_float_first) {
+      simplex_enable_float_first(simplex);
+    }
     simplex_set_bland_threshold(simplex, params->bland_threshold);
     if (params->integer_check) {
       simplex_enable_periodic_icheck(simplex);
@@ -537,6 +553,17 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     }
   }
 
+  /*
+   * Set sparse IDL solver parameters
+   */
+  if (context_has_isdl_solver(ctx)) {
+    if (params->isdl_prop) {
+      isdl_enable_propagation(ctx->arith_solver);
+    } else {
+      isdl_disable_propagation(ctx->arith_solver);
+    }
+  }
+
   /*
    * Set array solver parameters
    */
@@ -544,6 +571,22 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     fsolver = ctx->fun_solver;
     fun_solver_set_max_update_conflicts(fsolver, params->max_update_conflicts);
     fun_solver_set_max_extensionality(fsolver, params->max_extensionality);
+    if (params->eager_array_lemmas) {
+      fun_solver_enable_eager_lemmas(fsolver);
+    } else {
+      fun_solver_disable_eager_lemmas(fsolver);
+    }
+  }
+
+  /*
+   * Set bitvector solver parameters
+   */
+  if (context_has_bv_solver(ctx)) {
+    if (params->bv_lazy_blast) {
+      bv_solver_enable_lazy_blasting(ctx->bv_solver);
+    } else {
+      bv_solver_disable_lazy_blasting(ctx->bv_solver);
+    }
   }
 }
 
@@ -553,7 +596,7 @@ static smt_status_t _o_call_mcsat_solver(context_t *ctx, const param_t *params)
 }
 
 static smt_status_t call_mcsat_solver(context_t *ctx, const param_t *params) {
-  MT_PROTECT(smt_status_t, __yices_globals.lock, _o_call_mcsat_solver(ctx, params));
+  MT_PROTECT_WRITE(smt_status_t, __yices_globals.lock, _o_call_mcsat_solver(ctx, params));
 }
 
 /*
@@ -646,6 +689,18 @@ smt_status_t check_context_with_model_and_hint(context_t *ctx, const param_t *pa
 }
 
 
+/*
+ * The functions below convert the problem to CNF then use the clauses
+ * outside of smt_core. The bitvector solver must then bit-blast all
+ * operations upfront (lazy bit-blasting relies on final_check).
+ */
+static void context_bitblast_eagerly(context_t *ctx) {
+  if (context_has_bv_solver(ctx)) {
+    bv_solver_disable_lazy_blasting(ctx->bv_solver);
+  }
+}
+
+
 /*
  * Precheck: force generation of clauses and other stuff that's
  * constructed lazily by the solvers. For example, this
@@ -673,6 +728,7 @@ smt_status_t precheck_context(context_t *ctx) {
 
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
+    context_bitblast_eagerly(ctx);
     start_search(core, 0, NULL);
     smt_process(core);
     stat = smt_status(core);
@@ -710,6 +766,7 @@ smt_status_t check_with_delegate(context_t *ctx, const char *sat_solver, uint32_
 
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
+    context_bitblast_eagerly(ctx);
     start_search(core, 0, NULL);
     smt_process(core);
     stat = smt_status(core);
@@ -770,6 +827,7 @@ int32_t bitblast_then_export_to_dimacs(context_t *ctx, const char *filename, smt
   code = 0;
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
+    context_bitblast_eagerly(ctx);
     start_search(core, 0, NULL);
     smt_process(core);
     stat = smt_status(core);
@@ -827,6 +885,7 @@ int32_t process_then_export_to_dimacs(context_t *ctx, const char *filename, smt_
   code = 0;
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
+    context_bitblast_eagerly(ctx);
     start_search(core, 0, NULL);
     smt_process(core);
     stat = smt_status(core);
@@ -46,6 +46,17 @@ static void show_stats(FILE *f, dpll_stats_t *stat) {
   fprintf(f, " simplify db             : %"PRIu32"\n", stat->simplify_calls);
   fprintf(f, " reduce db               : %"PRIu32"\n", stat->reduce_calls);
   fprintf(f, " remove irrelevant       : %"PRIu32"\n", stat->remove_calls);
+  if (stat->inprocess_calls > 0) {
+    fprintf(f, " inprocess db            : %"PRIu32"\n", stat->inprocess_calls);
+    fprintf(f, " subsumed clauses        : %"PRIu64"\n", stat->subsumed_clauses);
+    fprintf(f, " vivified clauses        : %"PRIu64"\n", stat->vivified_clauses);
+    fprintf(f, " vivified literals       : %"PRIu64"\n", stat->vivified_literals);
+  }
+  if (stat->chrono_backtracks > 0) {
+    fprintf(f, " chrono backtracks       : %"PRIu64"\n", stat->chrono_backtracks);
+    fprintf(f, " chrono saved literals   : %"PRIu64"\n", stat->chrono_saved);
+    fprintf(f, " chrono reassigned       : %"PRIu64"\n", stat->chrono_reassigned);
+  }
   fprintf(f, " decisions               : %"PRIu64"\n", stat->decisions);
   fprintf(f, " random decisions        : %"PRIu64"\n", stat->random_decisions);
   fprintf(f, " propagations            : %"PRIu64"\n", stat->propagations);
@@ -79,6 +90,8 @@ static void show_egraph_stats(FILE *f, egraph_stats_t *stat) {
   fprintf(f, " other dyn ack.lemmas    : %"PRIu32"\n", stat->ack_lemmas);
   fprintf(f, " final checks            : %"PRIu32"\n", stat->final_checks);
   fprintf(f, " interface equalities    : %"PRIu32"\n", stat->interface_eqs);
+  fprintf(f, " equality explanations   : %"PRIu32"\n", stat->eq_expls);
+  fprintf(f, " cached explanations     : %"PRIu32"\n", stat->cached_expls);
 }
 
 /*
@@ -91,6 +104,10 @@ static void show_funsolver_stats(FILE *f, fun_solver_stats_t *stat) {
   fprintf(f, " update axiom1           : %"PRIu32"\n", stat->num_update_axiom1);
   fprintf(f, " update axiom2           : %"PRIu32"\n", stat->num_update_axiom2);
   fprintf(f, " extensionality axioms   : %"PRIu32"\n", stat->num_extensionality_axiom);
+  if (stat->num_eager_checks > 0) {
+    fprintf(f, " eager checks            : %"PRIu32"\n", stat->num_eager_checks);
+    fprintf(f, " eager update axioms     : %"PRIu32"\n", stat->num_eager_axiom2);
+  }
 }
 
 /*
@@ -122,6 +139,15 @@ static void show_simplex_stats(FILE *f, simplex_stats_t *stat) {
   fprintf(f, " calls to make_feasible  : %"PRIu32"\n", stat->num_make_feasible);
   fprintf(f, " pivots                  : %"PRIu32"\n", stat->num_pivots);
   fprintf(f, " bland-rule activations  : %"PRIu32"\n", stat->num_blands);
+  if (stat->num_float_checks > 0) {
+    fprintf(f, " float checks            : %"PRIu32"\n", stat->num_float_checks);
+    fprintf(f, " float pivots            : %"PRIu32"\n", stat->num_float_pivots);
+    fprintf(f, " float bases confirmed   : %"PRIu32"\n", stat->num_float_confirmed);
+    fprintf(f, " float failures          : %"PRIu32"\n", stat->num_float_failures);
+  }
+  if (stat->num_matrix_packs > 0) {
+    fprintf(f, " matrix packs            : %"PRIu32"\n", stat->num_matrix_packs);
+  }
   fprintf(f, " simple lemmas           : %"PRIu32"\n", stat->num_binary_lemmas);
   //  fprintf(f, " propagation lemmas      : %"PRIu32"\n", stat->num_prop_lemmas);  (it's always zero)
   fprintf(f, " prop. to core           : %"PRIu32"\n", stat->num_props);
@@ -169,6 +195,10 @@ static void show_bvsolver_stats(FILE *f, bv_solver_t *solver) {
   fprintf(f, " equiv conflicts         : %"PRIu32"\n", solver->stats.equiv_conflicts);
   fprintf(f, " semi-equiv lemmas       : %"PRIu32"\n", solver->stats.half_equiv_lemmas);
   fprintf(f, " interface lemmas        : %"PRIu32"\n", solver->stats.interface_lemmas);
+  if (bv_solver_lazy_ops(solver) > 0) {
+    fprintf(f, " lazy operations         : %"PRIu32"\n", bv_solver_lazy_ops(solver));
+    fprintf(f, " lazy refinements        : %"PRIu32"\n", bv_solver_lazy_refinements(solver));
+  }
 }
 
 
@@ -193,6 +223,8 @@ void yices_print_presearch_stats(FILE *f, context_t *ctx) {
     fprintf(f, "arithmetic solver       : IDL Floyd-Warshall\n");
   } else if (context_has_rdl_solver(ctx)) {
     fprintf(f, "arithmetic solver       : RDL Floyd-Warshall\n");
+  } else if (context_has_isdl_solver(ctx)) {
+    fprintf(f, "arithmetic solver       : IDL Sparse Graph\n");
   }
   fprintf(f, "\n");
   fflush(f);
@@ -125,6 +125,7 @@ typedef enum {
  * - EAGER_LEMMAS
  * - ENABLE_ICHECK
  * - EQPROP
+ * - PACKED_MATRIX
  *
  * Options for testing and debugging
  * - LAX_OPTION: try to keep going when the assertions contain unsupported
@@ -156,6 +157,7 @@ typedef enum {
 #define SPLX_EGRLMAS_OPTION_MASK  0x1000000
 #define SPLX_ICHECK_OPTION_MASK   0x2000000
 #define SPLX_EQPROP_OPTION_MASK   0x4000000
+#define SPLX_PACKED_OPTION_MASK   0x8000000
 
 // FOR TESTING
 #define LAX_OPTION_MASK         0x40000000
@@ -178,6 +180,7 @@ typedef enum {
   CTX_ARCH_SPLX,         // simplex
   CTX_ARCH_IFW,          // integer floyd-warshall
   CTX_ARCH_RFW,          // real floyd-warshall
+  CTX_ARCH_ISDL,         // integer difference logic (sparse graph)
   CTX_ARCH_BV,           // bitvector solver
   CTX_ARCH_EGFUN,        // egraph+array/function theory
   CTX_ARCH_EGSPLX,       // egraph+simplex
@@ -187,7 +190,7 @@ typedef enum {
   CTX_ARCH_EGSPLXBV,     // egraph+simplex+bitvector
   CTX_ARCH_EGFUNSPLXBV,  // all solvers (should be the default)
 
-  CTX_ARCH_AUTO_IDL,     // either simplex or integer floyd-warshall
+  CTX_ARCH_AUTO_IDL,     // simplex, integer floyd-warshall, or sparse IDL
   CTX_ARCH_AUTO_RDL,     // either simplex or real floyd-warshall
 
   CTX_ARCH_MCSAT         // mcsat solver
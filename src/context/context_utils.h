@@ -559,6 +559,10 @@ static inline bool splx_eqprop_enabled(context_t *ctx) {
   return (ctx->options & SPLX_EQPROP_OPTION_MASK) != 0;
 }
 
+static inline bool splx_packed_matrix_enabled(context_t *ctx) {
+  return (ctx->options & SPLX_PACKED_OPTION_MASK) != 0;
+}
+
 
 /*
  * Provisional: set/clear/test dump mode
@@ -142,6 +142,8 @@ void dump_context(FILE *f, context_t *context) {
       dump_idl_solver(f, context->arith_solver);
     } else if (context_has_rdl_solver(context)) {
       dump_rdl_solver(f, context->arith_solver);
+    } else if (context_has_isdl_solver(context)) {
+      // nothing to print for the sparse IDL solver
     } else {
       assert(context_has_simplex_solver(context));
       dump_simplex_solver(f, context->arith_solver);
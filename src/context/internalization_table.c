@@ -852,3 +852,25 @@ void intern_tbl_gc_mark(intern_tbl_t *tbl) {
 }
 
 
+
+
+
+/*
+ * SUPPORT FOR SNAPSHOTS
+ */
+void intern_tbl_restore_entry(intern_tbl_t *tbl, int32_t i, int32_t map, type_t tau, uint8_t rank) {
+  assert(good_term_idx(tbl->terms, i) && ai32_read(&tbl->type, i) == NULL_TYPE && tau != NULL_TYPE);
+
+  ai32_write(&tbl->map, i, map);
+  ai32_write(&tbl->type, i, tau);
+  au8_write(&tbl->rank, i, rank);
+}
+
+void intern_tbl_restore_reverse_map(intern_tbl_t *tbl, int32_t x, term_t t) {
+  int_hmap_pair_t *ip;
+
+  assert(x >= 0 && good_term(tbl->terms, t));
+
+  ip = int_hmap_get(&tbl->reverse_map, x);
+  ip->val = t;
+}
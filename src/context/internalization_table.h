@@ -357,4 +357,23 @@ extern void intern_tbl_merge_classes(intern_tbl_t *tbl, term_t r1, term_t r2);
 extern void intern_tbl_gc_mark(intern_tbl_t *tbl);
 
 
+/*
+ * SUPPORT FOR SNAPSHOTS
+ */
+
+/*
+ * Restore the entry for term index i: set map[i], type[i], and rank[i]
+ * - i must not be present in the table and tau must not be NULL_TYPE
+ * - map is stored as is (either a parent term or an object with the
+ *   sign bit set): the caller must check that it's consistent
+ * - the reverse map is not updated
+ */
+extern void intern_tbl_restore_entry(intern_tbl_t *tbl, int32_t i, int32_t map, type_t tau, uint8_t rank);
+
+/*
+ * Restore the reverse map: set the term mapped to object x to t
+ */
+extern void intern_tbl_restore_reverse_map(intern_tbl_t *tbl, int32_t x, term_t t);
+
+
 #endif /* __INTERNALIZATION_TABLE_H */
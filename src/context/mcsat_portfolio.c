@@ -0,0 +1,178 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PORTFOLIO FOR MCSAT: DIVERSIFIED CONFIGURATIONS
+ */
+
+#include <assert.h>
+
+#include "context/context_portfolio.h"
+#include "context/mcsat_portfolio.h"
+#include "utils/dprng.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Initialize for n workers
+ */
+void init_mcsat_portfolio(mcsat_portfolio_t *p, uint32_t n) {
+  uint32_t i;
+
+  assert(0 < n && n <= PORTFOLIO_MAX_WORKERS);
+
+  p->nworkers = n;
+  p->options = (mcsat_options_t *) safe_malloc(n * sizeof(mcsat_options_t));
+  p->var_order = (ivector_t *) safe_malloc(n * sizeof(ivector_t));
+  for (i=0; i<n; i++) {
+    init_mcsat_options(p->options + i);
+    init_ivector(p->var_order + i, 0);
+  }
+}
+
+
+/*
+ * Delete
+ */
+void delete_mcsat_portfolio(mcsat_portfolio_t *p) {
+  uint32_t i;
+
+  for (i=0; i<p->nworkers; i++) {
+    delete_ivector(p->var_order + i);
+  }
+  safe_free(p->options);
+  safe_free(p->var_order);
+  p->options = NULL;
+  p->var_order = NULL;
+}
+
+
+
+/*
+ * DIVERSIFICATION
+ */
+
+/*
+ * Variants of the fixed variable order
+ * - KEEP: same order as worker 0
+ * - REVERSE: reversed order
+ * - NONE: no fixed order (use the activity heuristic only)
+ */
+typedef enum {
+  ORDER_KEEP,
+  ORDER_REVERSE,
+  ORDER_NONE,
+} order_flavor_t;
+
+
+/*
+ * Each worker other than worker 0 is assigned a flavor:
+ * - whether to flip the nra_mgcd and nra_nlsat options
+ * - frequency of random decisions (negative means keep the base value)
+ * - variant of the variable order
+ * All workers also get different random seeds.
+ */
+typedef struct mcsat_flavor_s {
+  bool flip_mgcd;
+  bool flip_nlsat;
+  double rand_dec_freq;
+  order_flavor_t order;
+} mcsat_flavor_t;
+
+#define NUM_MCSAT_FLAVORS 8
+
+static const mcsat_flavor_t mcsat_flavor[NUM_MCSAT_FLAVORS] = {
+  { true,  false, -1.0, ORDER_KEEP },
+  { false, true,  -1.0, ORDER_NONE },
+  { true,  true,  0.05, ORDER_REVERSE },
+  { false, false, 0.10, ORDER_KEEP },
+  { true,  false, 0.00, ORDER_REVERSE },
+  { false, true,  0.05, ORDER_KEEP },
+  { true,  true,  -1.0, ORDER_NONE },
+  { false, false, 0.20, ORDER_REVERSE },
+};
+
+
+/*
+ * Copy order into v, modified as specified by flavor
+ */
+static void copy_var_order(ivector_t *v, const ivector_t *order, order_flavor_t flavor) {
+  uint32_t i, n;
+
+  ivector_reset(v);
+  switch (flavor) {
+  case ORDER_KEEP:
+    ivector_copy(v, order->data, order->size);
+    break;
+
+  case ORDER_REVERSE:
+    n = order->size;
+    for (i=0; i<n; i++) {
+      ivector_push(v, order->data[n - 1 - i]);
+    }
+    break;
+
+  case ORDER_NONE:
+    break;
+  }
+}
+
+
+/*
+ * Assign options to all workers
+ */
+void mcsat_portfolio_diversify(mcsat_portfolio_t *p, const context_t *ctx) {
+  const mcsat_flavor_t *f;
+  mcsat_options_t *opts;
+  uint32_t i;
+
+  p->options[0] = ctx->mcsat_options;
+  copy_var_order(p->var_order, &ctx->mcsat_var_order, ORDER_KEEP);
+
+  for (i=1; i<p->nworkers; i++) {
+    f = mcsat_flavor + ((i - 1) % NUM_MCSAT_FLAVORS);
+    opts = p->options + i;
+    *opts = ctx->mcsat_options;
+    opts->rand_dec_seed += 7919.0 * i;
+    if (opts->rand_dec_seed == 0.0) {
+      opts->rand_dec_seed = DPRNG_DEFAULT_SEED;
+    }
+    if (f->flip_mgcd) {
+      opts->nra_mgcd = !opts->nra_mgcd;
+    }
+    if (f->flip_nlsat) {
+      opts->nra_nlsat = !opts->nra_nlsat;
+    }
+    if (f->rand_dec_freq >= 0.0) {
+      opts->rand_dec_freq = f->rand_dec_freq;
+    }
+    copy_var_order(p->var_order + i, &ctx->mcsat_var_order, f->order);
+  }
+}
+
+
+/*
+ * Give worker i's options and variable order to ctx
+ * - the MCSAT plugins read the options from ctx when they need them
+ *   and the heuristic parameters are reset at the start of each search
+ */
+void mcsat_portfolio_set_worker(const mcsat_portfolio_t *p, context_t *ctx, uint32_t i) {
+  assert(i < p->nworkers);
+  ctx->mcsat_options = p->options[i];
+  ivector_copy(&ctx->mcsat_var_order, p->var_order[i].data, p->var_order[i].size);
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PORTFOLIO FOR MCSAT
+ *
+ * MCSAT is very sensitive to the variable order and to the NRA options
+ * (nra_mgcd, nra_nlsat, nra_bound). An MCSAT portfolio assigns several
+ * configurations to the same context, so that they can be raced.
+ *
+ * MCSAT creates terms during the search (in explanations and lemmas)
+ * so the workers can't run as threads that share the global term
+ * table. This module only builds the configurations. The race itself
+ * is done by yices_smt2, which runs each worker in a child process
+ * (cf. frontend/common/process_race.h): the library never forks.
+ */
+
+#ifndef __MCSAT_PORTFOLIO_H
+#define __MCSAT_PORTFOLIO_H
+
+#include <stdint.h>
+
+#include "context/context_types.h"
+#include "mcsat/options.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Portfolio descriptor:
+ * - nworkers = number of workers
+ * - options[i] = MCSAT options for worker i
+ * - var_order[i] = fixed variable order for worker i (may be empty)
+ */
+typedef struct mcsat_portfolio_s {
+  uint32_t nworkers;
+  mcsat_options_t *options;
+  ivector_t *var_order;
+} mcsat_portfolio_t;
+
+
+/*
+ * Initialize a portfolio for n workers
+ * - n must be positive and no more than PORTFOLIO_MAX_WORKERS
+ * - all workers get the default options and no variable order
+ */
+extern void init_mcsat_portfolio(mcsat_portfolio_t *p, uint32_t n);
+
+/*
+ * Delete: free memory
+ */
+extern void delete_mcsat_portfolio(mcsat_portfolio_t *p);
+
+/*
+ * Assign diversified options to all workers, based on ctx's options
+ * and variable order
+ * - worker 0 gets the options of ctx
+ * - the others get different random seeds, flip the NRA options,
+ *   and use variants of the variable order (if any)
+ */
+extern void mcsat_portfolio_diversify(mcsat_portfolio_t *p, const context_t *ctx);
+
+/*
+ * Give worker i's options and variable order to ctx
+ * - ctx must use MCSAT and i must be less than p->nworkers
+ * - the next check of ctx uses this configuration
+ */
+extern void mcsat_portfolio_set_worker(const mcsat_portfolio_t *p, context_t *ctx, uint32_t i);
+
+
+#endif /* __MCSAT_PORTFOLIO_H */
@@ -174,6 +174,7 @@ void ef_solve(ef_client_t *efc, uint32_t n, const term_t *assertions, param_t *p
       ef_solver_check(efc->efsolver, parameters, efc->ef_parameters.gen_mode,
 			efc->ef_parameters.max_samples, efc->ef_parameters.max_iters,
 			efc->ef_parameters.max_numlearnt_per_round,
+			efc->ef_parameters.cex_workers,
 			efc->ef_parameters.ematching);
       efc->efdone = true;
     }
@@ -0,0 +1,383 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PARALLEL COUNTEREXAMPLE SEARCH: CHECK THE UNIVERSAL CONSTRAINTS CONCURRENTLY
+ */
+
+#include <assert.h>
+
+#include "context/context.h"
+#include "exists_forall/ef_parallel.h"
+#include "utils/memalloc.h"
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <errno.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#include "mt/threads.h"
+#endif
+
+
+/*
+ * Initialize for n contexts and k threads
+ */
+void init_ef_cex_pool(ef_cex_pool_t *pool, uint32_t k, uint32_t n) {
+  uint32_t i;
+
+  assert(0 < k && k <= EF_MAX_CEX_WORKERS);
+  assert(n <= UINT32_MAX/sizeof(context_t *));
+
+  pool->nworkers = k;
+  pool->nctx = n;
+  pool->ctx = (context_t **) safe_malloc(n * sizeof(context_t *));
+  pool->status = (smt_status_t *) safe_malloc(n * sizeof(smt_status_t));
+  for (i=0; i<n; i++) {
+    pool->ctx[i] = NULL;
+    pool->status[i] = STATUS_IDLE;
+  }
+  pool->winner = -1;
+  pool->error = -1;
+  pool->interrupted = false;
+  pool->checked = 0;
+  pool->cancelled = 0;
+}
+
+
+/*
+ * Delete the pool and the contexts
+ */
+void delete_ef_cex_pool(ef_cex_pool_t *pool) {
+  uint32_t i;
+
+  for (i=0; i<pool->nctx; i++) {
+    if (pool->ctx[i] != NULL) {
+      delete_context(pool->ctx[i]);
+      safe_free(pool->ctx[i]);
+    }
+  }
+  safe_free(pool->ctx);
+  safe_free(pool->status);
+  pool->ctx = NULL;
+  pool->status = NULL;
+}
+
+
+/*
+ * Interrupt all checks in progress
+ */
+void ef_cex_pool_stop(ef_cex_pool_t *pool) {
+  context_t *ctx;
+  uint32_t i;
+
+  for (i=0; i<pool->nctx; i++) {
+    ctx = pool->ctx[i];
+    if (ctx != NULL && context_status(ctx) == STATUS_SEARCHING) {
+      context_stop_search(ctx);
+    }
+  }
+}
+
+
+/*
+ * Record the status of context i
+ * - return true if all the other checks must be stopped
+ */
+static bool ef_cex_pool_record_status(ef_cex_pool_t *pool, uint32_t i, smt_status_t stat) {
+  pool->status[i] = stat;
+  pool->checked ++;
+  switch (stat) {
+  case STATUS_UNSAT:
+    return false;
+
+  case STATUS_SAT:
+  case STATUS_UNKNOWN:
+    if (pool->winner < 0 && pool->error < 0) {
+      pool->winner = i;
+      return true;
+    }
+    return false;
+
+  case YICES_STATUS_INTERRUPTED:
+    if (pool->winner < 0 && pool->error < 0) {
+      pool->interrupted = true;
+      return true;
+    }
+    pool->cancelled ++;
+    return false;
+
+  default:
+    if (pool->winner < 0 && pool->error < 0) {
+      pool->error = i;
+      return true;
+    }
+    return false;
+  }
+}
+
+
+/*
+ * Final status
+ */
+static smt_status_t ef_cex_pool_status(ef_cex_pool_t *pool) {
+  if (pool->winner >= 0) {
+    return pool->status[pool->winner];
+  }
+  if (pool->error >= 0) {
+    return pool->status[pool->error];
+  }
+  return pool->interrupted ? YICES_STATUS_INTERRUPTED : STATUS_UNSAT;
+}
+
+
+/*
+ * Prepare for a check: reset the results
+ * - return the number of contexts to check
+ */
+static uint32_t ef_cex_pool_prepare(ef_cex_pool_t *pool) {
+  uint32_t i, n;
+
+  pool->winner = -1;
+  pool->error = -1;
+  pool->interrupted = false;
+  pool->checked = 0;
+  pool->cancelled = 0;
+
+  n = 0;
+  for (i=0; i<pool->nctx; i++) {
+    if (pool->status[i] == STATUS_IDLE) {
+      assert(pool->ctx[i] != NULL && context_status(pool->ctx[i]) == STATUS_IDLE);
+      n ++;
+    }
+  }
+  return n;
+}
+
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+/*
+ * MULTI-THREADED VERSION
+ */
+
+/*
+ * Shared state:
+ * - lock protects the status array, winner, error, interrupted,
+ *   the counters, next, running, and stop
+ * - done is signaled every time a worker finishes
+ * - start = first context to check
+ * - next = number of contexts taken by the workers so far
+ * - running = number of workers still running
+ * - stop = true once the workers must be interrupted
+ */
+typedef struct ef_cex_race_s {
+  ef_cex_pool_t *pool;
+  const param_t *params;
+  pthread_mutex_t lock;
+  pthread_cond_t done;
+  uint32_t start;
+  uint32_t next;
+  uint32_t running;
+  bool stop;
+} ef_cex_race_t;
+
+
+/*
+ * Worker: take the next context to check until there's none left
+ * or the workers must stop.
+ * - status[i] is set to STATUS_SEARCHING while context i is checked
+ */
+static void *ef_cex_worker(void *arg) {
+  ef_cex_race_t *race;
+  ef_cex_pool_t *pool;
+  smt_status_t stat;
+  uint32_t i, n;
+
+  race = arg;
+  pool = race->pool;
+  n = pool->nctx;
+
+  check_thread_api(pthread_mutex_lock(&race->lock), "ef_cex_worker: pthread_mutex_lock");
+  while (!race->stop && race->next < n) {
+    i = race->start + race->next;
+    if (i >= n) i -= n;
+    race->next ++;
+    if (pool->status[i] != STATUS_IDLE) continue;
+
+    pool->status[i] = STATUS_SEARCHING;
+    check_thread_api(pthread_mutex_unlock(&race->lock), "ef_cex_worker: pthread_mutex_unlock");
+
+    stat = check_context(pool->ctx[i], race->params);
+
+    check_thread_api(pthread_mutex_lock(&race->lock), "ef_cex_worker: pthread_mutex_lock");
+    if (ef_cex_pool_record_status(pool, i, stat)) {
+      race->stop = true;
+      check_thread_api(pthread_cond_signal(&race->done), "ef_cex_worker: pthread_cond_signal");
+    }
+  }
+  assert(race->running > 0);
+  race->running --;
+  check_thread_api(pthread_cond_signal(&race->done), "ef_cex_worker: pthread_cond_signal");
+  check_thread_api(pthread_mutex_unlock(&race->lock), "ef_cex_worker: pthread_mutex_unlock");
+
+  return NULL;
+}
+
+
+/*
+ * Interrupt the contexts that are being checked.
+ * - a worker may not have entered the search yet when this is called.
+ *   context_stop_search has no effect then so the caller must
+ *   repeat this until all workers are done.
+ */
+static void ef_cex_stop_workers(ef_cex_race_t *race) {
+  ef_cex_pool_t *pool;
+  uint32_t i;
+
+  pool = race->pool;
+  for (i=0; i<pool->nctx; i++) {
+    if (pool->status[i] == STATUS_SEARCHING && context_status(pool->ctx[i]) == STATUS_SEARCHING) {
+      context_stop_search(pool->ctx[i]);
+    }
+  }
+}
+
+
+/*
+ * Add 1ms to ts
+ */
+static void set_deadline(struct timespec *ts) {
+  struct timeval tv;
+
+  if (gettimeofday(&tv, NULL) == -1) {
+    perror_fatal("ef_cex_pool_check: gettimeofday");
+  }
+  ts->tv_sec = tv.tv_sec;
+  ts->tv_nsec = 1000 * tv.tv_usec + 1000000;
+  if (ts->tv_nsec >= 1000000000) {
+    ts->tv_sec ++;
+    ts->tv_nsec -= 1000000000;
+  }
+}
+
+
+smt_status_t ef_cex_pool_check(ef_cex_pool_t *pool, const param_t *params, uint32_t start) {
+  ef_cex_race_t race;
+  pthread_t *tid;
+  pthread_attr_t attr;
+  struct rlimit rlp;
+  struct timespec deadline;
+  uint32_t i, k, n;
+  int ret;
+
+  assert(start < pool->nctx || pool->nctx == 0);
+
+  n = ef_cex_pool_prepare(pool);
+  if (n == 0) {
+    return STATUS_UNSAT;
+  }
+
+  k = pool->nworkers;
+  if (k > n) k = n;
+
+  race.pool = pool;
+  race.params = params;
+  race.start = start;
+  race.next = 0;
+  race.running = k;
+  race.stop = false;
+  check_thread_api(pthread_mutex_init(&race.lock, NULL), "ef_cex_pool_check: pthread_mutex_init");
+  check_thread_api(pthread_cond_init(&race.done, NULL), "ef_cex_pool_check: pthread_cond_init");
+
+  tid = (pthread_t *) safe_malloc(k * sizeof(pthread_t));
+
+  /* The search can recurse deeply: use the main thread's stack size. */
+  check_thread_api(pthread_attr_init(&attr), "ef_cex_pool_check: pthread_attr_init");
+  if (getrlimit(RLIMIT_STACK, &rlp) == 0 && rlp.rlim_cur != RLIM_INFINITY) {
+    check_thread_api(pthread_attr_setstacksize(&attr, rlp.rlim_cur), "ef_cex_pool_check: pthread_attr_setstacksize");
+  }
+  for (i=0; i<k; i++) {
+    check_thread_api(pthread_create(tid + i, &attr, ef_cex_worker, &race), "ef_cex_pool_check: pthread_create");
+  }
+  check_thread_api(pthread_attr_destroy(&attr), "ef_cex_pool_check: pthread_attr_destroy");
+
+  /*
+   * Wait for all workers. Once stop is set, keep interrupting the
+   * checks that are still running every millisecond.
+   */
+  check_thread_api(pthread_mutex_lock(&race.lock), "ef_cex_pool_check: pthread_mutex_lock");
+  while (race.running > 0) {
+    if (race.stop) {
+      ef_cex_stop_workers(&race);
+      set_deadline(&deadline);
+      ret = pthread_cond_timedwait(&race.done, &race.lock, &deadline);
+      if (ret != 0 && ret != ETIMEDOUT) {
+	perror_fatal_code("ef_cex_pool_check: pthread_cond_timedwait", ret);
+      }
+    } else {
+      check_thread_api(pthread_cond_wait(&race.done, &race.lock), "ef_cex_pool_check: pthread_cond_wait");
+    }
+  }
+  check_thread_api(pthread_mutex_unlock(&race.lock), "ef_cex_pool_check: pthread_mutex_unlock");
+
+  for (i=0; i<k; i++) {
+    check_thread_api(pthread_join(tid[i], NULL), "ef_cex_pool_check: pthread_join");
+  }
+
+  safe_free(tid);
+  check_thread_api(pthread_cond_destroy(&race.done), "ef_cex_pool_check: pthread_cond_destroy");
+  check_thread_api(pthread_mutex_destroy(&race.lock), "ef_cex_pool_check: pthread_mutex_destroy");
+
+  // the contexts never checked were skipped
+  pool->cancelled += n - pool->checked;
+
+  return ef_cex_pool_status(pool);
+}
+
+
+#else
+
+/*
+ * SINGLE-THREADED VERSION: check the contexts in order
+ */
+smt_status_t ef_cex_pool_check(ef_cex_pool_t *pool, const param_t *params, uint32_t start) {
+  uint32_t i, j, n;
+
+  assert(start < pool->nctx || pool->nctx == 0);
+
+  n = ef_cex_pool_prepare(pool);
+  if (n > 0) {
+    i = start;
+    for (j=0; j<pool->nctx; j++) {
+      if (pool->status[i] == STATUS_IDLE &&
+	  ef_cex_pool_record_status(pool, i, check_context(pool->ctx[i], params))) {
+	break;
+      }
+      i ++;
+      if (i == pool->nctx) i = 0;
+    }
+    pool->cancelled += n - pool->checked;
+  }
+
+  return ef_cex_pool_status(pool);
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PARALLEL COUNTEREXAMPLE SEARCH FOR THE EXISTS/FORALL SOLVER
+ *
+ * A candidate exists model X0 is tested against each universal
+ * constraint by checking whether (B_i(Y) and not C_i(X0, Y)) is
+ * satisfiable. These checks are independent. A counterexample pool
+ * keeps one forall context per constraint and runs check_context on
+ * these contexts in a pool of threads. The first check that finds a
+ * counterexample (i.e., returns SAT or UNKNOWN) wins: the checks still
+ * running are interrupted and the ones not started yet are skipped.
+ *
+ * The contexts are kept from one candidate to the next, except the
+ * ones that were interrupted: these are in an unusable state and must
+ * be deleted by the caller.
+ *
+ * Only check_context runs in the worker threads. The caller must
+ * build and assert the formulas before the check, and build models
+ * and lemmas after the check, since all these operations may create
+ * terms.
+ *
+ * Multiple threads are used only if Yices is compiled in THREAD_SAFE
+ * mode on a POSIX system. Otherwise, the contexts are checked one
+ * after the other, with the same result.
+ */
+
+#ifndef __EF_PARALLEL_H
+#define __EF_PARALLEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "context/context_types.h"
+#include "api/search_parameters.h"
+
+
+/*
+ * Maximal number of threads
+ */
+#define EF_MAX_CEX_WORKERS 64
+
+
+/*
+ * Pool descriptor:
+ * - nworkers = number of threads
+ * - nctx = number of contexts (one per universal constraint)
+ * - ctx[i] = context for constraint i (NULL if not created yet)
+ * - status[i] = status of context i:
+ *   the caller must set status[i] to STATUS_IDLE for the contexts
+ *   to check. Any other status means that context i is skipped.
+ *   After the check, status[i] is the result of check_context,
+ *   or STATUS_IDLE if context i was not checked.
+ * - winner = index of the first context that returned SAT or UNKNOWN
+ *   or -1 if there's none
+ * - error = index of the first context that returned an unexpected
+ *   status, or -1
+ * - interrupted = true if a check was interrupted from outside before
+ *   a winner was found
+ * - checked = number of contexts checked in the last call
+ * - cancelled = number of contexts that were interrupted or skipped
+ *   in the last call because a winner was found
+ */
+typedef struct ef_cex_pool_s {
+  uint32_t nworkers;
+  uint32_t nctx;
+  context_t **ctx;
+  smt_status_t *status;
+  int32_t winner;
+  int32_t error;
+  bool interrupted;
+  uint32_t checked;
+  uint32_t cancelled;
+} ef_cex_pool_t;
+
+
+/*
+ * Initialize pool for n contexts and k threads
+ * - k must be positive and no more than EF_MAX_CEX_WORKERS
+ * - all contexts are NULL
+ */
+extern void init_ef_cex_pool(ef_cex_pool_t *pool, uint32_t k, uint32_t n);
+
+
+/*
+ * Delete the pool and all its contexts
+ */
+extern void delete_ef_cex_pool(ef_cex_pool_t *pool);
+
+
+/*
+ * Check all contexts i such that pool->status[i] is STATUS_IDLE
+ * - the contexts are scanned in the order start, start+1, ..., n-1, 0, ..., start-1
+ *   (a thread takes the next context in this order when it's free)
+ * - params = search parameters for all the checks
+ *
+ * Result:
+ * - STATUS_SAT or STATUS_UNKNOWN if there's a winner
+ * - the unexpected status of context pool->error if there's no winner
+ *   and some check failed
+ * - YICES_STATUS_INTERRUPTED if the checks were interrupted
+ * - STATUS_UNSAT if all the checks returned UNSAT
+ *
+ * The contexts interrupted by the pool have status YICES_STATUS_INTERRUPTED
+ * and must be deleted or reset by the caller.
+ */
+extern smt_status_t ef_cex_pool_check(ef_cex_pool_t *pool, const param_t *params, uint32_t start);
+
+
+/*
+ * Interrupt all the checks in progress
+ * - this can be called from a signal handler or another thread
+ */
+extern void ef_cex_pool_stop(ef_cex_pool_t *pool);
+
+
+#endif /* __EF_PARALLEL_H */
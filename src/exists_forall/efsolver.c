@@ -204,12 +204,14 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
   solver->max_samples = 0;
   solver->max_iters = 0;
   solver->max_numlearnt_per_round = 0;
+  solver->cex_workers = 1;
   solver->ematching = false;
 
   solver->num_models = 0;
   solver->iters = 0;
   solver->numiters = 0;
   solver->numlearnt = 0;
+  solver->numcancelled = 0;
   solver->scan_idx = 0;
 
   solver->exists_context = NULL;
@@ -225,7 +227,7 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
   n = ef_prob_num_uvars(prob);
   assert(n <= UINT32_MAX/sizeof(term_t));
   solver->uvalue = (term_t *) safe_malloc(n * sizeof(term_t));
-
+  solver->cex_pool = NULL;
 
   solver->full_model = NULL;
   init_ivector(&solver->implicant, 20);
@@ -265,6 +267,11 @@ void delete_ef_solver(ef_solver_t *solver) {
   delete_ivector(&solver->evalue);
   safe_free(solver->uvalue);
   solver->uvalue = NULL;
+  if (solver->cex_pool != NULL) {
+    delete_ef_cex_pool(solver->cex_pool);
+    safe_free(solver->cex_pool);
+    solver->cex_pool = NULL;
+  }
 
   if (solver->full_model != NULL) {
     yices_free_model(solver->full_model);
@@ -295,6 +302,7 @@ void ef_solver_stop_search(ef_solver_t *solver) {
   if (solver->status == EF_STATUS_SEARCHING) {
     if (exists_ctx != NULL) context_stop_search(exists_ctx);
     if (forall_ctx != NULL) context_stop_search(forall_ctx);
+    if (solver->cex_pool != NULL) ef_cex_pool_stop(solver->cex_pool);
     solver->status = EF_STATUS_INTERRUPTED;
   }
 }
@@ -1178,27 +1186,22 @@ static void ef_solver_learn(ef_solver_t *solver, term_t cex_cnstr, uint32_t i) {
 
 
 /*
- * Test the current exists model using universal constraint i
- * - i must be a valid index (i.e., 0 <= i < solver->prob->num_cnstr)
- * - this checks the assertion B_i and not C_i after replacing existential
- *   variables by their values (stored in evalue)
+ * Search for counterexamples to constraint i in forall_ctx
+ * - forall_ctx must contain the assertions B_i and not C_i, where
+ *   the existential variables are replaced by their values in C_i
+ * - code = result of asserting these formulas
+ * - the universal variables of uninterpreted types are restricted to
+ *   values of increasing generations, until a counterexample is found
+ *   or all values have been tried
  * - learn multiple lemmas (upto max_numlearnt)
- * - return code:
- *   if STATUS_SAT (or STATUS_UNKNOWN): a model of (B_i and not C_i)
- *   is found and stored in uvalue_aux
- *   if STATUS_UNSAT: no model found (current exists model is good as
- *   far as constraint i is concerned)
- *   anything else: an error or interruption
+ * - the return code is as in ef_solver_test_exists_model below
  *
- * - if we get an error or interruption, solver->status is updated
- *   otherwise, it is kept as is (should be EF_STATUS_SEARCHING)
+ * The backtrack points pushed in forall_ctx are not all popped:
+ * the caller must reset or delete forall_ctx.
  */
-static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t domain_cnstr, uint32_t i) {
-  context_t *forall_ctx;
+static smt_status_t ef_solver_search_counterexamples(ef_solver_t *solver, context_t *forall_ctx, uint32_t i, int32_t code) {
   ef_cnstr_t *cnstr;
-  term_t g;
   int32_t n, generation;
-  int32_t code;
   smt_status_t status;
   term_t uvar_cnstr, uvar_cnstr_old;
   term_t cex_cnstr;
@@ -1208,16 +1211,6 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t doma
   cnstr = solver->prob->cnstr + i;
   status = STATUS_ERROR;
 
-  n = ef_prob_num_evars(solver->prob);
-  g = ef_substitution(solver->prob, solver->prob->all_evars, solver->evalue.data, n, cnstr->guarantee);
-  if (g < 0) {
-    // error in substitution
-    solver->status = EF_STATUS_SUBST_ERROR;
-    solver->error_code = g;
-    status = STATUS_ERROR;
-    return status;
-  }
-
   /*
    * make uvalue_aux large enough
    */
@@ -1225,9 +1218,6 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t doma
   resize_ivector(&solver->uvalue_aux, n);
   solver->uvalue_aux.size = n;
 
-  forall_ctx = get_forall_context(solver);
-  code = forall_context_assert(solver, domain_cnstr, cnstr->assumption, g); // assert B_i(Y_i) and not g(Y_i)
-
   uvar_cnstr_old = yices_true();
   generation = 0;
   bool done = false;
@@ -1319,12 +1309,13 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t doma
       break;
     }
 
-    // if reached highest generation, then break
-    if (done)
+    // if reached highest generation or the check failed, then break
+    if (done || status != STATUS_UNSAT)
       break;
 
     uvar_cnstr_old = uvar_cnstr;
     generation++;
+    context_clear_unsat(forall_ctx);
     context_pop(forall_ctx);
     code = CTX_NO_ERROR;
   }
@@ -1363,6 +1354,49 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t doma
     status = STATUS_ERROR;
   }
 
+  return status;
+}
+
+
+/*
+ * Test the current exists model using universal constraint i
+ * - i must be a valid index (i.e., 0 <= i < solver->prob->num_cnstr)
+ * - this checks the assertion B_i and not C_i after replacing existential
+ *   variables by their values (stored in evalue)
+ * - learn multiple lemmas (upto max_numlearnt)
+ * - return code:
+ *   if STATUS_SAT (or STATUS_UNKNOWN): a model of (B_i and not C_i)
+ *   is found and stored in uvalue_aux
+ *   if STATUS_UNSAT: no model found (current exists model is good as
+ *   far as constraint i is concerned)
+ *   anything else: an error or interruption
+ *
+ * - if we get an error or interruption, solver->status is updated
+ *   otherwise, it is kept as is (should be EF_STATUS_SEARCHING)
+ */
+static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t domain_cnstr, uint32_t i) {
+  context_t *forall_ctx;
+  ef_cnstr_t *cnstr;
+  term_t g;
+  int32_t n;
+  int32_t code;
+  smt_status_t status;
+
+  assert(i < ef_prob_num_constraints(solver->prob));
+  cnstr = solver->prob->cnstr + i;
+
+  n = ef_prob_num_evars(solver->prob);
+  g = ef_substitution(solver->prob, solver->prob->all_evars, solver->evalue.data, n, cnstr->guarantee);
+  if (g < 0) {
+    // error in substitution
+    solver->status = EF_STATUS_SUBST_ERROR;
+    solver->error_code = g;
+    return STATUS_ERROR;
+  }
+
+  forall_ctx = get_forall_context(solver);
+  code = forall_context_assert(solver, domain_cnstr, cnstr->assumption, g); // assert B_i(Y_i) and not g(Y_i)
+  status = ef_solver_search_counterexamples(solver, forall_ctx, i, code);
   clear_forall_context(solver, true);
 
   return status;
@@ -1399,6 +1433,220 @@ static void trace_candidate_check(ef_solver_t *solver, uint32_t i, smt_status_t
   }
 }
 
+/*
+ * PARALLEL COUNTEREXAMPLE SEARCH
+ */
+
+/*
+ * Get the counterexample pool: allocate it if needed
+ */
+static ef_cex_pool_t *get_cex_pool(ef_solver_t *solver) {
+  ef_cex_pool_t *pool;
+  uint32_t k;
+
+  pool = solver->cex_pool;
+  if (pool == NULL) {
+    k = solver->cex_workers;
+    if (k > EF_MAX_CEX_WORKERS) {
+      k = EF_MAX_CEX_WORKERS;
+    }
+    pool = (ef_cex_pool_t *) safe_malloc(sizeof(ef_cex_pool_t));
+    init_ef_cex_pool(pool, k, ef_prob_num_constraints(solver->prob));
+    solver->cex_pool = pool;
+  }
+  return pool;
+}
+
+
+/*
+ * Prepare the context for constraint i to test the current exists model
+ * - if the context does not exist, it's created and B_i is asserted
+ *   at the base level
+ * - then we assert domain_cnstr and not C_i (where the existential
+ *   variables are replaced by their values) after a push, and the
+ *   scalar domain constraint on the universal variables after a
+ *   second push. All generations are included in this constraint
+ *   so the context is satisfiable iff constraint i has a counterexample
+ *   (cf. ef_solver_search_counterexamples).
+ * - pool->status[i] is set to STATUS_IDLE if the context must be
+ *   checked or to STATUS_UNSAT if the assertions are trivially unsat
+ *
+ * Return false if there's an error (and set solver->status).
+ */
+static bool prepare_cex_context(ef_solver_t *solver, uint32_t i, term_t domain_cnstr) {
+  ef_cex_pool_t *pool;
+  ef_cnstr_t *cnstr;
+  context_t *ctx;
+  term_t assertions[2];
+  term_t g, uvar_cnstr;
+  int32_t n, code;
+  bool done;
+
+  pool = solver->cex_pool;
+  cnstr = solver->prob->cnstr + i;
+  pool->status[i] = STATUS_UNSAT;
+
+  ctx = pool->ctx[i];
+  if (ctx == NULL) {
+    ctx = (context_t *) safe_malloc(sizeof(context_t));
+    init_context(ctx, solver->prob->terms, solver->logic, CTX_MODE_PUSHPOP, solver->arch, false);
+    pool->ctx[i] = ctx;
+    code = assert_formula(ctx, cnstr->assumption);
+    if (code < 0 && code != TRIVIALLY_UNSAT) goto assert_error;
+  }
+
+  if (context_status(ctx) == STATUS_UNSAT) {
+    // B_i is false: no counterexample ever
+    assert(context_base_level(ctx) == 0);
+    return true;
+  }
+
+  n = ef_prob_num_evars(solver->prob);
+  g = ef_substitution(solver->prob, solver->prob->all_evars, solver->evalue.data, n, cnstr->guarantee);
+  if (g < 0) {
+    solver->status = EF_STATUS_SUBST_ERROR;
+    solver->error_code = g;
+    return false;
+  }
+
+  assertions[0] = domain_cnstr;
+  assertions[1] = opposite_term(g);
+  context_push(ctx);
+  code = assert_formulas(ctx, 2, assertions);
+  if (code == CTX_NO_ERROR) {
+    n = ef_constraint_num_uvars(cnstr);
+    uvar_cnstr = constraint_scalar(&solver->value_table, n, cnstr->uvars, -1, &done);
+    assert(done);
+    context_push(ctx);
+    code = assert_formula(ctx, uvar_cnstr);
+  }
+
+  if (code == CTX_NO_ERROR) {
+    pool->status[i] = STATUS_IDLE;
+  } else if (code != TRIVIALLY_UNSAT) {
+    goto assert_error;
+  }
+  return true;
+
+ assert_error:
+  solver->status = EF_STATUS_ASSERT_ERROR;
+  solver->error_code = code;
+  return false;
+}
+
+
+/*
+ * Restore the context for constraint i to its base level
+ * - if the context was interrupted or is in a bad state, it's deleted
+ *   (it will be rebuilt for the next candidate)
+ */
+static void reset_cex_context(ef_cex_pool_t *pool, uint32_t i) {
+  context_t *ctx;
+
+  ctx = pool->ctx[i];
+  if (ctx != NULL) {
+    while (context_base_level(ctx) > 0) {
+      switch (context_status(ctx)) {
+      case STATUS_IDLE:
+	break;
+
+      case STATUS_SAT:
+      case STATUS_UNKNOWN:
+	context_clear(ctx);
+	break;
+
+      case STATUS_UNSAT:
+	context_clear_unsat(ctx);
+	break;
+
+      default:
+	delete_context(ctx);
+	safe_free(ctx);
+	pool->ctx[i] = NULL;
+	return;
+      }
+      context_pop(ctx);
+    }
+  }
+}
+
+
+/*
+ * Check the current exists model against all the universal constraints
+ * in parallel.
+ * - domain_cnstr = domain constraint for uninterpreted types
+ * - if some constraint i has a counterexample, we learn from it in
+ *   its context and set solver->scan_idx to (i+1) modulo num_constraints
+ *   (the other checks are cancelled)
+ * - solver->status is updated as in ef_solver_check_exists_model
+ */
+static void ef_solver_check_exists_model_parallel(ef_solver_t *solver, term_t domain_cnstr) {
+  ef_cex_pool_t *pool;
+  context_t *ctx;
+  smt_status_t status;
+  uint32_t i, n;
+  int32_t w;
+
+  pool = get_cex_pool(solver);
+  n = pool->nctx;
+  assert(n > 0 && solver->scan_idx < n);
+
+  for (i=0; i<n; i++) {
+    if (! prepare_cex_context(solver, i, domain_cnstr)) goto done;
+  }
+
+  trace_printf(solver->trace, 4, "(EF: testing candidate against %"PRIu32" constraints in parallel)\n", n);
+  status = ef_cex_pool_check(pool, solver->parameters, solver->scan_idx);
+  solver->numiters += pool->checked;
+  solver->numcancelled += pool->cancelled;
+
+  switch (status) {
+  case STATUS_SAT:
+  case STATUS_UNKNOWN:
+    w = pool->winner;
+    assert(w >= 0);
+    trace_candidate_check(solver, w, status);
+    trace_printf(solver->trace, 5, "(EF: %"PRIu32" checks cancelled)\n", pool->cancelled);
+
+    // go back to (B_w and domain_cnstr and not C_w) and learn
+    ctx = pool->ctx[w];
+    context_clear(ctx);
+    context_pop(ctx);
+    ef_solver_search_counterexamples(solver, ctx, w, CTX_NO_ERROR);
+
+    solver->scan_idx = w + 1;
+    if (solver->scan_idx == n) {
+      solver->scan_idx = 0;
+    }
+    break;
+
+  case STATUS_UNSAT:
+    trace_puts(solver->trace, 4, "(EF: candidate passed all constraints)\n");
+    if (solver->status == EF_STATUS_SEARCHING) {
+      solver->status = EF_STATUS_SAT;
+    }
+    break;
+
+  case YICES_STATUS_INTERRUPTED:
+    trace_candidate_check(solver, 0, status);
+    solver->status = EF_STATUS_INTERRUPTED;
+    break;
+
+  default:
+    trace_candidate_check(solver, pool->error, status);
+    solver->status = EF_STATUS_CHECK_ERROR;
+    solver->error_code = status;
+    break;
+  }
+
+ done:
+  for (i=0; i<n; i++) {
+    reset_cex_context(pool, i);
+  }
+}
+
+
+
 /*
  * Check whether the current exists_model can be falsified by one
  * of the universal constraints.
@@ -1414,6 +1662,10 @@ static void trace_candidate_check(ef_solver_t *solver, uint32_t i, smt_status_t
  *
  * If constraint i falsifies the model then solver->scan_idx is
  * set to (i+1) modulo num_constraints.
+ *
+ * If solver->cex_workers > 1, all the constraints are checked in
+ * parallel instead. The first constraint found to falsify the model
+ * is used and scan_idx is only used to order the checks.
  */
 static void  ef_solver_check_exists_model(ef_solver_t *solver) {
   smt_status_t status;
@@ -1440,6 +1692,11 @@ static void  ef_solver_check_exists_model(ef_solver_t *solver) {
 #endif
 
   solver->num_models += 1;
+  if (solver->cex_workers > 1 && n > 1) {
+    ef_solver_check_exists_model_parallel(solver, domain_cnstr);
+    return;
+  }
+
   do {
     solver->numiters += 1;
     trace_printf(solver->trace, 4, "(EF: testing candidate against constraint %"PRIu32")\n", i);
@@ -1588,12 +1845,13 @@ static void ef_solver_search(ef_solver_t *solver) {
  */
 void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
 		     ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters, uint32_t max_numlearnt,
-		     bool ematching) {
+		     uint32_t cex_workers, bool ematching) {
   solver->parameters = parameters;
   solver->option = gen_mode;
   solver->max_samples = max_samples;
   solver->max_iters = max_iters;
   solver->max_numlearnt_per_round = max_numlearnt;
+  solver->cex_workers = cex_workers;
   solver->ematching = ematching;
   solver->scan_idx = 0;
 
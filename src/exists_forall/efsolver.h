@@ -129,6 +129,7 @@
 #include "context/context_types.h"
 #include "solvers/quant/ef_problem.h"
 #include "exists_forall/ef_values.h"
+#include "exists_forall/ef_parallel.h"
 #include "io/tracer.h"
 
 #include "yices_types.h"
@@ -149,6 +150,8 @@
  * - uvalue = array large enough to store the value of all universal variables
  * - evalue_aux and uvalue_aux = auxiliary vectors (to store value vector of smaller
  *   sizes than evalue/uvalue)
+ * - cex_pool = one forall context per universal constraint, used if
+ *   cex_workers > 1 to check the constraints in parallel (NULL otherwise)
  *
  * Flags for diagnostic
  * - status = status of the last call to check (either in the exists or
@@ -209,12 +212,14 @@ typedef struct ef_solver_s {
   uint32_t max_samples;      // bound on pre-sampling: 0 means no pre-sampling
   uint32_t max_iters;        // bound on outer iterations
   uint32_t max_numlearnt_per_round;    // bound on inner iterations
+  uint32_t cex_workers;      // number of threads for the counterexample search
   bool ematching;            // use ematching or not
 
   uint32_t num_models;       // total number of exists models
   uint32_t iters;            // number of outer iterations
   uint32_t numiters;         // total number of counterexample iterations
   uint32_t numlearnt;        // total number of inner iterations
+  uint32_t numcancelled;     // number of counterexample checks cancelled
   uint32_t scan_idx;         // first universal constraint to check
 
   // Exists and forall contexts + exists model
@@ -223,6 +228,7 @@ typedef struct ef_solver_s {
   model_t *exists_model;
   ivector_t evalue;
   term_t *uvalue;
+  ef_cex_pool_t *cex_pool;
 
   // Support for implicant construction and projection
   model_t *full_model;
@@ -282,10 +288,14 @@ extern void ef_solver_set_trace(ef_solver_t *solver, tracer_t *trace);
  * - also it's available as a mapping form solver->prob->evars to solver->evalues
  *
  * Also solver->iters stores the number of iterations required.
+ *
+ * If cex_workers > 1, each candidate model is checked against all the
+ * universal constraints in parallel using cex_workers threads (cf.
+ * ef_parallel.h). The first counterexample found is used for learning.
  */
 extern void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
 			    ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters, uint32_t max_numlearnt,
-			    bool ematching);
+			    uint32_t cex_workers, bool ematching);
 
 
 /*
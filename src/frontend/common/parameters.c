@@ -37,10 +37,12 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "aux-eq-ratio",
   "bland-threshold",
   "branching",
+  "bv-lazy-blast",
   "bvarith-elim",
   "c-factor",
   "c-threshold",
   "cache-tclauses",
+  "chrono-levels",
   "clause-decay",
   "d-factor",
   "d-threshold",
@@ -48,7 +50,9 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "dyn-ack-threshold",
   "dyn-bool-ack",
   "dyn-bool-ack-threshold",
+  "eager-array-lemmas",
   "eager-lemmas",
+  "ef-cex-workers",
   "ef-flatten-iff",
   "ef-flatten-ite",
   "ef-gen-mode",
@@ -75,6 +79,8 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "flatten",
   "icheck",
   "icheck-period",
+  "inprocessing",
+  "isdl-prop",
   "keep-ite",
   "learn-eq",
   "max-ack",
@@ -99,6 +105,7 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "random-seed",
   "randomness",
   "simplex-adjust",
+  "simplex-float",
   "simplex-prop",
   "tclause-size",
   "var-decay",
@@ -112,10 +119,12 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_AUX_EQ_RATIO,
   PARAM_BLAND_THRESHOLD,
   PARAM_BRANCHING,
+  PARAM_BV_LAZY_BLAST,
   PARAM_BVARITH_ELIM,
   PARAM_C_FACTOR,
   PARAM_C_THRESHOLD,
   PARAM_CACHE_TCLAUSES,
+  PARAM_CHRONO_LEVELS,
   PARAM_CLAUSE_DECAY,
   PARAM_D_FACTOR,
   PARAM_D_THRESHOLD,
@@ -123,7 +132,9 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
+  PARAM_EAGER_ARRAY_LEMMAS,
   PARAM_EAGER_LEMMAS,
+  PARAM_EF_CEX_WORKERS,
   PARAM_EF_FLATTEN_IFF,
   PARAM_EF_FLATTEN_ITE,
   PARAM_EF_GEN_MODE,
@@ -150,6 +161,8 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_FLATTEN,
   PARAM_ICHECK,
   PARAM_ICHECK_PERIOD,
+  PARAM_INPROCESSING,
+  PARAM_ISDL_PROP,
   PARAM_KEEP_ITE,
   PARAM_LEARN_EQ,
   PARAM_MAX_ACK,
@@ -174,6 +187,7 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_RANDOM_SEED,
   PARAM_RANDOMNESS,
   PARAM_SIMPLEX_ADJUST,
+  PARAM_SIMPLEX_FLOAT,
   PARAM_SIMPLEX_PROP,
   PARAM_TCLAUSE_SIZE,
   PARAM_VAR_DECAY,
@@ -68,6 +68,8 @@ typedef enum yices_param {
   PARAM_CLAUSE_DECAY,
   PARAM_CACHE_TCLAUSES,
   PARAM_TCLAUSE_SIZE,
+  PARAM_INPROCESSING,
+  PARAM_CHRONO_LEVELS,
   // egraph parameters
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
@@ -83,14 +85,21 @@ typedef enum yices_param {
   PARAM_EAGER_LEMMAS,
   PARAM_SIMPLEX_PROP,
   PARAM_SIMPLEX_ADJUST,
+  PARAM_SIMPLEX_FLOAT,
   PARAM_PROP_THRESHOLD,
   PARAM_BLAND_THRESHOLD,
   PARAM_ICHECK,
   PARAM_ICHECK_PERIOD,
+  // sparse idl solver parameters
+  PARAM_ISDL_PROP,
   // array solver parameters
   PARAM_MAX_UPDATE_CONFLICTS,
   PARAM_MAX_EXTENSIONALITY,
+  PARAM_EAGER_ARRAY_LEMMAS,
+  // bitvector solver parameters
+  PARAM_BV_LAZY_BLAST,
   // EF solver
+  PARAM_EF_CEX_WORKERS,
   PARAM_EF_FLATTEN_IFF,
   PARAM_EF_FLATTEN_ITE,
   PARAM_EF_GEN_MODE,
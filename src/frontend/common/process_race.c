@@ -0,0 +1,250 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * RACE BETWEEN CHILD PROCESSES
+ */
+
+#include <assert.h>
+
+#include "frontend/common/process_race.h"
+
+
+#ifndef MINGW
+
+#include <errno.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+#include "yices_exit_codes.h"
+
+
+#define MAX_RACERS 255
+
+
+/*
+ * Report of a child: two bytes = index of the child + status
+ * - a write of two bytes to a pipe is atomic, so the reports of
+ *   different children are not mixed
+ */
+static void write_report(int fd, uint32_t i, smt_status_t stat) {
+  uint8_t msg[2];
+  ssize_t k;
+
+  msg[0] = (uint8_t) i;
+  msg[1] = (uint8_t) stat;
+  do {
+    k = write(fd, msg, 2);
+  } while (k < 0 && errno == EINTR);
+}
+
+/*
+ * Read the next report
+ * - return false on end-of-file (all the children have reported or died)
+ */
+static bool read_report(int fd, uint8_t msg[2]) {
+  ssize_t k;
+
+  do {
+    k = read(fd, msg, 2);
+  } while (k < 0 && errno == EINTR);
+
+  return k == 2;
+}
+
+
+/*
+ * Wait for child pid to terminate
+ * - return its status as given by waitpid
+ */
+static int wait_child(pid_t pid) {
+  int wstatus;
+  pid_t r;
+
+  do {
+    r = waitpid(pid, &wstatus, 0);
+  } while (r < 0 && errno == EINTR);
+
+  return r == pid ? wstatus : 0;
+}
+
+
+/*
+ * Exit the same way as a child whose status is wstatus
+ */
+static void __attribute__((noreturn)) exit_as_child(int wstatus) {
+  int sig;
+
+  if (WIFSIGNALED(wstatus)) {
+    sig = WTERMSIG(wstatus);
+    signal(sig, SIG_DFL);
+    raise(sig);
+  }
+  _exit(WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : YICES_EXIT_INTERNAL_ERROR);
+}
+
+
+/*
+ * Code of child i:
+ * - report = write end of the report pipe
+ * - go = read end of the pipe where the parent sends its decision
+ * - parent = pid of the calling process
+ * - return i if the child wins, exit otherwise
+ */
+static int32_t run_child(uint32_t i, race_worker_t worker, void *aux, int report, int go, pid_t parent, smt_status_t *status) {
+  smt_status_t stat;
+  ssize_t k;
+  char c;
+
+#ifdef __linux__
+  // don't survive the calling process
+  (void) prctl(PR_SET_PDEATHSIG, SIGKILL);
+  if (getppid() != parent) {
+    _exit(YICES_EXIT_INTERRUPTED);
+  }
+#endif
+
+  stat = worker(aux, i);
+  write_report(report, i, stat);
+  close(report);
+
+  do {
+    k = read(go, &c, 1);
+  } while (k < 0 && errno == EINTR);
+  if (k != 1) {
+    // the parent picked another winner
+    _exit(YICES_EXIT_SUCCESS);
+  }
+
+  close(go);
+  *status = stat;
+  return i;
+}
+
+
+/*
+ * Race n workers
+ */
+int32_t process_race(uint32_t n, race_worker_t worker, void *aux, smt_status_t *status) {
+  pid_t pid[MAX_RACERS];
+  int go[MAX_RACERS];
+  bool reported[MAX_RACERS];
+  int report[2], fd[2];
+  uint8_t msg[2];
+  pid_t parent;
+  int32_t winner;
+  uint32_t i, j, m;
+
+  assert(0 < n && n <= MAX_RACERS);
+
+  // don't let the children print what's still buffered
+  fflush(NULL);
+
+  if (pipe(report) < 0) {
+    return -1;
+  }
+
+  parent = getpid();
+  m = 0;
+  for (i=0; i<n; i++) {
+    if (pipe(fd) < 0) break;
+    pid[i] = fork();
+    if (pid[i] < 0) {
+      close(fd[0]);
+      close(fd[1]);
+      break;
+    }
+    if (pid[i] == 0) {
+      // child: keep only its ends of the pipes
+      close(report[0]);
+      close(fd[1]);
+      for (j=0; j<i; j++) {
+        close(go[j]);
+      }
+      return run_child(i, worker, aux, report[1], fd[0], parent, status);
+    }
+    close(fd[0]);
+    go[i] = fd[1];
+    reported[i] = false;
+    m ++;
+  }
+  close(report[1]);
+
+  // first SAT or UNSAT report wins
+  winner = -1;
+  while (m > 0 && read_report(report[0], msg)) {
+    i = msg[0];
+    assert(i < m);
+    reported[i] = true;
+    if (msg[1] == STATUS_SAT || msg[1] == STATUS_UNSAT) {
+      winner = i;
+      break;
+    }
+  }
+  close(report[0]);
+
+  if (winner < 0) {
+    // all the children are done: pick the first one that reported
+    for (i=0; i<m; i++) {
+      if (reported[i]) {
+        winner = i;
+        break;
+      }
+    }
+  }
+
+  for (i=0; i<m; i++) {
+    if (i == winner) {
+      (void) write(go[i], "g", 1);
+    } else {
+      kill(pid[i], SIGKILL);
+    }
+    close(go[i]);
+  }
+  for (i=0; i<m; i++) {
+    if (i != winner) {
+      (void) wait_child(pid[i]);
+    }
+  }
+
+  if (winner < 0) {
+    return -1;
+  }
+
+  exit_as_child(wait_child(pid[winner]));
+}
+
+
+#else
+
+/*
+ * No fork
+ */
+int32_t process_race(uint32_t n, race_worker_t worker, void *aux, smt_status_t *status) {
+  return -1;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * RACE BETWEEN CHILD PROCESSES
+ *
+ * This is used by yices_smt2 for the MCSAT portfolio: MCSAT creates
+ * terms during the search, so its workers can't run as threads that
+ * share the global term table. Instead, each worker runs in a child
+ * process, on a copy of the whole process state.
+ *
+ * The calling process doesn't search. Each child runs its worker then
+ * reports its status through a pipe. The calling process picks the
+ * winner: the first child that reports SAT or UNSAT or, if none does,
+ * the child of smallest index that reported (usually worker 0). So a
+ * timeout in the children gives the same result as a normal check.
+ * The winner returns from process_race and continues running the
+ * program, with its context and model as if it had done the check
+ * alone. Nothing is solved again. The other children are killed.
+ *
+ * Once a winner is picked, process_race does not return in the calling
+ * process: it waits for the winner to terminate and exits with the
+ * same status.
+ *
+ * No signal handler is installed. Since fork only copies the calling
+ * thread, process_race must be called when the process has no other
+ * thread (no timer, no pipelined reader). The children may start
+ * threads of their own (e.g., for a timeout).
+ */
+
+#ifndef __FRONTEND_COMMON_PROCESS_RACE_H
+#define __FRONTEND_COMMON_PROCESS_RACE_H
+
+#include <stdint.h>
+
+#include "yices_types.h"
+
+
+/*
+ * Worker: called in child i as worker(aux, i)
+ * - it must return the status of the check done by the child
+ */
+typedef smt_status_t (*race_worker_t)(void *aux, uint32_t i);
+
+/*
+ * Race n workers
+ * - n must be positive and no more than 255
+ * - in the winning child: return the winner's index and store its
+ *   status in *status
+ * - in the calling process: return -1 if no child could be used
+ *   (because fork or pipe failed, or all the children died without
+ *   reporting). Then the caller must do the check itself.
+ *
+ * On systems without fork (MINGW), process_race always returns -1.
+ */
+extern int32_t process_race(uint32_t n, race_worker_t worker, void *aux, smt_status_t *status);
+
+
+#endif /* __FRONTEND_COMMON_PROCESS_RACE_H */
@@ -824,9 +824,7 @@ smt_token_t next_smt_token(lexer_t *lex) {
   for (;;) {
     while (isspace(c)) c = reader_next_char(rd);
     if (c != ';') break;
-    do {
-      c = reader_next_char(rd);
-    } while (c != '\n' && c != EOF);
+    c = reader_skip_to_eol(rd);
   }
 
   // record start of token
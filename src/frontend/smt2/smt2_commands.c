@@ -41,8 +41,11 @@
 #include "api/yices_globals.h"
 #include "api/yices_mutex.h"
 #include "context/context.h"
+#include "context/context_portfolio.h"
+#include "context/mcsat_portfolio.h"
 #include "frontend/common/bug_report.h"
 #include "frontend/common/parameters.h"
+#include "frontend/common/process_race.h"
 #include "frontend/common/tables.h"
 #include "frontend/smt2/attribute_values.h"
 #include "frontend/smt2/smt2_commands.h"
@@ -64,6 +67,7 @@
 #include "io/simple_printf.h"
 #include "solvers/bv/bvsolver.h"
 #include "solvers/floyd_warshall/idl_floyd_warshall.h"
+#include "solvers/floyd_warshall/idl_sparse_solver.h"
 #include "solvers/floyd_warshall/rdl_floyd_warshall.h"
 #include "solvers/funs/fun_solver.h"
 #include "solvers/quant/quant_solver.h"
@@ -186,6 +190,8 @@ static void dump_context(FILE *f, context_t *ctx) {
       dump_idl_solver(f, ctx->arith_solver);
     } else if (context_has_rdl_solver(ctx)) {
       dump_rdl_solver(f, ctx->arith_solver);
+    } else if (context_has_isdl_solver(ctx)) {
+      // nothing to print for the sparse IDL solver
     } else {
       assert(context_has_simplex_solver(ctx));
       dump_simplex_solver(f, ctx->arith_solver);
@@ -1706,6 +1712,7 @@ static void show_egraph_stats(int fd, print_buffer_t *b, egraph_t *egraph) {
   print_string_and_uint32(fd, b, " :egraph-ackermann-lemmas ", egraph_all_ackermann(egraph));
   print_string_and_uint32(fd, b, " :egraph-final-checks ", egraph_num_final_checks(egraph));
   print_string_and_uint32(fd, b, " :egraph-interface-lemmas ", egraph_num_interface_eqs(egraph));
+  print_string_and_uint32(fd, b, " :egraph-cached-explanations ", egraph_num_cached_explanations(egraph));
 }
 
 static void show_funsolver_stats(int fd, print_buffer_t *b, fun_solver_t *solver) {
@@ -1714,6 +1721,10 @@ static void show_funsolver_stats(int fd, print_buffer_t *b, fun_solver_t *solver
   print_string_and_uint32(fd, b, " :array-update1-axioms ", fun_solver_num_update1_axioms(solver));
   print_string_and_uint32(fd, b, " :array-update2-axioms ", fun_solver_num_update2_axioms(solver));
   print_string_and_uint32(fd, b, " :array-extensionality-axioms ", fun_solver_num_extensionality_axioms(solver));
+  if (fun_solver_num_eager_checks(solver) > 0) {
+    print_string_and_uint32(fd, b, " :array-eager-checks ", fun_solver_num_eager_checks(solver));
+    print_string_and_uint32(fd, b, " :array-eager-axioms ", fun_solver_num_eager_axioms(solver));
+  }
 }
 
 static void show_quantsolver_stats(int fd, print_buffer_t *b, quant_solver_t *solver) {
@@ -1722,6 +1733,12 @@ static void show_quantsolver_stats(int fd, print_buffer_t *b, quant_solver_t *so
   print_string_and_uint32(fd, b, " :ematch-instances ", quant_solver_num_instances(solver));
   print_string_and_uint32(fd, b, " :ematch-rounds ", solver->stats.num_rounds);
   print_string_and_uint32(fd, b, " :ematch-searches ", solver->stats.num_search);
+  print_string_and_uint32(fd, b, " :ematch-roots-matched ", solver->stats.num_roots_matched);
+  print_string_and_uint32(fd, b, " :ematch-roots-skipped ", solver->stats.num_roots_skipped);
+  print_string_and_float(fd, b, " :ematch-time ", solver->stats.ematch_time);
+  if (solver->stats.ematch_time > 0) {
+    print_string_and_float(fd, b, " :ematch-instances-per-sec ", quant_solver_num_instances(solver)/solver->stats.ematch_time);
+  }
   print_string_and_uint32(fd, b, " :ematch-trial-fdepth ", solver->em.exec.fdepth);
   print_string_and_uint32(fd, b, " :ematch-trial-vdepth ", solver->em.exec.vdepth);
   print_string_and_uint32(fd, b, " :ematch-cnstr-epsilon ", solver->cnstr_learner.learner.epsilon);
@@ -1767,6 +1784,10 @@ static void show_bvsolver_stats(int fd, print_buffer_t *b, bv_solver_t *solver)
   print_string_and_uint32(fd, b, " :bvsolver-atoms ", bv_solver_num_atoms(solver));
   print_string_and_uint32(fd, b, " :bvsolver-equiv-lemmas ", bv_solver_equiv_lemmas(solver));
   print_string_and_uint32(fd, b, " :bvsolver-interface-lemmas ", bv_solver_interface_lemmas(solver));
+  if (bv_solver_lazy_ops(solver) > 0) {
+    print_string_and_uint32(fd, b, " :bvsolver-lazy-ops ", bv_solver_lazy_ops(solver));
+    print_string_and_uint32(fd, b, " :bvsolver-lazy-refinements ", bv_solver_lazy_refinements(solver));
+  }
 }
 
 static void show_idl_fw_stats(int fd, print_buffer_t *b, idl_solver_t *solver) {
@@ -1774,6 +1795,14 @@ static void show_idl_fw_stats(int fd, print_buffer_t *b, idl_solver_t *solver) {
   print_string_and_uint32(fd, b, " :idl-solver-atoms ", idl_num_atoms(solver));
 }
 
+static void show_isdl_stats(int fd, print_buffer_t *b, isdl_solver_t *solver) {
+  print_string_and_uint32(fd, b, " :idl-solver-vars ", isdl_num_vars(solver));
+  print_string_and_uint32(fd, b, " :idl-solver-atoms ", isdl_num_atoms(solver));
+  print_string_and_uint32(fd, b, " :idl-solver-edges ", isdl_num_edges(solver));
+  print_string_and_uint32(fd, b, " :idl-solver-conflicts ", solver->stats.num_conflicts);
+  print_string_and_uint32(fd, b, " :idl-solver-propagations ", solver->stats.num_props);
+}
+
 static void show_rdl_fw_stats(int fd, print_buffer_t *b, rdl_solver_t *solver) {
   print_string_and_uint32(fd, b, " :rdl-solver-vars ", rdl_num_vars(solver));
   print_string_and_uint32(fd, b, " :rdl-solver-atoms ", rdl_num_atoms(solver));
@@ -1804,6 +1833,8 @@ static void show_ctx_stats(int fd, print_buffer_t *b, context_t *ctx) {
       show_simplex_stats(fd, b, ctx->arith_solver);
     } else if (context_has_idl_solver(ctx)) {
       show_idl_fw_stats(fd, b, ctx->arith_solver);
+    } else if (context_has_isdl_solver(ctx)) {
+      show_isdl_stats(fd, b, ctx->arith_solver);
     } else {
       assert(context_has_rdl_solver(ctx));
       show_rdl_fw_stats(fd, b, ctx->arith_solver);
@@ -1827,6 +1858,9 @@ static void show_ef_stats(int fd, print_buffer_t *b, ef_client_t *efc) {
   print_string_and_uint32(fd, b, " :mbqi-models ", efc->efsolver->num_models);
   print_string_and_uint32(fd, b, " :mbqi-cex ", efc->efsolver->numiters);
   print_string_and_uint32(fd, b, " :mbqi-instances ", efc->efsolver->numlearnt);
+  if (efc->efsolver->cex_workers > 1) {
+    print_string_and_uint32(fd, b, " :mbqi-cex-cancelled ", efc->efsolver->numcancelled);
+  }
 }
 
 
@@ -2580,10 +2614,11 @@ static inline bool one_check_mode(smt2_globals_t *g) {
 }
 
 /*
- * Allocate and initialize the context based on g->logic
+ * Allocate and initialize a new context based on g->logic
  * - make sure the logic is supported before calling this
  */
-static void init_smt2_context(smt2_globals_t *g) {
+static context_t *new_smt2_context(smt2_globals_t *g) {
+  context_t *ctx;
   smt_logic_t logic;
   context_arch_t arch;
   context_mode_t mode;
@@ -2628,16 +2663,25 @@ static void init_smt2_context(smt2_globals_t *g) {
     qflag = false;
   }
 
-  g->ctx = yices_create_context(logic, arch, mode, iflag, qflag);
-  assert(g->ctx != NULL);
+  ctx = yices_create_context(logic, arch, mode, iflag, qflag);
+  assert(ctx != NULL);
+
+  // Set the mcsat options
+  ctx->mcsat_options = g->mcsat_options;
+  ivector_copy(&ctx->mcsat_var_order, g->var_order.data, g->var_order.size);
+
+  return ctx;
+}
+
+/*
+ * Allocate and initialize g->ctx
+ */
+static void init_smt2_context(smt2_globals_t *g) {
+  g->ctx = new_smt2_context(g);
   if (g->verbosity > 0 || g->tracer != NULL) {
     context_set_trace(g->ctx, get_tracer(g));
   }
 
-  // Set the mcsat options
-  g->ctx->mcsat_options = g->mcsat_options;
-  ivector_copy(&g->ctx->mcsat_var_order, g->var_order.data, g->var_order.size);
-
   /*
    * TODO: override the default context options based on
    * ctx_parameters.  I don't want to do it now (2015/07/22). If we
@@ -2727,6 +2771,145 @@ static smt_status_t check_sat_with_timeout(smt2_globals_t *g, const param_t *par
 }
 
 
+/*
+ * Portfolio check of the delayed assertions
+ * - g->ctx must be IDLE and contain all the assertions
+ * - we create g->portfolio - 1 more contexts for the same assertions
+ *   then race them all (with g->ctx as worker 0)
+ * - params = search parameters for worker 0. The other workers use
+ *   variants of these parameters.
+ * - if a worker other than 0 wins, it replaces g->ctx (so that the
+ *   model is extracted from the right context)
+ * - the timeout is handled via g->ctx: if it's interrupted the
+ *   whole portfolio is stopped.
+ */
+static smt_status_t check_sat_portfolio(smt2_globals_t *g, const param_t *params) {
+  portfolio_t portfolio;
+  pvector_t workers;
+  context_t *ctx, *winner;
+  smt_status_t stat;
+  uint32_t i;
+  int32_t code;
+
+  assert(g->portfolio > 1 && context_status(g->ctx) == STATUS_IDLE);
+
+  init_pvector(&workers, g->portfolio);
+  pvector_push(&workers, g->ctx);
+  for (i=1; i<g->portfolio; i++) {
+    ctx = new_smt2_context(g);
+    code = yices_assert_formulas(ctx, g->assertions.size, g->assertions.data);
+    if (code < 0 || context_status(ctx) != STATUS_IDLE) {
+      // this should not happen since the assertions were accepted by g->ctx
+      yices_free_context(ctx);
+      break;
+    }
+    pvector_push(&workers, ctx);
+  }
+  trace_printf(g->tracer, 3, "(check-sat: portfolio of %"PRIu32" workers)\n", workers.size);
+
+  init_portfolio(&portfolio, workers.size);
+  for (i=0; i<workers.size; i++) {
+    portfolio_set_context(&portfolio, i, workers.data[i]);
+  }
+  portfolio_diversify_params(&portfolio, params);
+
+  if (g->timeout > 0) {
+    if (! g->to) {
+      g->to = init_timeout();
+    }
+    g->interrupted = false;
+    start_timeout(g->to, g->timeout, timeout_handler, g);
+    stat = portfolio_check(&portfolio);
+    clear_timeout(g->to);
+  } else {
+    stat = portfolio_check(&portfolio);
+  }
+
+  winner = portfolio_winner(&portfolio);
+  if (winner != NULL) {
+    trace_printf(g->tracer, 3, "(check-sat: portfolio won by worker %"PRId32")\n", portfolio.winner);
+  }
+  trace_printf(g->tracer, 3, "(check-sat: %"PRIu64" clauses shared)\n", portfolio.shared);
+  delete_portfolio(&portfolio);
+
+  // keep the winner as g->ctx and delete all the other contexts
+  if (winner != NULL && winner != g->ctx) {
+    yices_free_context(g->ctx);
+    g->ctx = winner;
+  }
+  for (i=1; i<workers.size; i++) {
+    if (workers.data[i] != g->ctx) {
+      yices_free_context(workers.data[i]);
+    }
+  }
+  delete_pvector(&workers);
+
+  if (stat == YICES_STATUS_INTERRUPTED) {
+    trace_printf(g->tracer, 2, "(check-sat: interrupted)\n");
+    g->interrupted = true;
+    stat = STATUS_UNKNOWN;
+  }
+
+  return stat;
+}
+
+
+/*
+ * Worker of an MCSAT portfolio: this runs in a child process
+ */
+typedef struct mcsat_race_s {
+  smt2_globals_t *globals;
+  const mcsat_portfolio_t *portfolio;
+  const param_t *params;
+} mcsat_race_t;
+
+static smt_status_t mcsat_race_worker(void *aux, uint32_t i) {
+  mcsat_race_t *race;
+
+  race = aux;
+  mcsat_portfolio_set_worker(race->portfolio, race->globals->ctx, i);
+  return check_sat_with_timeout(race->globals, race->params);
+}
+
+
+/*
+ * Portfolio check for MCSAT
+ * - g->ctx must be IDLE and use MCSAT
+ * - each worker runs in a child process with a variant of the
+ *   MCSAT options and variable order of g->ctx (cf. mcsat_portfolio.h)
+ * - the winner continues as if it had done the check alone: its context
+ *   has the model or the UNSAT state. This process waits for the winner
+ *   and exits (cf. process_race.h).
+ * - if the race can't be done, this process checks with worker 0
+ */
+static smt_status_t check_sat_mcsat_portfolio(smt2_globals_t *g, const param_t *params) {
+  mcsat_portfolio_t portfolio;
+  mcsat_race_t race;
+  smt_status_t stat;
+  int32_t winner;
+
+  assert(g->portfolio > 1 && context_has_mcsat(g->ctx) && context_status(g->ctx) == STATUS_IDLE);
+
+  init_mcsat_portfolio(&portfolio, g->portfolio);
+  mcsat_portfolio_diversify(&portfolio, g->ctx);
+  trace_printf(g->tracer, 3, "(check-sat: MCSAT portfolio of %"PRIu32" workers)\n", portfolio.nworkers);
+
+  race.globals = g;
+  race.portfolio = &portfolio;
+  race.params = params;
+  winner = process_race(portfolio.nworkers, mcsat_race_worker, &race, &stat);
+  if (winner < 0) {
+    trace_printf(g->tracer, 3, "(check-sat: no portfolio, checking with worker 0)\n");
+    stat = mcsat_race_worker(&race, 0);
+  } else if (stat == STATUS_SAT || stat == STATUS_UNSAT) {
+    trace_printf(g->tracer, 3, "(check-sat: portfolio won by worker %"PRId32")\n", winner);
+  }
+  delete_mcsat_portfolio(&portfolio);
+
+  return stat;
+}
+
+
 /*
  * Check with assumptions:
  * - params = search parameters
@@ -3029,7 +3212,7 @@ static bool _o_has_uf(term_t *a, uint32_t n) {
   return result;
 }
 static bool has_uf(term_t *a, uint32_t n) {
-  MT_PROTECT(bool, __yices_globals.lock, _o_has_uf(a, n));
+  MT_PROTECT_WRITE(bool, __yices_globals.lock, _o_has_uf(a, n));
 }
 
 /*
@@ -3052,6 +3235,59 @@ static void add_delayed_assertion(smt2_globals_t *g, term_t t) {
 }
 
 
+/*
+ * Save all delayed assertions to g->save_snapshot
+ * - if with_context is true, g->ctx contains the assertions and we
+ *   try to save it too. If the context can't be saved, we save only
+ *   the assertions.
+ * - the snapshot is written only once (on the first check-sat)
+ */
+static void save_assertions_snapshot(smt2_globals_t *g, bool with_context) {
+  int32_t code;
+
+  assert(g->save_snapshot != NULL);
+
+  code = 0;
+  if (with_context) {
+    code = yices_save_context_snapshot(g->ctx, g->save_snapshot, g->assertions.size, g->assertions.data);
+    if (code < 0 && yices_error_code() == SNAPSHOT_UNSUPPORTED_CONTEXT) {
+      trace_printf(g->tracer, 3, "(check-sat: the context can't be saved, saving the assertions only)\n");
+      with_context = false;
+    }
+  }
+  if (! with_context) {
+    code = yices_save_snapshot(g->save_snapshot, g->assertions.size, g->assertions.data);
+  }
+
+  if (code < 0) {
+    if (yices_error_code() == OUTPUT_ERROR) {
+      print_error("can't write snapshot %s: %s", g->save_snapshot, strerror(errno));
+    } else {
+      print_error("can't save snapshot %s: the assertions contain unsupported terms", g->save_snapshot);
+    }
+  } else {
+    trace_printf(g->tracer, 3, "(check-sat: %"PRIu32" assertions saved to %s)\n",
+                 g->assertions.size, g->save_snapshot);
+  }
+  g->save_snapshot = NULL;
+}
+
+
+/*
+ * Create g->ctx and assert the delayed assertions
+ * - if g->ctx was restored from a context snapshot, it exists already
+ *   and contains the first g->nrestored assertions: only the others
+ *   are asserted
+ * - return the code returned by yices_assert_formulas
+ */
+static int32_t assert_delayed_assertions(smt2_globals_t *g) {
+  if (g->ctx == NULL) {
+    init_smt2_context(g);
+  }
+  return yices_assert_formulas(g->ctx, g->assertions.size - g->nrestored, g->assertions.data + g->nrestored);
+}
+
+
 /*
  * Check satisfiability of all assertions
  */
@@ -3064,15 +3300,32 @@ static void check_delayed_assertions(smt2_globals_t *g, bool report) {
   g->frozen = true;
 
   if (g->trivially_unsat) {
+    if (g->save_snapshot != NULL) {
+      save_assertions_snapshot(g, false);
+    }
     trace_printf(g->tracer, 3, "(check-sat: trivially unsat)\n");
     if (report)
       report_status(g, STATUS_UNSAT);
   } else if (trivially_true_assertions(g->assertions.data, g->assertions.size, &model)) {
+    if (g->save_snapshot != NULL) {
+      save_assertions_snapshot(g, false);
+    }
     trace_printf(g->tracer, 3, "(check-sat: trivially true)\n");
     g->trivially_sat = true;
     g->model = model;
     if (report)
       report_status(g, STATUS_SAT);
+  } else if (g->sls_moves > 0 && !g->export_to_dimacs &&
+             local_search_assertions(g->assertions.data, g->assertions.size, g->sls_moves, &model)) {
+    // the model is used as in the trivially true case
+    if (g->save_snapshot != NULL) {
+      save_assertions_snapshot(g, false);
+    }
+    trace_printf(g->tracer, 3, "(check-sat: model found by local search)\n");
+    g->trivially_sat = true;
+    g->model = model;
+    if (report)
+      report_status(g, STATUS_SAT);
   } else {
     /*
      * check for mislabeled benchmarks: some benchmarks
@@ -3083,12 +3336,14 @@ static void check_delayed_assertions(smt2_globals_t *g, bool report) {
       trace_printf(g->tracer, 2, "(Warning: switching logic to QF_IDL)\n");
       g->logic_code = QF_IDL;
     }
-    init_smt2_context(g);
-
     if (g->export_to_dimacs) {
       /*
        * Bitblast and export in DIMACS format.
        */
+      if (g->save_snapshot != NULL) {
+        save_assertions_snapshot(g, false);
+      }
+      init_smt2_context(g);
       code = export_delayed_assertions(g->ctx, g->assertions.size, g->assertions.data, g->dimacs_file);
       if (code < 0) {
         print_yices_error(true);
@@ -3100,13 +3355,16 @@ static void check_delayed_assertions(smt2_globals_t *g, bool report) {
       /*
        * Assert formulas
        */
-      code = yices_assert_formulas(g->ctx, g->assertions.size, g->assertions.data);
+      code = assert_delayed_assertions(g);
       if (code < 0) {
         // error during assertion processing
         print_yices_error(true);
         done = true;
         return;
       }
+      if (g->save_snapshot != NULL) {
+        save_assertions_snapshot(g, true);
+      }
 
       if (g->delegate != NULL && g->logic_code == QF_BV) {
         /*
@@ -3133,7 +3391,15 @@ static void check_delayed_assertions(smt2_globals_t *g, bool report) {
         if (g->random_seed != 0) {
           g->parameters.random_seed = g->random_seed;
         }
-        status = check_sat_with_timeout(g, &g->parameters);
+        if (g->portfolio > 1 && context_supports_portfolio(g->ctx) &&
+            context_status(g->ctx) == STATUS_IDLE) {
+          status = check_sat_portfolio(g, &g->parameters);
+        } else if (g->portfolio > 1 && context_has_mcsat(g->ctx) &&
+                   context_status(g->ctx) == STATUS_IDLE) {
+          status = check_sat_mcsat_portfolio(g, &g->parameters);
+        } else {
+          status = check_sat_with_timeout(g, &g->parameters);
+        }
       }
 
       if (report)
@@ -3274,8 +3540,7 @@ static void check_delayed_assertions_assuming(smt2_globals_t *g, uint32_t n, sig
       assumptions->status = STATUS_UNSAT;
       report_status(g, STATUS_UNSAT);
     } else {
-      init_smt2_context(g);
-      code = yices_assert_formulas(g->ctx, g->assertions.size, g->assertions.data);
+      code = assert_delayed_assertions(g);
       if (code < 0) {
         // error during assertion processing
         print_yices_error(true);
@@ -3312,8 +3577,7 @@ static void check_delayed_assertions_assuming_model(smt2_globals_t *g, uint32_t
     report_status(g, STATUS_UNSAT);
     g->check_with_model_status = STATUS_UNSAT;
   } else {
-    init_smt2_context(g);
-    code = yices_assert_formulas(g->ctx, g->assertions.size, g->assertions.data);
+    code = assert_delayed_assertions(g);
     if (code < 0) {
       // error during assertion processing
       print_yices_error(true);
@@ -4608,10 +4872,14 @@ static void init_smt2_globals(smt2_globals_t *g) {
   init_params_to_defaults(&g->parameters);
   g->dump_models = false;
   g->nthreads = 0;
+  g->portfolio = 0;
+  g->sls_moves = 0;
   g->timeout = 0;
   g->to = NULL;
   g->interrupted = false;
   g->delegate = NULL;
+  g->save_snapshot = NULL;
+  g->load_snapshot = NULL;
   g->avtbl = NULL;
   g->info = NULL;
   g->ctx = NULL;
@@ -4650,6 +4918,7 @@ static void init_smt2_globals(smt2_globals_t *g) {
   g->trivially_unsat = false;
   g->trivially_sat = false;
   g->frozen = false;
+  g->nrestored = 0;
 
   init_smt2_pattern_map(&g->term_patterns);
 }
@@ -4810,6 +5079,38 @@ void smt2_set_delegate(const char *name) {
   __smt2_globals.delegate = name;
 }
 
+/*
+ * Set the number of workers for portfolio check
+ * - n <= 1 means no portfolio
+ */
+void smt2_set_portfolio(uint32_t n) {
+  if (n > PORTFOLIO_MAX_WORKERS) {
+    n = PORTFOLIO_MAX_WORKERS;
+  }
+  __smt2_globals.portfolio = n;
+}
+
+/*
+ * Budget for local search
+ * - n = 0 means no local search
+ */
+void smt2_set_sls_moves(uint32_t n) {
+  __smt2_globals.sls_moves = n;
+}
+
+/*
+ * Snapshot files
+ */
+void smt2_set_save_snapshot(const char *filename) {
+  assert(filename != NULL);
+  __smt2_globals.save_snapshot = filename;
+}
+
+void smt2_set_load_snapshot(const char *filename) {
+  assert(filename != NULL);
+  __smt2_globals.load_snapshot = filename;
+}
+
 /*
  * Set a a dimacs filename but don't force export to DIMACS
  * This is use to export to DIMACS after delegate preprocessing
@@ -5186,6 +5487,14 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->parameters.tclause_size);
     break;
 
+  case PARAM_INPROCESSING:
+    print_boolean_value(g->parameters.inprocessing);
+    break;
+
+  case PARAM_CHRONO_LEVELS:
+    print_uint32_value(g->parameters.chrono_levels);
+    break;
+
   case PARAM_DYN_ACK:
     print_boolean_value(g->parameters.use_dyn_ack);
     break;
@@ -5242,6 +5551,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_boolean_value(g->parameters.adjust_simplex_model);
     break;
 
+  case PARAM_SIMPLEX_FLOAT:
+    print_boolean_value(g->parameters.simplex_float_first);
+    break;
+
   case PARAM_PROP_THRESHOLD:
     print_uint32_value(g->parameters.max_prop_row_size);
     break;
@@ -5254,6 +5567,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->parameters.integer_check_period);
     break;
 
+  case PARAM_ISDL_PROP:
+    print_boolean_value(g->parameters.isdl_prop);
+    break;
+
   case PARAM_MAX_UPDATE_CONFLICTS:
     print_uint32_value(g->parameters.max_update_conflicts);
     break;
@@ -5262,6 +5579,14 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->parameters.max_extensionality);
     break;
 
+  case PARAM_EAGER_ARRAY_LEMMAS:
+    print_boolean_value(g->parameters.eager_array_lemmas);
+    break;
+
+  case PARAM_BV_LAZY_BLAST:
+    print_boolean_value(g->parameters.bv_lazy_blast);
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     print_boolean_value(g->ef_client.ef_parameters.flatten_iff);
     break;
@@ -5286,6 +5611,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->ef_client.ef_parameters.max_numlearnt_per_round);
     break;
 
+  case PARAM_EF_CEX_WORKERS:
+    print_uint32_value(g->ef_client.ef_parameters.cex_workers);
+    break;
+
   case PARAM_EMATCH_EN:
     print_boolean_value(g->ef_client.ef_parameters.ematching);
     break;
@@ -5841,6 +6170,18 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_INPROCESSING:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.inprocessing = tt;
+    }
+    break;
+
+  case PARAM_CHRONO_LEVELS:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->parameters.chrono_levels = n;
+    }
+    break;
+
   case PARAM_DYN_ACK:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->parameters.use_dyn_ack = tt;
@@ -5927,6 +6268,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_SIMPLEX_FLOAT:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.simplex_float_first = tt;
+    }
+    break;
+
   case PARAM_PROP_THRESHOLD:
     if (param_val_to_nonneg32(param, val, &n, &reason)) {
       g->parameters.max_prop_row_size = n;
@@ -5959,6 +6306,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_ISDL_PROP:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.isdl_prop = tt;
+    }
+    break;
+
   case PARAM_MAX_UPDATE_CONFLICTS:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       g->parameters.max_update_conflicts = n;
@@ -5971,6 +6324,18 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_EAGER_ARRAY_LEMMAS:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.eager_array_lemmas = tt;
+    }
+    break;
+
+  case PARAM_BV_LAZY_BLAST:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.bv_lazy_blast = tt;
+    }
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->ef_client.ef_parameters.flatten_iff = tt;
@@ -6007,6 +6372,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_EF_CEX_WORKERS:
+    if (param_val_to_pos32(param, val, &n, &reason)) {
+      g->ef_client.ef_parameters.cex_workers = n;
+    }
+    break;
+
   case PARAM_EMATCH_EN:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->ef_client.ef_parameters.ematching = tt;
@@ -6380,6 +6751,82 @@ void smt2_set_info(const char *name, aval_t value) {
 }
 
 
+/*
+ * Try to restore g->ctx from the context snapshot g->load_snapshot
+ * - this is done only in benchmark mode, when the assertions are
+ *   checked by check_delayed_assertions (i.e., not for exists/forall
+ *   problems, unsat cores, DIMACS export, or multiple threads)
+ * - return true if the context is restored: the assertions are
+ *   added to v
+ * - return false otherwise: g->ctx is deleted and v is unchanged
+ */
+static bool load_context_snapshot(smt2_globals_t *g, term_vector_t *v) {
+  if (g->efmode || g->produce_unsat_cores || g->export_to_dimacs || g->nthreads > 0) {
+    return false;
+  }
+
+  init_smt2_context(g);
+  if (yices_load_context_snapshot(g->ctx, g->load_snapshot, v) == 0) {
+    return true;
+  }
+
+  yices_free_context(g->ctx);
+  g->ctx = NULL;
+  return false;
+}
+
+
+/*
+ * Restore the assertions stored in g->load_snapshot
+ * - in benchmark mode, they are added to the delayed assertions.
+ *   If the snapshot contains a context, g->ctx is also restored
+ *   and g->nrestored is set.
+ * - in incremental mode, they are asserted in g->ctx (at the base level)
+ * - return false and print an error if something goes wrong
+ */
+static bool load_assertions_snapshot(smt2_globals_t *g) {
+  term_vector_t v;
+  uint32_t i;
+  int32_t code;
+  bool ok, restored;
+
+  assert(g->load_snapshot != NULL);
+
+  ok = true;
+  yices_init_term_vector(&v);
+  restored = g->benchmark_mode && load_context_snapshot(g, &v);
+  code = restored ? 0 : yices_load_snapshot(g->load_snapshot, &v);
+  if (code < 0) {
+    if (yices_error_code() == INPUT_ERROR) {
+      print_error("can't read snapshot %s: %s", g->load_snapshot, strerror(errno));
+    } else {
+      print_error("invalid snapshot file %s", g->load_snapshot);
+    }
+    ok = false;
+  } else {
+    trace_printf(g->tracer, 3, "(set-logic: %"PRIu32" assertions %srestored from %s)\n",
+                 v.size, restored ? "and context " : "", g->load_snapshot);
+    for (i=0; i<v.size && ok; i++) {
+      if (g->benchmark_mode) {
+        add_delayed_assertion(g, v.data[i]);
+      } else if (context_status(g->ctx) == STATUS_IDLE) {
+        code = assert_formula(g->ctx, v.data[i]);
+        if (code < 0) {
+          print_internalization_error(code);
+          ok = false;
+        }
+      }
+    }
+    if (restored) {
+      g->nrestored = g->assertions.size;
+    }
+  }
+  yices_delete_term_vector(&v);
+
+  return ok;
+}
+
+
 /*
  * Set the logic:
  * - name = logic name (using the SMT-LIB conventions)
@@ -6479,6 +6926,12 @@ void smt2_set_logic(const char *name) {
     yices_set_default_params(&__smt2_globals.parameters, code, arch, CTX_MODE_ONECHECK);
   }
 
+  if (__smt2_globals.load_snapshot != NULL) {
+    if (! load_assertions_snapshot(&__smt2_globals)) {
+      return;
+    }
+  }
+
   report_success();
 }
 
@@ -401,6 +401,12 @@ typedef struct smt2_globals_s {
   // nthreads
   uint32_t nthreads;           // default = 0 (single threaded)
 
+  // portfolio: number of solver configurations raced by check-sat
+  uint32_t portfolio;          // default = 0 (no portfolio)
+
+  // local search: number of moves tried by check-sat before bit-blasting
+  uint32_t sls_moves;          // default = 0 (no local search)
+
   // timeout
   uint32_t timeout;           // default = 0 (no timeout); global timeout used for every check-sat
   timeout_t *to;              // initially NULL. Non-NULL once init_timeout is called
@@ -409,6 +415,10 @@ typedef struct smt2_globals_s {
   // optional: delegate sat solver for QF_BV
   const char *delegate;      // default = NULL: no delegate
 
+  // optional: snapshot files
+  const char *save_snapshot; // default = NULL: assertions are saved on check-sat if non-NULL
+  const char *load_snapshot; // default = NULL: assertions are restored on set-logic if non-NULL
+
   // internals
   attr_vtbl_t *avtbl;        // global attribute table
   strmap_t *info;            // for set-info/get-info (initially NULL)
@@ -457,11 +467,14 @@ typedef struct smt2_globals_s {
    * - trivially_sat: true if assertions are true in the default model
    * - frozen: set to true after the first call to check_sat if
    *   benchmark_mode is true
+   * - nrestored: number of assertions restored from a context snapshot
+   *   (i.e., assertions[0 ... nrestored-1] are already in ctx)
    */
   ivector_t assertions;
   bool trivially_unsat;
   bool trivially_sat;
   bool frozen;
+  uint32_t nrestored;
 
   ptr_hmap_t term_patterns;
 
@@ -539,6 +552,46 @@ extern void smt2_set_delegate(const char *name);
  */
 extern void smt2_set_dimacs_file(const char *filename);
 
+/*
+ * Set the number of workers for portfolio check:
+ * - in benchmark mode, check-sat races n contexts with different
+ *   search parameters (n is capped at PORTFOLIO_MAX_WORKERS)
+ * - if the context uses MCSAT, the workers are child processes
+ *   with different MCSAT options (cf. mcsat_portfolio.h) and the
+ *   winner continues in place of this process (cf. process_race.h)
+ * - n <= 1 means no portfolio (default)
+ */
+extern void smt2_set_portfolio(uint32_t n);
+
+/*
+ * Set the budget for local search:
+ * - in benchmark mode, check-sat first tries to find a model of the
+ *   assertions by word-level local search, using at most n moves.
+ *   If that fails, the problem is solved as usual.
+ * - this is used only for Boolean and bitvector problems
+ * - n = 0 means no local search (default)
+ */
+extern void smt2_set_sls_moves(uint32_t n);
+
+/*
+ * Save the assertions to a snapshot file:
+ * - in benchmark mode, the assertions are saved to filename
+ *   when check-sat is called (before solving)
+ * - if the context supports it, the snapshot also stores the context
+ *   after the assertions are internalized (cf. context_snapshot.h)
+ */
+extern void smt2_set_save_snapshot(const char *filename);
+
+/*
+ * Restore assertions from a snapshot file:
+ * - the terms stored in filename are restored and asserted
+ *   when the logic is set
+ * - in benchmark mode, if filename contains a context snapshot, the
+ *   context is created and restored when the logic is set: the
+ *   restored assertions are not internalized again
+ */
+extern void smt2_set_load_snapshot(const char *filename);
+
 /*
  * Delete all internal structures (called after exit).
  */
@@ -464,21 +464,67 @@ void smt2_lexer_activate_two_dot_five(void) {
 }
 
 
+/*
+ * Character classes: char_class[c] is a bit mask
+ * - SMT2_SIMPLE_CHAR is set if c is simple (cf. issimple below)
+ * - SMT2_SPACE_CHAR is set if c is a space (isspace)
+ * Both depend on the locale. The table is built when the first lexer
+ * is initialized and it's read-only after that: the lexer thread of a
+ * pipeline (cf. smt2_pipeline.h) can read it while the main thread
+ * initializes other lexers.
+ */
+#define SMT2_SIMPLE_CHAR 1
+#define SMT2_SPACE_CHAR  2
+
+static bool issimple(int c);
+
+static uint8_t char_class[256];
+static bool char_class_ready = false;
+
+static void smt2_init_char_classes(void) {
+  uint32_t i;
+  uint8_t k;
+
+  if (char_class_ready) return;
+
+  for (i=0; i<256; i++) {
+    k = 0;
+    if (issimple(i)) k |= SMT2_SIMPLE_CHAR;
+    if (isspace(i)) k |= SMT2_SPACE_CHAR;
+    char_class[i] = k;
+  }
+  char_class_ready = true;
+}
+
+static inline bool is_simple_char(int c) {
+  assert(c < 256);
+  return c >= 0 && (char_class[c] & SMT2_SIMPLE_CHAR) != 0;
+}
+
+static inline bool is_space_char(int c) {
+  assert(c < 256);
+  return c >= 0 && (char_class[c] & SMT2_SPACE_CHAR) != 0;
+}
+
+
 /*
  * Lexer initialization
  */
 int32_t init_smt2_file_lexer(lexer_t *lex, const char *filename) {
   smt2_activate_default();
+  smt2_init_char_classes();
   return init_file_lexer(lex, filename);
 }
 
 void init_smt2_stream_lexer(lexer_t *lex, FILE *f, const char *name) {
   smt2_activate_default();
+  smt2_init_char_classes();
   init_stream_lexer(lex, f, name);
 }
 
 void init_smt2_string_lexer(lexer_t *lex, char *data, const char *name) {
   smt2_activate_default();
+  smt2_init_char_classes();
   init_string_lexer(lex, data, name);
 }
 
@@ -853,6 +899,41 @@ static bool issimple(int c) {
 }
 
 
+/*
+ * Add the current character then all the simple chars that follow
+ * to the buffer
+ * - we scan the reader's buffer directly when possible
+ * - return the first character that's not simple
+ */
+static int smt2_read_simple_chars(lexer_t *lex) {
+  reader_t *rd;
+  string_buffer_t *buffer;
+  const char *s;
+  uint32_t i, n;
+  int c;
+
+  rd = &lex->reader;
+  buffer = lex->buffer;
+  c = reader_current_char(rd);
+
+  do {
+    string_buffer_append_char(buffer, c);
+    s = reader_buffer(rd, &n);
+    i = 0;
+    while (i < n && (char_class[(unsigned char) s[i]] & SMT2_SIMPLE_CHAR)) {
+      i ++;
+    }
+    if (i > 0) {
+      string_buffer_append_chars(buffer, s, i);
+      reader_skip_buffered_chars(rd, i);
+    }
+    c = reader_next_char(rd);
+  } while (is_simple_char(c));
+
+  return c;
+}
+
+
 /*
  * Read a keyword:
  * - the buffer must be empty
@@ -863,21 +944,14 @@ static bool issimple(int c) {
  * Otherwise return SMT2_TK_KEYWORD.
  */
 static smt2_token_t smt2_read_keyword(lexer_t *lex) {
-  reader_t *rd;
   string_buffer_t *buffer;
-  int c;
   smt2_token_t tk;
 
-  rd = &lex->reader;
   buffer = lex->buffer;
-  c = reader_current_char(rd);
-
-  assert(string_buffer_length(buffer) == 0 && c == ':');
+  assert(string_buffer_length(buffer) == 0 &&
+         reader_current_char(&lex->reader) == ':');
 
-  do {
-    string_buffer_append_char(buffer, c);
-    c = reader_next_char(rd);
-  } while (issimple(c));
+  smt2_read_simple_chars(lex);
   string_buffer_close(buffer);
 
   tk = SMT2_TK_KEYWORD;
@@ -900,22 +974,15 @@ static smt2_token_t smt2_read_keyword(lexer_t *lex) {
  * token id. Otherwise, return SMT2_TK_SYMBOL.
  */
 static smt2_token_t smt2_read_symbol(lexer_t *lex) {
-  reader_t *rd;
   string_buffer_t *buffer;
   const keyword_t *kw;
-  int c;
   smt2_token_t tk;
 
-  rd = &lex->reader;
   buffer = lex->buffer;
-  c = reader_current_char(rd);
-
-  assert(string_buffer_length(buffer) == 0 && issimple(c));
+  assert(string_buffer_length(buffer) == 0 &&
+         issimple(reader_current_char(&lex->reader)));
 
-  do {
-    string_buffer_append_char(buffer, c);
-    c = reader_next_char(rd);
-  } while (issimple(c));
+  smt2_read_simple_chars(lex);
   string_buffer_close(buffer);
 
   tk = SMT2_TK_SYMBOL;
@@ -1004,12 +1071,10 @@ smt2_token_t next_smt2_token(lexer_t *lex) {
 
   // skip spaces and comments
   for (;;) {
-    while (isspace(c)) c = reader_next_char(rd);
+    while (is_space_char(c)) c = reader_next_char(rd);
     if (c != ';') break;
     // comments: read everything until the end of the line or EOF
-    do {
-      c = reader_next_char(rd);
-    } while (c != '\n' && c != EOF);
+    c = reader_skip_to_eol(rd);
   }
 
   // record start of token
@@ -1076,7 +1141,7 @@ smt2_token_t next_smt2_token(lexer_t *lex) {
     goto done;
 
   default:
-    if (issimple(c)) {
+    if (is_simple_char(c)) {
       tk = smt2_read_symbol(lex);
       goto done;
     } else {
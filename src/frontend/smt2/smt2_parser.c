@@ -41,6 +41,24 @@ static inline uint32_t tklen(lexer_t *lex) {
 }
 
 
+/*
+ * Token source: either the lexer or a pipeline attached to it
+ */
+static smt2_pipeline_t *pipeline = NULL;
+
+void smt2_parser_set_pipeline(smt2_pipeline_t *pipe) {
+  pipeline = pipe;
+}
+
+static inline smt2_token_t next_token(lexer_t *lex) {
+  if (pipeline != NULL) {
+    assert(pipeline->lex == lex);
+    return smt2_pipeline_next_token(pipeline);
+  }
+  return next_smt2_token(lex);
+}
+
+
 /*
  * Marker for the bottom of the state stack
  */
@@ -117,7 +135,7 @@ static int32_t smt2_parse(parser_t *parser, state_t start) {
 
   loop:
     // jump here for actions that consume the current token
-    token = next_smt2_token(lex);
+    token = next_token(lex);
     loc.line = current_token_line(lex);
     loc.column = current_token_column(lex);
     if (keep_tokens) {
@@ -25,6 +25,7 @@
 
 #include <stdio.h>
 
+#include "frontend/smt2/smt2_pipeline.h"
 #include "parser_utils/parser.h"
 
 /*
@@ -33,4 +34,11 @@
  */
 extern int32_t parse_smt2_command(parser_t *parser);
 
+/*
+ * Read tokens from a pipeline instead of the parser's lexer
+ * - pipe must be started on the parser's lexer (cf. smt2_pipeline.h)
+ * - pipe = NULL means read from the lexer
+ */
+extern void smt2_parser_set_pipeline(smt2_pipeline_t *pipe);
+
 #endif /* __SMT2_PARSER_H */
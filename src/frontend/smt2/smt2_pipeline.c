@@ -0,0 +1,490 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PIPELINED LEXER FOR SMT2
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "frontend/smt2/smt2_pipeline.h"
+#include "utils/memalloc.h"
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <signal.h>
+
+#include "mt/threads.h"
+#endif
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+/*
+ * BLOCKS
+ */
+
+/*
+ * Allocate a block with n characters
+ */
+static smt2_token_block_t *new_token_block(uint32_t n) {
+  smt2_token_block_t *b;
+
+  b = (smt2_token_block_t *) safe_malloc(sizeof(smt2_token_block_t) + SMT2_PIPELINE_BLOCK_SIZE * sizeof(smt2_ptoken_t));
+  b->next = NULL;
+  b->ntokens = 0;
+  b->published = 0;
+  b->closed = false;
+  b->nchars = 0;
+  b->csize = n;
+  b->chars = (char *) safe_malloc(n);
+
+  return b;
+}
+
+static void free_token_block(smt2_token_block_t *b) {
+  safe_free(b->chars);
+  safe_free(b);
+}
+
+static void free_token_block_list(smt2_token_block_t *b) {
+  smt2_token_block_t *next;
+
+  while (b != NULL) {
+    next = b->next;
+    free_token_block(b);
+    b = next;
+  }
+}
+
+/*
+ * Make room for n characters in block b:
+ * - the chars array can be reallocated only if b is empty
+ *   (otherwise the parser may be reading it)
+ */
+static void token_block_reserve_chars(smt2_token_block_t *b, uint32_t n) {
+  uint32_t size;
+
+  assert(b->ntokens == 0 || b->nchars + n <= b->csize);
+
+  size = b->csize;
+  if (b->nchars + n > size) {
+    while (b->nchars + n > size) {
+      size += size >> 1;
+      if (size < SMT2_PIPELINE_CHARS_SIZE) {
+        size = SMT2_PIPELINE_CHARS_SIZE;
+      }
+    }
+    b->chars = (char *) safe_realloc(b->chars, size);
+    b->csize = size;
+  }
+}
+
+
+
+/*
+ * LEXER THREAD
+ */
+
+/*
+ * Make the tokens of the current block visible to the parser
+ * - must be called with the mutex held
+ */
+static void publish_tokens(smt2_pipeline_t *pipe) {
+  pipe->tail->published = pipe->tail->ntokens;
+  if (pipe->parser_waiting) {
+    check_thread_api(pthread_cond_signal(&pipe->tokens_available), "smt2_pipeline: pthread_cond_signal");
+  }
+}
+
+/*
+ * Close the current block and add a new block to the queue
+ * - wait if the queue is full
+ * - return false if the pipeline is stopped
+ */
+static bool next_token_block(smt2_pipeline_t *pipe) {
+  smt2_token_block_t *b;
+
+  check_thread_api(pthread_mutex_lock(&pipe->mutex), "smt2_pipeline: pthread_mutex_lock");
+  publish_tokens(pipe);
+  while (pipe->nblocks >= SMT2_PIPELINE_MAX_BLOCKS && !pipe->stop) {
+    pipe->lexer_waiting = true;
+    check_thread_api(pthread_cond_wait(&pipe->room_available, &pipe->mutex), "smt2_pipeline: pthread_cond_wait");
+    pipe->lexer_waiting = false;
+  }
+  if (pipe->stop) {
+    check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+    return false;
+  }
+
+  b = pipe->free_list;
+  if (b != NULL) {
+    pipe->free_list = b->next;
+    b->next = NULL;
+    b->ntokens = 0;
+    b->published = 0;
+    b->closed = false;
+    b->nchars = 0;
+  } else {
+    b = new_token_block(SMT2_PIPELINE_CHARS_SIZE);
+  }
+  pipe->nblocks ++;
+
+  pipe->tail->closed = true;
+  pipe->tail->next = b;
+  pipe->tail = b;
+  check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+
+  return true;
+}
+
+/*
+ * Store the current token of the source lexer in the queue
+ * - return false if the pipeline is stopped
+ */
+static bool store_token(smt2_pipeline_t *pipe, smt2_token_t tk) {
+  lexer_t *lex;
+  smt2_token_block_t *b;
+  smt2_ptoken_t *p;
+  uint32_t len;
+
+  lex = &pipe->source;
+  len = current_token_length(lex);
+
+  b = pipe->tail;
+  if (b->ntokens == SMT2_PIPELINE_BLOCK_SIZE ||
+      (b->nchars + len + 1 > b->csize && b->ntokens > 0)) {
+    if (! next_token_block(pipe)) return false;
+    b = pipe->tail;
+  }
+  token_block_reserve_chars(b, len + 1);
+
+  p = b->token + b->ntokens;
+  p->tk = tk;
+  p->tk_pos = current_token_pos(lex);
+  p->tk_line = current_token_line(lex);
+  p->tk_column = current_token_column(lex);
+  p->line = reader_line(&lex->reader);
+  p->column = reader_column(&lex->reader);
+  p->start = b->nchars;
+  p->len = len;
+  memcpy(b->chars + b->nchars, current_token_value(lex), len);
+  b->chars[b->nchars + len] = '\0';
+  b->nchars += len + 1;
+  b->ntokens ++;
+
+  // publish by chunks so that the parser can start on long commands
+  if (b->ntokens - b->published >= SMT2_PIPELINE_CHUNK_SIZE) {
+    check_thread_api(pthread_mutex_lock(&pipe->mutex), "smt2_pipeline: pthread_mutex_lock");
+    publish_tokens(pipe);
+    check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+  }
+
+  return true;
+}
+
+/*
+ * End of a command: publish the tokens
+ * - if barrier is true, wait until the parser has read all the tokens
+ * - return false if the pipeline is stopped
+ */
+static bool end_command(smt2_pipeline_t *pipe, bool barrier) {
+  bool go_on;
+
+  check_thread_api(pthread_mutex_lock(&pipe->mutex), "smt2_pipeline: pthread_mutex_lock");
+  publish_tokens(pipe);
+  if (barrier) {
+    pipe->barrier = true;
+    while (pipe->barrier && !pipe->stop) {
+      pipe->lexer_waiting = true;
+      check_thread_api(pthread_cond_wait(&pipe->room_available, &pipe->mutex), "smt2_pipeline: pthread_cond_wait");
+      pipe->lexer_waiting = false;
+    }
+  }
+  go_on = !pipe->stop;
+  check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+
+  return go_on;
+}
+
+
+/*
+ * Command states: to detect (exit) and (set-info :smt-lib-version ...)
+ */
+typedef enum {
+  CMD_START,       // before the command
+  CMD_OPEN,        // after '('
+  CMD_SET_INFO,    // after '(set-info'
+  CMD_VERSION,     // after '(set-info :smt-lib-version'
+  CMD_EXIT,        // after '(exit'
+  CMD_OTHER,       // anything else
+} cmd_state_t;
+
+static yices_thread_result_t YICES_THREAD_ATTR smt2_lexer_thread(void *arg) {
+  smt2_pipeline_t *pipe;
+  lexer_t *lex;
+  smt2_token_t tk;
+  cmd_state_t state;
+  uint32_t depth;
+  sigset_t signals;
+
+  pipe = arg;
+  lex = &pipe->source;
+
+  // signals are handled by the main thread
+  sigfillset(&signals);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+  depth = 0;
+  state = CMD_START;
+  for (;;) {
+    tk = next_smt2_token(lex);
+    if (! store_token(pipe, tk)) break;
+
+    switch (tk) {
+    case SMT2_TK_LP:
+      depth ++;
+      state = (state == CMD_START) ? CMD_OPEN : CMD_OTHER;
+      break;
+
+    case SMT2_TK_RP:
+      if (depth > 0) depth --;
+      break;
+
+    case SMT2_TK_SET_INFO:
+      state = (state == CMD_OPEN) ? CMD_SET_INFO : CMD_OTHER;
+      break;
+
+    case SMT2_TK_EXIT:
+      state = (state == CMD_OPEN) ? CMD_EXIT : CMD_OTHER;
+      break;
+
+    case SMT2_TK_KEYWORD:
+      if (state == CMD_SET_INFO &&
+          smt2_string_to_keyword(current_token_value(lex), current_token_length(lex)) == SMT2_KW_SMT_LIB_VERSION) {
+        state = CMD_VERSION;
+      } else if (state != CMD_VERSION) {
+        state = CMD_OTHER;
+      }
+      break;
+
+    default:
+      if (state != CMD_VERSION) {
+        state = CMD_OTHER;
+      }
+      break;
+    }
+
+    if (tk == SMT2_TK_EOS) {
+      end_command(pipe, false);
+      break;
+    }
+
+    if (depth == 0) {
+      if (state == CMD_EXIT) {
+        // nothing is read after (exit): the parser gets end-of-stream
+        if (store_token(pipe, SMT2_TK_EOS)) {
+          end_command(pipe, false);
+        }
+        break;
+      }
+      if (! end_command(pipe, state == CMD_VERSION)) break;
+      state = CMD_START;
+    }
+  }
+
+  return yices_thread_exit();
+}
+
+
+
+/*
+ * START/STOP
+ */
+
+bool start_smt2_pipeline(smt2_pipeline_t *pipe, lexer_t *lex) {
+  smt2_token_block_t *b;
+
+  assert(lex->next == NULL);
+
+  if (! reader_is_mapped(&lex->reader)) {
+    return false;
+  }
+
+  // the lexer thread uses a copy of lex with its own buffer
+  pipe->lex = lex;
+  pipe->source = *lex;
+  pipe->source.buffer = (string_buffer_t *) safe_malloc(sizeof(string_buffer_t));
+  init_string_buffer(pipe->source.buffer, 128);
+
+  b = new_token_block(SMT2_PIPELINE_CHARS_SIZE);
+  pipe->head = b;
+  pipe->index = 0;
+  pipe->avail = 0;
+  pipe->tail = b;
+  pipe->free_list = NULL;
+  pipe->nblocks = 1;
+  pipe->eos = false;
+  pipe->parser_waiting = false;
+  pipe->lexer_waiting = false;
+  pipe->barrier = false;
+  pipe->stop = false;
+
+  check_thread_api(pthread_mutex_init(&pipe->mutex, NULL), "smt2_pipeline: pthread_mutex_init");
+  check_thread_api(pthread_cond_init(&pipe->tokens_available, NULL), "smt2_pipeline: pthread_cond_init");
+  check_thread_api(pthread_cond_init(&pipe->room_available, NULL), "smt2_pipeline: pthread_cond_init");
+  check_thread_api(pthread_create(&pipe->thread, NULL, smt2_lexer_thread, pipe), "smt2_pipeline: pthread_create");
+
+  return true;
+}
+
+
+void stop_smt2_pipeline(smt2_pipeline_t *pipe) {
+  lexer_t *lex;
+
+  check_thread_api(pthread_mutex_lock(&pipe->mutex), "smt2_pipeline: pthread_mutex_lock");
+  pipe->stop = true;
+  if (pipe->lexer_waiting) {
+    check_thread_api(pthread_cond_signal(&pipe->room_available), "smt2_pipeline: pthread_cond_signal");
+  }
+  check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+  check_thread_api(pthread_join(pipe->thread, NULL), "smt2_pipeline: pthread_join");
+
+  check_thread_api(pthread_cond_destroy(&pipe->room_available), "smt2_pipeline: pthread_cond_destroy");
+  check_thread_api(pthread_cond_destroy(&pipe->tokens_available), "smt2_pipeline: pthread_cond_destroy");
+  check_thread_api(pthread_mutex_destroy(&pipe->mutex), "smt2_pipeline: pthread_mutex_destroy");
+
+  free_token_block_list(pipe->head);
+  free_token_block_list(pipe->free_list);
+  pipe->head = NULL;
+  pipe->tail = NULL;
+  pipe->free_list = NULL;
+
+  // give the reader back
+  lex = pipe->lex;
+  lex->reader = pipe->source.reader;
+  delete_string_buffer(pipe->source.buffer);
+  safe_free(pipe->source.buffer);
+  pipe->source.buffer = NULL;
+}
+
+
+
+/*
+ * PARSER SIDE
+ */
+
+/*
+ * Wait until head contains a token that can be read
+ * - release the blocks that have been read
+ */
+static void wait_for_token(smt2_pipeline_t *pipe) {
+  smt2_token_block_t *b;
+
+  check_thread_api(pthread_mutex_lock(&pipe->mutex), "smt2_pipeline: pthread_mutex_lock");
+  for (;;) {
+    b = pipe->head;
+    if (pipe->index < b->published) {
+      pipe->avail = b->published;
+      break;
+    }
+
+    if (b->closed) {
+      // all tokens of b have been read
+      assert(b->next != NULL);
+      pipe->head = b->next;
+      pipe->index = 0;
+      pipe->avail = 0;
+      b->next = pipe->free_list;
+      pipe->free_list = b;
+      pipe->nblocks --;
+      if (pipe->lexer_waiting) {
+        check_thread_api(pthread_cond_signal(&pipe->room_available), "smt2_pipeline: pthread_cond_signal");
+      }
+      continue;
+    }
+
+    if (pipe->barrier) {
+      // the last command has been processed
+      pipe->barrier = false;
+      check_thread_api(pthread_cond_signal(&pipe->room_available), "smt2_pipeline: pthread_cond_signal");
+    }
+
+    pipe->parser_waiting = true;
+    check_thread_api(pthread_cond_wait(&pipe->tokens_available, &pipe->mutex), "smt2_pipeline: pthread_cond_wait");
+    pipe->parser_waiting = false;
+  }
+  check_thread_api(pthread_mutex_unlock(&pipe->mutex), "smt2_pipeline: pthread_mutex_unlock");
+}
+
+smt2_token_t smt2_pipeline_next_token(smt2_pipeline_t *pipe) {
+  lexer_t *lex;
+  smt2_token_block_t *b;
+  smt2_ptoken_t *p;
+
+  lex = pipe->lex;
+  if (pipe->eos) {
+    // the lexer keeps returning end-of-stream
+    return lex->token;
+  }
+
+  if (pipe->index >= pipe->avail) {
+    wait_for_token(pipe);
+  }
+
+  b = pipe->head;
+  p = b->token + pipe->index;
+  pipe->index ++;
+
+  lex->token = p->tk;
+  lex->tk_pos = p->tk_pos;
+  lex->tk_line = p->tk_line;
+  lex->tk_column = p->tk_column;
+  lex->reader.line = p->line;
+  lex->reader.column = p->column;
+  string_buffer_reset(lex->buffer);
+  string_buffer_append_chars(lex->buffer, b->chars + p->start, p->len);
+  string_buffer_close(lex->buffer);
+
+  if (p->tk == SMT2_TK_EOS) {
+    pipe->eos = true;
+  }
+
+  return p->tk;
+}
+
+
+#else
+
+/*
+ * NO THREADS: pipelining is not supported
+ */
+bool start_smt2_pipeline(smt2_pipeline_t *pipe, lexer_t *lex) {
+  return false;
+}
+
+void stop_smt2_pipeline(smt2_pipeline_t *pipe) {
+  assert(false);
+}
+
+smt2_token_t smt2_pipeline_next_token(smt2_pipeline_t *pipe) {
+  assert(false);
+  return next_smt2_token(pipe->lex);
+}
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PIPELINED LEXER FOR SMT2
+ *
+ * In pipelined mode, a separate thread reads the input and splits it
+ * into tokens while the main thread parses and executes the commands
+ * (including check-sat). The tokens are stored in a bounded queue of
+ * blocks. The parser reads them from the queue in the same order as
+ * it would read them from the lexer, so the commands are executed in
+ * the same order and produce the same results.
+ *
+ * Only the lexing is done in advance: building terms and executing
+ * commands depend on the declarations and on the assertion stack,
+ * so they must be done by the main thread.
+ *
+ * The lexer thread stops after (exit) or at the end of the input.
+ * It also waits after (set-info :smt-lib-version ...) until the
+ * main thread has processed that command, since the version changes
+ * how strings are read.
+ *
+ * Tokens are published (made visible to the parser) by chunks of
+ * SMT2_PIPELINE_CHUNK_SIZE tokens, at the end of each block, and at
+ * the end of each command. So the parser can start on a long command
+ * before the lexer thread has reached its end.
+ *
+ * The pipeline is used only if the input is a memory-mapped file so
+ * that the lexer thread never blocks on a read. It also requires
+ * threads (i.e., compilation in THREAD_SAFE mode on a POSIX system).
+ * There's nothing to gain on a single processor, and the gain depends
+ * on how much of the run time is spent in the lexer, so yices_smt2
+ * uses the pipeline only if option --pipeline is given.
+ */
+
+#ifndef __SMT2_PIPELINE_H
+#define __SMT2_PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <pthread.h>
+#endif
+
+#include "frontend/smt2/smt2_lexer.h"
+
+
+/*
+ * Token record:
+ * - tk = token code
+ * - tk_pos, tk_line, tk_column = start of the token
+ * - line, column = reader position after the token (used in
+ *   error messages)
+ * - the token value is chars[start ... start + len - 1] in the block
+ */
+typedef struct smt2_ptoken_s {
+  smt2_token_t tk;
+  uint32_t tk_line;
+  uint32_t tk_column;
+  uint32_t line;
+  uint32_t column;
+  uint32_t start;
+  uint32_t len;
+  uint64_t tk_pos;
+} smt2_ptoken_t;
+
+
+/*
+ * Block of tokens:
+ * - next = next block in the queue
+ * - ntokens = number of tokens stored in the block
+ * - published = number of tokens visible to the parser
+ * - closed = true if no more tokens will be added to this block
+ * - chars = token values, nchars = number of characters used,
+ *   csize = size of the chars array
+ * - token = array of SMT2_PIPELINE_BLOCK_SIZE token records
+ *
+ * ntokens, nchars and the tokens are written by the lexer thread only.
+ * The parser reads them after they are published.
+ */
+typedef struct smt2_token_block_s smt2_token_block_t;
+
+struct smt2_token_block_s {
+  smt2_token_block_t *next;
+  uint32_t ntokens;
+  uint32_t published;
+  bool closed;
+  uint32_t nchars;
+  uint32_t csize;
+  char *chars;
+  smt2_ptoken_t token[0]; // real size = SMT2_PIPELINE_BLOCK_SIZE
+};
+
+#define SMT2_PIPELINE_BLOCK_SIZE 4096
+#define SMT2_PIPELINE_CHUNK_SIZE 256
+#define SMT2_PIPELINE_CHARS_SIZE 65536
+
+// maximal number of blocks in the queue
+#define SMT2_PIPELINE_MAX_BLOCKS 16
+
+
+/*
+ * Pipeline:
+ * - lex = lexer used by the parser: its reader is moved to source
+ *   and the tokens are copied into lex from the queue
+ * - source = lexer used by the lexer thread
+ * - head = block being read by the parser, index = index of the
+ *   next token to read in head, avail = number of tokens of head
+ *   known to be published
+ * - tail = block being filled by the lexer thread
+ * - free_list = blocks that can be reused
+ * - nblocks = number of blocks in the queue
+ * - eos = true once the parser has read the end-of-stream token
+ *
+ * Synchronization:
+ * - mutex protects the published and closed fields of all blocks,
+ *   the links between blocks, free_list, nblocks, and the fields below
+ * - tokens_available is signaled when tokens are published
+ * - room_available is signaled when a block is released, when the
+ *   barrier is cleared, or when the pipeline is stopped
+ * - parser_waiting = true if the parser is waiting for tokens
+ * - lexer_waiting = true if the lexer thread is waiting
+ * - barrier = true if the lexer thread waits for the parser to
+ *   process the last command
+ * - stop = true if the lexer thread must stop
+ */
+typedef struct smt2_pipeline_s {
+  lexer_t *lex;
+  lexer_t source;
+  smt2_token_block_t *head;
+  uint32_t index;
+  uint32_t avail;
+  smt2_token_block_t *tail;
+  smt2_token_block_t *free_list;
+  uint32_t nblocks;
+  bool eos;
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t tokens_available;
+  pthread_cond_t room_available;
+#endif
+  bool parser_waiting;
+  bool lexer_waiting;
+  bool barrier;
+  bool stop;
+} smt2_pipeline_t;
+
+
+/*
+ * Start the lexer thread for lex
+ * - lex must be a top-level SMT2 lexer, initialized and not used yet.
+ * - return false if pipelining is not supported for lex. Nothing is
+ *   changed in this case.
+ * - return true otherwise: the tokens for lex must then be obtained
+ *   by calling smt2_pipeline_next_token.
+ */
+extern bool start_smt2_pipeline(smt2_pipeline_t *pipe, lexer_t *lex);
+
+/*
+ * Stop the lexer thread and free the queue
+ * - the reader is given back to the parser's lexer so that it can
+ *   be closed normally.
+ */
+extern void stop_smt2_pipeline(smt2_pipeline_t *pipe);
+
+/*
+ * Read the next token: wait for the lexer thread if the queue is empty.
+ * - the token, its position and its value are copied in pipe->lex,
+ *   as if next_smt2_token(pipe->lex) had been called.
+ */
+extern smt2_token_t smt2_pipeline_next_token(smt2_pipeline_t *pipe);
+
+
+#endif /* __SMT2_PIPELINE_H */
@@ -1622,11 +1622,86 @@ static const help_record_t help_data[] = {
     "whose values matter for satisfying the assertions.\n",
     NULL, },
 
-  // END MARKER: index 162
+  // simplex-float: index 163
+  { HPARAM,
+    "(set-param simplex-float [boolean])",
+    "Enable/disable the floating-point phase in the Simplex solver",
+    "If 'simplex-float' is true, the Simplex solver first searches for a\n"
+    "feasible basis using a floating-point copy of the tableau when many\n"
+    "variables are out of bounds. The basis found is then installed in the\n"
+    "exact tableau and checked with rational arithmetic, so this does not\n"
+    "affect soundness. It may reduce the number of exact pivots on large\n"
+    "linear problems.\n",
+    NULL },
+
+  // inprocessing: index 164
+  { HPARAM,
+    "(set-param inprocessing [boolean])",
+    "Enable/disable inprocessing of the learned clauses",
+    "If 'inprocessing' is true, the SAT solver periodically simplifies the\n"
+    "learned clauses at decision level 0. Learned clauses subsumed by other\n"
+    "clauses are removed and learned clauses are shortened by vivification.\n"
+    "The problem clauses are not modified.\n",
+    NULL },
+
+  // chrono-levels: index 165
+  { HPARAM,
+    "(set-param chrono-levels [integer])",
+    "Control chronological backtracking",
+    "If 'chrono-levels' is positive, the solver does not backjump after a\n"
+    "conflict if that would undo more than 'chrono-levels' decision levels.\n"
+    "Instead, it backtracks by one level and assigns the learned literal out\n"
+    "of order. This avoids redoing many propagations when the backjump is\n"
+    "long. Default: 0 (chronological backtracking is disabled).\n",
+    NULL },
+
+  // bv-lazy-blast: index 166
+  { HPARAM,
+    "(set-param bv-lazy-blast [boolean])",
+    "Enable/disable lazy bit-blasting of multiplications and divisions",
+    "If 'bv-lazy-blast' is true, the bitvector solver does not bit-blast\n"
+    "wide multiplications, divisions, and remainders upfront. They are\n"
+    "first treated as fresh variables constrained by a few cheap axioms.\n"
+    "An operation is bit-blasted only if the final assignment is not\n"
+    "consistent with its definition.\n",
+    NULL },
+
+  // eager-array-lemmas: index 167
+  { HPARAM,
+    "(set-param eager-array-lemmas [boolean])",
+    "Enable/disable eager generation of array update axioms",
+    "If 'eager-array-lemmas' is true, the array solver searches for\n"
+    "update conflicts during propagation and not only in final check.\n"
+    "Conflicts between reads of arrays connected by updates that don't\n"
+    "modify the index being read are then detected earlier.\n"
+    "Default: false.\n",
+    NULL },
+
+  // ef-cex-workers: index 168
+  { HPARAM,
+    "(set-param ef-cex-workers [integer])",
+    "Set the number of threads used to check the universal constraints",
+    "The ef-solver tests each candidate model against all the universal\n"
+    "constraints. If 'ef-cex-workers' is more than 1, these checks run\n"
+    "in parallel in that many threads, with one context per constraint.\n"
+    "The first counterexample found is used and the other checks are\n"
+    "cancelled. Default: 1 (the constraints are checked one by one).\n",
+    NULL },
+
+  // isdl-prop: index 169
+  { HPARAM,
+    "(set-param isdl-prop [boolean])",
+    "Enable/disable theory propagation in the sparse IDL solver",
+    "The sparse IDL solver is used for large integer difference logic\n"
+    "problems. If 'isdl-prop' is true, this solver propagates the\n"
+    "difference atoms implied by new edges. Default: false.\n",
+    NULL },
+
+  // END MARKER: index 170
   { HMISC, NULL, NULL, NULL, NULL },
 };
 
-#define END_HELP_DATA 163
+#define END_HELP_DATA 171
 
 
 
@@ -2002,6 +2077,7 @@ static const help_index_t help_index[] = {
   { "bv-extract", NULL, 81, help_basic },
   { "bv-ge", NULL, 94, help_basic },
   { "bv-gt", NULL, 95, help_basic },
+  { "bv-lazy-blast", NULL, 166, help_basic },
   { "bv-le", NULL, 96, help_basic },
   { "bv-lt", NULL, 97, help_basic },
   { "bv-lshr", NULL, 79, help_basic },
@@ -2042,6 +2118,7 @@ static const help_index_t help_index[] = {
   { "ceil", NULL, 154, help_basic },
   { "check", NULL, 6, help_basic },
   { "check-assuming", NULL, 159, help_basic },
+  { "chrono-levels", NULL, 165, help_basic },
   { "clause-decay", NULL, 119, help_basic },
   { "commands", "Command Summary", HCOMMAND, help_for_category },
   { "d-factor", NULL, 111, help_basic },
@@ -2055,8 +2132,10 @@ static const help_index_t help_index[] = {
   { "dyn-ack-threshold", NULL, 128, help_basic },
   { "dyn-bool-ack", NULL, 123, help_basic },
   { "dyn-bool-ack-threshold", NULL, 129, help_basic },
+  { "eager-array-lemmas", NULL, 167, help_basic },
   { "eager-lemmas", NULL, 131, help_basic },
   { "echo", NULL, 13, help_basic },
+  { "ef-cex-workers", NULL, 168, help_basic },
   { "ef-flatten-iff", NULL, 147, help_basic },
   { "ef-flatten-ite", NULL, 148, help_basic },
   { "ef-gen-mode", NULL, 149, help_basic },
@@ -2074,11 +2153,13 @@ static const help_index_t help_index[] = {
   { "help", "Show help", 21, help_variant },
   { "icheck", NULL, 136, help_basic },
   { "icheck-period", NULL, 137, help_basic },
+  { "inprocessing", NULL, 164, help_basic },
   { "if", NULL, 32, help_basic },
   { "include", NULL, 12, help_basic },
   { "index", index_string, 0, help_special },
   { "int", NULL, 25, help_basic },
   { "is-int", NULL, 158, help_basic },
+  { "isdl-prop", NULL, 169, help_basic },
   { "ite", NULL, 31, help_basic },
   { "keep-ite", NULL, 106, help_basic },
   { "learn-eq", NULL, 105, help_basic },
@@ -2119,6 +2200,7 @@ static const help_index_t help_index[] = {
   { "show-unsat-assumptions", NULL, 161, help_basic },
   { "show-unsat-core", NULL, 160, help_basic },
   { "simplex-adjust", NULL, 134, help_basic },
+  { "simplex-float", NULL, 163, help_basic },
   { "simplex-prop", NULL, 132, help_basic },
   { "syntax", syntax_summary, 0, help_special },
   { "tclause-size", NULL, 121, help_basic },
@@ -517,9 +517,8 @@ yices_token_t next_yices_token(lexer_t *lex) {
   for (;;) {
     while (isspace(c)) c = reader_next_char(rd);
     if (c != ';') break;
-    do { // read to end-of-line or eof
-      c = reader_next_char(rd);
-    } while (c != '\n' && c != EOF);
+    // read to end-of-line or eof
+    c = reader_skip_to_eol(rd);
   }
 
   // record token position (start of token)
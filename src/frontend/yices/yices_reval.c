@@ -1320,6 +1320,14 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], parameters.tclause_size, n);
     break;
 
+  case PARAM_INPROCESSING:
+    show_bool_param(param2string[p], parameters.inprocessing, n);
+    break;
+
+  case PARAM_CHRONO_LEVELS:
+    show_pos32_param(param2string[p], parameters.chrono_levels, n);
+    break;
+
   case PARAM_DYN_ACK:
     show_bool_param(param2string[p], parameters.use_dyn_ack, n);
     break;
@@ -1372,6 +1380,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_bool_param(param2string[p], parameters.adjust_simplex_model, n);
     break;
 
+  case PARAM_SIMPLEX_FLOAT:
+    show_bool_param(param2string[p], parameters.simplex_float_first, n);
+    break;
+
   case PARAM_PROP_THRESHOLD:
     show_pos32_param(param2string[p], parameters.max_prop_row_size, n);
     break;
@@ -1388,6 +1400,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], parameters.integer_check_period, n);
     break;
 
+  case PARAM_ISDL_PROP:
+    show_bool_param(param2string[p], parameters.isdl_prop, n);
+    break;
+
   case PARAM_MAX_UPDATE_CONFLICTS:
     show_pos32_param(param2string[p], parameters.max_update_conflicts, n);
     break;
@@ -1396,6 +1412,14 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], parameters.max_extensionality, n);
     break;
 
+  case PARAM_EAGER_ARRAY_LEMMAS:
+    show_bool_param(param2string[p], parameters.eager_array_lemmas, n);
+    break;
+
+  case PARAM_BV_LAZY_BLAST:
+    show_bool_param(param2string[p], parameters.bv_lazy_blast, n);
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     show_bool_param(param2string[p], ef_client_globals.ef_parameters.flatten_iff, n);
     break;
@@ -1420,6 +1444,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], ef_client_globals.ef_parameters.max_numlearnt_per_round, n);
     break;
 
+  case PARAM_EF_CEX_WORKERS:
+    show_pos32_param(param2string[p], ef_client_globals.ef_parameters.cex_workers, n);
+    break;
+
   case PARAM_EMATCH_EN:
     show_bool_param(param2string[p], ef_client_globals.ef_parameters.ematching, n);
     break;
@@ -1740,6 +1768,20 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_INPROCESSING:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.inprocessing = tt;
+      print_ok();
+    }
+    break;
+
+  case PARAM_CHRONO_LEVELS:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      parameters.chrono_levels = n;
+      print_ok();
+    }
+    break;
+
   case PARAM_DYN_ACK:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       parameters.use_dyn_ack = tt;
@@ -1838,6 +1880,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_SIMPLEX_FLOAT:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.simplex_float_first = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_PROP_THRESHOLD:
     if (param_val_to_nonneg32(param, val, &n, &reason)) {
       parameters.max_prop_row_size = n;
@@ -1873,6 +1922,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_ISDL_PROP:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.isdl_prop = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_MAX_UPDATE_CONFLICTS:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       parameters.max_update_conflicts = n;
@@ -1887,6 +1943,20 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_EAGER_ARRAY_LEMMAS:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.eager_array_lemmas = tt;
+      print_ok();
+    }
+    break;
+
+  case PARAM_BV_LAZY_BLAST:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.bv_lazy_blast = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       ef_client_globals.ef_parameters.flatten_iff = tt;
@@ -1929,6 +1999,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_EF_CEX_WORKERS:
+    if (param_val_to_pos32(param, val, &n, &reason)) {
+      ef_client_globals.ef_parameters.cex_workers = n;
+      print_ok();
+    }
+    break;
+
   case PARAM_EMATCH_EN:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       ef_client_globals.ef_parameters.ematching = tt;
@@ -2092,6 +2169,17 @@ static void show_stats(dpll_stats_t *stat) {
   printf(" restarts                : %"PRIu32"\n", stat->restarts);
   printf(" simplify db             : %"PRIu32"\n", stat->simplify_calls);
   printf(" reduce db               : %"PRIu32"\n", stat->reduce_calls);
+  if (stat->inprocess_calls > 0) {
+    printf(" inprocess db            : %"PRIu32"\n", stat->inprocess_calls);
+    printf(" subsumed clauses        : %"PRIu64"\n", stat->subsumed_clauses);
+    printf(" vivified clauses        : %"PRIu64"\n", stat->vivified_clauses);
+    printf(" vivified literals       : %"PRIu64"\n", stat->vivified_literals);
+  }
+  if (stat->chrono_backtracks > 0) {
+    printf(" chrono backtracks       : %"PRIu64"\n", stat->chrono_backtracks);
+    printf(" chrono saved literals   : %"PRIu64"\n", stat->chrono_saved);
+    printf(" chrono reassigned       : %"PRIu64"\n", stat->chrono_reassigned);
+  }
   printf(" decisions               : %"PRIu64"\n", stat->decisions);
   printf(" random decisions        : %"PRIu64"\n", stat->random_decisions);
   printf(" propagations            : %"PRIu64"\n", stat->propagations);
@@ -2129,6 +2217,10 @@ static void show_funsolver_stats(fun_solver_stats_t *stat) {
   printf(" update axiom1           : %"PRIu32"\n", stat->num_update_axiom1);
   printf(" update axiom2           : %"PRIu32"\n", stat->num_update_axiom2);
   printf(" extensionality axioms   : %"PRIu32"\n", stat->num_extensionality_axiom);
+  if (stat->num_eager_checks > 0) {
+    printf(" eager checks            : %"PRIu32"\n", stat->num_eager_checks);
+    printf(" eager update axioms     : %"PRIu32"\n", stat->num_eager_axiom2);
+  }
 }
 
 static void show_quantsolver_stats(quant_solver_stats_t *stat) {
@@ -2154,6 +2246,15 @@ static void show_simplex_stats(simplex_stats_t *stat) {
   printf(" calls to make_feasible  : %"PRIu32"\n", stat->num_make_feasible);
   printf(" pivots                  : %"PRIu32"\n", stat->num_pivots);
   printf(" bland-rule activations  : %"PRIu32"\n", stat->num_blands);
+  if (stat->num_float_checks > 0) {
+    printf(" float checks            : %"PRIu32"\n", stat->num_float_checks);
+    printf(" float pivots            : %"PRIu32"\n", stat->num_float_pivots);
+    printf(" float bases confirmed   : %"PRIu32"\n", stat->num_float_confirmed);
+    printf(" float failures          : %"PRIu32"\n", stat->num_float_failures);
+  }
+  if (stat->num_matrix_packs > 0) {
+    printf(" matrix packs            : %"PRIu32"\n", stat->num_matrix_packs);
+  }
   printf(" simple lemmas           : %"PRIu32"\n", stat->num_binary_lemmas);
   printf(" prop. to core           : %"PRIu32"\n", stat->num_props);
   printf(" derived bounds          : %"PRIu32"\n", stat->num_bound_props);
@@ -2194,6 +2295,10 @@ static void show_bvsolver_stats(bv_solver_t *solver) {
   printf(" sge atoms               : %"PRIu32"\n", bv_solver_num_sge_atoms(solver));
   printf(" equiv lemmas            : %"PRIu32"\n", solver->stats.equiv_lemmas);
   printf(" interface lemmas        : %"PRIu32"\n", solver->stats.interface_lemmas);
+  if (bv_solver_lazy_ops(solver) > 0) {
+    printf(" lazy operations         : %"PRIu32"\n", bv_solver_lazy_ops(solver));
+    printf(" lazy refinements        : %"PRIu32"\n", bv_solver_lazy_refinements(solver));
+  }
 }
 
 
@@ -37,6 +37,7 @@
 #include <math.h>
 
 #include "io/reader.h"
+#include "solvers/cdcl/cube_and_conquer.h"
 #include "solvers/cdcl/new_sat_solver.h"
 #include "utils/command_line.h"
 #include "utils/cputime.h"
@@ -401,6 +402,8 @@ static void check_model(const char *filename) {
  *   seed_value = value of the seed
  * - stats = true for printing statistics
  * - data = true for collecting data
+ * - threads = number of threads for cube and conquer (0 means sequential search)
+ * - cube_depth = lookahead depth for cube and conquer (0 means default)
  */
 static char *input_filename = NULL;
 static bool verbose;
@@ -411,6 +414,8 @@ static bool seed_given;
 static uint32_t seed_value;
 static bool stats;
 static bool data;
+static uint32_t threads;
+static uint32_t cube_depth;
 
 static bool var_decay_given;
 static bool clause_decay_given;
@@ -454,6 +459,8 @@ enum {
   preprocess_flag,
   seed_opt,
   stats_flag,
+  threads_opt,
+  cube_depth_opt,
 
   var_decay_opt,
   clause_decay_opt,
@@ -485,6 +492,8 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "preprocess", 'p', FLAG_OPTION, preprocess_flag },
   { "seed", 's', MANDATORY_INT, seed_opt },
   { "stats", '\0', FLAG_OPTION, stats_flag },
+  { "threads", '\0', MANDATORY_INT, threads_opt },
+  { "cube-depth", '\0', MANDATORY_INT, cube_depth_opt },
 
   { "var-decay", '\0', MANDATORY_FLOAT, var_decay_opt },
   { "clause-decay", '\0', MANDATORY_FLOAT, clause_decay_opt },
@@ -533,6 +542,7 @@ static void print_help(char *progname) {
 	 "   --preprocess, -p        Use preprocessing\n"
 	 "   --seed=<int>, -s <int>  Set the prng seed\n"
 	 "   --stats                 Print statistics at the end of the search\n"
+	 "   --threads=<int>         Use cube and conquer with this many threads\n"
 	 "   --data                  Store conflict data in 'xxxx.data'\n"
          "\n"
          "For bug reporting and other information, please see http://yices.csl.sri.com/\n");
@@ -559,6 +569,9 @@ static void print_parameters(char *progname) {
 	 "   --res-clause-limit=<integer>   Don't create clauses bigger than this during variable elimination\n"
 	 "   --res-extra=<integer>          Allow variable eliminations that incresae the number of clauses\n"
 	 "\n"
+	 "Cube and conquer\n"
+	 "   --cube-depth=<integer>          Number of branching variables per cube\n"
+	 "\n"
 	 "Simplification\n"
 	 "   --simplify-interval=<integer>   Number of conflicts between simplification\n"
 	 "   --simplify-bin-delta=<integer>  Number of new binary clauses between SCC computations\n"
@@ -596,6 +609,8 @@ static void parse_command_line(int argc, char *argv[]) {
   stats = false;
   preprocess = false;
   data = false;
+  threads = 0;
+  cube_depth = 0;
 
   var_decay_given = false;
   clause_decay_given = false;
@@ -670,6 +685,16 @@ static void parse_command_line(int argc, char *argv[]) {
 	stats = true;
 	break;
 
+      case threads_opt:
+	if (! validate_integer_option(&parser, &elem, 1, CUBE_MAX_WORKERS)) goto bad_usage;
+	threads = elem.i_value;
+	break;
+
+      case cube_depth_opt:
+	if (! validate_integer_option(&parser, &elem, 1, 30)) goto bad_usage;
+	cube_depth = elem.i_value;
+	break;
+
       case var_decay_opt:
 	// must be in [0.0, 1.1]
 	if (! validate_double_option(&parser, &elem, 0.0, false, 1.0, false)) goto bad_usage;
@@ -1137,7 +1162,11 @@ int main(int argc, char* argv[]) {
     if (data) {
       nsat_open_datafile(&solver, "xxxx.data");
     }
-    (void) nsat_solve(&solver);
+    if (threads > 0) {
+      (void) nsat_cube_and_conquer(&solver, threads, cube_depth);
+    } else {
+      (void) nsat_solve(&solver);
+    }
     print_results();
     if (model) {
       print_model();
@@ -1131,6 +1131,12 @@ static void show_quantsolver_stats(quant_solver_stats_t *stat) {
   printf(" quantifiers             : %"PRIu32"\n", stat->num_quantifiers);
   printf(" patterns                : %"PRIu32"\n", stat->num_patterns);
   printf(" instances               : %"PRIu32"\n", stat->num_instances);
+  printf(" roots matched           : %"PRIu32"\n", stat->num_roots_matched);
+  printf(" roots skipped           : %"PRIu32"\n", stat->num_roots_skipped);
+  printf(" matching time           : %.4f s\n", stat->ematch_time);
+  if (stat->ematch_time > 0) {
+    printf(" instances per second    : %.1f\n", stat->num_instances/stat->ematch_time);
+  }
 }
 
 /*
@@ -1305,6 +1311,8 @@ static void print_presearch_stats(void) {
     printf("arithmetic solver       : IDL Floyd-Warshall\n");
   } else if (context_has_rdl_solver(&context)) {
     printf("arithmetic solver       : RDL Floyd-Warshall\n");
+  } else if (context_has_isdl_solver(&context)) {
+    printf("arithmetic solver       : IDL Sparse Graph\n");
   }
 
   printf("\n");
@@ -59,10 +59,13 @@
 #include <unistd.h>
 #endif
 
+#include "context/context_portfolio.h"
+#include "exists_forall/ef_parallel.h"
 #include "frontend/common/parameters.h"
 #include "frontend/smt2/smt2_commands.h"
 #include "frontend/smt2/smt2_lexer.h"
 #include "frontend/smt2/smt2_parser.h"
+#include "frontend/smt2/smt2_pipeline.h"
 #include "frontend/smt2/smt2_term_stack.h"
 #include "io/simple_printf.h"
 #include "solvers/cdcl/delegate.h"
@@ -87,12 +90,15 @@ extern const char * const yices_rev;
  * - interactive: set option :print-success to true.
  *   and  print a prompt before parsing commands if stdin is a terminal.
  * - timeout: command-line option
+ * - use_pipeline: if true, the input is read and split into tokens
+ *   by a separate thread (cf. smt2_pipeline.h)
  *
  * - filename = name of the input file (NULL means read stdin)
  */
 static lexer_t lexer;
 static parser_t parser;
 static tstack_t stack;
+static smt2_pipeline_t pipeline;
 
 static bool incremental;
 static bool interactive;
@@ -100,11 +106,14 @@ static bool smt2_model_format;
 static bool dump_models;
 static bool bvdecimal;
 static bool show_stats;
+static bool use_pipeline;
 static int32_t verbosity;
 static uint32_t timeout;
 static char *filename;
 static char *delegate;
 static char *dimacsfile;
+static char *save_snapshot_file;
+static char *load_snapshot_file;
 
 // mcsat options
 static bool mcsat;
@@ -123,6 +132,7 @@ static pvector_t trace_tags;
 static bool ef_en_ematch;
 static int32_t ef_mbqi_max_iter;
 static int32_t ef_mbqi_max_lemma_per_round;
+static int32_t ef_mbqi_workers;
 
 static int32_t ef_ematch_inst_per_round;
 static int32_t ef_ematch_inst_per_search;
@@ -144,6 +154,8 @@ static int32_t ef_ematch_cnstr_mode;
 static int32_t ef_ematch_term_mode;
 
 static uint32_t nthreads;
+static uint32_t portfolio;
+static uint32_t sls_moves;
 
 /****************************
  *  COMMAND-LINE ARGUMENTS  *
@@ -177,6 +189,7 @@ typedef enum optid {
   ematch_en_opt,                    // enable ematching
   mbqi_max_iter_opt,                // set max mbqi iterations
   mbqi_lemmas_per_round_opt,        // set max mbqi lemmas per round
+  mbqi_workers_opt,                 // number of threads for the mbqi counterexample search
   ematch_inst_per_round_opt,        // set max ematch instances per round
   ematch_inst_per_search_opt,       // set max ematch instances per search
   ematch_inst_total_opt,            // set max ematch instances
@@ -193,9 +206,14 @@ typedef enum optid {
   ematch_cnstr_mode_opt,            // set cnstr mode in ematching
   ematch_term_mode_opt,             // set term mode in ematching
   nthreads_opt,                     // number of threads
+  portfolio_opt,                    // number of workers for portfolio check
+  save_snapshot_opt,                // save the assertions to a snapshot file
+  load_snapshot_opt,                // restore assertions from a snapshot file
+  sls_moves_opt,                    // budget for local search
+  pipeline_opt,                     // read the input in a separate thread
 } optid_t;
 
-#define NUM_OPTIONS (nthreads_opt+1)
+#define NUM_OPTIONS (pipeline_opt+1)
 
 /*
  * Option descriptors
@@ -228,6 +246,7 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "ematch", '\0', FLAG_OPTION, ematch_en_opt },
   { "mbqi-max-iter", '\0', MANDATORY_INT, mbqi_max_iter_opt },
   { "mbqi-lemmas-per-round", '\0', MANDATORY_INT, mbqi_lemmas_per_round_opt },
+  { "mbqi-workers", '\0', MANDATORY_INT, mbqi_workers_opt },
   { "ematch-inst-per-round", '\0', MANDATORY_INT, ematch_inst_per_round_opt },
   { "ematch-inst-per-search", '\0', MANDATORY_INT, ematch_inst_per_search_opt },
   { "ematch-inst-total", '\0', MANDATORY_INT, ematch_inst_total_opt },
@@ -243,7 +262,12 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "ematch-term-alpha", '\0', MANDATORY_FLOAT, ematch_term_alpha_opt },
   { "ematch-cnstr-mode", '\0', MANDATORY_STRING, ematch_cnstr_mode_opt },
   { "ematch-term-mode", '\0', MANDATORY_STRING, ematch_term_mode_opt },
-  { "nthreads", 'n', MANDATORY_INT, nthreads_opt }
+  { "nthreads", 'n', MANDATORY_INT, nthreads_opt },
+  { "portfolio", '\0', MANDATORY_INT, portfolio_opt },
+  { "save-snapshot", '\0', MANDATORY_STRING, save_snapshot_opt },
+  { "load-snapshot", '\0', MANDATORY_STRING, load_snapshot_opt },
+  { "sls-moves", '\0', MANDATORY_INT, sls_moves_opt },
+  { "pipeline", '\0', FLAG_OPTION, pipeline_opt },
 };
 
 
@@ -279,13 +303,19 @@ static void print_help(const char *progname) {
          "    --yices-model-format      Display models in the Yices model format (default = false)\n"
          "    --dump-models             Display models on sat result (default = false)\n"
          "    --bvconst-in-decimal      Display bit-vector constants as decimal numbers (default = false)\n"
-         "    --delegate=<satsolver>    Use an external SAT solver (can be cadical, cryptominisat, kissat, or y2sat)\n"
+         "    --delegate=<satsolver>    Use an external SAT solver (can be cadical, cryptominisat, kissat, y2sat, or y2sat-cubes)\n"
          "    --dimacs=<filename>       Bitblast and export to a file (in DIMACS format)\n"
          "    --mcsat                   Use the MCSat solver\n"
          "    --mcsat-help              Show the MCSat options\n"
          "    --ef-help                 Show the EF options\n"
 	 "    --nthreads=<number of threads>  Specify the number of threads (default = 0 = main thread only)\n"
 	 "    -n <number of threads>\n"
+         "    --portfolio=<workers>     Race several solver configurations in parallel (default = 1)\n"
+         "                              (threads for CDCL(T), one child process per worker for MCSat)\n"
+         "    --save-snapshot=<filename>  Save the assertions to a snapshot file on (check-sat)\n"
+         "    --load-snapshot=<filename>  Add the assertions stored in a snapshot file after (set-logic)\n"
+         "    --sls-moves=<moves>       Try local search before bit-blasting (default = 0 = no local search)\n"
+         "    --pipeline                Read the next commands in a separate thread\n"
          "\n"
          "For bug reports and other information, please see http://yices.csl.sri.com/\n");
   fflush(stdout);
@@ -325,6 +355,7 @@ static void print_ef_help(const char *progname) {
   printf("   (mbqi)\n");
   printf("    --mbqi-max-iter=<M>             Set the max number of mbqi iterations (default: %d)\n", DEF_MBQI_MAX_ITERS);
   printf("    --mbqi-lemmas-per-round=<M>     Set the max number of lemmas per mbqi round (default: %d)\n", DEF_MBQI_MAX_LEMMAS_PER_ROUND);
+  printf("    --mbqi-workers=<M>              Set the number of threads checking the universal constraints (default: %d)\n", DEF_EF_CEX_WORKERS);
   printf("   (ematch)\n");
   printf("    --ematch-inst-per-round=<M>     Set the max number of instances per ematch round (default: %d)\n", DEFAULT_MAX_INSTANCES_PER_ROUND);
   printf("    --ematch-inst-per-search=<M>    Set the max number of instances per ematch seach (default: %d)\n", DEFAULT_MAX_INSTANCES_PER_SEARCH);
@@ -390,10 +421,13 @@ static void parse_command_line(int argc, char *argv[]) {
   dump_models = false;
   bvdecimal = false;
   show_stats = false;
+  use_pipeline = false;
   verbosity = 0;
   timeout = 0;
   delegate = NULL;
   dimacsfile = NULL;
+  save_snapshot_file = NULL;
+  load_snapshot_file = NULL;
 
   mcsat = false;
   mcsat_rand_dec_freq = -1;
@@ -410,6 +444,7 @@ static void parse_command_line(int argc, char *argv[]) {
   ef_en_ematch = DEF_EMATCH_EN;
   ef_mbqi_max_iter = -1;
   ef_mbqi_max_lemma_per_round = -1;
+  ef_mbqi_workers = -1;
   ef_ematch_inst_per_round = -1;
   ef_ematch_inst_per_search = -1;
   ef_ematch_inst_total = -1;
@@ -427,6 +462,8 @@ static void parse_command_line(int argc, char *argv[]) {
   ef_ematch_term_mode = -1;
 
   nthreads = 0;
+  portfolio = 0;
+  sls_moves = 0;
 
   init_cmdline_parser(&parser, options, NUM_OPTIONS, argv, argc);
 
@@ -495,7 +532,49 @@ static void parse_command_line(int argc, char *argv[]) {
         }
         nthreads = v;
         break;
-	
+
+      case portfolio_opt:
+        if (! validate_integer_option(&parser, &elem, 1, PORTFOLIO_MAX_WORKERS)) goto bad_usage;
+        portfolio = elem.i_value;
+        break;
+
+      case sls_moves_opt:
+        if (! validate_integer_option(&parser, &elem, 0, INT32_MAX)) goto bad_usage;
+        sls_moves = elem.i_value;
+        break;
+
+      case pipeline_opt:
+        use_pipeline = true;
+        break;
+
+      case save_snapshot_opt:
+        if (save_snapshot_file == NULL) {
+          save_snapshot_file = copy_string(elem.s_value);
+          if (save_snapshot_file == NULL) {
+            fprintf(stderr, "%s: file-name %s is too long\n", parser.command_name, elem.s_value);
+            code = YICES_EXIT_USAGE;
+            goto exit;
+          }
+        } else {
+          fprintf(stderr, "%s: can't give more than one snapshot file to save\n", parser.command_name);
+          goto bad_usage;
+        }
+        break;
+
+      case load_snapshot_opt:
+        if (load_snapshot_file == NULL) {
+          load_snapshot_file = copy_string(elem.s_value);
+          if (load_snapshot_file == NULL) {
+            fprintf(stderr, "%s: file-name %s is too long\n", parser.command_name, elem.s_value);
+            code = YICES_EXIT_USAGE;
+            goto exit;
+          }
+        } else {
+          fprintf(stderr, "%s: can't give more than one snapshot file to load\n", parser.command_name);
+          goto bad_usage;
+        }
+        break;
+
       case incremental_opt:
         incremental = true;
         break;
@@ -510,7 +589,7 @@ static void parse_command_line(int argc, char *argv[]) {
           if (supported_delegate(elem.s_value, &unknown_delegate)) {
           delegate = copy_string(elem.s_value);
         } else if (unknown_delegate) {
-          fprintf(stderr, "%s: unknown delegate: %s (choices are 'y2sat' or 'cadical' or 'kissat' or 'cryptominisat')\n",
+          fprintf(stderr, "%s: unknown delegate: %s (choices are 'y2sat' or 'y2sat-cubes' or 'cadical' or 'kissat' or 'cryptominisat')\n",
           parser.command_name, elem.s_value);
           goto bad_usage;
         } else {
@@ -619,6 +698,11 @@ static void parse_command_line(int argc, char *argv[]) {
         ef_mbqi_max_lemma_per_round = elem.i_value;
         break;
 
+      case mbqi_workers_opt:
+        if (! validate_integer_option(&parser, &elem, 1, EF_MAX_CEX_WORKERS)) goto bad_usage;
+        ef_mbqi_workers = elem.i_value;
+        break;
+
       case ematch_inst_per_round_opt:
         if (! validate_integer_option(&parser, &elem, 0, INT32_MAX)) goto bad_usage;
         ef_ematch_inst_per_round = elem.i_value;
@@ -727,10 +811,34 @@ static void parse_command_line(int argc, char *argv[]) {
     goto exit;
   }
 
+  if (incremental && save_snapshot_file != NULL) {
+    fprintf(stderr, "%s: saving a snapshot is not supported in incremental mode\n", parser.command_name);
+    code = YICES_EXIT_USAGE;
+    goto exit;
+  }
+
+  if (incremental && portfolio > 1) {
+    fprintf(stderr, "%s: portfolio mode is not supported in incremental mode\n", parser.command_name);
+    code = YICES_EXIT_USAGE;
+    goto exit;
+  }
+
+  if (incremental && sls_moves > 0) {
+    fprintf(stderr, "%s: local search is not supported in incremental mode\n", parser.command_name);
+    code = YICES_EXIT_USAGE;
+    goto exit;
+  }
+
   // force interactive to false if there's a filename
   if (filename != NULL) {
     interactive = false;
   }
+
+  if (interactive && use_pipeline) {
+    fprintf(stderr, "%s: pipelined input is not supported in interactive mode\n", parser.command_name);
+    code = YICES_EXIT_USAGE;
+    goto exit;
+  }
   return;
 
   /*
@@ -865,6 +973,16 @@ static void setup_options_ef(void) {
     q_clear(&q);
   }
 
+  if (ef_mbqi_workers >= 0) {
+    aval_t aval_max;
+    rational_t q;
+    q_init(&q);
+    q_set32(&q, ef_mbqi_workers);
+    aval_max = attr_vtbl_rational(__smt2_globals.avtbl, &q);
+    smt2_set_option(":yices-ef-cex-workers", aval_max);
+    q_clear(&q);
+  }
+
   if (ef_ematch_inst_per_round >= 0) {
     aval_t aval_max;
     rational_t q;
@@ -1147,10 +1265,35 @@ int main(int argc, char *argv[]) {
     smt2_set_delegate(delegate);
     if (dimacsfile != NULL) smt2_set_dimacs_file(dimacsfile);
   }
+  if (portfolio > 1) smt2_set_portfolio(portfolio);
+  if (sls_moves > 0) smt2_set_sls_moves(sls_moves);
+  if (save_snapshot_file != NULL) smt2_set_save_snapshot(save_snapshot_file);
+  if (load_snapshot_file != NULL) smt2_set_load_snapshot(load_snapshot_file);
 
   init_smt2_tstack(&stack);
   init_parser(&parser, &lexer, &stack);
 
+  if (use_pipeline && portfolio > 1) {
+    /*
+     * The MCSAT portfolio forks the process. The lexer thread
+     * wouldn't exist in the children.
+     */
+    use_pipeline = false;
+    if (verbosity > 0) {
+      fprintf(stderr, "Pipelined input is not used in portfolio mode\n");
+    }
+  }
+  if (use_pipeline) {
+    if (start_smt2_pipeline(&pipeline, &lexer)) {
+      smt2_parser_set_pipeline(&pipeline);
+    } else {
+      use_pipeline = false;
+      if (verbosity > 0) {
+        fprintf(stderr, "Pipelined input is not used: the input is not a regular file\n");
+      }
+    }
+  }
+
   init_parameter_name_table();
 
   if (verbosity > 0) {
@@ -1195,6 +1338,19 @@ int main(int argc, char *argv[]) {
     safe_free(delegate);
     delegate = NULL;
   }
+  if (save_snapshot_file != NULL) {
+    safe_free(save_snapshot_file);
+    save_snapshot_file = NULL;
+  }
+  if (load_snapshot_file != NULL) {
+    safe_free(load_snapshot_file);
+    load_snapshot_file = NULL;
+  }
+
+  if (use_pipeline) {
+    smt2_parser_set_pipeline(NULL);
+    stop_smt2_pipeline(&pipeline);
+  }
 
   delete_pvector(&trace_tags);
   delete_parser(&parser);
@@ -424,6 +424,8 @@ static void print_presearch_stats(FILE *f) {
     fprintf(f, "arithmetic solver       : IDL Floyd-Warshall\n");
   } else if (context_has_rdl_solver(&context)) {
     fprintf(f, "arithmetic solver       : RDL Floyd-Warshall\n");
+  } else if (context_has_isdl_solver(&context)) {
+    fprintf(f, "arithmetic solver       : IDL Sparse Graph\n");
   }
   fprintf(f, "\n");
   fflush(f);
@@ -621,6 +623,12 @@ static void show_quantsolver_stats(quant_solver_stats_t *stat) {
   fprintf(stderr, " quantifiers             : %"PRIu32"\n", stat->num_quantifiers);
   fprintf(stderr, " patterns                : %"PRIu32"\n", stat->num_patterns);
   fprintf(stderr, " instances               : %"PRIu32"\n", stat->num_instances);
+  fprintf(stderr, " roots matched           : %"PRIu32"\n", stat->num_roots_matched);
+  fprintf(stderr, " roots skipped           : %"PRIu32"\n", stat->num_roots_skipped);
+  fprintf(stderr, " matching time           : %.4f s\n", stat->ematch_time);
+  if (stat->ematch_time > 0) {
+    fprintf(stderr, " instances per second    : %.1f\n", stat->num_instances/stat->ematch_time);
+  }
 }
 
 
@@ -1242,8 +1250,8 @@ static int process_benchmark(void) {
      */
     switch (arch) {
     case CTX_ARCH_AUTO_IDL:
-      if (context_has_idl_solver(&context)) {
-        // IDL/Floyd-Warshall: --flatten --cache-tclauses --fast-restarts
+      if (context_has_idl_solver(&context) || context_has_isdl_solver(&context)) {
+        // IDL/Floyd-Warshall or sparse: --flatten --cache-tclauses --fast-restarts
         params.cache_tclauses = true;
         params.tclause_size = 8;
         params.fast_restart = true;
@@ -2723,7 +2723,7 @@ __YICES_DLLSPEC__ extern void yices_garbage_collect(const term_t t[], uint32_t n
  * - uf-solver: either NONE, DEFAULT
  * - bv-solver: either NONE, DEFAULT
  * - array-solver: either NONE, DEFAULT
- * - arith-solver: either NONE, DEFAULT, IFW, RFW, SIMPLEX
+ * - arith-solver: either NONE, DEFAULT, IFW, RFW, ISDL, SIMPLEX
  * - mode: either ONE-SHOT, MULTI-CHECKS, PUSH-POP, INTERACTIVE
  *
  * This is done as follows:
@@ -2785,6 +2785,9 @@ __YICES_DLLSPEC__ extern void yices_free_config(ctx_config_t *config);
  *                    |                     |
  *                    | "rfw"               |  solver for RDL, based on Floyd-Warshall
  *                    |                     |
+ *                    | "isdl"              |  solver for IDL, based on a sparse graph
+ *                    |                     |  (for problems with many variables)
+ *                    |                     |
  *                    | "simplex"           |  solver for linear arithmetic, based on Simplex
  *                    |                     |
  *                    | "default"           |  same as "simplex"
@@ -3065,6 +3068,10 @@ __YICES_DLLSPEC__ extern int32_t yices_pop(context_t *ctx);
  *   (ite c 10 (ite d 3 20)), then the context with include the assertion
  *   3 <= t <= 20.
  *
+ *   packed-arith-matrix: store the simplex tableau in packed blocks that
+ *   are rebuilt periodically. This may make pivoting faster on large
+ *   tableaus.
+ *
  * The parameter must be given as a string. For example, to disable var-elim,
  * call  yices_context_disable_option(ctx, "var-elim")
  *
@@ -3730,12 +3737,15 @@ __YICES_DLLSPEC__ extern void yices_model_collect_defined_terms(model_t *mdl, te
  * The delegate is an optional argument used only when logic is "QF_BV".
  * If is ignored otherwise. It must either be NULL or be the name of an
  * external SAT solver to use after bit-blasting. Valid delegates
- * are "cadical", "cryptominisat", and "y2sat".
+ * are "cadical", "cryptominisat", "y2sat", and "y2sat-cubes".
  * If delegate is NULL, the default SAT solver is used.
  *
+ * The "y2sat-cubes" delegate uses y2sat in cube-and-conquer mode
+ * with one thread per processor (if the library is thread safe).
+ *
  * Support for "cadical" and "cryptominisat" must be enabled at compilation
- * time. The "y2sat" solver is always available. The function will return STATUS_ERROR
- * and store an error code if the requested delegate is not available.
+ * time. The "y2sat" and "y2sat-cubes" solvers are always available. The function
+ * will return STATUS_ERROR and store an error code if the requested delegate is not available.
  *
  * Error codes:
  *
@@ -3754,7 +3764,7 @@ __YICES_DLLSPEC__ extern void yices_model_collect_defined_terms(model_t *mdl, te
  * if the logic is known but not supported by Yices
  *   code = CTX_LOGIC_NOT_SUPPORTED
  *
- * if delegate is not one of "cadical", "cryptominisat", "y2sat"
+ * if delegate is not one of "cadical", "cryptominisat", "y2sat", "y2sat-cubes"
  *   code = CTX_UNKNOWN_DELEGATE
  *
  * if delegate is "cadical" or "cryptominisat" but support for these SAT solvers
@@ -3779,6 +3789,37 @@ __YICES_DLLSPEC__ extern smt_status_t yices_check_formula(term_t f, const char *
  */
 __YICES_DLLSPEC__ extern smt_status_t yices_check_formulas(const term_t f[], uint32_t n, const char *logic, model_t **model, const char *delegate);
 
+/*
+ * Check whether n formulas are satisfiable using a portfolio of solvers.
+ * - f = array of n Boolean terms
+ * - n = number of elements in f
+ * - logic = SMT name for a logic (or NULL)
+ * - model = resulting model (or NULL if no model is needed)
+ * - nworkers = number of solver configurations to run
+ *
+ * This is similar to yices_check_formulas (with no delegate) except
+ * that nworkers contexts are constructed and checked in parallel, each
+ * with different search parameters (random seed, branching, restarts,
+ * egraph and simplex options). The first context to return SAT or
+ * UNSAT determines the result and the others are interrupted.
+ *
+ * Parallel check requires a thread-safe build (cf. yices_is_thread_safe).
+ * Otherwise, only the first configuration is checked. A single context is
+ * also used if the logic requires MCSAT or quantifier support: MCSAT
+ * creates terms during the search, so MCSAT workers can't run as threads
+ * that share the term table. The MCSAT portfolio is available only in
+ * yices_smt2 (option --portfolio), which runs each worker in a child
+ * process.
+ *
+ * Error codes: same as yices_check_formulas plus
+ *
+ * if nworkers is 0 or more than 64
+ *   code = CTX_INVALID_PARAMETER_VALUE
+ *
+ * Since 2.6.5.
+ */
+__YICES_DLLSPEC__ extern smt_status_t yices_check_formulas_portfolio(const term_t f[], uint32_t n, const char *logic, model_t **model, uint32_t nworkers);
+
 /*
  * Check whether the given delegate is supported
  * - return 0 if it's not supported.
@@ -3862,6 +3903,120 @@ __YICES_DLLSPEC__ extern int32_t yices_export_formulas_to_dimacs(const term_t f[
 
 
 
+/*
+ * Save n terms f[0 ... n-1] to a binary snapshot file
+ * - the snapshot contains the terms f[0 ... n-1], all their subterms
+ *   and types, and the names of these terms and types
+ * - it can be restored by yices_load_snapshot, which is much faster
+ *   than parsing and rebuilding the terms
+ * - the file format depends on the Yices version and on the byte
+ *   order of the machine
+ *
+ * Finite-field terms, terms of type variable or type instance, and
+ * MCSAT root atoms can't be stored in a snapshot.
+ *
+ * Return code: 0 if the file was written, -1 if there's an error
+ *
+ * Error reports:
+ * if f[i] is not a valid term:
+ *   code = INVALID_TERM
+ *   term1 = f[i]
+ * if a subterm of f[i] can't be stored:
+ *   code = SNAPSHOT_UNSUPPORTED_TERM
+ *   term1 = the subterm
+ * if there's an error when opening or writing to filename
+ *   code = OUTPUT_ERROR
+ *
+ * Since 2.6.5.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_save_snapshot(const char *filename, uint32_t n, const term_t f[]);
+
+
+/*
+ * Restore a snapshot created by yices_save_snapshot
+ * - the terms are rebuilt and the names stored in the snapshot are
+ *   restored. Uninterpreted terms and types in the snapshot are
+ *   mapped to fresh uninterpreted terms and types.
+ * - the terms f[0 ... n-1] given to yices_save_snapshot are stored
+ *   in vector v (in the same order). v must be initialized by
+ *   yices_init_term_vector.
+ *
+ * Return code: 0 if the snapshot was restored, -1 if there's an error
+ *
+ * Error reports:
+ * if the file can't be opened or read
+ *   code = INPUT_ERROR
+ * if the file is not a snapshot, or was created by a different version
+ * of Yices or on a machine with a different byte order, or is corrupted
+ *   code = SNAPSHOT_FORMAT_ERROR
+ *
+ * Since 2.6.5.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_load_snapshot(const char *filename, term_vector_t *v);
+
+
+/*
+ * Save a context and the formulas f[0 ... n-1] asserted in it
+ * - f[0 ... n-1] must be the formulas asserted in ctx
+ * - the snapshot contains the terms as in yices_save_snapshot and
+ *   the internal state of ctx after these formulas were processed
+ *   (i.e., the clauses and the bitvector solver state). Restoring it
+ *   with yices_load_context_snapshot skips both term construction
+ *   and internalization of f[0 ... n-1].
+ *
+ * This is supported only for contexts with no theory solvers or with
+ * just the bitvector solver (e.g., for logics QF_BV or NONE), at
+ * base level 0, and that have not been checked yet (i.e., the status
+ * must be STATUS_IDLE and no bit-blasting has been done). Learned
+ * clauses and search heuristic data are not stored.
+ *
+ * Return code: 0 if the file was written, -1 if there's an error
+ *
+ * Error reports:
+ * if f[i] is not a valid term:
+ *   code = INVALID_TERM
+ *   term1 = f[i]
+ * if ctx can't be saved:
+ *   code = SNAPSHOT_UNSUPPORTED_CONTEXT
+ * if a subterm of f[i] can't be stored:
+ *   code = SNAPSHOT_UNSUPPORTED_TERM
+ *   term1 = the subterm
+ * if there's an error when opening or writing to filename
+ *   code = OUTPUT_ERROR
+ *
+ * Since 2.6.5.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_save_context_snapshot(context_t *ctx, const char *filename, uint32_t n, const term_t f[]);
+
+
+/*
+ * Restore a snapshot created by yices_save_context_snapshot
+ * - ctx must be a new context (or a context that was just reset)
+ *   created with the same configuration as the context that was saved
+ * - the terms are rebuilt as in yices_load_snapshot and the state of
+ *   ctx is restored: the formulas stored in the snapshot are asserted
+ *   in ctx and they are also stored in vector v (which must be
+ *   initialized by yices_init_term_vector)
+ *
+ * Return code: 0 if the snapshot was restored, -1 if there's an error
+ *
+ * Error reports:
+ * if the file can't be opened or read
+ *   code = INPUT_ERROR
+ * if the file is not a context snapshot or is corrupted
+ *   code = SNAPSHOT_FORMAT_ERROR
+ * if ctx is not empty or its configuration does not match the context
+ * that was saved (architecture, mode, logic, and options must be the same)
+ *   code = SNAPSHOT_UNSUPPORTED_CONTEXT
+ *
+ * If the error code is SNAPSHOT_FORMAT_ERROR, ctx is reset.
+ *
+ * Since 2.6.5.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_load_context_snapshot(context_t *ctx, const char *filename, term_vector_t *v);
+
+
+
 
 /***********************
  *  VALUES IN A MODEL  *
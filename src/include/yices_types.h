@@ -483,6 +483,10 @@ typedef enum error_code {
    * Input/output and system errors
    */
   OUTPUT_ERROR = 9000,
+  INPUT_ERROR,
+  SNAPSHOT_FORMAT_ERROR,
+  SNAPSHOT_UNSUPPORTED_TERM,
+  SNAPSHOT_UNSUPPORTED_CONTEXT,
 
   /*
    * Catch-all code for anything else.
@@ -620,10 +624,17 @@ typedef enum error_code {
  *  EVAL_NO_IMPLICANT
  *
  *
+ * Error when saving a snapshot: term1 is the term that can't be stored
+ *
+ *  SNAPSHOT_UNSUPPORTED_TERM
+ *
  * Other error codes. No field is meaningful in the error_report,
  * except the error code:
  *
  *  OUTPUT_ERROR
+ *  INPUT_ERROR
+ *  SNAPSHOT_FORMAT_ERROR
+ *  SNAPSHOT_UNSUPPORTED_CONTEXT
  *  INTERNAL_EXCEPTION
  */
 typedef struct error_report_s {
@@ -27,9 +27,18 @@
 #endif
 
 #include <stdbool.h>
+#include <string.h>
 #include <assert.h>
 
+#if !defined(MINGW)
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "io/reader.h"
+#include "utils/memalloc.h"
 
 
 
@@ -74,6 +83,121 @@ static int file_reader_next_char(reader_t *reader) {
 
 
 
+#if !defined(MINGW)
+
+/*
+ * Buffered stream: refill the block buffer
+ * - we use read so that we get whatever is available on a pipe or
+ *   terminal without waiting for a full block
+ * - return false on end-of-file or error
+ */
+static bool stream_reader_refill(reader_t *reader) {
+  ssize_t n;
+
+  assert(reader->block != NULL && reader->ptr == reader->end);
+
+  do {
+    n = read(fileno(reader->input.stream), reader->block, READER_BLOCK_SIZE);
+  } while (n < 0 && errno == EINTR);
+
+  if (n <= 0) {
+    return false;
+  }
+
+  reader->ptr = reader->block;
+  reader->end = reader->block + n;
+  return true;
+}
+
+
+/*
+ * Read and return the next char from a buffered reader
+ * - this is called by reader_next_char when the buffer is empty
+ * - update pos, line, column
+ */
+static int buffered_reader_next_char(reader_t *reader) {
+  assert(reader->is_stream);
+
+  if (reader->current == EOF) {
+    return EOF;
+  }
+
+  if (reader->current == '\n') {
+    reader->line ++;
+    reader->column = 0;
+  }
+
+  if (reader->ptr < reader->end ||
+      (reader->block != NULL && stream_reader_refill(reader))) {
+    reader->current = (unsigned char) *reader->ptr;
+    reader->ptr ++;
+  } else {
+    reader->current = EOF;
+  }
+  reader->pos ++;
+  reader->column ++;
+
+  return reader->current;
+}
+
+
+/*
+ * Try to map the file in memory
+ * - this is done only for non-empty regular files: pipes, terminals,
+ *   devices, etc. use the block buffer
+ * - the file must not be truncated while it's mapped (cf. reader.h)
+ * - return false if that fails
+ */
+static bool reader_map_file(reader_t *reader) {
+  struct stat s;
+  void *map;
+  int fd;
+
+  fd = fileno(reader->input.stream);
+  if (fstat(fd, &s) < 0 || !S_ISREG(s.st_mode) || s.st_size <= 0 ||
+      (uint64_t) s.st_size > (uint64_t) SIZE_MAX) {
+    return false;
+  }
+
+  map = mmap(NULL, (size_t) s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+
+#if defined(MADV_SEQUENTIAL)
+  (void) madvise(map, (size_t) s.st_size, MADV_SEQUENTIAL);
+#endif
+
+  reader->map = map;
+  reader->map_size = (size_t) s.st_size;
+  reader->ptr = (const char *) map;
+  reader->end = reader->ptr + reader->map_size;
+  return true;
+}
+
+
+/*
+ * Set up the buffer for a stream reader: map the file if possible,
+ * otherwise allocate a block buffer
+ */
+static void init_reader_buffer(reader_t *reader) {
+  reader->read = buffered_reader_next_char;
+  if (! reader_map_file(reader)) {
+    reader->block = (char *) safe_malloc(READER_BLOCK_SIZE);
+  }
+}
+
+#else
+
+/*
+ * No buffering on Windows: use getc
+ */
+static void init_reader_buffer(reader_t *reader) {
+}
+
+#endif
+
+
 /*
  * Read and return the next char from a string reader
  * - update pos, line, column
@@ -126,12 +250,18 @@ int32_t init_file_reader(reader_t *reader, const char *filename) {
   reader->is_stream = true;
   reader->read = file_reader_next_char;
   reader->name = filename;
+  reader->ptr = NULL;
+  reader->end = NULL;
+  reader->block = NULL;
+  reader->map = NULL;
+  reader->map_size = 0;
 
   if (f == NULL) {
     reader->current = EOF;
     return -1;
   }
 
+  init_reader_buffer(reader);
   reader->current = '\n';
   return 0;
 }
@@ -139,6 +269,8 @@ int32_t init_file_reader(reader_t *reader, const char *filename) {
 /*
  * Initialize reader for an already opened stream
  * - set filename to name
+ * - the stream is read directly (not through stdio) so nothing
+ *   must have been read from f yet
  */
 void init_stream_reader(reader_t *reader, FILE *f, const char *name) {
   reader->current = '\n';
@@ -149,6 +281,12 @@ void init_stream_reader(reader_t *reader, FILE *f, const char *name) {
   reader->is_stream = true;
   reader->read = file_reader_next_char;
   reader->name = name;
+  reader->ptr = NULL;
+  reader->end = NULL;
+  reader->block = NULL;
+  reader->map = NULL;
+  reader->map_size = 0;
+  init_reader_buffer(reader);
 }
 
 
@@ -164,6 +302,11 @@ void init_string_reader(reader_t *reader, const char *data, const char *name) {
   reader->is_stream = false;
   reader->read = string_reader_next_char;
   reader->name = name;
+  reader->ptr = NULL;
+  reader->end = NULL;
+  reader->block = NULL;
+  reader->map = NULL;
+  reader->map_size = 0;
 }
 
 
@@ -183,11 +326,30 @@ void reset_string_reader(reader_t *reader, const char *data) {
 
 
 
+/*
+ * Release the buffer (if any)
+ */
+static void delete_reader_buffer(reader_t *reader) {
+#if !defined(MINGW)
+  if (reader->map != NULL) {
+    (void) munmap(reader->map, reader->map_size);
+    reader->map = NULL;
+    reader->map_size = 0;
+  }
+#endif
+  safe_free(reader->block);
+  reader->block = NULL;
+  reader->ptr = NULL;
+  reader->end = NULL;
+}
+
+
 /*
  * Close reader: return EOF on error, 0 otherwise
  */
 int close_reader(reader_t *reader) {
   if (reader->is_stream) {
+    delete_reader_buffer(reader);
     return fclose(reader->input.stream);
   } else {
     return 0;
@@ -195,6 +357,47 @@ int close_reader(reader_t *reader) {
 }
 
 
+/*
+ * Variant: free the buffer but don't close the stream
+ */
+void close_reader_only(reader_t *reader) {
+  if (reader->is_stream) {
+    delete_reader_buffer(reader);
+  }
+}
+
+
+/*
+ * Read until the current character is '\n' or EOF
+ * - we use memchr to search the buffer
+ */
+int reader_skip_to_eol(reader_t *reader) {
+  const char *p;
+  int c;
+
+  c = reader->current;
+  while (c != '\n' && c != EOF) {
+    if (reader->ptr < reader->end) {
+      p = memchr(reader->ptr, '\n', reader->end - reader->ptr);
+      if (p == NULL) {
+        p = reader->end - 1;
+      }
+      // skip all characters up to p (included)
+      // c is not '\n' so there's no line update
+      reader->pos += (p - reader->ptr) + 1;
+      reader->column += (p - reader->ptr) + 1;
+      reader->ptr = p + 1;
+      c = (unsigned char) *p;
+      reader->current = c;
+    } else {
+      c = reader->read(reader);
+    }
+  }
+
+  return c;
+}
+
+
 #if 0
 /*
  * Experimental variant: use wide characters
@@ -19,11 +19,27 @@
 /*
  * File reader: keeps track of filename, position, and current character.
  * String reader: same thing but reads from a null-terminated string.
+ *
+ * File and stream readers are buffered:
+ * - regular files are mapped in memory if possible
+ * - other streams (pipes, terminals) are read by blocks.
+ * The next characters are taken from the buffer without a function
+ * call. Lexers can also scan the buffer directly (cf. reader_buffer).
+ *
+ * Only regular files are mapped. If a mapped file is truncated by
+ * another process while it's being read, accessing the pages past
+ * the new end of file raises SIGBUS and kills the process (stdio
+ * would just see a shorter file). Input that may change while it's
+ * read should be given through a pipe or stdin, which are read by
+ * blocks.
  */
 
 #ifndef __READER_H
 #define __READER_H
 
+#include <assert.h>
+#include <stddef.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -36,6 +52,10 @@
  * - name = filename or whatever else is given at initialization.
  * - read = read function: get next character
  *   return EOF on last character
+ * - ptr/end = buffered characters not read yet (ptr == end if
+ *   the buffer is empty or if the reader is not buffered)
+ * - block = buffer for a stream reader (NULL otherwise)
+ * - map/map_size = memory-mapped file (NULL/0 otherwise)
  */
 typedef struct reader_s reader_t;
 
@@ -53,8 +73,18 @@ struct reader_s {
     const char *data;
   } input;
   const char *name;
+  const char *ptr;
+  const char *end;
+  char *block;
+  void *map;
+  size_t map_size;
 };
 
+/*
+ * Size of the block buffer for streams
+ */
+#define READER_BLOCK_SIZE 65536
+
 
 /*
  * Initializations:
@@ -131,6 +161,12 @@ extern void reset_string_reader(reader_t *reader, const char *data);
  */
 extern int close_reader(reader_t *reader);
 
+/*
+ * Variant: free the buffer but don't close the file/stream
+ * - characters that were buffered but not read are lost
+ */
+extern void close_reader_only(reader_t *reader);
+
 
 /*
  * Get current character, position, line or column numbers
@@ -151,14 +187,86 @@ static inline uint64_t reader_position(reader_t *reader) {
   return reader->pos;
 }
 
+/*
+ * Check whether the whole input is mapped in memory
+ * (then reading never blocks)
+ */
+static inline bool reader_is_mapped(reader_t *reader) {
+  return reader->map != NULL;
+}
+
 
 /*
  * Read one character, update position data and return the new
  * character.
+ * - fast path: the next character is in the buffer
  */
 static inline int reader_next_char(reader_t *reader) {
+  int c;
+
+  if (reader->ptr < reader->end) {
+    if (reader->current == '\n') {
+      reader->line ++;
+      reader->column = 0;
+    }
+    c = (unsigned char) *reader->ptr;
+    reader->ptr ++;
+    reader->current = c;
+    reader->pos ++;
+    reader->column ++;
+    return c;
+  }
+
   return reader->read(reader);
 }
 
 
+/*
+ * Direct access to the buffer:
+ * - return a pointer to the buffered characters that follow the
+ *   current character and store their number in *n
+ * - *n is 0 if the buffer is empty (this doesn't mean that the
+ *   end of the input is reached)
+ */
+static inline const char *reader_buffer(reader_t *reader, uint32_t *n) {
+  size_t k;
+
+  k = reader->end - reader->ptr;
+  if (k > UINT32_MAX) {
+    k = UINT32_MAX;
+  }
+  *n = (uint32_t) k;
+  return reader->ptr;
+}
+
+/*
+ * Skip k characters from the buffer
+ * - k must be no more than the number of buffered characters
+ * - the first k-1 skipped characters must not be '\n'
+ *   (they're not taken into account for the line count)
+ * - the current character becomes the last skipped character
+ */
+static inline void reader_skip_buffered_chars(reader_t *reader, uint32_t k) {
+  assert(k <= (size_t) (reader->end - reader->ptr));
+
+  if (k > 0) {
+    if (reader->current == '\n') {
+      reader->line ++;
+      reader->column = 0;
+    }
+    reader->ptr += k;
+    reader->current = (unsigned char) reader->ptr[-1];
+    reader->pos += k;
+    reader->column += k;
+  }
+}
+
+
+/*
+ * Read until the current character is '\n' or EOF
+ * - return the current character
+ */
+extern int reader_skip_to_eol(reader_t *reader);
+
+
 #endif /* __READER_H */
@@ -0,0 +1,1726 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * BINARY SNAPSHOTS OF TERMS
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <gmp.h>
+
+#if !defined(MINGW)
+#include <sys/mman.h>
+#endif
+
+#include "io/term_snapshot.h"
+#include "terms/bv_constants.h"
+#include "terms/bvarith64_buffer_terms.h"
+#include "terms/bvarith_buffer_terms.h"
+#include "terms/rba_buffer_terms.h"
+#include "utils/hash_functions.h"
+#include "utils/int_array_sort.h"
+#include "utils/int_hash_map.h"
+#include "utils/memalloc.h"
+#include "utils/refcount_strings.h"
+
+
+/*
+ * Number of predefined types (bool, int, real) and of predefined
+ * term indices (const_idx, bool_const, zero_const). They are not
+ * stored in the snapshot.
+ */
+#define NUM_PREDEFINED_TYPES 3
+#define NUM_PREDEFINED_TERMS 3
+
+/*
+ * Tags for rational constants and for name records
+ */
+enum {
+  SNAPSHOT_SMALL_RATIONAL = 0,  // [tag, num, den]
+  SNAPSHOT_BIG_RATIONAL = 1,    // [tag, string in base 16]
+};
+
+enum {
+  SNAPSHOT_TERM_NAME = 0,       // [tag, term occurrence, name]
+  SNAPSHOT_TYPE_NAME = 1,       // [tag, type, name]
+};
+
+
+
+/*
+ * WRITER
+ */
+
+/*
+ * - type_map: maps types to their rank in the snapshot
+ * - term_map: maps term indices to their rank in the snapshot
+ * - type_body: content of the type section
+ * - term_body: content of the term section
+ * - name_body: content of the name section
+ * - stack: for exploring terms
+ * - aux: to collect the children of a term
+ * - bad = term that can't be stored
+ */
+typedef struct snapshot_writer_s {
+  term_table_t *terms;
+  type_table_t *types;
+  int_hmap_t type_map;
+  int_hmap_t term_map;
+  ivector_t type_body;
+  ivector_t term_body;
+  ivector_t name_body;
+  ivector_t stack;
+  ivector_t aux;
+  uint32_t ntypes;
+  uint32_t nterms;
+  uint32_t nnames;
+  term_t bad;
+  jmp_buf env;
+} snapshot_writer_t;
+
+
+static void init_snapshot_writer(snapshot_writer_t *w, term_table_t *terms) {
+  w->terms = terms;
+  w->types = terms->types;
+  init_int_hmap(&w->type_map, 0);
+  init_int_hmap(&w->term_map, 0);
+  init_ivector(&w->type_body, 64);
+  init_ivector(&w->term_body, 1024);
+  init_ivector(&w->name_body, 64);
+  init_ivector(&w->stack, 64);
+  init_ivector(&w->aux, 10);
+  w->ntypes = 0;
+  w->nterms = 0;
+  w->nnames = 0;
+  w->bad = NULL_TERM;
+}
+
+static void delete_snapshot_writer(snapshot_writer_t *w) {
+  delete_int_hmap(&w->type_map);
+  delete_int_hmap(&w->term_map);
+  delete_ivector(&w->type_body);
+  delete_ivector(&w->term_body);
+  delete_ivector(&w->name_body);
+  delete_ivector(&w->stack);
+  delete_ivector(&w->aux);
+}
+
+
+/*
+ * Add a 64bit value to v (low-order word first)
+ */
+static void push_uint64(ivector_t *v, uint64_t x) {
+  ivector_push(v, (int32_t) (uint32_t) x);
+  ivector_push(v, (int32_t) (uint32_t) (x >> 32));
+}
+
+/*
+ * Add a string to v: length then the characters packed in words
+ */
+static void push_string(ivector_t *v, const char *s) {
+  uint32_t len, nwords, i;
+
+  len = strlen(s);
+  nwords = (len + 3) >> 2;
+  ivector_push(v, len);
+  i = v->size;
+  resize_ivector(v, i + nwords);
+  if (nwords > 0) {
+    v->data[i + nwords - 1] = 0; // clear the padding
+    memcpy(v->data + i, s, len);
+  }
+  v->size = i + nwords;
+}
+
+/*
+ * Add a rational to v
+ */
+static void push_rational(ivector_t *v, rational_t *q) {
+  mpq_t aux;
+  char *s;
+  int32_t num;
+  uint32_t den;
+  size_t len;
+
+  if (q_get_int32(q, &num, &den)) {
+    ivector_push(v, SNAPSHOT_SMALL_RATIONAL);
+    ivector_push(v, num);
+    ivector_push(v, den);
+  } else {
+    mpq_init(aux);
+    q_get_mpq(q, aux);
+    len = mpz_sizeinbase(mpq_numref(aux), 16) + mpz_sizeinbase(mpq_denref(aux), 16) + 3;
+    s = (char *) safe_malloc(len);
+    mpq_get_str(s, 16, aux);
+    ivector_push(v, SNAPSHOT_BIG_RATIONAL);
+    push_string(v, s);
+    safe_free(s);
+    mpq_clear(aux);
+  }
+}
+
+/*
+ * Add a name record
+ */
+static void push_name(snapshot_writer_t *w, uint32_t tag, int32_t id, const char *name) {
+  ivector_push(&w->name_body, tag);
+  ivector_push(&w->name_body, id);
+  push_string(&w->name_body, name);
+  w->nnames ++;
+}
+
+
+/*
+ * Rank of type tau: add tau and its components to the type section if needed
+ * - raise an exception if tau is not supported
+ */
+static int32_t snapshot_type(snapshot_writer_t *w, type_t tau) {
+  type_table_t *types;
+  int_hmap_pair_t *p;
+  tuple_type_t *tup;
+  function_type_t *fun;
+  char *name;
+  int32_t rank;
+  uint32_t i, n;
+
+  if (tau < NUM_PREDEFINED_TYPES) {
+    return tau;
+  }
+
+  p = int_hmap_find(&w->type_map, tau);
+  if (p != NULL) {
+    return p->val;
+  }
+
+  types = w->types;
+  switch (type_kind(types, tau)) {
+  case BITVECTOR_TYPE:
+    ivector_push(&w->type_body, BITVECTOR_TYPE);
+    ivector_push(&w->type_body, bv_type_size(types, tau));
+    break;
+
+  case SCALAR_TYPE:
+    ivector_push(&w->type_body, SCALAR_TYPE);
+    ivector_push(&w->type_body, scalar_type_cardinal(types, tau));
+    break;
+
+  case UNINTERPRETED_TYPE:
+    ivector_push(&w->type_body, UNINTERPRETED_TYPE);
+    break;
+
+  case TUPLE_TYPE:
+    tup = tuple_type_desc(types, tau);
+    n = tup->nelem;
+    for (i=0; i<n; i++) {
+      (void) snapshot_type(w, tup->elem[i]);
+    }
+    ivector_push(&w->type_body, TUPLE_TYPE);
+    ivector_push(&w->type_body, n);
+    for (i=0; i<n; i++) {
+      ivector_push(&w->type_body, snapshot_type(w, tup->elem[i]));
+    }
+    break;
+
+  case FUNCTION_TYPE:
+    fun = function_type_desc(types, tau);
+    n = fun->ndom;
+    (void) snapshot_type(w, fun->range);
+    for (i=0; i<n; i++) {
+      (void) snapshot_type(w, fun->domain[i]);
+    }
+    ivector_push(&w->type_body, FUNCTION_TYPE);
+    ivector_push(&w->type_body, snapshot_type(w, fun->range));
+    ivector_push(&w->type_body, n);
+    for (i=0; i<n; i++) {
+      ivector_push(&w->type_body, snapshot_type(w, fun->domain[i]));
+    }
+    break;
+
+  default:
+    // finite fields, type variables, type instances
+    longjmp(w->env, SNAP_UNSUPPORTED_TERM);
+    break;
+  }
+
+  rank = NUM_PREDEFINED_TYPES + w->ntypes;
+  w->ntypes ++;
+  int_hmap_add(&w->type_map, tau, rank);
+
+  name = type_name(types, tau);
+  if (name != NULL) {
+    push_name(w, SNAPSHOT_TYPE_NAME, rank, name);
+  }
+
+  return rank;
+}
+
+
+/*
+ * Collect the children of term index i in w->aux
+ * - raise an exception if i is not supported
+ */
+static void collect_children(snapshot_writer_t *w, int32_t i) {
+  term_table_t *terms;
+  composite_term_t *c;
+  pprod_t *pp;
+  polynomial_t *p;
+  bvpoly64_t *p64;
+  bvpoly_t *pb;
+  ivector_t *v;
+  uint32_t j, n;
+
+  terms = w->terms;
+  v = &w->aux;
+  ivector_reset(v);
+
+  switch (kind_for_idx(terms, i)) {
+  case CONSTANT_TERM:
+  case ARITH_CONSTANT:
+  case BV64_CONSTANT:
+  case BV_CONSTANT:
+  case VARIABLE:
+  case UNINTERPRETED_TERM:
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    ivector_push(v, integer_value_for_idx(terms, i));
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case APP_TERM:
+  case UPDATE_TERM:
+  case TUPLE_TERM:
+  case EQ_TERM:
+  case DISTINCT_TERM:
+  case FORALL_TERM:
+  case LAMBDA_TERM:
+  case OR_TERM:
+  case XOR_TERM:
+  case ARITH_BINEQ_ATOM:
+  case ARITH_RDIV:
+  case ARITH_IDIV:
+  case ARITH_MOD:
+  case ARITH_DIVIDES_ATOM:
+  case BV_ARRAY:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    c = composite_for_idx(terms, i);
+    ivector_add(v, c->arg, c->arity);
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    ivector_push(v, select_for_idx(terms, i)->arg);
+    break;
+
+  case POWER_PRODUCT:
+    pp = pprod_for_idx(terms, i);
+    n = pp->len;
+    for (j=0; j<n; j++) {
+      ivector_push(v, pp->prod[j].var);
+    }
+    break;
+
+  case ARITH_POLY:
+    p = ptr_for_idx(terms, i);
+    n = p->nterms;
+    for (j=0; j<n; j++) {
+      if (p->mono[j].var != const_idx) ivector_push(v, p->mono[j].var);
+    }
+    break;
+
+  case BV64_POLY:
+    p64 = ptr_for_idx(terms, i);
+    n = p64->nterms;
+    for (j=0; j<n; j++) {
+      if (p64->mono[j].var != const_idx) ivector_push(v, p64->mono[j].var);
+    }
+    break;
+
+  case BV_POLY:
+    pb = ptr_for_idx(terms, i);
+    n = pb->nterms;
+    for (j=0; j<n; j++) {
+      if (pb->mono[j].var != const_idx) ivector_push(v, pb->mono[j].var);
+    }
+    break;
+
+  default:
+    // finite fields, root atoms
+    w->bad = pos_term(i);
+    longjmp(w->env, SNAP_UNSUPPORTED_TERM);
+    break;
+  }
+}
+
+
+/*
+ * Encoding of term occurrence t: t must be already visited
+ */
+static int32_t snapshot_occ(snapshot_writer_t *w, term_t t) {
+  int_hmap_pair_t *p;
+  int32_t i;
+
+  i = index_of(t);
+  if (i < NUM_PREDEFINED_TERMS) {
+    return t;
+  }
+  p = int_hmap_find(&w->term_map, i);
+  assert(p != NULL);
+  return (p->val << 1) | polarity_of(t);
+}
+
+
+/*
+ * Add the record for term index i (all children must be visited)
+ */
+static void emit_term(snapshot_writer_t *w, int32_t i) {
+  term_table_t *terms;
+  ivector_t *v;
+  composite_term_t *c;
+  select_term_t *s;
+  bvconst64_term_t *b64;
+  bvconst_term_t *b;
+  pprod_t *pp;
+  polynomial_t *p;
+  bvpoly64_t *p64;
+  bvpoly_t *pb;
+  term_kind_t kind;
+  type_t tau;
+  char *name;
+  int32_t rank;
+  uint32_t j, k, n, width;
+
+  terms = w->terms;
+  v = &w->term_body;
+  kind = kind_for_idx(terms, i);
+
+  w->bad = pos_term(i);
+  tau = snapshot_type(w, type_for_idx(terms, i));
+  w->bad = NULL_TERM;
+
+  ivector_push(v, kind);
+  ivector_push(v, tau);
+
+  switch (kind) {
+  case CONSTANT_TERM:
+    ivector_push(v, integer_value_for_idx(terms, i));
+    break;
+
+  case ARITH_CONSTANT:
+    push_rational(v, rational_for_idx(terms, i));
+    break;
+
+  case BV64_CONSTANT:
+    b64 = ptr_for_idx(terms, i);
+    ivector_push(v, b64->bitsize);
+    push_uint64(v, b64->value);
+    break;
+
+  case BV_CONSTANT:
+    b = ptr_for_idx(terms, i);
+    ivector_push(v, b->bitsize);
+    ivector_add(v, (int32_t *) b->data, (b->bitsize + 31) >> 5);
+    break;
+
+  case VARIABLE:
+  case UNINTERPRETED_TERM:
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    ivector_push(v, snapshot_occ(w, integer_value_for_idx(terms, i)));
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    s = select_for_idx(terms, i);
+    ivector_push(v, s->idx);
+    ivector_push(v, snapshot_occ(w, s->arg));
+    break;
+
+  case POWER_PRODUCT:
+    pp = pprod_for_idx(terms, i);
+    n = pp->len;
+    ivector_push(v, n);
+    for (j=0; j<n; j++) {
+      ivector_push(v, snapshot_occ(w, pp->prod[j].var));
+      ivector_push(v, pp->prod[j].exp);
+    }
+    break;
+
+  case ARITH_POLY:
+    p = ptr_for_idx(terms, i);
+    n = p->nterms;
+    ivector_push(v, n);
+    for (j=0; j<n; j++) {
+      ivector_push(v, snapshot_occ(w, p->mono[j].var));
+      push_rational(v, &p->mono[j].coeff);
+    }
+    break;
+
+  case BV64_POLY:
+    p64 = ptr_for_idx(terms, i);
+    n = p64->nterms;
+    ivector_push(v, n);
+    for (j=0; j<n; j++) {
+      ivector_push(v, snapshot_occ(w, p64->mono[j].var));
+      push_uint64(v, p64->mono[j].coeff);
+    }
+    break;
+
+  case BV_POLY:
+    pb = ptr_for_idx(terms, i);
+    n = pb->nterms;
+    width = pb->width;
+    ivector_push(v, n);
+    for (j=0; j<n; j++) {
+      ivector_push(v, snapshot_occ(w, pb->mono[j].var));
+      ivector_add(v, (int32_t *) pb->mono[j].coeff, width);
+    }
+    break;
+
+  default:
+    // all composites
+    c = composite_for_idx(terms, i);
+    n = c->arity;
+    ivector_push(v, n);
+    for (j=0; j<n; j++) {
+      ivector_push(v, snapshot_occ(w, c->arg[j]));
+    }
+    break;
+  }
+
+  rank = NUM_PREDEFINED_TERMS + w->nterms;
+  w->nterms ++;
+  int_hmap_add(&w->term_map, i, rank);
+
+  for (k=0; k<2; k++) {
+    name = term_name(terms, pos_term(i) | k);
+    if (name != NULL) {
+      push_name(w, SNAPSHOT_TERM_NAME, (rank << 1) | k, name);
+    }
+  }
+}
+
+
+/*
+ * Visit t and all its subterms
+ * - the terms are added to the term section in post order
+ */
+static void snapshot_term(snapshot_writer_t *w, term_t t) {
+  ivector_t *stack;
+  uint32_t j, n;
+  int32_t i, x;
+
+  stack = &w->stack;
+  assert(stack->size == 0);
+
+  i = index_of(t);
+  if (i < NUM_PREDEFINED_TERMS) return;
+  ivector_push(stack, i);
+
+  while (stack->size > 0) {
+    i = ivector_last(stack);
+    if (int_hmap_find(&w->term_map, i) != NULL) {
+      ivector_pop(stack);
+      continue;
+    }
+
+    collect_children(w, i);
+    n = stack->size;
+    for (j=0; j<w->aux.size; j++) {
+      x = index_of(w->aux.data[j]);
+      if (x >= NUM_PREDEFINED_TERMS && int_hmap_find(&w->term_map, x) == NULL) {
+        ivector_push(stack, x);
+      }
+    }
+
+    if (stack->size == n) {
+      // all children are visited
+      emit_term(w, i);
+      ivector_pop(stack);
+    }
+  }
+}
+
+
+/*
+ * Write n words of a to f
+ */
+static bool write_words(FILE *f, const int32_t *a, uint32_t n) {
+  return fwrite(a, sizeof(int32_t), n, f) == n;
+}
+
+
+int32_t save_term_snapshot_ext(const char *filename, term_table_t *terms, uint32_t n, const term_t *a,
+                               uint32_t m, const term_t *b, const ivector_t *ext, term_t *bad) {
+  snapshot_writer_t writer;
+  ivector_t body;
+  uint32_t header[SNAPSHOT_HEADER_SIZE];
+  uint32_t i, next;
+  int32_t code;
+  FILE *f;
+
+  init_snapshot_writer(&writer, terms);
+  init_ivector(&body, 0);
+
+  code = setjmp(writer.env);
+  if (code == 0) {
+    for (i=0; i<n; i++) {
+      snapshot_term(&writer, a[i]);
+    }
+    for (i=0; i<m; i++) {
+      snapshot_term(&writer, b[i]);
+    }
+
+    /*
+     * Body = types, terms, names, roots, extension in a single block
+     * (the checksum is computed on the whole block).
+     */
+    ivector_add(&body, writer.type_body.data, writer.type_body.size);
+    ivector_add(&body, writer.term_body.data, writer.term_body.size);
+    ivector_add(&body, writer.name_body.data, writer.name_body.size);
+    for (i=0; i<n; i++) {
+      ivector_push(&body, snapshot_occ(&writer, a[i]));
+    }
+    for (i=0; i<m; i++) {
+      ivector_push(&body, snapshot_occ(&writer, b[i]));
+    }
+    next = 0;
+    if (ext != NULL) {
+      next = ext->size;
+      ivector_add(&body, ext->data, next);
+    }
+
+    header[0] = SNAPSHOT_MAGIC;
+    header[1] = SNAPSHOT_VERSION;
+    header[2] = SNAPSHOT_BOM;
+    header[3] = writer.ntypes;
+    header[4] = writer.nterms;
+    header[5] = writer.nnames;
+    header[6] = n;
+    header[7] = m;
+    header[8] = next;
+    header[9] = body.size;
+    header[10] = jenkins_hash_array((uint32_t *) body.data, body.size, 0x1234);
+
+    f = fopen(filename, "wb");
+    if (f == NULL) {
+      code = SNAP_IO_ERROR;
+    } else {
+      if (write_words(f, (int32_t *) header, SNAPSHOT_HEADER_SIZE) &&
+          write_words(f, body.data, body.size)) {
+        code = 0;
+      } else {
+        code = SNAP_IO_ERROR;
+      }
+      if (fclose(f) == EOF) {
+        code = SNAP_IO_ERROR;
+      }
+    }
+  } else {
+    assert(code == SNAP_UNSUPPORTED_TERM);
+    *bad = writer.bad;
+  }
+
+  delete_ivector(&body);
+  delete_snapshot_writer(&writer);
+
+  return code;
+}
+
+
+int32_t save_term_snapshot(const char *filename, term_table_t *terms, uint32_t n, const term_t *a, term_t *bad) {
+  return save_term_snapshot_ext(filename, terms, n, a, 0, NULL, NULL, bad);
+}
+
+
+
+
+/*
+ * READER
+ */
+
+/*
+ * - data = content of the file (size words)
+ * - pos = read pointer
+ * - type_map[r] = type of rank r
+ * - term_map[r] = term of rank r
+ * - aux = buffer for term arguments
+ * - vars = buffer to check bound variables
+ * - roots = the root terms followed by the extra roots
+ * - nroots = number of roots (not including the extra roots)
+ * - ext = start of the extension (next words)
+ * - named = the term occurrences that have a name in the snapshot
+ * - bv = buffer for bitvector constants and coefficients
+ * - q = buffer for rationals
+ */
+typedef struct snapshot_reader_s {
+  term_manager_t *manager;
+  term_table_t *terms;
+  type_table_t *types;
+  const uint32_t *data;
+  uint32_t size;
+  uint32_t pos;
+  type_t *type_map;
+  term_t *term_map;
+  uint32_t ntypes;  // number of types read so far (including the predefined types)
+  uint32_t nterms;  // number of terms read so far (including the predefined terms)
+  ivector_t aux;
+  ivector_t vars;
+  ivector_t roots;
+  uint32_t nroots;
+  const uint32_t *ext;
+  uint32_t next;
+  ivector_t named;
+  bvconstant_t bv;
+  rational_t q;
+  jmp_buf env;
+} snapshot_reader_t;
+
+
+static void init_snapshot_reader(snapshot_reader_t *r, term_manager_t *manager, const uint32_t *data, uint32_t size) {
+  r->manager = manager;
+  r->terms = term_manager_get_terms(manager);
+  r->types = term_manager_get_types(manager);
+  r->data = data;
+  r->size = size;
+  r->pos = 0;
+  r->type_map = NULL;
+  r->term_map = NULL;
+  r->ntypes = 0;
+  r->nterms = 0;
+  init_ivector(&r->aux, 10);
+  init_ivector(&r->vars, 10);
+  init_ivector(&r->roots, 10);
+  r->nroots = 0;
+  r->ext = NULL;
+  r->next = 0;
+  init_ivector(&r->named, 10);
+  init_bvconstant(&r->bv);
+  q_init(&r->q);
+}
+
+static void delete_snapshot_reader(snapshot_reader_t *r) {
+  safe_free(r->type_map);
+  safe_free(r->term_map);
+  delete_ivector(&r->aux);
+  delete_ivector(&r->vars);
+  delete_ivector(&r->roots);
+  delete_ivector(&r->named);
+  delete_bvconstant(&r->bv);
+  q_clear(&r->q);
+}
+
+
+/*
+ * Read one word: raise an exception if we're at the end of the data
+ */
+static uint32_t read_word(snapshot_reader_t *r) {
+  if (r->pos >= r->size) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  return r->data[r->pos ++];
+}
+
+static uint64_t read_uint64(snapshot_reader_t *r) {
+  uint64_t x;
+
+  x = read_word(r);
+  return x | (((uint64_t) read_word(r)) << 32);
+}
+
+/*
+ * Check that n more words can be read
+ */
+static void check_available(snapshot_reader_t *r, uint32_t n) {
+  if (n > r->size - r->pos) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+}
+
+/*
+ * Read a type rank and return the corresponding type
+ */
+static type_t read_type(snapshot_reader_t *r) {
+  uint32_t x;
+
+  x = read_word(r);
+  if (x >= r->ntypes) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  return r->type_map[x];
+}
+
+/*
+ * Read a term occurrence and return the corresponding term
+ */
+static term_t read_occ(snapshot_reader_t *r) {
+  uint32_t x;
+  term_t t;
+
+  x = read_word(r);
+  if ((x >> 1) >= r->nterms || (x >> 1) == const_idx) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  t = r->term_map[x >> 1] ^ (x & 1);
+  // only Boolean terms can have negative polarity
+  if (is_neg_term(t) && !is_boolean_term(r->terms, t)) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  return t;
+}
+
+/*
+ * Read a polynomial variable: either const_idx or a term occurrence
+ */
+static term_t read_var(snapshot_reader_t *r) {
+  if (r->pos < r->size && r->data[r->pos] == const_idx) {
+    r->pos ++;
+    return const_idx;
+  }
+  return read_occ(r);
+}
+
+/*
+ * Read n term occurrences into r->aux
+ */
+static void read_args(snapshot_reader_t *r, uint32_t n) {
+  uint32_t i;
+
+  check_available(r, n);
+  ivector_reset(&r->aux);
+  for (i=0; i<n; i++) {
+    ivector_push(&r->aux, read_occ(r));
+  }
+}
+
+/*
+ * Read a string: return a pointer to a new string
+ * (to be freed by the caller)
+ */
+static char *read_string(snapshot_reader_t *r) {
+  char *s;
+  uint32_t len, nwords;
+
+  len = read_word(r);
+  nwords = (len >> 2) + ((len & 3) != 0); // no overflow
+  check_available(r, nwords);
+  s = (char *) safe_malloc(len + 1);
+  memcpy(s, r->data + r->pos, len);
+  s[len] = '\0';
+  r->pos += nwords;
+
+  return s;
+}
+
+/*
+ * Read a rational into r->q
+ */
+static void read_rational(snapshot_reader_t *r) {
+  char *s;
+  int32_t num;
+  uint32_t den;
+  int code;
+
+  switch (read_word(r)) {
+  case SNAPSHOT_SMALL_RATIONAL:
+    num = read_word(r);
+    den = read_word(r);
+    if (den == 0) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    q_set_int32(&r->q, num, den);
+    break;
+
+  case SNAPSHOT_BIG_RATIONAL:
+    s = read_string(r);
+    code = q_set_from_string_base(&r->q, s, 16);
+    safe_free(s);
+    if (code < 0) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    break;
+
+  default:
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+    break;
+  }
+}
+
+/*
+ * Read a bitvector constant of n bits into r->bv
+ */
+static void read_bvconst(snapshot_reader_t *r, uint32_t n) {
+  uint32_t w;
+
+  w = (n + 31) >> 5;
+  check_available(r, w);
+  bvconstant_copy(&r->bv, n, r->data + r->pos);
+  r->pos += w;
+}
+
+
+/*
+ * Read a type record
+ */
+static void read_type_record(snapshot_reader_t *r) {
+  type_t range;
+  type_t tau;
+  uint32_t i, n;
+
+  switch (read_word(r)) {
+  case BITVECTOR_TYPE:
+    n = read_word(r);
+    if (n == 0 || n > YICES_MAX_BVSIZE) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    tau = bv_type(r->types, n);
+    break;
+
+  case SCALAR_TYPE:
+    n = read_word(r);
+    if (n == 0) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    tau = new_scalar_type(r->types, n);
+    break;
+
+  case UNINTERPRETED_TYPE:
+    tau = new_uninterpreted_type(r->types);
+    break;
+
+  case TUPLE_TYPE:
+    n = read_word(r);
+    if (n == 0 || n > YICES_MAX_ARITY) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    check_available(r, n);
+    ivector_reset(&r->aux);
+    for (i=0; i<n; i++) {
+      ivector_push(&r->aux, read_type(r));
+    }
+    tau = tuple_type(r->types, n, r->aux.data);
+    break;
+
+  case FUNCTION_TYPE:
+    range = read_type(r);
+    n = read_word(r);
+    if (n == 0 || n > YICES_MAX_ARITY) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    check_available(r, n);
+    ivector_reset(&r->aux);
+    for (i=0; i<n; i++) {
+      ivector_push(&r->aux, read_type(r));
+    }
+    tau = function_type(r->types, range, n, r->aux.data);
+    break;
+
+  default:
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+    break;
+  }
+
+  r->type_map[r->ntypes] = tau;
+  r->ntypes ++;
+}
+
+
+/*
+ * TYPE CHECKING
+ */
+
+/*
+ * The term constructors assume well-typed arguments so a snapshot
+ * whose checksum is correct but whose content is not well typed must be
+ * caught before we call them. All the checks raise SNAP_FORMAT_ERROR.
+ */
+static void check_format(snapshot_reader_t *r, bool cond) {
+  if (! cond) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+}
+
+static void check_boolean_args(snapshot_reader_t *r, uint32_t n, const term_t *a) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    check_format(r, is_boolean_term(r->terms, a[i]));
+  }
+}
+
+static void check_arith_args(snapshot_reader_t *r, uint32_t n, const term_t *a) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    check_format(r, is_arithmetic_term(r->terms, a[i]));
+  }
+}
+
+/*
+ * All terms in a[0 ... n-1] must be bitvectors of the same size
+ */
+static void check_bv_args(snapshot_reader_t *r, uint32_t n, const term_t *a) {
+  uint32_t i, nbits;
+
+  assert(n > 0);
+  check_format(r, is_bitvector_term(r->terms, a[0]));
+  nbits = term_bitsize(r->terms, a[0]);
+  for (i=1; i<n; i++) {
+    check_format(r, is_bitvector_term(r->terms, a[i]) && term_bitsize(r->terms, a[i]) == nbits);
+  }
+}
+
+/*
+ * All terms in a[0 ... n-1] must have compatible types
+ * - return their common super type
+ */
+static type_t check_compatible_args(snapshot_reader_t *r, uint32_t n, const term_t *a) {
+  type_t tau;
+  uint32_t i;
+
+  assert(n > 0);
+  tau = term_type(r->terms, a[0]);
+  for (i=1; i<n; i++) {
+    tau = super_type(r->types, tau, term_type(r->terms, a[i]));
+    check_format(r, tau != NULL_TYPE);
+  }
+  return tau;
+}
+
+/*
+ * f must be a function of arity n and a[i] must be a subtype of the i-th domain
+ */
+static function_type_t *check_fun_args(snapshot_reader_t *r, term_t f, uint32_t n, const term_t *a) {
+  function_type_t *fun;
+  type_t tau;
+  uint32_t i;
+
+  tau = term_type(r->terms, f);
+  check_format(r, type_kind(r->types, tau) == FUNCTION_TYPE);
+  fun = function_type_desc(r->types, tau);
+  check_format(r, fun->ndom == n);
+  for (i=0; i<n; i++) {
+    check_format(r, is_subtype(r->types, term_type(r->terms, a[i]), fun->domain[i]));
+  }
+  return fun;
+}
+
+/*
+ * a[0 ... n-1] must be distinct variables
+ */
+static void check_bound_vars(snapshot_reader_t *r, uint32_t n, const term_t *a) {
+  ivector_t *v;
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    check_format(r, term_kind(r->terms, a[i]) == VARIABLE);
+  }
+  v = &r->vars;
+  ivector_copy(v, a, n);
+  int_array_sort(v->data, n);
+  for (i=1; i<n; i++) {
+    check_format(r, v->data[i-1] != v->data[i]);
+  }
+}
+
+
+/*
+ * Arithmetic or bitvector power product of n factors and type tau
+ */
+static term_t read_pprod(snapshot_reader_t *r, uint32_t n, type_t tau) {
+  term_table_t *terms;
+  rba_buffer_t *b;
+  bvarith64_buffer_t *b64;
+  bvarith_buffer_t *bb;
+  term_t x;
+  uint32_t i, d, nbits;
+
+  terms = r->terms;
+  check_available(r, 2 * n);
+
+  if (is_arithmetic_type(tau)) {
+    b = term_manager_get_arith_buffer(r->manager);
+    rba_buffer_set_one(b);
+    for (i=0; i<n; i++) {
+      x = read_occ(r);
+      d = read_word(r);
+      check_format(r, is_arithmetic_term(terms, x));
+      rba_buffer_mul_term_power(b, terms, x, d);
+    }
+    return mk_arith_term(r->manager, b);
+  }
+
+  if (! is_bv_type(r->types, tau)) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  nbits = bv_type_size(r->types, tau);
+  if (nbits <= 64) {
+    b64 = term_manager_get_bvarith64_buffer(r->manager);
+    bvarith64_buffer_prepare(b64, nbits);
+    bvarith64_buffer_set_one(b64);
+    for (i=0; i<n; i++) {
+      x = read_occ(r);
+      d = read_word(r);
+      check_format(r, is_bitvector_term(terms, x) && term_bitsize(terms, x) == nbits);
+      bvarith64_buffer_mul_term_power(b64, terms, x, d);
+    }
+    return mk_bvarith64_term(r->manager, b64);
+  } else {
+    bb = term_manager_get_bvarith_buffer(r->manager);
+    bvarith_buffer_prepare(bb, nbits);
+    bvarith_buffer_set_one(bb);
+    for (i=0; i<n; i++) {
+      x = read_occ(r);
+      d = read_word(r);
+      check_format(r, is_bitvector_term(terms, x) && term_bitsize(terms, x) == nbits);
+      bvarith_buffer_mul_term_power(bb, terms, x, d);
+    }
+    return mk_bvarith_term(r->manager, bb);
+  }
+}
+
+/*
+ * Polynomials with n monomials
+ */
+static term_t read_poly(snapshot_reader_t *r, uint32_t n) {
+  rba_buffer_t *b;
+  term_t x;
+  uint32_t i;
+
+  b = term_manager_get_arith_buffer(r->manager);
+  reset_rba_buffer(b);
+  for (i=0; i<n; i++) {
+    x = read_var(r);
+    read_rational(r);
+    if (x == const_idx) {
+      rba_buffer_add_const(b, &r->q);
+    } else {
+      check_format(r, is_arithmetic_term(r->terms, x));
+      rba_buffer_add_const_times_term(b, r->terms, &r->q, x);
+    }
+  }
+  return mk_arith_term(r->manager, b);
+}
+
+static term_t read_bvpoly64(snapshot_reader_t *r, uint32_t n, type_t tau) {
+  bvarith64_buffer_t *b;
+  term_t x;
+  uint64_t c;
+  uint32_t i, nbits;
+
+  if (! is_bv_type(r->types, tau) || bv_type_size(r->types, tau) > 64) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  nbits = bv_type_size(r->types, tau);
+
+  b = term_manager_get_bvarith64_buffer(r->manager);
+  bvarith64_buffer_prepare(b, nbits);
+  for (i=0; i<n; i++) {
+    x = read_var(r);
+    c = read_uint64(r);
+    if (x == const_idx) {
+      bvarith64_buffer_add_const(b, c);
+    } else {
+      check_format(r, is_bitvector_term(r->terms, x) && term_bitsize(r->terms, x) == nbits);
+      bvarith64_buffer_add_const_times_term(b, r->terms, c, x);
+    }
+  }
+  return mk_bvarith64_term(r->manager, b);
+}
+
+static term_t read_bvpoly(snapshot_reader_t *r, uint32_t n, type_t tau) {
+  bvarith_buffer_t *b;
+  term_t x;
+  uint32_t i, nbits;
+
+  if (! is_bv_type(r->types, tau) || bv_type_size(r->types, tau) <= 64) {
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+  }
+  nbits = bv_type_size(r->types, tau);
+
+  b = term_manager_get_bvarith_buffer(r->manager);
+  bvarith_buffer_prepare(b, nbits);
+  for (i=0; i<n; i++) {
+    x = read_var(r);
+    read_bvconst(r, nbits);
+    if (x == const_idx) {
+      bvarith_buffer_add_const(b, r->bv.data);
+    } else {
+      check_format(r, is_bitvector_term(r->terms, x) && term_bitsize(r->terms, x) == nbits);
+      bvarith_buffer_add_const_times_term(b, r->terms, r->bv.data, x);
+    }
+  }
+  return mk_bvarith_term(r->manager, b);
+}
+
+
+/*
+ * Composite with n arguments stored in r->aux
+ * - the arguments are type-checked first
+ */
+static term_t build_composite(snapshot_reader_t *r, term_kind_t kind, uint32_t n) {
+  term_manager_t *mngr;
+  function_type_t *fun;
+  term_t *a;
+  type_t tau;
+
+  mngr = r->manager;
+  a = r->aux.data;
+
+  switch (kind) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    if (n != 3) break;
+    check_boolean_args(r, 1, a);
+    tau = check_compatible_args(r, 2, a+1);
+    return mk_ite(mngr, a[0], a[1], a[2], tau);
+
+  case APP_TERM:
+    if (n < 2) break;
+    (void) check_fun_args(r, a[0], n-1, a+1);
+    return mk_application(mngr, a[0], n-1, a+1);
+
+  case UPDATE_TERM:
+    if (n < 3) break;
+    fun = check_fun_args(r, a[0], n-2, a+1);
+    check_format(r, is_subtype(r->types, term_type(r->terms, a[n-1]), fun->range));
+    return mk_update(mngr, a[0], n-2, a+1, a[n-1]);
+
+  case TUPLE_TERM:
+    return mk_tuple(mngr, n, a);
+
+  case EQ_TERM:
+    if (n != 2) break;
+    (void) check_compatible_args(r, 2, a);
+    return mk_eq(mngr, a[0], a[1]);
+
+  case DISTINCT_TERM:
+    if (n < 2) break;
+    (void) check_compatible_args(r, n, a);
+    return mk_distinct(mngr, n, a);
+
+  case FORALL_TERM:
+    if (n < 2) break;
+    check_bound_vars(r, n-1, a);
+    check_boolean_args(r, 1, a+n-1);
+    return mk_forall(mngr, n-1, a, a[n-1]);
+
+  case LAMBDA_TERM:
+    if (n < 2) break;
+    check_bound_vars(r, n-1, a);
+    return mk_lambda(mngr, n-1, a, a[n-1]);
+
+  case OR_TERM:
+    check_boolean_args(r, n, a);
+    return mk_or(mngr, n, a);
+
+  case XOR_TERM:
+    check_boolean_args(r, n, a);
+    return mk_xor(mngr, n, a);
+
+  case ARITH_BINEQ_ATOM:
+    if (n != 2) break;
+    check_arith_args(r, 2, a);
+    return mk_arith_eq(mngr, a[0], a[1]);
+
+  case ARITH_RDIV:
+    if (n != 2) break;
+    check_arith_args(r, 2, a);
+    return mk_arith_rdiv(mngr, a[0], a[1]);
+
+  case ARITH_IDIV:
+    if (n != 2) break;
+    check_arith_args(r, 2, a);
+    return mk_arith_idiv(mngr, a[0], a[1]);
+
+  case ARITH_MOD:
+    if (n != 2) break;
+    check_arith_args(r, 2, a);
+    return mk_arith_mod(mngr, a[0], a[1]);
+
+  case ARITH_DIVIDES_ATOM:
+    if (n != 2) break;
+    check_arith_args(r, 2, a);
+    check_format(r, term_kind(r->terms, a[0]) == ARITH_CONSTANT);
+    return mk_arith_divides(mngr, a[0], a[1]);
+
+  case BV_ARRAY:
+    if (n > YICES_MAX_BVSIZE) break;
+    check_boolean_args(r, n, a);
+    return mk_bvarray(mngr, n, a);
+
+  case BV_DIV:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvdiv(mngr, a[0], a[1]);
+
+  case BV_REM:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvrem(mngr, a[0], a[1]);
+
+  case BV_SDIV:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvsdiv(mngr, a[0], a[1]);
+
+  case BV_SREM:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvsrem(mngr, a[0], a[1]);
+
+  case BV_SMOD:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvsmod(mngr, a[0], a[1]);
+
+  case BV_SHL:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvshl(mngr, a[0], a[1]);
+
+  case BV_LSHR:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvlshr(mngr, a[0], a[1]);
+
+  case BV_ASHR:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvashr(mngr, a[0], a[1]);
+
+  case BV_EQ_ATOM:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bveq(mngr, a[0], a[1]);
+
+  case BV_GE_ATOM:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvge(mngr, a[0], a[1]);
+
+  case BV_SGE_ATOM:
+    if (n != 2) break;
+    check_bv_args(r, 2, a);
+    return mk_bvsge(mngr, a[0], a[1]);
+
+  default:
+    break;
+  }
+
+  longjmp(r->env, SNAP_FORMAT_ERROR);
+}
+
+
+/*
+ * Unary arithmetic term or atom of the given kind (x is arithmetic)
+ */
+static term_t build_arith_unary(snapshot_reader_t *r, term_kind_t kind, term_t x) {
+  term_manager_t *mngr;
+
+  mngr = r->manager;
+  switch (kind) {
+  case ARITH_EQ_ATOM:
+    return mk_arith_term_eq0(mngr, x);
+
+  case ARITH_GE_ATOM:
+    return mk_arith_term_geq0(mngr, x);
+
+  case ARITH_IS_INT_ATOM:
+    return mk_arith_is_int(mngr, x);
+
+  case ARITH_FLOOR:
+    return mk_arith_floor(mngr, x);
+
+  case ARITH_CEIL:
+    return mk_arith_ceil(mngr, x);
+
+  default:
+    assert(kind == ARITH_ABS);
+    return mk_arith_abs(mngr, x);
+  }
+}
+
+
+/*
+ * Read a term record
+ */
+static void read_term_record(snapshot_reader_t *r) {
+  term_manager_t *mngr;
+  term_kind_t kind;
+  type_t tau;
+  term_t t, x;
+  uint32_t n, idx;
+
+  mngr = r->manager;
+  kind = read_word(r);
+  tau = read_type(r);
+
+  switch (kind) {
+  case CONSTANT_TERM:
+    idx = read_word(r);
+    if ((type_kind(r->types, tau) != SCALAR_TYPE && type_kind(r->types, tau) != UNINTERPRETED_TYPE) ||
+        idx > (uint32_t) INT32_MAX ||
+        (type_kind(r->types, tau) == SCALAR_TYPE && idx >= scalar_type_cardinal(r->types, tau))) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    t = mk_constant(mngr, tau, idx);
+    break;
+
+  case ARITH_CONSTANT:
+    read_rational(r);
+    t = mk_arith_constant(mngr, &r->q);
+    break;
+
+  case BV64_CONSTANT:
+    n = read_word(r);
+    if (n == 0 || n > 64) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    bvconstant_copy64(&r->bv, n, read_uint64(r));
+    t = mk_bv_constant(mngr, &r->bv);
+    break;
+
+  case BV_CONSTANT:
+    n = read_word(r);
+    if (n <= 64 || n > YICES_MAX_BVSIZE) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    read_bvconst(r, n);
+    t = mk_bv_constant(mngr, &r->bv);
+    break;
+
+  case VARIABLE:
+    t = mk_variable(mngr, tau);
+    break;
+
+  case UNINTERPRETED_TERM:
+    t = mk_uterm(mngr, tau);
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    x = read_occ(r);
+    check_arith_args(r, 1, &x);
+    t = build_arith_unary(r, kind, x);
+    break;
+
+  case SELECT_TERM:
+    idx = read_word(r);
+    x = read_occ(r);
+    tau = term_type(r->terms, x);
+    if (type_kind(r->types, tau) != TUPLE_TYPE || idx >= tuple_type_desc(r->types, tau)->nelem) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    t = mk_select(mngr, idx, x);
+    break;
+
+  case BIT_TERM:
+    idx = read_word(r);
+    x = read_occ(r);
+    if (! is_bv_type(r->types, term_type(r->terms, x)) || idx >= term_bitsize(r->terms, x)) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    t = mk_bitextract(mngr, x, idx);
+    break;
+
+  case POWER_PRODUCT:
+    n = read_word(r);
+    t = read_pprod(r, n, tau);
+    break;
+
+  case ARITH_POLY:
+    n = read_word(r);
+    t = read_poly(r, n);
+    break;
+
+  case BV64_POLY:
+    n = read_word(r);
+    t = read_bvpoly64(r, n, tau);
+    break;
+
+  case BV_POLY:
+    n = read_word(r);
+    t = read_bvpoly(r, n, tau);
+    break;
+
+  default:
+    n = read_word(r);
+    if (n == 0 || n > YICES_MAX_ARITY) {
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    read_args(r, n);
+    t = build_composite(r, kind, n);
+    break;
+  }
+
+  r->term_map[r->nterms] = t;
+  r->nterms ++;
+}
+
+
+/*
+ * Read a name record
+ */
+static void read_name_record(snapshot_reader_t *r) {
+  uint32_t tag;
+  uint32_t x;
+  term_t t;
+  char *s;
+
+  tag = read_word(r);
+  x = read_word(r);
+  s = read_string(r);
+
+  switch (tag) {
+  case SNAPSHOT_TERM_NAME:
+    if ((x >> 1) < NUM_PREDEFINED_TERMS || (x >> 1) >= r->nterms) {
+      safe_free(s);
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    t = r->term_map[x >> 1] ^ (x & 1);
+    if (is_neg_term(t) && !is_boolean_term(r->terms, t)) {
+      safe_free(s);
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    set_term_name(r->terms, t, clone_string(s));
+    ivector_push(&r->named, t);
+    break;
+
+  case SNAPSHOT_TYPE_NAME:
+    if (x < NUM_PREDEFINED_TYPES || x >= r->ntypes) {
+      safe_free(s);
+      longjmp(r->env, SNAP_FORMAT_ERROR);
+    }
+    set_type_name(r->types, r->type_map[x], clone_string(s));
+    break;
+
+  default:
+    safe_free(s);
+    longjmp(r->env, SNAP_FORMAT_ERROR);
+    break;
+  }
+
+  safe_free(s);
+}
+
+
+/*
+ * Restore the snapshot stored in data[0 ... size-1]
+ */
+static int32_t restore_snapshot(snapshot_reader_t *r) {
+  const uint32_t *h;
+  uint32_t ntypes, nterms, nnames, nroots, nextra, next, i;
+  int32_t code;
+
+  h = r->data;
+  if (r->size < SNAPSHOT_HEADER_SIZE || h[0] != SNAPSHOT_MAGIC ||
+      h[1] != SNAPSHOT_VERSION || h[2] != SNAPSHOT_BOM ||
+      h[9] != r->size - SNAPSHOT_HEADER_SIZE ||
+      h[10] != jenkins_hash_array(h + SNAPSHOT_HEADER_SIZE, h[9], 0x1234)) {
+    return SNAP_FORMAT_ERROR;
+  }
+
+  ntypes = h[3];
+  nterms = h[4];
+  nnames = h[5];
+  nroots = h[6];
+  nextra = h[7];
+  next = h[8];
+
+  // every type and term record has at least one word
+  if (ntypes > h[9] || nterms > h[9] || next > h[9]) {
+    return SNAP_FORMAT_ERROR;
+  }
+
+  r->type_map = (type_t *) safe_malloc((ntypes + NUM_PREDEFINED_TYPES) * sizeof(type_t));
+  r->term_map = (term_t *) safe_malloc((nterms + NUM_PREDEFINED_TERMS) * sizeof(term_t));
+  for (i=0; i<NUM_PREDEFINED_TYPES; i++) {
+    r->type_map[i] = i;
+  }
+  for (i=0; i<NUM_PREDEFINED_TERMS; i++) {
+    r->term_map[i] = pos_term(i);
+  }
+  r->ntypes = NUM_PREDEFINED_TYPES;
+  r->nterms = NUM_PREDEFINED_TERMS;
+  r->pos = SNAPSHOT_HEADER_SIZE;
+
+  code = setjmp(r->env);
+  if (code == 0) {
+    for (i=0; i<ntypes; i++) {
+      read_type_record(r);
+    }
+    for (i=0; i<nterms; i++) {
+      read_term_record(r);
+    }
+    for (i=0; i<nnames; i++) {
+      read_name_record(r);
+    }
+    check_available(r, nroots);
+    for (i=0; i<nroots; i++) {
+      ivector_push(&r->roots, read_occ(r));
+    }
+    check_available(r, nextra);
+    for (i=0; i<nextra; i++) {
+      ivector_push(&r->roots, read_occ(r));
+    }
+    r->nroots = nroots;
+    r->ext = r->data + r->pos;
+    r->next = next;
+    if (next != r->size - r->pos) {
+      code = SNAP_FORMAT_ERROR;
+    }
+  }
+
+  return code;
+}
+
+
+#if defined(MINGW)
+
+/*
+ * No mmap: read the whole file
+ */
+static uint32_t *map_snapshot(int fd, size_t size) {
+  uint32_t *data;
+  size_t n;
+  ssize_t k;
+
+  data = (uint32_t *) safe_malloc(size);
+  n = 0;
+  while (n < size) {
+    k = read(fd, ((char *) data) + n, size - n);
+    if (k <= 0) {
+      safe_free(data);
+      return NULL;
+    }
+    n += k;
+  }
+  return data;
+}
+
+static void unmap_snapshot(uint32_t *data, size_t size) {
+  safe_free(data);
+}
+
+#else
+
+static uint32_t *map_snapshot(int fd, size_t size) {
+  void *data;
+
+  data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  return data == MAP_FAILED ? NULL : data;
+}
+
+static void unmap_snapshot(uint32_t *data, size_t size) {
+  munmap(data, size);
+}
+
+#endif
+
+
+int32_t load_term_snapshot_ext(const char *filename, term_manager_t *manager, ivector_t *v, ivector_t *named,
+                               snapshot_ext_fun_t fun, void *aux) {
+  snapshot_reader_t reader;
+  struct stat s;
+  uint32_t *data;
+  size_t size;
+  int32_t code;
+  int fd;
+
+  fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return SNAP_IO_ERROR;
+  }
+  if (fstat(fd, &s) < 0) {
+    close(fd);
+    return SNAP_IO_ERROR;
+  }
+
+  size = s.st_size;
+  if (size < SNAPSHOT_HEADER_SIZE * sizeof(uint32_t) || (size & 3) != 0 ||
+      size / sizeof(uint32_t) > UINT32_MAX) {
+    close(fd);
+    return SNAP_FORMAT_ERROR;
+  }
+
+  data = map_snapshot(fd, size);
+  close(fd);
+  if (data == NULL) {
+    return SNAP_IO_ERROR;
+  }
+
+  init_snapshot_reader(&reader, manager, data, size / sizeof(uint32_t));
+  if (fun != NULL && data[8] == 0) {
+    // no extension: don't create any term
+    code = SNAP_FORMAT_ERROR;
+  } else {
+    code = restore_snapshot(&reader);
+  }
+  if (code == 0 && fun != NULL) {
+    code = fun(aux, reader.roots.data, reader.roots.size, reader.ext, reader.next);
+  }
+  if (code == 0) {
+    ivector_add(v, reader.roots.data, reader.nroots);
+    if (named != NULL) {
+      ivector_add(named, reader.named.data, reader.named.size);
+    }
+  }
+  delete_snapshot_reader(&reader);
+  unmap_snapshot(data, size);
+
+  return code;
+}
+
+
+int32_t load_term_snapshot(const char *filename, term_manager_t *manager, ivector_t *v, ivector_t *named) {
+  return load_term_snapshot_ext(filename, manager, v, named, NULL, NULL);
+}
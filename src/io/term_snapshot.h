@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * BINARY SNAPSHOTS OF TERMS
+ *
+ * A snapshot stores a set of root terms (typically the assertions of
+ * a benchmark), all the terms and types they depend on, and the names
+ * of these terms and types. Restoring a snapshot rebuilds the terms
+ * in the term table without going through a parser, so a process that
+ * solves the same base problem many times can skip parsing and term
+ * construction.
+ *
+ * File format: an array of 32bit words in native byte order
+ * - header: magic number, version, byte-order mark, number of types,
+ *   number of terms, number of names, number of roots, number of
+ *   extra roots, size of the extension, size of the body (in words),
+ *   checksum of the body.
+ * - body:
+ *   1) type records in topological order (children first)
+ *   2) term records in topological order
+ *   3) name records
+ *   4) root terms then extra roots
+ *   5) extension: an opaque block of words stored by the client
+ *
+ * The extra roots and the extension are used by context snapshots
+ * (see context/context_snapshot.h). The extension refers to terms by
+ * their position in the array of roots. Extra roots are not returned
+ * by load_term_snapshot.
+ *
+ * In the body, a type is identified by its rank in the snapshot and a
+ * term occurrence is encoded as (rank << 1 | polarity) like term_t.
+ * The predefined types (bool, int, real) and the predefined terms
+ * (true, zero) have the same index as in the term and type tables.
+ *
+ * Restoring is done on a read-only memory map of the file. A snapshot
+ * is valid only for the same version and byte order as the process
+ * that created it.
+ *
+ * Terms and types that can't be stored in a snapshot:
+ * - finite-field terms and types
+ * - type variables and type instances
+ * - root atoms (from MCSAT)
+ */
+
+#ifndef __TERM_SNAPSHOT_H
+#define __TERM_SNAPSHOT_H
+
+#include <stdint.h>
+
+#include "terms/term_manager.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Header fields
+ */
+#define SNAPSHOT_MAGIC    0x504e5359u  // "YSNP" in little endian
+#define SNAPSHOT_VERSION  2u
+#define SNAPSHOT_BOM      0x01020304u
+
+#define SNAPSHOT_HEADER_SIZE 11
+
+
+/*
+ * Error codes returned by the save and load functions
+ * - SNAP_IO_ERROR: the file could not be opened, read, or written
+ *   (errno is set)
+ * - SNAP_FORMAT_ERROR: the file is not a snapshot, or it was
+ *   produced by a different version or on a machine with a
+ *   different byte order, or it's corrupted
+ * - SNAP_UNSUPPORTED_TERM: a term or its type can't be stored
+ * - SNAP_UNSUPPORTED_CONTEXT: used by context snapshots
+ */
+enum {
+  SNAP_IO_ERROR = -1,
+  SNAP_FORMAT_ERROR = -2,
+  SNAP_UNSUPPORTED_TERM = -3,
+  SNAP_UNSUPPORTED_CONTEXT = -4,
+};
+
+
+/*
+ * Save terms a[0 ... n-1] and all their subterms to filename.
+ * - all terms must be valid in terms
+ * - return 0 if the snapshot was written
+ * - return SNAP_IO_ERROR if the file can't be written
+ * - return SNAP_UNSUPPORTED_TERM if one of the subterms can't be
+ *   stored. The offending term is returned in *bad.
+ */
+extern int32_t save_term_snapshot(const char *filename, term_table_t *terms, uint32_t n, const term_t *a, term_t *bad);
+
+
+/*
+ * Variant with extra roots and an extension
+ * - b[0 ... m-1] = extra roots (stored after a[0 ... n-1])
+ * - ext = content of the extension (NULL means empty)
+ * - return codes are as in save_term_snapshot
+ */
+extern int32_t save_term_snapshot_ext(const char *filename, term_table_t *terms, uint32_t n, const term_t *a,
+                                      uint32_t m, const term_t *b, const ivector_t *ext, term_t *bad);
+
+
+/*
+ * Restore the snapshot stored in filename
+ * - the terms are rebuilt using the manager (and the manager's term and
+ *   type tables). Names stored in the snapshot are given to the
+ *   corresponding terms and types.
+ * - the root terms are added to vector v (in the same order as they
+ *   were saved)
+ * - if named is non-NULL, the term occurrences that received a name
+ *   are added to named
+ * - return 0 if the snapshot was restored
+ * - return SNAP_IO_ERROR or SNAP_FORMAT_ERROR otherwise
+ *   (in this case, v and named are unchanged but some new terms and types may
+ *   have been created)
+ *
+ * New uninterpreted terms and new variables are created for the
+ * uninterpreted terms and variables in the snapshot. Likewise, new
+ * scalar and uninterpreted types are created.
+ */
+extern int32_t load_term_snapshot(const char *filename, term_manager_t *manager, ivector_t *v, ivector_t *named);
+
+
+/*
+ * Function to process the extension of a snapshot
+ * - aux = client data
+ * - roots = all the restored roots (n roots followed by m extra roots)
+ * - ext[0 ... size-1] = the extension (it's read-only and valid only
+ *   until the function returns)
+ * - the function must return 0 if the extension is processed or
+ *   a negative error code otherwise
+ */
+typedef int32_t (*snapshot_ext_fun_t)(void *aux, const term_t *roots, uint32_t nroots, const uint32_t *ext, uint32_t size);
+
+
+/*
+ * Variant of load_term_snapshot that processes the extension
+ * - if fun is non-NULL, it's called on the extension after the terms
+ *   are restored and the value it returns is returned. If fun is NULL,
+ *   the extension is ignored.
+ * - if fun is non-NULL and the snapshot has no extension, the function
+ *   returns SNAP_FORMAT_ERROR without restoring anything
+ * - the roots are added to v (not the extra roots) only if the
+ *   snapshot is restored and fun succeeds
+ */
+extern int32_t load_term_snapshot_ext(const char *filename, term_manager_t *manager, ivector_t *v, ivector_t *named,
+                                      snapshot_ext_fun_t fun, void *aux);
+
+
+#endif /* __TERM_SNAPSHOT_H */
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mcsat/nra/nra_atom_cache.h"
+#include "mcsat/utils/lp_utils.h"
+
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+#include <poly/polynomial.h>
+#include <assert.h>
+
+static
+int32_t* nra_atom_cache_alloc_index(uint32_t n) {
+  int32_t* index;
+  uint32_t i;
+
+  assert(n > 0 && (n & (n - 1)) == 0);
+  index = (int32_t*) safe_malloc(n * sizeof(int32_t));
+  for (i = 0; i < n; ++ i) {
+    index[i] = -1;
+  }
+  return index;
+}
+
+void nra_atom_cache_construct(nra_atom_cache_t* cache) {
+  cache->entry = NULL;
+  cache->nentries = 0;
+  cache->size = 0;
+  cache->index = nra_atom_cache_alloc_index(NRA_ATOM_CACHE_DEFAULT_HSIZE);
+  cache->hsize = NRA_ATOM_CACHE_DEFAULT_HSIZE;
+}
+
+void nra_atom_cache_reset(nra_atom_cache_t* cache) {
+  uint32_t i;
+
+  for (i = 0; i < cache->nentries; ++ i) {
+    lp_polynomial_delete(cache->entry[i].p);
+  }
+  cache->nentries = 0;
+  for (i = 0; i < cache->hsize; ++ i) {
+    cache->index[i] = -1;
+  }
+}
+
+void nra_atom_cache_destruct(nra_atom_cache_t* cache) {
+  nra_atom_cache_reset(cache);
+  safe_free(cache->entry);
+  safe_free(cache->index);
+  cache->entry = NULL;
+  cache->index = NULL;
+}
+
+static inline
+uint32_t nra_atom_cache_slot_hash(uint32_t p_hash, lp_sign_condition_t sgn) {
+  return jenkins_hash_pair(p_hash, sgn, 0x5e0b7c21);
+}
+
+term_t nra_atom_cache_find(const nra_atom_cache_t* cache, const lp_polynomial_t* p, lp_sign_condition_t sgn) {
+  const nra_atom_cache_entry_t* e;
+  uint32_t p_hash, i, mask;
+  int32_t k;
+
+  if (cache->nentries == 0) {
+    return NULL_TERM;
+  }
+
+  p_hash = lp_polynomial_order_independent_hash(p);
+  mask = cache->hsize - 1;
+  i = nra_atom_cache_slot_hash(p_hash, sgn) & mask;
+  for (;;) {
+    k = cache->index[i];
+    if (k < 0) {
+      return NULL_TERM;
+    }
+    e = cache->entry + k;
+    if (e->hash == p_hash && e->sgn == sgn && lp_polynomial_cmp(e->p, p) == 0) {
+      return e->atom;
+    }
+    i = (i + 1) & mask;
+  }
+}
+
+/** Store entry k in the index (of size mask + 1) */
+static
+void nra_atom_cache_index_add(int32_t* index, uint32_t mask, const nra_atom_cache_entry_t* e, int32_t k) {
+  uint32_t i;
+
+  i = nra_atom_cache_slot_hash(e->hash, e->sgn) & mask;
+  while (index[i] >= 0) {
+    i = (i + 1) & mask;
+  }
+  index[i] = k;
+}
+
+static
+void nra_atom_cache_extend(nra_atom_cache_t* cache) {
+  uint32_t n, i;
+
+  if (cache->nentries == cache->size) {
+    n = cache->size == 0 ? 64 : cache->size + (cache->size >> 1);
+    if (n > NRA_ATOM_CACHE_MAX_SIZE) {
+      out_of_memory();
+    }
+    cache->entry = (nra_atom_cache_entry_t*) safe_realloc(cache->entry, n * sizeof(nra_atom_cache_entry_t));
+    cache->size = n;
+  }
+
+  // Keep the hash table at most half full
+  if (2 * (cache->nentries + 1) > cache->hsize) {
+    n = 2 * cache->hsize;
+    safe_free(cache->index);
+    cache->index = nra_atom_cache_alloc_index(n);
+    cache->hsize = n;
+    for (i = 0; i < cache->nentries; ++ i) {
+      nra_atom_cache_index_add(cache->index, n - 1, cache->entry + i, i);
+    }
+  }
+}
+
+void nra_atom_cache_add(nra_atom_cache_t* cache, const lp_polynomial_t* p, lp_sign_condition_t sgn, term_t atom) {
+  nra_atom_cache_entry_t* e;
+  uint32_t k;
+
+  assert(nra_atom_cache_find(cache, p, sgn) == NULL_TERM);
+
+  nra_atom_cache_extend(cache);
+
+  k = cache->nentries;
+  e = cache->entry + k;
+  e->p = lp_polynomial_new_copy(p);
+  e->hash = lp_polynomial_order_independent_hash(p);
+  e->sgn = sgn;
+  e->atom = atom;
+  cache->nentries = k + 1;
+
+  nra_atom_cache_index_add(cache->index, cache->hsize - 1, e, k);
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Cache of the atoms (p sgn 0) produced by the NRA explanations.
+ *
+ * Explanations often use the same polynomial constraints again. Building
+ * the atom goes through an arithmetic buffer and the term manager each
+ * time, so the atoms are kept here, indexed by polynomial and sign
+ * condition. The polynomials are copies owned by the cache.
+ *
+ * The hash codes don't depend on the variable order so entries stay valid
+ * when the order changes. The cache must be reset when the atoms may be
+ * garbage collected or the libpoly variables remapped.
+ */
+
+#pragma once
+
+#include <poly/poly.h>
+#include <stdint.h>
+
+#include "terms/terms.h"
+
+typedef struct nra_atom_cache_entry_s {
+  /** The polynomial (owned) */
+  lp_polynomial_t* p;
+  /** Its hash code */
+  uint32_t hash;
+  /** The sign condition */
+  lp_sign_condition_t sgn;
+  /** The atom (p sgn 0) */
+  term_t atom;
+} nra_atom_cache_entry_t;
+
+typedef struct nra_atom_cache_s {
+  /** Entries */
+  nra_atom_cache_entry_t* entry;
+  uint32_t nentries;
+  uint32_t size;
+  /** Hash table: indices in entry or -1 */
+  int32_t* index;
+  uint32_t hsize;
+} nra_atom_cache_t;
+
+#define NRA_ATOM_CACHE_DEFAULT_HSIZE 256
+#define NRA_ATOM_CACHE_MAX_SIZE (UINT32_MAX/(2*sizeof(nra_atom_cache_entry_t)))
+
+/** Construct an empty cache */
+void nra_atom_cache_construct(nra_atom_cache_t* cache);
+
+/** Destruct the cache */
+void nra_atom_cache_destruct(nra_atom_cache_t* cache);
+
+/** Remove all entries */
+void nra_atom_cache_reset(nra_atom_cache_t* cache);
+
+/** Get the atom for (p sgn 0), or NULL_TERM if it's not in the cache */
+term_t nra_atom_cache_find(const nra_atom_cache_t* cache, const lp_polynomial_t* p, lp_sign_condition_t sgn);
+
+/** Add the atom for (p sgn 0), there must be no entry for (p, sgn) */
+void nra_atom_cache_add(nra_atom_cache_t* cache, const lp_polynomial_t* p, lp_sign_condition_t sgn, term_t atom);
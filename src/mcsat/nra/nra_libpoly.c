@@ -64,6 +64,45 @@ term_t lp_polynomial_to_yices_term_nra(nra_plugin_t *nra, const lp_polynomial_t
   return result;
 }
 
+term_t nra_polynomial_sign_atom(nra_plugin_t *nra, const lp_polynomial_t *p, lp_sign_condition_t sgn) {
+  term_manager_t* tm = nra->ctx->tm;
+  term_t p_term, atom;
+
+  atom = nra_atom_cache_find(&nra->atom_cache, p, sgn);
+  if (atom != NULL_TERM) {
+    (*nra->stats.atom_cache_hits) ++;
+    return atom;
+  }
+
+  p_term = lp_polynomial_to_yices_term_nra(nra, p);
+  switch (sgn) {
+  case LP_SGN_LT_0:
+    atom = mk_arith_term_lt0(tm, p_term);
+    break;
+  case LP_SGN_LE_0:
+    atom = mk_arith_term_leq0(tm, p_term);
+    break;
+  case LP_SGN_EQ_0:
+    atom = mk_arith_term_eq0(tm, p_term);
+    break;
+  case LP_SGN_NE_0:
+    atom = mk_arith_term_neq0(tm, p_term);
+    break;
+  case LP_SGN_GT_0:
+    atom = mk_arith_term_gt0(tm, p_term);
+    break;
+  case LP_SGN_GE_0:
+    atom = mk_arith_term_geq0(tm, p_term);
+    break;
+  default:
+    assert(false);
+  }
+
+  nra_atom_cache_add(&nra->atom_cache, p, sgn, atom);
+
+  return atom;
+}
+
 void nra_poly_constraint_add(nra_plugin_t *nra, variable_t constraint_var) {
   if (poly_constraint_db_has(nra->constraint_db, constraint_var)) {
     // Already added
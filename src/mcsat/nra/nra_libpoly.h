@@ -38,6 +38,12 @@ lp_polynomial_t* lp_polynomial_from_term_nra(nra_plugin_t* nra, term_t p, lp_int
  */
 term_t lp_polynomial_to_yices_term_nra(nra_plugin_t *nra, const lp_polynomial_t *lp_p);
 
+/**
+ * Get the atom (p sgn 0). The atoms are cached in the plugin so that the
+ * explanations don't build the same atoms again.
+ */
+term_t nra_polynomial_sign_atom(nra_plugin_t *nra, const lp_polynomial_t *p, lp_sign_condition_t sgn);
+
 /** Compute an approximation of the constraint value with interval computation */
 const mcsat_value_t* nra_poly_constraint_db_approximate(nra_plugin_t* nra, variable_t constraint_var);
 
@@ -68,6 +68,9 @@ void nra_plugin_stats_init(nra_plugin_t* nra) {
   nra->stats.evaluations = statistics_new_int(nra->ctx->stats, "mcsat::nra::evaluations");
   nra->stats.constraint_regular = statistics_new_int(nra->ctx->stats, "mcsat::nra::constraints_regular");
   nra->stats.constraint_root = statistics_new_int(nra->ctx->stats, "mcsat::nra::constraints_root");
+  nra->stats.atom_cache_hits = statistics_new_int(nra->ctx->stats, "mcsat::nra::atom_cache_hits");
+  nra->stats.psc_cache_hits = statistics_new_int(nra->ctx->stats, "mcsat::nra::psc_cache_hits");
+  nra->stats.psc_cache_misses = statistics_new_int(nra->ctx->stats, "mcsat::nra::psc_cache_misses");
 }
 
 static
@@ -142,6 +145,8 @@ void nra_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
   ctx->request_decision_calls(ctx, SCALAR_TYPE);
 
   init_rba_buffer(&nra->buffer, ctx->terms->pprods);
+  nra_atom_cache_construct(&nra->atom_cache);
+  nra_psc_cache_construct(&nra->psc_cache, NRA_PSC_CACHE_DEFAULT_CAPACITY);
 
   nra->global_bound_term = NULL_TERM;
 
@@ -183,6 +188,10 @@ void nra_plugin_destruct(plugin_t* plugin) {
 
   feasible_set_db_delete(nra->feasible_set_db);
 
+  // the caches keep polynomials: delete them before lp_data
+  nra_atom_cache_destruct(&nra->atom_cache);
+  nra_psc_cache_destruct(&nra->psc_cache);
+
   lp_data_destruct(&nra->lp_data);
 
   delete_rba_buffer(&nra->buffer);
@@ -1882,6 +1891,12 @@ void nra_plugin_gc_sweep(plugin_t* plugin, const gc_info_t* gc_vars) {
   // Unit information (constraint_unit_info, constraint_unit_var)
   constraint_unit_info_gc_sweep(&nra->unit_info, gc_vars);
 
+  // Cached atoms (they are not marked, and the lp variables may be remapped)
+  nra_atom_cache_reset(&nra->atom_cache);
+
+  // Cached subresultants (same reason)
+  nra_psc_cache_reset(&nra->psc_cache);
+
   // Watch list manager
   watch_list_manager_gc_sweep_lists(&nra->wlm, gc_vars);
 }
@@ -109,6 +109,9 @@ struct lp_projection_map_struct {
   /** Plugin context (if available) */
   plugin_context_t* plugin_ctx;
 
+  /** The plugin (if available, used to cache the atoms) */
+  nra_plugin_t* nra;
+
   /** Tmp buffer */
   rba_buffer_t* buffer;
   bool external_buffer;
@@ -143,6 +146,7 @@ void lp_projection_map_construct(lp_projection_map_t* map,
   map->use_root_constraints_for_cells = true;
   map->tm = tm;
   map->plugin_ctx = ctx;
+  map->nra = NULL;
   map->use_mgcd = use_mgcd;
   map->use_nlsat = use_nlsat;
 
@@ -163,6 +167,7 @@ void lp_projection_map_construct_from_nra(lp_projection_map_t* map, nra_plugin_t
   lp_projection_map_construct(map,
       nra->ctx->tm, &nra->lp_data, &nra->buffer, nra->ctx,
       nra->ctx->options->nra_mgcd, nra->ctx->options->nra_nlsat);
+  map->nra = nra;
 }
 
 void lp_projection_map_destruct(lp_projection_map_t* map) {
@@ -186,6 +191,34 @@ term_t lp_projection_map_polynomial_to_term(lp_projection_map_t* map, const lp_p
   return lp_polynomial_to_yices_arith_term(map->lp_data, p, map->tm->terms, map->buffer);
 }
 
+/** Make the atom (p sgn 0), use the plugin cache if available */
+static
+term_t lp_projection_map_sign_atom(lp_projection_map_t* map, const lp_polynomial_t* p, lp_sign_condition_t sgn) {
+  if (map->nra != NULL) {
+    return nra_polynomial_sign_atom(map->nra, p, sgn);
+  }
+
+  term_manager_t* tm = map->tm;
+  term_t p_term = lp_projection_map_polynomial_to_term(map, p);
+  switch (sgn) {
+  case LP_SGN_LT_0:
+    return mk_arith_term_lt0(tm, p_term);
+  case LP_SGN_LE_0:
+    return mk_arith_term_leq0(tm, p_term);
+  case LP_SGN_EQ_0:
+    return mk_arith_term_eq0(tm, p_term);
+  case LP_SGN_NE_0:
+    return mk_arith_term_neq0(tm, p_term);
+  case LP_SGN_GT_0:
+    return mk_arith_term_gt0(tm, p_term);
+  case LP_SGN_GE_0:
+    return mk_arith_term_geq0(tm, p_term);
+  default:
+    assert(false);
+    return NULL_TERM;
+  }
+}
+
 lp_polynomial_hash_set_t* lp_projection_map_get_set_of(lp_projection_map_t* map, lp_variable_t var) {
 
   assert(var != variable_null);
@@ -366,34 +399,34 @@ void lp_projection_map_describe_cell_part(lp_projection_map_t* map, lp_variable_
     // x r -b/a  [ a is positive ]
     // ax + b r 0
 
-    term_t p_term = lp_projection_map_polynomial_to_term(map, p);
-
-    if (ctx_trace_enabled(map->plugin_ctx, "nra::explain::projection")) {
-      ctx_trace_printf(map->plugin_ctx, "p_term = "); ctx_trace_term(map->plugin_ctx, p_term);
-    }
-
+    lp_sign_condition_t sgn = LP_SGN_EQ_0;
     switch (r) {
     case ROOT_ATOM_LT:
-      root_atom = mk_arith_term_lt0(tm, p_term);
+      sgn = LP_SGN_LT_0;
       break;
     case ROOT_ATOM_LEQ:
-      root_atom = mk_arith_term_leq0(tm, p_term);
+      sgn = LP_SGN_LE_0;
       break;
     case ROOT_ATOM_EQ:
-      root_atom = mk_arith_term_eq0(tm, p_term);
+      sgn = LP_SGN_EQ_0;
       break;
     case ROOT_ATOM_NEQ:
-      root_atom = mk_arith_term_neq0(tm, p_term);
+      sgn = LP_SGN_NE_0;
       break;
     case ROOT_ATOM_GEQ:
-      root_atom = mk_arith_term_geq0(tm, p_term);
+      sgn = LP_SGN_GE_0;
       break;
     case ROOT_ATOM_GT:
-      root_atom = mk_arith_term_gt0(tm, p_term);
+      sgn = LP_SGN_GT_0;
       break;
     default:
       assert(false);
     }
+    root_atom = lp_projection_map_sign_atom(map, p, sgn);
+
+    if (ctx_trace_enabled(map->plugin_ctx, "nra::explain::projection")) {
+      ctx_trace_printf(map->plugin_ctx, "root_atom = "); ctx_trace_term(map->plugin_ctx, root_atom);
+    }
   } else {
     // Regular root atom
     if (map->use_root_constraints_for_cells) {
@@ -406,14 +439,13 @@ void lp_projection_map_describe_cell_part(lp_projection_map_t* map, lp_variable_
       lp_polynomial_t* current_d = lp_data_new_polynomial(map->lp_data);
       while (!lp_polynomial_is_constant(current)) {
         int current_sgn = lp_polynomial_sgn(current, map->lp_data->lp_assignment);
-        term_t current_term = lp_projection_map_polynomial_to_term(map, current);
         term_t current_literal;
         if (current_sgn < 0) {
-          current_literal = mk_arith_term_lt0(tm, current_term);
+          current_literal = lp_projection_map_sign_atom(map, current, LP_SGN_LT_0);
         } else if (current_sgn > 0) {
-          current_literal = mk_arith_term_gt0(tm, current_term);
+          current_literal = lp_projection_map_sign_atom(map, current, LP_SGN_GT_0);
         } else {
-          current_literal = mk_arith_term_eq0(tm, current_term);
+          current_literal = lp_projection_map_sign_atom(map, current, LP_SGN_EQ_0);
         }
         // Add to output
 #if TRACE
@@ -726,17 +758,35 @@ void lp_projection_map_add_psc(lp_projection_map_t* map, lp_polynomial_t*** poly
   size_t q_deg = lp_polynomial_degree(q);
 
   uint32_t psc_size = p_deg > q_deg ? q_deg + 1 : p_deg + 1;
-  polynomial_buffer_ensure_size(polynomial_buffer, polynomial_buffer_size, psc_size, map->lp_data->lp_ctx);
 
-  // Get the psc
-  lp_polynomial_psc(*polynomial_buffer, p, q);
+  // Get the psc (from the plugin cache if possible)
+  lp_polynomial_t** psc = NULL;
+  if (map->nra != NULL) {
+    uint32_t cached_size;
+    psc = nra_psc_cache_find(&map->nra->psc_cache, x, p, q, &cached_size);
+    if (psc != NULL) {
+      assert(cached_size == psc_size);
+      (*map->nra->stats.psc_cache_hits) ++;
+    } else {
+      (*map->nra->stats.psc_cache_misses) ++;
+    }
+  }
+  if (psc == NULL) {
+    polynomial_buffer_ensure_size(polynomial_buffer, polynomial_buffer_size, psc_size, map->lp_data->lp_ctx);
+    lp_polynomial_psc(*polynomial_buffer, p, q);
+    psc = *polynomial_buffer;
+    if (map->nra != NULL) {
+      nra_psc_cache_add(&map->nra->psc_cache, x, p, q, psc, psc_size);
+    }
+  }
+
   // Add the initial sequence of the psc
   uint32_t psc_i;
   for (psc_i = 0; psc_i < psc_size; ++ psc_i) {
     // Add it
-    lp_projection_map_add(map, (*polynomial_buffer)[psc_i]);
+    lp_projection_map_add(map, psc[psc_i]);
     // If it doesn't vanish we're done
-    if (lp_polynomial_sgn((*polynomial_buffer)[psc_i], map->lp_data->lp_assignment)) {
+    if (lp_polynomial_sgn(psc[psc_i], map->lp_data->lp_assignment)) {
       break;
     }
   }
@@ -1077,21 +1127,19 @@ poly_constraint_resolve_fm(nra_plugin_t *nra,
   bool ok = lp_polynomial_constraint_resolve_fm(c0->polynomial, c0_sgn_condition, c1->polynomial, c1_sgn_condition, m, R, &R_sgn_condition, assumptions);
   if (ok) {
     // (C1 && C2 && assumptions && !(p R2 0)) => false
-    term_manager_t* tm = nra->ctx->tm;
     size_t n = lp_polynomial_vector_size(assumptions);
     size_t i;
     for (i = 0; i < n; ++ i) {
       lp_polynomial_t* assumption_p_i = lp_polynomial_vector_at(assumptions, i);
-      term_t assumption_i_p_term = lp_polynomial_to_yices_term_nra(nra, assumption_p_i);
       int assumption_i_p_sgn = lp_polynomial_sgn(assumption_p_i, m);
       //      term_t assumption_i = NULL_TERM; // infer dead store
       term_t assumption_i;
       if (assumption_i_p_sgn < 0) {
-        assumption_i = mk_arith_term_lt0(tm, assumption_i_p_term);
+        assumption_i = nra_polynomial_sign_atom(nra, assumption_p_i, LP_SGN_LT_0);
       } else if (assumption_i_p_sgn > 0) {
-        assumption_i = mk_arith_term_gt0(tm, assumption_i_p_term);
+        assumption_i = nra_polynomial_sign_atom(nra, assumption_p_i, LP_SGN_GT_0);
       } else {
-        assumption_i = mk_arith_term_eq0(tm, assumption_i_p_term);
+        assumption_i = nra_polynomial_sign_atom(nra, assumption_p_i, LP_SGN_EQ_0);
       }
       if (ctx_trace_enabled(nra->ctx, "mcsat::nra::explain")) {
         ctx_trace_printf(nra->ctx, "adding FM assumption: ");
@@ -1100,28 +1148,7 @@ poly_constraint_resolve_fm(nra_plugin_t *nra,
       ivector_push(out, assumption_i);
       lp_polynomial_delete(assumption_p_i);
     }
-    term_t R_p_term = lp_polynomial_to_yices_term_nra(nra, R);
-    term_t R_term = NULL_TERM;
-    switch (R_sgn_condition) {
-    case LP_SGN_LT_0:
-      R_term = mk_arith_term_lt0(tm, R_p_term);
-      break;
-    case LP_SGN_LE_0:
-      R_term = mk_arith_term_leq0(tm, R_p_term);
-      break;
-    case LP_SGN_EQ_0:
-      R_term = mk_arith_term_eq0(tm, R_p_term);
-      break;
-    case LP_SGN_NE_0:
-      R_term = mk_arith_term_neq0(tm, R_p_term);
-      break;
-    case LP_SGN_GT_0:
-      R_term = mk_arith_term_gt0(tm, R_p_term);
-      break;
-    case LP_SGN_GE_0:
-      R_term = mk_arith_term_geq0(tm, R_p_term);
-      break;
-    }
+    term_t R_term = nra_polynomial_sign_atom(nra, R, R_sgn_condition);
     R_term = opposite_term(R_term);
     if (ctx_trace_enabled(nra->ctx, "mcsat::nra::explain")) {
       ctx_trace_printf(nra->ctx, "adding resolvent: ");
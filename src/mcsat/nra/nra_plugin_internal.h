@@ -28,6 +28,8 @@
 #include "mcsat/utils/lp_data.h"
 #include "mcsat/utils/lp_constraint_db.h"
 #include "mcsat/nra/feasible_set_db.h"
+#include "mcsat/nra/nra_atom_cache.h"
+#include "mcsat/nra/nra_psc_cache.h"
 
 #include "terms/term_manager.h"
 
@@ -84,6 +86,9 @@ struct nra_plugin_s {
     statistic_int_t* evaluations;
     statistic_int_t* constraint_regular;
     statistic_int_t* constraint_root;
+    statistic_int_t* atom_cache_hits;
+    statistic_int_t* psc_cache_hits;
+    statistic_int_t* psc_cache_misses;
   } stats;
 
   /** Database of polynomial constraints */
@@ -108,6 +113,12 @@ struct nra_plugin_s {
   /** Arithmetic buffer for computation */
   rba_buffer_t buffer;
 
+  /** Atoms built by the explanations */
+  nra_atom_cache_t atom_cache;
+
+  /** Subresultants computed by the projection */
+  nra_psc_cache_t psc_cache;
+
   /** Exception handler */
   jmp_buf* exception;
 
@@ -0,0 +1,206 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mcsat/nra/nra_psc_cache.h"
+#include "mcsat/utils/lp_utils.h"
+
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+#include <poly/polynomial.h>
+#include <assert.h>
+
+void nra_psc_cache_construct(nra_psc_cache_t* cache, uint32_t capacity) {
+  uint32_t i, n;
+
+  assert(capacity > 0);
+
+  // Two buckets per entry (power of 2)
+  n = 1;
+  while (n < 2 * capacity) {
+    n <<= 1;
+  }
+
+  cache->entry = (nra_psc_cache_entry_t*) safe_malloc(capacity * sizeof(nra_psc_cache_entry_t));
+  cache->nentries = 0;
+  cache->capacity = capacity;
+  cache->bucket = (int32_t*) safe_malloc(n * sizeof(int32_t));
+  cache->nbuckets = n;
+  for (i = 0; i < n; ++ i) {
+    cache->bucket[i] = -1;
+  }
+  cache->lru_first = -1;
+  cache->lru_last = -1;
+}
+
+/** Free the polynomials of entry e */
+static
+void nra_psc_cache_entry_destruct(nra_psc_cache_entry_t* e) {
+  uint32_t i;
+
+  lp_polynomial_delete(e->p);
+  lp_polynomial_delete(e->q);
+  for (i = 0; i < e->psc_size; ++ i) {
+    lp_polynomial_delete(e->psc[i]);
+  }
+  safe_free(e->psc);
+}
+
+void nra_psc_cache_reset(nra_psc_cache_t* cache) {
+  uint32_t i;
+
+  for (i = 0; i < cache->nentries; ++ i) {
+    nra_psc_cache_entry_destruct(cache->entry + i);
+  }
+  cache->nentries = 0;
+  for (i = 0; i < cache->nbuckets; ++ i) {
+    cache->bucket[i] = -1;
+  }
+  cache->lru_first = -1;
+  cache->lru_last = -1;
+}
+
+void nra_psc_cache_destruct(nra_psc_cache_t* cache) {
+  nra_psc_cache_reset(cache);
+  safe_free(cache->entry);
+  safe_free(cache->bucket);
+  cache->entry = NULL;
+  cache->bucket = NULL;
+}
+
+static
+uint32_t nra_psc_cache_hash(lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  uint32_t p_hash = lp_polynomial_order_independent_hash(p);
+  uint32_t q_hash = lp_polynomial_order_independent_hash(q);
+  return jenkins_hash_triple(p_hash, q_hash, x, 0x6b43a9b5);
+}
+
+/** Remove entry k from the LRU list */
+static
+void nra_psc_cache_lru_remove(nra_psc_cache_t* cache, int32_t k) {
+  nra_psc_cache_entry_t* e = cache->entry + k;
+
+  if (e->lru_prev >= 0) {
+    cache->entry[e->lru_prev].lru_next = e->lru_next;
+  } else {
+    cache->lru_first = e->lru_next;
+  }
+  if (e->lru_next >= 0) {
+    cache->entry[e->lru_next].lru_prev = e->lru_prev;
+  } else {
+    cache->lru_last = e->lru_prev;
+  }
+}
+
+/** Add entry k at the end of the LRU list (most recently used) */
+static
+void nra_psc_cache_lru_push(nra_psc_cache_t* cache, int32_t k) {
+  nra_psc_cache_entry_t* e = cache->entry + k;
+
+  e->lru_prev = cache->lru_last;
+  e->lru_next = -1;
+  if (cache->lru_last >= 0) {
+    cache->entry[cache->lru_last].lru_next = k;
+  } else {
+    cache->lru_first = k;
+  }
+  cache->lru_last = k;
+}
+
+lp_polynomial_t** nra_psc_cache_find(nra_psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q, uint32_t* psc_size) {
+  nra_psc_cache_entry_t* e;
+  uint32_t hash;
+  int32_t k;
+
+  if (cache->nentries == 0) {
+    return NULL;
+  }
+
+  hash = nra_psc_cache_hash(x, p, q);
+  k = cache->bucket[hash & (cache->nbuckets - 1)];
+  while (k >= 0) {
+    e = cache->entry + k;
+    if (e->hash == hash && e->x == x && lp_polynomial_cmp(e->p, p) == 0 && lp_polynomial_cmp(e->q, q) == 0) {
+      if (cache->lru_last != k) {
+        nra_psc_cache_lru_remove(cache, k);
+        nra_psc_cache_lru_push(cache, k);
+      }
+      *psc_size = e->psc_size;
+      return e->psc;
+    }
+    k = e->next;
+  }
+
+  return NULL;
+}
+
+/** Remove the least recently used entry and return its index */
+static
+int32_t nra_psc_cache_evict(nra_psc_cache_t* cache) {
+  nra_psc_cache_entry_t* e;
+  int32_t k, *prev;
+
+  k = cache->lru_first;
+  assert(k >= 0);
+  e = cache->entry + k;
+
+  // remove from the bucket
+  prev = cache->bucket + (e->hash & (cache->nbuckets - 1));
+  while (*prev != k) {
+    assert(*prev >= 0);
+    prev = &cache->entry[*prev].next;
+  }
+  *prev = e->next;
+
+  nra_psc_cache_lru_remove(cache, k);
+  nra_psc_cache_entry_destruct(e);
+
+  return k;
+}
+
+void nra_psc_cache_add(nra_psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q, lp_polynomial_t** psc, uint32_t psc_size) {
+  nra_psc_cache_entry_t* e;
+  uint32_t i, b;
+  int32_t k;
+
+  assert(nra_psc_cache_find(cache, x, p, q, &i) == NULL);
+
+  if (cache->nentries < cache->capacity) {
+    k = cache->nentries;
+    cache->nentries ++;
+  } else {
+    k = nra_psc_cache_evict(cache);
+  }
+
+  e = cache->entry + k;
+  e->p = lp_polynomial_new_copy(p);
+  e->q = lp_polynomial_new_copy(q);
+  e->x = x;
+  e->hash = nra_psc_cache_hash(x, p, q);
+  e->psc = (lp_polynomial_t**) safe_malloc(psc_size * sizeof(lp_polynomial_t*));
+  e->psc_size = psc_size;
+  for (i = 0; i < psc_size; ++ i) {
+    e->psc[i] = lp_polynomial_new_copy(psc[i]);
+  }
+
+  b = e->hash & (cache->nbuckets - 1);
+  e->next = cache->bucket[b];
+  cache->bucket[b] = k;
+
+  nra_psc_cache_lru_push(cache, k);
+}
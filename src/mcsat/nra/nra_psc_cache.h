@@ -0,0 +1,94 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Cache of the principal subresultant coefficients (PSC) computed by the
+ * NRA projection.
+ *
+ * The same pairs of polynomials are projected in many conflicts. The PSC
+ * of (p, q) with respect to x only depends on p, q and x (not on the model)
+ * so it's kept here. The cache has a fixed capacity and the least recently
+ * used entry is replaced when it's full. All polynomials are copies owned
+ * by the cache.
+ *
+ * The hash codes don't depend on the variable order. The variable x is
+ * part of the key since the top variable of p and q depends on the order.
+ * The cache must be reset when the libpoly variables may be remapped
+ * (i.e., on garbage collection).
+ */
+
+#pragma once
+
+#include <poly/poly.h>
+#include <stdint.h>
+
+typedef struct nra_psc_cache_entry_s {
+  /** The pair */
+  lp_polynomial_t* p;
+  lp_polynomial_t* q;
+  /** The variable */
+  lp_variable_t x;
+  /** Hash code of (p, q, x) */
+  uint32_t hash;
+  /** The PSC */
+  lp_polynomial_t** psc;
+  uint32_t psc_size;
+  /** Next entry in the same bucket (or -1) */
+  int32_t next;
+  /** LRU list: less and more recently used entries (or -1) */
+  int32_t lru_prev;
+  int32_t lru_next;
+} nra_psc_cache_entry_t;
+
+typedef struct nra_psc_cache_s {
+  /** Entries: nentries used out of capacity */
+  nra_psc_cache_entry_t* entry;
+  uint32_t nentries;
+  uint32_t capacity;
+  /** Hash table: first entry of each bucket (or -1) */
+  int32_t* bucket;
+  uint32_t nbuckets;
+  /** LRU list: least and most recently used entries (or -1) */
+  int32_t lru_first;
+  int32_t lru_last;
+} nra_psc_cache_t;
+
+#define NRA_PSC_CACHE_DEFAULT_CAPACITY 4096
+
+/** Construct an empty cache with the given capacity (positive) */
+void nra_psc_cache_construct(nra_psc_cache_t* cache, uint32_t capacity);
+
+/** Destruct the cache */
+void nra_psc_cache_destruct(nra_psc_cache_t* cache);
+
+/** Remove all entries */
+void nra_psc_cache_reset(nra_psc_cache_t* cache);
+
+/**
+ * Get the PSC of p and q with respect to x. Returns NULL if it's not in
+ * the cache. Otherwise the size is stored in psc_size and the entry
+ * becomes the most recently used. The result is valid until the next
+ * call to nra_psc_cache_add.
+ */
+lp_polynomial_t** nra_psc_cache_find(nra_psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q, uint32_t* psc_size);
+
+/**
+ * Add the PSC of p and q with respect to x (the polynomials are copied).
+ * There must be no entry for (p, q, x).
+ */
+void nra_psc_cache_add(nra_psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q, lp_polynomial_t** psc, uint32_t psc_size);
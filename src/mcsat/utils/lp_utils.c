@@ -20,6 +20,7 @@
 
 #include "terms/rba_buffer_terms.h"
 #include "terms/term_manager.h"
+#include "utils/hash_functions.h"
 
 #include <poly/polynomial.h>
 #include <poly/monomial.h>
@@ -399,6 +400,31 @@ term_t lp_polynomial_to_yices_arith_ff_term(const lp_data_t *lp_data, const lp_p
   return result;
 }
 
+/**
+ * Hash of a monomial, added to the hash of the polynomial. The powers and
+ * the monomials are combined with +, so the result doesn't depend on the
+ * order in which libpoly traverses them.
+ */
+static
+void lp_polynomial_hash_traverse_f(const lp_polynomial_context_t* ctx, lp_monomial_t* m, void* data) {
+  uint32_t* h = (uint32_t*) data;
+  uint32_t pp_hash, a_hash;
+  size_t i;
+
+  pp_hash = 0;
+  for (i = 0; i < m->n; ++ i) {
+    pp_hash += jenkins_hash_pair(m->p[i].x, m->p[i].d, 0x2c8e41f3);
+  }
+  a_hash = mpz_fdiv_ui(&m->a, 0x7fffffff);
+  *h += jenkins_hash_pair(pp_hash, a_hash, 0x91d3a7b5);
+}
+
+uint32_t lp_polynomial_order_independent_hash(const lp_polynomial_t* p) {
+  uint32_t h = 0;
+  lp_polynomial_traverse(p, lp_polynomial_hash_traverse_f, &h);
+  return h;
+}
+
 const mcsat_value_t* ensure_lp_value(const mcsat_value_t* value, mcsat_value_t* alternative) {
   lp_value_t lp_value;
   lp_rational_t rat_value;
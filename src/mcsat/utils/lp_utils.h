@@ -40,6 +40,12 @@ term_t lp_polynomial_to_yices_arith_term(const lp_data_t *lp_data, const lp_poly
  */
 term_t lp_polynomial_to_yices_arith_ff_term(const lp_data_t *lp_data, const lp_polynomial_t* lp_p, term_table_t* terms, rba_buffer_t* b);
 
+/**
+ * Hash code of a polynomial that doesn't depend on the variable order
+ * (libpoly's hash depends on the current order).
+ */
+uint32_t lp_polynomial_order_independent_hash(const lp_polynomial_t* p);
+
 /**
  * Ensure value is an lp_value. If not the passed alternative will be constructed to an equivalent lp_value.
  */
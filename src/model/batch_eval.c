@@ -0,0 +1,1065 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * BATCH EVALUATION: COMPUTE THE VALUES OF MANY TERMS IN MANY MODELS
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "model/batch_eval.h"
+#include "model/model_eval.h"
+#include "terms/bv64_constants.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Initialize: empty tape
+ */
+void init_batch_evaluator(batch_evaluator_t *eval, term_table_t *terms) {
+  eval->terms = terms;
+  eval->tape = (beval_instr_t *) safe_malloc(DEF_BEVAL_TAPE_SIZE * sizeof(beval_instr_t));
+  eval->ninstr = 0;
+  eval->size = DEF_BEVAL_TAPE_SIZE;
+  init_ivector(&eval->args, 0);
+  init_int_hmap(&eval->index, 0);
+  init_ivector(&eval->targets, 0);
+  init_ivector(&eval->leaves, 0);
+
+  eval->nbool = 0;
+  eval->nbv = 0;
+  eval->nvalues = 0;
+  eval->bool_lanes = NULL;
+  eval->bv_lanes = NULL;
+  eval->value_lanes = NULL;
+  eval->bad = NULL;
+  eval->lanes_size = 0;
+}
+
+
+/*
+ * Free the lanes
+ */
+static void beval_free_lanes(batch_evaluator_t *eval) {
+  safe_free(eval->bool_lanes);
+  safe_free(eval->bv_lanes);
+  safe_free(eval->value_lanes);
+  safe_free(eval->bad);
+  eval->bool_lanes = NULL;
+  eval->bv_lanes = NULL;
+  eval->value_lanes = NULL;
+  eval->bad = NULL;
+  eval->lanes_size = 0;
+}
+
+
+/*
+ * Allocate the lanes for the current tape
+ */
+static void beval_alloc_lanes(batch_evaluator_t *eval) {
+  if (eval->lanes_size != eval->ninstr) {
+    beval_free_lanes(eval);
+    eval->bool_lanes = (uint64_t *) safe_malloc(eval->nbool * BATCH_EVAL_BLOCK_WORDS * sizeof(uint64_t));
+    eval->bv_lanes = (uint64_t *) safe_malloc(eval->nbv * BATCH_EVAL_BLOCK * sizeof(uint64_t));
+    eval->value_lanes = (value_t *) safe_malloc(eval->nvalues * BATCH_EVAL_BLOCK * sizeof(value_t));
+    eval->bad = (uint64_t *) safe_malloc(eval->ninstr * BATCH_EVAL_BLOCK_WORDS * sizeof(uint64_t));
+    eval->lanes_size = eval->ninstr;
+  }
+}
+
+
+/*
+ * Delete: free memory
+ */
+void delete_batch_evaluator(batch_evaluator_t *eval) {
+  beval_free_lanes(eval);
+  safe_free(eval->tape);
+  eval->tape = NULL;
+  delete_ivector(&eval->args);
+  delete_int_hmap(&eval->index);
+  delete_ivector(&eval->targets);
+  delete_ivector(&eval->leaves);
+}
+
+
+/*
+ * Reset: empty tape
+ */
+void reset_batch_evaluator(batch_evaluator_t *eval) {
+  beval_free_lanes(eval);
+  eval->ninstr = 0;
+  ivector_reset(&eval->args);
+  int_hmap_reset(&eval->index);
+  ivector_reset(&eval->targets);
+  ivector_reset(&eval->leaves);
+  eval->nbool = 0;
+  eval->nbv = 0;
+  eval->nvalues = 0;
+}
+
+
+
+/*
+ * COMPILATION
+ */
+
+/*
+ * Make the tape large enough for one more instruction
+ */
+static void extend_beval_tape(batch_evaluator_t *eval) {
+  uint32_t n;
+
+  n = eval->size + 1;
+  n += n >> 1;
+  if (n >= MAX_BEVAL_TAPE_SIZE) {
+    out_of_memory();
+  }
+  eval->tape = (beval_instr_t *) safe_realloc(eval->tape, n * sizeof(beval_instr_t));
+  eval->size = n;
+}
+
+
+/*
+ * Check whether t is a bitvector term of no more than 64 bits
+ */
+static bool is_bv64_term(term_table_t *terms, term_t t) {
+  return is_bitvector_term(terms, t) && term_bitsize(terms, t) <= 64;
+}
+
+
+/*
+ * Kind of lane for term t
+ */
+static beval_kind_t beval_term_kind(term_table_t *terms, term_t t) {
+  if (is_boolean_term(terms, t)) {
+    return BEVAL_BOOL_LANE;
+  } else if (is_bv64_term(terms, t)) {
+    return BEVAL_BV_LANE;
+  } else {
+    return BEVAL_VALUE_LANE;
+  }
+}
+
+
+/*
+ * Add an instruction for term t
+ * - the arguments are the last nargs elements of eval->args
+ * - return the instruction's index
+ */
+static int32_t beval_add_instr(batch_evaluator_t *eval, beval_opcode_t op, term_t t, uint32_t nargs, uint64_t aux) {
+  beval_instr_t *ins;
+  uint32_t i;
+
+  assert(nargs <= eval->args.size);
+
+  i = eval->ninstr;
+  if (i == eval->size) {
+    extend_beval_tape(eval);
+  }
+  assert(i < eval->size);
+
+  ins = eval->tape + i;
+  ins->op = op;
+  ins->kind = beval_term_kind(eval->terms, t);
+  ins->term = t;
+  ins->nbits = 0;
+  ins->nargs = nargs;
+  ins->args = eval->args.size - nargs;
+  ins->aux = aux;
+
+  switch (ins->kind) {
+  case BEVAL_BOOL_LANE:
+    ins->lane = eval->nbool;
+    eval->nbool ++;
+    break;
+
+  case BEVAL_BV_LANE:
+    ins->nbits = term_bitsize(eval->terms, t);
+    ins->lane = eval->nbv;
+    eval->nbv ++;
+    break;
+
+  case BEVAL_VALUE_LANE:
+    ins->lane = eval->nvalues;
+    eval->nvalues ++;
+    break;
+  }
+
+  eval->ninstr ++;
+  int_hmap_add(&eval->index, t, i);
+
+  return i;
+}
+
+
+static int32_t beval_compile(batch_evaluator_t *eval, term_t t);
+
+/*
+ * Compile the arguments a[0 ... n-1] then push them on eval->args
+ * - a must not be modified by the compilation (it's a term descriptor)
+ */
+static void beval_compile_args(batch_evaluator_t *eval, term_t *a, uint32_t n) {
+  int32_t *x;
+  uint32_t i;
+
+  // compile first since this may push arguments of other instructions
+  x = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  for (i=0; i<n; i++) {
+    x[i] = beval_compile(eval, a[i]);
+  }
+  ivector_add(&eval->args, x, n);
+  safe_free(x);
+}
+
+
+/*
+ * Composite with arguments a[0 ... n-1]
+ */
+static int32_t beval_compile_composite(batch_evaluator_t *eval, beval_opcode_t op, term_t t, composite_term_t *d, uint64_t aux) {
+  beval_compile_args(eval, d->arg, d->arity);
+  return beval_add_instr(eval, op, t, d->arity, aux);
+}
+
+
+/*
+ * Leaf t
+ */
+static int32_t beval_compile_leaf(batch_evaluator_t *eval, term_t t) {
+  int32_t i;
+
+  i = beval_add_instr(eval, BEVAL_LEAF, t, 0, 0);
+  ivector_push(&eval->leaves, i);
+  return i;
+}
+
+
+/*
+ * Boolean term t: t is not negated
+ */
+static int32_t beval_compile_bool(batch_evaluator_t *eval, term_t t) {
+  term_table_t *terms;
+  composite_term_t *d;
+  select_term_t *s;
+
+  terms = eval->terms;
+  switch (term_kind(terms, t)) {
+  case CONSTANT_TERM:
+    if (t == true_term) {
+      return beval_add_instr(eval, BEVAL_TRUE, t, 0, 0);
+    }
+    break;
+
+  case OR_TERM:
+    return beval_compile_composite(eval, BEVAL_OR, t, or_term_desc(terms, t), 0);
+
+  case XOR_TERM:
+    return beval_compile_composite(eval, BEVAL_XOR, t, xor_term_desc(terms, t), 0);
+
+  case EQ_TERM:
+    d = eq_term_desc(terms, t);
+    if (is_boolean_term(terms, d->arg[0])) {
+      return beval_compile_composite(eval, BEVAL_IFF, t, d, 0);
+    }
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    return beval_compile_composite(eval, BEVAL_BOOL_ITE, t, ite_term_desc(terms, t), 0);
+
+  case BIT_TERM:
+    s = bit_term_desc(terms, t);
+    if (is_bv64_term(terms, s->arg)) {
+      beval_compile_args(eval, &s->arg, 1);
+      return beval_add_instr(eval, BEVAL_BIT, t, 1, s->idx);
+    }
+    break;
+
+  case BV_EQ_ATOM:
+    d = bveq_atom_desc(terms, t);
+    if (is_bv64_term(terms, d->arg[0])) {
+      return beval_compile_composite(eval, BEVAL_BVEQ, t, d, 0);
+    }
+    break;
+
+  case BV_GE_ATOM:
+    d = bvge_atom_desc(terms, t);
+    if (is_bv64_term(terms, d->arg[0])) {
+      return beval_compile_composite(eval, BEVAL_BVGE, t, d, 0);
+    }
+    break;
+
+  case BV_SGE_ATOM:
+    d = bvsge_atom_desc(terms, t);
+    if (is_bv64_term(terms, d->arg[0])) {
+      // aux = sign bit
+      return beval_compile_composite(eval, BEVAL_BVSGE, t, d, sgn_bit_mask64(term_bitsize(terms, d->arg[0])));
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  return beval_compile_leaf(eval, t);
+}
+
+
+/*
+ * Bitvector polynomial: the arguments are the non-constant monomials
+ */
+static int32_t beval_compile_bv64_poly(batch_evaluator_t *eval, term_t t, bvpoly64_t *p) {
+  uint32_t i, n;
+
+  i = 0;
+  n = p->nterms;
+  if (p->mono[0].var == const_idx) {
+    i = 1;
+  }
+  for (; i<n; i++) {
+    (void) beval_compile(eval, p->mono[i].var);
+  }
+
+  i = 0;
+  if (p->mono[0].var == const_idx) {
+    i = 1;
+  }
+  for (; i<n; i++) {
+    ivector_push(&eval->args, beval_compile(eval, p->mono[i].var));
+  }
+
+  return beval_add_instr(eval, BEVAL_BV_POLY, t, n - (p->mono[0].var == const_idx), 0);
+}
+
+
+/*
+ * Bitvector power product
+ */
+static int32_t beval_compile_bv_pprod(batch_evaluator_t *eval, term_t t, pprod_t *p) {
+  uint32_t i, n;
+
+  n = p->len;
+  for (i=0; i<n; i++) {
+    (void) beval_compile(eval, p->prod[i].var);
+  }
+  for (i=0; i<n; i++) {
+    ivector_push(&eval->args, beval_compile(eval, p->prod[i].var));
+  }
+
+  return beval_add_instr(eval, BEVAL_BV_PPROD, t, n, 0);
+}
+
+
+/*
+ * Bitvector term t of no more than 64 bits
+ */
+static int32_t beval_compile_bv(batch_evaluator_t *eval, term_t t) {
+  term_table_t *terms;
+
+  terms = eval->terms;
+  switch (term_kind(terms, t)) {
+  case BV64_CONSTANT:
+    return beval_add_instr(eval, BEVAL_BV_CONST, t, 0, bvconst64_term_desc(terms, t)->value);
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    return beval_compile_composite(eval, BEVAL_BV_ITE, t, ite_term_desc(terms, t), 0);
+
+  case BV_ARRAY:
+    return beval_compile_composite(eval, BEVAL_BV_ARRAY, t, bvarray_term_desc(terms, t), 0);
+
+  case BV64_POLY:
+    return beval_compile_bv64_poly(eval, t, bvpoly64_term_desc(terms, t));
+
+  case POWER_PRODUCT:
+    return beval_compile_bv_pprod(eval, t, pprod_term_desc(terms, t));
+
+  case BV_DIV:
+    return beval_compile_composite(eval, BEVAL_BV_DIV, t, bvdiv_term_desc(terms, t), 0);
+
+  case BV_REM:
+    return beval_compile_composite(eval, BEVAL_BV_REM, t, bvrem_term_desc(terms, t), 0);
+
+  case BV_SDIV:
+    return beval_compile_composite(eval, BEVAL_BV_SDIV, t, bvsdiv_term_desc(terms, t), 0);
+
+  case BV_SREM:
+    return beval_compile_composite(eval, BEVAL_BV_SREM, t, bvsrem_term_desc(terms, t), 0);
+
+  case BV_SMOD:
+    return beval_compile_composite(eval, BEVAL_BV_SMOD, t, bvsmod_term_desc(terms, t), 0);
+
+  case BV_SHL:
+    return beval_compile_composite(eval, BEVAL_BV_SHL, t, bvshl_term_desc(terms, t), 0);
+
+  case BV_LSHR:
+    return beval_compile_composite(eval, BEVAL_BV_LSHR, t, bvlshr_term_desc(terms, t), 0);
+
+  case BV_ASHR:
+    return beval_compile_composite(eval, BEVAL_BV_ASHR, t, bvashr_term_desc(terms, t), 0);
+
+  default:
+    return beval_compile_leaf(eval, t);
+  }
+}
+
+
+/*
+ * Compile term t: return the index of its instruction
+ */
+static int32_t beval_compile(batch_evaluator_t *eval, term_t t) {
+  int_hmap_pair_t *r;
+  int32_t i;
+
+  assert(good_term(eval->terms, t));
+
+  r = int_hmap_find(&eval->index, t);
+  if (r != NULL) {
+    return r->val;
+  }
+
+  if (is_neg_term(t)) {
+    i = beval_compile(eval, opposite_term(t));
+    ivector_push(&eval->args, i);
+    return beval_add_instr(eval, BEVAL_NOT, t, 1, 0);
+  }
+
+  switch (beval_term_kind(eval->terms, t)) {
+  case BEVAL_BOOL_LANE:
+    return beval_compile_bool(eval, t);
+
+  case BEVAL_BV_LANE:
+    return beval_compile_bv(eval, t);
+
+  default:
+    return beval_compile_leaf(eval, t);
+  }
+}
+
+
+/*
+ * Add terms a[0 ... n-1]
+ */
+void batch_eval_add_terms(batch_evaluator_t *eval, const term_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    ivector_push(&eval->targets, beval_compile(eval, a[i]));
+  }
+}
+
+
+
+/*
+ * LANES
+ */
+
+/*
+ * Lanes of instruction i
+ */
+static inline uint64_t *bool_lane(batch_evaluator_t *eval, uint32_t i) {
+  assert(i < eval->ninstr && eval->tape[i].kind == BEVAL_BOOL_LANE);
+  return eval->bool_lanes + eval->tape[i].lane * BATCH_EVAL_BLOCK_WORDS;
+}
+
+static inline uint64_t *bv_lane(batch_evaluator_t *eval, uint32_t i) {
+  assert(i < eval->ninstr && eval->tape[i].kind == BEVAL_BV_LANE);
+  return eval->bv_lanes + eval->tape[i].lane * BATCH_EVAL_BLOCK;
+}
+
+static inline value_t *value_lane(batch_evaluator_t *eval, uint32_t i) {
+  assert(i < eval->ninstr && eval->tape[i].kind == BEVAL_VALUE_LANE);
+  return eval->value_lanes + eval->tape[i].lane * BATCH_EVAL_BLOCK;
+}
+
+static inline uint64_t *bad_lane(batch_evaluator_t *eval, uint32_t i) {
+  assert(i < eval->ninstr);
+  return eval->bad + i * BATCH_EVAL_BLOCK_WORDS;
+}
+
+
+/*
+ * Bit j of a packed lane
+ */
+static inline uint64_t lane_bit(const uint64_t *a, uint32_t j) {
+  return (a[j >> 6] >> (j & 63)) & 1;
+}
+
+static inline void set_lane_bit(uint64_t *a, uint32_t j) {
+  a[j >> 6] |= ((uint64_t) 1) << (j & 63);
+}
+
+
+/*
+ * Convert bitvector object o to a 64bit unsigned integer
+ * - o must have between 1 and 64bits
+ */
+static uint64_t bvobj_to_uint64(value_bv_t *o) {
+  uint64_t c;
+
+  assert(1 <= o->nbits && o->nbits <= 64);
+  c = o->data[0];
+  if (o->nbits > 32) {
+    c += ((uint64_t) o->data[1]) << 32;
+  }
+  return c;
+}
+
+
+/*
+ * x^d modulo 2^64
+ */
+static uint64_t upower64(uint64_t x, uint32_t d) {
+  uint64_t y;
+
+  y = 1;
+  while (d != 0) {
+    if ((d & 1) != 0) {
+      y *= x;
+    }
+    d >>= 1;
+    x *= x;
+  }
+  return y;
+}
+
+
+
+/*
+ * EXECUTION
+ */
+
+/*
+ * Store the value v of leaf i for model j of the current block
+ * - vtbl = value table of model j
+ * - return true if v is an error code
+ */
+static bool beval_store_leaf(batch_evaluator_t *eval, uint32_t i, uint32_t j, value_table_t *vtbl, value_t v) {
+  beval_instr_t *ins;
+  uint64_t *a;
+
+  ins = eval->tape + i;
+  switch (ins->kind) {
+  case BEVAL_BOOL_LANE:
+    if (v >= 0 && is_true(vtbl, v)) {
+      set_lane_bit(bool_lane(eval, i), j);
+    }
+    break;
+
+  case BEVAL_BV_LANE:
+    a = bv_lane(eval, i);
+    a[j] = 0;
+    if (v >= 0) {
+      a[j] = bvobj_to_uint64(vtbl_bitvector(vtbl, v));
+      assert(a[j] == norm64(a[j], ins->nbits));
+    }
+    break;
+
+  case BEVAL_VALUE_LANE:
+    value_lane(eval, i)[j] = v;
+    break;
+  }
+
+  if (v < 0) {
+    set_lane_bit(bad_lane(eval, i), j);
+    return true;
+  }
+  return false;
+}
+
+
+/*
+ * Compute the leaves for models mdl[0 ... k-1] of the current block
+ * - return true if some leaf can't be evaluated
+ */
+static bool beval_leaves(batch_evaluator_t *eval, model_t **mdl, uint32_t k) {
+  evaluator_t aux;
+  term_t t;
+  value_t v;
+  uint32_t i, j, l, n;
+  bool has_eval, bad;
+
+  n = eval->ninstr;
+  for (i=0; i<n; i++) {
+    if (eval->tape[i].kind == BEVAL_BOOL_LANE) {
+      memset(bool_lane(eval, i), 0, BATCH_EVAL_BLOCK_WORDS * sizeof(uint64_t));
+    }
+  }
+  memset(eval->bad, 0, n * BATCH_EVAL_BLOCK_WORDS * sizeof(uint64_t));
+
+  bad = false;
+  for (j=0; j<k; j++) {
+    has_eval = false;
+    for (l=0; l<eval->leaves.size; l++) {
+      i = eval->leaves.data[l];
+      t = eval->tape[i].term;
+      v = model_find_term_value(mdl[j], t);
+      if (v == null_value) {
+        // the evaluator is created only if it's needed
+        if (! has_eval) {
+          init_evaluator(&aux, mdl[j]);
+          has_eval = true;
+        }
+        v = eval_in_model(&aux, t);
+      }
+      bad |= beval_store_leaf(eval, i, j, &mdl[j]->vtbl, v);
+    }
+    if (has_eval) {
+      delete_evaluator(&aux);
+    }
+  }
+
+  return bad;
+}
+
+
+/*
+ * Boolean operators on nw words
+ */
+static void beval_exec_or(batch_evaluator_t *eval, uint64_t *r, int32_t *a, uint32_t n, uint32_t nw) {
+  uint64_t *x;
+  uint32_t i, w;
+
+  memset(r, 0, nw * sizeof(uint64_t));
+  for (i=0; i<n; i++) {
+    x = bool_lane(eval, a[i]);
+    for (w=0; w<nw; w++) {
+      r[w] |= x[w];
+    }
+  }
+}
+
+static void beval_exec_xor(batch_evaluator_t *eval, uint64_t *r, int32_t *a, uint32_t n, uint32_t nw) {
+  uint64_t *x;
+  uint32_t i, w;
+
+  memset(r, 0, nw * sizeof(uint64_t));
+  for (i=0; i<n; i++) {
+    x = bool_lane(eval, a[i]);
+    for (w=0; w<nw; w++) {
+      r[w] ^= x[w];
+    }
+  }
+}
+
+
+/*
+ * Bitvector polynomial
+ */
+static void beval_exec_bv_poly(batch_evaluator_t *eval, beval_instr_t *ins, uint64_t *r, int32_t *a, uint32_t k) {
+  bvpoly64_t *p;
+  uint64_t *x;
+  uint64_t c, mask;
+  uint32_t i, j, n;
+
+  p = bvpoly64_term_desc(eval->terms, ins->term);
+  c = 0;
+  i = 0;
+  if (p->mono[0].var == const_idx) {
+    c = p->mono[0].coeff;
+    i = 1;
+  }
+  for (j=0; j<k; j++) {
+    r[j] = c;
+  }
+
+  n = p->nterms;
+  for (; i<n; i++) {
+    c = p->mono[i].coeff;
+    x = bv_lane(eval, *a);
+    a ++;
+    for (j=0; j<k; j++) {
+      r[j] += c * x[j];
+    }
+  }
+
+  mask = mask64(ins->nbits);
+  for (j=0; j<k; j++) {
+    r[j] &= mask;
+  }
+}
+
+
+/*
+ * Bitvector power product
+ */
+static void beval_exec_bv_pprod(batch_evaluator_t *eval, beval_instr_t *ins, uint64_t *r, int32_t *a, uint32_t k) {
+  pprod_t *p;
+  uint64_t *x;
+  uint64_t mask;
+  uint32_t i, j, n, d;
+
+  p = pprod_term_desc(eval->terms, ins->term);
+  for (j=0; j<k; j++) {
+    r[j] = 1;
+  }
+
+  n = p->len;
+  assert(n == ins->nargs);
+  for (i=0; i<n; i++) {
+    x = bv_lane(eval, a[i]);
+    d = p->prod[i].exp;
+    if (d == 1) {
+      for (j=0; j<k; j++) {
+        r[j] *= x[j];
+      }
+    } else {
+      for (j=0; j<k; j++) {
+        r[j] *= upower64(x[j], d);
+      }
+    }
+  }
+
+  mask = mask64(ins->nbits);
+  for (j=0; j<k; j++) {
+    r[j] &= mask;
+  }
+}
+
+
+/*
+ * Execute instruction i for the first k models of the block
+ */
+static void beval_exec(batch_evaluator_t *eval, uint32_t i, uint32_t k) {
+  beval_instr_t *ins;
+  int32_t *a;
+  uint64_t *r, *x, *y, *z;
+  uint64_t c;
+  uint32_t j, n, nw;
+
+  ins = eval->tape + i;
+  a = eval->args.data + ins->args;
+  nw = (k + 63) >> 6;
+  n = ins->nbits;
+
+  switch (ins->op) {
+  case BEVAL_LEAF:
+    break;
+
+  case BEVAL_TRUE:
+    r = bool_lane(eval, i);
+    for (j=0; j<nw; j++) {
+      r[j] = ~((uint64_t) 0);
+    }
+    break;
+
+  case BEVAL_NOT:
+    r = bool_lane(eval, i);
+    x = bool_lane(eval, a[0]);
+    for (j=0; j<nw; j++) {
+      r[j] = ~x[j];
+    }
+    break;
+
+  case BEVAL_OR:
+    beval_exec_or(eval, bool_lane(eval, i), a, ins->nargs, nw);
+    break;
+
+  case BEVAL_XOR:
+    beval_exec_xor(eval, bool_lane(eval, i), a, ins->nargs, nw);
+    break;
+
+  case BEVAL_IFF:
+    r = bool_lane(eval, i);
+    x = bool_lane(eval, a[0]);
+    y = bool_lane(eval, a[1]);
+    for (j=0; j<nw; j++) {
+      r[j] = ~(x[j] ^ y[j]);
+    }
+    break;
+
+  case BEVAL_BOOL_ITE:
+    r = bool_lane(eval, i);
+    z = bool_lane(eval, a[0]);
+    x = bool_lane(eval, a[1]);
+    y = bool_lane(eval, a[2]);
+    for (j=0; j<nw; j++) {
+      r[j] = (z[j] & x[j]) | (~z[j] & y[j]);
+    }
+    break;
+
+  case BEVAL_BIT:
+    r = bool_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    memset(r, 0, nw * sizeof(uint64_t));
+    for (j=0; j<k; j++) {
+      r[j >> 6] |= ((x[j] >> ins->aux) & 1) << (j & 63);
+    }
+    break;
+
+  case BEVAL_BVEQ:
+    r = bool_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    memset(r, 0, nw * sizeof(uint64_t));
+    for (j=0; j<k; j++) {
+      r[j >> 6] |= ((uint64_t) (x[j] == y[j])) << (j & 63);
+    }
+    break;
+
+  case BEVAL_BVGE:
+    r = bool_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    memset(r, 0, nw * sizeof(uint64_t));
+    for (j=0; j<k; j++) {
+      r[j >> 6] |= ((uint64_t) (x[j] >= y[j])) << (j & 63);
+    }
+    break;
+
+  case BEVAL_BVSGE:
+    // flipping the sign bit maps the signed order to the unsigned order
+    r = bool_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    c = ins->aux;
+    memset(r, 0, nw * sizeof(uint64_t));
+    for (j=0; j<k; j++) {
+      r[j >> 6] |= ((uint64_t) ((x[j] ^ c) >= (y[j] ^ c))) << (j & 63);
+    }
+    break;
+
+  case BEVAL_BV_CONST:
+    r = bv_lane(eval, i);
+    c = ins->aux;
+    for (j=0; j<k; j++) {
+      r[j] = c;
+    }
+    break;
+
+  case BEVAL_BV_ITE:
+    r = bv_lane(eval, i);
+    z = bool_lane(eval, a[0]);
+    x = bv_lane(eval, a[1]);
+    y = bv_lane(eval, a[2]);
+    for (j=0; j<k; j++) {
+      r[j] = lane_bit(z, j) ? x[j] : y[j];
+    }
+    break;
+
+  case BEVAL_BV_ARRAY:
+    r = bv_lane(eval, i);
+    memset(r, 0, k * sizeof(uint64_t));
+    for (n=0; n<ins->nargs; n++) {
+      z = bool_lane(eval, a[n]);
+      for (j=0; j<k; j++) {
+        r[j] |= lane_bit(z, j) << n;
+      }
+    }
+    break;
+
+  case BEVAL_BV_POLY:
+    beval_exec_bv_poly(eval, ins, bv_lane(eval, i), a, k);
+    break;
+
+  case BEVAL_BV_PPROD:
+    beval_exec_bv_pprod(eval, ins, bv_lane(eval, i), a, k);
+    break;
+
+  case BEVAL_BV_DIV:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_udiv2z(x[j], y[j], n);
+    }
+    break;
+
+  case BEVAL_BV_REM:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_urem2z(x[j], y[j], n);
+    }
+    break;
+
+  case BEVAL_BV_SDIV:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_sdiv2z(x[j], y[j], n);
+    }
+    break;
+
+  case BEVAL_BV_SREM:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_srem2z(x[j], y[j], n);
+    }
+    break;
+
+  case BEVAL_BV_SMOD:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_smod2z(x[j], y[j], n);
+    }
+    break;
+
+  case BEVAL_BV_SHL:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    c = mask64(n);
+    for (j=0; j<k; j++) {
+      r[j] = (y[j] < n) ? ((x[j] << y[j]) & c) : 0;
+    }
+    break;
+
+  case BEVAL_BV_LSHR:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = (y[j] < n) ? (x[j] >> y[j]) : 0;
+    }
+    break;
+
+  case BEVAL_BV_ASHR:
+    r = bv_lane(eval, i);
+    x = bv_lane(eval, a[0]);
+    y = bv_lane(eval, a[1]);
+    for (j=0; j<k; j++) {
+      r[j] = bvconst64_ashr(x[j], y[j], n);
+    }
+    break;
+  }
+}
+
+
+/*
+ * Propagate the bad bits to instruction i
+ */
+static void beval_propagate_bad(batch_evaluator_t *eval, uint32_t i) {
+  beval_instr_t *ins;
+  int32_t *a;
+  uint64_t *r, *x;
+  uint32_t j, n, w;
+
+  ins = eval->tape + i;
+  a = eval->args.data + ins->args;
+  n = ins->nargs;
+  r = bad_lane(eval, i);
+  for (j=0; j<n; j++) {
+    x = bad_lane(eval, a[j]);
+    for (w=0; w<BATCH_EVAL_BLOCK_WORDS; w++) {
+      r[w] |= x[w];
+    }
+  }
+}
+
+
+/*
+ * Value of instruction i for model j of the block, as an object in vtbl
+ */
+static value_t beval_value(batch_evaluator_t *eval, uint32_t i, uint32_t j, value_table_t *vtbl) {
+  beval_instr_t *ins;
+
+  ins = eval->tape + i;
+  switch (ins->kind) {
+  case BEVAL_BOOL_LANE:
+    return vtbl_mk_bool(vtbl, lane_bit(bool_lane(eval, i), j));
+
+  case BEVAL_BV_LANE:
+    return vtbl_mk_bv_from_bv64(vtbl, ins->nbits, bv_lane(eval, i)[j]);
+
+  default:
+    return value_lane(eval, i)[j];
+  }
+}
+
+
+/*
+ * Value of term t in model mdl: slow path when a leaf can't be evaluated
+ * - a leaf may fail even if t can be evaluated by eval_in_model
+ *   (e.g., if the leaf occurs in an if-then-else branch that's not taken)
+ */
+static value_t beval_value_in_model(model_t *mdl, term_t t) {
+  evaluator_t aux;
+  value_t v;
+
+  init_evaluator(&aux, mdl);
+  v = eval_in_model(&aux, t);
+  delete_evaluator(&aux);
+
+  return v;
+}
+
+
+/*
+ * Evaluate the tape on one block of models
+ * - mdl = models of the block, k = number of models in the block
+ * - m = total number of models
+ * - b = index of the first model of the block
+ */
+static void beval_block(batch_evaluator_t *eval, model_t **mdl, uint32_t k, uint32_t m, uint32_t b, value_t *val) {
+  beval_instr_t *ins;
+  value_t *row;
+  uint32_t i, j, n, t;
+  bool bad;
+
+  assert(0 < k && k <= BATCH_EVAL_BLOCK);
+
+  bad = beval_leaves(eval, mdl, k);
+
+  n = eval->ninstr;
+  for (i=0; i<n; i++) {
+    beval_exec(eval, i, k);
+    if (bad) {
+      beval_propagate_bad(eval, i);
+    }
+  }
+
+  n = eval->targets.size;
+  for (t=0; t<n; t++) {
+    i = eval->targets.data[t];
+    ins = eval->tape + i;
+    row = val + t * m + b;
+    for (j=0; j<k; j++) {
+      if (bad && lane_bit(bad_lane(eval, i), j)) {
+        row[j] = beval_value_in_model(mdl[j], ins->term);
+      } else {
+        row[j] = beval_value(eval, i, j, &mdl[j]->vtbl);
+      }
+    }
+  }
+}
+
+
+/*
+ * Evaluate all terms in mdl[0 ... m-1]
+ */
+void batch_eval_in_models(batch_evaluator_t *eval, model_t **mdl, uint32_t m, value_t *val) {
+  uint32_t b, k;
+
+  if (eval->targets.size == 0) return;
+
+  beval_alloc_lanes(eval);
+  for (b=0; b<m; b += k) {
+    k = m - b;
+    if (k > BATCH_EVAL_BLOCK) {
+      k = BATCH_EVAL_BLOCK;
+    }
+    beval_block(eval, mdl + b, k, m, b, val);
+  }
+}
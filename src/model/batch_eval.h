@@ -0,0 +1,244 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * BATCH EVALUATION: COMPUTE THE VALUES OF MANY TERMS IN MANY MODELS
+ *
+ * A batch evaluator compiles a set of terms into a tape: an array of
+ * instructions sorted in topological order (the arguments of an
+ * instruction precede it). The tape is then run over a sequence of
+ * models. The models are processed in blocks of BATCH_EVAL_BLOCK
+ * models and each instruction is executed for all the models of a
+ * block before the next instruction. The values of an instruction for
+ * a block are stored in contiguous arrays (lanes):
+ * - Boolean values are packed: one bit per model
+ * - bitvector values of 64 bits or less are stored as uint64_t
+ *   (normalized) with one element per model
+ * The loops on lanes are simple enough for the compiler to vectorize.
+ *
+ * The leaves of the tape are the uninterpreted terms and the terms
+ * that are not Boolean or bitvector operators on 64 bits or less
+ * (arithmetic atoms, function applications, wide bitvectors, ...).
+ * The value of a leaf is read from the model if it's there or it's
+ * computed by eval_in_model otherwise, once per model. It's then
+ * converted to a lane if the leaf is a Boolean or a small bitvector.
+ *
+ * The result is a matrix of concrete values: the value of term i in
+ * model j is an object in the value table of model j. The values are
+ * the same as the ones eval_in_model would return. If the evaluation
+ * of a term fails in a model, the matrix contains the error code
+ * returned by eval_in_model. (If a leaf can't be evaluated in a model,
+ * the terms that depend on it are evaluated again by eval_in_model in
+ * that model, since eval_in_model may not need the leaf's value.)
+ *
+ * NOTE: the models must map only uninterpreted terms to values (as
+ * specified in models.h). The values of composite Boolean or bitvector
+ * terms are always computed from their arguments.
+ */
+
+#ifndef __BATCH_EVAL_H
+#define __BATCH_EVAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "model/models.h"
+#include "utils/int_hash_map.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Number of models per block: must be a multiple of 64
+ */
+#define BATCH_EVAL_BLOCK 256
+#define BATCH_EVAL_BLOCK_WORDS (BATCH_EVAL_BLOCK/64)
+
+
+/*
+ * Opcodes
+ */
+typedef enum beval_opcode {
+  BEVAL_LEAF,        // value read from the model or computed by eval_in_model
+
+  // Boolean operators
+  BEVAL_TRUE,
+  BEVAL_NOT,
+  BEVAL_OR,
+  BEVAL_XOR,
+  BEVAL_IFF,
+  BEVAL_BOOL_ITE,
+  BEVAL_BIT,
+  BEVAL_BVEQ,
+  BEVAL_BVGE,
+  BEVAL_BVSGE,
+
+  // Bitvector operators
+  BEVAL_BV_CONST,
+  BEVAL_BV_ITE,
+  BEVAL_BV_ARRAY,
+  BEVAL_BV_POLY,
+  BEVAL_BV_PPROD,
+  BEVAL_BV_DIV,
+  BEVAL_BV_REM,
+  BEVAL_BV_SDIV,
+  BEVAL_BV_SREM,
+  BEVAL_BV_SMOD,
+  BEVAL_BV_SHL,
+  BEVAL_BV_LSHR,
+  BEVAL_BV_ASHR,
+} beval_opcode_t;
+
+
+/*
+ * Kind of lanes where an instruction stores its result
+ */
+typedef enum beval_kind {
+  BEVAL_BOOL_LANE,    // packed Booleans
+  BEVAL_BV_LANE,      // bitvectors of 64bits or less
+  BEVAL_VALUE_LANE,   // concrete values (for the leaves of other types)
+} beval_kind_t;
+
+
+/*
+ * Instruction:
+ * - op = opcode
+ * - kind = kind of the result lane
+ * - term = the term computed by this instruction
+ * - nbits = number of bits if kind is BEVAL_BV_LANE (0 otherwise)
+ * - nargs = number of arguments
+ * - args = index of the first argument in the evaluator's args vector:
+ *   the arguments are instruction indices
+ * - lane = index of the result lane (among the lanes of this kind)
+ * - aux = constant value for BEVAL_BV_CONST, bit index for BEVAL_BIT,
+ *   sign bit of the arguments for BEVAL_BVSGE
+ *
+ * For BEVAL_BV_POLY and BEVAL_BV_PPROD, the coefficients and the
+ * exponents are read from the term's descriptor.
+ */
+typedef struct beval_instr_s {
+  beval_opcode_t op;
+  beval_kind_t kind;
+  term_t term;
+  uint32_t nbits;
+  uint32_t nargs;
+  uint32_t args;
+  uint32_t lane;
+  uint64_t aux;
+} beval_instr_t;
+
+#define DEF_BEVAL_TAPE_SIZE 64
+#define MAX_BEVAL_TAPE_SIZE (UINT32_MAX/sizeof(beval_instr_t))
+
+
+/*
+ * Batch evaluator:
+ * - terms = the term table
+ * - tape = array of ninstr instructions, size = its full size
+ * - args = arguments of all the instructions
+ * - index = map from terms to instructions
+ * - targets = instructions for the terms added by batch_eval_add_terms
+ * - leaves = instructions with opcode BEVAL_LEAF
+ * - nbool, nbv, nvalues = number of lanes of each kind
+ * - bool_lanes = nbool * BATCH_EVAL_BLOCK_WORDS words
+ * - bv_lanes = nbv * BATCH_EVAL_BLOCK words
+ * - value_lanes = nvalues * BATCH_EVAL_BLOCK values
+ * - bad = one bit per instruction and model: set if the value can't be
+ *   computed because eval_in_model failed on a leaf
+ *   (ninstr * BATCH_EVAL_BLOCK_WORDS words)
+ * - lanes_size = number of instructions for which the lanes are allocated
+ *
+ * The lanes are allocated when the tape is first run, and reallocated
+ * if the tape grows.
+ */
+typedef struct batch_evaluator_s {
+  term_table_t *terms;
+  beval_instr_t *tape;
+  uint32_t ninstr;
+  uint32_t size;
+  ivector_t args;
+  int_hmap_t index;
+  ivector_t targets;
+  ivector_t leaves;
+
+  uint32_t nbool;
+  uint32_t nbv;
+  uint32_t nvalues;
+  uint64_t *bool_lanes;
+  uint64_t *bv_lanes;
+  value_t *value_lanes;
+  uint64_t *bad;
+  uint32_t lanes_size;
+} batch_evaluator_t;
+
+
+
+/*
+ * Initialization: empty tape for terms in table terms
+ */
+extern void init_batch_evaluator(batch_evaluator_t *eval, term_table_t *terms);
+
+
+/*
+ * Delete: free all memory
+ */
+extern void delete_batch_evaluator(batch_evaluator_t *eval);
+
+
+/*
+ * Reset: remove all terms
+ */
+extern void reset_batch_evaluator(batch_evaluator_t *eval);
+
+
+/*
+ * Add terms a[0 ... n-1] to the set of terms to evaluate
+ * - all terms must be valid in eval->terms, and they must not be
+ *   deleted (by the garbage collector) while eval is in use
+ * - the terms are numbered in the order in which they are added
+ *   (the first term has index 0)
+ */
+extern void batch_eval_add_terms(batch_evaluator_t *eval, const term_t *a, uint32_t n);
+
+
+/*
+ * Number of terms to evaluate
+ */
+static inline uint32_t batch_eval_num_terms(batch_evaluator_t *eval) {
+  return eval->targets.size;
+}
+
+
+/*
+ * Evaluate all terms in models mdl[0 ... m-1]
+ * - all models must use the term table eval->terms
+ * - the value of term i in model j is stored in val[i * m + j]:
+ *   this is either an object in mdl[j]->vtbl or a negative error code
+ *   as returned by eval_in_model
+ * - val must be an array of size (batch_eval_num_terms(eval) * m)
+ *
+ * Evaluation may create new objects in the models' value tables.
+ * As for eval_in_model, these objects are permanent.
+ *
+ * NOTE: this function creates a temporary evaluator for each model
+ * (cf. model_eval.h) so no other evaluator must be attached to the
+ * models when it's called.
+ */
+extern void batch_eval_in_models(batch_evaluator_t *eval, model_t **mdl, uint32_t m, value_t *val);
+
+
+#endif /* __BATCH_EVAL_H */
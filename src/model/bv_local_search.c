@@ -0,0 +1,1081 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * WORD-LEVEL LOCAL SEARCH FOR BITVECTOR PROBLEMS
+ */
+
+#include <assert.h>
+
+#include "model/bv_local_search.h"
+#include "terms/bv64_constants.h"
+#include "utils/bit_tricks.h"
+#include "utils/memalloc.h"
+#include "utils/prng.h"
+
+
+/*
+ * Initialize search for the given term table
+ */
+void init_bv_local_search(bv_local_search_t *search, term_table_t *terms, uint32_t seed) {
+  search->terms = terms;
+  search->node = NULL;
+  search->nnodes = 0;
+  search->size = 0;
+  init_ivector(&search->children, 0);
+  init_int_hmap(&search->map, 0);
+  init_ivector(&search->roots, 0);
+  init_ivector(&search->vars, 0);
+  init_ivector(&search->aux, 0);
+  init_ivector(&search->false_roots, 0);
+  search->seed = seed;
+
+  search->moves = 0;
+  search->prop_moves = 0;
+  search->random_moves = 0;
+}
+
+
+/*
+ * Delete: free memory
+ */
+void delete_bv_local_search(bv_local_search_t *search) {
+  safe_free(search->node);
+  search->node = NULL;
+  delete_ivector(&search->children);
+  delete_int_hmap(&search->map);
+  delete_ivector(&search->roots);
+  delete_ivector(&search->vars);
+  delete_ivector(&search->aux);
+  delete_ivector(&search->false_roots);
+}
+
+
+/*
+ * Make the node array larger
+ */
+static void extend_bvls_nodes(bv_local_search_t *search) {
+  uint32_t n;
+
+  n = search->size;
+  if (n == 0) {
+    n = DEF_BVLS_SIZE;
+  } else {
+    n += n >> 1;
+    if (n > MAX_BVLS_SIZE) {
+      out_of_memory();
+    }
+  }
+  search->node = (bvls_node_t *) safe_realloc(search->node, n * sizeof(bvls_node_t));
+  search->size = n;
+}
+
+
+
+/*
+ * RANDOM VALUES
+ */
+
+// random integer between 0 and n-1
+static inline uint32_t bvls_random(bv_local_search_t *search, uint32_t n) {
+  assert(n > 0);
+  return random_uint(&search->seed, n);
+}
+
+// random n-bit value (the low-order bits of the PRNG are not random
+// so we use the 16 high-order bits of four calls)
+static uint64_t bvls_random64(bv_local_search_t *search, uint32_t n) {
+  uint64_t x;
+  uint32_t i;
+
+  x = 0;
+  for (i=0; i<4; i++) {
+    x = (x << 16) | (random_uint32(&search->seed) >> 16);
+  }
+  return norm64(x, n);
+}
+
+// random value between lo and hi (inclusive)
+static uint64_t bvls_random_range(bv_local_search_t *search, uint64_t lo, uint64_t hi) {
+  uint64_t d;
+
+  assert(lo <= hi);
+  d = hi - lo;
+  if (d == UINT64_MAX) {
+    return bvls_random64(search, 64);
+  }
+  return lo + bvls_random64(search, 64) % (d + 1);
+}
+
+
+
+/*
+ * CONSTRUCTION OF THE DAG
+ */
+
+/*
+ * Check whether t's type is supported: Boolean or bitvector of
+ * at most 64 bits.
+ */
+static bool bvls_supported_type(term_table_t *terms, term_t t) {
+  return is_boolean_term(terms, t) ||
+    (is_bitvector_term(terms, t) && term_bitsize(terms, t) <= 64);
+}
+
+/*
+ * Collect the children of t into v
+ * - t must be a positive term
+ * - const_idx is stored as is (in a polynomial)
+ * - return false if t is not supported
+ */
+static bool bvls_get_children(term_table_t *terms, term_t t, ivector_t *v) {
+  composite_term_t *d;
+  bvpoly64_t *p;
+  pprod_t *pp;
+  uint32_t i, n;
+
+  assert(is_pos_term(t));
+
+  ivector_reset(v);
+  if (! bvls_supported_type(terms, t)) {
+    return false;
+  }
+
+  switch (term_kind(terms, t)) {
+  case CONSTANT_TERM:
+    // only true_term is allowed (scalar constants are rejected above)
+    return index_of(t) == bool_const;
+
+  case BV64_CONSTANT:
+  case UNINTERPRETED_TERM:
+    return true;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case EQ_TERM:
+  case OR_TERM:
+  case XOR_TERM:
+  case BV_ARRAY:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    d = composite_term_desc(terms, t);
+    n = d->arity;
+    for (i=0; i<n; i++) {
+      ivector_push(v, d->arg[i]);
+    }
+    return true;
+
+  case BIT_TERM:
+    ivector_push(v, bit_term_arg(terms, t));
+    return true;
+
+  case POWER_PRODUCT:
+    pp = pprod_term_desc(terms, t);
+    n = pp->len;
+    for (i=0; i<n; i++) {
+      ivector_push(v, pp->prod[i].var);
+    }
+    return true;
+
+  case BV64_POLY:
+    p = bvpoly64_term_desc(terms, t);
+    n = p->nterms;
+    for (i=0; i<n; i++) {
+      ivector_push(v, p->mono[i].var);
+    }
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+
+/*
+ * Code for child term u
+ * - u must be const_idx or have a node
+ */
+static int32_t bvls_child_code(bv_local_search_t *search, term_t u) {
+  int_hmap_pair_t *r;
+
+  if (u == const_idx) {
+    return -1;
+  }
+  r = int_hmap_find(&search->map, index_of(u));
+  assert(r != NULL);
+  return (r->val << 1) | polarity_of(u);
+}
+
+/*
+ * Value of the child with the given code
+ */
+static inline uint64_t bvls_code_value(bv_local_search_t *search, int32_t c) {
+  if (c < 0) {
+    return 1;
+  }
+  return search->node[c >> 1].value ^ (c & 1);
+}
+
+static inline bool bvls_code_fixed(bv_local_search_t *search, int32_t c) {
+  return c < 0 || search->node[c >> 1].fixed;
+}
+
+static inline int32_t *bvls_children(bv_local_search_t *search, uint32_t i) {
+  assert(i < search->nnodes);
+  return search->children.data + search->node[i].first;
+}
+
+
+/*
+ * Operations on values (64 bits or less)
+ * - a and b are normalized n-bit values
+ */
+static uint64_t bvls_eval_binop(term_kind_t kind, uint64_t a, uint64_t b, uint32_t n) {
+  switch (kind) {
+  case BV_DIV:
+    return bvconst64_udiv2z(a, b, n);
+  case BV_REM:
+    return bvconst64_urem2z(a, b, n);
+  case BV_SDIV:
+    return bvconst64_sdiv2z(a, b, n);
+  case BV_SREM:
+    return bvconst64_srem2z(a, b, n);
+  case BV_SMOD:
+    return bvconst64_smod2z(a, b, n);
+  case BV_SHL:
+    return bvconst64_lshl(a, b, n);
+  case BV_LSHR:
+    return bvconst64_lshr(a, b, n);
+  case BV_ASHR:
+    return bvconst64_ashr(a, b, n);
+  case BV_EQ_ATOM:
+    return a == b;
+  case BV_GE_ATOM:
+    return a >= b;
+  case BV_SGE_ATOM:
+    return signed64_ge(a, b, n);
+  default:
+    assert(false);
+    return 0;
+  }
+}
+
+/*
+ * Bitsize of the arguments of a binary node
+ */
+static inline uint32_t bvls_arg_bitsize(bv_local_search_t *search, uint32_t i) {
+  int32_t *c;
+
+  c = bvls_children(search, i);
+  return search->node[c[0] >> 1].bitsize;
+}
+
+
+/*
+ * Evaluate node i: the children must be evaluated
+ */
+static void bvls_eval_node(bv_local_search_t *search, uint32_t i) {
+  term_table_t *terms;
+  bvls_node_t *d;
+  bvpoly64_t *p;
+  pprod_t *pp;
+  int32_t *c;
+  uint64_t v, x;
+  uint32_t j, k, n;
+
+  terms = search->terms;
+  d = search->node + i;
+  c = bvls_children(search, i);
+  n = d->nchildren;
+
+  switch (d->kind) {
+  case CONSTANT_TERM:
+  case BV64_CONSTANT:
+  case UNINTERPRETED_TERM:
+    // value is set elsewhere
+    return;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    v = bvls_code_value(search, c[0]) ? bvls_code_value(search, c[1]) : bvls_code_value(search, c[2]);
+    break;
+
+  case EQ_TERM:
+    v = (bvls_code_value(search, c[0]) == bvls_code_value(search, c[1]));
+    break;
+
+  case OR_TERM:
+    v = 0;
+    for (j=0; j<n; j++) {
+      if (bvls_code_value(search, c[j])) {
+        v = 1;
+        break;
+      }
+    }
+    break;
+
+  case XOR_TERM:
+    v = 0;
+    for (j=0; j<n; j++) {
+      v ^= bvls_code_value(search, c[j]);
+    }
+    break;
+
+  case BV_ARRAY:
+    v = 0;
+    for (j=0; j<n; j++) {
+      v |= bvls_code_value(search, c[j]) << j;
+    }
+    break;
+
+  case BIT_TERM:
+    v = tst_bit64(bvls_code_value(search, c[0]), bit_term_index(terms, d->term));
+    break;
+
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    v = bvls_eval_binop(d->kind, bvls_code_value(search, c[0]), bvls_code_value(search, c[1]),
+                        bvls_arg_bitsize(search, i));
+    break;
+
+  case POWER_PRODUCT:
+    pp = pprod_term_desc(terms, d->term);
+    v = 1;
+    for (j=0; j<n; j++) {
+      x = bvls_code_value(search, c[j]);
+      for (k=0; k<pp->prod[j].exp; k++) {
+        v *= x;
+      }
+    }
+    v = norm64(v, d->bitsize);
+    break;
+
+  case BV64_POLY:
+    p = bvpoly64_term_desc(terms, d->term);
+    v = 0;
+    for (j=0; j<n; j++) {
+      v += p->mono[j].coeff * bvls_code_value(search, c[j]);
+    }
+    v = norm64(v, d->bitsize);
+    break;
+
+  default:
+    assert(false);
+    v = 0;
+    break;
+  }
+
+  d->value = v;
+}
+
+
+/*
+ * Create a node for term t
+ * - the children of t are in search->aux and they all have a node
+ * - return the node id
+ */
+static uint32_t bvls_new_node(bv_local_search_t *search, term_t t) {
+  term_table_t *terms;
+  bvls_node_t *d;
+  uint32_t i, j, n;
+  int32_t c;
+  bool fixed;
+
+  terms = search->terms;
+  i = search->nnodes;
+  if (i == search->size) {
+    extend_bvls_nodes(search);
+  }
+  assert(i < search->size);
+  search->nnodes = i + 1;
+
+  d = search->node + i;
+  d->term = t;
+  d->kind = term_kind(terms, t);
+  d->bitsize = is_bitvector_term(terms, t) ? term_bitsize(terms, t) : 0;
+  d->first = search->children.size;
+  d->value = 0;
+
+  n = search->aux.size;
+  d->nchildren = n;
+  fixed = (d->kind != UNINTERPRETED_TERM);
+  for (j=0; j<n; j++) {
+    c = bvls_child_code(search, search->aux.data[j]);
+    ivector_push(&search->children, c);
+    fixed &= bvls_code_fixed(search, c);
+  }
+  d->fixed = fixed;
+
+  switch (d->kind) {
+  case CONSTANT_TERM:
+    d->value = 1;
+    break;
+
+  case BV64_CONSTANT:
+    d->value = bvconst64_term_desc(terms, t)->value;
+    break;
+
+  case UNINTERPRETED_TERM:
+    ivector_push(&search->vars, i);
+    break;
+
+  default:
+    bvls_eval_node(search, i);
+    break;
+  }
+
+  int_hmap_add(&search->map, index_of(t), i);
+
+  return i;
+}
+
+
+/*
+ * Add term t and all its subterms to the DAG
+ * - return false if an unsupported term is found
+ */
+static bool bvls_add_term(bv_local_search_t *search, term_t t) {
+  ivector_t stack;
+  term_t u;
+  uint32_t i, n;
+  bool ok, done;
+
+  ok = true;
+  init_ivector(&stack, 16);
+  ivector_push(&stack, unsigned_term(t));
+
+  while (stack.size > 0) {
+    u = ivector_last(&stack);
+    if (int_hmap_find(&search->map, index_of(u)) != NULL) {
+      ivector_pop(&stack);
+      continue;
+    }
+    if (! bvls_get_children(search->terms, u, &search->aux)) {
+      ok = false;
+      break;
+    }
+
+    // push the children that are not visited yet
+    done = true;
+    n = search->aux.size;
+    for (i=0; i<n; i++) {
+      if (search->aux.data[i] != const_idx &&
+          int_hmap_find(&search->map, index_of(search->aux.data[i])) == NULL) {
+        ivector_push(&stack, unsigned_term(search->aux.data[i]));
+        done = false;
+      }
+    }
+
+    if (done) {
+      bvls_new_node(search, u);
+      ivector_pop(&stack);
+    }
+  }
+
+  delete_ivector(&stack);
+
+  return ok;
+}
+
+
+/*
+ * Add assertions a[0 ... n-1]
+ */
+bool bv_local_search_add_assertions(bv_local_search_t *search, uint32_t n, const term_t *a) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    assert(is_boolean_term(search->terms, a[i]));
+    if (! bvls_add_term(search, a[i])) {
+      return false;
+    }
+    ivector_push(&search->roots, bvls_child_code(search, a[i]));
+  }
+
+  return true;
+}
+
+
+
+/*
+ * INVERSE VALUES
+ */
+
+/*
+ * Solve c * x = r modulo 2^n
+ * - return false if there's no solution
+ * - otherwise store a solution in *x (chosen at random if there are several)
+ */
+static bool bvls_solve_mul(bv_local_search_t *search, uint64_t c, uint64_t r, uint32_t n, uint64_t *x) {
+  uint64_t inv, y;
+  uint32_t k;
+
+  c = norm64(c, n);
+  r = norm64(r, n);
+  if (c == 0) {
+    return false;
+  }
+
+  // c = 2^k * c' with c' odd: r must be divisible by 2^k
+  k = ctz64(c);
+  if (k > 0 && (r & mask64(k)) != 0) {
+    return false;
+  }
+
+  // inverse of c' modulo 2^64 (Newton iteration)
+  c >>= k;
+  inv = c;
+  inv *= 2 - c * inv;
+  inv *= 2 - c * inv;
+  inv *= 2 - c * inv;
+  inv *= 2 - c * inv;
+  inv *= 2 - c * inv;
+  assert(c * inv == 1);
+
+  y = (r >> k) * inv;
+  if (k > 0) {
+    // the k high-order bits are arbitrary
+    y = norm64(y, n - k) | (bvls_random64(search, k) << (n - k));
+  }
+  *x = norm64(y, n);
+
+  return true;
+}
+
+
+/*
+ * Choose a random element in search->aux
+ */
+static inline int32_t bvls_random_aux(bv_local_search_t *search) {
+  assert(search->aux.size > 0);
+  return search->aux.data[bvls_random(search, search->aux.size)];
+}
+
+/*
+ * Store in search->aux the indices j of the non-fixed children of node i
+ */
+static void bvls_collect_free_children(bv_local_search_t *search, uint32_t i) {
+  int32_t *c;
+  uint32_t j, n;
+
+  ivector_reset(&search->aux);
+  c = bvls_children(search, i);
+  n = search->node[i].nchildren;
+  for (j=0; j<n; j++) {
+    if (! bvls_code_fixed(search, c[j])) {
+      ivector_push(&search->aux, j);
+    }
+  }
+}
+
+
+/*
+ * Inverse value for a binary node i of kind BV_DIV ... BV_ASHR
+ * - j = index of the child to change (0 or 1)
+ * - o = value of the other child
+ * - t = target value for node i
+ * - return a value x for child j such that i evaluates to t
+ *   or a random value if we can't find one
+ */
+static uint64_t bvls_inverse_binop(bv_local_search_t *search, uint32_t i, uint32_t j, uint64_t o, uint64_t t) {
+  term_kind_t kind;
+  uint64_t x, max;
+  uint32_t n, k;
+
+  kind = search->node[i].kind;
+  n = search->node[i].bitsize;
+  max = mask64(n);
+  x = 0;
+
+  switch (kind) {
+  case BV_DIV:
+  case BV_SDIV:
+    if (j == 0) {
+      // x = t * o + random remainder
+      x = norm64(t * o, n);
+      if (o > 1) {
+        x = norm64(x + bvls_random_range(search, 0, o - 1), n);
+      }
+    } else if (t != 0) {
+      // x = o / t
+      x = o / t;
+    } else if (o < max) {
+      x = bvls_random_range(search, o + 1, max);
+    }
+    break;
+
+  case BV_REM:
+  case BV_SREM:
+  case BV_SMOD:
+    if (j == 0) {
+      x = t;
+    } else if (o > t) {
+      x = o - t;
+    }
+    break;
+
+  case BV_SHL:
+    if (j == 0) {
+      x = (o < n) ? t >> o : bvls_random64(search, n);
+    }
+    break;
+
+  case BV_LSHR:
+  case BV_ASHR:
+    if (j == 0 && o < n) {
+      x = norm64(t << o, n);
+      if (o > 0) {
+        x |= bvls_random64(search, o);
+      }
+    }
+    break;
+
+  default:
+    assert(false);
+    break;
+  }
+
+  if (j == 1 && (kind == BV_SHL || kind == BV_LSHR || kind == BV_ASHR)) {
+    // try all shift amounts from a random start
+    k = bvls_random(search, n + 1);
+    for (x=0; x<=n; x++) {
+      if (bvls_eval_binop(kind, o, (x + k) % (n + 1), n) == t) {
+        return (x + k) % (n + 1);
+      }
+    }
+    return bvls_random64(search, n);
+  }
+
+  if (j == 0 && bvls_eval_binop(kind, x, o, n) == t) return x;
+  if (j == 1 && bvls_eval_binop(kind, o, x, n) == t) return x;
+
+  return bvls_random64(search, n);
+}
+
+
+/*
+ * Inverse value for a comparison node i (BV_EQ_ATOM, BV_GE_ATOM, BV_SGE_ATOM)
+ * - j = index of the child to change
+ * - o = value of the other child
+ * - t = target truth value
+ * - return false if there's no possible value
+ */
+static bool bvls_inverse_compare(bv_local_search_t *search, uint32_t i, uint32_t j, uint64_t o, uint64_t t, uint64_t *x) {
+  term_kind_t kind;
+  uint64_t f, max, y;
+  uint32_t n;
+
+  kind = search->node[i].kind;
+  n = bvls_arg_bitsize(search, i);
+  max = mask64(n);
+
+  if (kind == BV_EQ_ATOM) {
+    if (t) {
+      *x = o;
+    } else {
+      y = bvls_random64(search, n);
+      if (y == 0) y = 1;
+      *x = o ^ y;
+    }
+    return true;
+  }
+
+  /*
+   * signed comparison: flip the sign bit to map it
+   * to an unsigned comparison
+   */
+  f = (kind == BV_SGE_ATOM) ? sgn_bit_mask64(n) : 0;
+  o ^= f;
+
+  if (j == 0) {
+    // x >= o or x < o
+    if (t) {
+      y = bvls_random_range(search, o, max);
+    } else if (o > 0) {
+      y = bvls_random_range(search, 0, o - 1);
+    } else {
+      return false;
+    }
+  } else {
+    // o >= x or o < x
+    if (t) {
+      y = bvls_random_range(search, 0, o);
+    } else if (o < max) {
+      y = bvls_random_range(search, o + 1, max);
+    } else {
+      return false;
+    }
+  }
+
+  *x = y ^ f;
+
+  return true;
+}
+
+
+/*
+ * Inverse for a polynomial or power product: the result is
+ * c * x where x is the child to change.
+ * - for a polynomial, c is the coefficient of x and the rest of
+ *   the polynomial is subtracted from the target
+ * - for a power product, x must have exponent 1 and c is the
+ *   product of the other factors.
+ */
+static bool bvls_inverse_arith(bv_local_search_t *search, uint32_t i, uint32_t j, uint64_t t, uint64_t *x) {
+  bvls_node_t *d;
+  bvpoly64_t *p;
+  pprod_t *pp;
+  int32_t *c;
+  uint64_t a, v;
+  uint32_t k, e, n;
+
+  d = search->node + i;
+  c = bvls_children(search, i);
+  n = d->nchildren;
+
+  if (d->kind == BV64_POLY) {
+    p = bvpoly64_term_desc(search->terms, d->term);
+    for (k=0; k<n; k++) {
+      if (k != j) {
+        t -= p->mono[k].coeff * bvls_code_value(search, c[k]);
+      }
+    }
+    return bvls_solve_mul(search, p->mono[j].coeff, t, d->bitsize, x);
+  }
+
+  assert(d->kind == POWER_PRODUCT);
+  pp = pprod_term_desc(search->terms, d->term);
+  if (pp->prod[j].exp != 1) {
+    return false;
+  }
+  a = 1;
+  for (k=0; k<n; k++) {
+    if (k != j) {
+      v = bvls_code_value(search, c[k]);
+      for (e=0; e<pp->prod[k].exp; e++) {
+        a *= v;
+      }
+    }
+  }
+  return bvls_solve_mul(search, a, t, d->bitsize, x);
+}
+
+
+/*
+ * Select a child of node i and a value for it so that i gets value t
+ * - i must not be fixed and its current value must be different from t
+ * - on success, return true and store the child's node id in *child
+ *   and its target value in *ct
+ * - return false if no child can be selected
+ */
+static bool bvls_propagate(bv_local_search_t *search, uint32_t i, uint64_t t, uint32_t *child, uint64_t *ct) {
+  bvls_node_t *d;
+  int32_t *c;
+  uint64_t v, o;
+  uint32_t j, k, n, start;
+  int32_t a, b;
+
+  d = search->node + i;
+  c = bvls_children(search, i);
+  n = d->nchildren;
+
+  switch (d->kind) {
+  case OR_TERM:
+    // t true: make a false child true
+    // t false: make a true child false
+    ivector_reset(&search->aux);
+    for (j=0; j<n; j++) {
+      if (! bvls_code_fixed(search, c[j]) && bvls_code_value(search, c[j]) != t) {
+        ivector_push(&search->aux, j);
+      }
+    }
+    if (search->aux.size == 0) return false;
+    j = bvls_random_aux(search);
+    v = t;
+    break;
+
+  case EQ_TERM:
+  case XOR_TERM:
+    // flip any child
+    bvls_collect_free_children(search, i);
+    if (search->aux.size == 0) return false;
+    j = bvls_random_aux(search);
+    v = bvls_code_value(search, c[j]) ^ 1;
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    // flip the condition or change the active branch
+    a = bvls_code_value(search, c[0]) ? c[1] : c[2];
+    b = bvls_code_value(search, c[0]) ? c[2] : c[1];
+    if (! bvls_code_fixed(search, c[0]) &&
+        (bvls_code_fixed(search, a) || (bvls_code_value(search, b) == t && bvls_random(search, 2) == 0))) {
+      j = 0;
+      v = bvls_code_value(search, c[0]) ^ 1;
+    } else if (! bvls_code_fixed(search, a)) {
+      j = (a == c[1]) ? 1 : 2;
+      v = t;
+    } else {
+      return false;
+    }
+    break;
+
+  case BV_ARRAY:
+    // flip a bit that differs from t
+    ivector_reset(&search->aux);
+    for (j=0; j<n; j++) {
+      if (! bvls_code_fixed(search, c[j]) && bvls_code_value(search, c[j]) != tst_bit64(t, j)) {
+        ivector_push(&search->aux, j);
+      }
+    }
+    if (search->aux.size == 0) return false;
+    j = bvls_random_aux(search);
+    v = tst_bit64(t, j);
+    break;
+
+  case BIT_TERM:
+    j = 0;
+    k = bit_term_index(search->terms, d->term);
+    v = bvls_code_value(search, c[0]);
+    v = t ? set_bit64(v, k) : clr_bit64(v, k);
+    break;
+
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+    bvls_collect_free_children(search, i);
+    assert(search->aux.size > 0);
+    j = bvls_random_aux(search);
+    o = bvls_code_value(search, c[1 - j]);
+    v = bvls_inverse_binop(search, i, j, o, t);
+    break;
+
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    bvls_collect_free_children(search, i);
+    assert(search->aux.size > 0);
+    j = bvls_random_aux(search);
+    o = bvls_code_value(search, c[1 - j]);
+    if (! bvls_inverse_compare(search, i, j, o, t, &v)) {
+      // try the other child
+      j = 1 - j;
+      if (bvls_code_fixed(search, c[j])) return false;
+      o = bvls_code_value(search, c[1 - j]);
+      if (! bvls_inverse_compare(search, i, j, o, t, &v)) return false;
+    }
+    break;
+
+  case POWER_PRODUCT:
+  case BV64_POLY:
+    // try all children from a random start
+    bvls_collect_free_children(search, i);
+    n = search->aux.size;
+    if (n == 0) return false;
+    start = bvls_random(search, n);
+    for (k=0; k<n; k++) {
+      j = search->aux.data[(start + k) % n];
+      if (bvls_inverse_arith(search, i, j, t, &v)) {
+        goto found;
+      }
+    }
+    return false;
+
+  default:
+    assert(false);
+    return false;
+  }
+
+ found:
+  assert(! bvls_code_fixed(search, c[j]));
+  *child = c[j] >> 1;
+  *ct = v ^ (c[j] & 1);
+
+  return true;
+}
+
+
+
+/*
+ * SEARCH
+ */
+
+/*
+ * Re-evaluate all nodes after node i
+ */
+static void bvls_update(bv_local_search_t *search, uint32_t i) {
+  uint32_t n;
+
+  n = search->nnodes;
+  for (i++; i<n; i++) {
+    if (! search->node[i].fixed) {
+      bvls_eval_node(search, i);
+    }
+  }
+}
+
+/*
+ * Random walk: flip a random bit of a random variable
+ * - return the variable's node id
+ */
+static uint32_t bvls_random_walk(bv_local_search_t *search) {
+  bvls_node_t *d;
+  uint32_t i;
+
+  assert(search->vars.size > 0);
+  i = search->vars.data[bvls_random(search, search->vars.size)];
+  d = search->node + i;
+  if (d->bitsize == 0) {
+    d->value ^= 1;
+  } else {
+    d->value ^= ((uint64_t) 1) << bvls_random(search, d->bitsize);
+  }
+  search->random_moves ++;
+
+  return i;
+}
+
+/*
+ * One move: propagate true from a random false assertion
+ * - r = code of the assertion
+ */
+static void bvls_move(bv_local_search_t *search, int32_t r) {
+  bvls_node_t *d;
+  uint32_t i, child;
+  uint64_t t, ct;
+
+  i = r >> 1;
+  t = 1 ^ (r & 1);
+  while (search->node[i].kind != UNINTERPRETED_TERM) {
+    d = search->node + i;
+    assert(d->value != t);
+    if (d->fixed || ! bvls_propagate(search, i, t, &child, &ct)) {
+      i = bvls_random_walk(search);
+      goto update;
+    }
+    i = child;
+    t = ct;
+    if (search->node[i].value == t) {
+      // can happen after a random inverse
+      return;
+    }
+  }
+
+  search->node[i].value = t;
+  search->prop_moves ++;
+
+ update:
+  bvls_update(search, i);
+}
+
+
+/*
+ * Collect the false assertions in search->false_roots
+ * - return false if one of them is fixed
+ */
+static bool bvls_collect_false_roots(bv_local_search_t *search) {
+  uint32_t i, n;
+  int32_t r;
+
+  ivector_reset(&search->false_roots);
+  n = search->roots.size;
+  for (i=0; i<n; i++) {
+    r = search->roots.data[i];
+    if (bvls_code_value(search, r) == 0) {
+      if (bvls_code_fixed(search, r)) {
+        return false;
+      }
+      ivector_push(&search->false_roots, r);
+    }
+  }
+
+  return true;
+}
+
+
+/*
+ * Run the search for at most max_moves moves
+ */
+bool bv_local_search_run(bv_local_search_t *search, uint32_t max_moves) {
+  ivector_t *v;
+  uint32_t k;
+
+  v = &search->false_roots;
+  for (k=0; k<max_moves; k++) {
+    if (! bvls_collect_false_roots(search)) {
+      return false;
+    }
+    if (v->size == 0) {
+      return true;
+    }
+    if (search->vars.size == 0) {
+      return false;
+    }
+    bvls_move(search, v->data[bvls_random(search, v->size)]);
+    search->moves ++;
+  }
+
+  return bvls_collect_false_roots(search) && v->size == 0;
+}
+
+
+/*
+ * Store the assignment in mdl
+ */
+void bv_local_search_build_model(bv_local_search_t *search, model_t *mdl) {
+  value_table_t *vtbl;
+  bvls_node_t *d;
+  value_t v;
+  uint32_t i, n;
+
+  vtbl = model_get_vtbl(mdl);
+  n = search->vars.size;
+  for (i=0; i<n; i++) {
+    d = search->node + search->vars.data[i];
+    assert(d->kind == UNINTERPRETED_TERM);
+    if (d->bitsize == 0) {
+      v = vtbl_mk_bool(vtbl, d->value);
+    } else {
+      v = vtbl_mk_bv_from_bv64(vtbl, d->bitsize, d->value);
+    }
+    model_map_term(mdl, d->term, v);
+  }
+}
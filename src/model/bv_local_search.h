@@ -0,0 +1,145 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * WORD-LEVEL LOCAL SEARCH FOR BITVECTOR PROBLEMS
+ *
+ * This is an incomplete procedure that tries to find a model of a set
+ * of assertions without bit-blasting. It works directly on the terms:
+ * - all uninterpreted terms get a value (initially 0 or false)
+ * - every term in the assertions is evaluated bottom-up
+ * - if an assertion is false, a move tries to fix it: the target
+ *   value (true) is propagated down from the assertion to a variable
+ *   by computing an inverse value for one of the children of each
+ *   node on the path. The variable then gets the inverse value.
+ * - if propagation fails, the move is a random walk step: a random
+ *   bit of a random variable is flipped.
+ * The search stops as soon as all assertions are true or after a
+ * given number of moves.
+ *
+ * Only Boolean terms and bitvector terms of no more than 64 bits are
+ * supported. Terms of other types or wider bitvectors are rejected
+ * when the assertions are added.
+ */
+
+#ifndef __BV_LOCAL_SEARCH_H
+#define __BV_LOCAL_SEARCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "model/models.h"
+#include "terms/terms.h"
+#include "utils/int_hash_map.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Node = a term in the assertions' DAG
+ * - term = the term (positive occurrence)
+ * - kind = its kind
+ * - bitsize = number of bits (0 for Boolean terms)
+ * - nchildren = number of children
+ * - first = index of the first child in the children vector
+ * - value = current value (0 or 1 for Boolean terms)
+ * - fixed = true if the value does not depend on any variable
+ *
+ * A child is stored as a code: (node id << 1) | polarity, or -1 for
+ * const_idx (a monomial with no variable). The value of a Boolean child
+ * is the node's value xor polarity. The value of -1 is 1.
+ */
+typedef struct bvls_node_s {
+  term_t term;
+  term_kind_t kind;
+  uint32_t bitsize;
+  uint32_t nchildren;
+  uint32_t first;
+  uint64_t value;
+  bool fixed;
+} bvls_node_t;
+
+
+/*
+ * Search state:
+ * - terms = term table
+ * - node = array of nodes, in topological order (children first)
+ * - nnodes = number of nodes
+ * - size = size of the node array
+ * - children = child codes for all nodes
+ * - map = maps term indices to node ids
+ * - roots = codes of the assertions
+ * - vars = ids of the variable nodes (uninterpreted terms)
+ * - aux, false_roots = buffers
+ * - seed = for the pseudo-random number generator
+ * - statistics: number of moves, propagation moves, random walk moves
+ */
+typedef struct bv_local_search_s {
+  term_table_t *terms;
+  bvls_node_t *node;
+  uint32_t nnodes;
+  uint32_t size;
+  ivector_t children;
+  int_hmap_t map;
+  ivector_t roots;
+  ivector_t vars;
+  ivector_t aux;
+  ivector_t false_roots;
+  uint32_t seed;
+
+  uint32_t moves;
+  uint32_t prop_moves;
+  uint32_t random_moves;
+} bv_local_search_t;
+
+#define DEF_BVLS_SIZE 64
+#define MAX_BVLS_SIZE (UINT32_MAX/sizeof(bvls_node_t))
+
+#define BVLS_DEFAULT_SEED 0xabcdef98
+
+
+/*
+ * Initialize search for the given term table and random seed
+ */
+extern void init_bv_local_search(bv_local_search_t *search, term_table_t *terms, uint32_t seed);
+
+/*
+ * Delete: free memory
+ */
+extern void delete_bv_local_search(bv_local_search_t *search);
+
+/*
+ * Add assertions a[0 ... n-1]
+ * - all of them must be Boolean terms
+ * - return false if one of them contains an unsupported term
+ */
+extern bool bv_local_search_add_assertions(bv_local_search_t *search, uint32_t n, const term_t *a);
+
+/*
+ * Run the search for at most max_moves moves
+ * - return true if all assertions are true in the final assignment
+ */
+extern bool bv_local_search_run(bv_local_search_t *search, uint32_t max_moves);
+
+/*
+ * Store the current assignment in model mdl
+ * - every variable must be unassigned in mdl
+ */
+extern void bv_local_search_build_model(bv_local_search_t *search, model_t *mdl);
+
+
+#endif /* __BV_LOCAL_SEARCH_H */
@@ -49,12 +49,49 @@
   } while(0)
 
 
+/*
+ * Same thing for a reader/writer lock:
+ * - MT_PROTECT_READ is for expressions that don't modify the protected data
+ * - MT_PROTECT_WRITE and MT_PROTECT_WRITE_VOID are for everything else
+ */
+#define MT_PROTECT_READ(TYPE,LOCK,EXPRESSION)\
+  do { yices_rwlock_t *lock = &(LOCK);\
+       TYPE retval;\
+       get_yices_read_lock(lock);\
+       retval = (EXPRESSION);\
+       release_yices_read_lock(lock);\
+       return retval;\
+  } while(0)
+
+#define MT_PROTECT_WRITE_VOID(LOCK,EXPRESSION)\
+  do { yices_rwlock_t *lock = &(LOCK);\
+       get_yices_write_lock(lock);\
+       (EXPRESSION);\
+       release_yices_write_lock(lock);\
+  } while(0)
+
+#define MT_PROTECT_WRITE(TYPE,LOCK,EXPRESSION)\
+  do { yices_rwlock_t *lock = &(LOCK);\
+       TYPE retval;\
+       get_yices_write_lock(lock);\
+       retval = (EXPRESSION);\
+       release_yices_write_lock(lock);\
+       return retval;\
+  } while(0)
+
+
 #else
 
 #define MT_PROTECT_VOID(LOCK,EXPRESSION)  EXPRESSION
 
 #define MT_PROTECT(TYPE,LOCK,EXPRESSION)  return EXPRESSION
 
+#define MT_PROTECT_READ(TYPE,LOCK,EXPRESSION)  return EXPRESSION
+
+#define MT_PROTECT_WRITE_VOID(LOCK,EXPRESSION)  EXPRESSION
+
+#define MT_PROTECT_WRITE(TYPE,LOCK,EXPRESSION)  return EXPRESSION
+
 #endif
 
 
@@ -31,9 +31,11 @@
 #ifdef MINGW
 #include <synchapi.h>
 typedef CRITICAL_SECTION yices_lock_t;
+typedef SRWLOCK yices_rwlock_t;
 #else
 #include <pthread.h>
 typedef pthread_mutex_t yices_lock_t;
+typedef pthread_rwlock_t yices_rwlock_t;
 #endif
 
 
@@ -52,6 +54,33 @@ extern int32_t release_yices_lock(yices_lock_t* lock);
 extern void destroy_yices_lock(yices_lock_t* lock);
 
 
+/*
+ * Reader/writer locks: several threads can hold the lock in read
+ * (shared) mode, or a single thread can hold it in write (exclusive) mode.
+ * - the locks are not recursive
+ * - a thread that holds the lock in read mode must not try to get it
+ *   in write mode (deadlock)
+ * - writers have priority over new readers
+ */
+
+/* returns 0 on success; -1 on failure (and prints an error message) */
+extern int32_t create_yices_rwlock(yices_rwlock_t* lock);
+
+/* returns 0 on success; -1 on failure (and prints an error message) */
+extern int32_t get_yices_read_lock(yices_rwlock_t* lock);
+
+/* returns 0 on success; -1 on failure (and prints an error message) */
+extern int32_t release_yices_read_lock(yices_rwlock_t* lock);
+
+/* returns 0 on success; -1 on failure (and prints an error message) */
+extern int32_t get_yices_write_lock(yices_rwlock_t* lock);
+
+/* returns 0 on success; -1 on failure (and prints an error message) */
+extern int32_t release_yices_write_lock(yices_rwlock_t* lock);
+
+extern void destroy_yices_rwlock(yices_rwlock_t* lock);
+
+
 #endif
 
 #endif /* __YICES_LOCKS_H */
@@ -92,3 +92,67 @@ void destroy_yices_lock(yices_lock_t* lock){
   check_thread_api(pthread_mutex_destroy(lock),
 		   "destroy_yices_lock: pthread_mutex_destroy");
 }
+
+
+int32_t create_yices_rwlock(yices_rwlock_t* lock){
+  pthread_rwlockattr_t *rwattr = NULL;
+
+#ifdef __GLIBC__
+  /*
+   * glibc's default favors readers: a steady stream of readers could
+   * starve the threads that build terms.
+   */
+  pthread_rwlockattr_t rwa;
+
+  rwattr = &rwa;
+
+  check_thread_api(pthread_rwlockattr_init(rwattr),
+		   "create_yices_rwlock: pthread_rwlockattr_init");
+  check_thread_api(pthread_rwlockattr_setkind_np(rwattr,
+						 PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP),
+		   "create_yices_rwlock: pthread_rwlockattr_setkind_np");
+#endif
+
+  check_thread_api(pthread_rwlock_init(lock, rwattr),
+		   "create_yices_rwlock: pthread_rwlock_init");
+
+#ifdef __GLIBC__
+  check_thread_api(pthread_rwlockattr_destroy(rwattr),
+		   "create_yices_rwlock: pthread_rwlockattr_destroy");
+#endif
+
+  return 0;
+}
+
+int32_t get_yices_read_lock(yices_rwlock_t* lock){
+  check_thread_api(pthread_rwlock_rdlock(lock),
+		   "get_yices_read_lock: pthread_rwlock_rdlock");
+
+  return 0;
+}
+
+int32_t release_yices_read_lock(yices_rwlock_t* lock){
+  check_thread_api(pthread_rwlock_unlock(lock),
+		   "release_yices_read_lock: pthread_rwlock_unlock");
+
+  return 0;
+}
+
+int32_t get_yices_write_lock(yices_rwlock_t* lock){
+  check_thread_api(pthread_rwlock_wrlock(lock),
+		   "get_yices_write_lock: pthread_rwlock_wrlock");
+
+  return 0;
+}
+
+int32_t release_yices_write_lock(yices_rwlock_t* lock){
+  check_thread_api(pthread_rwlock_unlock(lock),
+		   "release_yices_write_lock: pthread_rwlock_unlock");
+
+  return 0;
+}
+
+void destroy_yices_rwlock(yices_rwlock_t* lock){
+  check_thread_api(pthread_rwlock_destroy(lock),
+		   "destroy_yices_rwlock: pthread_rwlock_destroy");
+}
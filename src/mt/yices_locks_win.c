@@ -50,3 +50,37 @@ void destroy_yices_lock(yices_lock_t* lock){
   /* void return type */
   DeleteCriticalSection(lock);
 }
+
+
+/*
+ * Slim reader/writer locks (Vista or later). They don't need to be
+ * destroyed. They are not fair but they don't starve writers in practice.
+ */
+int32_t create_yices_rwlock(yices_rwlock_t* lock){
+  InitializeSRWLock(lock);
+  return 0;
+}
+
+int32_t get_yices_read_lock(yices_rwlock_t* lock){
+  AcquireSRWLockShared(lock);
+  return 0;
+}
+
+int32_t release_yices_read_lock(yices_rwlock_t* lock){
+  ReleaseSRWLockShared(lock);
+  return 0;
+}
+
+int32_t get_yices_write_lock(yices_rwlock_t* lock){
+  AcquireSRWLockExclusive(lock);
+  return 0;
+}
+
+int32_t release_yices_write_lock(yices_rwlock_t* lock){
+  ReleaseSRWLockExclusive(lock);
+  return 0;
+}
+
+void destroy_yices_rwlock(yices_rwlock_t* lock){
+  (void) lock;
+}
@@ -189,6 +189,7 @@ int close_lexer(lexer_t *lex) {
  * - if lex->next is NULL (toplevel lexer), delete the internal buffer
  */
 void close_lexer_only(lexer_t *lex) {
+  close_reader_only(&lex->reader);
   if (lex->next == NULL) {
     if (lex->buffer != NULL) {
       delete_string_buffer(lex->buffer);
@@ -203,11 +204,7 @@ void close_lexer_only(lexer_t *lex) {
  * Flush: read until the end of the line or EOF
  */
 void flush_lexer(lexer_t *lex) {
-  int c;
-  c = reader_current_char(&lex->reader);
-  while (c != '\n' && c != EOF) {
-    c = reader_next_char(&lex->reader);
-  }
+  reader_skip_to_eol(&lex->reader);
   lex->token = -1;
   string_buffer_reset(lex->buffer);
 }
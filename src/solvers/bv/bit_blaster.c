@@ -446,6 +446,7 @@ void init_bit_blaster(bit_blaster_t *s, smt_core_t *solver, remap_table_t *remap
   s->solver = solver;
   s->remap = remap;
   s->htbl = get_gate_table(solver);
+  init_ivector(&s->or_def, 0);
   init_cbuffer(&s->buffer);
   init_ivector(&s->aux_vector, 0);
   init_ivector(&s->aux_vector2, 0);
@@ -460,6 +461,7 @@ void init_bit_blaster(bit_blaster_t *s, smt_core_t *solver, remap_table_t *remap
 void delete_bit_blaster(bit_blaster_t *s) {
   s->solver = NULL;
   s->htbl = NULL;
+  delete_ivector(&s->or_def);
   delete_ivector(&s->aux_vector);
   delete_ivector(&s->aux_vector2);
   delete_ivector(&s->aux_vector3);
@@ -471,6 +473,7 @@ void delete_bit_blaster(bit_blaster_t *s) {
  * Reset buffers
  */
 void reset_bit_blaster(bit_blaster_t *s) {
+  ivector_reset(&s->or_def);
   reset_cbuffer(&s->buffer);
   ivector_reset(&s->aux_vector);
   ivector_reset(&s->aux_vector2);
@@ -1660,6 +1663,183 @@ literal_t bit_blaster_eval_bveq(bit_blaster_t *s, uint32_t n, literal_t *a, lite
 
 
 
+/**************************
+ *  TWO-LEVEL REWRITING   *
+ *************************/
+
+/*
+ * Binary or gates form an And-Inverter Graph: (not x) = (and (not a) (not b))
+ * when x = (or a b). Before creating a new or2 gate, we look at the
+ * definitions of its inputs and apply the optimization rules of
+ * Brummayer & Biere, "Local Two-Level And-Inverter Graph Minimization
+ * without Blowup" (2006). These never increase the number of gates.
+ *
+ * The definitions are stored in s->or_def: if variable x was created
+ * as output of (or a b) then or_def[2x] = a and or_def[2x+1] = b.
+ * The gate table and the variables are modified on pop, so an entry
+ * is used only if the gate table still maps (or a b) to x.
+ */
+
+// defined below
+static literal_t make_or2(bit_blaster_t *s, literal_t a, literal_t b);
+
+/*
+ * Record that l = (or a b)
+ * - l must be a positive literal
+ */
+static void record_or2_def(bit_blaster_t *s, literal_t l, literal_t a, literal_t b) {
+  ivector_t *v;
+  uint32_t i;
+  bvar_t x;
+
+  assert(is_pos(l));
+
+  v = &s->or_def;
+  x = var_of(l);
+  i = 2 * x;
+  while (v->size <= i + 1) {
+    ivector_push(v, null_literal);
+  }
+  v->data[i] = a;
+  v->data[i+1] = b;
+}
+
+/*
+ * Check whether l is an and gate or the negation of an and gate
+ * - if l = (and c[0] c[1]) return 1
+ * - if l = (not (and c[0] c[1])) return -1
+ * - otherwise return 0
+ */
+static int32_t and_gate_def(bit_blaster_t *s, literal_t l, literal_t c[2]) {
+  ivector_t *v;
+  boolgate_t *g;
+  literal_t a, b;
+  uint32_t i;
+
+  v = &s->or_def;
+  i = 2 * var_of(l);
+  if (i + 1 >= v->size || v->data[i] == null_literal) {
+    return 0;
+  }
+
+  a = v->data[i];
+  b = v->data[i+1];
+  g = gate_table_find_or2(s->htbl, a, b);
+  if (g == NULL || g->lit[2] != pos_lit(var_of(l))) {
+    // stale entry
+    v->data[i] = null_literal;
+    v->data[i+1] = null_literal;
+    return 0;
+  }
+
+  c[0] = not(a);
+  c[1] = not(b);
+  return is_neg(l) ? 1 : -1;
+}
+
+/*
+ * (and a b) = (not (or (not a) (not b)))
+ */
+static inline literal_t rewrite_make_and2(bit_blaster_t *s, literal_t a, literal_t b) {
+  return not(make_or2(s, not(a), not(b)));
+}
+
+/*
+ * Rules for (and a b) where a is a gate:
+ * - ka = +1 if a = (and ca[0] ca[1])
+ * - ka = -1 if a = (not (and ca[0] ca[1]))
+ * - kb and cb are the same for b (kb = 0 if b is not a gate)
+ * Return null_literal if no rule applies.
+ */
+static literal_t rewrite_and2_aux(bit_blaster_t *s, literal_t a, int32_t ka, literal_t *ca,
+                                  literal_t b, int32_t kb, literal_t *cb) {
+  uint32_t i, j;
+
+  if (ka > 0) {
+    // contradiction: (and (and x y) (not x)) = false
+    if (b == not(ca[0]) || b == not(ca[1])) return false_literal;
+    // idempotence: (and (and x y) x) = (and x y)
+    if (b == ca[0] || b == ca[1]) return a;
+    if (kb > 0) {
+      // contradiction: (and (and x y) (and (not x) z)) = false
+      for (i=0; i<2; i++) {
+        for (j=0; j<2; j++) {
+          if (ca[i] == not(cb[j])) return false_literal;
+        }
+      }
+    }
+
+  } else if (ka < 0) {
+    // subsumption: (and (not (and x y)) (not x)) = (not x)
+    if (b == not(ca[0]) || b == not(ca[1])) return b;
+    // substitution: (and (not (and x y)) x) = (and x (not y))
+    if (b == ca[0]) return rewrite_make_and2(s, b, not(ca[1]));
+    if (b == ca[1]) return rewrite_make_and2(s, b, not(ca[0]));
+
+    if (kb > 0) {
+      for (i=0; i<2; i++) {
+        for (j=0; j<2; j++) {
+          // subsumption: (and (not (and x y)) (and (not x) z)) = (and (not x) z)
+          if (cb[j] == not(ca[i])) return b;
+        }
+      }
+      for (i=0; i<2; i++) {
+        for (j=0; j<2; j++) {
+          // substitution: (and (not (and x y)) (and x z)) = (and (and x z) (not y))
+          if (cb[j] == ca[i]) return rewrite_make_and2(s, b, not(ca[1-i]));
+        }
+      }
+
+    } else if (kb < 0) {
+      // resolution: (and (not (and x y)) (not (and x (not y)))) = (not x)
+      for (i=0; i<2; i++) {
+        for (j=0; j<2; j++) {
+          if (ca[i] == cb[j] && ca[1-i] == not(cb[1-j])) return not(ca[i]);
+        }
+      }
+    }
+  }
+
+  return null_literal;
+}
+
+/*
+ * Try to simplify (and a b) using the definitions of a and b
+ * - return null_literal if that fails
+ */
+static literal_t rewrite_and2(bit_blaster_t *s, literal_t a, literal_t b) {
+  literal_t ca[2], cb[2];
+  int32_t ka, kb;
+  literal_t l;
+
+  ka = and_gate_def(s, a, ca);
+  kb = and_gate_def(s, b, cb);
+  if (ka == 0 && kb == 0) {
+    return null_literal;
+  }
+
+  l = rewrite_and2_aux(s, a, ka, ca, b, kb, cb);
+  if (l == null_literal) {
+    l = rewrite_and2_aux(s, b, kb, cb, a, ka, ca);
+  }
+  return l;
+}
+
+/*
+ * Try to simplify (or a b) = (not (and (not a) (not b)))
+ */
+static literal_t rewrite_or2(bit_blaster_t *s, literal_t a, literal_t b) {
+  literal_t l;
+
+  l = rewrite_and2(s, not(a), not(b));
+  if (l != null_literal) {
+    l = not(l);
+  }
+  return l;
+}
+
+
+
 /************************
  *  GATE CONSTRUCTION   *
  ***********************/
@@ -1705,6 +1885,10 @@ literal_t bit_blaster_make_or(bit_blaster_t *s, uint32_t n, literal_t *a) {
   if (n == 0) return false_literal;
   if (n == 1) return v->data[0];
 
+  if (n == 2) {
+    return make_or2(s, v->data[0], v->data[1]);
+  }
+
   if (n <= BIT_BLASTER_MAX_HASHCONS_SIZE) {
     g = gate_table_get_or(s->htbl, n, v->data);
     l = g->lit[n];  // output literal for an or gate
@@ -1844,18 +2028,28 @@ static literal_t make_or2(bit_blaster_t *s, literal_t a, literal_t b) {
   aux = bit_blaster_eval_or2(s, a, b);
   if (aux == null_literal) {
     /*
-     * look in the hash table for (xor a b)
+     * look in the hash table for (or a b)
      * - normalize first: arguments must be in increasing order
      */
     if (a > b) {
       aux = a; a = b; b = aux;
     }
-    g = gate_table_get_or2(s->htbl, a, b);
-    aux = g->lit[2];
+    g = gate_table_find_or2(s->htbl, a, b);
+    if (g != NULL && g->lit[2] != null_literal) {
+      return g->lit[2];
+    }
+
+    /*
+     * new gate: try two-level rewriting
+     */
+    aux = rewrite_or2(s, a, b);
     if (aux == null_literal) {
+      g = gate_table_get_or2(s->htbl, a, b);
+      assert(g->lit[2] == null_literal);
       aux = bit_blaster_fresh_literal(s);
       g->lit[2] = aux;
       bit_blaster_or2_gate(s, a, b, aux);
+      record_or2_def(s, aux, a, b);
     }
   }
 
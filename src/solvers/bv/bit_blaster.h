@@ -90,12 +90,15 @@ typedef struct cbuffer_s {
  *   where the clauses and literals are created
  * - remap_table to interface with the bvsolver
  * - gate table for hash consing
+ * - or_def: definition of the binary or gates created by the blaster
+ *   (used for two-level rewriting, see bit_blaster.c)
  * - buffers
  */
 typedef struct bit_blaster_s {
   smt_core_t *solver;
   remap_table_t *remap;
   gate_table_t *htbl;
+  ivector_t or_def;
   cbuffer_t buffer;
   ivector_t aux_vector;
   ivector_t aux_vector2;
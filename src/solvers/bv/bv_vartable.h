@@ -34,7 +34,9 @@
  * refcount_int_array functions.
  *
  * We use two bits in kind[x] to mark variables and to record which variables
- * have been bit-blasted:
+ * have been bit-blasted. A third bit records whether x was bit-blasted
+ * lazily (i.e., x is a multiplication or division whose definition
+ * has not been converted to clauses yet).
  */
 
 #ifndef __BV_VARTABLE_H
@@ -152,12 +154,14 @@ typedef struct bv_vartable_s {
  * Bit masks for the kind:
  * - bit 7: mark
  * - bit 6: bit-blasted bit
- * - bit 5 to 0: the tag
+ * - bit 5: lazy bit
+ * - bit 4 to 0: the tag
  */
 
 #define BVVAR_MARK_MASK ((uint8_t) 0x80)
 #define BVVAR_BLST_MASK ((uint8_t) 0x40)
-#define BVVAR_TAG_MASK  ((uint8_t) 0x3F)
+#define BVVAR_LAZY_MASK ((uint8_t) 0x20)
+#define BVVAR_TAG_MASK  ((uint8_t) 0x1F)
 
 
 
@@ -315,7 +319,8 @@ extern thvar_t find_bvneg(bv_vartable_t *table, thvar_t x);
  * - kind[x] stores
  *   bit 7: mark bit
  *   bit 6: bitblasted bit
- *   bit 5--0: tag
+ *   bit 5: lazy bit
+ *   bit 4--0: tag
  */
 static inline bvvar_tag_t tag_of_kind(uint8_t k) {
   return (bvvar_tag_t) (k & BVVAR_TAG_MASK);
@@ -329,6 +334,10 @@ static inline bool blasted_of_kind(uint8_t k) {
   return (k & BVVAR_BLST_MASK) != 0;
 }
 
+static inline bool lazy_of_kind(uint8_t k) {
+  return (k & BVVAR_LAZY_MASK) != 0;
+}
+
 
 
 /*
@@ -353,6 +362,11 @@ static inline bool bvvar_is_bitblasted(bv_vartable_t *table, thvar_t x) {
   return blasted_of_kind(table->kind[x]);
 }
 
+static inline bool bvvar_is_lazy(bv_vartable_t *table, thvar_t x) {
+  assert(valid_bvvar(table, x));
+  return lazy_of_kind(table->kind[x]);
+}
+
 static inline uint32_t bvvar_bitsize(bv_vartable_t *table, thvar_t x) {
   assert(valid_bvvar(table, x));
   return table->bit_size[x];
@@ -508,5 +522,19 @@ static inline void bvvar_clr_bitblasted(bv_vartable_t *table, thvar_t x) {
 }
 
 
+/*
+ * Set/clear the lazy bit on x
+ */
+static inline void bvvar_set_lazy(bv_vartable_t *table, thvar_t x) {
+  assert(valid_bvvar(table, x));
+  table->kind[x] |= BVVAR_LAZY_MASK;
+}
+
+static inline void bvvar_clr_lazy(bv_vartable_t *table, thvar_t x) {
+  assert(valid_bvvar(table, x));
+  table->kind[x] &= (uint8_t) (~BVVAR_LAZY_MASK);
+}
+
+
 
 #endif /* __BV_VARTABLE_H */
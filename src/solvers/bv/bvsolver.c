@@ -31,6 +31,7 @@
 #include "utils/int_powers.h"
 #include "utils/memalloc.h"
 #include "utils/refcount_int_arrays.h"
+#include "yices_limits.h"
 
 
 #define TRACE 0
@@ -464,7 +465,8 @@ static void init_bv_trail(bv_trail_stack_t *stack) {
  * - bb = bitblast pointer
  */
 static void bv_trail_save(bv_trail_stack_t *stack, uint32_t nv, uint32_t na, uint32_t nb,
-                          uint32_t ns, uint32_t ndm, uint32_t ndb, uint32_t bb) {
+                          uint32_t ns, uint32_t ndm, uint32_t ndb, uint32_t bb,
+                          uint32_t nl, uint32_t nr) {
   uint32_t i, n;
 
   i = stack->top;
@@ -491,6 +493,8 @@ static void bv_trail_save(bv_trail_stack_t *stack, uint32_t nv, uint32_t na, uin
   stack->data[i].ndelayed_mapped = ndm;
   stack->data[i].ndelayed_blasted = ndb;
   stack->data[i].nbblasted = bb;
+  stack->data[i].nlazy = nl;
+  stack->data[i].nrefined = nr;
 
   stack->top = i+1;
 }
@@ -548,6 +552,8 @@ static void init_bv_stats(bv_stats_t *s) {
   s->equiv_conflicts = 0;
   s->half_equiv_lemmas = 0;
   s->interface_lemmas = 0;
+  s->lazy_ops = 0;
+  s->lazy_refinements = 0;
 }
 
 static inline void reset_bv_stats(bv_stats_t *s) {
@@ -1652,6 +1658,176 @@ static void collect_bvvar_literals(bv_solver_t *solver, thvar_t x, ivector_t *v)
 
 
 
+/*
+ * LAZY BIT-BLASTING
+ */
+
+/*
+ * Cheap axioms for x = (op a b) when x is bit-blasted lazily
+ * - a and b are the literals of the operands
+ * - c is the array of literals of x
+ * - n = number of bits
+ *
+ * For multiplication:
+ *   c[0] = a[0] and b[0]
+ *   (a == 0) or (b == 0) implies (c == 0)
+ * For unsigned division and remainder (with the SMT-LIB rules for
+ * a zero divider):
+ *   (b == 0) implies (udiv a b) = 0b111...1 and (urem a b) = a
+ *   (b != 0) implies (udiv a b) <= a and (urem a b) < b
+ *   (urem a b) <= a
+ * For signed remainder:
+ *   (b == 0) implies (srem a b) = a
+ */
+static void bv_solver_lazy_axioms(bv_solver_t *solver, bvvar_tag_t op, literal_t *a, literal_t *b,
+                                  literal_t *c, uint32_t n) {
+  bit_blaster_t *blaster;
+  smt_core_t *core;
+  uint32_t i;
+  literal_t la, lb, l;
+
+  blaster = solver->blaster;
+  core = solver->core;
+
+  switch (op) {
+  case BVTAG_MUL:
+    bit_blaster_eq(blaster, c[0], bit_blaster_make_and2(blaster, a[0], b[0]));
+    la = bit_blaster_make_or(blaster, n, a); // la := (a != 0)
+    lb = bit_blaster_make_or(blaster, n, b); // lb := (b != 0)
+    for (i=1; i<n; i++) {
+      add_binary_clause(core, la, not(c[i]));
+      add_binary_clause(core, lb, not(c[i]));
+    }
+    break;
+
+  case BVTAG_UDIV:
+    lb = bit_blaster_make_or(blaster, n, b);
+    for (i=0; i<n; i++) {
+      add_binary_clause(core, lb, c[i]);
+    }
+    l = bit_blaster_make_bvuge(blaster, a, c, n); // l := (a >= c)
+    add_binary_clause(core, not(lb), l);
+    break;
+
+  case BVTAG_UREM:
+    lb = bit_blaster_make_or(blaster, n, b);
+    for (i=0; i<n; i++) {
+      add_ternary_clause(core, lb, not(a[i]), c[i]);
+      add_ternary_clause(core, lb, a[i], not(c[i]));
+    }
+    bit_blaster_assert_bvuge(blaster, a, c, n);
+    l = bit_blaster_make_bvuge(blaster, c, b, n); // l := (c >= b)
+    add_binary_clause(core, not(lb), not(l));
+    break;
+
+  case BVTAG_SREM:
+    lb = bit_blaster_make_or(blaster, n, b);
+    for (i=0; i<n; i++) {
+      add_ternary_clause(core, lb, not(a[i]), c[i]);
+      add_ternary_clause(core, lb, a[i], not(c[i]));
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+
+/*
+ * Bit-blast x = (op a b) lazily: x is treated as a fresh variable
+ * - u = pseudo literal array for x
+ * - a and b = literals for the operands
+ * - n = number of bits
+ * x is marked as lazy and added to the lazy queue. Its definition
+ * is bit-blasted in final check if needed.
+ */
+static void bv_solver_lazy_blast_op(bv_solver_t *solver, thvar_t x, bvvar_tag_t op,
+                                    literal_t *a, literal_t *b, literal_t *u, uint32_t n) {
+  remap_table_t *rmap;
+  ivector_t *c;
+  uint32_t i;
+  literal_t l;
+
+  rmap = solver->remap;
+  c = &solver->c_vector;
+  ivector_reset(c);
+  for (i=0; i<n; i++) {
+    l = remap_table_find(rmap, u[i]);
+    if (l == null_literal) {
+      l = bit_blaster_fresh_literal(solver->blaster);
+      remap_table_assign(rmap, u[i], l);
+    }
+    ivector_push(c, l);
+  }
+
+  bv_solver_lazy_axioms(solver, op, a, b, c->data, n);
+
+  bvvar_set_lazy(&solver->vtbl, x);
+  bv_queue_push(&solver->lazy_queue, x);
+  solver->stats.lazy_ops ++;
+}
+
+
+/*
+ * Bit-blast the definition of a lazy variable x
+ * - this is called in final check, if the values of x and of its
+ *   operands don't match the definition
+ * - the clauses are added to the core as lemmas
+ */
+static void bv_solver_refine_lazy_var(bv_solver_t *solver, thvar_t x) {
+  bv_vartable_t *vtbl;
+  ivector_t *a, *b;
+  literal_t *u;
+  uint32_t n;
+  bvvar_tag_t op;
+
+  vtbl = &solver->vtbl;
+
+  assert(bvvar_is_bitblasted(vtbl, x) && bvvar_is_lazy(vtbl, x));
+
+  op = bvvar_tag(vtbl, x);
+  n = bvvar_bitsize(vtbl, x);
+  u = bvvar_get_map(vtbl, x);
+  a = &solver->a_vector;
+  b = &solver->b_vector;
+  collect_bvvar_literals(solver, vtbl->def[x].op[0], a);
+  collect_bvvar_literals(solver, vtbl->def[x].op[1], b);
+  assert(a->size == n && b->size == n && u != NULL);
+
+  switch (op) {
+  case BVTAG_MUL:
+    bit_blaster_make_bvmul(solver->blaster, a->data, b->data, u, n);
+    break;
+
+  case BVTAG_UDIV:
+    bit_blaster_make_udivision(solver->blaster, a->data, b->data, u, NULL, n);
+    break;
+
+  case BVTAG_UREM:
+    bit_blaster_make_udivision(solver->blaster, a->data, b->data, NULL, u, n);
+    break;
+
+  case BVTAG_SDIV:
+    bit_blaster_make_sdivision(solver->blaster, a->data, b->data, u, NULL, n);
+    break;
+
+  case BVTAG_SREM:
+    bit_blaster_make_sdivision(solver->blaster, a->data, b->data, NULL, u, n);
+    break;
+
+  default:
+    assert(false);
+    abort();
+  }
+
+  bvvar_clr_lazy(vtbl, x);
+  bv_queue_push(&solver->refined_queue, x);
+  solver->stats.lazy_refinements ++;
+}
+
+
+
 /*
  * Recursive bit-blasting:
  * - if x is bitblasted already: do nothing
@@ -1767,7 +1943,28 @@ static void bv_solver_bitblast_variable(bv_solver_t *solver, thvar_t x) {
         collect_bvvar_literals(solver, y, a);
         collect_bvvar_literals(solver, z, b);
         assert(a->size == n && b->size == n);
-        bit_blaster_make_bvdivop(solver, op, y, z, a->data, b->data, u, n);
+        if (solver->lazy_blasting && n >= BV_LAZY_MIN_BITS) {
+          bv_solver_lazy_blast_op(solver, x, op, a->data, b->data, u, n);
+        } else {
+          bit_blaster_make_bvdivop(solver, op, y, z, a->data, b->data, u, n);
+        }
+        break;
+
+      case BVTAG_MUL:
+        y = vtbl->def[x].op[0];
+        z = vtbl->def[x].op[1];
+        bv_solver_bitblast_variable(solver, y);
+        bv_solver_bitblast_variable(solver, z);
+        a = &solver->a_vector;
+        b = &solver->b_vector;
+        collect_bvvar_literals(solver, y, a);
+        collect_bvvar_literals(solver, z, b);
+        assert(a->size == n && b->size == n);
+        if (solver->lazy_blasting && n >= BV_LAZY_MIN_BITS) {
+          bv_solver_lazy_blast_op(solver, x, op, a->data, b->data, u, n);
+        } else {
+          bit_blaster_make_bvmul(solver->blaster, a->data, b->data, u, n);
+        }
         break;
 
       case BVTAG_SMOD:
@@ -1776,7 +1973,6 @@ static void bv_solver_bitblast_variable(bv_solver_t *solver, thvar_t x) {
       case BVTAG_ASHR:
       case BVTAG_ADD:
       case BVTAG_SUB:
-      case BVTAG_MUL:
         y = vtbl->def[x].op[0];
         z = vtbl->def[x].op[1];
         bv_solver_bitblast_variable(solver, y);
@@ -7159,10 +7355,18 @@ bool bv_solver_propagate(bv_solver_t *solver) {
   return true;
 }
 
+// defined below: check and refine the lazy operations
+static uint32_t bv_solver_refine_lazy_ops(bv_solver_t *solver);
+
 /*
- * Final check: nothing to do
+ * Final check: if some operations were bit-blasted lazily, check
+ * whether the current assignment satisfies their definition.
+ * Bit-blast the definitions that are not satisfied.
  */
 fcheck_code_t bv_solver_final_check(bv_solver_t *solver) {
+  if (solver->lazy_queue.top > 0 && bv_solver_refine_lazy_ops(solver) > 0) {
+    return FCHECK_CONTINUE;
+  }
   return FCHECK_SAT;
 }
 
@@ -7237,6 +7441,7 @@ void init_bv_solver(bv_solver_t *solver, smt_core_t *core, egraph_t *egraph) {
   solver->decision_level = 0;
   solver->bitblasted = false;
   solver->bbptr = 0;
+  solver->lazy_blasting = false;
 
   init_bv_vartable(&solver->vtbl);
   init_bv_atomtable(&solver->atbl);
@@ -7256,6 +7461,8 @@ void init_bv_solver(bv_solver_t *solver, smt_core_t *core, egraph_t *egraph) {
   init_bv_queue(&solver->select_queue);
   init_bv_queue(&solver->delayed_mapped);
   init_bv_queue(&solver->delayed_blasted);
+  init_bv_queue(&solver->lazy_queue);
+  init_bv_queue(&solver->refined_queue);
   init_bv_trail(&solver->trail_stack);
 
   init_bvpoly_buffer(&solver->buffer);
@@ -7269,6 +7476,7 @@ void init_bv_solver(bv_solver_t *solver, smt_core_t *core, egraph_t *egraph) {
   init_bv_interval_stack(&solver->intv_stack);
   init_ivector(&solver->a_vector, 0);
   init_ivector(&solver->b_vector, 0);
+  init_ivector(&solver->c_vector, 0);
 
   solver->val_map = NULL;
 
@@ -7328,6 +7536,8 @@ void delete_bv_solver(bv_solver_t *solver) {
   delete_bv_queue(&solver->select_queue);
   delete_bv_queue(&solver->delayed_mapped);
   delete_bv_queue(&solver->delayed_blasted);
+  delete_bv_queue(&solver->lazy_queue);
+  delete_bv_queue(&solver->refined_queue);
   delete_bv_trail(&solver->trail_stack);
 
   delete_bvpoly_buffer(&solver->buffer);
@@ -7339,6 +7549,7 @@ void delete_bv_solver(bv_solver_t *solver) {
   delete_bv_interval_stack(&solver->intv_stack);
   delete_ivector(&solver->a_vector);
   delete_ivector(&solver->b_vector);
+  delete_ivector(&solver->c_vector);
 
   if (solver->val_map != NULL) {
     delete_bvconst_hmap(solver->val_map);
@@ -7357,7 +7568,7 @@ void delete_bv_solver(bv_solver_t *solver) {
  * Start a new base level
  */
 void bv_solver_push(bv_solver_t *solver) {
-  uint32_t na, nv, nb, ns, ndm, ndb, bb;
+  uint32_t na, nv, nb, ns, ndm, ndb, bb, nl, nr;
 
   assert(solver->decision_level == solver->base_level &&
          all_bvvars_unmarked(solver));
@@ -7369,8 +7580,10 @@ void bv_solver_push(bv_solver_t *solver) {
   ndm = solver->delayed_mapped.top;
   ndb = solver->delayed_blasted.top;
   bb = solver->bbptr;
+  nl = solver->lazy_queue.top;
+  nr = solver->refined_queue.top;
 
-  bv_trail_save(&solver->trail_stack, nv, na, nb, ns, ndm, ndb, bb);
+  bv_trail_save(&solver->trail_stack, nv, na, nb, ns, ndm, ndb, bb, nl, nr);
 
   mtbl_push(&solver->mtbl);
 
@@ -7451,6 +7664,36 @@ static void bv_solver_clean_delayed_blasted_vars(bv_solver_t *solver, uint32_t n
     x = dqueue->data[i];
     assert(bvvar_is_bitblasted(vtbl, x));
     bvvar_clr_bitblasted(vtbl, x);
+    bvvar_clr_lazy(vtbl, x);
+  }
+}
+
+
+/*
+ * Restore the lazy bit of variables refined since the corresponding push
+ * - n = number of variables in the refined queue at the push
+ * - nvars = number of variables at the push
+ *
+ * This is called after bv_solver_clean_delayed_blasted_vars. The clauses
+ * that encode the definition of these variables are removed by the core
+ * on pop, so they must be refined again if needed.
+ */
+static void bv_solver_restore_lazy_vars(bv_solver_t *solver, uint32_t n, uint32_t nvars) {
+  bv_vartable_t *vtbl;
+  bv_queue_t *rqueue;
+  uint32_t i, top;
+  thvar_t x;
+
+  vtbl = &solver->vtbl;
+  rqueue = &solver->refined_queue;
+  top = rqueue->top;
+  assert(n <= top);
+
+  for (i=n; i<top; i++) {
+    x = rqueue->data[i];
+    if (x < nvars && bvvar_is_bitblasted(vtbl, x)) {
+      bvvar_set_lazy(vtbl, x);
+    }
   }
 }
 
@@ -7518,6 +7761,9 @@ void bv_solver_pop(bv_solver_t *solver) {
   solver->delayed_mapped.top = top->ndelayed_mapped;
   bv_solver_clean_delayed_blasted_vars(solver, top->ndelayed_blasted);
   solver->delayed_blasted.top = top->ndelayed_blasted;
+  bv_solver_restore_lazy_vars(solver, top->nrefined, top->nvars);
+  solver->refined_queue.top = top->nrefined;
+  solver->lazy_queue.top = top->nlazy;
 
   /*
    * remove vars in the select queue
@@ -7595,6 +7841,8 @@ void bv_solver_reset(bv_solver_t *solver) {
   reset_bv_queue(&solver->select_queue);
   reset_bv_queue(&solver->delayed_mapped);
   reset_bv_queue(&solver->delayed_blasted);
+  reset_bv_queue(&solver->lazy_queue);
+  reset_bv_queue(&solver->refined_queue);
   reset_bv_trail(&solver->trail_stack);
 
   reset_bvpoly_buffer(&solver->buffer, 32);
@@ -7603,6 +7851,7 @@ void bv_solver_reset(bv_solver_t *solver) {
   reset_bv_interval_stack(&solver->intv_stack);
   ivector_reset(&solver->a_vector);
   ivector_reset(&solver->b_vector);
+  ivector_reset(&solver->c_vector);
 
   if (solver->val_map != NULL) {
     delete_bvconst_hmap(solver->val_map);
@@ -8708,6 +8957,47 @@ static bool bv_solver_get_variable_value(bv_solver_t *solver, thvar_t x, uint32_
 
 
 
+/*
+ * Check the variables bit-blasted lazily in the current assignment
+ * - for every x in the lazy queue that's not refined yet, compare the value
+ *   of x with the value of (op y z) computed from the values of y and z
+ * - if they differ, bit-blast the definition of x
+ * - return the number of variables refined
+ */
+static uint32_t bv_solver_refine_lazy_ops(bv_solver_t *solver) {
+  bv_vartable_t *vtbl;
+  bv_queue_t *lqueue;
+  bvconstant_t *val, *expected;
+  uint32_t i, n, k, refined;
+  thvar_t x;
+
+  vtbl = &solver->vtbl;
+  lqueue = &solver->lazy_queue;
+  val = &solver->aux1;
+  expected = &solver->aux2;
+  refined = 0;
+
+  for (i=0; i<lqueue->top; i++) {
+    x = lqueue->data[i];
+    if (bvvar_is_lazy(vtbl, x)) {
+      n = bvvar_bitsize(vtbl, x);
+      k = (n + 31) >> 5;
+      bvconstant_set_bitsize(val, n);
+      bvconstant_set_bitsize(expected, n);
+      if (!get_bitblasted_var_value(solver, x, val->data) ||
+          !bv_solver_binop_value(solver, bvvar_tag(vtbl, x), vtbl->def[x].op, n, expected->data) ||
+          !bvconst_eq(val->data, expected->data, k)) {
+        bv_solver_refine_lazy_var(solver, x);
+        refined ++;
+      }
+    }
+  }
+
+  return refined;
+}
+
+
+
 /*
  * Copy the value assigned to x in the model into buffer c
  * - return true if the value is available
@@ -8879,6 +9169,501 @@ bv_egraph_interface_t *bv_solver_bv_egraph_interface(bv_solver_t *solver) {
 
 
 
+/***************
+ *  SNAPSHOTS  *
+ **************/
+
+/*
+ * A snapshot stores the solver state after internalization and
+ * before bit-blasting. Layout (all 32bit words):
+ * - remap table: n = number of pseudo variables (0 if there's no remap
+ *   table) then map[x] for x=1 ... n-1
+ * - variables: n = number of variables, then for x=1 ... n-1:
+ *   tag, bitsize, definition, then 0 if x has no pseudo map or 1
+ *   followed by bitsize pseudo literals
+ * - atoms: n, then tag, literal, left and right variables for each atom
+ * - merge table: n, then n pairs (x, parent of x)
+ * - bounds: n, then n pairs (variable, atom index) in queue order
+ * - select queue: n, then n variables
+ * The table of expanded forms is a cache and is not saved.
+ */
+
+static void snapshot_push64(ivector_t *v, uint64_t c) {
+  ivector_push(v, (int32_t) (uint32_t) c);
+  ivector_push(v, (int32_t) (uint32_t) (c >> 32));
+}
+
+/*
+ * Definition of x
+ */
+static void bv_solver_snapshot_def(bv_vartable_t *vtbl, thvar_t x, ivector_t *v) {
+  bvpoly64_t *p64;
+  bvpoly_t *p;
+  pprod_t *pp;
+  bv_ite_t *ite;
+  thvar_t *op;
+  uint32_t i, n;
+
+  n = bvvar_bitsize(vtbl, x);
+  switch (bvvar_tag(vtbl, x)) {
+  case BVTAG_VAR:
+    break;
+
+  case BVTAG_CONST64:
+    snapshot_push64(v, bvvar_val64(vtbl, x));
+    break;
+
+  case BVTAG_CONST:
+    ivector_add(v, (int32_t *) bvvar_val(vtbl, x), (n + 31) >> 5);
+    break;
+
+  case BVTAG_POLY64:
+    p64 = bvvar_poly64_def(vtbl, x);
+    ivector_push(v, p64->nterms);
+    for (i=0; i<p64->nterms; i++) {
+      ivector_push(v, p64->mono[i].var);
+      snapshot_push64(v, p64->mono[i].coeff);
+    }
+    break;
+
+  case BVTAG_POLY:
+    p = bvvar_poly_def(vtbl, x);
+    ivector_push(v, p->nterms);
+    for (i=0; i<p->nterms; i++) {
+      ivector_push(v, p->mono[i].var);
+      ivector_add(v, (int32_t *) p->mono[i].coeff, p->width);
+    }
+    break;
+
+  case BVTAG_PPROD:
+    pp = bvvar_pprod_def(vtbl, x);
+    ivector_push(v, pp->len);
+    for (i=0; i<pp->len; i++) {
+      ivector_push(v, pp->prod[i].var);
+      ivector_push(v, pp->prod[i].exp);
+    }
+    break;
+
+  case BVTAG_BIT_ARRAY:
+    ivector_add(v, bvvar_bvarray_def(vtbl, x), n);
+    break;
+
+  case BVTAG_ITE:
+    ite = bvvar_ite_def(vtbl, x);
+    ivector_push(v, ite->cond);
+    ivector_push(v, ite->left);
+    ivector_push(v, ite->right);
+    break;
+
+  default:
+    op = bvvar_binop(vtbl, x);
+    ivector_push(v, op[0]);
+    ivector_push(v, op[1]);
+    break;
+  }
+}
+
+
+/*
+ * Store the solver state in v
+ * - return false if the state can't be saved: this happens if the
+ *   solver has started bit-blasting, if it's not at base level 0,
+ *   or if some variables are attached to egraph terms.
+ */
+bool bv_solver_snapshot(bv_solver_t *solver, ivector_t *v) {
+  bv_vartable_t *vtbl;
+  bv_atomtable_t *atbl;
+  bv_bound_queue_t *bqueue;
+  remap_table_t *rmap;
+  literal_t *map;
+  int32_t *owner;
+  uint32_t i, j, n;
+  int32_t k;
+
+  vtbl = &solver->vtbl;
+  rmap = solver->remap;
+  if (solver->base_level > 0 || solver->compiler != NULL || solver->blaster != NULL ||
+      vtbl->eterm != NULL) {
+    return false;
+  }
+
+  // remap table
+  if (rmap == NULL) {
+    ivector_push(v, 0);
+  } else {
+    n = rmap->nvars;
+    ivector_push(v, n);
+    for (i=1; i<n; i++) {
+      if (tst_bit(rmap->merge_bit, i)) return false;
+      ivector_push(v, rmap->map[i]);
+    }
+  }
+
+  // variables
+  n = vtbl->nvars;
+  ivector_push(v, n);
+  for (i=1; i<n; i++) {
+    if (bvvar_tag(vtbl, i) >= BVTAG_ADD || bvvar_is_bitblasted(vtbl, i)) return false;
+    ivector_push(v, bvvar_tag(vtbl, i));
+    ivector_push(v, bvvar_bitsize(vtbl, i));
+    bv_solver_snapshot_def(vtbl, i, v);
+    map = bvvar_get_map(vtbl, i);
+    if (map == NULL) {
+      ivector_push(v, 0);
+    } else {
+      ivector_push(v, 1);
+      ivector_add(v, map, bvvar_bitsize(vtbl, i));
+    }
+  }
+
+  // atoms
+  atbl = &solver->atbl;
+  n = atbl->natoms;
+  ivector_push(v, n);
+  for (i=0; i<n; i++) {
+    ivector_push(v, bvatm_tag(atbl->data + i));
+    ivector_push(v, atbl->data[i].lit);
+    ivector_push(v, atbl->data[i].left);
+    ivector_push(v, atbl->data[i].right);
+  }
+
+  // merge table
+  j = v->size;
+  ivector_push(v, 0);
+  n = solver->mtbl.top;
+  for (i=0; i<n; i++) {
+    if (solver->mtbl.map[i] >= 0) {
+      ivector_push(v, i);
+      ivector_push(v, solver->mtbl.map[i]);
+      v->data[j] ++;
+    }
+  }
+
+  // bounds: recover the variable of each queue element from the lists
+  bqueue = &solver->bqueue;
+  n = bqueue->top;
+  ivector_push(v, n);
+  if (n > 0) {
+    owner = (int32_t *) safe_malloc(n * sizeof(int32_t));
+    for (i=0; i<bqueue->bsize; i++) {
+      for (k = bqueue->bound[i]; k >= 0; k = bqueue->data[k].pre) {
+        owner[k] = i;
+      }
+    }
+    for (i=0; i<n; i++) {
+      ivector_push(v, owner[i]);
+      ivector_push(v, bqueue->data[i].atom_id);
+    }
+    safe_free(owner);
+  }
+
+  // select queue
+  n = solver->select_queue.top;
+  ivector_push(v, n);
+  ivector_add(v, solver->select_queue.data, n);
+
+  return true;
+}
+
+
+/*
+ * Reader for bv_solver_restore_snapshot
+ */
+typedef struct bv_snapshot_reader_s {
+  const int32_t *data;
+  uint32_t pos;
+  uint32_t size;
+} bv_snapshot_reader_t;
+
+static inline bool snapshot_available(bv_snapshot_reader_t *r, uint32_t n) {
+  return n <= r->size - r->pos;
+}
+
+static bool snapshot_read(bv_snapshot_reader_t *r, int32_t *x) {
+  if (r->pos == r->size) return false;
+  *x = r->data[r->pos];
+  r->pos ++;
+  return true;
+}
+
+// read a count n, where each element uses k words
+static bool snapshot_read_count(bv_snapshot_reader_t *r, uint32_t k, uint32_t *n) {
+  int32_t x;
+
+  if (! snapshot_read(r, &x) || x < 0 || ! snapshot_available(r, ((uint64_t) x) * k)) return false;
+  *n = x;
+  return true;
+}
+
+static uint64_t snapshot_read64(bv_snapshot_reader_t *r) {
+  uint64_t c;
+
+  assert(snapshot_available(r, 2));
+  c = ((uint64_t) (uint32_t) r->data[r->pos + 1]) << 32;
+  c |= (uint32_t) r->data[r->pos];
+  r->pos += 2;
+  return c;
+}
+
+/*
+ * Checks on literals and variables
+ */
+static inline bool snapshot_good_literal(bv_solver_t *solver, literal_t l) {
+  return l >= 0 && var_of(l) < num_vars(solver->core);
+}
+
+static bool snapshot_good_literals(bv_solver_t *solver, const literal_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (! snapshot_good_literal(solver, a[i])) return false;
+  }
+  return true;
+}
+
+// x must be an existing variable of n bits
+static inline bool snapshot_good_var(bv_solver_t *solver, thvar_t x, uint32_t n) {
+  return 0 < x && x < solver->vtbl.nvars && bvvar_bitsize(&solver->vtbl, x) == n;
+}
+
+
+/*
+ * Read the definition of a variable of the given tag and size
+ * and create it. Return null_thvar if the definition is invalid.
+ */
+static thvar_t bv_solver_restore_var(bv_solver_t *solver, bv_snapshot_reader_t *r, bvvar_tag_t tag, uint32_t n) {
+  bv_vartable_t *vtbl;
+  bvpoly_buffer_t *b;
+  pp_buffer_t *pp;
+  const int32_t *a;
+  uint64_t degree;
+  uint32_t i, k, w;
+  int32_t x, prev;
+
+  vtbl = &solver->vtbl;
+  w = (n + 31) >> 5;
+
+  switch (tag) {
+  case BVTAG_VAR:
+    return make_bvvar(vtbl, n);
+
+  case BVTAG_CONST64:
+    if (n > 64 || ! snapshot_available(r, 2)) break;
+    return get_bvconst64(vtbl, n, norm64(snapshot_read64(r), n));
+
+  case BVTAG_CONST:
+    if (n <= 64 || ! snapshot_available(r, w)) break;
+    a = r->data + r->pos;
+    r->pos += w;
+    return get_bvconst(vtbl, n, (uint32_t *) a);
+
+  case BVTAG_POLY64:
+  case BVTAG_POLY:
+    if ((tag == BVTAG_POLY64) != (n <= 64)) break;
+    k = (tag == BVTAG_POLY64) ? 3 : w + 1;
+    if (! snapshot_read_count(r, k, &k) || k == 0) break;
+    b = &solver->buffer;
+    reset_bvpoly_buffer(b, n);
+    prev = -1;
+    for (i=0; i<k; i++) {
+      if (! snapshot_read(r, &x) || x <= prev || (x != const_idx && ! snapshot_good_var(solver, x, n))) return null_thvar;
+      prev = x;
+      if (tag == BVTAG_POLY64) {
+        bvpoly_buffer_add_mono64(b, x, snapshot_read64(r));
+      } else {
+        bvpoly_buffer_add_monomial(b, x, (uint32_t *) (r->data + r->pos));
+        r->pos += w;
+      }
+    }
+    normalize_bvpoly_buffer(b);
+    if (b->nterms != k) break;
+    return (tag == BVTAG_POLY64) ? get_bvpoly64(vtbl, b) : get_bvpoly(vtbl, b);
+
+  case BVTAG_PPROD:
+    if (! snapshot_read_count(r, 2, &k) || k == 0) break;
+    pp = &solver->prod_buffer;
+    pp_buffer_reset(pp);
+    prev = -1;
+    degree = 0;
+    for (i=0; i<k; i++) {
+      x = r->data[r->pos];
+      degree += (uint32_t) r->data[r->pos + 1];
+      if (x <= prev || ! snapshot_good_var(solver, x, n) || r->data[r->pos + 1] <= 0 ||
+          degree > YICES_MAX_DEGREE) {
+        return null_thvar;
+      }
+      prev = x;
+      pp_buffer_mul_varexp(pp, x, r->data[r->pos + 1]);
+      r->pos += 2;
+    }
+    if (degree < 2) break;
+    pp_buffer_normalize(pp);
+    return get_bvpprod(vtbl, n, pp);
+
+  case BVTAG_BIT_ARRAY:
+    if (! snapshot_available(r, n)) break;
+    a = r->data + r->pos;
+    r->pos += n;
+    if (! snapshot_good_literals(solver, a, n)) break;
+    return get_bvarray(vtbl, n, (literal_t *) a);
+
+  case BVTAG_ITE:
+    if (! snapshot_available(r, 3)) break;
+    a = r->data + r->pos;
+    r->pos += 3;
+    if (! snapshot_good_literal(solver, a[0]) || ! snapshot_good_var(solver, a[1], n) ||
+        ! snapshot_good_var(solver, a[2], n)) {
+      break;
+    }
+    return get_bvite(vtbl, n, a[0], a[1], a[2]);
+
+  case BVTAG_UDIV:
+  case BVTAG_UREM:
+  case BVTAG_SDIV:
+  case BVTAG_SREM:
+  case BVTAG_SMOD:
+  case BVTAG_SHL:
+  case BVTAG_LSHR:
+  case BVTAG_ASHR:
+    if (! snapshot_available(r, 2)) break;
+    a = r->data + r->pos;
+    r->pos += 2;
+    if (! snapshot_good_var(solver, a[0], n) || ! snapshot_good_var(solver, a[1], n)) break;
+    switch (tag) {
+    case BVTAG_UDIV: return get_bvdiv(vtbl, n, a[0], a[1]);
+    case BVTAG_UREM: return get_bvrem(vtbl, n, a[0], a[1]);
+    case BVTAG_SDIV: return get_bvsdiv(vtbl, n, a[0], a[1]);
+    case BVTAG_SREM: return get_bvsrem(vtbl, n, a[0], a[1]);
+    case BVTAG_SMOD: return get_bvsmod(vtbl, n, a[0], a[1]);
+    case BVTAG_SHL:  return get_bvshl(vtbl, n, a[0], a[1]);
+    case BVTAG_LSHR: return get_bvlshr(vtbl, n, a[0], a[1]);
+    default:         return get_bvashr(vtbl, n, a[0], a[1]);
+    }
+
+  default:
+    break;
+  }
+
+  return null_thvar;
+}
+
+
+/*
+ * Restore a snapshot stored in a[0 ... n-1] by bv_solver_snapshot
+ * - the solver must be empty and the core must be restored first
+ * - return false if a is not a valid snapshot for this solver
+ *   (the solver may be partially restored in this case)
+ */
+bool bv_solver_restore_snapshot(bv_solver_t *solver, const int32_t *a, uint32_t n) {
+  bv_snapshot_reader_t reader;
+  bv_vartable_t *vtbl;
+  bv_atomtable_t *atbl;
+  remap_table_t *rmap;
+  literal_t *map;
+  uint32_t i, k, nbits, nrmap;
+  int32_t tag, x, y, flag;
+  thvar_t v;
+
+  assert(solver->base_level == 0 && solver->vtbl.nvars == 1 && solver->atbl.natoms == 0);
+
+  reader.data = a;
+  reader.pos = 0;
+  reader.size = n;
+
+  vtbl = &solver->vtbl;
+  atbl = &solver->atbl;
+
+  // remap table
+  if (! snapshot_read_count(&reader, 1, &nrmap) || nrmap == 1 || nrmap > MAX_REMAP_TABLE_SIZE) return false;
+  rmap = NULL;
+  if (nrmap > 0) {
+    rmap = bv_solver_get_remap(solver);
+    if (rmap->nvars != 1) return false;
+    for (i=1; i<nrmap; i++) {
+      (void) remap_table_fresh_lit(rmap);
+      x = a[reader.pos ++];
+      if (x != null_literal && ! snapshot_good_literal(solver, x)) return false;
+      remap_table_restore_var(rmap, i, x);
+    }
+  }
+
+  // variables
+  if (! snapshot_read_count(&reader, 0, &k) || k == 0 || k > MAX_BVVARTABLE_SIZE) return false;
+  for (i=1; i<k; i++) {
+    if (! snapshot_read(&reader, &tag) || ! snapshot_read(&reader, &x) ||
+        tag < 0 || tag >= BVTAG_ADD || x <= 0 || x > YICES_MAX_BVSIZE) {
+      return false;
+    }
+    nbits = x;
+    v = bv_solver_restore_var(solver, &reader, tag, nbits);
+    if (v != i || ! snapshot_read(&reader, &flag)) return false;
+    if (flag != 0) {
+      if (rmap == NULL || ! snapshot_available(&reader, nbits)) return false;
+      map = alloc_int_array(nbits);
+      bvvar_set_map(vtbl, v, map);
+      for (x=0; x<nbits; x++) {
+        y = a[reader.pos ++];
+        if (y < 0 || var_of(y) >= rmap->nvars) return false;
+        map[x] = y;
+      }
+    }
+  }
+
+  // atoms
+  if (! snapshot_read_count(&reader, 4, &k)) return false;
+  for (i=0; i<k; i++) {
+    tag = a[reader.pos];
+    x = a[reader.pos + 2];
+    y = a[reader.pos + 3];
+    if (tag < BVEQ_ATM || tag > BVSGE_ATM || x <= 0 || x >= vtbl->nvars ||
+        ! snapshot_good_var(solver, y, bvvar_bitsize(vtbl, x)) ||
+        get_bv_atom(atbl, tag, x, y) != i) {
+      return false;
+    }
+    flag = a[reader.pos + 1];
+    if (! snapshot_good_literal(solver, flag) || ! is_pos(flag) || bvar_has_atom(solver->core, var_of(flag))) {
+      return false;
+    }
+    atbl->data[i].lit = flag;
+    attach_atom_to_bvar(solver->core, var_of(flag), bvatom_idx2tagged_ptr(i));
+    reader.pos += 4;
+  }
+
+  // merge table: don't create cycles
+  if (! snapshot_read_count(&reader, 2, &k)) return false;
+  for (i=0; i<k; i++) {
+    x = a[reader.pos ++];
+    y = a[reader.pos ++];
+    if (x <= 0 || x >= vtbl->nvars || y <= 0 || y >= vtbl->nvars || x == y ||
+        ! mtbl_is_root(&solver->mtbl, x) || mtbl_get_root(&solver->mtbl, y) == x) {
+      return false;
+    }
+    mtbl_map(&solver->mtbl, x, y);
+  }
+
+  // bounds
+  if (! snapshot_read_count(&reader, 2, &k)) return false;
+  for (i=0; i<k; i++) {
+    x = a[reader.pos ++];
+    y = a[reader.pos ++];
+    if (x <= 0 || x >= vtbl->nvars || y < 0 || y >= atbl->natoms) return false;
+    bv_bound_queue_push(&solver->bqueue, x, y);
+  }
+
+  // select queue
+  if (! snapshot_read_count(&reader, 1, &k)) return false;
+  for (i=0; i<k; i++) {
+    x = a[reader.pos ++];
+    if (x <= 0 || x >= vtbl->nvars || bvvar_get_map(vtbl, x) == NULL) return false;
+    bv_queue_push(&solver->select_queue, x);
+  }
+
+  return reader.pos == n;
+}
+
+
+
+
 #if DUMP
 
 /*******************
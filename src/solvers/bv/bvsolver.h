@@ -73,6 +73,21 @@ extern bool bv_solver_bitblast(bv_solver_t *solver);
 extern bool bv_solver_compile(bv_solver_t *solver);
 
 
+/*
+ * Lazy bit-blasting of multiplications and divisions
+ * - this must be set before start_search to have an effect
+ * - it must be disabled when the clauses are exported to another
+ *   SAT solver (since the refinement is done in final_check)
+ */
+static inline void bv_solver_enable_lazy_blasting(bv_solver_t *solver) {
+  solver->lazy_blasting = true;
+}
+
+static inline void bv_solver_disable_lazy_blasting(bv_solver_t *solver) {
+  solver->lazy_blasting = false;
+}
+
+
 
 /*******************************
  *  INTERNALIZATION FUNCTIONS  *
@@ -268,6 +283,14 @@ static inline uint32_t bv_solver_interface_lemmas(bv_solver_t *solver) {
   return solver->stats.interface_lemmas;
 }
 
+static inline uint32_t bv_solver_lazy_ops(bv_solver_t *solver) {
+  return solver->stats.lazy_ops; // operations bit-blasted lazily
+}
+
+static inline uint32_t bv_solver_lazy_refinements(bv_solver_t *solver) {
+  return solver->stats.lazy_refinements;
+}
+
 
 
 /************************
@@ -412,6 +435,30 @@ extern void bv_solver_pop(bv_solver_t *solver);
 extern void bv_solver_reset(bv_solver_t *solver);
 
 
+/*
+ * SNAPSHOTS
+ */
+
+/*
+ * Store the solver state in v: variables, atoms, pseudo maps, merge table,
+ * bounds and select queue. This is intended to save the state reached
+ * after internalization so that it can be restored without redoing it.
+ * - return false if the state can't be stored: if the solver is not at
+ *   base level 0, if bit-blasting has started, or if there's an egraph
+ */
+extern bool bv_solver_snapshot(bv_solver_t *solver, ivector_t *v);
+
+/*
+ * Restore a snapshot stored in a[0 ... n-1]
+ * - the solver must be empty and at base level 0
+ * - the core must be restored first (the atoms and bit arrays refer
+ *   to its literals)
+ * - return false if a is not a valid snapshot (the solver may be
+ *   partially restored in this case)
+ */
+extern bool bv_solver_restore_snapshot(bv_solver_t *solver, const int32_t *a, uint32_t n);
+
+
 
 
 #endif /* __BVSOLVER_H */
@@ -200,7 +200,7 @@ typedef struct bv_queue_s {
  * For every push, we keep track of the number of variables and atoms
  * on entry to the new base level, the size of the bound queue, and
  * the size of the queue of select vars and delayed mapped/bitblasting vars, the
- * number of bitblasted atoms.
+ * number of bitblasted atoms, and the size of the lazy and refined queues.
  */
 typedef struct bv_trail_s {
   uint32_t nvars;
@@ -210,6 +210,8 @@ typedef struct bv_trail_s {
   uint32_t ndelayed_mapped;
   uint32_t ndelayed_blasted;
   uint32_t nbblasted;
+  uint32_t nlazy;
+  uint32_t nrefined;
 } bv_trail_t;
 
 typedef struct bv_trail_stack_s {
@@ -272,6 +274,8 @@ typedef struct bv_stats_s {
   uint32_t equiv_conflicts;
   uint32_t half_equiv_lemmas;
   uint32_t interface_lemmas;
+  uint32_t lazy_ops;           // operations bit-blasted lazily
+  uint32_t lazy_refinements;   // operations bit-blasted in final_check
 } bv_stats_t;
 
 
@@ -279,6 +283,11 @@ typedef struct bv_stats_s {
  *  SOLVER  *
  ***********/
 
+/*
+ * Minimal bit-width of the operations that can be bit-blasted lazily
+ */
+#define BV_LAZY_MIN_BITS 16
+
 typedef struct bv_solver_s {
   /*
    * Attached smt core + egraph
@@ -300,6 +309,19 @@ typedef struct bv_solver_s {
   bool bitblasted;
   uint32_t bbptr;
 
+  /*
+   * Lazy bit-blasting: if lazy_blasting is true, then multiplications
+   * and divisions of at least BV_LAZY_MIN_BITS bits are bit-blasted
+   * as fresh variables (with a few cheap axioms). Their definition is
+   * bit-blasted in final_check if the assignment does not satisfy it.
+   * - lazy_queue = variables bit-blasted lazily
+   * - refined_queue = variables of lazy_queue whose definition
+   *   was bit-blasted later (used to restore their lazy bit on pop)
+   */
+  bool lazy_blasting;
+  bv_queue_t lazy_queue;
+  bv_queue_t refined_queue;
+
   /*
    * Variable + atom tables
    */
@@ -375,6 +397,7 @@ typedef struct bv_solver_s {
   // buffers for bit-blasting
   ivector_t a_vector;
   ivector_t b_vector;
+  ivector_t c_vector;
 
 
   /*
@@ -375,6 +375,17 @@ literal_t *remap_table_fresh_array(remap_table_t *table, uint32_t n) {
 }
 
 
+/*
+ * Restore map[x] and merge_bit[x]
+ */
+void remap_table_restore_var(remap_table_t *table, int32_t x, literal_t l) {
+  assert(0 < x && x < table->nvars && table->trail.top == 0 &&
+         !tst_bit(table->merge_bit, x));
+
+  table->map[x] = l;
+}
+
+
 /*
  * Substitution: replace l by its root
  */
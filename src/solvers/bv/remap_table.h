@@ -221,6 +221,16 @@ extern literal_t remap_table_fresh_lit(remap_table_t *table);
 extern literal_t *remap_table_fresh_array(remap_table_t *table, uint32_t n);
 
 
+/*
+ * Restore variable x from a snapshot: set map[x] to l
+ * - x must be a variable of table other than 0 (i.e., 0 < x < table->nvars)
+ *   and x must not be merged with another variable
+ * - l must be a literal of the core or null_literal
+ * - this must be called at level 0: nothing is saved on the undo stack
+ */
+extern void remap_table_restore_var(remap_table_t *table, int32_t x, literal_t l);
+
+
 /*
  * Decrement the reference counter (a must be allocated with the previous
  * function or with refcount_int_array).
@@ -0,0 +1,244 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CLAUSE EXCHANGE BETWEEN PARALLEL SOLVERS
+ */
+
+#include <assert.h>
+
+#include "solvers/cdcl/clause_exchange.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * All accesses to shared fields go through the GCC atomic builtins.
+ * Data words are accessed with relaxed atomics: a reader may race with
+ * the writer but it discards what it read if the ring's reserved index
+ * shows that the data was overwritten.
+ */
+#define load_relaxed(p)      __atomic_load_n(p, __ATOMIC_RELAXED)
+#define load_acquire(p)      __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define store_relaxed(p, v)  __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#define store_release(p, v)  __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+
+/*
+ * RING BUFFER
+ */
+static void init_clause_ring(clause_ring_t *r, uint32_t n) {
+  assert(n > 0 && (n & (n - 1)) == 0);
+  r->data = (uint32_t *) safe_malloc(n * sizeof(uint32_t));
+  r->capacity = n;
+  r->head = 0;
+  r->reserved = 0;
+}
+
+static void delete_clause_ring(clause_ring_t *r) {
+  safe_free(r->data);
+  r->data = NULL;
+}
+
+
+/*
+ * Write clause a[0 ... n-1]: only the ring's owner can call this
+ */
+static void clause_ring_write(clause_ring_t *r, uint32_t n, const literal_t *a) {
+  uint32_t pos, mask, i;
+
+  assert(n < r->capacity);
+
+  mask = r->capacity - 1;
+  pos = r->head;
+
+  store_relaxed(&r->reserved, pos + n + 1);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  store_relaxed(r->data + (pos & mask), n);
+  for (i=0; i<n; i++) {
+    pos ++;
+    store_relaxed(r->data + (pos & mask), (uint32_t) a[i]);
+  }
+  pos ++;
+
+  store_release(&r->head, pos);
+}
+
+
+/*
+ * Read the clause at position *cursor into v
+ * - max_length = bound on the clause length
+ * - return false if the clause was overwritten or if there's nothing to read
+ * - if the cursor has fallen behind, it's moved to the ring's head
+ *   and dropped is incremented
+ */
+static bool clause_ring_read(clause_ring_t *r, uint32_t *cursor, uint32_t max_length, ivector_t *v, uint64_t *dropped) {
+  uint32_t head, pos, mask, n, i;
+
+  head = load_acquire(&r->head);
+  pos = *cursor;
+  if (pos == head) return false;
+
+  if (head - pos <= r->capacity) {
+    mask = r->capacity - 1;
+    ivector_reset(v);
+    n = load_relaxed(r->data + (pos & mask));
+    if (n <= max_length) {
+      for (i=1; i<=n; i++) {
+        ivector_push(v, (int32_t) load_relaxed(r->data + ((pos + i) & mask)));
+      }
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (load_relaxed(&r->reserved) - pos <= r->capacity) {
+        // not overwritten
+        *cursor = pos + n + 1;
+        return true;
+      }
+    }
+  }
+
+  // lost: skip to the head
+  (*dropped) ++;
+  *cursor = head;
+  return false;
+}
+
+
+
+/*
+ * EXCHANGE
+ */
+void init_clause_exchange(clause_exchange_t *x, uint32_t n) {
+  uint32_t i;
+
+  assert(n >= 2);
+
+  x->ring = (clause_ring_t *) safe_malloc(n * sizeof(clause_ring_t));
+  for (i=0; i<n; i++) {
+    init_clause_ring(x->ring + i, CLAUSE_RING_CAPACITY);
+  }
+  x->nworkers = n;
+  x->max_length = DEF_SHARE_MAX_LENGTH;
+  x->max_lbd = DEF_SHARE_MAX_LBD;
+  x->nvars = 0;
+  x->nready = 0;
+  x->mismatch = false;
+}
+
+void delete_clause_exchange(clause_exchange_t *x) {
+  uint32_t i;
+
+  for (i=0; i<x->nworkers; i++) {
+    delete_clause_ring(x->ring + i);
+  }
+  safe_free(x->ring);
+  x->ring = NULL;
+}
+
+
+
+/*
+ * PORTS
+ */
+void init_clause_port(clause_port_t *p, clause_exchange_t *x, uint32_t id) {
+  uint32_t i;
+
+  assert(id < x->nworkers);
+
+  p->exchange = x;
+  p->id = id;
+  p->next = (id + 1) % x->nworkers;
+  p->cursor = (uint32_t *) safe_malloc(x->nworkers * sizeof(uint32_t));
+  for (i=0; i<x->nworkers; i++) {
+    p->cursor[i] = 0;
+  }
+  p->active = false;
+  p->nvars = 0;
+  p->exported = 0;
+  p->imported = 0;
+  p->dropped = 0;
+}
+
+void delete_clause_port(clause_port_t *p) {
+  safe_free(p->cursor);
+  p->cursor = NULL;
+}
+
+
+/*
+ * Registration: the first worker to register sets x->nvars.
+ * The others compare their number of variables with it.
+ */
+void clause_port_register(clause_port_t *p, uint32_t nvars) {
+  clause_exchange_t *x;
+  uint32_t expected;
+
+  assert(nvars > 0);
+
+  x = p->exchange;
+  expected = 0;
+  if (! __atomic_compare_exchange_n(&x->nvars, &expected, nvars, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+      && expected != nvars) {
+    store_relaxed(&x->mismatch, true);
+  }
+  __atomic_fetch_add(&x->nready, 1, __ATOMIC_RELEASE);
+}
+
+
+bool clause_port_is_active(clause_port_t *p) {
+  clause_exchange_t *x;
+
+  if (! p->active) {
+    x = p->exchange;
+    if (load_acquire(&x->nready) == x->nworkers && ! load_relaxed(&x->mismatch)) {
+      p->nvars = load_relaxed(&x->nvars);
+      p->active = true;
+    }
+  }
+  return p->active;
+}
+
+
+void clause_port_export(clause_port_t *p, uint32_t n, const literal_t *a) {
+  assert(p->active && 0 < n && n <= p->exchange->max_length);
+  clause_ring_write(p->exchange->ring + p->id, n, a);
+  p->exported ++;
+}
+
+
+bool clause_port_import(clause_port_t *p, ivector_t *v) {
+  clause_exchange_t *x;
+  uint32_t i, j;
+
+  assert(p->active);
+
+  x = p->exchange;
+  j = p->next;
+  for (i=1; i<x->nworkers; i++) {
+    if (j == p->id) {
+      j = (j + 1) % x->nworkers;
+    }
+    if (clause_ring_read(x->ring + j, p->cursor + j, x->max_length, v, &p->dropped)) {
+      p->next = (j + 1) % x->nworkers;
+      p->imported ++;
+      return true;
+    }
+    j = (j + 1) % x->nworkers;
+  }
+
+  return false;
+}
@@ -0,0 +1,188 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CLAUSE EXCHANGE BETWEEN PARALLEL SOLVERS
+ *
+ * Several smt_cores that solve the same problem in different threads
+ * can exchange short learned clauses (including units) through a
+ * clause exchange. Each solver (worker) owns one ring buffer where it
+ * writes the clauses it exports. All the other workers read from that
+ * ring. There's a single writer per ring so no lock is needed:
+ * - the writer publishes a clause by updating the ring's head
+ * - readers that fall behind by more than a ring's capacity
+ *   lose the overwritten clauses (this is detected by a seqlock-style
+ *   check on the ring's reserved index).
+ *
+ * A clause learned by one worker is valid in another worker only if the
+ * Boolean variables denote the same atoms in both. This holds for the
+ * variables created before the search starts, provided all workers
+ * internalized the same assertions in the same way. Each worker registers
+ * its number of variables when its search starts. Sharing is enabled
+ * only once all workers have registered and they all agree on this
+ * number. Clauses that contain a variable outside this common prefix
+ * (e.g., created during the search by a theory solver) are not exported.
+ */
+
+#ifndef __CLAUSE_EXCHANGE_H
+#define __CLAUSE_EXCHANGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "solvers/cdcl/smt_core_base_types.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Ring buffer:
+ * - data = array of size capacity (a power of two)
+ * - a clause of n literals is stored as n followed by the literals
+ * - head = end of the last published clause
+ * - reserved = end of the clause being written
+ * Positions are 32bit counters that wrap around. The actual index of
+ * position k in data is (k & (capacity - 1)).
+ */
+typedef struct clause_ring_s {
+  uint32_t *data;
+  uint32_t capacity;
+  uint32_t head;
+  uint32_t reserved;
+} clause_ring_t;
+
+#define CLAUSE_RING_CAPACITY 65536
+
+
+/*
+ * Exchange:
+ * - nworkers = number of rings
+ * - max_length = maximal length of exported clauses
+ * - max_lbd = maximal LBD of exported clauses
+ * - nvars = number of variables in the common prefix
+ *   (0 until the first worker registers)
+ * - nready = number of workers that registered
+ * - mismatch = true if two workers registered different nvars
+ */
+typedef struct clause_exchange_s {
+  clause_ring_t *ring;
+  uint32_t nworkers;
+  uint32_t max_length;
+  uint32_t max_lbd;
+  uint32_t nvars;
+  uint32_t nready;
+  bool mismatch;
+} clause_exchange_t;
+
+#define DEF_SHARE_MAX_LENGTH 8
+#define DEF_SHARE_MAX_LBD    2
+
+
+/*
+ * Port: connects worker id to the exchange
+ * - cursor[j] = read position in ring j (cursor[id] is not used)
+ * - next = index of the next ring to read from
+ * - active = true once the exchange is known to be enabled
+ * - nvars = copy of exchange->nvars (valid if active is true)
+ * - statistics: number of clauses exported, imported, and
+ *   dropped (lost because the reader fell behind)
+ */
+typedef struct clause_port_s {
+  clause_exchange_t *exchange;
+  uint32_t id;
+  uint32_t next;
+  uint32_t *cursor;
+  bool active;
+  uint32_t nvars;
+  uint64_t exported;
+  uint64_t imported;
+  uint64_t dropped;
+} clause_port_t;
+
+
+
+/*
+ * Initialize an exchange for n workers
+ * - n must be at least 2
+ * - max_length and max_lbd are set to the defaults
+ */
+extern void init_clause_exchange(clause_exchange_t *x, uint32_t n);
+
+/*
+ * Delete: free memory
+ */
+extern void delete_clause_exchange(clause_exchange_t *x);
+
+
+/*
+ * Initialize port p for worker id
+ * - id must be less than x->nworkers
+ */
+extern void init_clause_port(clause_port_t *p, clause_exchange_t *x, uint32_t id);
+
+/*
+ * Delete port p
+ */
+extern void delete_clause_port(clause_port_t *p);
+
+
+/*
+ * Register the number of variables of p's worker.
+ * - this must be called once, when the worker starts searching
+ */
+extern void clause_port_register(clause_port_t *p, uint32_t nvars);
+
+
+/*
+ * Check whether sharing is enabled
+ * - this returns false until all workers have registered
+ */
+extern bool clause_port_is_active(clause_port_t *p);
+
+
+/*
+ * Check whether a clause of length n and lbd is worth exporting
+ * - the clause's variables must also be checked with clause_port_var_is_shared
+ */
+static inline bool clause_port_accepts(clause_port_t *p, uint32_t n, uint32_t lbd) {
+  return n <= p->exchange->max_length && lbd <= p->exchange->max_lbd;
+}
+
+static inline bool clause_port_var_is_shared(clause_port_t *p, bvar_t x) {
+  return (uint32_t) x < p->nvars;
+}
+
+
+/*
+ * Export clause a[0 ... n-1]
+ * - p must be active
+ * - n must be positive and no more than max_length
+ * - all variables of a must be shared
+ */
+extern void clause_port_export(clause_port_t *p, uint32_t n, const literal_t *a);
+
+
+/*
+ * Get the next clause exported by the other workers
+ * - p must be active
+ * - return false if there's none
+ * - otherwise, the clause is copied into v and the function returns true
+ */
+extern bool clause_port_import(clause_port_t *p, ivector_t *v);
+
+
+#endif /* __CLAUSE_EXCHANGE_H */
@@ -0,0 +1,524 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CUBE AND CONQUER FOR THE NEW SAT SOLVER
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "solvers/cdcl/cube_and_conquer.h"
+#include "utils/memalloc.h"
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <pthread.h>
+#include <unistd.h>
+
+#include "mt/threads.h"
+#endif
+
+
+/*
+ * Worker:
+ * - solver = copy of the simplified problem
+ * - cubes in [lo, hi) are owned by this worker
+ * - current = cube being solved or -1
+ * - in multithreaded mode, lock protects lo and hi
+ */
+typedef struct cube_worker_s {
+  sat_solver_t solver;
+  uint32_t lo;
+  uint32_t hi;
+  int32_t current;
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  pthread_mutex_t lock;
+#endif
+} cube_worker_t;
+
+
+/*
+ * Global state:
+ * - master = the solver that produced the cubes
+ * - cubes = cubes as returned by nsat_lookahead_cubes
+ * - ncubes = number of cubes
+ * - start[i] = index of cube i in vector cubes
+ * - refuted[i] = true if cube i is known to be unsat
+ * - winner = index of the worker that found a model (or -1)
+ * - unsat = true if a worker proved that the problem is unsat
+ * - solved = number of cubes solved
+ * - pruned = number of cubes removed without being solved
+ * - in multithreaded mode, lock protects refuted, winner, unsat, solved,
+ *   pruned and the current field of all workers.
+ */
+typedef struct cube_conquer_s {
+  sat_solver_t *master;
+  ivector_t cubes;
+  uint32_t ncubes;
+  uint32_t *start;
+  bool *refuted;
+  cube_worker_t *worker;
+  uint32_t nworkers;
+  int32_t winner;
+  bool unsat;
+  uint32_t solved;
+  uint32_t pruned;
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  pthread_mutex_t lock;
+#endif
+} cube_conquer_t;
+
+
+/*
+ * Cube i: length and literals
+ */
+static inline uint32_t cube_length(const cube_conquer_t *cc, uint32_t i) {
+  assert(i < cc->ncubes);
+  return cc->cubes.data[cc->start[i]];
+}
+
+static inline literal_t *cube_literals(const cube_conquer_t *cc, uint32_t i) {
+  assert(i < cc->ncubes);
+  return cc->cubes.data + cc->start[i] + 1;
+}
+
+
+/*
+ * Default depth: log2(n) rounded up + CUBE_EXTRA_DEPTH
+ */
+static uint32_t default_depth(uint32_t n) {
+  uint32_t d;
+
+  d = CUBE_EXTRA_DEPTH;
+  while (n > 1) {
+    d ++;
+    n = (n + 1) >> 1;
+  }
+  return d;
+}
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+/*
+ * Default number of workers: number of online processors
+ */
+static uint32_t default_workers(void) {
+  long n;
+
+  n = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n < 1) return 1;
+  if (n > CUBE_MAX_WORKERS) return CUBE_MAX_WORKERS;
+  return (uint32_t) n;
+}
+#endif
+
+
+/*
+ * Initialize: build the cubes then the workers
+ * - master must be preprocessed
+ */
+static void init_cube_conquer(cube_conquer_t *cc, sat_solver_t *master, uint32_t nworkers, uint32_t depth) {
+  cube_worker_t *w;
+  uint32_t i, j, n;
+
+  cc->master = master;
+  init_ivector(&cc->cubes, 0);
+  n = nsat_lookahead_cubes(master, depth, &cc->cubes);
+  cc->ncubes = n;
+  cc->start = (uint32_t *) safe_malloc(n * sizeof(uint32_t));
+  cc->refuted = (bool *) safe_malloc(n * sizeof(bool));
+  j = 0;
+  for (i=0; i<n; i++) {
+    cc->start[i] = j;
+    cc->refuted[i] = false;
+    j += cc->cubes.data[j] + 1;
+  }
+  assert(j == cc->cubes.size);
+
+  cc->nworkers = nworkers;
+  cc->worker = (cube_worker_t *) safe_malloc(nworkers * sizeof(cube_worker_t));
+  for (i=0; i<nworkers; i++) {
+    w = cc->worker + i;
+    init_nsat_solver(&w->solver, master->nvars, false);
+    w->solver.params = master->params;
+    nsat_set_random_seed(&w->solver, master->params.seed + i);
+    nsat_copy_problem(&w->solver, master);
+    w->lo = (uint32_t) (((uint64_t) n * i)/nworkers);
+    w->hi = (uint32_t) (((uint64_t) n * (i + 1))/nworkers);
+    w->current = -1;
+  }
+
+  cc->winner = -1;
+  cc->unsat = false;
+  cc->solved = 0;
+  cc->pruned = 0;
+}
+
+
+/*
+ * Delete: add the workers' statistics to the master's
+ */
+static void delete_cube_conquer(cube_conquer_t *cc) {
+  solver_stats_t *stats;
+  uint32_t i;
+
+  stats = &cc->master->stats;
+  for (i=0; i<cc->nworkers; i++) {
+    stats->conflicts += cc->worker[i].solver.stats.conflicts;
+    stats->decisions += cc->worker[i].solver.stats.decisions;
+    stats->propagations += cc->worker[i].solver.stats.propagations;
+    delete_nsat_solver(&cc->worker[i].solver);
+  }
+  safe_free(cc->worker);
+  safe_free(cc->start);
+  safe_free(cc->refuted);
+  delete_ivector(&cc->cubes);
+  cc->worker = NULL;
+  cc->start = NULL;
+  cc->refuted = NULL;
+}
+
+
+/*
+ * Check whether the search is over
+ */
+static inline bool cube_conquer_done(const cube_conquer_t *cc) {
+  return cc->winner >= 0 || cc->unsat;
+}
+
+
+/*
+ * Check whether cube j starts with the first p literals of cube i
+ */
+static bool cube_has_prefix(const cube_conquer_t *cc, uint32_t j, uint32_t i, uint32_t p) {
+  literal_t *a, *b;
+  uint32_t k;
+
+  if (cube_length(cc, j) < p) return false;
+
+  a = cube_literals(cc, i);
+  b = cube_literals(cc, j);
+  for (k=0; k<p; k++) {
+    if (a[k] != b[k]) return false;
+  }
+  return true;
+}
+
+static void mark_refuted(cube_conquer_t *cc, uint32_t j) {
+  if (! cc->refuted[j]) {
+    cc->refuted[j] = true;
+    cc->pruned ++;
+  }
+}
+
+/*
+ * Cube i is refuted by its first p literals
+ * - the cubes that share this prefix are contiguous to i
+ * - interrupt the workers that are solving one of them
+ */
+static void prune_cubes(cube_conquer_t *cc, uint32_t i, uint32_t p) {
+  cube_worker_t *w;
+  uint32_t j;
+
+  assert(0 < p && p <= cube_length(cc, i));
+
+  j = i;
+  while (j > 0 && cube_has_prefix(cc, j-1, i, p)) {
+    j --;
+    mark_refuted(cc, j);
+  }
+  j = i + 1;
+  while (j < cc->ncubes && cube_has_prefix(cc, j, i, p)) {
+    mark_refuted(cc, j);
+    j ++;
+  }
+
+  for (j=0; j<cc->nworkers; j++) {
+    w = cc->worker + j;
+    if (w->current >= 0 && cc->refuted[w->current]) {
+      nsat_stop_search(&w->solver);
+    }
+  }
+}
+
+/*
+ * Interrupt all the workers
+ */
+static void stop_workers(cube_conquer_t *cc) {
+  uint32_t i;
+
+  for (i=0; i<cc->nworkers; i++) {
+    nsat_stop_search(&cc->worker[i].solver);
+  }
+}
+
+/*
+ * Record the result of worker id on its current cube
+ */
+static void record_result(cube_conquer_t *cc, uint32_t id, solver_status_t stat) {
+  cube_worker_t *w;
+  uint32_t i;
+
+  w = cc->worker + id;
+  assert(w->current >= 0);
+  i = w->current;
+  w->current = -1;
+
+  switch (stat) {
+  case STAT_SAT:
+    if (cc->winner < 0) {
+      cc->winner = id;
+      stop_workers(cc);
+    }
+    break;
+
+  case STAT_UNSAT:
+    cc->solved ++;
+    cc->refuted[i] = true;
+    if (w->solver.failed_prefix == 0) {
+      cc->unsat = true;
+      stop_workers(cc);
+    } else {
+      prune_cubes(cc, i, w->solver.failed_prefix);
+    }
+    break;
+
+  default:
+    // interrupted
+    break;
+  }
+}
+
+
+/*
+ * Check whether worker id must solve cube i and make i the current cube
+ */
+static bool start_cube(cube_conquer_t *cc, uint32_t id, uint32_t i) {
+  cube_worker_t *w;
+
+  w = cc->worker + id;
+  if (cc->refuted[i]) return false;
+  w->current = i;
+  nsat_clear_stop_flag(&w->solver);
+  return true;
+}
+
+
+/*
+ * Solve the current cube of worker id
+ */
+static solver_status_t solve_cube(cube_conquer_t *cc, uint32_t id) {
+  cube_worker_t *w;
+  uint32_t i;
+
+  w = cc->worker + id;
+  assert(w->current >= 0);
+  i = w->current;
+  return nsat_solve_with_assumptions(&w->solver, cube_length(cc, i), cube_literals(cc, i));
+}
+
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+/*
+ * MULTI-THREADED VERSION
+ */
+
+typedef struct cube_job_s {
+  cube_conquer_t *cc;
+  uint32_t id;
+} cube_job_t;
+
+
+/*
+ * Get the next cube for worker id:
+ * - take the first cube of its own range if any
+ * - otherwise steal the upper half of another worker's range
+ * - return -1 if all ranges are empty
+ */
+static int32_t next_cube(cube_conquer_t *cc, uint32_t id) {
+  cube_worker_t *w, *v;
+  uint32_t k, lo, hi, mid;
+  int32_t i;
+
+  w = cc->worker + id;
+  i = -1;
+  check_thread_api(pthread_mutex_lock(&w->lock), "cube_worker: pthread_mutex_lock");
+  if (w->lo < w->hi) {
+    i = w->lo;
+    w->lo ++;
+  }
+  check_thread_api(pthread_mutex_unlock(&w->lock), "cube_worker: pthread_mutex_unlock");
+  if (i >= 0) return i;
+
+  for (k=1; k<cc->nworkers; k++) {
+    v = cc->worker + (id + k) % cc->nworkers;
+    lo = 0;
+    hi = 0;
+    check_thread_api(pthread_mutex_lock(&v->lock), "cube_worker: pthread_mutex_lock");
+    if (v->lo < v->hi) {
+      mid = v->lo + (v->hi - v->lo)/2;
+      lo = mid;
+      hi = v->hi;
+      v->hi = mid;
+    }
+    check_thread_api(pthread_mutex_unlock(&v->lock), "cube_worker: pthread_mutex_unlock");
+
+    if (lo < hi) {
+      // stolen range: [lo, hi)
+      check_thread_api(pthread_mutex_lock(&w->lock), "cube_worker: pthread_mutex_lock");
+      w->lo = lo + 1;
+      w->hi = hi;
+      check_thread_api(pthread_mutex_unlock(&w->lock), "cube_worker: pthread_mutex_unlock");
+      return lo;
+    }
+  }
+
+  return -1;
+}
+
+
+static void *cube_worker(void *arg) {
+  cube_job_t *job;
+  cube_conquer_t *cc;
+  solver_status_t stat;
+  int32_t i;
+  bool solve, done;
+
+  job = arg;
+  cc = job->cc;
+
+  for (;;) {
+    i = next_cube(cc, job->id);
+    if (i < 0) break;
+
+    check_thread_api(pthread_mutex_lock(&cc->lock), "cube_worker: pthread_mutex_lock");
+    done = cube_conquer_done(cc);
+    solve = !done && start_cube(cc, job->id, i);
+    check_thread_api(pthread_mutex_unlock(&cc->lock), "cube_worker: pthread_mutex_unlock");
+    if (done) break;
+
+    if (solve) {
+      stat = solve_cube(cc, job->id);
+      check_thread_api(pthread_mutex_lock(&cc->lock), "cube_worker: pthread_mutex_lock");
+      record_result(cc, job->id, stat);
+      check_thread_api(pthread_mutex_unlock(&cc->lock), "cube_worker: pthread_mutex_unlock");
+      // the solver can't be used after a model is found
+      if (stat == STAT_SAT) break;
+    }
+  }
+
+  return NULL;
+}
+
+
+static void run_workers(cube_conquer_t *cc) {
+  cube_job_t *job;
+  pthread_t *tid;
+  uint32_t i, n;
+
+  n = cc->nworkers;
+  check_thread_api(pthread_mutex_init(&cc->lock, NULL), "cube_and_conquer: pthread_mutex_init");
+  for (i=0; i<n; i++) {
+    check_thread_api(pthread_mutex_init(&cc->worker[i].lock, NULL), "cube_and_conquer: pthread_mutex_init");
+  }
+
+  job = (cube_job_t *) safe_malloc(n * sizeof(cube_job_t));
+  tid = (pthread_t *) safe_malloc(n * sizeof(pthread_t));
+  for (i=0; i<n; i++) {
+    job[i].cc = cc;
+    job[i].id = i;
+    check_thread_api(pthread_create(tid + i, NULL, cube_worker, job + i), "cube_and_conquer: pthread_create");
+  }
+  for (i=0; i<n; i++) {
+    check_thread_api(pthread_join(tid[i], NULL), "cube_and_conquer: pthread_join");
+  }
+  safe_free(job);
+  safe_free(tid);
+
+  for (i=0; i<n; i++) {
+    check_thread_api(pthread_mutex_destroy(&cc->worker[i].lock), "cube_and_conquer: pthread_mutex_destroy");
+  }
+  check_thread_api(pthread_mutex_destroy(&cc->lock), "cube_and_conquer: pthread_mutex_destroy");
+}
+
+
+#else
+
+/*
+ * SINGLE-THREADED VERSION: worker 0 solves all the cubes
+ */
+static void run_workers(cube_conquer_t *cc) {
+  uint32_t i;
+  solver_status_t stat;
+
+  for (i=0; i<cc->ncubes; i++) {
+    if (cube_conquer_done(cc)) break;
+    if (start_cube(cc, 0, i)) {
+      stat = solve_cube(cc, 0);
+      record_result(cc, 0, stat);
+    }
+  }
+}
+
+#endif
+
+
+solver_status_t nsat_cube_and_conquer(sat_solver_t *solver, uint32_t nworkers, uint32_t depth) {
+  cube_conquer_t cc;
+  solver_status_t stat;
+
+  assert(nworkers <= CUBE_MAX_WORKERS);
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  if (nworkers == 0) {
+    nworkers = default_workers();
+  }
+#else
+  nworkers = 1;
+#endif
+
+  stat = nsat_apply_preprocessing(solver);
+  if (stat != STAT_UNKNOWN) return stat;
+
+  if (depth == 0) {
+    depth = default_depth(nworkers);
+  }
+  init_cube_conquer(&cc, solver, nworkers, depth);
+  if (cc.ncubes > 0) {
+    run_workers(&cc);
+  }
+
+  if (cc.winner >= 0) {
+    nsat_import_model(solver, &cc.worker[cc.winner].solver);
+  } else if (! solver->has_empty_clause) {
+    // all cubes are refuted
+    nsat_solver_simplify_and_add_clause(solver, 0, NULL);
+  }
+
+  if (solver->verbosity >= 1) {
+    fprintf(stderr, "c cube and conquer: %"PRIu32" workers, %"PRIu32" cubes, %"PRIu32" solved, %"PRIu32" pruned\n",
+	    cc.nworkers, cc.ncubes, cc.solved, cc.pruned);
+  }
+
+  delete_cube_conquer(&cc);
+
+  return solver->status;
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CUBE AND CONQUER FOR THE NEW SAT SOLVER
+ *
+ * The clauses are first simplified by the solver's preprocessing. Then
+ * a lookahead splits the search space into cubes (cf. nsat_lookahead_cubes).
+ * Each worker owns a copy of the simplified problem and solves cubes
+ * under assumptions. It keeps its learned clauses from one cube to the next.
+ *
+ * Scheduling: the cubes are listed in depth-first order. Each worker
+ * starts with a contiguous range of cubes and solves them in order.
+ * A worker that runs out of cubes steals the upper half of another
+ * worker's range.
+ *
+ * Pruning: when a cube is unsat, the solver reports a prefix of the cube
+ * that's unsat. All the cubes that share this prefix are unsat too. They
+ * are removed and the workers that are solving them are interrupted.
+ *
+ * The search stops as soon as a cube is satisfiable or when all cubes
+ * are refuted. If the library is not thread safe, a single worker
+ * solves all the cubes.
+ */
+
+#ifndef __CUBE_AND_CONQUER_H
+#define __CUBE_AND_CONQUER_H
+
+#include <stdint.h>
+
+#include "solvers/cdcl/new_sat_solver.h"
+
+
+/*
+ * Bound on the number of workers
+ */
+#define CUBE_MAX_WORKERS 64
+
+/*
+ * Default lookahead depth: log2(number of workers) + CUBE_EXTRA_DEPTH
+ * so that there are a few cubes per worker.
+ */
+#define CUBE_EXTRA_DEPTH 4
+
+
+/*
+ * Check satisfiability of solver's clauses using cube and conquer
+ * - nworkers = number of threads (at most CUBE_MAX_WORKERS)
+ *   if nworkers is 0, we use one thread per online processor
+ * - depth = lookahead depth (0 means use the default)
+ * - the workers use the same search parameters as solver, except for the
+ *   random seed.
+ * - result = STAT_SAT or STAT_UNSAT.
+ *
+ * If the result is STAT_SAT, the model is stored in solver. The statistics
+ * of all workers (conflicts, decisions, propagations) are added to solver's
+ * statistics.
+ */
+extern solver_status_t nsat_cube_and_conquer(sat_solver_t *solver, uint32_t nworkers, uint32_t depth);
+
+
+#endif /* __CUBE_AND_CONQUER_H */
@@ -32,6 +32,7 @@
 #include "kissat.h"
 #endif
 
+#include "solvers/cdcl/cube_and_conquer.h"
 #include "solvers/cdcl/delegate.h"
 #include "solvers/cdcl/new_sat_solver.h"
 #include "utils/memalloc.h"
@@ -164,6 +165,23 @@ static void ysat_as_delegate(delegate_t *d, uint32_t nvars) {
 }
 
 
+/*
+ * y2sat with cube and conquer: one worker per processor
+ */
+static smt_status_t ysat_cubes_check(void *solver) {
+  switch (nsat_cube_and_conquer(solver, 0, 0)) {
+  case STAT_SAT: return STATUS_SAT;
+  case STAT_UNSAT: return STATUS_UNSAT;
+  default: return STATUS_UNKNOWN;
+  }
+}
+
+static void ysat_cubes_as_delegate(delegate_t *d, uint32_t nvars) {
+  ysat_as_delegate(d, nvars);
+  d->check = ysat_cubes_check;
+}
+
+
 #if HAVE_CADICAL || HAVE_KISSAT
 /*
  * Conversion from literal_t to dimacs:
@@ -515,6 +533,9 @@ bool init_delegate(delegate_t *d, const char *solver_name, uint32_t nvars) {
   if (strcmp("y2sat", solver_name) == 0) {
     ysat_as_delegate(d, nvars);
     return true;
+  } else if (strcmp("y2sat-cubes", solver_name) == 0) {
+    ysat_cubes_as_delegate(d, nvars);
+    return true;
 #if HAVE_CADICAL
   } else if (strcmp("cadical", solver_name) == 0) {
     cadical_as_delegate(d, nvars);
@@ -546,7 +567,7 @@ bool init_delegate(delegate_t *d, const char *solver_name, uint32_t nvars) {
  *   if we have optional support (but not compiled), *unknown is set to fasle.
  */
 bool supported_delegate(const char *solver_name, bool *unknown) {
-  if (strcmp("y2sat", solver_name) == 0) {
+  if (strcmp("y2sat", solver_name) == 0 || strcmp("y2sat-cubes", solver_name) == 0) {
     *unknown = false;
     return true;
   }
@@ -2912,6 +2912,12 @@ void init_nsat_solver(sat_solver_t *solver, uint32_t sz, bool pp) {
   init_descriptors(&solver->descriptors);
   init_bgate_array(&solver->gates);
 
+  solver->assumptions = NULL;
+  solver->nassumptions = 0;
+  solver->failed_prefix = 0;
+  solver->search_ready = false;
+  solver->stop = false;
+
   solver->data = NULL;
 }
 
@@ -3045,6 +3051,12 @@ void reset_nsat_solver(sat_solver_t *solver) {
   reset_descriptors(&solver->descriptors);
   reset_bgate_array(&solver->gates);
 
+  solver->assumptions = NULL;
+  solver->nassumptions = 0;
+  solver->failed_prefix = 0;
+  solver->search_ready = false;
+  solver->stop = false;
+
   reset_datafile(solver);
 }
 
@@ -3543,19 +3555,12 @@ static void assign_literal(sat_solver_t *solver, literal_t l) {
 
 
 /*
- * Decide literal: increase decision level then
- * assign literal l to true and push it on the stack
+ * Increase the decision level
+ * - return the new level
  */
-static void nsat_decide_literal(sat_solver_t *solver, literal_t l) {
+static uint32_t open_decision_level(sat_solver_t *solver) {
   uint32_t k;
-  bvar_t v;
-
-  assert(l < solver->nliterals);
-  assert(lit_is_unassigned(solver, l));
-
-  solver->stats.decisions ++;
 
-  // Increase decision level
   k = solver->decision_level + 1;
   solver->decision_level = k;
   if (solver->stack.nlevels <= k) {
@@ -3567,6 +3572,24 @@ static void nsat_decide_literal(sat_solver_t *solver, literal_t l) {
   }
   solver->stash.level[k] = solver->stash.top;
 
+  return k;
+}
+
+/*
+ * Decide literal: increase decision level then
+ * assign literal l to true and push it on the stack
+ */
+static void nsat_decide_literal(sat_solver_t *solver, literal_t l) {
+  uint32_t k;
+  bvar_t v;
+
+  assert(l < solver->nliterals);
+  assert(lit_is_unassigned(solver, l));
+
+  solver->stats.decisions ++;
+
+  k = open_decision_level(solver);
+
   push_literal(&solver->stack, l);
 
   solver->value[l] = VAL_TRUE;
@@ -10770,6 +10793,173 @@ static void try_naive_search(sat_solver_t *solver) {
 
 
 
+/*************************
+ *  LOOKAHEAD AND CUBES  *
+ ************************/
+
+/*
+ * To split the search space into cubes, we build a shallow decision tree:
+ * - at each node, the candidate branching variables are the first
+ *   LOOKAHEAD_CANDIDATES active variables in the decision list
+ *   (i.e., the most active variables).
+ * - for each candidate x, we probe pos_lit(x) and neg_lit(x) and count
+ *   how many literals each assigns. The branching variable is the
+ *   candidate with the largest product of these two counts.
+ * - if both literals of x cause a conflict, the node is refuted.
+ *   If only one of them does, then the other literal is forced as in
+ *   failed-literal probing: we add it to the current cube and try again.
+ */
+#define LOOKAHEAD_CANDIDATES 32
+
+/*
+ * Probe literal l:
+ * - return false if l causes a conflict
+ * - otherwise, store the number of literals assigned by l in *props
+ *   and backtrack
+ */
+static bool lookahead_probe(sat_solver_t *solver, literal_t l, uint32_t *props) {
+  uint32_t top;
+
+  top = solver->stack.top;
+  if (! test_literal(solver, l)) {
+    return false;
+  }
+  *props = solver->stack.top - top;
+  backtrack_one_level(solver);
+
+  return true;
+}
+
+/*
+ * Collect at most max active variables of highest rank into a
+ * - return the number of variables collected
+ */
+static uint32_t lookahead_candidates(const sat_solver_t *solver, bvar_t *a, uint32_t max) {
+  const nvar_list_t *list;
+  uint32_t n;
+  bvar_t x;
+
+  list = &solver->list;
+  n = 0;
+  x = list->link[0].pre;
+  while (x != 0 && n < max) {
+    if (var_is_active(solver, x)) {
+      a[n] = x;
+      n ++;
+    }
+    x = list->link[x].pre;
+  }
+
+  return n;
+}
+
+/*
+ * Split the current node
+ * - path = literals assigned on the way to this node (one per decision level)
+ * - depth = number of splits left
+ * - the cubes under this node are added to vector cubes
+ */
+static void lookahead_split(sat_solver_t *solver, ivector_t *path, uint32_t depth, ivector_t *cubes) {
+  bvar_t candidate[LOOKAHEAD_CANDIDATES];
+  uint32_t i, n, forced, pos, neg;
+  uint64_t score, best_score;
+  literal_t l;
+  bvar_t x, best;
+  bool pos_ok, neg_ok;
+
+  forced = 0;
+
+ again:
+  best = 0;
+  best_score = 0;
+  if (depth > 0) {
+    n = lookahead_candidates(solver, candidate, LOOKAHEAD_CANDIDATES);
+    for (i=0; i<n; i++) {
+      x = candidate[i];
+      pos_ok = lookahead_probe(solver, pos_lit(x), &pos);
+      neg_ok = lookahead_probe(solver, neg_lit(x), &neg);
+      if (pos_ok != neg_ok) {
+	// failed literal: force the other one
+	l = pos_ok ? pos_lit(x) : neg_lit(x);
+	if (! test_literal(solver, l)) goto undo;
+	ivector_push(path, l);
+	forced ++;
+	goto again;
+      }
+      if (! pos_ok) goto undo; // refuted
+
+      score = ((uint64_t) pos + 1) * ((uint64_t) neg + 1);
+      if (score > best_score) {
+	best_score = score;
+	best = x;
+      }
+    }
+  }
+
+  if (best == 0) {
+    // leaf: store the cube
+    ivector_push(cubes, path->size);
+    ivector_add(cubes, path->data, path->size);
+  } else {
+    l = preferred_literal(solver, best);
+    for (i=0; i<2; i++) {
+      if (test_literal(solver, l)) {
+	ivector_push(path, l);
+	lookahead_split(solver, path, depth - 1, cubes);
+	ivector_pop(path);
+	backtrack_one_level(solver);
+      }
+      l = not(l);
+    }
+  }
+
+ undo:
+  while (forced > 0) {
+    backtrack_one_level(solver);
+    ivector_pop(path);
+    forced --;
+  }
+}
+
+
+/*
+ * Build the cubes
+ */
+uint32_t nsat_lookahead_cubes(sat_solver_t *solver, uint32_t depth, ivector_t *cubes) {
+  ivector_t path;
+  uint64_t props;
+  uint32_t i, n;
+
+  assert(solver->decision_level == 0 && ! solver->preprocess);
+
+  ivector_reset(cubes);
+  if (solver->has_empty_clause) return 0;
+
+  props = solver->stats.propagations;
+  save_assignment(solver);
+  init_ivector(&path, 10);
+  lookahead_split(solver, &path, depth, cubes);
+  delete_ivector(&path);
+  restore_assignment(solver);
+  solver->stats.propagations = props;
+
+  if (cubes->size == 0) {
+    // all branches are refuted
+    add_empty_clause(solver);
+    return 0;
+  }
+
+  n = 0;
+  for (i=0; i<cubes->size; i += cubes->data[i] + 1) {
+    n ++;
+  }
+
+  return n;
+}
+
+
+
+
 /*****************
  *  HEURISTICS   *
  ****************/
@@ -11138,13 +11328,52 @@ solver_status_t nsat_apply_preprocessing(sat_solver_t *solver) {
 
 
 /*
- * Solving procedure
+ * Check whether the search must be interrupted
  */
-solver_status_t nsat_solve(sat_solver_t *solver) {
-  bvar_t x;
+static inline bool search_stopped(sat_solver_t *solver) {
+  return __atomic_load_n(&solver->stop, __ATOMIC_RELAXED);
+}
 
-  if (solver->has_empty_clause) goto done;
 
+/*
+ * Decide the next assumption
+ * - the current decision level k must be less than solver->nassumptions
+ * - if assumption[k] is false, set status to UNSAT and return false
+ * - if it's true, open an empty decision level
+ */
+static bool decide_assumption(sat_solver_t *solver) {
+  literal_t l;
+  uint32_t k;
+
+  k = solver->decision_level;
+  assert(k < solver->nassumptions);
+
+  l = full_lit_subst(solver, solver->assumptions[k]);
+  switch (lit_value(solver, l)) {
+  case VAL_FALSE:
+    solver->failed_prefix = k + 1;
+    solver->status = STAT_UNSAT;
+    return false;
+
+  case VAL_TRUE:
+    (void) open_decision_level(solver);
+    break;
+
+  default:
+    nsat_decide_literal(solver, l);
+    break;
+  }
+
+  return true;
+}
+
+
+/*
+ * Initialize the search counters then simplify the clauses:
+ * preprocessing or level-0 propagation, SCC, failed-literal probing.
+ * - return false if the clauses are unsat
+ */
+static bool prepare_search(sat_solver_t *solver) {
   solver->prng = solver->params.seed;
   solver->cla_inc = INIT_CLAUSE_ACTIVITY_INCREMENT;
   solver->max_depth = 0;
@@ -11158,11 +11387,11 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
   if (solver->preprocess) {
     // preprocess + one round of simplification
     nsat_do_preprocess(solver);
-    if (solver->has_empty_clause) goto done;
+    if (solver->has_empty_clause) return false;
   } else {
     // one round of propagation + one round of simplification
     level0_propagation(solver);
-    if (solver->has_empty_clause) goto done;
+    if (solver->has_empty_clause) return false;
   }
 
   var_list_add_all(&solver->list, true);
@@ -11170,23 +11399,36 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
 
   nsat_simplify(solver);
   done_simplify(solver);
-  if (solver->has_empty_clause) goto done;
+  if (solver->has_empty_clause) return false;
 
   failed_literal_probing(solver);
-  if (solver->has_empty_clause) goto done;
+  if (solver->has_empty_clause) return false;
 
-  try_naive_search(solver);
+  return true;
+}
+
+/*
+ * Reset the counters before the main loop
+ */
+static void start_search(sat_solver_t *solver) {
   solver->stats.conflicts = 0;
   solver->stats.decisions = 0;
   solver->stats.starts = 1;
   solver->try_assignment = false;
   solver->try_naive_search = true;
+  solver->search_ready = true;
+}
 
-  report(solver, "");
 
-  /*
-   * MAIN LOOP
-   */
+/*
+ * Main loop
+ * - the first decisions are the assumptions (if any)
+ * - exit when the status is known or if the search is interrupted
+ *   (status = STAT_UNKNOWN in that case)
+ */
+static void nsat_search(sat_solver_t *solver) {
+  bvar_t x;
+
   for (;;) {
 
     nsat_boolean_propagation(solver);
@@ -11197,7 +11439,7 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
       // conflict
       if (solver->decision_level == 0) {
 	export_last_conflict(solver);
-	solver->status = STAT_UNSAT;
+	add_empty_clause(solver);
 	break;
       }
       resolve_conflict(solver);
@@ -11205,6 +11447,10 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
       if (! solver->stabilizing) {
 	decay_clause_activities(solver);
       }
+      if (search_stopped(solver)) {
+	solver->status = STAT_UNKNOWN;
+	break;
+      }
 
     } else {
       // no conflict
@@ -11224,6 +11470,9 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
 	nsat_reduce_learned_clause_set(solver);
 	done_reduce(solver);
 
+      } else if (solver->decision_level < solver->nassumptions) {
+	if (! decide_assumption(solver)) break;
+
       } else {
 	if (solver->try_assignment) {
 	  build_assignment(solver);
@@ -11238,11 +11487,29 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
       }
     }
   }
+}
+
+
+/*
+ * Solving procedure
+ */
+solver_status_t nsat_solve(sat_solver_t *solver) {
+  if (solver->has_empty_clause) goto done;
+
+  if (! prepare_search(solver)) goto done;
+
+  try_naive_search(solver);
+  start_search(solver);
+
+  report(solver, "");
+
+  nsat_search(solver);
 
   report(solver, "end");
 
  done:
-  assert(solver->status == STAT_UNSAT || solver->status == STAT_SAT);
+  assert(solver->status == STAT_UNSAT || solver->status == STAT_SAT ||
+	 (solver->status == STAT_UNKNOWN && solver->stop));
 
   if (solver->status == STAT_SAT) {
     extend_assignment(solver);
@@ -11256,6 +11523,41 @@ solver_status_t nsat_solve(sat_solver_t *solver) {
 }
 
 
+/*
+ * Solving under assumptions
+ */
+solver_status_t nsat_solve_with_assumptions(sat_solver_t *solver, uint32_t n, const literal_t *a) {
+  assert(! solver->preprocess);
+
+  solver->failed_prefix = 0;
+  if (solver->has_empty_clause) goto done;
+
+  if (solver->search_ready) {
+    // search from a previous call
+    if (solver->decision_level > 0) {
+      backtrack(solver, 0);
+    }
+    solver->status = STAT_UNKNOWN;
+  } else {
+    if (! prepare_search(solver)) goto done;
+    start_search(solver);
+  }
+
+  solver->assumptions = a;
+  solver->nassumptions = n;
+  nsat_search(solver);
+  solver->assumptions = NULL;
+  solver->nassumptions = 0;
+
+  if (solver->status == STAT_SAT) {
+    extend_assignment(solver);
+  }
+
+ done:
+  return solver->status;
+}
+
+
 
 
 /************************
@@ -11336,6 +11638,98 @@ uint32_t nsat_get_true_literals(const sat_solver_t *solver, literal_t *a) {
 
 
 
+/*
+ * Copy the clauses of src into dst
+ */
+void nsat_copy_problem(sat_solver_t *dst, const sat_solver_t *src) {
+  const clause_pool_t *pool;
+  const watch_t *w;
+  vector_t buffer;
+  uint32_t i, j, k, n;
+  cidx_t cidx;
+  literal_t a[2];
+
+  assert(src->decision_level == 0 && ! src->preprocess && ! dst->preprocess);
+
+  if (dst->nvars < src->nvars) {
+    nsat_solver_add_vars(dst, src->nvars - dst->nvars);
+  }
+
+  if (src->has_empty_clause) {
+    add_empty_clause(dst);
+    return;
+  }
+
+  // all literals assigned at level 0
+  n = src->stack.top;
+  for (i=0; i<n; i++) {
+    a[0] = src->stack.lit[i];
+    nsat_solver_simplify_and_add_clause(dst, 1, a);
+  }
+
+  // binary clauses in the watch vectors
+  n = src->nliterals;
+  for (i=2; i<n; i++) {
+    w = src->watch[i];
+    if (w != NULL) {
+      j = 0;
+      while (j < w->size) {
+	k = w->data[j];
+	if (idx_is_literal(k)) {
+	  if (i < idx2lit(k)) {
+	    a[0] = i;
+	    a[1] = idx2lit(k);
+	    nsat_solver_simplify_and_add_clause(dst, 2, a);
+	  }
+	  j ++;
+	} else {
+	  j += 2;
+	}
+      }
+    }
+  }
+
+  // problem clauses
+  init_vector(&buffer);
+  pool = &src->pool;
+  cidx = clause_pool_first_clause(pool);
+  while (cidx < pool->learned) {
+    n = clause_length(pool, cidx);
+    reset_vector(&buffer);
+    for (i=0; i<n; i++) {
+      vector_push(&buffer, clause_literals(pool, cidx)[i]);
+    }
+    nsat_solver_simplify_and_add_clause(dst, n, (literal_t *) buffer.data);
+    cidx = clause_pool_next_clause(pool, cidx);
+  }
+  delete_vector(&buffer);
+}
+
+
+/*
+ * Import the model of src
+ */
+void nsat_import_model(sat_solver_t *solver, const sat_solver_t *src) {
+  uint32_t i, n;
+  bval_t v;
+
+  assert(solver->decision_level == 0 && src->status == STAT_SAT && src->nvars >= solver->nvars);
+
+  n = solver->nvars;
+  for (i=1; i<n; i++) {
+    if (var_is_active(solver, i)) {
+      v = var_is_true(src, i) ? VAL_TRUE : VAL_FALSE;
+      solver->value[pos_lit(i)] = v;
+      solver->value[neg_lit(i)] = opposite_val(v);
+    }
+  }
+
+  solver->status = STAT_SAT;
+  extend_assignment(solver);
+}
+
+
+
 /*********************************
  *  EXPORT IN THE DIMACS FORMAT  *
  ********************************/
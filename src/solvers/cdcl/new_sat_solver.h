@@ -36,6 +36,7 @@
 
 #include "solvers/cdcl/smt_core_base_types.h"
 #include "solvers/cdcl/new_gates.h"
+#include "utils/int_vectors.h"
 #include "utils/tag_map.h"
 
 
@@ -952,6 +953,21 @@ typedef struct sat_solver_s {
   bool try_assignment;
   bool try_naive_search;
 
+  /*
+   * Search under assumptions (used by cube and conquer)
+   * - assumptions = array of nassumptions literals
+   * - failed_prefix = set when the search returns STAT_UNSAT:
+   *   the clauses are unsat under assumptions[0 ... failed_prefix-1]
+   *   (so failed_prefix = 0 means that the clauses are unsat)
+   * - search_ready = true once the search counters are initialized
+   * - stop = flag to interrupt the search (may be set by another thread)
+   */
+  const literal_t *assumptions;
+  uint32_t nassumptions;
+  uint32_t failed_prefix;
+  bool search_ready;
+  bool stop;
+
   /*
    * Statistics record
    */
@@ -1278,6 +1294,68 @@ static inline solver_status_t nsat_status(sat_solver_t *solver) {
 extern solver_status_t nsat_apply_preprocessing(sat_solver_t *solver);
 
 
+/*
+ * Check satisfiability under assumptions a[0 ... n-1]
+ * - the solver must not use preprocessing (i.e., pp must be false in init_nsat_solver)
+ * - this can be called several times with different assumptions.
+ *   Learned clauses are kept from one call to the next.
+ * - result = STAT_SAT or STAT_UNSAT, or STAT_UNKNOWN if the search was
+ *   interrupted by nsat_stop_search.
+ * - if the result is STAT_UNSAT, solver->failed_prefix is set.
+ * - if the result is STAT_SAT, the solver can't be used for another search.
+ */
+extern solver_status_t nsat_solve_with_assumptions(sat_solver_t *solver, uint32_t n, const literal_t *a);
+
+
+/*
+ * Interrupt the search: this can be called from another thread.
+ * - the flag remains set until it's cleared by nsat_clear_stop_flag
+ */
+static inline void nsat_stop_search(sat_solver_t *solver) {
+  __atomic_store_n(&solver->stop, true, __ATOMIC_RELAXED);
+}
+
+static inline void nsat_clear_stop_flag(sat_solver_t *solver) {
+  __atomic_store_n(&solver->stop, false, __ATOMIC_RELAXED);
+}
+
+
+/*
+ * Split the search space into cubes using lookahead
+ * - this must be called after nsat_apply_preprocessing, if it returned STAT_UNKNOWN.
+ * - depth = maximal number of branching variables per cube.
+ * - the cubes are stored in vector cubes: each cube is stored as its
+ *   length k followed by its k literals. Cubes are listed in depth-first
+ *   order so the cubes that share a prefix are contiguous.
+ * - a cube may also contain literals forced by failed-literal detection.
+ * - branches refuted by the lookahead are omitted. If all branches are
+ *   refuted, the empty clause is added to the solver.
+ * - return the number of cubes
+ */
+extern uint32_t nsat_lookahead_cubes(sat_solver_t *solver, uint32_t depth, ivector_t *cubes);
+
+
+/*
+ * Copy the problem clauses of src into dst
+ * - src must be at decision level 0 and not in preprocessing mode
+ * - dst must not use preprocessing
+ * - the variables of src are added to dst with the same indices.
+ *   The literals assigned at level 0 in src become unit clauses.
+ *   Learned clauses are not copied.
+ */
+extern void nsat_copy_problem(sat_solver_t *dst, const sat_solver_t *src);
+
+
+/*
+ * Import the model found by src
+ * - src must be a copy of solver (cf. nsat_copy_problem) and its status must be STAT_SAT
+ * - solver must be at decision level 0
+ * - this sets solver's status to STAT_SAT and extends the model to the
+ *   variables eliminated by solver's preprocessing
+ */
+extern void nsat_import_model(sat_solver_t *solver, const sat_solver_t *src);
+
+
 /********************
  * EXPORT TO DIMACS *
  *******************/
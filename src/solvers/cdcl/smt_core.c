@@ -227,10 +227,11 @@ static inline void delete_clause(clause_t *cl) {
  * Allocate and initialize a new learned clause
  * \param len = number of literals
  * \param lit = array of len literals
+ * \param lbd = the clause's LBD
  * The watched pointers are not initialized.
  * The activity is initialized to 0.0
  */
-static clause_t *new_learned_clause(uint32_t len, literal_t *lit) {
+static clause_t *new_learned_clause(uint32_t len, literal_t *lit, uint32_t lbd) {
   learned_clause_t *tmp;
   clause_t *result;
   uint32_t i;
@@ -238,6 +239,9 @@ static clause_t *new_learned_clause(uint32_t len, literal_t *lit) {
   tmp = (learned_clause_t *) safe_malloc(sizeof(learned_clause_t) + sizeof(literal_t) +
                                          len * sizeof(literal_t));
   tmp->activity = 0.0;
+  tmp->lbd = (lbd < MAX_CLAUSE_LBD) ? lbd : MAX_CLAUSE_LBD;
+  tmp->used = 0;
+  tmp->vivified = false;
   result = &(tmp->clause);
 
   for (i=0; i<len; i++) {
@@ -1290,6 +1294,14 @@ static void init_statistics(dpll_stats_t *stat) {
   stat->bin_clauses_deleted = 0;
   stat->literals_before_simpl = 0;
   stat->subsumed_literals = 0;
+  stat->inprocess_calls = 0;
+  stat->vivified_clauses = 0;
+  stat->vivified_literals = 0;
+  stat->subsumed_clauses = 0;
+  stat->lbd_updates = 0;
+  stat->chrono_backtracks = 0;
+  stat->chrono_saved = 0;
+  stat->chrono_reassigned = 0;
 }
 
 
@@ -1506,6 +1518,12 @@ void init_smt_core(smt_core_t *s, uint32_t n, void *th,
   s->aux_literals = 0;
   s->aux_clauses = 0;
 
+  s->inprocess_enabled = false;
+  s->inprocess_props = 0;
+  s->inprocess_threshold = INPROCESS_MIN_PROPS;
+
+  s->chrono_levels = 0;
+
   s->decision_level = 0;
   s->base_level = 0;
 
@@ -1529,6 +1547,7 @@ void init_smt_core(smt_core_t *s, uint32_t n, void *th,
   init_ivector(&s->buffer, DEF_LBUFFER_SIZE);
   init_ivector(&s->buffer2, DEF_LBUFFER_SIZE);
   init_ivector(&s->explanation, DEF_LBUFFER_SIZE);
+  init_tag_map(&s->lbd_map, 0);
 
   // assumptions
   s->has_assumptions = false;
@@ -1591,6 +1610,7 @@ void init_smt_core(smt_core_t *s, uint32_t n, void *th,
   // EXPERIMENTAL
   // s->etable = NULL;
   s->trace = NULL;
+  s->share = NULL;
 
   s->interrupt_push = false;
 }
@@ -1619,6 +1639,7 @@ void delete_smt_core(smt_core_t *s) {
   delete_ivector(&s->buffer);
   delete_ivector(&s->buffer2);
   delete_ivector(&s->explanation);
+  delete_tag_map(&s->lbd_map);
 
   // Delete all the clauses
   cl = s->problem_clauses;
@@ -1730,6 +1751,8 @@ void reset_smt_core(smt_core_t *s) {
   s->simplify_bottom = 0;
   s->simplify_props = 0;
   s->simplify_threshold = 0;
+  s->inprocess_props = 0;
+  s->inprocess_threshold = INPROCESS_MIN_PROPS;
   s->decision_level = 0;
   s->base_level = 0;
 
@@ -1825,6 +1848,15 @@ void smt_core_set_trace(smt_core_t *s, tracer_t *tracer) {
 }
 
 
+/*
+ * Attach/detach a clause-exchange port
+ */
+void smt_core_set_clause_port(smt_core_t *s, clause_port_t *p) {
+  assert(p == NULL || (s->status == STATUS_IDLE && s->base_level == 0));
+  s->share = p;
+}
+
+
 extern double avg_learned_clause_size(smt_core_t *core) {
   uint32_t num_clauses;
   double r;
@@ -2338,12 +2370,50 @@ static void increase_clause_activity(smt_core_t *s, clause_t *cl) {
  *  BACKTRACKING   *
  ******************/
 
+/*
+ * Undo the assignments in stack->lit[k ... top-1] but keep the
+ * out-of-order literals of level <= back_level.
+ * - the kept literals are moved down to stack->lit[k ...] (in the
+ *   same order) and return the new top of the stack
+ */
+static uint32_t backtrack_keep_out_of_order(smt_core_t *s, uint32_t back_level, uint32_t k) {
+  uint32_t i, j, n;
+  literal_t *u, l;
+  bvar_t x;
+
+  u = s->stack.lit;
+  n = s->stack.top;
+  j = k;
+  for (i=k; i<n; i++) {
+    l = u[i];
+    x = var_of(l);
+    assert(literal_value(s, l) == VAL_TRUE);
+    if (s->level[x] <= back_level) {
+      u[j] = l;
+      j ++;
+    } else {
+      s->value[x] &= 1;
+      heap_insert(&s->heap, x);
+    }
+  }
+
+  s->stats.chrono_reassigned += j - k;
+
+  return j;
+}
+
+
 /*
  * Backtrack core to decision level back_level
  * - undo all literal assignments of level >= back_level + 1
  * - requires decision_level > back_level >= base_level
  * Also clear conflict data and sets cp_flag if deletion of atoms is enabled
  *
+ * If chronological backtracking is enabled, the stack may contain
+ * out-of-order literals above level_index[back_level + 1]. They
+ * are kept and put back in the propagation queues: the theory solver
+ * must see them again after it backtracks to back_level.
+ *
  * NOTE: this function does not force the theory solver to backtrack.
  */
 static void backtrack(smt_core_t *s, uint32_t back_level) {
@@ -2360,23 +2430,29 @@ static void backtrack(smt_core_t *s, uint32_t back_level) {
 
   u = s->stack.lit;
   k = s->stack.level_index[back_level + 1];
-  i = s->stack.top;
-  while (i > k) {
-    i --;
-    l = u[i];
 
-    assert(literal_value(s, l) == VAL_TRUE);
-    assert(s->level[var_of(l)] > back_level);
+  if (s->chrono_levels > 0) {
+    s->stack.top = backtrack_keep_out_of_order(s, back_level, k);
+    i = k;
+  } else {
+    i = s->stack.top;
+    while (i > k) {
+      i --;
+      l = u[i];
 
-    // clear assignment of x, keep polarity bit
-    x = var_of(l);
-    s->value[x] &= 1;
-    heap_insert(&s->heap, x);
+      assert(literal_value(s, l) == VAL_TRUE);
+      assert(s->level[var_of(l)] > back_level);
 
-    assert(literal_value(s, l) == VAL_UNDEF_TRUE);
+      // clear assignment of x, keep polarity bit
+      x = var_of(l);
+      s->value[x] &= 1;
+      heap_insert(&s->heap, x);
+
+      assert(literal_value(s, l) == VAL_UNDEF_TRUE);
+    }
+    s->stack.top = i;
   }
 
-  s->stack.top = i;
   s->stack.prop_ptr = i;
   s->stack.theory_ptr = i;
   s->decision_level = back_level;
@@ -2872,6 +2948,57 @@ static inline uint32_t d_level(smt_core_t *s, literal_t l) {
  *  LEARNED CLAUSES  *
  ********************/
 
+/*
+ * LBD of a clause a[0 ... n-1] = number of distinct decision levels
+ * among its literals. This is used to assign learned clauses to tiers.
+ * - level[x] is not reset on backtracking so this works even if some
+ *   literals are not currently assigned (we get the level of their
+ *   last assignment)
+ */
+static uint32_t clause_lbd(smt_core_t *s, uint32_t n, const literal_t *a) {
+  tag_map_t *map;
+  uint32_t i, r;
+
+  map = &s->lbd_map;
+  for (i=0; i<n; i++) {
+    tag_map_write(map, d_level(s, a[i]), 1);
+  }
+  r = tag_map_size(map);
+  clear_tag_map(map);
+
+  return r;
+}
+
+
+/*
+ * Update the header of learned clause cl when it's used in conflict resolution:
+ * - increase its activity and mark it as used
+ * - if it's not in the core tier, recompute its LBD (all literals of
+ *   cl are assigned at this point). If the LBD is smaller than before,
+ *   the clause may move to a lower tier.
+ */
+static void bump_learned_clause(smt_core_t *s, clause_t *cl) {
+  learned_clause_t *lcl;
+  literal_t *a;
+  uint32_t n, lbd;
+
+  increase_clause_activity(s, cl);
+
+  lcl = learned(cl);
+  lcl->used = 1;
+  if (lcl->lbd > TIER_CORE_LBD) {
+    a = cl->cl;
+    n = 0;
+    while (a[n] >= 0) n ++;
+    lbd = clause_lbd(s, n, a);
+    if (lbd < lcl->lbd) {
+      lcl->lbd = lbd;
+      s->stats.lbd_updates ++;
+    }
+  }
+}
+
+
 /*
  * Auxiliary function: add { l1, l2} as a binary clause
  * - l1 and l2 must be distinct (and not complementary)
@@ -2899,6 +3026,60 @@ static void direct_binary_clause(smt_core_t *s, literal_t l1, literal_t l2) {
 }
 
 
+/*
+ * Export learned clause a[0 ... n-1] to the clause exchange
+ * - lbd = LBD of a[0 ... n-1]
+ * - the clause is exported if it's short enough, has low LBD, and
+ *   all its variables are shared
+ */
+static void export_learned_clause(smt_core_t *s, uint32_t n, literal_t *a, uint32_t lbd) {
+  clause_port_t *p;
+  uint32_t i;
+
+  p = s->share;
+  if (s->base_level > 0 || !clause_port_is_active(p) || !clause_port_accepts(p, n, lbd)) {
+    return;
+  }
+
+  for (i=0; i<n; i++) {
+    if (! clause_port_var_is_shared(p, var_of(a[i]))) return;
+  }
+
+  clause_port_export(p, n, a);
+}
+
+
+/*
+ * Backtrack after conflict resolution then assert the implied literal l0
+ * - a = antecedent for l0
+ * - k = assertion level: all other literals of the learned clause are
+ *   false at level <= k
+ * - normally, we backtrack to level k. If chronological backtracking is
+ *   enabled and this would undo more than s->chrono_levels levels, we
+ *   backtrack to decision_level - 1 instead and l0 is assigned out of order
+ *   at level k.
+ */
+static void backjump_and_imply(smt_core_t *s, literal_t l0, antecedent_t a, uint32_t k) {
+  prop_stack_t *stack;
+  uint32_t d;
+
+  assert(k < s->decision_level);
+
+  d = s->decision_level;
+  if (s->chrono_levels == 0 || k == s->base_level || d - k <= s->chrono_levels) {
+    backtrack_to_level(s, k);
+    implied_literal(s, l0, a);
+  } else {
+    stack = &s->stack;
+    s->stats.chrono_backtracks ++;
+    s->stats.chrono_saved += stack->level_index[d] - stack->level_index[k+1];
+    backtrack_to_level(s, d - 1);
+    implied_literal(s, l0, a);
+    s->level[var_of(l0)] = k;
+  }
+}
+
+
 /*
  * Add an array of literals a as a new learned clause, after conflict resolution.
  * - n must be at least 1
@@ -2910,7 +3091,7 @@ static void direct_binary_clause(smt_core_t *s, literal_t l1, literal_t l2) {
  */
 static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
   clause_t *cl;
-  uint32_t i, j, k, q;
+  uint32_t i, j, k, q, lbd;
   literal_t l0, l1;
 
 #if TRACE
@@ -2923,6 +3104,12 @@ static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
   fflush(stdout);
 #endif
 
+  // the LBD must be computed before backtracking
+  lbd = clause_lbd(s, n, a);
+  if (s->share != NULL) {
+    export_learned_clause(s, n, a, lbd);
+  }
+
   l0 = a[0];
 
   if (n == 1) {
@@ -2952,8 +3139,7 @@ static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
     assert(k < s->level[var_of(l0)]);
 
     direct_binary_clause(s, l0, l1);
-    backtrack_to_level(s, k);
-    implied_literal(s, l0, mk_literal_antecedent(l1));
+    backjump_and_imply(s, l0, mk_literal_antecedent(l1), k);
 
   } else {
 
@@ -2977,7 +3163,7 @@ static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
     l1 = a[j]; a[j] = a[1]; a[1] = l1;
 
     // create the new clause with l0 and l1 as watched literals
-    cl = new_learned_clause(n, a);
+    cl = new_learned_clause(n, a, lbd);
     add_clause_to_vector(&s->learned_clauses, cl);
     increase_clause_activity(s, cl);
 
@@ -2990,9 +3176,7 @@ static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
 
     // backtrack and assert l0
     assert(k < s->level[var_of(l0)]);
-    backtrack_to_level(s, k);
-
-    implied_literal(s, l0, mk_clause0_antecedent(cl));
+    backjump_and_imply(s, l0, mk_clause0_antecedent(cl), k);
   }
 }
 
@@ -3070,7 +3254,7 @@ static bool try_cache_theory_clause(smt_core_t *s, uint32_t n, literal_t *a) {
 #endif
 
     // create the new clause with l0 and l1 as watched literals
-    cl = new_learned_clause(n, a);
+    cl = new_learned_clause(n, a, clause_lbd(s, n, a));
     add_clause_to_vector(&s->learned_clauses, cl);
     increase_clause_activity(s, cl);
 
@@ -3478,7 +3662,8 @@ static void resolve_conflict(smt_core_t *s) {
   ivector_t *buffer;
 
   assert(s->inconsistent);
-  assert(s->theory_conflict || get_conflict_level(s, s->conflict) == s->decision_level);
+  assert(s->theory_conflict || s->chrono_levels > 0 ||
+         get_conflict_level(s, s->conflict) == s->decision_level);
   assert(s->base_level <= s->decision_level);
 
   s->stats.conflicts ++;
@@ -3488,16 +3673,18 @@ static void resolve_conflict(smt_core_t *s) {
 
   /*
    * adjust conflict_level and backtrack to that level if the conflict
-   * was reported by the theory solver.
+   * was reported by the theory solver. With chronological backtracking,
+   * a boolean conflict may also involve only out-of-order literals
+   * of lower levels.
    */
-  if (s->theory_conflict) {
+  if (s->theory_conflict || s->chrono_levels > 0) {
     conflict_level = get_conflict_level(s, c);
     assert(s->base_level <= conflict_level && conflict_level <= s->decision_level);
     backtrack_to_level(s, conflict_level);
     assert(s->decision_level == conflict_level);
 
     // Cache as a clause
-    if (s->th_cache_enabled) {
+    if (s->theory_conflict && s->th_cache_enabled) {
       try_cache_theory_conflict(s, s->th_conflict_size, c);
     }
   }
@@ -3538,9 +3725,10 @@ static void resolve_conflict(smt_core_t *s) {
 
   /*
    * If the conflict is a learned clause, increase its activity
+   * and update its LBD
    */
   if (l == end_learned) {
-    increase_clause_activity(s, s->false_clause);
+    bump_learned_clause(s, s->false_clause);
   }
 
   assert(unresolved > 0);
@@ -3549,6 +3737,8 @@ static void resolve_conflict(smt_core_t *s) {
    * Scan the assignment stack from top to bottom and process the
    * antecedent of all marked literals:
    * - all the literals processed have decision_level == conflict_level
+   * - out-of-order literals of lower levels are skipped (they may
+   *   be marked if they're in the learned clause)
    * - the code works if unresolved == 1 (which may happen for theory conflicts)
    */
   stack = s->stack.lit;
@@ -3556,8 +3746,8 @@ static void resolve_conflict(smt_core_t *s) {
   for (;;) {
     j --;
     b = stack[j];
-    assert(d_level(s, b) == conflict_level);
-    if (is_lit_marked(s, b)) {
+    assert(d_level(s, b) == conflict_level || (s->chrono_levels > 0 && d_level(s, b) < conflict_level));
+    if (d_level(s, b) == conflict_level && is_lit_marked(s, b)) {
       if (unresolved == 1) {
         // not b is the implied literal; we're done.
         buffer->data[0] = not(b);
@@ -3589,7 +3779,7 @@ static void resolve_conflict(smt_core_t *s) {
             l = *c;
           }
           if (l == end_learned) {
-            increase_clause_activity(s, cl);
+            bump_learned_clause(s, cl);
           }
           break;
 
@@ -4686,14 +4876,6 @@ static void quick_split(clause_t **a, uint32_t low, uint32_t high) {
 }
 
 
-/*
- * Apply this to a vector v of learned_clauses
- */
-static void reorder_clause_vector(clause_t **v) {
-  quick_split(v, 0, get_cv_size(v));
-}
-
-
 /*
  * Auxiliary function: follow clause list of l0
  * Remove all clauses marked for removal
@@ -4779,35 +4961,69 @@ static void delete_learned_clauses(smt_core_t *s) {
 
 
 /*
- * Delete half the learned clauses, minus the locked ones (Minisat style).
+ * Check whether learned clause cl must be kept by reduce_clause_database
+ * - clauses in the core tier are always kept
+ * - clauses in the mid tier are kept if they've been used since
+ *   the previous reduction
+ * - this resets the used flag
+ */
+static bool clause_is_in_kept_tier(clause_t *cl) {
+  learned_clause_t *lcl;
+  bool keep;
+
+  lcl = learned(cl);
+  keep = lcl->lbd <= TIER_CORE_LBD || (lcl->lbd <= TIER_MID_LBD && lcl->used);
+  lcl->used = 0;
+
+  return keep;
+}
+
+
+/*
+ * Reduce the learned clauses (tier-based):
+ * - the clauses to keep because of their tier are moved to the
+ *   start of the learned-clause vector: v[0 ... k-1]
+ * - then we delete half the clauses in v[k ... n-1], minus the
+ *   locked ones (Minisat style).
  * This is expensive: the function scans and reconstructs the
  * watched lists.
  */
 void reduce_clause_database(smt_core_t *s) {
-  uint32_t i, n;
-  clause_t **v;
+  uint32_t i, k, n, half;
+  clause_t **v, *aux;
   float act_threshold;
 
   v = s->learned_clauses;
   n = get_cv_size(v);
   if (n == 0) return;
 
-  // put the clauses with lowest activity in the upper
-  // half of the learned clause vector.
-  reorder_clause_vector(v);
+  k = 0;
+  for (i=0; i<n; i++) {
+    if (clause_is_in_kept_tier(v[i])) {
+      aux = v[k]; v[k] = v[i]; v[i] = aux;
+      k ++;
+    }
+  }
+
+  if (k < n) {
+    // put the local clauses with lowest activity in the upper
+    // half of v[k ... n-1]
+    quick_split(v, k, n);
 
-  act_threshold = s->cla_inc/n;
+    half = (k + n)/2;
+    act_threshold = s->cla_inc/(n - k);
 
-  // prepare for deletion: all non-locked clauses, with activity less
-  // than activity_threshold are marked for deletion.
-  for (i=0; i<n/2; i++) {
-    if (get_activity(v[i]) <= act_threshold && ! clause_is_locked(s, v[i])) {
-      mark_for_removal(v[i]);
+    // prepare for deletion: all non-locked clauses, with activity less
+    // than activity_threshold are marked for deletion.
+    for (i=k; i<half; i++) {
+      if (get_activity(v[i]) <= act_threshold && ! clause_is_locked(s, v[i])) {
+        mark_for_removal(v[i]);
+      }
     }
-  }
-  for (i = n/2; i<n; i++) {
-    if (! clause_is_locked(s, v[i])) {
-      mark_for_removal(v[i]);
+    for (i=half; i<n; i++) {
+      if (! clause_is_locked(s, v[i])) {
+        mark_for_removal(v[i]);
+      }
     }
   }
 
@@ -5210,6 +5426,490 @@ static void simplify_clause_database(smt_core_t *s) {
 
 
 
+/*******************************************
+ *  INPROCESSING OF THE LEARNED CLAUSES    *
+ ******************************************/
+
+/*
+ * Inprocessing is done periodically at base level 0, after the
+ * clause database has been simplified (so no clause contains a
+ * literal assigned at the base level). It includes two steps:
+ * - subsumption: learned clauses subsumed by another clause are removed
+ * - vivification: learned clauses are shortened by probing
+ * Both steps only touch learned clauses. Since learned clauses are
+ * implied by the problem clauses and theory lemmas, this does not
+ * change the set of models.
+ *
+ * We don't do bounded variable elimination. A Boolean variable without
+ * an atom may still be used by a theory solver (e.g., the bits of a
+ * bit-vector variable) and new clauses can be added on the fly.
+ */
+
+/*
+ * Add a[0 ... n-1] as a new learned clause at base level 0
+ * - lbd = LBD to store in the clause (this can't be computed here
+ *   since all literals are unassigned)
+ * - a is simplified first (so a is modified)
+ * - if a is reduced to a unit clause, the literal is assigned
+ *   at the base level but not propagated
+ * - if a is reduced to the empty clause, a conflict is recorded
+ * Return the new clause if a has more than two literals after
+ * simplification, NULL otherwise.
+ */
+static clause_t *add_base_learned_clause(smt_core_t *s, uint32_t n, literal_t *a, uint32_t lbd) {
+  clause_t *cl;
+
+  assert(s->decision_level == 0 && s->base_level == 0);
+
+  cl = NULL;
+  if (preprocess_clause(s, &n, a)) {
+    // all literals of a[0 ... n-1] are unassigned
+    if (n > 2) {
+      cl = new_learned_clause(n, a, (lbd < n) ? lbd : n);
+      add_clause_to_vector(&s->learned_clauses, cl);
+      increase_clause_activity(s, cl);
+      s->watch[a[0]] = cons(0, cl, s->watch[a[0]]);
+      s->watch[a[1]] = cons(1, cl, s->watch[a[1]]);
+      s->nb_clauses ++;
+      s->stats.learned_literals += n;
+    } else if (n == 2) {
+      direct_binary_clause(s, a[0], a[1]);
+    } else if (n == 1) {
+      assign_literal(s, a[0]);
+      s->nb_unit_clauses ++;
+    } else {
+      record_empty_conflict(s);
+    }
+  }
+
+  return cl;
+}
+
+
+/*
+ * Check whether cl is a learned clause. Also return its length in *len.
+ */
+static bool is_learned_clause(clause_t *cl, uint32_t *len) {
+  uint32_t n;
+
+  n = clause_length(cl);
+  *len = n;
+  return cl->cl[n] == end_learned;
+}
+
+
+/*
+ * SUBSUMPTION
+ *
+ * We sort the clauses by increasing length (counting sort), then we
+ * visit them in this order. Each clause of size <= INPROCESS_SUBSUME_SIZE
+ * is added to an index under one of its literals (the one with fewest
+ * indexed clauses). A learned clause D is subsumed if a clause C that
+ * was already indexed is included in D. Since C is indexed under a
+ * literal of C, it's enough to scan the index lists of D's literals.
+ * We also check whether D is subsumed by a binary clause.
+ *
+ * - the literals of D are marked in array mark (indexed by literals)
+ * - the work is bounded by budget (number of literals visited)
+ */
+
+/*
+ * Check whether all literals of cl are marked
+ * - *visits is incremented by the number of literals examined
+ */
+static bool clause_is_marked(clause_t *cl, const uint8_t *mark, uint64_t *visits) {
+  literal_t *a;
+
+  a = cl->cl;
+  while (*a >= 0 && mark[*a]) {
+    a ++;
+  }
+  *visits += (a - cl->cl) + 1;
+
+  return *a < 0;
+}
+
+/*
+ * Check whether the learned clause a[0 ... n-1] is subsumed by
+ * a binary clause or by an indexed clause.
+ * - head[l] = index of the first clause in l's list (-1 if the list is empty)
+ * - next[i] = successor of cand[i] in its list
+ */
+static bool clause_is_subsumed(smt_core_t *s, literal_t *a, uint32_t n, clause_t **cand,
+                               const int32_t *head, const int32_t *next,
+                               const uint8_t *mark, uint64_t *visits) {
+  uint32_t i;
+  int32_t j;
+  literal_t l, *b;
+
+  for (i=0; i<n; i++) {
+    l = a[i];
+    b = s->bin[l];
+    if (b != NULL) {
+      // b contains the literals l' such that (l \/ l') is a clause
+      while (*b >= 0) {
+        if (mark[*b]) return true;
+        b ++;
+      }
+      *visits += (b - s->bin[l]);
+    }
+
+    for (j = head[l]; j >= 0; j = next[j]) {
+      if (clause_is_marked(cand[j], mark, visits)) return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Remove the learned clauses that are subsumed
+ * - budget = bound on the number of literal visits
+ */
+static void subsume_learned_clauses(smt_core_t *s, uint64_t budget) {
+  uint32_t count[INPROCESS_SUBSUME_SIZE + 2];
+  clause_t **cand;
+  clause_t **v;
+  int32_t *head, *next;
+  uint32_t *occ;
+  uint8_t *mark;
+  uint64_t visits;
+  uint32_t i, j, k, n, len, total, subsumed;
+  literal_t l, best;
+
+  assert(s->decision_level == 0 && s->base_level == 0);
+
+  /*
+   * Counting sort: clauses of length k <= INPROCESS_SUBSUME_SIZE go into
+   * bucket k. Longer learned clauses go into the last bucket.
+   * Long problem clauses are ignored: they are neither indexed nor
+   * candidates for removal.
+   */
+  for (k=0; k<INPROCESS_SUBSUME_SIZE+2; k++) {
+    count[k] = 0;
+  }
+
+  v = s->problem_clauses;
+  n = get_cv_size(v);
+  for (i=0; i<n; i++) {
+    len = clause_length(v[i]);
+    if (len <= INPROCESS_SUBSUME_SIZE) count[len] ++;
+  }
+  v = s->learned_clauses;
+  n = get_cv_size(v);
+  for (i=0; i<n; i++) {
+    len = clause_length(v[i]);
+    if (len > INPROCESS_SUBSUME_SIZE) len = INPROCESS_SUBSUME_SIZE + 1;
+    count[len] ++;
+  }
+
+  // count[k] := start of bucket k
+  total = 0;
+  for (k=0; k<INPROCESS_SUBSUME_SIZE+2; k++) {
+    n = count[k];
+    count[k] = total;
+    total += n;
+  }
+
+  if (total == 0) return;
+
+  cand = (clause_t **) safe_malloc(total * sizeof(clause_t *));
+  v = s->problem_clauses;
+  n = get_cv_size(v);
+  for (i=0; i<n; i++) {
+    len = clause_length(v[i]);
+    if (len <= INPROCESS_SUBSUME_SIZE) {
+      cand[count[len]] = v[i];
+      count[len] ++;
+    }
+  }
+  v = s->learned_clauses;
+  n = get_cv_size(v);
+  for (i=0; i<n; i++) {
+    len = clause_length(v[i]);
+    if (len > INPROCESS_SUBSUME_SIZE) len = INPROCESS_SUBSUME_SIZE + 1;
+    cand[count[len]] = v[i];
+    count[len] ++;
+  }
+
+  n = s->nlits;
+  head = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  occ = (uint32_t *) safe_malloc(n * sizeof(uint32_t));
+  mark = (uint8_t *) safe_malloc(n * sizeof(uint8_t));
+  next = (int32_t *) safe_malloc(total * sizeof(int32_t));
+  for (i=0; i<n; i++) {
+    head[i] = -1;
+    occ[i] = 0;
+    mark[i] = 0;
+  }
+
+  visits = 0;
+  subsumed = 0;
+  for (i=0; i<total && visits <= budget; i++) {
+    assert(! is_clause_to_be_removed(cand[i]));
+
+    if (is_learned_clause(cand[i], &len) && ! clause_is_locked(s, cand[i])) {
+      for (j=0; j<len; j++) {
+        mark[cand[i]->cl[j]] = 1;
+      }
+      if (clause_is_subsumed(s, cand[i]->cl, len, cand, head, next, mark, &visits)) {
+        for (j=0; j<len; j++) {
+          mark[cand[i]->cl[j]] = 0;
+        }
+        mark_for_removal(cand[i]);
+        subsumed ++;
+        continue;
+      }
+      for (j=0; j<len; j++) {
+        mark[cand[i]->cl[j]] = 0;
+      }
+    }
+
+    if (len <= INPROCESS_SUBSUME_SIZE) {
+      // index cand[i] under its literal with fewest occurrences
+      best = cand[i]->cl[0];
+      for (j=1; j<len; j++) {
+        l = cand[i]->cl[j];
+        if (occ[l] < occ[best]) best = l;
+      }
+      next[i] = head[best];
+      head[best] = i;
+      occ[best] ++;
+    }
+  }
+
+  safe_free(next);
+  safe_free(mark);
+  safe_free(occ);
+  safe_free(head);
+  safe_free(cand);
+
+  if (subsumed > 0) {
+    delete_learned_clauses(s);
+    s->stats.subsumed_clauses += subsumed;
+  }
+}
+
+
+/*
+ * VIVIFICATION
+ *
+ * Given a learned clause cl = (l_1 \/ ... \/ l_n), we assign l_1, ..., l_n
+ * to false one by one, with Boolean propagation after each assignment.
+ * - if l_i is false before it's assigned, it can be removed from cl
+ * - if l_i is true before it's assigned, then (l_1 \/ ... \/ l_i) is implied
+ *   (minus the removed literals)
+ * - if propagation causes a conflict after l_i is assigned, then
+ *   (l_1 \/ ... \/ l_i) is implied too
+ * The probe assignments are made at decision level 1 and they are
+ * undone before we move to the next clause. The theory solver is not
+ * notified.
+ */
+
+/*
+ * Start a probe: move to decision level 1
+ */
+static void vivify_start_probe(smt_core_t *s) {
+  assert(s->decision_level == 0 && s->base_level == 0 && s->stack.prop_ptr == s->stack.top);
+
+  s->decision_level = 1;
+  if (s->stack.nlevels <= 1) {
+    increase_stack_levels(&s->stack);
+  }
+  s->stack.level_index[1] = s->stack.top;
+}
+
+/*
+ * Assign literal l at level 1
+ */
+static void vivify_assign(smt_core_t *s, literal_t l) {
+  bvar_t v;
+
+  assert(s->decision_level == 1 && literal_is_unassigned(s, l));
+
+  push_literal(&s->stack, l);
+  v = var_of(l);
+  s->value[v] = (VAL_TRUE ^ sign_of_lit(l));
+  s->level[v] = 1;
+  s->antecedent[v] = mk_literal_antecedent(null_literal);
+}
+
+/*
+ * Undo the probe assignments and clear the conflict if any
+ * - saved = copy of the value array before the probe: we use it
+ *   to restore the cached polarities
+ */
+static void vivify_end_probe(smt_core_t *s, const uint8_t *saved) {
+  uint32_t i, k;
+  bvar_t x;
+
+  assert(s->decision_level == 1);
+
+  k = s->stack.level_index[1];
+  i = s->stack.top;
+  while (i > k) {
+    i --;
+    x = var_of(s->stack.lit[i]);
+    s->value[x] = saved[x];
+    heap_insert(&s->heap, x);
+  }
+  s->stack.top = k;
+  s->stack.prop_ptr = k;
+  s->decision_level = 0;
+
+  s->inconsistent = false;
+  s->conflict = NULL;
+  s->false_clause = NULL;
+}
+
+/*
+ * Vivify clause cl: store the shortened clause in vector v
+ * - the literals of cl are copied into vector aux first
+ *   (propagation may reorder the literals of cl)
+ * - return true if the result is shorter than cl
+ */
+static bool vivify_clause(smt_core_t *s, clause_t *cl, ivector_t *v, ivector_t *aux, const uint8_t *saved) {
+  uint32_t i, n;
+  literal_t l;
+
+  ivector_reset(v);
+  ivector_reset(aux);
+  n = clause_length(cl);
+  ivector_add(aux, cl->cl, n);
+
+  vivify_start_probe(s);
+  for (i=0; i<n; i++) {
+    l = aux->data[i];
+    switch (literal_value(s, l)) {
+    case VAL_FALSE:
+      break;
+
+    case VAL_TRUE:
+      ivector_push(v, l);
+      goto done;
+
+    case VAL_UNDEF_FALSE:
+    case VAL_UNDEF_TRUE:
+      ivector_push(v, l);
+      vivify_assign(s, not(l));
+      if (! boolean_propagation(s)) goto done;
+      break;
+    }
+  }
+
+ done:
+  vivify_end_probe(s, saved);
+
+  return v->size < n;
+}
+
+
+/*
+ * Vivify the learned clauses that have not been vivified before
+ * - stop when the number of propagations reaches budget
+ */
+static void vivify_learned_clauses(smt_core_t *s, uint64_t budget) {
+  ivector_t removed, shortened;
+  ivector_t *v;
+  clause_t **lc, *cl;
+  uint8_t *saved;
+  uint64_t props;
+  uint32_t i, j, n;
+
+  assert(s->decision_level == 0 && s->base_level == 0);
+
+  lc = s->learned_clauses;
+  n = get_cv_size(lc);
+  if (n == 0) return;
+
+  saved = (uint8_t *) safe_malloc(s->nvars * sizeof(uint8_t));
+  for (i=0; i<s->nvars; i++) {
+    saved[i] = s->value[i];
+  }
+
+  /*
+   * removed = indices of the clauses to replace
+   * shortened = the new clauses (each stored as its size, then its LBD,
+   *   then its literals)
+   * probe propagations are not counted in the statistics
+   */
+  init_ivector(&removed, 0);
+  init_ivector(&shortened, 0);
+  v = &s->buffer2;
+  assert(v->size == 0);
+  props = s->stats.propagations;
+
+  for (i=0; i<n && s->stats.propagations - props < budget; i++) {
+    if (! learned(lc[i])->vivified && ! clause_is_locked(s, lc[i])) {
+      learned(lc[i])->vivified = true;
+      if (vivify_clause(s, lc[i], v, &s->buffer, saved)) {
+        s->stats.vivified_clauses ++;
+        s->stats.vivified_literals += clause_length(lc[i]) - v->size;
+        ivector_push(&removed, i);
+        ivector_push(&shortened, v->size);
+        ivector_push(&shortened, learned(lc[i])->lbd);
+        ivector_add(&shortened, v->data, v->size);
+      }
+    }
+  }
+  ivector_reset(v);
+  ivector_reset(&s->buffer);
+  s->stats.propagations = props;
+  safe_free(saved);
+
+  if (removed.size > 0) {
+    for (i=0; i<removed.size; i++) {
+      mark_for_removal(lc[removed.data[i]]);
+    }
+    delete_learned_clauses(s);
+
+    i = 0;
+    while (i < shortened.size && ! s->inconsistent) {
+      n = shortened.data[i];
+      j = i + 2;
+      cl = add_base_learned_clause(s, n, shortened.data + j, shortened.data[i+1]);
+      if (cl != NULL) {
+        learned(cl)->vivified = true;
+      }
+      i = j + n;
+    }
+  }
+
+  delete_ivector(&removed);
+  delete_ivector(&shortened);
+}
+
+
+/*
+ * Inprocessing pass
+ * - this must be called at base level 0 after simplify_clause_database
+ * - it may add unit clauses (not propagated) or record a conflict
+ */
+static void inprocess_clause_database(smt_core_t *s) {
+  uint64_t props, literals;
+
+  assert(s->decision_level == 0 && s->base_level == 0 && s->simplify_bottom == s->stack.top);
+
+  props = s->stats.propagations - s->inprocess_props;
+  literals = s->stats.learned_literals + s->stats.prob_literals + 2 * s->nb_bin_clauses;
+
+  subsume_learned_clauses(s, INPROCESS_SUBSUME_EFFORT * literals);
+  vivify_learned_clauses(s, (uint64_t) (INPROCESS_VIVIFY_EFFORT * props));
+
+  s->stats.inprocess_calls ++;
+
+  /*
+   * Next pass: after INPROCESS_RATIO * the number of literals propagations
+   */
+  s->inprocess_props = s->stats.propagations;
+  s->inprocess_threshold = INPROCESS_RATIO * literals;
+  if (s->inprocess_threshold < INPROCESS_MIN_PROPS) {
+    s->inprocess_threshold = INPROCESS_MIN_PROPS;
+  }
+}
+
+
+
 
 /**************
  *  PUSH/POP  *
@@ -6060,6 +6760,14 @@ void start_search(smt_core_t *s, uint32_t n, const literal_t *a) {
    */
   s->th_ctrl.start_search(s->th_solver);
 
+  /*
+   * Theory solvers may create variables in start_search (e.g., bit-blasting)
+   * so we register the number of variables with the clause exchange here.
+   */
+  if (s->share != NULL) {
+    clause_port_register(s->share, s->nvars);
+  }
+
 #if DEBUG
   check_heap_content(s);
   check_heap(s);
@@ -6138,6 +6846,21 @@ static bool smt_core_process(smt_core_t *s, uint64_t max_conflicts) {
     simplify_clause_database(s);
   }
 
+  // inprocessing: the database must be simplified first
+  if (s->inprocess_enabled &&
+      s->status == STATUS_SEARCHING &&
+      s->decision_level == 0 && s->base_level == 0 &&
+      s->stats.propagations >= s->inprocess_props + s->inprocess_threshold) {
+    if (s->stack.top > s->simplify_bottom) {
+      simplify_clause_database(s);
+    }
+    inprocess_clause_database(s);
+    if (s->inconsistent || s->stack.prop_ptr < s->stack.top) {
+      // new unit clauses or empty clause
+      return smt_core_process(s, max_conflicts);
+    }
+  }
+
   return true;
 }
 
@@ -6291,8 +7014,8 @@ static bool level_has_lower_activity(smt_core_t *s, double ax, uint32_t k) {
 
   while (i < n) {
     x = var_of(stack->lit[i]);
-    assert(bvar_is_assigned(s, x) && s->level[x] == k);
-    if (s->heap.activity[x] >= ax) {
+    assert(bvar_is_assigned(s, x) && (s->level[x] == k || (s->chrono_levels > 0 && s->level[x] < k)));
+    if (s->level[x] == k && s->heap.activity[x] >= ax) {
       return false;
     }
     i ++;
@@ -6327,9 +7050,37 @@ static void partial_restart(smt_core_t *s, uint32_t k) {
 }
 
 
+/*
+ * Import the clauses exported by other solvers
+ * - this must be called at decision level 0
+ * - the clauses are simplified then added as learned clauses
+ *   (their LBD is not known so we use their length)
+ * - stop if a conflict is found
+ */
+static void import_shared_clauses(smt_core_t *s) {
+  clause_port_t *p;
+  ivector_t *v;
+
+  assert(s->decision_level == 0 && s->base_level == 0);
+
+  p = s->share;
+  if (! clause_port_is_active(p)) return;
+
+  v = &s->buffer2;
+  assert(v->size == 0);
+
+  while (! s->inconsistent && clause_port_import(p, v)) {
+    (void) add_base_learned_clause(s, v->size, v->data, v->size);
+  }
+
+  ivector_reset(v);
+}
+
+
 /*
  * Full restart: cause s and the theory solver to backtrack to base_level
  * (do nothing if decision_level == base_level)
+ * - if a clause-exchange port is attached, import the shared clauses
  */
 void smt_restart(smt_core_t *s) {
 
@@ -6342,6 +7093,9 @@ void smt_restart(smt_core_t *s) {
   if (s->base_level < s->decision_level) {
     full_restart(s);
   }
+  if (s->share != NULL && s->base_level == 0 && s->status == STATUS_SEARCHING) {
+    import_shared_clauses(s);
+  }
 }
 
 
@@ -6704,6 +7458,186 @@ void collect_free_bool_vars(free_bool_vars_t *fv, const smt_core_t *s) {
 
 
 
+/***************
+ *  SNAPSHOTS  *
+ **************/
+
+/*
+ * Layout of the snapshot (all 32bit words):
+ * - number of variables, inconsistent flag
+ * - n, then n unit literals (the literals assigned at level 0)
+ * - n, then n binary clauses (two literals each)
+ * - n, then n clauses: length followed by the literals
+ * - n, then n gates: tag followed by the input and output literals
+ */
+void smt_core_snapshot(smt_core_t *s, ivector_t *v) {
+  clause_t **cv;
+  clause_t *c;
+  literal_t *bin;
+  boolgate_t *g;
+  literal_t l1, l2;
+  uint32_t i, n, k, count, scan_index;
+
+  assert(s->base_level == 0 && s->decision_level == 0);
+
+  ivector_push(v, s->nvars);
+  ivector_push(v, s->inconsistent);
+
+  // units
+  k = v->size;
+  ivector_push(v, 0);
+  count = 0;
+  n = s->stack.top;
+  for (i=0; i<n; i++) {
+    l1 = s->stack.lit[i];
+    if (var_of(l1) != const_bvar) {
+      ivector_push(v, l1);
+      count ++;
+    }
+  }
+  v->data[k] = count;
+
+  // binary clauses
+  k = v->size;
+  ivector_push(v, 0);
+  count = 0;
+  n = s->nlits;
+  for (l1=0; l1<n; l1++) {
+    bin = s->bin[l1];
+    if (bin != NULL) {
+      for (;;) {
+        l2 = *bin ++;
+        if (l2 < 0) break;
+        if (l1 <= l2) {
+          ivector_push(v, l1);
+          ivector_push(v, l2);
+          count ++;
+        }
+      }
+    }
+  }
+  v->data[k] = count;
+
+  // problem clauses
+  cv = s->problem_clauses;
+  n = get_cv_size(cv);
+  ivector_push(v, n);
+  for (i=0; i<n; i++) {
+    c = cv[i];
+    k = v->size;
+    ivector_push(v, 0);
+    for (count=0; c->cl[count] >= 0; count++) {
+      ivector_push(v, c->cl[count]);
+    }
+    v->data[k] = count;
+  }
+
+  // gates
+  k = v->size;
+  ivector_push(v, 0);
+  count = 0;
+  scan_index = 0;
+  g = gate_table_next(&s->gates, &scan_index);
+  while (g != NULL) {
+    n = tag_indegree(g->tag) + tag_outdegree(g->tag);
+    ivector_push(v, g->tag);
+    ivector_add(v, g->lit, n);
+    count ++;
+    g = gate_table_next(&s->gates, &scan_index);
+  }
+  v->data[k] = count;
+}
+
+
+/*
+ * Check that a[0 ... n-1] are literals of s
+ */
+static bool good_snapshot_literals(smt_core_t *s, const int32_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] < 0 || a[i] >= s->nlits) return false;
+  }
+  return true;
+}
+
+bool smt_core_restore_snapshot(smt_core_t *s, const int32_t *a, uint32_t n) {
+  boolgate_t *g;
+  const int32_t *units;
+  uint32_t i, j, k, nunits, len, tag, deg;
+  bool inconsistent;
+
+  assert(s->base_level == 0 && s->decision_level == 0 && num_prob_clauses(s) == 0);
+
+  if (n < 3 || a[0] < s->nvars || a[0] > MAX_ATOM_TABLE_SIZE) return false;
+  add_boolean_variables(s, a[0] - s->nvars);
+  inconsistent = (a[1] != 0);
+
+  // the units are added after the clauses
+  nunits = a[2];
+  if (nunits > n - 3) return false;
+  units = a + 3;
+  if (! good_snapshot_literals(s, units, nunits)) return false;
+  k = 3 + nunits;
+
+  // binary clauses
+  if (k >= n || a[k] > (n - k - 1)/2) return false;
+  len = 2 * a[k];
+  k ++;
+  if (! good_snapshot_literals(s, a + k, len)) return false;
+  for (i=0; i<len; i += 2) {
+    add_binary_clause(s, a[k+i], a[k+i+1]);
+  }
+  k += len;
+
+  // problem clauses
+  if (k >= n) return false;
+  j = a[k];
+  k ++;
+  while (j > 0) {
+    if (k >= n || a[k] > n - k - 1) return false;
+    len = a[k];
+    k ++;
+    if (! good_snapshot_literals(s, a + k, len)) return false;
+    add_clause(s, len, (literal_t *) (a + k));
+    k += len;
+    j --;
+  }
+
+  for (i=0; i<nunits; i++) {
+    add_unit_clause(s, units[i]);
+  }
+
+  // gates
+  if (k >= n) return false;
+  j = a[k];
+  k ++;
+  while (j > 0) {
+    if (k >= n) return false;
+    tag = a[k];
+    deg = tag_indegree(tag) + tag_outdegree(tag);
+    if (tag_combinator(tag) > FULLADD_GATE || tag_indegree(tag) == 0 || deg > n - k - 1 ||
+        ! good_snapshot_literals(s, a + k + 1, deg)) {
+      return false;
+    }
+    g = gate_table_get(&s->gates, tag, (literal_t *) (a + k + 1));
+    for (i=tag_indegree(tag); i<deg; i++) {
+      g->lit[i] = a[k + 1 + i];
+    }
+    k += deg + 1;
+    j --;
+  }
+
+  if (inconsistent) {
+    add_empty_clause(s);
+  }
+
+  return k == n;
+}
+
+
+
+
 /*************************
  *  DEBUGGING FUNCTIONS  *
  ************************/
@@ -54,10 +54,12 @@
 #include <stddef.h>
 
 #include "io/tracer.h"
+#include "solvers/cdcl/clause_exchange.h"
 #include "solvers/cdcl/smt_core_base_types.h"
 #include "solvers/cdcl/gates_hash_table.h"
 #include "utils/bitvectors.h"
 #include "utils/int_vectors.h"
+#include "utils/tag_map.h"
 
 #include "yices_types.h"
 
@@ -116,11 +118,25 @@ struct clause_s {
   literal_t cl[0];
 };
 
+/*
+ * Learned clauses have a header:
+ * - activity = used for deletion of clauses in the local tier
+ * - lbd = literal block distance (number of distinct decision levels
+ *   in the clause), computed when the clause is learned and updated
+ *   when it's used in conflict resolution
+ * - used = set when the clause is used in conflict resolution
+ *   (reset by reduce_clause_database)
+ */
 typedef struct learned_clause_s {
   float activity;
+  uint16_t lbd;
+  uint8_t used;
+  bool vivified;     // set once the clause has been vivified (see smt_core.c)
   clause_t clause;
 } learned_clause_t;
 
+#define MAX_CLAUSE_LBD UINT16_MAX
+
 
 /*
  * Tagging/untagging of link pointers
@@ -263,6 +279,9 @@ static inline uint32_t get_lv_capacity(literal_t *v) {
  * - for each decision level, an index into the stack points
  *   to the literal decided or assigned at that level (for backtracking)
  * - for level 0, level_index[0] = 0 = index of the first literal assigned
+ * - with chronological backtracking, a literal of level k may be stored
+ *   after level_index[k+1] (out-of-order literal). Literals that have the
+ *   same level are still stored in assignment order.
  */
 typedef struct {
   literal_t *lit;
@@ -800,6 +819,17 @@ typedef struct dpll_stats_s {
 
   uint64_t literals_before_simpl;
   uint64_t subsumed_literals;
+
+  uint32_t inprocess_calls;          // number of inprocessing passes
+  uint64_t vivified_clauses;         // number of learned clauses shortened by vivification
+  uint64_t vivified_literals;        // number of literals removed by vivification
+  uint64_t subsumed_clauses;         // number of learned clauses removed by subsumption
+
+  uint64_t lbd_updates;              // number of learned clauses whose LBD decreased
+
+  uint64_t chrono_backtracks;        // number of conflicts resolved by chronological backtracking
+  uint64_t chrono_saved;             // number of trail literals not undone thanks to it
+  uint64_t chrono_reassigned;        // out-of-order literals kept on backtrack (sent again to the theory)
 } dpll_stats_t;
 
 
@@ -971,6 +1001,19 @@ typedef struct smt_core_s {
   uint64_t aux_literals;       // temporary counter used by simplify_clause
   uint32_t aux_clauses;        // temporary counter used by simplify_clause
 
+  /* Inprocessing of the learned clauses (disabled by default) */
+  bool inprocess_enabled;
+  uint64_t inprocess_props;     // value of the propagation counter after the last pass
+  uint64_t inprocess_threshold; // number of propagations before the next pass
+
+  /*
+   * Chronological backtracking (disabled if chrono_levels is 0):
+   * if conflict resolution would backjump more than chrono_levels
+   * levels, we backtrack one level only and the implied literal is
+   * assigned out of order (at its real level).
+   */
+  uint32_t chrono_levels;
+
   /* Current decision level */
   uint32_t decision_level;
   uint32_t base_level;         // Incremented on push/decremented on pop
@@ -1006,6 +1049,9 @@ typedef struct smt_core_s {
   ivector_t buffer;
   ivector_t buffer2;
 
+  /* Map used to compute the LBD of clauses (indexed by decision levels) */
+  tag_map_t lbd_map;
+
   /* Buffer for expanding theory explanations */
   ivector_t explanation;
 
@@ -1056,6 +1102,9 @@ typedef struct smt_core_s {
   /* Tracer object (default to NULL) */
   tracer_t *trace;
 
+  /* Port for exchanging clauses with parallel solvers (default to NULL) */
+  clause_port_t *share;
+
   bool interrupt_push;
 } smt_core_t;
 
@@ -1096,6 +1145,37 @@ typedef struct smt_core_s {
 #define TAIL_RELEVANCE 45
 
 
+/*
+ * Tiers of learned clauses (for reduce_clause_database):
+ * - core tier: clauses of LBD <= TIER_CORE_LBD are never deleted
+ * - mid tier: clauses of LBD <= TIER_MID_LBD are kept as long as they
+ *   are used in conflict resolution between two reductions
+ * - local tier: all other clauses (and unused mid-tier clauses)
+ *   are deleted based on activity
+ */
+#define TIER_CORE_LBD 2
+#define TIER_MID_LBD  6
+
+
+/*
+ * Inprocessing parameters:
+ * - a pass is run from simplify_clause_database (at base level 0) when
+ *   the number of propagations since the previous pass exceeds
+ *   INPROCESS_RATIO * the number of literals in the database
+ *   (and at least INPROCESS_MIN_PROPS)
+ * - vivification is bounded: it can use at most INPROCESS_VIVIFY_EFFORT
+ *   * the number of propagations since the previous pass
+ * - subsumption uses clauses of size <= INPROCESS_SUBSUME_SIZE to
+ *   subsume learned clauses. The number of literal visits is bounded by
+ *   INPROCESS_SUBSUME_EFFORT * the number of literals in the database
+ */
+#define INPROCESS_RATIO          10
+#define INPROCESS_MIN_PROPS      100000
+#define INPROCESS_VIVIFY_EFFORT  0.1
+#define INPROCESS_SUBSUME_SIZE   20
+#define INPROCESS_SUBSUME_EFFORT 10
+
+
 /*
  * Default random_factor = 2% of decisions are random (more or less)
  * - the heuristic generates a random 24 bit integer
@@ -1170,6 +1250,16 @@ extern void reset_smt_core(smt_core_t *s);
 extern void smt_core_set_trace(smt_core_t *s, tracer_t *tracer);
 
 
+/*
+ * Attach or detach a clause-exchange port (p = NULL to detach)
+ * - if a port is attached, short learned clauses are exported to
+ *   the exchange and clauses learned by other solvers are imported
+ *   on every restart.
+ * - a port can be attached only if s's status is IDLE and its base level is 0
+ */
+extern void smt_core_set_clause_port(smt_core_t *s, clause_port_t *p);
+
+
 /*
  * EXPERIMENTAL: create the etable
  */
@@ -1246,6 +1336,35 @@ static inline void disable_theory_cache(smt_core_t *s) {
 }
 
 
+/*
+ * Enable/disable inprocessing: vivification and subsumption of the
+ * learned clauses, done periodically at base level 0 on the same
+ * schedule as simplify_clause_database.
+ */
+static inline void enable_inprocessing(smt_core_t *s) {
+  s->inprocess_enabled = true;
+}
+
+static inline void disable_inprocessing(smt_core_t *s) {
+  s->inprocess_enabled = false;
+}
+
+
+/*
+ * Enable/disable chronological backtracking
+ * - levels = threshold: chronological backtracking is used when
+ *   a conflict would cause a backjump of more than levels levels
+ * - levels = 0 disables it
+ */
+static inline void enable_chrono_backtracking(smt_core_t *s, uint32_t levels) {
+  s->chrono_levels = levels;
+}
+
+static inline void disable_chrono_backtracking(smt_core_t *s) {
+  s->chrono_levels = 0;
+}
+
+
 /*
  * Read the current decision level
  */
@@ -1303,6 +1422,10 @@ static inline uint32_t num_remove_calls(smt_core_t *s) {
   return s->stats.remove_calls;
 }
 
+static inline uint32_t num_inprocess_calls(smt_core_t *s) {
+  return s->stats.inprocess_calls;
+}
+
 static inline uint64_t num_decisions(smt_core_t *s) {
   return s->stats.decisions;
 }
@@ -1634,6 +1757,14 @@ extern void add_ternary_clause(smt_core_t *s, literal_t l1, literal_t l2, litera
 
 extern void add_clause(smt_core_t *s, uint32_t n, literal_t *a);
 
+/*
+ * Check whether lemmas added on the fly are waiting in the lemma queue
+ * (they are added to the clause database after theory propagation).
+ */
+static inline bool smt_core_has_pending_lemmas(smt_core_t *s) {
+  return s->lemmas.free_block > 0;
+}
+
 
 /*********************************
  *  QUANTIFIER INSTANCE CLAUSES  *
@@ -1765,8 +1896,12 @@ extern void smt_partial_restart_var(smt_core_t *s);
 
 
 /*
- * Reduce the clause database by removing half the learned clauses
- * (the ones with lowest activities)
+ * Reduce the clause database:
+ * - learned clauses in the core tier are kept
+ * - learned clauses in the mid tier are kept if they were used
+ *   since the previous reduction
+ * - of the remaining clauses, we remove half (the ones with
+ *   lowest activities)
  */
 extern void reduce_clause_database(smt_core_t *s);
 
@@ -2058,4 +2193,27 @@ extern void delete_free_bool_vars(free_bool_vars_t *fv);
 extern void collect_free_bool_vars(free_bool_vars_t *fv, const smt_core_t *s);
 
 
+/***************
+ *  SNAPSHOTS  *
+ **************/
+
+/*
+ * Store the base-level state of s in v: number of variables, unit
+ * literals, binary and problem clauses, and the gate table. The
+ * learned clauses are not stored.
+ * - s must be at base level 0 and not searching
+ */
+extern void smt_core_snapshot(smt_core_t *s, ivector_t *v);
+
+/*
+ * Restore a snapshot stored by smt_core_snapshot in a[0 ... n-1]
+ * - s must be at base level 0 and have no clauses
+ * - new variables are added so that s has as many variables as the
+ *   core that was saved (s must not have more)
+ * - return false if a is not a valid snapshot (s may be partially
+ *   restored in this case)
+ */
+extern bool smt_core_restore_snapshot(smt_core_t *s, const int32_t *a, uint32_t n);
+
+
 #endif /* __SMT_CORE_H */
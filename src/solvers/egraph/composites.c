@@ -22,6 +22,8 @@
 #include <stddef.h>
 
 #include "solvers/egraph/composites.h"
+#include "utils/bit_tricks.h"
+#include "utils/hash_ctrl_bytes.h"
 #include "utils/int_array_sort.h"
 #include "utils/memalloc.h"
 
@@ -1170,12 +1172,12 @@ static bool is_power_of_two(uint32_t n) {
  * - n = size, if n = 0, the default size is used.
  */
 void init_congruence_table(congruence_table_t *tbl, uint32_t n) {
-  uint32_t i;
-  composite_t **tmp;
-
   if (n == 0) {
     n = DEFAULT_CONGRUENCE_TBL_SIZE;
   }
+  if (n < HCTRL_GROUP) {
+    n = HCTRL_GROUP;
+  }
 
   if (n >= MAX_CONGRUENCE_TBL_SIZE) {
     out_of_memory();
@@ -1183,18 +1185,11 @@ void init_congruence_table(congruence_table_t *tbl, uint32_t n) {
 
   assert(is_power_of_two(n));
 
-  tmp = (composite_t **) safe_malloc(n * sizeof(composite_t *));
-  for (i=0; i<n; i++) {
-    tmp[i] = NULL_COMPOSITE;
-  }
-
-  tbl->data = tmp;
+  tbl->data = (composite_t **) safe_malloc(n * sizeof(composite_t *));
+  tbl->ctrl = hctrl_alloc(n);
   tbl->size = n;
   tbl->nelems = 0;
-  tbl->ndeleted = 0;
-
   tbl->resize_threshold = (uint32_t)(n * CONGRUENCE_TBL_RESIZE_RATIO);
-  tbl->cleanup_threshold = (uint32_t)(n * CONGRUENCE_TBL_CLEANUP_RATIO);
 
   init_sign_buffer(&tbl->buffer);
 }
@@ -1204,15 +1199,8 @@ void init_congruence_table(congruence_table_t *tbl, uint32_t n) {
  * Reset: remove all composites
  */
 void reset_congruence_table(congruence_table_t *tbl) {
-  uint32_t i, n;
-
-  n = tbl->size;
-  for (i=0; i<n; i++) {
-    tbl->data[i] = NULL_COMPOSITE;
-  }
-
+  hctrl_clear(tbl->ctrl, tbl->size);
   tbl->nelems = 0;
-  tbl->ndeleted = 0;
 }
 
 
@@ -1221,71 +1209,46 @@ void reset_congruence_table(congruence_table_t *tbl) {
  */
 void delete_congruence_table(congruence_table_t *tbl) {
   safe_free(tbl->data);
+  safe_free(tbl->ctrl);
   tbl->data = NULL;
+  tbl->ctrl = NULL;
   delete_sign_buffer(&tbl->buffer);
 }
 
 
 /*
- * Store composite d in a clean data array
- * - mask = size of data - 1
- * - d->hash is the hash code of d
- * data must not contain any deleted eterms and must have at least one empty slot
+ * Index of the first empty slot at or after slot j
+ * - mask = size - 1
  */
-static void congruence_table_clean_copy(composite_t **data, composite_t *d, uint32_t mask) {
-  uint32_t j;
+static uint32_t congruence_table_empty_slot(const uint8_t *ctrl, uint32_t j, uint32_t mask) {
+  uint32_t e;
 
-  j = d->hash & mask;
-  while (data[j] != NULL_COMPOSITE) {
-    j ++;
-    j &= mask;
+  for (;;) {
+    e = hctrl_match_empty(ctrl + j);
+    if (e != 0) {
+      return (j + ctz(e)) & mask;
+    }
+    j = (j + HCTRL_GROUP) & mask;
   }
-  data[j] = d;
-}
-
-
-/*
- * Check whether a pointer is non-deleted and non-null
- */
-static inline bool live_ptr(composite_t *d) {
-  return (((uintptr_t) d) & ~((uintptr_t) 1)) != 0;
 }
 
 
 /*
- * Remove deleted elements
+ * Store c in slot j
  */
-static void congruence_table_cleanup(congruence_table_t *tbl) {
-  composite_t **tmp, *d;
-  uint32_t j, n, mask;
-
-  n = tbl->size;
-  tmp = (composite_t **) safe_malloc(n * sizeof(composite_t *));
-  for (j=0; j<n; j++) {
-    tmp[j] = NULL_COMPOSITE;
-  }
-
-  mask = n - 1;
-  for (j=0; j<n; j++) {
-    d = tbl->data[j];
-    if (live_ptr(d)) {
-      congruence_table_clean_copy(tmp, d, mask);
-    }
-  }
-
-  safe_free(tbl->data);
-  tbl->data = tmp;
-  tbl->ndeleted = 0;
+static inline void congruence_table_store(congruence_table_t *tbl, uint32_t j, composite_t *c) {
+  tbl->data[j] = c;
+  hctrl_set(tbl->ctrl, tbl->size, j, hctrl_tag(c->hash));
 }
 
 
 /*
- * Remove deleted elements and make the table twice as large
+ * Make the table twice as large
  */
 static void congruence_table_extend(congruence_table_t *tbl) {
-  composite_t **tmp;
-  uint32_t n, n2, j, mask;
-  composite_t *d;
+  composite_t **tmp, **old;
+  uint8_t *ctrl, *old_ctrl;
+  uint32_t n, n2, i, j, mask;
 
   n = tbl->size;
   n2 = n<<1;
@@ -1294,49 +1257,95 @@ static void congruence_table_extend(congruence_table_t *tbl) {
   }
 
   tmp = (composite_t **) safe_malloc(n2 * sizeof(composite_t *));
-  for (j=0; j<n2; j++) {
-    tmp[j] = NULL_COMPOSITE;
-  }
-
+  ctrl = hctrl_alloc(n2);
   mask = n2 - 1;
-  for (j=0; j<n; j++) {
-    d = tbl->data[j];
-    if (live_ptr(d)) {
-      congruence_table_clean_copy(tmp, d, mask);
+
+  old = tbl->data;
+  old_ctrl = tbl->ctrl;
+  for (i=0; i<n; i++) {
+    if (old_ctrl[i] != HCTRL_EMPTY) {
+      j = congruence_table_empty_slot(ctrl, old[i]->hash & mask, mask);
+      tmp[j] = old[i];
+      hctrl_set(ctrl, n2, j, old_ctrl[i]);
     }
   }
 
-  safe_free(tbl->data);
+  safe_free(old);
+  safe_free(old_ctrl);
   tbl->data = tmp;
-  tbl->ndeleted = 0;
+  tbl->ctrl = ctrl;
   tbl->size = n2;
-
   tbl->resize_threshold = (uint32_t)(n2 * CONGRUENCE_TBL_RESIZE_RATIO);
-  tbl->cleanup_threshold = (uint32_t)(n2 * CONGRUENCE_TBL_CLEANUP_RATIO);
 }
 
 
 /*
- * Remove c from the congruence table.
- * - c must be in the table otherwise the function loops
+ * Search for c in the table
+ * - return its slot or tbl->size if c is not present
  */
-void congruence_table_remove(congruence_table_t *tbl, composite_t *c) {
-  uint32_t mask, j;
+static uint32_t congruence_table_slot(congruence_table_t *tbl, composite_t *c) {
+  uint32_t mask, i, j, m, e;
+  uint8_t tag;
+
+  assert(tbl->size > tbl->nelems);
 
   mask = tbl->size - 1;
+  tag = hctrl_tag(c->hash);
   j = c->hash & mask;
-  while (tbl->data[j] != c) {
-    j ++;
-    j &= mask;
+  for (;;) {
+    e = hctrl_match_empty(tbl->ctrl + j);
+    m = hctrl_before_empty(hctrl_match(tbl->ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      if (tbl->data[i] == c) return i;
+      m &= m - 1;
+    }
+    if (e != 0) return tbl->size;
+    j = (j + HCTRL_GROUP) & mask;
   }
+}
 
-  assert(tbl->data[j] == c);
-  tbl->data[j] = DELETED_COMPOSITE;
-  tbl->nelems --;
-  tbl->ndeleted ++;
-  if (tbl->ndeleted > tbl->cleanup_threshold) {
-    congruence_table_cleanup(tbl);
+
+/*
+ * Empty slot i: shift the composites that follow it in the probe
+ * sequence backward so that they remain reachable from their
+ * initial slot.
+ */
+static void congruence_table_clear_slot(congruence_table_t *tbl, uint32_t i) {
+  composite_t **data;
+  uint8_t *ctrl;
+  uint32_t mask, j;
+
+  assert(i < tbl->size && tbl->ctrl[i] != HCTRL_EMPTY);
+
+  mask = tbl->size - 1;
+  data = tbl->data;
+  ctrl = tbl->ctrl;
+  j = i;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (ctrl[j] == HCTRL_EMPTY) break;
+    if (hctrl_can_shift(data[j]->hash & mask, j, i, mask)) {
+      data[i] = data[j];
+      hctrl_set(ctrl, tbl->size, i, ctrl[j]);
+      i = j;
+    }
   }
+  hctrl_set(ctrl, tbl->size, i, HCTRL_EMPTY);
+  tbl->nelems --;
+}
+
+
+/*
+ * Remove c from the congruence table.
+ * - c must be in the table
+ */
+void congruence_table_remove(congruence_table_t *tbl, composite_t *c) {
+  uint32_t i;
+
+  i = congruence_table_slot(tbl, c);
+  assert(i < tbl->size && tbl->data[i] == c);
+  congruence_table_clear_slot(tbl, i);
 }
 
 
@@ -1347,28 +1356,15 @@ void congruence_table_remove(congruence_table_t *tbl, composite_t *c) {
  * - return false if c was not present
  */
 bool congruence_table_remove_if_present(congruence_table_t *tbl, composite_t *c) {
-  uint32_t mask, j;
-  composite_t *aux;
-
-  assert(tbl->size > tbl->ndeleted + tbl->nelems);
+  uint32_t i;
 
-  mask = tbl->size - 1;
-  j = c->hash & mask;
-  for (;;) {
-    aux = tbl->data[j];
-    if (aux == c) break;
-    if (aux == NULL_COMPOSITE) return false; // c not in the table
-    j ++;
-    j &= mask;
+  i = congruence_table_slot(tbl, c);
+  if (i == tbl->size) {
+    return false; // c not in the table
   }
 
-  assert(tbl->data[j] == c);
-  tbl->data[j] = DELETED_COMPOSITE;
-  tbl->nelems --;
-  tbl->ndeleted ++;
-  if (tbl->ndeleted > tbl->cleanup_threshold) {
-    congruence_table_cleanup(tbl);
-  }
+  assert(tbl->data[i] == c);
+  congruence_table_clear_slot(tbl, i);
 
   return true;
 }
@@ -1383,23 +1379,13 @@ bool congruence_table_remove_if_present(congruence_table_t *tbl, composite_t *c)
 void congruence_table_add(congruence_table_t *tbl, composite_t *c) {
   uint32_t mask, j;
 
-  assert(tbl->size > tbl->ndeleted + tbl->nelems);
+  assert(tbl->size > tbl->nelems);
 
   mask = tbl->size - 1;
-  j = c->hash & mask;
-  while (live_ptr(tbl->data[j])) {
-    j ++;
-    j &= mask;
-  }
-
-  if (tbl->data[j] == DELETED_COMPOSITE) {
-    assert(tbl->ndeleted > 0);
-    tbl->ndeleted --;
-  }
-
-  tbl->data[j] = c;
+  j = congruence_table_empty_slot(tbl->ctrl, c->hash & mask, mask);
+  congruence_table_store(tbl, j, c);
   tbl->nelems ++;
-  if (tbl->nelems + tbl->ndeleted > tbl->resize_threshold) {
+  if (tbl->nelems > tbl->resize_threshold) {
     congruence_table_extend(tbl);
   }
 }
@@ -1411,20 +1397,28 @@ void congruence_table_add(congruence_table_t *tbl, composite_t *c) {
  * - the table must not be full
  */
 composite_t  *congruence_table_find(congruence_table_t *tbl, signature_t *s, elabel_t *label) {
-  uint32_t mask, j, h;
+  uint32_t mask, i, j, h, m, e;
   composite_t *c;
+  uint8_t tag;
 
   mask = tbl->size - 1;
   h = hash_signature(s);
+  tag = hctrl_tag(h);
   j = h & mask;
+  hctrl_prefetch(tbl->data + j);
   for (;;) {
-    c = tbl->data[j];
-    if (c == NULL_COMPOSITE ||
-        (c != DELETED_COMPOSITE && c->hash == h && signature_matches(c, s, &tbl->buffer, label))) {
-      return c;
+    e = hctrl_match_empty(tbl->ctrl + j);
+    m = hctrl_before_empty(hctrl_match(tbl->ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      c = tbl->data[i];
+      if (c->hash == h && signature_matches(c, s, &tbl->buffer, label)) {
+        return c;
+      }
+      m &= m - 1;
     }
-    j ++;
-    j &= mask;
+    if (e != 0) return NULL_COMPOSITE;
+    j = (j + HCTRL_GROUP) & mask;
   }
 }
 
@@ -1453,28 +1447,34 @@ static inline bool matches_sigma_eq(composite_t *c, elabel_t *sigma, elabel_t *l
  * - return NULL_COMPOSITE if there's none
  */
 composite_t *congruence_table_find_eq(congruence_table_t *tbl, occ_t t1, occ_t t2, elabel_t *label) {
-  uint32_t mask, j, h;
+  uint32_t mask, i, j, h, m, e;
   composite_t *c;
   elabel_t s[2];
+  uint8_t tag;
 
   s[0] = get_label(label, t1);
   s[1] = get_label(label, t2);
   normalize_sigma_eq(s);
   h = hash_sigma_eq(s);
+  tag = hctrl_tag(h);
 
   mask = tbl->size - 1;
   j = h & mask;
+  hctrl_prefetch(tbl->data + j);
   for (;;) {
-    c = tbl->data[j];
-    if (c == NULL_COMPOSITE ||
-        (c != DELETED_COMPOSITE &&
-         c->tag == mk_eq_tag() && c->hash == h && matches_sigma_eq(c, s, label))) {
-      return c;
+    e = hctrl_match_empty(tbl->ctrl + j);
+    m = hctrl_before_empty(hctrl_match(tbl->ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      c = tbl->data[i];
+      if (c->tag == mk_eq_tag() && c->hash == h && matches_sigma_eq(c, s, label)) {
+        return c;
+      }
+      m &= m - 1;
     }
-    j ++;
-    j &= mask;
+    if (e != 0) return NULL_COMPOSITE;
+    j = (j + HCTRL_GROUP) & mask;
   }
-
 }
 
 
@@ -1483,50 +1483,41 @@ composite_t *congruence_table_find_eq(congruence_table_t *tbl, occ_t t1, occ_t t
  * If there is none, insert c in tbl.
  */
 composite_t  *congruence_table_get(congruence_table_t *tbl, composite_t *c, signature_t *s, elabel_t *label) {
-  uint32_t mask, j, k, h;
+  uint32_t mask, i, j, h, m, e;
   composite_t *aux;
+  uint8_t tag;
 
-  assert(tbl->size > tbl->ndeleted + tbl->nelems);
+  assert(tbl->size > tbl->nelems);
 
   mask = tbl->size - 1;
   h = hash_signature(s);
   c->hash = h;
+  tag = hctrl_tag(h);
   j = h & mask;
+  hctrl_prefetch(tbl->data + j);
 
   for (;;) {
-    aux = tbl->data[j];
-    if (aux == NULL_COMPOSITE) goto add;
-    if (aux == DELETED_COMPOSITE) break;
-    if (aux->hash == h && signature_matches(aux, s, &tbl->buffer, label)) goto found;
-    j ++;
-    j &= mask;
-  }
-
-  // j is where addition will happen if necessary
-  k = j;
-  for (;;) {
-    k++;
-    k &= mask;
-    aux = tbl->data[k];
-    if (aux == NULL_COMPOSITE) {
-      tbl->ndeleted --;
-      goto add;
+    e = hctrl_match_empty(tbl->ctrl + j);
+    m = hctrl_before_empty(hctrl_match(tbl->ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      aux = tbl->data[i];
+      if (aux->hash == h && signature_matches(aux, s, &tbl->buffer, label)) {
+        return aux;
+      }
+      m &= m - 1;
     }
-    if (aux != DELETED_COMPOSITE &&
-        aux->hash == h && signature_matches(aux, s, &tbl->buffer, label)) goto found;
+    if (e != 0) break;
+    j = (j + HCTRL_GROUP) & mask;
   }
 
- add:
-  tbl->data[j] = c;
+  // add c in the first empty slot
+  congruence_table_store(tbl, (j + ctz(e)) & mask, c);
   tbl->nelems ++;
-  if (tbl->nelems + tbl->ndeleted > tbl->resize_threshold) {
+  if (tbl->nelems > tbl->resize_threshold) {
     congruence_table_extend(tbl);
   }
   return c;
-
-
- found:
-  return aux;
 }
 
 
@@ -1536,13 +1527,15 @@ composite_t  *congruence_table_get(congruence_table_t *tbl, composite_t *c, sign
  * Check whether c is a congruence root
  * - use the internal buffer to compute c's signature and hash code
  * - no change to c->hash
+ * - c may have been stored with a different hash code, so we
+ *   check all the slots up to the first empty one (not just the
+ *   slots with a matching tag)
  */
 bool congruence_table_is_root(congruence_table_t *tbl, composite_t *c, elabel_t *label) {
-  uint32_t mask, j;
+  uint32_t mask, i, j, m, e;
   signature_t *s;
-  composite_t *aux;
 
-  assert(tbl->size > tbl->ndeleted + tbl->nelems);
+  assert(tbl->size > tbl->nelems);
 
   s = &tbl->buffer;
   signature_composite(c, label, s);
@@ -1550,11 +1543,15 @@ bool congruence_table_is_root(congruence_table_t *tbl, composite_t *c, elabel_t
   mask = tbl->size - 1;
   j = hash_signature(s) & mask;
   for (;;) {
-    aux = tbl->data[j];
-    if (aux == c) return true;
-    if (aux == NULL_COMPOSITE) return false;
-    j ++;
-    j &= mask;
+    e = hctrl_match_empty(tbl->ctrl + j);
+    m = hctrl_before_empty(~e & 0xFFFF, e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      if (tbl->data[i] == c) return true;
+      m &= m - 1;
+    }
+    if (e != 0) return false;
+    j = (j + HCTRL_GROUP) & mask;
   }
 }
 
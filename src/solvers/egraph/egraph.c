@@ -912,6 +912,9 @@ static void init_egraph_stats(egraph_stats_t *s) {
 
   s->final_checks = 0;
   s->interface_eqs = 0;
+
+  s->eq_expls = 0;
+  s->cached_expls = 0;
 }
 
 /*
@@ -4621,6 +4624,7 @@ void egraph_reset(egraph_t *egraph) {
   reset_cache(&egraph->cache);
   arena_reset(&egraph->arena);
   reset_istack(&egraph->istack);
+  reset_expl_cache(&egraph->expl_cache);
 
   ivector_reset(&egraph->interface_eqs);
   egraph->reconcile_top = 0;
@@ -4926,6 +4930,9 @@ static void egraph_local_backtrack(egraph_t *egraph, uint32_t back_level) {
   egraph->stack.top = k;
   egraph->stack.prop_ptr = k;
 
+  // remove the explanations that use the deleted edges
+  expl_cache_backtrack(&egraph->expl_cache, back_level);
+
   // delete all temporary data in the arena
   n = egraph->decision_level;
   do {
@@ -6324,7 +6331,7 @@ fcheck_code_t _o_egraph_final_check(egraph_t *egraph) {
 }
 
 fcheck_code_t egraph_final_check(egraph_t *egraph) {
-  MT_PROTECT(fcheck_code_t, __yices_globals.lock, _o_egraph_final_check(egraph));
+  MT_PROTECT_WRITE(fcheck_code_t, __yices_globals.lock, _o_egraph_final_check(egraph));
 }
 
 
@@ -6889,6 +6896,7 @@ void init_egraph(egraph_t *egraph, type_table_t *ttbl) {
 
   egraph->short_cuts = true;
   egraph->top_id = 0;
+  init_expl_cache(&egraph->expl_cache);
 
   init_ivector(&egraph->interface_eqs, 40);
   egraph->reconcile_top = 0;
@@ -7036,6 +7044,7 @@ void delete_egraph(egraph_t *egraph) {
   delete_istack(&egraph->istack);
   delete_ivector(&egraph->aux_buffer);
   delete_pvector(&egraph->cmp_vector);
+  delete_expl_cache(&egraph->expl_cache);
   delete_ivector(&egraph->expl_vector);
   delete_ivector(&egraph->expl_queue);
   delete_arena(&egraph->arena);
@@ -676,6 +676,10 @@ static inline uint32_t egraph_num_interface_eqs(egraph_t *egraph) {
   return egraph->stats.interface_eqs; // interface equalities or lemmas created by final check
 }
 
+static inline uint32_t egraph_num_cached_explanations(egraph_t *egraph) {
+  return egraph->stats.cached_expls;
+}
+
 
 
 
@@ -704,4 +708,13 @@ static inline bool egraph_is_at_base_level(egraph_t *egraph) {
   return egraph->decision_level == egraph->base_level;
 }
 
+/*
+ * Number of equalities in the propagation stack: this increases when
+ * classes are merged and decreases on backtracking. Satellite solvers
+ * can use it to check whether the egraph has changed.
+ */
+static inline uint32_t egraph_num_equalities(egraph_t *egraph) {
+  return egraph->stack.top;
+}
+
 #endif /* __EGRAPH_H */
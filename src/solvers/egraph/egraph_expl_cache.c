@@ -0,0 +1,316 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF EQUALITY EXPLANATIONS
+ */
+
+#include <assert.h>
+
+#include "solvers/egraph/egraph_expl_cache.h"
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Markers in the hash table
+ */
+enum {
+  EXPL_CACHE_EMPTY = -1,
+  EXPL_CACHE_DELETED = -2,
+};
+
+
+/*
+ * Allocate and clear a hash table of size n
+ */
+static int32_t *alloc_expl_index(uint32_t n) {
+  int32_t *tmp;
+  uint32_t i;
+
+  assert(n > 0 && (n & (n - 1)) == 0);
+  if (n > MAX_EXPL_CACHE_HSIZE) {
+    out_of_memory();
+  }
+  tmp = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  for (i=0; i<n; i++) {
+    tmp[i] = EXPL_CACHE_EMPTY;
+  }
+  return tmp;
+}
+
+
+/*
+ * Initialization
+ */
+void init_expl_cache(expl_cache_t *cache) {
+  cache->entry = NULL;
+  cache->nentries = 0;
+  cache->size = 0;
+  cache->index = alloc_expl_index(DEF_EXPL_CACHE_HSIZE);
+  cache->hsize = DEF_EXPL_CACHE_HSIZE;
+  cache->nelems = 0;
+  cache->ndeleted = 0;
+  init_ivector(&cache->lits, 0);
+  init_ivector(&cache->aux, 0);
+}
+
+
+/*
+ * Delete
+ */
+void delete_expl_cache(expl_cache_t *cache) {
+  safe_free(cache->entry);
+  safe_free(cache->index);
+  cache->entry = NULL;
+  cache->index = NULL;
+  delete_ivector(&cache->lits);
+  delete_ivector(&cache->aux);
+}
+
+
+/*
+ * Reset
+ */
+void reset_expl_cache(expl_cache_t *cache) {
+  uint32_t i, n;
+
+  n = cache->hsize;
+  for (i=0; i<n; i++) {
+    cache->index[i] = EXPL_CACHE_EMPTY;
+  }
+  cache->nentries = 0;
+  cache->nelems = 0;
+  cache->ndeleted = 0;
+  ivector_reset(&cache->lits);
+  ivector_reset(&cache->aux);
+}
+
+
+/*
+ * Hash code for the pair (t1, t2)
+ */
+static inline uint32_t hash_occ_pair(occ_t t1, occ_t t2) {
+  return jenkins_hash_pair(t1, t2, 0x8ab3e1f2);
+}
+
+
+/*
+ * Index of the hash table slot that contains the entry for (t1, t2)
+ * - return -1 if there's no such entry
+ * - t1 and t2 must be normalized
+ */
+static int32_t expl_cache_slot(const expl_cache_t *cache, occ_t t1, occ_t t2) {
+  expl_cache_entry_t *e;
+  uint32_t i, mask;
+  int32_t k;
+
+  assert(t1 <= t2);
+
+  mask = cache->hsize - 1;
+  i = hash_occ_pair(t1, t2) & mask;
+  for (;;) {
+    k = cache->index[i];
+    if (k == EXPL_CACHE_EMPTY) return -1;
+    if (k >= 0) {
+      e = cache->entry + k;
+      if (e->t1 == t1 && e->t2 == t2) return i;
+    }
+    i ++;
+    i &= mask;
+  }
+}
+
+
+/*
+ * Store entry k in a clean hash table (no deleted slots)
+ */
+static void expl_cache_clean_copy(int32_t *index, uint32_t mask, const expl_cache_entry_t *e, int32_t k) {
+  uint32_t i;
+
+  i = hash_occ_pair(e->t1, e->t2) & mask;
+  while (index[i] != EXPL_CACHE_EMPTY) {
+    i ++;
+    i &= mask;
+  }
+  index[i] = k;
+}
+
+
+/*
+ * Rebuild the hash table from the entries
+ * - the new size is n
+ */
+static void expl_cache_rehash(expl_cache_t *cache, uint32_t n) {
+  int32_t *tmp;
+  uint32_t i, mask;
+
+  tmp = alloc_expl_index(n);
+  mask = n - 1;
+  for (i=0; i<cache->nentries; i++) {
+    expl_cache_clean_copy(tmp, mask, cache->entry + i, i);
+  }
+  safe_free(cache->index);
+  cache->index = tmp;
+  cache->hsize = n;
+  cache->nelems = cache->nentries;
+  cache->ndeleted = 0;
+}
+
+
+/*
+ * Store entry k in the hash table (reuse a deleted slot if possible)
+ * - there must be no other entry for the same pair
+ */
+static void expl_cache_insert_index(expl_cache_t *cache, int32_t k) {
+  expl_cache_entry_t *e;
+  uint32_t i, mask;
+
+  e = cache->entry + k;
+  mask = cache->hsize - 1;
+  i = hash_occ_pair(e->t1, e->t2) & mask;
+  while (cache->index[i] >= 0) {
+    i ++;
+    i &= mask;
+  }
+  if (cache->index[i] == EXPL_CACHE_DELETED) {
+    cache->ndeleted --;
+  }
+  cache->index[i] = k;
+  cache->nelems ++;
+}
+
+
+/*
+ * Make room for one more entry (in the entry array and in the hash table)
+ */
+static void expl_cache_make_room(expl_cache_t *cache) {
+  uint32_t n;
+
+  if (cache->nentries == cache->size) {
+    n = cache->size;
+    if (n == 0) {
+      n = DEF_EXPL_CACHE_SIZE;
+    } else {
+      n += n >> 1;
+      if (n > MAX_EXPL_CACHE_SIZE) {
+        out_of_memory();
+      }
+    }
+    cache->entry = (expl_cache_entry_t *) safe_realloc(cache->entry, n * sizeof(expl_cache_entry_t));
+    cache->size = n;
+  }
+
+  if (cache->nelems + cache->ndeleted + 1 > (uint32_t) (cache->hsize * EXPL_CACHE_RESIZE_RATIO)) {
+    n = cache->hsize;
+    if (cache->nelems + 1 > (uint32_t) (n * EXPL_CACHE_RESIZE_RATIO/2)) {
+      // more than half full without the deleted slots: double the size
+      n <<= 1;
+    }
+    expl_cache_rehash(cache, n);
+  }
+}
+
+
+/*
+ * Search for an explanation
+ */
+literal_t *expl_cache_find(expl_cache_t *cache, occ_t t1, occ_t t2, int32_t id, uint32_t *n) {
+  expl_cache_entry_t *e;
+  int32_t i;
+  occ_t aux;
+
+  if (t1 > t2) {
+    aux = t1; t1 = t2; t2 = aux;
+  }
+
+  i = expl_cache_slot(cache, t1, t2);
+  if (i >= 0) {
+    e = cache->entry + cache->index[i];
+    if (e->id <= id) {
+      *n = e->len;
+      return cache->lits.data + e->start;
+    }
+  }
+
+  return NULL;
+}
+
+
+/*
+ * Add an explanation
+ */
+void expl_cache_add(expl_cache_t *cache, occ_t t1, occ_t t2, int32_t id, uint32_t level, const literal_t *a, uint32_t n) {
+  expl_cache_entry_t *e;
+  uint32_t k;
+  occ_t aux;
+
+  assert(cache->nentries == 0 || cache->entry[cache->nentries - 1].level <= level);
+
+  if (cache->lits.size + n > EXPL_CACHE_MAX_LITS) {
+    return;
+  }
+
+  if (t1 > t2) {
+    aux = t1; t1 = t2; t2 = aux;
+  }
+
+  if (expl_cache_slot(cache, t1, t2) >= 0) {
+    return;
+  }
+
+  expl_cache_make_room(cache);
+  k = cache->nentries;
+  e = cache->entry + k;
+  e->t1 = t1;
+  e->t2 = t2;
+  e->id = id;
+  e->level = level;
+  e->start = cache->lits.size;
+  e->len = n;
+  ivector_add(&cache->lits, a, n);
+  cache->nentries = k + 1;
+
+  expl_cache_insert_index(cache, k);
+}
+
+
+/*
+ * Backtrack: remove all entries of level > back_level
+ */
+void expl_cache_backtrack(expl_cache_t *cache, uint32_t back_level) {
+  expl_cache_entry_t *e;
+  uint32_t k;
+  int32_t i;
+
+  k = cache->nentries;
+  while (k > 0 && cache->entry[k - 1].level > back_level) {
+    k --;
+    e = cache->entry + k;
+    i = expl_cache_slot(cache, e->t1, e->t2);
+    assert(i >= 0 && cache->index[i] == (int32_t) k);
+    cache->index[i] = EXPL_CACHE_DELETED;
+    cache->nelems --;
+    cache->ndeleted ++;
+  }
+
+  if (k < cache->nentries) {
+    cache->lits.size = cache->entry[k].start;
+    cache->nentries = k;
+  }
+}
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF EQUALITY EXPLANATIONS
+ *
+ * The same equality (t1 == t2) is often explained many times by the
+ * egraph (for propagated atoms and for the satellite solvers). To avoid
+ * walking the merge trees again, we keep the literals of an explanation
+ * in a cache, until we backtrack.
+ *
+ * Each entry stores:
+ * - the pair (t1, t2), normalized so that t1 < t2
+ * - id = the edge bound used to build the explanation: all the edges
+ *   used are < id. The same literals explain (t1 == t2) for any
+ *   bound >= id (but not for smaller bounds).
+ * - level = the decision level when the entry was created. All the
+ *   literals and edges used in the explanation are assigned or added
+ *   at this level or lower. The entry is removed when we backtrack
+ *   to a lower level.
+ * - the literals are stored in a single array (lits[start ... start+len-1])
+ *
+ * Entries are created in order of non-decreasing level, so
+ * backtracking removes a suffix of the entry array.
+ */
+
+#ifndef __EGRAPH_EXPL_CACHE_H
+#define __EGRAPH_EXPL_CACHE_H
+
+#include <stdint.h>
+
+#include "solvers/cdcl/smt_core_base_types.h"
+#include "solvers/egraph/egraph_base_types.h"
+#include "utils/int_vectors.h"
+
+
+typedef struct expl_cache_entry_s {
+  occ_t t1;
+  occ_t t2;
+  int32_t id;
+  uint32_t level;
+  uint32_t start;
+  uint32_t len;
+} expl_cache_entry_t;
+
+
+/*
+ * Cache:
+ * - entry = array of entries, nentries = number of entries, size = its size
+ * - index = hash table: contains entry indices, or -1 (empty), or -2 (deleted)
+ * - hsize = size of the hash table (a power of 2)
+ * - nelems = number of live elements in the hash table
+ * - ndeleted = number of deleted elements
+ * - lits = literals of all the explanations
+ * - aux = buffer used by the egraph to build explanations
+ */
+typedef struct expl_cache_s {
+  expl_cache_entry_t *entry;
+  uint32_t nentries;
+  uint32_t size;
+
+  int32_t *index;
+  uint32_t hsize;
+  uint32_t nelems;
+  uint32_t ndeleted;
+
+  ivector_t lits;
+  ivector_t aux;
+} expl_cache_t;
+
+#define DEF_EXPL_CACHE_SIZE 64
+#define MAX_EXPL_CACHE_SIZE (UINT32_MAX/sizeof(expl_cache_entry_t))
+
+#define DEF_EXPL_CACHE_HSIZE 128
+#define MAX_EXPL_CACHE_HSIZE (UINT32_MAX/sizeof(int32_t))
+
+// resize when nelems + ndeleted > hsize * RESIZE_RATIO
+#define EXPL_CACHE_RESIZE_RATIO 0.6
+
+// explanations are not cached once the literal array is this big
+#define EXPL_CACHE_MAX_LITS (1<<22)
+
+
+/*
+ * Initialization: the cache is empty
+ */
+extern void init_expl_cache(expl_cache_t *cache);
+
+/*
+ * Delete: free all memory
+ */
+extern void delete_expl_cache(expl_cache_t *cache);
+
+/*
+ * Reset: remove all entries
+ */
+extern void reset_expl_cache(expl_cache_t *cache);
+
+/*
+ * Search for an explanation of (t1 == t2) that's valid for edge bound id
+ * - return a pointer to the explanation literals and store their number in *n
+ * - return NULL if there's no such explanation in the cache
+ */
+extern literal_t *expl_cache_find(expl_cache_t *cache, occ_t t1, occ_t t2, int32_t id, uint32_t *n);
+
+/*
+ * Store the explanation a[0 ... n-1] for (t1 == t2)
+ * - id = edge bound used to build the explanation
+ * - level = current decision level: it must be no less than the level
+ *   of all the entries in the cache
+ * - nothing is stored if there's already an entry for (t1, t2) or
+ *   if the cache is full
+ */
+extern void expl_cache_add(expl_cache_t *cache, occ_t t1, occ_t t2, int32_t id, uint32_t level, const literal_t *a, uint32_t n);
+
+/*
+ * Remove all the entries created at a level > back_level
+ */
+extern void expl_cache_backtrack(expl_cache_t *cache, uint32_t back_level);
+
+
+#endif /* __EGRAPH_EXPL_CACHE_H */
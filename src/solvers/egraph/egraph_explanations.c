@@ -1080,13 +1080,45 @@ static void build_explanation_vector(egraph_t *egraph, ivector_t *v) {
 /*
  * Build explanation for (t1 == t2): requires class[t1] == class[t2]
  * - id = edge index: all edges used in building the explanation must have index < id
+ *
+ * The result is kept in the explanation cache. It can be reused
+ * for any id' >= id until we backtrack. We don't store anything in
+ * reconcile mode since the reconciliation edges are removed without
+ * backtracking.
  */
 void egraph_explain_equality(egraph_t *egraph, occ_t t1, occ_t t2, int32_t id, ivector_t *v) {
+  ivector_t *aux;
+  literal_t *a;
+  uint32_t n, n0;
+
   assert(egraph_equal_occ(egraph, t1, t2));
   assert(egraph->expl_queue.size == 0);
-  egraph->top_id = id;
-  explain_eq(egraph, t1, t2, v);
-  build_explanation_vector(egraph, v);
+
+  egraph->stats.eq_expls ++;
+  n0 = v->size;
+  a = expl_cache_find(&egraph->expl_cache, t1, t2, id, &n);
+  if (a != NULL) {
+    egraph->stats.cached_expls ++;
+    ivector_add(v, a, n);
+  } else {
+    egraph->top_id = id;
+    if (egraph->reconcile_mode) {
+      explain_eq(egraph, t1, t2, v);
+      build_explanation_vector(egraph, v);
+      return;
+    }
+    aux = &egraph->expl_cache.aux;
+    ivector_reset(aux);
+    explain_eq(egraph, t1, t2, aux);
+    build_explanation_vector(egraph, aux);
+    expl_cache_add(&egraph->expl_cache, t1, t2, id, egraph->decision_level, aux->data, aux->size);
+    ivector_add(v, aux->data, aux->size);
+  }
+
+  // the new literals are distinct but they may occur in v already
+  if (n0 > 0) {
+    ivector_remove_duplicates(v);
+  }
 }
 
 
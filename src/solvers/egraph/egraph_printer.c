@@ -27,6 +27,7 @@
 #include "solvers/egraph/egraph_printer.h"
 #include "solvers/egraph/egraph_utils.h"
 #include "solvers/egraph/theory_explanations.h"
+#include "utils/hash_ctrl_bytes.h"
 #include "utils/int_array_sort.h"
 #include "utils/int_hash_sets.h"
 #include "utils/prng.h"
@@ -864,8 +865,8 @@ static void collect_congruence_roots(congruence_table_t *tbl, pvector_t *v) {
 
   n = tbl->size;
   for (i=0; i<n; i++) {
-    tmp = tbl->data[i];
-    if (tmp != NULL_COMPOSITE && tmp != DELETED_COMPOSITE) {
+    if (tbl->ctrl[i] != HCTRL_EMPTY) {
+      tmp = tbl->data[i];
       pvector_push(v, tmp);
     }
   }
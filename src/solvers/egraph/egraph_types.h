@@ -248,6 +248,7 @@
 #include "model/fun_maps.h"
 #include "solvers/cdcl/smt_core.h"
 #include "solvers/egraph/egraph_base_types.h"
+#include "solvers/egraph/egraph_expl_cache.h"
 #include "utils/arena.h"
 #include "utils/cache.h"
 #include "utils/int_hash_map.h"
@@ -681,30 +682,33 @@ typedef struct signature_s {
 
 /*
  * Hash-table of composites: stores a unique representative
- * (congruence root) per signature. It's similar to int_hash_table.
+ * (congruence root) per signature. It's similar to int_hash_table:
+ * ctrl[i] is HCTRL_EMPTY if data[i] is empty or a 7-bit tag derived
+ * from data[i]->hash otherwise (cf. utils/hash_ctrl_bytes.h).
+ *
+ * Composites are removed and added back on every merge and every
+ * backtrack. Removal shifts the following composites backward rather
+ * than leaving a tombstone: this keeps the probe sequences short,
+ * which matters more here than the cost of the removal itself.
  */
 typedef struct congruence_table_s {
   composite_t **data;  // the hash table proper
+  uint8_t *ctrl;       // control bytes
   uint32_t size;       // its size (must be a power of 2)
   uint32_t nelems;     // number of elements
-  uint32_t ndeleted;   // deleted elements
   uint32_t resize_threshold;
-  uint32_t cleanup_threshold;
   signature_t buffer;  // for internal use
 } congruence_table_t;
 
 
 /*
- * Marker for deleted elements in the congruence table
- * Empty slots contain the NULL pointer
+ * Returned by the search functions if there's no match
  */
-#define DELETED_COMPOSITE ((composite_t *) 1)
 #define NULL_COMPOSITE ((composite_t *) 0)
 
 #define DEFAULT_CONGRUENCE_TBL_SIZE 256
 #define MAX_CONGRUENCE_TBL_SIZE (UINT32_MAX/sizeof(composite_t*))
 #define CONGRUENCE_TBL_RESIZE_RATIO 0.6
-#define CONGRUENCE_TBL_CLEANUP_RATIO 0.2
 
 
 
@@ -1284,6 +1288,10 @@ typedef struct egraph_stats_s {
   uint32_t final_checks;     // number of calls to final check
   uint32_t interface_eqs;    // number of interface equalities generated
 
+  // equality explanations
+  uint32_t eq_expls;         // number of calls to egraph_explain_equality
+  uint32_t cached_expls;     // number of explanations found in the cache
+
 } egraph_stats_t;
 
 
@@ -1426,6 +1434,11 @@ struct egraph_s {
   bool short_cuts;            // enable/disable short cuts in explanations
   int32_t top_id;             // used when building explanations
 
+  /*
+   * Cache of equality explanations (cleared on backtracking)
+   */
+  expl_cache_t expl_cache;
+
   /*
    * Support for model reconciliation
    */
@@ -0,0 +1,2419 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * SPARSE SOLVER FOR INTEGER DIFFERENCE LOGIC
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "solvers/floyd_warshall/idl_sparse_solver.h"
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Marks used by the searches:
+ * - B_SEEN/B_DONE: the vertex has been reached/settled by a backward
+ *   search (on incoming edges). dist_b and pred_b are defined.
+ * - F_SEEN/F_DONE: same thing for the forward search.
+ */
+#define ISDL_B_SEEN 0x1
+#define ISDL_B_DONE 0x2
+#define ISDL_F_SEEN 0x4
+#define ISDL_F_DONE 0x8
+
+
+/*
+ * Conversion between atom index and void* (as in the Floyd-Warshall solver)
+ */
+static inline void *isdl_index2atom(int32_t i) {
+  return (void *) ((size_t) i);
+}
+
+static inline int32_t isdl_atom2index(void *a) {
+  return (int32_t) ((size_t) a);
+}
+
+
+
+/****************
+ *  EDGE STACK  *
+ ***************/
+
+static void init_isdl_edges(isdl_edges_t *edges, uint32_t n) {
+  assert(n < MAX_ISDL_EDGES_SIZE);
+
+  edges->size = n;
+  edges->top = 0;
+  edges->source = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  edges->target = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  edges->cost = (int32_t *) safe_malloc(n * sizeof(int32_t));
+  edges->lit = (literal_t *) safe_malloc(n * sizeof(literal_t));
+}
+
+/*
+ * Make the stack 50% larger
+ */
+static void extend_isdl_edges(isdl_edges_t *edges) {
+  uint32_t n;
+
+  n = edges->size + 1;
+  n += n>>1;
+  if (n >= MAX_ISDL_EDGES_SIZE) {
+    out_of_memory();
+  }
+  edges->source = (int32_t *) safe_realloc(edges->source, n * sizeof(int32_t));
+  edges->target = (int32_t *) safe_realloc(edges->target, n * sizeof(int32_t));
+  edges->cost = (int32_t *) safe_realloc(edges->cost, n * sizeof(int32_t));
+  edges->lit = (literal_t *) safe_realloc(edges->lit, n * sizeof(literal_t));
+  edges->size = n;
+}
+
+static inline void reset_isdl_edges(isdl_edges_t *edges) {
+  edges->top = 0;
+}
+
+static void delete_isdl_edges(isdl_edges_t *edges) {
+  safe_free(edges->source);
+  safe_free(edges->target);
+  safe_free(edges->cost);
+  safe_free(edges->lit);
+  edges->source = NULL;
+  edges->target = NULL;
+  edges->cost = NULL;
+  edges->lit = NULL;
+}
+
+
+
+/******************
+ *  VERTEX TABLE  *
+ *****************/
+
+/*
+ * Initialize the vectors and marks of vertices i to n-1
+ */
+static void init_isdl_vertex_range(isdl_vtbl_t *vtbl, uint32_t i, uint32_t n) {
+  while (i < n) {
+    vtbl->val[i] = 0;
+    init_ivector(vtbl->out + i, 0);
+    init_ivector(vtbl->in + i, 0);
+    init_ivector(vtbl->atoms + i, 0);
+    vtbl->flag[i] = 0;
+    vtbl->hpos[i] = -1;
+    i ++;
+  }
+}
+
+/*
+ * Allocate the arrays for size n
+ */
+static void resize_isdl_vtbl_arrays(isdl_vtbl_t *vtbl, uint32_t n) {
+  vtbl->val = (int64_t *) safe_realloc(vtbl->val, n * sizeof(int64_t));
+  vtbl->out = (ivector_t *) safe_realloc(vtbl->out, n * sizeof(ivector_t));
+  vtbl->in = (ivector_t *) safe_realloc(vtbl->in, n * sizeof(ivector_t));
+  vtbl->atoms = (ivector_t *) safe_realloc(vtbl->atoms, n * sizeof(ivector_t));
+  vtbl->key = (int64_t *) safe_realloc(vtbl->key, n * sizeof(int64_t));
+  vtbl->dist_b = (int64_t *) safe_realloc(vtbl->dist_b, n * sizeof(int64_t));
+  vtbl->dist_f = (int64_t *) safe_realloc(vtbl->dist_f, n * sizeof(int64_t));
+  vtbl->pred_b = (int32_t *) safe_realloc(vtbl->pred_b, n * sizeof(int32_t));
+  vtbl->pred_f = (int32_t *) safe_realloc(vtbl->pred_f, n * sizeof(int32_t));
+  vtbl->flag = (uint8_t *) safe_realloc(vtbl->flag, n * sizeof(uint8_t));
+  vtbl->hpos = (int32_t *) safe_realloc(vtbl->hpos, n * sizeof(int32_t));
+}
+
+static void init_isdl_vtbl(isdl_vtbl_t *vtbl, uint32_t n) {
+  assert(n < MAX_ISDL_VTBL_SIZE);
+
+  vtbl->size = n;
+  vtbl->val = NULL;
+  vtbl->out = NULL;
+  vtbl->in = NULL;
+  vtbl->atoms = NULL;
+  vtbl->key = NULL;
+  vtbl->dist_b = NULL;
+  vtbl->dist_f = NULL;
+  vtbl->pred_b = NULL;
+  vtbl->pred_f = NULL;
+  vtbl->flag = NULL;
+  vtbl->hpos = NULL;
+  resize_isdl_vtbl_arrays(vtbl, n);
+  init_isdl_vertex_range(vtbl, 0, n);
+}
+
+/*
+ * Make the table 50% larger
+ */
+static void extend_isdl_vtbl(isdl_vtbl_t *vtbl) {
+  uint32_t n;
+
+  n = vtbl->size + 1;
+  n += n>>1;
+  if (n >= MAX_ISDL_VTBL_SIZE) {
+    out_of_memory();
+  }
+  resize_isdl_vtbl_arrays(vtbl, n);
+  init_isdl_vertex_range(vtbl, vtbl->size, n);
+  vtbl->size = n;
+}
+
+static void delete_isdl_vtbl(isdl_vtbl_t *vtbl) {
+  uint32_t i;
+
+  for (i=0; i<vtbl->size; i++) {
+    delete_ivector(vtbl->out + i);
+    delete_ivector(vtbl->in + i);
+    delete_ivector(vtbl->atoms + i);
+  }
+  safe_free(vtbl->val);
+  safe_free(vtbl->out);
+  safe_free(vtbl->in);
+  safe_free(vtbl->atoms);
+  safe_free(vtbl->key);
+  safe_free(vtbl->dist_b);
+  safe_free(vtbl->dist_f);
+  safe_free(vtbl->pred_b);
+  safe_free(vtbl->pred_f);
+  safe_free(vtbl->flag);
+  safe_free(vtbl->hpos);
+  vtbl->val = NULL;
+  vtbl->out = NULL;
+  vtbl->in = NULL;
+  vtbl->atoms = NULL;
+  vtbl->key = NULL;
+  vtbl->dist_b = NULL;
+  vtbl->dist_f = NULL;
+  vtbl->pred_b = NULL;
+  vtbl->pred_f = NULL;
+  vtbl->flag = NULL;
+  vtbl->hpos = NULL;
+}
+
+/*
+ * Empty the vectors of vertices 0 to n-1
+ */
+static void reset_isdl_vtbl(isdl_vtbl_t *vtbl, uint32_t n) {
+  uint32_t i;
+
+  assert(n <= vtbl->size);
+  for (i=0; i<n; i++) {
+    vtbl->val[i] = 0;
+    ivector_reset(vtbl->out + i);
+    ivector_reset(vtbl->in + i);
+    ivector_reset(vtbl->atoms + i);
+    vtbl->flag[i] = 0;
+    vtbl->hpos[i] = -1;
+  }
+}
+
+
+
+/**********
+ *  HEAP  *
+ *********/
+
+/*
+ * The heap is ordered by solver->vertices.key. The position of
+ * vertex x in the heap is stored in solver->vertices.hpos[x].
+ */
+static void init_isdl_heap(isdl_heap_t *heap, uint32_t n) {
+  assert(n < MAX_ISDL_HEAP_SIZE);
+  heap->size = n;
+  heap->nelems = 0;
+  heap->data = (int32_t *) safe_malloc(n * sizeof(int32_t));
+}
+
+static void extend_isdl_heap(isdl_heap_t *heap) {
+  uint32_t n;
+
+  n = heap->size + 1;
+  n += n>>1;
+  if (n >= MAX_ISDL_HEAP_SIZE) {
+    out_of_memory();
+  }
+  heap->data = (int32_t *) safe_realloc(heap->data, n * sizeof(int32_t));
+  heap->size = n;
+}
+
+static void delete_isdl_heap(isdl_heap_t *heap) {
+  safe_free(heap->data);
+  heap->data = NULL;
+}
+
+/*
+ * Move x up from position i
+ */
+static void isdl_heap_up(isdl_solver_t *solver, int32_t x, uint32_t i) {
+  isdl_heap_t *heap;
+  int64_t *key;
+  int32_t *hpos;
+  int32_t y;
+  uint32_t j;
+
+  heap = &solver->heap;
+  key = solver->vertices.key;
+  hpos = solver->vertices.hpos;
+
+  while (i > 0) {
+    j = (i - 1) >> 1;
+    y = heap->data[j];
+    if (key[y] <= key[x]) break;
+    heap->data[i] = y;
+    hpos[y] = i;
+    i = j;
+  }
+  heap->data[i] = x;
+  hpos[x] = i;
+}
+
+/*
+ * Move x down from position i
+ */
+static void isdl_heap_down(isdl_solver_t *solver, int32_t x, uint32_t i) {
+  isdl_heap_t *heap;
+  int64_t *key;
+  int32_t *hpos;
+  int32_t y, z;
+  uint32_t j, n;
+
+  heap = &solver->heap;
+  key = solver->vertices.key;
+  hpos = solver->vertices.hpos;
+  n = heap->nelems;
+
+  for (;;) {
+    j = 2 * i + 1;
+    if (j >= n) break;
+    y = heap->data[j];
+    if (j + 1 < n) {
+      z = heap->data[j + 1];
+      if (key[z] < key[y]) {
+        j ++;
+        y = z;
+      }
+    }
+    if (key[x] <= key[y]) break;
+    heap->data[i] = y;
+    hpos[y] = i;
+    i = j;
+  }
+  heap->data[i] = x;
+  hpos[x] = i;
+}
+
+/*
+ * Add x to the heap or move it up if its key has decreased
+ */
+static void isdl_heap_update(isdl_solver_t *solver, int32_t x) {
+  isdl_heap_t *heap;
+  int32_t i;
+
+  heap = &solver->heap;
+  i = solver->vertices.hpos[x];
+  if (i < 0) {
+    if (heap->nelems == heap->size) {
+      extend_isdl_heap(heap);
+    }
+    i = heap->nelems;
+    heap->nelems ++;
+  }
+  isdl_heap_up(solver, x, i);
+}
+
+/*
+ * Remove the vertex of smallest key (the heap must not be empty)
+ */
+static int32_t isdl_heap_get_min(isdl_solver_t *solver) {
+  isdl_heap_t *heap;
+  int32_t x, y;
+
+  heap = &solver->heap;
+  assert(heap->nelems > 0);
+
+  x = heap->data[0];
+  solver->vertices.hpos[x] = -1;
+  heap->nelems --;
+  if (heap->nelems > 0) {
+    y = heap->data[heap->nelems];
+    isdl_heap_down(solver, y, 0);
+  }
+  return x;
+}
+
+/*
+ * Empty the heap
+ */
+static void isdl_heap_clear(isdl_solver_t *solver) {
+  isdl_heap_t *heap;
+  uint32_t i;
+
+  heap = &solver->heap;
+  for (i=0; i<heap->nelems; i++) {
+    solver->vertices.hpos[heap->data[i]] = -1;
+  }
+  heap->nelems = 0;
+}
+
+
+
+/****************
+ *  ATOM TABLE  *
+ ***************/
+
+static void init_isdl_atbl(isdl_atbl_t *table, uint32_t n) {
+  assert(n < MAX_ISDL_ATBL_SIZE);
+
+  table->size = n;
+  table->natoms = 0;
+  table->atoms = (isdl_atom_t *) safe_malloc(n * sizeof(isdl_atom_t));
+  table->mark = allocate_bitvector(n);
+}
+
+/*
+ * Make the table 50% larger
+ */
+static void extend_isdl_atbl(isdl_atbl_t *table) {
+  uint32_t n;
+
+  n = table->size + 1;
+  n += n>>1;
+  if (n >= MAX_ISDL_ATBL_SIZE) {
+    out_of_memory();
+  }
+  table->size = n;
+  table->atoms = (isdl_atom_t *) safe_realloc(table->atoms, n * sizeof(isdl_atom_t));
+  table->mark = extend_bitvector(table->mark, n);
+}
+
+/*
+ * Create atom (x - y <= c) with no boolean variable
+ */
+static int32_t new_isdl_atom(isdl_atbl_t *table, int32_t x, int32_t y, int32_t c) {
+  uint32_t i;
+
+  i = table->natoms;
+  if (i == table->size) {
+    extend_isdl_atbl(table);
+  }
+  assert(i < table->size);
+  table->atoms[i].source = x;
+  table->atoms[i].target = y;
+  table->atoms[i].cost = c;
+  table->atoms[i].boolvar = null_bvar;
+  clr_bit(table->mark, i);
+  table->natoms ++;
+
+  return i;
+}
+
+static inline isdl_atom_t *get_isdl_atom(isdl_atbl_t *table, int32_t i) {
+  assert(0 <= i && i < table->natoms);
+  return table->atoms + i;
+}
+
+static inline bool isdl_atom_is_assigned(isdl_atbl_t *table, int32_t i) {
+  assert(0 <= i && i < table->natoms);
+  return tst_bit(table->mark, i);
+}
+
+static inline void mark_isdl_atom_assigned(isdl_atbl_t *table, int32_t i) {
+  assert(0 <= i && i < table->natoms && ! tst_bit(table->mark, i));
+  set_bit(table->mark, i);
+}
+
+static inline void mark_isdl_atom_unassigned(isdl_atbl_t *table, int32_t i) {
+  assert(0 <= i && i < table->natoms && tst_bit(table->mark, i));
+  clr_bit(table->mark, i);
+}
+
+static inline void reset_isdl_atbl(isdl_atbl_t *table) {
+  table->natoms = 0;
+}
+
+static void delete_isdl_atbl(isdl_atbl_t *table) {
+  safe_free(table->atoms);
+  delete_bitvector(table->mark);
+  table->atoms = NULL;
+  table->mark = NULL;
+}
+
+
+
+/**********************************
+ *  ATOM STACK/PROPAGATION QUEUE  *
+ *********************************/
+
+static void init_isdl_astack(isdl_astack_t *stack, uint32_t n) {
+  assert(n < MAX_ISDL_ASTACK_SIZE);
+  stack->size = n;
+  stack->top = 0;
+  stack->prop_ptr = 0;
+  stack->data = (int32_t *) safe_malloc(n * sizeof(int32_t));
+}
+
+static void extend_isdl_astack(isdl_astack_t *stack) {
+  uint32_t n;
+
+  n = stack->size + 1;
+  n += n>>1;
+  if (n >= MAX_ISDL_ASTACK_SIZE) {
+    out_of_memory();
+  }
+  stack->data = (int32_t *) safe_realloc(stack->data, n * sizeof(int32_t));
+  stack->size = n;
+}
+
+/*
+ * Atom index + sign: same encoding as in idl_floyd_warshall.c
+ */
+static inline int32_t mk_isdl_index(int32_t id, uint32_t sign) {
+  assert(sign == 0 || sign == 1);
+  return (id<<1) | sign;
+}
+
+static inline int32_t isdl_atom_of_index(int32_t idx) {
+  return idx>>1;
+}
+
+static inline bool is_pos_isdl_index(int32_t idx) {
+  return (((uint32_t) idx) & 1) == 0;
+}
+
+static void push_isdl_atom_index(isdl_astack_t *stack, int32_t k) {
+  uint32_t i;
+
+  i = stack->top;
+  if (i == stack->size) {
+    extend_isdl_astack(stack);
+  }
+  assert(i < stack->size);
+  stack->data[i] = k;
+  stack->top = i+1;
+}
+
+static inline void reset_isdl_astack(isdl_astack_t *stack) {
+  stack->top = 0;
+  stack->prop_ptr = 0;
+}
+
+static inline void delete_isdl_astack(isdl_astack_t *stack) {
+  safe_free(stack->data);
+  stack->data = NULL;
+}
+
+
+
+/*************************
+ *  UNDO AND PUSH STACKS *
+ ************************/
+
+static void init_isdl_undo_stack(isdl_undo_stack_t *stack, uint32_t n) {
+  assert(n < MAX_ISDL_UNDO_STACK_SIZE);
+  stack->size = n;
+  stack->top = 0;
+  stack->data = (isdl_undo_record_t *) safe_malloc(n * sizeof(isdl_undo_record_t));
+}
+
+static void push_isdl_undo_record(isdl_undo_stack_t *stack, uint32_t e, uint32_t a) {
+  uint32_t i, n;
+
+  i = stack->top;
+  n = stack->size;
+  if (i == n) {
+    n ++;
+    n += n>>1;
+    if (n >= MAX_ISDL_UNDO_STACK_SIZE) {
+      out_of_memory();
+    }
+    stack->data = (isdl_undo_record_t *) safe_realloc(stack->data, n * sizeof(isdl_undo_record_t));
+    stack->size = n;
+  }
+  assert(i < n);
+  stack->data[i].nedges = e;
+  stack->data[i].natoms = a;
+  stack->top = i+1;
+}
+
+static inline void reset_isdl_undo_stack(isdl_undo_stack_t *stack) {
+  stack->top = 0;
+}
+
+static inline void delete_isdl_undo_stack(isdl_undo_stack_t *stack) {
+  safe_free(stack->data);
+  stack->data = NULL;
+}
+
+
+static void init_isdl_trail_stack(isdl_trail_stack_t *stack) {
+  stack->size = 0;
+  stack->top = 0;
+  stack->data = NULL;
+}
+
+static void isdl_trail_stack_save(isdl_trail_stack_t *stack, uint32_t nv, uint32_t na) {
+  uint32_t i, n;
+
+  i = stack->top;
+  n = stack->size;
+  if (i == n) {
+    if (n == 0) {
+      n = DEFAULT_ISDL_TRAIL_SIZE;
+    } else {
+      n += n>>1;
+      if (n >= MAX_ISDL_TRAIL_SIZE) {
+        out_of_memory();
+      }
+    }
+    stack->data = (isdl_trail_t *) safe_realloc(stack->data, n * sizeof(isdl_trail_t));
+    stack->size = n;
+  }
+  assert(i < n);
+  stack->data[i].nvertices = nv;
+  stack->data[i].natoms = na;
+  stack->top = i+1;
+}
+
+static inline isdl_trail_t *isdl_trail_stack_top(isdl_trail_stack_t *stack) {
+  assert(stack->top > 0);
+  return stack->data + (stack->top - 1);
+}
+
+static inline void isdl_trail_stack_pop(isdl_trail_stack_t *stack) {
+  assert(stack->top > 0);
+  stack->top --;
+}
+
+static inline void reset_isdl_trail_stack(isdl_trail_stack_t *stack) {
+  stack->top = 0;
+}
+
+static inline void delete_isdl_trail_stack(isdl_trail_stack_t *stack) {
+  safe_free(stack->data);
+  stack->data = NULL;
+}
+
+
+
+/***********
+ *  GRAPH  *
+ **********/
+
+/*
+ * Add edge (x - y <= d) with literal l
+ * - return the edge index
+ */
+static int32_t isdl_push_edge(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d, literal_t l) {
+  isdl_edges_t *edges;
+  uint32_t i;
+
+  assert(0 <= x && x < solver->nvertices && 0 <= y && y < solver->nvertices && x != y);
+
+  edges = &solver->edges;
+  i = edges->top;
+  if (i == edges->size) {
+    extend_isdl_edges(edges);
+  }
+  assert(i < edges->size);
+  edges->source[i] = x;
+  edges->target[i] = y;
+  edges->cost[i] = d;
+  edges->lit[i] = l;
+  edges->top = i+1;
+
+  ivector_push(solver->vertices.out + x, i);
+  ivector_push(solver->vertices.in + y, i);
+
+  return i;
+}
+
+/*
+ * Remove all edges of index >= n
+ * - edges are removed in reverse order so each one is last
+ *   in its source and target vectors
+ */
+static void isdl_remove_edges(isdl_solver_t *solver, uint32_t n) {
+  isdl_edges_t *edges;
+  uint32_t i;
+
+  edges = &solver->edges;
+  assert(n <= edges->top);
+
+  i = edges->top;
+  while (i > n) {
+    i --;
+    assert(ivector_last(solver->vertices.out + edges->source[i]) == i);
+    assert(ivector_last(solver->vertices.in + edges->target[i]) == i);
+    ivector_pop(solver->vertices.out + edges->source[i]);
+    ivector_pop(solver->vertices.in + edges->target[i]);
+  }
+  edges->top = n;
+}
+
+
+/*
+ * Set flag f for vertex x and record x in the visited vector
+ */
+static inline void isdl_set_flag(isdl_solver_t *solver, int32_t x, uint8_t f) {
+  uint8_t *flag;
+
+  flag = solver->vertices.flag;
+  if (flag[x] == 0) {
+    ivector_push(&solver->visited, x);
+  }
+  flag[x] |= f;
+}
+
+/*
+ * Clear the flags of all visited vertices and empty the heap
+ */
+static void isdl_clear_search(isdl_solver_t *solver) {
+  ivector_t *v;
+  uint32_t i, n;
+
+  isdl_heap_clear(solver);
+  v = &solver->visited;
+  n = v->size;
+  for (i=0; i<n; i++) {
+    solver->vertices.flag[v->data[i]] = 0;
+  }
+  ivector_reset(v);
+  ivector_reset(&solver->settled);
+}
+
+
+/*
+ * Collect the literals on the path defined by pred_b from x
+ * - the path ends at the root of the backward search
+ * - true_literal is skipped
+ */
+static void isdl_collect_backward_path(isdl_solver_t *solver, int32_t x, ivector_t *v) {
+  isdl_edges_t *edges;
+  int32_t e;
+
+  edges = &solver->edges;
+  for (;;) {
+    e = solver->vertices.pred_b[x];
+    if (e < 0) break;
+    assert(edges->source[e] == x);
+    if (edges->lit[e] != true_literal) {
+      ivector_push(v, edges->lit[e]);
+    }
+    x = edges->target[e];
+  }
+}
+
+/*
+ * Collect the literals on the path defined by pred_f to x
+ * - the path starts at the root of the forward search
+ */
+static void isdl_collect_forward_path(isdl_solver_t *solver, int32_t x, ivector_t *v) {
+  isdl_edges_t *edges;
+  int32_t e;
+
+  edges = &solver->edges;
+  for (;;) {
+    e = solver->vertices.pred_f[x];
+    if (e < 0) break;
+    assert(edges->target[e] == x);
+    if (edges->lit[e] != true_literal) {
+      ivector_push(v, edges->lit[e]);
+    }
+    x = edges->source[e];
+  }
+}
+
+
+/*
+ * Update the potentials after edge e = (x - y <= d) is added:
+ * - if val[x] - val[y] > d, x must be decreased by gamma = val[x] - val[y] - d
+ *   then every vertex u with an edge (u - s <= c) to a decreased vertex s
+ *   may have to be decreased too.
+ * - the vertices are processed by decreasing gamma. Since the old
+ *   potentials satisfy all the other edges, this is Dijkstra's algorithm
+ *   on the reduced costs, and every vertex is updated at most once.
+ * - if y must be decreased, there's a negative circuit: e + the path
+ *   from y to x. Then the potentials are restored and the function
+ *   returns false. The path is stored in pred_b (from y).
+ *
+ * The key of a vertex u is -gamma(u). The old potentials of the updated
+ * vertices are kept in dist_f.
+ */
+static bool isdl_update_potentials(isdl_solver_t *solver, int32_t e) {
+  isdl_vtbl_t *vtbl;
+  isdl_edges_t *edges;
+  ivector_t *in;
+  int64_t gamma, g, new_val;
+  int32_t x, y, s, u, j;
+  uint32_t i, n;
+
+  vtbl = &solver->vertices;
+  edges = &solver->edges;
+  x = edges->source[e];
+  y = edges->target[e];
+
+  gamma = vtbl->val[x] - vtbl->val[y] - edges->cost[e];
+  if (gamma <= 0) {
+    return true;
+  }
+
+  assert(solver->visited.size == 0 && solver->heap.nelems == 0);
+
+  vtbl->key[x] = - gamma;
+  vtbl->pred_b[x] = e;
+  isdl_set_flag(solver, x, ISDL_B_SEEN);
+  isdl_heap_update(solver, x);
+
+  while (solver->heap.nelems > 0) {
+    s = isdl_heap_get_min(solver);
+    new_val = vtbl->val[s] + vtbl->key[s];
+    vtbl->dist_f[s] = vtbl->val[s];
+    vtbl->val[s] = new_val;
+    isdl_set_flag(solver, s, ISDL_B_DONE);
+    ivector_push(&solver->settled, s);
+    solver->stats.num_updates ++;
+
+    in = vtbl->in + s;
+    n = in->size;
+    for (i=0; i<n; i++) {
+      j = in->data[i];
+      u = edges->source[j];
+      if (vtbl->flag[u] & ISDL_B_DONE) continue;
+      g = vtbl->val[u] - new_val - edges->cost[j];
+      if (g > 0 && (!(vtbl->flag[u] & ISDL_B_SEEN) || -g < vtbl->key[u])) {
+        vtbl->key[u] = -g;
+        vtbl->pred_b[u] = j;
+        if (u == y) {
+          goto conflict;
+        }
+        isdl_set_flag(solver, u, ISDL_B_SEEN);
+        isdl_heap_update(solver, u);
+      }
+    }
+  }
+
+  isdl_clear_search(solver);
+  return true;
+
+ conflict:
+  // restore the potentials
+  n = solver->settled.size;
+  for (i=0; i<n; i++) {
+    s = solver->settled.data[i];
+    vtbl->val[s] = vtbl->dist_f[s];
+  }
+  // mark the end of the path at x
+  vtbl->pred_b[x] = null_isdl_edge;
+  return false;
+}
+
+
+/*
+ * Try to add edge (x - y <= d) with explanation l
+ * - if that causes a conflict, record the conflict in the core and return false
+ * - otherwise add the edge and return true
+ */
+static bool isdl_add_edge(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d, literal_t l) {
+  ivector_t *v;
+  uint32_t i, n;
+  int32_t e;
+
+  e = isdl_push_edge(solver, x, y, d, l);
+  if (isdl_update_potentials(solver, e)) {
+    ivector_push(&solver->new_edges, e);
+    return true;
+  }
+
+  // negative circuit: e + the path from y to x
+  v = &solver->expl_buffer;
+  ivector_reset(v);
+  isdl_collect_backward_path(solver, y, v);
+  isdl_clear_search(solver);
+  isdl_remove_edges(solver, e);
+  if (l != true_literal) {
+    ivector_push(v, l);
+  }
+  solver->stats.num_conflicts ++;
+
+  // the conflict clause is (not v[0]) or ... or (not v[n-1])
+  n = v->size;
+  for (i=0; i<n; i++) {
+    v->data[i] = not(v->data[i]);
+  }
+  ivector_push(v, null_literal);
+  record_theory_conflict(solver->core, v->data);
+
+  return false;
+}
+
+
+
+/**************************
+ *   THEORY PROPAGATION   *
+ *************************/
+
+/*
+ * Backward search from x: settle at most IDL_SPARSE_PROP_BOUND vertices
+ * that have a path to x.
+ * - the search uses the reduced cost of an edge (u - s <= c), that is,
+ *   c - val[u] + val[s] >= 0
+ * - for a settled vertex u, the length of the path u ---> x is
+ *   dist_b[u] + val[u] - val[x]
+ * - the settled vertices are added to solver->settled
+ */
+static void isdl_backward_search(isdl_solver_t *solver, int32_t x) {
+  isdl_vtbl_t *vtbl;
+  isdl_edges_t *edges;
+  ivector_t *in;
+  int64_t d;
+  int32_t s, u, j;
+  uint32_t i, n, count;
+
+  vtbl = &solver->vertices;
+  edges = &solver->edges;
+
+  vtbl->dist_b[x] = 0;
+  vtbl->key[x] = 0;
+  vtbl->pred_b[x] = null_isdl_edge;
+  isdl_set_flag(solver, x, ISDL_B_SEEN);
+  isdl_heap_update(solver, x);
+
+  count = 0;
+  while (solver->heap.nelems > 0 && count < IDL_SPARSE_PROP_BOUND) {
+    s = isdl_heap_get_min(solver);
+    isdl_set_flag(solver, s, ISDL_B_DONE);
+    ivector_push(&solver->settled, s);
+    count ++;
+
+    in = vtbl->in + s;
+    n = in->size;
+    for (i=0; i<n; i++) {
+      j = in->data[i];
+      u = edges->source[j];
+      if (vtbl->flag[u] & ISDL_B_DONE) continue;
+      d = vtbl->dist_b[s] + edges->cost[j] - vtbl->val[u] + vtbl->val[s];
+      assert(d >= vtbl->dist_b[s]);
+      if (!(vtbl->flag[u] & ISDL_B_SEEN) || d < vtbl->dist_b[u]) {
+        vtbl->dist_b[u] = d;
+        vtbl->key[u] = d;
+        vtbl->pred_b[u] = j;
+        isdl_set_flag(solver, u, ISDL_B_SEEN);
+        isdl_heap_update(solver, u);
+      }
+    }
+  }
+
+  isdl_heap_clear(solver);
+}
+
+/*
+ * Forward search from y: same thing on the outgoing edges.
+ * - for a settled vertex v, the length of the path y ---> v is
+ *   dist_f[v] + val[y] - val[v]
+ * - the settled vertices are not added to solver->settled
+ */
+static void isdl_forward_search(isdl_solver_t *solver, int32_t y) {
+  isdl_vtbl_t *vtbl;
+  isdl_edges_t *edges;
+  ivector_t *out;
+  int64_t d;
+  int32_t s, v, j;
+  uint32_t i, n, count;
+
+  vtbl = &solver->vertices;
+  edges = &solver->edges;
+
+  vtbl->dist_f[y] = 0;
+  vtbl->key[y] = 0;
+  vtbl->pred_f[y] = null_isdl_edge;
+  isdl_set_flag(solver, y, ISDL_F_SEEN);
+  isdl_heap_update(solver, y);
+
+  count = 0;
+  while (solver->heap.nelems > 0 && count < IDL_SPARSE_PROP_BOUND) {
+    s = isdl_heap_get_min(solver);
+    isdl_set_flag(solver, s, ISDL_F_DONE);
+    count ++;
+
+    out = vtbl->out + s;
+    n = out->size;
+    for (i=0; i<n; i++) {
+      j = out->data[i];
+      v = edges->target[j];
+      if (vtbl->flag[v] & ISDL_F_DONE) continue;
+      d = vtbl->dist_f[s] + edges->cost[j] - vtbl->val[s] + vtbl->val[v];
+      assert(d >= vtbl->dist_f[s]);
+      if (!(vtbl->flag[v] & ISDL_F_SEEN) || d < vtbl->dist_f[v]) {
+        vtbl->dist_f[v] = d;
+        vtbl->key[v] = d;
+        vtbl->pred_f[v] = j;
+        isdl_set_flag(solver, v, ISDL_F_SEEN);
+        isdl_heap_update(solver, v);
+      }
+    }
+  }
+
+  isdl_heap_clear(solver);
+}
+
+
+/*
+ * Build the antecedent for path u ---> x ---> y ---> v where x ---> y is edge e
+ * - return a null-terminated literal array allocated in the arena
+ */
+static literal_t *gen_isdl_prop_antecedent(isdl_solver_t *solver, int32_t u, int32_t e, int32_t v) {
+  ivector_t *w;
+  literal_t *expl;
+  literal_t l;
+  uint32_t i, n;
+
+  w = &solver->expl_buffer;
+  ivector_reset(w);
+  isdl_collect_backward_path(solver, u, w);
+  l = solver->edges.lit[e];
+  if (l != true_literal) {
+    ivector_push(w, l);
+  }
+  isdl_collect_forward_path(solver, v, w);
+
+  n = w->size;
+  expl = (literal_t *) arena_alloc(&solver->arena, (n + 1) * sizeof(int32_t));
+  for (i=0; i<n; i++) {
+    expl[i] = w->data[i];
+  }
+  expl[i] = null_literal;
+
+  return expl;
+}
+
+
+/*
+ * Propagation for edge e = (x - y <= d)
+ * - for every settled u in the backward search from x and settled v
+ *   in the forward search from y, there's a path u ---> v of length
+ *     len = dist(u, x) + d + dist(y, v)
+ *   so (u - v <= len) holds.
+ * - an atom (u - v <= c) is implied if len <= c
+ * - an atom (v - u <= c) is false if c < -len
+ */
+static void isdl_propagate_edge(isdl_solver_t *solver, int32_t e) {
+  isdl_vtbl_t *vtbl;
+  isdl_atbl_t *atbl;
+  isdl_atom_t *atom;
+  ivector_t *atoms;
+  literal_t *expl;
+  int64_t len_u;
+  int32_t x, y, u, v, k;
+  uint32_t i, j, n, m;
+
+  vtbl = &solver->vertices;
+  atbl = &solver->atoms;
+  x = solver->edges.source[e];
+  y = solver->edges.target[e];
+
+  assert(solver->visited.size == 0 && solver->settled.size == 0);
+
+  isdl_backward_search(solver, x);
+  isdl_forward_search(solver, y);
+
+  n = solver->settled.size;
+  for (i=0; i<n; i++) {
+    u = solver->settled.data[i];
+    // length of u ---> x ---> y
+    len_u = vtbl->dist_b[u] + vtbl->val[u] - vtbl->val[x] + solver->edges.cost[e];
+
+    atoms = vtbl->atoms + u;
+    m = atoms->size;
+    for (j=0; j<m; j++) {
+      k = atoms->data[j];
+      if (isdl_atom_is_assigned(atbl, k)) continue;
+      atom = get_isdl_atom(atbl, k);
+      if (atom->source == u) {
+        v = atom->target;
+        if ((vtbl->flag[v] & ISDL_F_DONE) &&
+            len_u + vtbl->dist_f[v] + vtbl->val[y] - vtbl->val[v] <= atom->cost) {
+          expl = gen_isdl_prop_antecedent(solver, u, e, v);
+          mark_isdl_atom_assigned(atbl, k);
+          push_isdl_atom_index(&solver->astack, mk_isdl_index(k, 0));
+          propagate_literal(solver->core, pos_lit(atom->boolvar), expl);
+          solver->stats.num_props ++;
+        }
+      } else {
+        assert(atom->target == u);
+        v = atom->source;
+        if ((vtbl->flag[v] & ISDL_F_DONE) &&
+            len_u + vtbl->dist_f[v] + vtbl->val[y] - vtbl->val[v] + atom->cost < 0) {
+          expl = gen_isdl_prop_antecedent(solver, u, e, v);
+          mark_isdl_atom_assigned(atbl, k);
+          push_isdl_atom_index(&solver->astack, mk_isdl_index(k, 1));
+          propagate_literal(solver->core, neg_lit(atom->boolvar), expl);
+          solver->stats.num_props ++;
+        }
+      }
+    }
+  }
+
+  isdl_clear_search(solver);
+}
+
+
+
+/*********************
+ *  VERTEX CREATION  *
+ ********************/
+
+/*
+ * Create a new vertex and return its index
+ */
+int32_t isdl_new_vertex(isdl_solver_t *solver) {
+  uint32_t n;
+
+  n = solver->nvertices;
+  if (n >= MAX_ISDL_VERTICES) {
+    return null_isdl_vertex;
+  }
+  if (n == solver->vertices.size) {
+    extend_isdl_vtbl(&solver->vertices);
+  }
+  assert(n < solver->vertices.size);
+  assert(solver->vertices.out[n].size == 0 && solver->vertices.in[n].size == 0 &&
+         solver->vertices.atoms[n].size == 0);
+  solver->vertices.val[n] = 0;
+  solver->nvertices = n + 1;
+  return n;
+}
+
+
+/*
+ * Get the zero vertex (create a new vertex if needed)
+ */
+int32_t isdl_zero_vertex(isdl_solver_t *solver) {
+  int32_t z;
+
+  z = solver->zero_vertex;
+  if (z == null_isdl_vertex) {
+    z = isdl_new_vertex(solver);
+    solver->zero_vertex = z;
+  }
+  return z;
+}
+
+
+
+/***************************
+ *  HASH-CONSING OF ATOMS  *
+ **************************/
+
+static inline uint32_t hash_isdl_atom(int32_t x, int32_t y, int32_t d) {
+  return jenkins_hash_triple(x, y, d, 0x5e1d0a37);
+}
+
+typedef struct isdlatom_hobj_s {
+  int_hobj_t m;
+  isdl_solver_t *solver;
+  int32_t source, target, cost;
+} isdlatom_hobj_t;
+
+static uint32_t hash_isdlatom(isdlatom_hobj_t *p) {
+  return hash_isdl_atom(p->source, p->target, p->cost);
+}
+
+static bool equal_isdlatom(isdlatom_hobj_t *p, int32_t id) {
+  isdl_atom_t *atm;
+
+  atm = get_isdl_atom(&p->solver->atoms, id);
+  return atm->source == p->source && atm->target == p->target && atm->cost == p->cost;
+}
+
+/*
+ * New atoms are added to the atom vectors of their two vertices
+ */
+static int32_t build_isdlatom(isdlatom_hobj_t *p) {
+  int32_t id;
+
+  id = new_isdl_atom(&p->solver->atoms, p->source, p->target, p->cost);
+  ivector_push(p->solver->vertices.atoms + p->source, id);
+  ivector_push(p->solver->vertices.atoms + p->target, id);
+  return id;
+}
+
+/*
+ * Atom constructor: use hash consing
+ * - if the atom is new, create a fresh boolean variable v
+ *   and attach the atom index to v in the core
+ */
+static bvar_t bvar_for_isdl_atom(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d) {
+  int32_t id;
+  isdl_atom_t *atm;
+  bvar_t v;
+  isdlatom_hobj_t atom_hobj;
+
+  atom_hobj.m.hash = (hobj_hash_t) hash_isdlatom;
+  atom_hobj.m.eq = (hobj_eq_t) equal_isdlatom;
+  atom_hobj.m.build = (hobj_build_t) build_isdlatom;
+  atom_hobj.solver = solver;
+  atom_hobj.source = x;
+  atom_hobj.target = y;
+  atom_hobj.cost = d;
+  id = int_htbl_get_obj(&solver->htbl, (int_hobj_t *) &atom_hobj);
+  atm = get_isdl_atom(&solver->atoms, id);
+  v = atm->boolvar;
+  if (v == null_bvar) {
+    v = create_boolean_variable(solver->core);
+    atm->boolvar = v;
+    attach_atom_to_bvar(solver->core, v, isdl_index2atom(id));
+  }
+  return v;
+}
+
+
+/*
+ * Get literal for atom (x - y <= d)
+ */
+literal_t isdl_make_atom(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d) {
+  assert(0 <= x && x < solver->nvertices && 0 <= y && y < solver->nvertices);
+
+  if (x == y) {
+    return (d >= 0) ? true_literal : false_literal;
+  }
+  return pos_lit(bvar_for_isdl_atom(solver, x, y, d));
+}
+
+
+
+/****************
+ *  ASSERTIONS  *
+ ***************/
+
+/*
+ * Assert (x - y <= d) as an axiom: attach true_literal to the edge
+ */
+void isdl_add_axiom_edge(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d) {
+  int32_t e;
+
+  assert(0 <= x && x < solver->nvertices && 0 <= y && y < solver->nvertices);
+  assert(solver->decision_level == solver->base_level);
+
+  if (solver->unsat_before_search) return;
+
+  if (x == y) {
+    if (d < 0) {
+      solver->unsat_before_search = true;
+    }
+    return;
+  }
+
+  e = isdl_push_edge(solver, x, y, d, true_literal);
+  if (! isdl_update_potentials(solver, e)) {
+    isdl_clear_search(solver);
+    isdl_remove_edges(solver, e);
+    solver->unsat_before_search = true;
+  }
+}
+
+
+/*
+ * Assert (x - y == d) as an axiom: (x - y <= d && y - x <= -d)
+ */
+void isdl_add_axiom_eq(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d) {
+  isdl_add_axiom_edge(solver, x, y, d);
+  isdl_add_axiom_edge(solver, y, x, -d);
+}
+
+
+
+/********************
+ *  SMT OPERATIONS  *
+ *******************/
+
+void isdl_start_internalization(isdl_solver_t *solver) {
+}
+
+/*
+ * Start search: if unsat flag is true, force a conflict in the core.
+ */
+void isdl_start_search(isdl_solver_t *solver) {
+  if (solver->unsat_before_search) {
+    record_empty_theory_conflict(solver->core);
+  }
+}
+
+/*
+ * Start a new decision level: save the number of edges and the size
+ * of the atom stack
+ */
+void isdl_increase_decision_level(isdl_solver_t *solver) {
+  assert(! solver->unsat_before_search);
+  assert(solver->astack.top == solver->astack.prop_ptr);
+
+  push_isdl_undo_record(&solver->stack, solver->edges.top, solver->astack.top);
+  solver->decision_level ++;
+  arena_push(&solver->arena);
+}
+
+
+/*
+ * Assert atom a (or its negation): push it into the propagation queue
+ */
+bool isdl_assert_atom(isdl_solver_t *solver, void *a, literal_t l) {
+  int32_t k;
+
+  k = isdl_atom2index(a);
+  assert(var_of(l) == get_isdl_atom(&solver->atoms, k)->boolvar);
+
+  if (! isdl_atom_is_assigned(&solver->atoms, k)) {
+    mark_isdl_atom_assigned(&solver->atoms, k);
+    push_isdl_atom_index(&solver->astack, mk_isdl_index(k, sign_of_lit(l)));
+  }
+
+  return true;
+}
+
+
+/*
+ * Add the edges of all atoms in the queue, then propagate
+ * implied atoms to the core.
+ */
+bool isdl_propagate(isdl_solver_t *solver) {
+  uint32_t i, n;
+  int32_t k, *a;
+  int32_t x, y, d;
+  literal_t l;
+  isdl_atom_t *atom;
+
+  ivector_reset(&solver->new_edges);
+
+  a = solver->astack.data;
+  n = solver->astack.top;
+  for (i=solver->astack.prop_ptr; i<n; i++) {
+    k = a[i];
+    atom = get_isdl_atom(&solver->atoms, isdl_atom_of_index(k));
+    // turn atom or its negation into (x - y <= d)
+    if (is_pos_isdl_index(k)) {
+      x = atom->source;
+      y = atom->target;
+      d = atom->cost;
+      l = pos_lit(atom->boolvar);
+    } else {
+      x = atom->target;
+      y = atom->source;
+      d = - atom->cost - 1;
+      l = neg_lit(atom->boolvar);
+    }
+
+    if (! isdl_add_edge(solver, x, y, d, l)) {
+      solver->astack.prop_ptr = n;
+      return false;
+    }
+  }
+  solver->astack.prop_ptr = n;
+
+  // theory propagation
+  if (solver->propagation) {
+    n = solver->new_edges.size;
+    for (i=0; i<n; i++) {
+      isdl_propagate_edge(solver, solver->new_edges.data[i]);
+    }
+  }
+  ivector_reset(&solver->new_edges);
+
+  // skip the implied atoms in the next call
+  solver->astack.prop_ptr = solver->astack.top;
+
+  return true;
+}
+
+
+/*
+ * Final check: do nothing and return SAT
+ */
+fcheck_code_t isdl_final_check(isdl_solver_t *solver) {
+  return FCHECK_SAT;
+}
+
+void isdl_clear(isdl_solver_t *solver) {
+}
+
+
+/*
+ * Expand explanation for literal l
+ */
+void isdl_expand_explanation(isdl_solver_t *solver, literal_t l, literal_t *expl, ivector_t *v) {
+  literal_t x;
+
+  for (;;) {
+    x = *expl ++;
+    if (x == null_literal) break;
+    ivector_push(v, x);
+  }
+}
+
+
+/*
+ * Backtrack to back_level: remove the edges and unassign the atoms
+ * - the potentials are still valid for the remaining edges
+ */
+void isdl_backtrack(isdl_solver_t *solver, uint32_t back_level) {
+  isdl_undo_record_t *undo;
+  uint32_t i, n;
+  int32_t *a;
+
+  assert(solver->base_level <= back_level && back_level < solver->decision_level);
+  assert(back_level + 1 < solver->stack.top);
+
+  undo = solver->stack.data + back_level + 1;
+  isdl_remove_edges(solver, undo->nedges);
+
+  n = undo->natoms;
+  i = solver->astack.top;
+  a = solver->astack.data;
+  while (i > n) {
+    i --;
+    mark_isdl_atom_unassigned(&solver->atoms, isdl_atom_of_index(a[i]));
+  }
+  solver->astack.top = n;
+  solver->astack.prop_ptr = n;
+
+  i = solver->decision_level;
+  do {
+    arena_pop(&solver->arena);
+    i --;
+  } while (i > back_level);
+
+  solver->stack.top = back_level + 1;
+  solver->decision_level = back_level;
+}
+
+
+/*
+ * Push: save the number of vertices and atoms
+ */
+void isdl_push(isdl_solver_t *solver) {
+  assert(solver->base_level == solver->decision_level);
+
+  dl_vartable_push(&solver->vtbl);
+  isdl_trail_stack_save(&solver->trail_stack, solver->nvertices, solver->atoms.natoms);
+  solver->base_level ++;
+  isdl_increase_decision_level(solver);
+  assert(solver->decision_level == solver->base_level);
+}
+
+
+/*
+ * Pop: remove the edges, atoms, and vertices created at the current base level
+ */
+void isdl_pop(isdl_solver_t *solver) {
+  isdl_trail_t *top;
+  isdl_atom_t *a;
+  uint32_t i, h, p;
+
+  assert(solver->base_level > 0 && solver->base_level == solver->decision_level);
+  top = isdl_trail_stack_top(&solver->trail_stack);
+
+  // remove the edges first
+  solver->base_level --;
+  isdl_backtrack(solver, solver->base_level);
+
+  dl_vartable_pop(&solver->vtbl);
+
+  // remove the atoms in reverse order, so each one is last in its vectors
+  p = top->natoms;
+  i = solver->atoms.natoms;
+  while (i > p) {
+    i --;
+    a = get_isdl_atom(&solver->atoms, i);
+    h = hash_isdl_atom(a->source, a->target, a->cost);
+    int_htbl_erase_record(&solver->htbl, h, i);
+    assert(ivector_last(solver->vertices.atoms + a->source) == i);
+    assert(ivector_last(solver->vertices.atoms + a->target) == i);
+    ivector_pop(solver->vertices.atoms + a->source);
+    ivector_pop(solver->vertices.atoms + a->target);
+  }
+  solver->atoms.natoms = p;
+
+  // remove the vertices
+  solver->nvertices = top->nvertices;
+  if (solver->zero_vertex >= (int32_t) solver->nvertices) {
+    solver->zero_vertex = null_isdl_vertex;
+  }
+
+  isdl_trail_stack_pop(&solver->trail_stack);
+}
+
+
+/*
+ * Reset
+ */
+void isdl_reset(isdl_solver_t *solver) {
+  solver->base_level = 0;
+  solver->decision_level = 0;
+  solver->unsat_before_search = false;
+
+  reset_dl_vartable(&solver->vtbl);
+
+  reset_isdl_vtbl(&solver->vertices, solver->nvertices);
+  solver->nvertices = 0;
+  solver->zero_vertex = null_isdl_vertex;
+  reset_isdl_edges(&solver->edges);
+  isdl_heap_clear(solver);
+
+  reset_isdl_atbl(&solver->atoms);
+  reset_isdl_astack(&solver->astack);
+  reset_isdl_undo_stack(&solver->stack);
+  reset_isdl_trail_stack(&solver->trail_stack);
+
+  reset_int_htbl(&solver->htbl);
+  arena_reset(&solver->arena);
+  ivector_reset(&solver->expl_buffer);
+  ivector_reset(&solver->aux_vector);
+  ivector_reset(&solver->visited);
+  ivector_reset(&solver->settled);
+  ivector_reset(&solver->new_edges);
+
+  solver->triple.target = nil_vertex;
+  solver->triple.source = nil_vertex;
+  q_clear(&solver->triple.constant);
+  reset_poly_buffer(&solver->buffer);
+
+  if (solver->value != NULL) {
+    safe_free(solver->value);
+    solver->value = NULL;
+  }
+
+  // undo record for level 0
+  push_isdl_undo_record(&solver->stack, 0, 0);
+}
+
+
+
+/*
+ * THEORY-BRANCHING
+ */
+
+/*
+ * Use the potentials: (x - y <= c) is true if val[x] - val[y] <= c
+ */
+literal_t isdl_select_polarity(isdl_solver_t *solver, void *a, literal_t l) {
+  isdl_atom_t *atom;
+  bvar_t v;
+
+  v = var_of(l);
+  atom = get_isdl_atom(&solver->atoms, isdl_atom2index(a));
+  assert(atom->boolvar == v);
+
+  if (solver->vertices.val[atom->source] - solver->vertices.val[atom->target] <= atom->cost) {
+    return pos_lit(v);
+  } else {
+    return neg_lit(v);
+  }
+}
+
+
+
+/**********************
+ *  INTERNALIZATION   *
+ *********************/
+
+/*
+ * Raise exception or abort
+ */
+static __attribute__ ((noreturn)) void isdl_exception(isdl_solver_t *solver, int code) {
+  if (solver->env != NULL) {
+    longjmp(*solver->env, code);
+  }
+  abort();
+}
+
+
+/*
+ * Store a triple (x, y, c) into the internal triple
+ * create/get the corresponding variable from vtbl.
+ * - x = target vertex
+ * - y = source vertex
+ * - c = constant
+ * This returns a variable id whose descriptor is (x - y + c).
+ */
+static thvar_t isdl_var_for_triple(isdl_solver_t *solver, int32_t x, int32_t y, int32_t c) {
+  dl_triple_t *triple;
+
+  triple = &solver->triple;
+  triple->target = x;
+  triple->source = y;
+  q_set32(&triple->constant, c);
+
+  return get_dl_var(&solver->vtbl, triple);
+}
+
+
+
+/*
+ * Apply renaming and substitution to polynomial p
+ * - map is a variable renaming: if p is a_0 t_0 + ... + a_n t_n
+ *   then map[i] is the theory variable x_i that replaces t_i.
+ * - so the function construct p = a_0 x_0 + ... + a_n x_n
+ * The result is stored into solver->buffer.
+ */
+static void isdl_rename_poly(isdl_solver_t *solver, polynomial_t *p, thvar_t *map) {
+  poly_buffer_t *b;
+  monomial_t *mono;
+  uint32_t i, n;
+
+  b = &solver->buffer;
+  reset_poly_buffer(b);
+
+  n = p->nterms;
+  mono = p->mono;
+
+  // deal with p's constant term if any
+  if (n > 0 && map[0] == null_thvar) {
+    assert(mono[0].var == const_idx);
+    poly_buffer_add_const(b, &mono[0].coeff);
+    n --;
+    map ++;
+    mono ++;
+  }
+
+  for (i=0; i<n; i++) {
+    assert(mono[i].var != const_idx);
+    addmul_dl_var_to_buffer(&solver->vtbl, b, map[i], &mono[i].coeff);
+  }
+
+  normalize_poly_buffer(b);
+}
+
+
+
+/*
+ * Create the zero_vertex but raise an exception if that fails.
+ */
+static int32_t isdl_get_zero_vertex(isdl_solver_t *solver) {
+  int32_t z;
+
+  z = isdl_zero_vertex(solver);
+  if (z < 0) {
+    isdl_exception(solver, TOO_MANY_ARITH_VARS);
+  }
+  return z;
+}
+
+
+/*
+ * Create the atom (x - y + c) == 0 for d = (x - y + c)
+ */
+static literal_t isdl_eq_from_triple(isdl_solver_t *solver, dl_triple_t *d) {
+  literal_t l1, l2;
+  int32_t c, x, y;
+
+  x = d->target;
+  y = d->source;
+
+  /*
+   * Check for trivial equality: we do this before attempting
+   * to  convert the constant to int32.
+   */
+  if (x == y) {
+    if (q_is_zero(&d->constant)) {
+      return true_literal;
+    } else {
+      return false_literal;
+    }
+  }
+
+  if (! q_get32(&d->constant, &c)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  /*
+   * d is (x - y + c)
+   */
+
+  // a nil_vertex in triples denote 'zero'
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  // v == 0 is the conjunction of (y - x <= c) and (x - y <= -c)
+  if (c == INT32_MIN) {
+    // we can't represent -c
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  l1 = isdl_make_atom(solver, y, x, c);  // atom (y - x <= c)
+  l2 = isdl_make_atom(solver, x, y, -c); // atom (x - y <= -c)
+  return mk_and_gate2(solver->gate_manager, l1, l2);
+}
+
+
+/*
+ * Create the atom (x - y + c) >= 0 for d = (x - y + c)
+ */
+static literal_t isdl_ge_from_triple(isdl_solver_t *solver, dl_triple_t *d) {
+  int32_t c, x, y;
+
+  x = d->target;
+  y = d->source;
+
+  /*
+   * Trivial case: don't convert the constant to int32
+   */
+  if (x == y) {
+    if (q_is_nonneg(&d->constant)) {
+      return true_literal;
+    } else {
+      return false_literal;
+    }
+  }
+
+  if (! q_get32(&d->constant, &c)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  // (x - y + c >= 0) is (y - x <= c)
+  return isdl_make_atom(solver, y, x, c);
+}
+
+
+/*
+ * Assert (x - y + c) == 0 or (x - y + c) != 0, given a triple d = x - y + c
+ * - tt true: assert the equality
+ * - tt false: assert the disequality
+ */
+static void isdl_assert_triple_eq(isdl_solver_t *solver, dl_triple_t *d, bool tt) {
+  int32_t x, y, c;
+  literal_t l1, l2;
+
+  x = d->target;
+  y = d->source;
+
+  if (x == y) {
+    // trivial case
+    if (q_is_zero(&d->constant) != tt) {
+      solver->unsat_before_search = true;
+    }
+    return;
+  }
+
+  if (! q_get32(&d->constant, &c)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  // d is (x - y + c)
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  if (tt) {
+    // (x - y + c) == 0 is equivalent to y - x == c
+    isdl_add_axiom_eq(solver, y, x, c);
+  } else {
+    // (x - y + c) != 0 is equivalent to
+    // (not (y - x <= c)) or (not (x - y <= -c))
+    if (c == INT32_MIN) {
+      isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+    }
+
+    l1 = isdl_make_atom(solver, y, x, c);   // atom (y - x <= c)
+    l2 = isdl_make_atom(solver, x, y, -c);  // atom (x - y <= -c)
+    add_binary_clause(solver->core, not(l1), not(l2));
+  }
+}
+
+
+/*
+ * Assert (x - y + c) >= 0 or (x - y + c) < 0, given a triple d = x - y + c
+ * - tt true: assert  (x - y + c) >= 0
+ * - tt false: assert (x - y + c) < 0
+ */
+static void isdl_assert_triple_ge(isdl_solver_t *solver, dl_triple_t *d, bool tt) {
+  int32_t x, y, c;
+
+  x = d->target;
+  y = d->source;
+
+  if (x == y) {
+    // trivial case
+    if (q_is_nonneg(&d->constant) != tt) {
+      solver->unsat_before_search = true;
+    }
+    return;
+  }
+
+  if (! q_get32(&d->constant, &c)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+  // d is (x - y + c)
+
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  if (tt) {
+    // (x - y + c) >= 0 is equivalent to (y - x <= c)
+    isdl_add_axiom_edge(solver, y, x, c);
+  } else {
+    // (x - y + c) < 0 is equivalent to (x - y <= -c-1)
+    // Note: (-c)-1 gives the right result even if c is INT32_MIN
+    isdl_add_axiom_edge(solver, x, y, -c-1);
+  }
+}
+
+
+/*
+ * TERM CONSTRUCTORS
+ */
+
+/*
+ * Create a new theory variable
+ * - is_int indicates whether the variable should be an integer,
+ *   so it should always be true for this solver.
+ * - raise exception NOT_IDL if is_int is false
+ * - raise exception TOO_MANY_VARS if we can't create a new vertex
+ *   for that variable
+ */
+thvar_t isdl_create_var(isdl_solver_t *solver, bool is_int) {
+  int32_t v;
+
+  if (! is_int) {
+    isdl_exception(solver, FORMULA_NOT_IDL);
+  }
+
+  v = isdl_new_vertex(solver);
+  if (v < 0) {
+    isdl_exception(solver, TOO_MANY_ARITH_VARS);
+  }
+
+  return isdl_var_for_triple(solver, v, nil_vertex, 0);
+}
+
+
+/*
+ * Create a variable that represents the constant q
+ * - fails if q is not an integer
+ */
+thvar_t isdl_create_const(isdl_solver_t *solver, rational_t *q) {
+  int32_t c;
+
+  if (! q_get32(q, &c)) {
+    /*
+     * We could do a more precise diagnosis here:
+     * There are two possibilities:
+     * q is not an integer
+     * q is an integer but it doesn't fit in 32bits
+     */
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  return isdl_var_for_triple(solver, nil_vertex, nil_vertex, c);
+}
+
+
+/*
+ * Create a variable for a polynomial p, with variables defined by map:
+ * - p is of the form a_0 t_0 + ... + a_n t_n where t_0, ..., t_n
+ *   are arithmetic terms.
+ * - map[i] is the theory variable x_i for t_i
+ *   (with map[0] = null_thvar if t_0 is const_idx)
+ * - the function constructs a variable equal to a_0 x_0 + ... + a_n x_n
+ *
+ * - fails if a_0 x_0 + ... + a_n x_n is not an IDL polynomial
+ *   (i.e., not of the form x - y + c)
+ */
+thvar_t isdl_create_poly(isdl_solver_t *solver, polynomial_t *p, thvar_t *map) {
+  poly_buffer_t *b;
+  dl_triple_t *triple;
+
+  // apply renaming and substitutions
+  isdl_rename_poly(solver, p, map);
+  b = &solver->buffer;
+
+  // b contains a_0 x_0 + ... + a_n x_n
+  triple = &solver->triple;
+  if (! convert_poly_buffer_to_dl_triple(b, triple) ||
+      ! q_is_int32(&triple->constant)) {
+    /*
+     * Exception here: either b is not of the right form
+     * or the constant is not an integer
+     * or the constant is an integer but it doesn't fit in 32bits
+     */
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  return get_dl_var(&solver->vtbl, triple);
+}
+
+
+/*
+ * Internalization for a product: always fails with NOT_IDL exception
+ */
+thvar_t isdl_create_pprod(isdl_solver_t *solver, pprod_t *p, thvar_t *map) {
+  isdl_exception(solver, FORMULA_NOT_IDL);
+}
+
+
+
+/*
+ * ATOM CONSTRUCTORS
+ */
+
+/*
+ * Create the atom v = 0
+ */
+literal_t isdl_create_eq_atom(isdl_solver_t *solver, thvar_t v) {
+  return isdl_eq_from_triple(solver, dl_var_triple(&solver->vtbl, v));
+}
+
+
+/*
+ * Create the atom v >= 0
+ */
+literal_t isdl_create_ge_atom(isdl_solver_t *solver, thvar_t v) {
+  return isdl_ge_from_triple(solver, dl_var_triple(&solver->vtbl, v));
+}
+
+
+/*
+ * Create the atom (v = w)
+ */
+literal_t isdl_create_vareq_atom(isdl_solver_t *solver, thvar_t v, thvar_t w) {
+  dl_triple_t *triple;
+
+  triple = &solver->triple;
+  if (! diff_dl_vars(&solver->vtbl, v, w, triple)) {
+    // v - w is not expressible as (target - source + c)
+    isdl_exception(solver, FORMULA_NOT_IDL);
+  }
+
+  return isdl_eq_from_triple(solver, triple);
+}
+
+
+/*
+ * Create the atom (p = 0)
+ * - map = variable renaming (as in create_poly)
+ */
+literal_t isdl_create_poly_eq_atom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map) {
+  poly_buffer_t *b;
+  dl_triple_t *triple;
+
+  // apply renaming and substitutions
+  isdl_rename_poly(solver, p, map);
+
+  b = &solver->buffer;
+  triple = &solver->triple;
+  if (! rescale_poly_buffer_to_dl_triple(b, triple)) {
+    // exception: p is not convertible to an IDL polynomial
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  return isdl_eq_from_triple(solver, triple);
+}
+
+
+
+/*
+ * Create the atom (p >= 0)
+ * - map = variable renaming (as in create_poly)
+ */
+literal_t isdl_create_poly_ge_atom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map) {
+  poly_buffer_t *b;
+  dl_triple_t *triple;
+
+  // apply renaming and substitutions
+  isdl_rename_poly(solver, p, map);
+
+  b = &solver->buffer;
+  triple = &solver->triple;
+  if (! rescale_poly_buffer_to_dl_triple(b, triple)) {
+    // exception: either p is not convertible to an IDL polynomial
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  return isdl_ge_from_triple(solver, triple);
+}
+
+
+
+
+/*
+ * TOP-LEVEL ASSERTIONS
+ */
+
+/*
+ * Assert the top-level constraint (v == 0) or (v != 0)
+ * - if tt is true: assert v == 0
+ * - if tt is false: assert v != 0
+ */
+void isdl_assert_eq_axiom(isdl_solver_t *solver, thvar_t v, bool tt) {
+  isdl_assert_triple_eq(solver, dl_var_triple(&solver->vtbl, v), tt);
+}
+
+
+/*
+ * Assert the top-level constraint (v >= 0) or (v < 0)
+ * - if tt is true: assert (v >= 0)
+ * - if tt is false: assert (v < 0)
+ */
+void isdl_assert_ge_axiom(isdl_solver_t *solver, thvar_t v, bool tt) {
+  isdl_assert_triple_ge(solver, dl_var_triple(&solver->vtbl, v), tt);
+}
+
+
+/*
+ * Assert (p == 0) or (p != 0) depending on tt
+ */
+void isdl_assert_poly_eq_axiom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map, bool tt) {
+  poly_buffer_t *b;
+  dl_triple_t *triple;
+
+  // apply renaming and substitutions
+  isdl_rename_poly(solver, p, map);
+
+  b = &solver->buffer;
+  triple = &solver->triple;
+  if (! rescale_poly_buffer_to_dl_triple(b, triple)) {
+    // exception: p is not convertible to an IDL polynomial
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  isdl_assert_triple_eq(solver, triple, tt);
+}
+
+
+/*
+ * Assert (p >= 0) or (p < 0) depending on tt
+ */
+void isdl_assert_poly_ge_axiom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map, bool tt) {
+  poly_buffer_t *b;
+  dl_triple_t *triple;
+
+  // apply renaming and substitutions
+  isdl_rename_poly(solver, p, map);
+
+  b = &solver->buffer;
+  triple = &solver->triple;
+  if (! rescale_poly_buffer_to_dl_triple(b, triple)) {
+    // exception:  p is not convertible to an IDL polynomial
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  isdl_assert_triple_ge(solver, triple, tt);
+}
+
+
+
+/*
+ * Assert (v == w) or (v != w)
+ * - if tt is true: assert (v == w)
+ * - if tt is false: assert (v != w)
+ */
+void isdl_assert_vareq_axiom(isdl_solver_t *solver, thvar_t v, thvar_t w, bool tt) {
+  dl_triple_t *triple;
+
+  triple = &solver->triple;
+  if (! diff_dl_vars(&solver->vtbl, v, w, triple)) {
+    isdl_exception(solver, FORMULA_NOT_IDL);
+  }
+
+  isdl_assert_triple_eq(solver, triple, tt);
+}
+
+
+
+
+/*
+ * Assert (c ==> v == w)
+ */
+void isdl_assert_cond_vareq_axiom(isdl_solver_t *solver, literal_t c, thvar_t v, thvar_t w) {
+  dl_triple_t *triple;
+  int32_t x, y, d;
+  literal_t l1, l2;
+
+  triple = &solver->triple;
+  if (! diff_dl_vars(&solver->vtbl, v, w, triple)) {
+    isdl_exception(solver, FORMULA_NOT_IDL);
+  }
+
+  x = triple->target;
+  y = triple->source;
+  // v == w is equivalent to (x - y + triple.constant) == 0
+
+  if (x == y) {
+    if (q_is_nonzero(&triple->constant)) {
+      // (x - y + constant) == 0 is false
+      add_unit_clause(solver->core, not(c));
+    }
+    return;
+  }
+
+  // convert the constant to int32_t d:
+  if (! q_get32(&triple->constant, &d)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  /*
+   * Assert (c ==> (x - y + d) == 0) as two clauses:
+   *  c ==> (y - x <= d)
+   *  c ==> (x - y <= -d)
+   */
+  if (d == INT32_MIN) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  l1 = isdl_make_atom(solver, y, x, d);  // (y - x <= d)
+  l2 = isdl_make_atom(solver, x, y, -d); // (x - y <= -d)
+  add_binary_clause(solver->core, not(c), l1);
+  add_binary_clause(solver->core, not(c), l2);
+}
+
+
+
+/*
+ * Assert (c[0] \/ .... \/ c[n-1] \/ v == w)
+ */
+void isdl_assert_clause_vareq_axiom(isdl_solver_t *solver, uint32_t n, literal_t *c, thvar_t v, thvar_t w) {
+  dl_triple_t *triple;
+  ivector_t *aux;
+  int32_t x, y, d;
+  literal_t l1, l2;
+
+  triple = &solver->triple;
+  if (! diff_dl_vars(&solver->vtbl, v, w, triple)) {
+    isdl_exception(solver, FORMULA_NOT_IDL);
+  }
+
+  x = triple->target;
+  y = triple->source;
+
+  // v == w is equivalent to (x - y + constant) == 0
+  if (x == y) {
+    if (q_is_nonzero(&triple->constant)) {
+      // (x - y + d) == 0 is false
+      add_clause(solver->core, n, c);
+    }
+    return;
+  }
+
+  // convert constant to a 32bit integer
+  if (! q_get32(&triple->constant, &d)) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  if (x < 0) {
+    x = isdl_get_zero_vertex(solver);
+  } else if (y < 0) {
+    y = isdl_get_zero_vertex(solver);
+  }
+
+  /*
+   * Assert two clauses:
+   *  c[0] \/ ... \/ c[n-1] \/ (y - x <= d)
+   *  c[0] \/ ... \/ c[n-1] \/ (x - y <= -d)
+   */
+  if (d == INT32_MIN) {
+    isdl_exception(solver, ARITHSOLVER_EXCEPTION);
+  }
+
+  l1 = isdl_make_atom(solver, y, x, d);  // (y - x <= d)
+  l2 = isdl_make_atom(solver, x, y, -d); // (x - y <= -d)
+
+  aux = &solver->aux_vector;
+  assert(aux->size == 0);
+  ivector_copy(aux, c, n);
+
+  assert(aux->size == n);
+  ivector_push(aux, l1);
+  add_clause(solver->core, n+1, aux->data);
+
+  aux->data[n] = l2;
+  add_clause(solver->core, n+1, aux->data);
+
+  ivector_reset(aux);
+}
+
+
+
+
+/************************
+ *  MODEL CONSTRUCTION  *
+ ***********************/
+
+/*
+ * The potentials satisfy all the edges. We shift them so that the
+ * zero vertex gets value 0.
+ */
+void isdl_build_model(isdl_solver_t *solver) {
+  uint32_t i, n;
+  int64_t offset;
+
+  assert(solver->value == NULL);
+
+  n = solver->nvertices;
+  offset = 0;
+  if (solver->zero_vertex >= 0) {
+    offset = solver->vertices.val[solver->zero_vertex];
+  }
+
+  solver->value = (int64_t *) safe_malloc(n * sizeof(int64_t));
+  for (i=0; i<n; i++) {
+    solver->value[i] = solver->vertices.val[i] - offset;
+  }
+}
+
+
+/*
+ * Free the model
+ */
+void isdl_free_model(isdl_solver_t *solver) {
+  assert(solver->value != NULL);
+  safe_free(solver->value);
+  solver->value = NULL;
+}
+
+
+/*
+ * Value of variable x in the model
+ * - copy the value in v and return true
+ */
+bool isdl_value_in_model(isdl_solver_t *solver, thvar_t x, rational_t *v) {
+  dl_triple_t *d;
+  int64_t aux;
+
+  assert(solver->value != NULL && 0 <= x && x < solver->vtbl.nvars);
+  d = dl_var_triple(&solver->vtbl, x);
+
+  // d is of the form (target - source + constant)
+  aux = 0;
+  if (d->target >= 0) {
+    aux = isdl_vertex_value(solver, d->target);
+  }
+  if (d->source >= 0) {
+    aux -= isdl_vertex_value(solver, d->source);
+  }
+
+  q_set64(v, aux);
+  q_add(v, &d->constant);
+
+  return true;
+}
+
+
+/*
+ * Interface function: check whether x is an integer variable.
+ */
+bool isdl_var_is_integer(isdl_solver_t *solver, thvar_t x) {
+  assert(0 <= x && x < solver->vtbl.nvars);
+  return true;
+}
+
+
+
+/***************************
+ *  INTERFACE DESCRIPTORS  *
+ **************************/
+
+static th_ctrl_interface_t isdl_control = {
+  (start_intern_fun_t) isdl_start_internalization,
+  (start_fun_t) isdl_start_search,
+  (propagate_fun_t) isdl_propagate,
+  (final_check_fun_t) isdl_final_check,
+  (increase_level_fun_t) isdl_increase_decision_level,
+  (backtrack_fun_t) isdl_backtrack,
+  (push_fun_t) isdl_push,
+  (pop_fun_t) isdl_pop,
+  (reset_fun_t) isdl_reset,
+  (clear_fun_t) isdl_clear,
+};
+
+/*
+ * SMT interface: delete_atom and end_atom_deletion are not supported.
+ */
+static th_smt_interface_t isdl_smt = {
+  (assert_fun_t) isdl_assert_atom,
+  (expand_expl_fun_t) isdl_expand_explanation,
+  (select_pol_fun_t) isdl_select_polarity,
+  NULL,
+  NULL,
+};
+
+/*
+ * Internalization interface
+ */
+static arith_interface_t isdl_intern = {
+  (create_arith_var_fun_t) isdl_create_var,
+  (create_arith_const_fun_t) isdl_create_const,
+  (create_arith_poly_fun_t) isdl_create_poly,
+  (create_arith_pprod_fun_t) isdl_create_pprod,
+
+  (create_arith_atom_fun_t) isdl_create_eq_atom,
+  (create_arith_atom_fun_t) isdl_create_ge_atom,
+  (create_arith_patom_fun_t) isdl_create_poly_eq_atom,
+  (create_arith_patom_fun_t) isdl_create_poly_ge_atom,
+  (create_arith_vareq_atom_fun_t) isdl_create_vareq_atom,
+
+  (assert_arith_axiom_fun_t) isdl_assert_eq_axiom,
+  (assert_arith_axiom_fun_t) isdl_assert_ge_axiom,
+  (assert_arith_paxiom_fun_t) isdl_assert_poly_eq_axiom,
+  (assert_arith_paxiom_fun_t) isdl_assert_poly_ge_axiom,
+  (assert_arith_vareq_axiom_fun_t) isdl_assert_vareq_axiom,
+  (assert_arith_cond_vareq_axiom_fun_t) isdl_assert_cond_vareq_axiom,
+  (assert_arith_clause_vareq_axiom_fun_t) isdl_assert_clause_vareq_axiom,
+
+  NULL, // attach_eterm is not supported
+  NULL, // eterm of var is not supported
+
+  (build_model_fun_t) isdl_build_model,
+  (free_model_fun_t) isdl_free_model,
+  (arith_val_in_model_fun_t) isdl_value_in_model,
+
+  (arith_var_is_int_fun_t) isdl_var_is_integer,
+};
+
+
+
+/*****************
+ *  FULL SOLVER  *
+ ****************/
+
+/*
+ * Initialize solver:
+ * - core = attached smt_core solver
+ * - gates = the attached gate manager
+ */
+void init_isdl_solver(isdl_solver_t *solver, smt_core_t *core, gate_manager_t *gates) {
+  solver->core = core;
+  solver->gate_manager = gates;
+  solver->base_level = 0;
+  solver->decision_level = 0;
+  solver->unsat_before_search = false;
+  solver->propagation = false;
+
+  init_dl_vartable(&solver->vtbl);
+
+  solver->nvertices = 0;
+  solver->zero_vertex = null_isdl_vertex;
+  init_isdl_vtbl(&solver->vertices, DEFAULT_ISDL_VTBL_SIZE);
+  init_isdl_edges(&solver->edges, DEFAULT_ISDL_EDGES_SIZE);
+  init_isdl_heap(&solver->heap, DEFAULT_ISDL_HEAP_SIZE);
+
+  init_isdl_atbl(&solver->atoms, DEFAULT_ISDL_ATBL_SIZE);
+  init_isdl_astack(&solver->astack, DEFAULT_ISDL_ASTACK_SIZE);
+  init_isdl_undo_stack(&solver->stack, DEFAULT_ISDL_UNDO_STACK_SIZE);
+  init_isdl_trail_stack(&solver->trail_stack);
+
+  solver->stats.num_conflicts = 0;
+  solver->stats.num_props = 0;
+  solver->stats.num_updates = 0;
+
+  init_int_htbl(&solver->htbl, 0);
+  init_arena(&solver->arena);
+  init_ivector(&solver->expl_buffer, DEFAULT_ISDL_BUFFER_SIZE);
+  init_ivector(&solver->aux_vector, DEFAULT_ISDL_BUFFER_SIZE);
+  init_ivector(&solver->visited, DEFAULT_ISDL_BUFFER_SIZE);
+  init_ivector(&solver->settled, DEFAULT_ISDL_BUFFER_SIZE);
+  init_ivector(&solver->new_edges, DEFAULT_ISDL_BUFFER_SIZE);
+
+  solver->triple.target = nil_vertex;
+  solver->triple.source = nil_vertex;
+  q_init(&solver->triple.constant);
+  init_poly_buffer(&solver->buffer);
+
+  solver->value = NULL;
+  solver->env = NULL;
+
+  // undo record for level 0
+  push_isdl_undo_record(&solver->stack, 0, 0);
+}
+
+
+/*
+ * Delete solver
+ */
+void delete_isdl_solver(isdl_solver_t *solver) {
+  delete_dl_vartable(&solver->vtbl);
+  delete_isdl_vtbl(&solver->vertices);
+  delete_isdl_edges(&solver->edges);
+  delete_isdl_heap(&solver->heap);
+  delete_isdl_atbl(&solver->atoms);
+  delete_isdl_astack(&solver->astack);
+  delete_isdl_undo_stack(&solver->stack);
+  delete_isdl_trail_stack(&solver->trail_stack);
+
+  delete_int_htbl(&solver->htbl);
+  delete_arena(&solver->arena);
+  delete_ivector(&solver->expl_buffer);
+  delete_ivector(&solver->aux_vector);
+  delete_ivector(&solver->visited);
+  delete_ivector(&solver->settled);
+  delete_ivector(&solver->new_edges);
+
+  q_clear(&solver->triple.constant);
+  delete_poly_buffer(&solver->buffer);
+
+  if (solver->value != NULL) {
+    safe_free(solver->value);
+    solver->value = NULL;
+  }
+}
+
+
+/*
+ * Attach a jump buffer
+ */
+void isdl_solver_init_jmpbuf(isdl_solver_t *solver, jmp_buf *buffer) {
+  solver->env = buffer;
+}
+
+
+/*
+ * Get the control and smt interfaces
+ */
+th_ctrl_interface_t *isdl_ctrl_interface(isdl_solver_t *solver) {
+  return &isdl_control;
+}
+
+th_smt_interface_t *isdl_smt_interface(isdl_solver_t *solver) {
+  return &isdl_smt;
+}
+
+
+/*
+ * Get the internalization interface
+ */
+arith_interface_t *isdl_arith_interface(isdl_solver_t *solver) {
+  return &isdl_intern;
+}
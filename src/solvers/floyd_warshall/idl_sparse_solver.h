@@ -0,0 +1,581 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * SPARSE SOLVER FOR INTEGER DIFFERENCE LOGIC
+ */
+
+/*
+ * This solver is an alternative to the Floyd-Warshall solver for
+ * problems with many variables and few constraints per variable. It
+ * doesn't keep a distance matrix, so it uses memory linear in the
+ * number of vertices and edges, and it has no limit on the number of
+ * vertices.
+ *
+ * Graph representation:
+ * - an edge from x to y of cost d encodes the assertion (x - y <= d)
+ * - edges are stored in a stack (added and removed in FIFO order)
+ * - each vertex keeps the indices of its outgoing and incoming edges
+ *
+ * Consistency check:
+ * - the solver maintains a potential val[x] for every vertex x such
+ *   that val[x] - val[y] <= d for every edge (x - y <= d)
+ * - when an edge x ---> y is added and it's violated by val, the
+ *   potentials of x and of the vertices that have a path to x are
+ *   decreased. This is a Dijkstra-like search on the incoming edges
+ *   (cf. Cotton & Maler, Fast and Flexible Difference Constraint
+ *   Propagation for DPLL(T), SAT 2006).
+ * - if y must be decreased, then the graph has a negative circuit.
+ * - any subset of a consistent set of edges is consistent for the same
+ *   potentials, so nothing needs to be restored on backtracking.
+ * - val is also the model.
+ *
+ * Theory propagation (disabled by default):
+ * - after an edge x ---> y is added, we search for short paths
+ *   u ---> x and y ---> v, using the potentials to make the edge
+ *   costs non-negative. The two searches stop after a fixed number
+ *   of vertices (IDL_SPARSE_PROP_BOUND).
+ * - then the atoms (u - v <= c) and (v - u <= c) are checked against
+ *   the path u ---> x ---> y ---> v.
+ * - this reduces the number of conflicts but the searches cost more
+ *   than they save on the problems we tried (random sparse problems
+ *   and job-shop scheduling with 1000 to 5000 variables).
+ *
+ * There's no sparse solver for real difference logic: large RDL
+ * problems go to simplex.
+ *
+ * The solver can't be attached to the egraph.
+ */
+
+#ifndef __IDL_SPARSE_SOLVER_H
+#define __IDL_SPARSE_SOLVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+
+#include "context/context_types.h"
+#include "solvers/cdcl/smt_core.h"
+#include "solvers/floyd_warshall/dl_vartable.h"
+#include "terms/poly_buffer.h"
+#include "utils/arena.h"
+#include "utils/bitvectors.h"
+#include "utils/int_hash_tables.h"
+#include "utils/int_vectors.h"
+
+
+/***********
+ *  GRAPH  *
+ **********/
+
+/*
+ * Edge and vertex indices are signed 32 bit integers
+ * - null_isdl_edge = -1 and null_isdl_vertex = -1 are markers
+ */
+enum {
+  null_isdl_edge = -1,
+  null_isdl_vertex = -1,
+};
+
+
+/*
+ * Edge stack:
+ * - for edge i: source[i], target[i], cost[i] define the edge
+ * - lit[i] = the literal that caused the edge to be added
+ *   (true_literal if the edge is an axiom)
+ */
+typedef struct isdl_edges_s {
+  uint32_t size;
+  uint32_t top;
+  int32_t *source;
+  int32_t *target;
+  int32_t *cost;
+  literal_t *lit;
+} isdl_edges_t;
+
+#define DEFAULT_ISDL_EDGES_SIZE 100
+#define MAX_ISDL_EDGES_SIZE (UINT32_MAX/sizeof(int32_t))
+
+
+/*
+ * Vertex table: for each vertex x
+ * - val[x] = potential of x
+ * - out[x] = vector of edges whose source is x
+ * - in[x] = vector of edges whose target is x
+ * - atoms[x] = vector of atoms whose source or target is x
+ *
+ * Data used by the searches:
+ * - key[x] = key in the heap
+ * - dist_b[x], pred_b[x] = distance and edge for the backward search
+ * - dist_f[x], pred_f[x] = distance and edge for the forward search
+ * - flag[x] = marks (see idl_sparse_solver.c)
+ * - hpos[x] = position of x in the heap (-1 if x is not in the heap)
+ */
+typedef struct isdl_vtbl_s {
+  uint32_t size;
+  int64_t *val;
+  ivector_t *out;
+  ivector_t *in;
+  ivector_t *atoms;
+
+  int64_t *key;
+  int64_t *dist_b;
+  int64_t *dist_f;
+  int32_t *pred_b;
+  int32_t *pred_f;
+  uint8_t *flag;
+  int32_t *hpos;
+} isdl_vtbl_t;
+
+#define DEFAULT_ISDL_VTBL_SIZE 100
+#define MAX_ISDL_VTBL_SIZE (UINT32_MAX/sizeof(ivector_t))
+
+
+/*
+ * Heap of vertices ordered by increasing key
+ * - data[0 ... nelems-1] = the heap
+ */
+typedef struct isdl_heap_s {
+  uint32_t size;
+  uint32_t nelems;
+  int32_t *data;
+} isdl_heap_t;
+
+#define DEFAULT_ISDL_HEAP_SIZE 100
+#define MAX_ISDL_HEAP_SIZE (UINT32_MAX/sizeof(int32_t))
+
+
+/*
+ * Maximal number of vertices visited in each direction for theory
+ * propagation.
+ */
+#define IDL_SPARSE_PROP_BOUND 100
+
+
+
+/***********
+ *  ATOMS  *
+ **********/
+
+/*
+ * Atom (source - target <= cost) attached to boolean variable boolvar
+ * - the atom index is attached to boolvar in the core
+ */
+typedef struct isdl_atom_s {
+  int32_t source;
+  int32_t target;
+  int32_t cost;
+  bvar_t boolvar;
+} isdl_atom_t;
+
+
+/*
+ * Atom table:
+ * - natoms = number of atoms
+ * - mark[i] = 1 if atom i is assigned (present in the atom stack)
+ */
+typedef struct isdl_atbl_s {
+  uint32_t size;
+  uint32_t natoms;
+  isdl_atom_t *atoms;
+  byte_t *mark;
+} isdl_atbl_t;
+
+#define DEFAULT_ISDL_ATBL_SIZE 100
+#define MAX_ISDL_ATBL_SIZE (UINT32_MAX/sizeof(isdl_atom_t))
+
+
+/*
+ * Atom stack & propagation queue (same encoding as in the
+ * Floyd-Warshall solver):
+ * - data[k] = atom index + sign bit (0 if the atom is true,
+ *   1 if it's false)
+ * - the atoms in data[prop_ptr ... top-1] are to be processed
+ */
+typedef struct isdl_astack_s {
+  uint32_t size;
+  uint32_t top;
+  uint32_t prop_ptr;
+  int32_t *data;
+} isdl_astack_t;
+
+#define DEFAULT_ISDL_ASTACK_SIZE 100
+#define MAX_ISDL_ASTACK_SIZE (UINT32_MAX/sizeof(int32_t))
+
+
+
+/****************
+ *  UNDO STACK  *
+ ***************/
+
+/*
+ * For each decision level: number of edges and of assigned atoms
+ * on entry to that level.
+ */
+typedef struct isdl_undo_record_s {
+  uint32_t nedges;
+  uint32_t natoms;
+} isdl_undo_record_t;
+
+typedef struct isdl_undo_stack_s {
+  uint32_t size;
+  uint32_t top;
+  isdl_undo_record_t *data;
+} isdl_undo_stack_t;
+
+#define DEFAULT_ISDL_UNDO_STACK_SIZE 100
+#define MAX_ISDL_UNDO_STACK_SIZE (UINT32_MAX/sizeof(isdl_undo_record_t))
+
+
+/*
+ * Push/pop stack: number of vertices and atoms on entry to each base level
+ */
+typedef struct isdl_trail_s {
+  uint32_t nvertices;
+  uint32_t natoms;
+} isdl_trail_t;
+
+typedef struct isdl_trail_stack_s {
+  uint32_t size;
+  uint32_t top;
+  isdl_trail_t *data;
+} isdl_trail_stack_t;
+
+#define DEFAULT_ISDL_TRAIL_SIZE 20
+#define MAX_ISDL_TRAIL_SIZE (UINT32_MAX/sizeof(isdl_trail_t))
+
+
+
+/****************
+ *  STATISTICS  *
+ ***************/
+
+typedef struct isdl_stats_s {
+  uint32_t num_conflicts;    // negative circuits found
+  uint32_t num_props;        // implied atoms
+  uint64_t num_updates;      // potential updates
+} isdl_stats_t;
+
+
+
+/*******************
+ *  SPARSE SOLVER  *
+ ******************/
+
+typedef struct isdl_solver_s {
+  /*
+   * Attached smt core + gate manager
+   */
+  smt_core_t *core;
+  gate_manager_t *gate_manager;
+
+  /*
+   * Base level and decision level (same interpretation as in smt_core)
+   */
+  uint32_t base_level;
+  uint32_t decision_level;
+
+  /*
+   * Unsat flag: set to true if the asserted axioms are inconsistent
+   */
+  bool unsat_before_search;
+
+  /*
+   * Theory propagation flag
+   */
+  bool propagation;
+
+  /*
+   * Variable table: every variable is mapped to a triple (x - y + c)
+   * where x and y are vertices.
+   */
+  dl_vartable_t vtbl;
+
+  /*
+   * Graph
+   */
+  uint32_t nvertices;
+  int32_t zero_vertex;
+  isdl_vtbl_t vertices;
+  isdl_edges_t edges;
+  isdl_heap_t heap;
+
+  /*
+   * Atoms
+   */
+  isdl_atbl_t atoms;
+  isdl_astack_t astack;
+
+  /*
+   * Backtracking and push/pop stacks
+   */
+  isdl_undo_stack_t stack;
+  isdl_trail_stack_t trail_stack;
+
+  /*
+   * Statistics
+   */
+  isdl_stats_t stats;
+
+  /*
+   * Auxiliary buffers and data structures
+   */
+  int_htbl_t htbl;        // for hash-consing of atoms
+  arena_t arena;          // for storing explanations of implied atoms
+  ivector_t expl_buffer;  // for constructing explanations
+  ivector_t aux_vector;   // general-purpose vector
+  ivector_t visited;      // vertices touched by a search
+  ivector_t settled;      // vertices removed from the heap in a search
+  ivector_t new_edges;    // edges added by the last call to propagate
+
+  dl_triple_t triple;     // for variable construction
+  poly_buffer_t buffer;   // for internal polynomial operations
+
+  /*
+   * Model: allocated when needed in build_model
+   */
+  int64_t *value;
+
+  /*
+   * Jump buffer for exception handling during internalization
+   */
+  jmp_buf *env;
+} isdl_solver_t;
+
+
+/*
+ * Maximal number of vertices: no limit other than the vertex table size
+ */
+#define MAX_ISDL_VERTICES MAX_ISDL_VTBL_SIZE
+
+#define DEFAULT_ISDL_BUFFER_SIZE 20
+
+
+
+
+/*********************
+ *  MAIN OPERATIONS  *
+ ********************/
+
+/*
+ * Initialize a solver
+ * - core = the attached smt-core object
+ * - gates = the attached gate manager
+ */
+extern void init_isdl_solver(isdl_solver_t *solver, smt_core_t *core, gate_manager_t *gates);
+
+/*
+ * Attach a jump buffer for internalization exceptions
+ */
+extern void isdl_solver_init_jmpbuf(isdl_solver_t *solver, jmp_buf *buffer);
+
+/*
+ * Enable/disable theory propagation (disabled by default)
+ */
+static inline void isdl_enable_propagation(isdl_solver_t *solver) {
+  solver->propagation = true;
+}
+
+static inline void isdl_disable_propagation(isdl_solver_t *solver) {
+  solver->propagation = false;
+}
+
+/*
+ * Delete: free all allocated memory
+ */
+extern void delete_isdl_solver(isdl_solver_t *solver);
+
+/*
+ * Get interface descriptors to attach solver to a core
+ */
+extern th_ctrl_interface_t *isdl_ctrl_interface(isdl_solver_t *solver);
+extern th_smt_interface_t  *isdl_smt_interface(isdl_solver_t *solver);
+
+/*
+ * Get interface descriptor for the internalization functions.
+ */
+extern arith_interface_t *isdl_arith_interface(isdl_solver_t *solver);
+
+
+
+
+/******************************
+ *  VERTEX AND ATOM CREATION  *
+ *****************************/
+
+/*
+ * Create a new vertex
+ * - return null_isdl_vertex if there are too many vertices
+ */
+extern int32_t isdl_new_vertex(isdl_solver_t *solver);
+
+/*
+ * Return the zero_vertex (create it if needed)
+ */
+extern int32_t isdl_zero_vertex(isdl_solver_t *solver);
+
+/*
+ * Create the atom (x - y <= d) and return the corresponding literal
+ * - x and y must be vertices in the solver
+ */
+extern literal_t isdl_make_atom(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d);
+
+/*
+ * Assert (x - y <= d) as an axiom
+ * - the solver must be at base level
+ * - if the edge causes a conflict, solver->unsat_before_search is set to true
+ */
+extern void isdl_add_axiom_edge(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d);
+
+/*
+ * Assert (x - y == d) as an axiom
+ */
+extern void isdl_add_axiom_eq(isdl_solver_t *solver, int32_t x, int32_t y, int32_t d);
+
+
+
+
+/*******************************
+ *  INTERNALIZATION FUNCTIONS  *
+ ******************************/
+
+/*
+ * These functions form the arith_interface descriptor. They're the
+ * same as for the Floyd-Warshall IDL solver (cf. idl_floyd_warshall.h).
+ */
+extern thvar_t isdl_create_var(isdl_solver_t *solver, bool is_int);
+extern thvar_t isdl_create_const(isdl_solver_t *solver, rational_t *q);
+extern thvar_t isdl_create_poly(isdl_solver_t *solver, polynomial_t *p, thvar_t *map);
+extern thvar_t isdl_create_pprod(isdl_solver_t *solver, pprod_t *p, thvar_t *map);
+
+extern literal_t isdl_create_eq_atom(isdl_solver_t *solver, thvar_t x);
+extern literal_t isdl_create_ge_atom(isdl_solver_t *solver, thvar_t x);
+extern literal_t isdl_create_poly_eq_atom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map);
+extern literal_t isdl_create_poly_ge_atom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map);
+extern literal_t isdl_create_vareq_atom(isdl_solver_t *solver, thvar_t x, thvar_t y);
+
+extern void isdl_assert_eq_axiom(isdl_solver_t *solver, thvar_t x, bool tt);
+extern void isdl_assert_ge_axiom(isdl_solver_t *solver, thvar_t x, bool tt);
+extern void isdl_assert_poly_eq_axiom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map, bool tt);
+extern void isdl_assert_poly_ge_axiom(isdl_solver_t *solver, polynomial_t *p, thvar_t *map, bool tt);
+extern void isdl_assert_vareq_axiom(isdl_solver_t *solver, thvar_t x, thvar_t y, bool tt);
+extern void isdl_assert_cond_vareq_axiom(isdl_solver_t *solver, literal_t c, thvar_t x, thvar_t y);
+extern void isdl_assert_clause_vareq_axiom(isdl_solver_t *solver, uint32_t n, literal_t *c, thvar_t x, thvar_t y);
+
+
+
+
+/**********************
+ *  SOLVER FUNCTIONS  *
+ *********************/
+
+/*
+ * These functions form the th_ctrl and th_smt interfaces.
+ */
+extern void isdl_start_search(isdl_solver_t *solver);
+extern void isdl_increase_decision_level(isdl_solver_t *solver);
+extern void isdl_backtrack(isdl_solver_t *solver, uint32_t back_level);
+extern void isdl_push(isdl_solver_t *solver);
+extern void isdl_pop(isdl_solver_t *solver);
+extern void isdl_reset(isdl_solver_t *solver);
+
+/*
+ * Push an assertion into the queue
+ * - atom is the index of an atom with boolean variable v
+ * - l is either pos_lit(v) or neg_lit(v)
+ */
+extern bool isdl_assert_atom(isdl_solver_t *solver, void *atom, literal_t l);
+
+/*
+ * Process the assertion queue then propagate implied atoms
+ * - return false if a conflict is detected
+ */
+extern bool isdl_propagate(isdl_solver_t *solver);
+
+/*
+ * Select the polarity of l that's true in the current potentials
+ */
+extern literal_t isdl_select_polarity(isdl_solver_t *solver, void *atom, literal_t l);
+
+/*
+ * Final check: do nothing and return SAT
+ */
+extern fcheck_code_t isdl_final_check(isdl_solver_t *solver);
+
+/*
+ * Explain why literal l is true (expl is a null-terminated array of literals)
+ */
+extern void isdl_expand_explanation(isdl_solver_t *solver, literal_t l, literal_t *expl, ivector_t *v);
+
+
+
+
+/************************
+ *  MODEL CONSTRUCTION  *
+ ***********************/
+
+/*
+ * Build a model: copy the potentials, shifted so that the zero
+ * vertex has value 0.
+ */
+extern void isdl_build_model(isdl_solver_t *solver);
+
+/*
+ * Value of vertex x in the model
+ */
+static inline int64_t isdl_vertex_value(isdl_solver_t *solver, int32_t x) {
+  assert(solver->value != NULL && 0 <= x && x < solver->nvertices);
+  return solver->value[x];
+}
+
+/*
+ * Value of variable v in the model
+ */
+extern bool isdl_value_in_model(isdl_solver_t *solver, thvar_t v, rational_t *q);
+
+/*
+ * Free the model
+ */
+extern void isdl_free_model(isdl_solver_t *solver);
+
+
+
+
+/*****************
+ *  STATISTICS   *
+ ****************/
+
+static inline uint32_t isdl_num_vars(isdl_solver_t *solver) {
+  return solver->vtbl.nvars;
+}
+
+static inline uint32_t isdl_num_atoms(isdl_solver_t *solver) {
+  return solver->atoms.natoms;
+}
+
+static inline uint32_t isdl_num_vertices(isdl_solver_t *solver) {
+  return solver->nvertices;
+}
+
+static inline uint32_t isdl_num_edges(isdl_solver_t *solver) {
+  return solver->edges.top;
+}
+
+
+#endif /* __IDL_SPARSE_SOLVER_H */
@@ -545,6 +545,8 @@ static void init_fun_solver_statistics(fun_solver_stats_t *stat) {
   stat->num_update_axiom1 = 0;
   stat->num_update_axiom2 = 0;
   stat->num_extensionality_axiom = 0;
+  stat->num_eager_checks = 0;
+  stat->num_eager_axiom2 = 0;
 }
 
 static inline void reset_fun_solver_statistics(fun_solver_stats_t *stat) {
@@ -1438,6 +1440,36 @@ static bool masking_edge(fun_solver_t *solver, int32_t i, composite_t *c) {
 }
 
 
+/*
+ * Stronger check used during propagation: edge i is non-masking
+ * for c if one of its indices is known to be distinct from the
+ * corresponding argument of c. In final check, all atoms are
+ * assigned so the two tests agree. During the search, masking_edge
+ * may return false for an edge whose indices are not assigned yet,
+ * and the resulting update lemma would not propagate anything.
+ */
+static bool known_nonmasking_edge(fun_solver_t *solver, int32_t i, composite_t *c) {
+  egraph_t *egraph;
+  fun_edge_t *e;
+  uint32_t n, j;
+
+  assert(composite_kind(c) == COMPOSITE_APPLY && composite_arity(c) > 0);
+
+  egraph = solver->egraph;
+  e = get_edge(&solver->etbl, i);
+  n = composite_arity(c) - 1;
+
+  assert(solver->vtbl.arity[e->source] == n);
+
+  for (j=0; j<n; j++) {
+    if (egraph_check_diseq(egraph, e->index[j], composite_child(c, j+1))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
 /*
  * Check whether c = (apply f i_1 ... i_n) and d = (apply g j_1 ... j_n)
  * are equal in the egraph
@@ -1648,8 +1680,10 @@ static void fun_solver_add_axiom2(fun_solver_t *solver, thvar_t x, thvar_t z, co
  * - if there's a conflict, c may be added to vtbl->app[z] for some z's
  * - if a conflict is found, then an instance of the generalized update axiom 2
  *   is added to the core.
+ * - if eager is true, we follow only the edges that are known to be
+ *   non-masking for c (cf. known_nonmasking_edge)
  */
-static bool update_conflict_for_application(fun_solver_t *solver, thvar_t x, composite_t *c) {
+static bool update_conflict_for_application(fun_solver_t *solver, thvar_t x, composite_t *c, bool eager) {
   fun_queue_t *queue;
   egraph_t *egraph;
   fun_vartable_t *vtbl;
@@ -1701,7 +1735,8 @@ static bool update_conflict_for_application(fun_solver_t *solver, thvar_t x, com
           for (i=0; i<n; i++) {
             k = edges[i];
             y = adjacent_root(solver, z, k);
-            if (vtbl->pre[y] < 0 && !masking_edge(solver, k, c)) {
+            if (vtbl->pre[y] < 0 &&
+                (eager ? known_nonmasking_edge(solver, k, c) : !masking_edge(solver, k, c))) {
               // y not visited yet: add it to the queue
               fun_queue_push(queue, y);
               vtbl->pre[y] = k;
@@ -1744,9 +1779,10 @@ static thvar_t root_app_var(egraph_t *egraph, composite_t *c) {
 /*
  * Collect all applications and check for update conflicts
  * - the equivalence classes and roots must be set first
- * - return true if no conflict is found, false otherwise
+ * - eager is true if this is called from propagate
+ * - return true if a conflict is found, false otherwise
  */
-static bool update_conflicts(fun_solver_t *solver) {
+static bool update_conflicts(fun_solver_t *solver, bool eager) {
   egraph_t *egraph;
   ppart_t *pp;
   void **v;
@@ -1777,7 +1813,7 @@ static bool update_conflicts(fun_solver_t *solver) {
     for (j=0; j<m; j++) {
       c = v[j];
       x = root_app_var(egraph, c);
-      if (update_conflict_for_application(solver, x, c)) {
+      if (update_conflict_for_application(solver, x, c, eager)) {
         result = true;
         num_updates ++;
         // exit if max_update_conflicts is reached
@@ -1800,7 +1836,7 @@ static bool update_conflicts(fun_solver_t *solver) {
         congruence_table_is_root(&egraph->ctable, c, egraph->terms.label) &&
         ptr_partition_get_index(pp, c) >= 0) {
       x = root_app_var(egraph, c);
-      if (update_conflict_for_application(solver, x, c)) {
+      if (update_conflict_for_application(solver, x, c, eager)) {
         result = true;
         num_updates ++;
         // exit if max_update_conflicts is reached
@@ -1864,6 +1900,11 @@ void init_fun_solver(fun_solver_t *solver, smt_core_t *core,
   solver->max_update_conflicts = DEFAULT_MAX_UPDATE_CONFLICTS;
   solver->max_extensionality = DEFAULT_MAX_EXTENSIONALITY;
 
+  solver->eager_lemmas = false;
+  solver->eager_top = 0;
+  solver->eager_period = 1;
+  solver->eager_skip = 0;
+
   init_fun_vartable(&solver->vtbl);
   init_edge_table(&solver->etbl);
   init_fun_queue(&solver->queue);
@@ -1929,6 +1970,9 @@ void fun_solver_reset(fun_solver_t *solver) {
   solver->base_level = 0;
   solver->decision_level = 0;
   reset_fun_solver_statistics(&solver->stats);
+  solver->eager_top = 0;
+  solver->eager_period = 1;
+  solver->eager_skip = 0;
   reset_fun_vartable(&solver->vtbl);
   reset_edge_table(&solver->etbl);
   reset_fun_queue(&solver->queue);
@@ -2060,6 +2104,9 @@ void fun_solver_start_search(fun_solver_t *solver) {
   solver->stats.num_init_vars = solver->vtbl.nvars;
   solver->stats.num_init_edges = solver->etbl.nedges;
   solver->reconciled = false;
+  solver->eager_top = 0;
+  solver->eager_period = 1;
+  solver->eager_skip = 0;
 
 #if TRACE
   printf("\n=== START SEARCH ===\n");
@@ -2072,10 +2119,47 @@ void fun_solver_start_search(fun_solver_t *solver) {
 
 
 /*
- * Propagate: do nothing
- * - all the work is done in final_check
+ * Propagate: search for update conflicts if eager lemmas are enabled
+ * - the update edges form a weak-equivalence graph: if c = (apply f i)
+ *   and d = (apply g j) are distinct in the egraph, i == j, and there's
+ *   a path from f to g whose edges have indices known to be distinct
+ *   from i, then an instance of axiom 2 is added to the core (as a lemma).
+ *   All the antecedents of this lemma are true, so it propagates (c == d).
+ * - this is a restricted version of the search done in final_check.
+ *   It's done when the egraph has changed and there are no pending
+ *   lemmas, with a backoff if the previous checks found nothing.
+ *   Final check is still needed for completeness.
+ * - the lemmas are added on the fly so there's never a conflict here
  */
 bool fun_solver_propagate(fun_solver_t *solver) {
+  uint32_t n, top;
+
+  if (solver->eager_lemmas && solver->etbl.nedges > 0) {
+    top = egraph_num_equalities(solver->egraph);
+    if (top != solver->eager_top && !smt_core_has_pending_lemmas(solver->core)) {
+      solver->eager_top = top;
+      if (solver->eager_skip > 0) {
+        solver->eager_skip --;
+        return true;
+      }
+
+      solver->stats.num_eager_checks ++;
+      n = solver->stats.num_update_axiom2;
+      fun_solver_build_classes(solver);
+      (void) update_conflicts(solver, true);
+      fun_solver_cleanup(solver);
+      n = solver->stats.num_update_axiom2 - n;
+      solver->stats.num_eager_axiom2 += n;
+
+      if (n > 0) {
+        solver->eager_period = 1;
+      } else if (solver->eager_period < MAX_EAGER_PERIOD) {
+        solver->eager_period <<= 1;
+      }
+      solver->eager_skip = solver->eager_period - 1;
+    }
+  }
+
   return true;
 }
 
@@ -2111,7 +2195,7 @@ fcheck_code_t fun_solver_final_check(fun_solver_t *solver) {
   // check for update conflicts
   result = FCHECK_SAT;
   fun_solver_build_classes(solver);
-  if (update_conflicts(solver)) {
+  if (update_conflicts(solver, false)) {
 #if TRACE
     printf("---> FUN Solver: update conflict\n");
 #endif
@@ -196,6 +196,10 @@ typedef struct fun_solver_stats_s {
   uint32_t num_update_axiom1;
   uint32_t num_update_axiom2;
   uint32_t num_extensionality_axiom;
+
+  // eager checks done in propagate + axiom2 instances they generated
+  uint32_t num_eager_checks;
+  uint32_t num_eager_axiom2;
 } fun_solver_stats_t;
 
 
@@ -231,6 +235,23 @@ typedef struct fun_solver_s {
   uint32_t max_update_conflicts;
   uint32_t max_extensionality;
 
+  /*
+   * Eager update lemmas:
+   * - if eager_lemmas is true, propagate searches for update conflicts
+   *   (i.e., weak-equivalence paths between arrays that disagree on
+   *   an index) instead of waiting for final_check
+   * - eager_top = number of egraph equalities at the last eager check:
+   *   we skip the check if the egraph has not changed since then
+   * - eager_period/eager_skip: to limit the cost, a check that finds
+   *   no conflict doubles eager_period (up to MAX_EAGER_PERIOD) and the
+   *   next eager_period - 1 opportunities are skipped. A check that
+   *   finds conflicts resets the period to 1.
+   */
+  bool eager_lemmas;
+  uint32_t eager_top;
+  uint32_t eager_period;
+  uint32_t eager_skip;
+
   /*
    * Main components
    */
@@ -333,6 +354,11 @@ typedef struct fun_solver_s {
 #define DEFAULT_MAX_UPDATE_CONFLICTS 20
 #define DEFAULT_MAX_EXTENSIONALITY    1
 
+/*
+ * Bound on the interval between two eager checks
+ */
+#define MAX_EAGER_PERIOD 64
+
 
 
 
@@ -548,6 +574,24 @@ static inline uint32_t fun_solver_get_max_update_conflicts(fun_solver_t *solver)
 }
 
 
+/*
+ * Eager update lemmas: search for update conflicts in propagate
+ * and not only in final_check (disabled by default, enabled by
+ * the search parameter eager_array_lemmas)
+ */
+static inline void fun_solver_enable_eager_lemmas(fun_solver_t *solver) {
+  solver->eager_lemmas = true;
+}
+
+static inline void fun_solver_disable_eager_lemmas(fun_solver_t *solver) {
+  solver->eager_lemmas = false;
+}
+
+static inline bool fun_solver_eager_lemmas_enabled(fun_solver_t *solver) {
+  return solver->eager_lemmas;
+}
+
+
 
 /****************
  *  STATISTICS  *
@@ -579,6 +623,18 @@ static inline uint32_t fun_solver_num_extensionality_axioms(fun_solver_t *solver
   return solver->stats.num_extensionality_axiom;
 }
 
+/*
+ * Eager checks and update axioms generated in propagate
+ * (these axioms are also counted in num_update2_axioms)
+ */
+static inline uint32_t fun_solver_num_eager_checks(fun_solver_t *solver) {
+  return solver->stats.num_eager_checks;
+}
+
+static inline uint32_t fun_solver_num_eager_axioms(fun_solver_t *solver) {
+  return solver->stats.num_eager_axiom2;
+}
+
 
 /********************************
  *  GARBAGE COLLECTION SUPPORT  *
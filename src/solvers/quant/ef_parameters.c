@@ -31,6 +31,7 @@ void init_ef_params(ef_param_t *p) {
 
   p->max_iters = DEF_MBQI_MAX_ITERS;
   p->max_numlearnt_per_round = DEF_MBQI_MAX_LEMMAS_PER_ROUND;
+  p->cex_workers = DEF_EF_CEX_WORKERS;
   p->ematching = DEF_EMATCH_EN;
 
   p->ematch_inst_per_round = DEFAULT_MAX_INSTANCES_PER_ROUND;
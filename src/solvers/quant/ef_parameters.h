@@ -30,6 +30,7 @@
 
 #define DEF_MBQI_MAX_ITERS              10000
 #define DEF_MBQI_MAX_LEMMAS_PER_ROUND   5
+#define DEF_EF_CEX_WORKERS              1
 #define DEF_EMATCH_EN   true
 
 typedef enum ef_gen_option {
@@ -46,6 +47,8 @@ typedef enum ef_gen_option {
  * - gen_mode = generalization method
  * - max_samples = number of samples (max) used in start (0 means no presampling)
  * - max_iters = bound on the outher iteration in efsolver
+ * - cex_workers = number of threads used to check the universal
+ *   constraints in parallel (1 means sequential checks)
  */
 typedef struct ef_param_s {
   bool flatten_iff;
@@ -55,6 +58,7 @@ typedef struct ef_param_s {
   uint32_t max_iters;
 
   uint32_t max_numlearnt_per_round;
+  uint32_t cex_workers;
   bool ematching;
 
   /*
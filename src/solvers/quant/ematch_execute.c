@@ -74,6 +74,17 @@ void init_ematch_exec(ematch_exec_t *exec, ematch_compile_t *comp, instance_tabl
   exec->max_fapps = DEF_MAX_FAPPS;
   exec->max_matches = DEF_MAX_MATCHES;
   exec->max_matches_per_yield = DEF_MAX_MATCHES_PER_YIELD;
+
+  exec->mtime = NULL;
+  exec->mtime_size = 0;
+  exec->matched = NULL;
+  exec->pidx = 0;
+  exec->valid_round = 0;
+  exec->skip_matched = false;
+  exec->truncated = false;
+  init_ivector(&exec->roots, 0);
+  exec->num_roots = 0;
+  exec->num_skipped = 0;
 }
 
 /*
@@ -86,6 +97,15 @@ void reset_ematch_exec(ematch_exec_t *exec) {
   ivector_reset(&exec->aux_vector2);
   int_hmap_reset(&exec->aux_map);
 
+  safe_free(exec->mtime);
+  exec->mtime = NULL;
+  exec->mtime_size = 0;
+  exec->matched = NULL;
+  exec->valid_round = 0;
+  ivector_reset(&exec->roots);
+  exec->num_roots = 0;
+  exec->num_skipped = 0;
+
   exec->comp = NULL;
   exec->itbl = NULL;
   exec->terms = NULL;
@@ -105,6 +125,12 @@ void delete_ematch_exec(ematch_exec_t *exec) {
   delete_ivector(&exec->aux_vector2);
   delete_int_hmap(&exec->aux_map);
 
+  safe_free(exec->mtime);
+  exec->mtime = NULL;
+  exec->mtime_size = 0;
+  exec->matched = NULL;
+  delete_ivector(&exec->roots);
+
   exec->comp = NULL;
   exec->itbl = NULL;
   exec->terms = NULL;
@@ -119,6 +145,21 @@ void delete_ematch_exec(ematch_exec_t *exec) {
  *   EGRAPH COMMANDS  *
  *********************/
 
+/*
+ * Check whether root t can be skipped: all its matches for the current
+ * pattern were found in some round r, and no class below t has changed
+ * since round r.
+ */
+static bool ematch_root_was_matched(ematch_exec_t *exec, eterm_t t) {
+  int_hmap2_rec_t *r;
+
+  if (exec->matched == NULL || t >= exec->mtime_size) {
+    return false;
+  }
+  r = int_hmap2_find(exec->matched, exec->pidx, t);
+  return r != NULL && r->val >= (int32_t) exec->valid_round && exec->mtime[t] <= (uint32_t) r->val;
+}
+
 /*
  * Collect function applications for function f in the class of occ, and push in aux vector
  */
@@ -152,7 +193,9 @@ static void egraph_get_all_fapps_in_class(ematch_exec_t *exec, eterm_t f, occ_t
         if (x == f) {
           // check if following if is redundant
           if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label)) {
-            if (composite_depth(egraph, p) < exec->fdepth) {
+            if (exec->skip_matched && ematch_root_was_matched(exec, ti)) {
+              exec->num_skipped ++;
+            } else if (composite_depth(egraph, p) < exec->fdepth) {
               occp = pos_occ(ti);
               ivector_push(aux, occp);
 
@@ -215,6 +258,7 @@ static void egraph_get_fapps_in_class_all(ematch_exec_t *exec, eterm_t f, occ_t
 #if TRACE
       printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+      exec->truncated = true;
       break;
     }
     ivector_push(out, aux->data[i]);
@@ -254,6 +298,7 @@ static void egraph_get_fapps_in_class_random(ematch_exec_t *exec, eterm_t f, occ
 #if TRACE
         printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+        exec->truncated = true;
         break;
       }
 
@@ -314,7 +359,9 @@ static void egraph_get_fapps_in_class_greedy(ematch_exec_t *exec, eterm_t f, occ
           if (generic_heap_member(main_heap, ti)) {
             // check if following if is redundant
             if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label)) {
-              if (composite_depth(egraph, p) < exec->fdepth) {
+              if (exec->skip_matched && ematch_root_was_matched(exec, ti)) {
+                exec->num_skipped ++;
+              } else if (composite_depth(egraph, p) < exec->fdepth) {
                 generic_heap_add(aux_heap, ti);
               } else {
 #if TRACE
@@ -358,6 +405,7 @@ static void egraph_get_fapps_in_class_greedy(ematch_exec_t *exec, eterm_t f, occ
 #if TRACE
       printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+      exec->truncated = true;
       break;
     }
 
@@ -778,6 +826,7 @@ static void ematch_exec_all_chooseapps(ematch_exec_t *exec, ematch_instr_t *inst
 #if TRACE
         printf("    chooseapp exit\n");
 #endif
+        exec->truncated = true;
         break;
       }
     }
@@ -1055,6 +1104,7 @@ static void ematch_exec_yield(ematch_exec_t *exec, ematch_instr_t *instr) {
 #if TRACE_LIGHT
         printf("    early exit\n");
 #endif
+        exec->truncated = true;
         reset_ematch_stack(&exec->bstack);
       }
     } else {
@@ -1171,6 +1221,7 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
   term_learner_t *term_learner;
   eterm_t tf;
   uint32_t max_matches_orig;
+  int_hmap2_t *matched;
 
 #if TRACE
   printf("  Pattern code:\n");
@@ -1187,11 +1238,16 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
   count = 0;
   x = NULL_TERM;
   term_learner = exec->term_learner;
+  matched = exec->matched;
+  ivector_reset(&exec->roots);
 
   if (kind == APP_TERM) {
     x = pat->p;
   } else if (kind == TUPLE_TERM) {
     x = tuple_term_desc(terms, pat->p)->arg[0];
+    // multi-pattern: the other fapps are taken from the whole egraph
+    // so a root can get new matches even if nothing changed below it
+    exec->matched = NULL;
   } else {
 //    printf("Unsupported pattern term (kind %d): ", kind);
 //    yices_pp_term(stdout, pat->p, 120, 1, 0);
@@ -1208,10 +1264,13 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
 
     init_ivector(&fapps, 4);
 
+    exec->skip_matched = true;
     egraph_get_all_fapps(exec, term_of_occ(occ), &fapps);
+    exec->skip_matched = false;
     n = fapps.size;
     for (i=0; i<n; i++) {
       tf = term_of_occ(fapps.data[i]);
+      exec->truncated = false;
 
 #if TRACE
       occ_t fapp = fapps.data[i];
@@ -1228,6 +1287,11 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
 
       ematch_exec_instr(exec, pat->code);
 
+      exec->num_roots ++;
+      if (!exec->truncated && exec->matched != NULL) {
+        ivector_push(&exec->roots, tf);
+      }
+
       ivector_remove_duplicates(aux);
       m = aux->size;
 
@@ -1256,6 +1320,7 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
     delete_ivector(&fapps);
   }
   exec->max_matches = max_matches_orig;
+  exec->matched = matched;
 
   return count;
 }
@@ -27,6 +27,7 @@
 #include "solvers/quant/ematch_instr_stack.h"
 #include "solvers/quant/ematch_instance.h"
 #include "solvers/quant/term_learner.h"
+#include "utils/int_hash_map2.h"
 
 
 
@@ -61,6 +62,30 @@ typedef struct ematch_exec_s {
 
   term_learner_t *term_learner;     // Reinforce learner
   iterate_kind_t *iter_mode;        // iteration mode
+
+  /*
+   * Incremental matching:
+   * - mtime[t] = last round in which a class below eterm t changed
+   *   (cf. quant_ematching.c), mtime_size = size of the array
+   * - matched = roots already matched for the current pattern
+   *   (NULL if all roots must be matched)
+   * - pidx = key of the current pattern in matched
+   * - valid_round = entries of matched older than this are ignored
+   * - skip_matched = true while collecting the roots
+   * - truncated = true if a limit was reached while matching a root
+   * - roots = roots fully matched by the last call to ematch_exec_pattern
+   */
+  uint32_t *mtime;
+  uint32_t mtime_size;
+  int_hmap2_t *matched;
+  int32_t pidx;
+  uint32_t valid_round;
+  bool skip_matched;
+  bool truncated;
+  ivector_t roots;
+
+  uint32_t num_roots;           // number of roots matched
+  uint32_t num_skipped;         // number of roots skipped
 } ematch_exec_t;
 
 
@@ -87,6 +112,9 @@ extern void ematch_exec_instr(ematch_exec_t *exec, int32_t idx);
 /*
  * Execute the code sequence for a pattern
  * - returns number of matches found
+ * - if exec->matched is non-NULL, the roots recorded there that
+ *   have not changed since they were matched are skipped
+ * - the roots for which all matches were found are stored in exec->roots
  */
 extern uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *filter, uint32_t nmatches);
 
@@ -71,6 +71,7 @@ void shrink_quant_table(quant_table_t *table, uint32_t n) {
     cnstr = &table->data[i];
     delete_index_vector(cnstr->patterns);
     delete_int_hset(&cnstr->instances);
+    delete_int_hmap2(&cnstr->matched);
 
     delete_index_vector(cnstr->uvars);
     delete_index_vector(cnstr->fun);
@@ -132,6 +133,7 @@ int32_t quant_table_add_cnstr(quant_table_t *qtbl, term_t t, int32_t *pv, uint32
   qcnstr->t = t;
   qcnstr->patterns = make_index_vector(pv, npv);
   init_int_hset(&qcnstr->instances, 0);
+  init_int_hmap2(&qcnstr->matched, 0);
   qcnstr->enable = NULL_TERM;
   qcnstr->enable_lit = null_literal;
 
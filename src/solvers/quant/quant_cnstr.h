@@ -25,6 +25,7 @@
 
 
 #include "solvers/quant/quant_pattern.h"
+#include "utils/int_hash_map2.h"
 
 
 /*
@@ -34,6 +35,7 @@ typedef struct quant_cnstr_s {
   term_t t;
   int32_t *patterns;  // pattern indices in pattern table
   int_hset_t instances; // match indices in instance table for whom instances are learnt
+  int_hmap2_t matched;  // map (pattern position, eterm) to the round where all matches of that root were learnt
 
   term_t *uvars;    // universal variables
   term_t *fun;      // functions that appear in the constraint
@@ -22,6 +22,8 @@
 
 
 #include "solvers/quant/quant_ematching.h"
+#include "solvers/egraph/egraph_utils.h"
+#include "utils/memalloc.h"
 
 
 #define TRACE 0
@@ -58,6 +60,17 @@ void init_ematch(ematch_globals_t *em) {
   init_ematch_exec(&em->exec, &em->comp, &em->instbl);
   init_int_hmap(&em->pattern2code, 0);
   init_instance_table(&em->instbl);
+
+  em->round = 0;
+  em->label = NULL;
+  em->nlabels = 0;
+  em->lsize = 0;
+  em->max_height = 0;
+  em->fdepth = 0;
+  em->vdepth = 0;
+  init_int_hset(&em->cmark, 0);
+  init_ivector(&em->aux, 0);
+  init_ivector(&em->aux2, 0);
 }
 
 /*
@@ -73,6 +86,15 @@ void reset_ematch(ematch_globals_t *em) {
   reset_ematch_exec(&em->exec);
   int_hmap_reset(&em->pattern2code);
   reset_instance_table(&em->instbl);
+
+  em->round = 0;
+  em->nlabels = 0;
+  em->max_height = 0;
+  em->fdepth = 0;
+  em->vdepth = 0;
+  int_hset_reset(&em->cmark);
+  ivector_reset(&em->aux);
+  ivector_reset(&em->aux2);
 }
 
 /*
@@ -88,6 +110,12 @@ void delete_ematch(ematch_globals_t *em) {
   delete_ematch_exec(&em->exec);
   delete_int_hmap(&em->pattern2code);
   delete_instance_table(&em->instbl);
+
+  safe_free(em->label);
+  em->label = NULL;
+  delete_int_hset(&em->cmark);
+  delete_ivector(&em->aux);
+  delete_ivector(&em->aux2);
 }
 
 /*
@@ -119,6 +147,39 @@ void ematch_attach_egraph(ematch_globals_t *em, egraph_t *egraph) {
   em->exec.term_learner->egraph = egraph;
 }
 
+/*
+ * Height of pattern term t: number of nested function applications
+ */
+static uint32_t pattern_height(term_table_t *terms, term_t t) {
+  composite_term_t *d;
+  uint32_t i, h, max;
+
+  max = 0;
+  switch (term_kind(terms, t)) {
+  case APP_TERM:
+    d = app_term_desc(terms, t);
+    for (i=1; i<d->arity; i++) {
+      h = pattern_height(terms, d->arg[i]);
+      if (h > max) max = h;
+    }
+    max ++;
+    break;
+
+  case TUPLE_TERM:
+    d = tuple_term_desc(terms, t);
+    for (i=0; i<d->arity; i++) {
+      h = pattern_height(terms, d->arg[i]);
+      if (h > max) max = h;
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  return max;
+}
+
 /*
  * Compile all patterns and fill in the pattern2code map
  */
@@ -127,7 +188,7 @@ void ematch_compile_all_patterns(ematch_globals_t *em) {
   pattern_table_t *ptbl;
   int_hmap_t *pc;
   pattern_t *pat;
-  uint32_t i;
+  uint32_t i, h;
   term_t t;
   int_hmap_pair_t *ip;
 
@@ -151,6 +212,10 @@ void ematch_compile_all_patterns(ematch_globals_t *em) {
       ip->val = ematch_compile_pattern(comp, t);
       pat->code = ip->val;
     }
+    h = pattern_height(comp->terms, t);
+    if (h > em->max_height) {
+      em->max_height = h;
+    }
   }
 }
 
@@ -172,3 +237,118 @@ void ematch_execute_all_patterns(ematch_globals_t *em) {
   }
 }
 
+
+
+/*
+ * Make the label and mtime arrays large enough for n terms
+ * - the new mtime entries are set to 0
+ */
+static void ematch_resize_rounds(ematch_globals_t *em, uint32_t n) {
+  ematch_exec_t *exec;
+  uint32_t i, size;
+
+  if (n > em->lsize) {
+    size = em->lsize + (em->lsize >> 1) + 1;
+    if (size < n) size = n;
+    if (size > UINT32_MAX/sizeof(elabel_t)) {
+      out_of_memory();
+    }
+    em->label = (elabel_t *) safe_realloc(em->label, size * sizeof(elabel_t));
+    em->lsize = size;
+  }
+
+  exec = &em->exec;
+  if (n > exec->mtime_size) {
+    size = em->lsize;
+    exec->mtime = (uint32_t *) safe_realloc(exec->mtime, size * sizeof(uint32_t));
+    for (i=exec->mtime_size; i<size; i++) {
+      exec->mtime[i] = 0;
+    }
+    exec->mtime_size = size;
+  }
+}
+
+/*
+ * Start a new round
+ */
+void ematch_start_round(ematch_globals_t *em) {
+  egraph_t *egraph;
+  ematch_exec_t *exec;
+  use_vector_t *u;
+  composite_t *p;
+  ivector_t *v, *w, *aux;
+  uint32_t i, j, k, n, round;
+  elabel_t l;
+  eterm_t t;
+  class_t c;
+
+  egraph = em->egraph;
+  exec = &em->exec;
+  assert(egraph != NULL);
+
+  em->round ++;
+  round = em->round;
+
+  n = egraph_num_terms(egraph);
+  if (n < em->nlabels) {
+    // terms were removed: the term ids may have been reused
+    em->nlabels = 0;
+    exec->valid_round = round;
+  }
+  if (exec->fdepth != em->fdepth || exec->vdepth != em->vdepth) {
+    // the matches depend on the depth limits
+    em->fdepth = exec->fdepth;
+    em->vdepth = exec->vdepth;
+    exec->valid_round = round;
+  }
+  ematch_resize_rounds(em, n);
+
+  v = &em->aux;
+  w = &em->aux2;
+  ivector_reset(v);
+  int_hset_reset(&em->cmark);
+
+  // new terms and terms that moved to another class
+  for (t=0; t<n; t++) {
+    l = egraph_term_label(egraph, t);
+    if (t >= em->nlabels || em->label[t] != l) {
+      exec->mtime[t] = round;
+      if (l != null_label) {
+        c = class_of(l);
+        if (int_hset_add(&em->cmark, c)) {
+          ivector_push(v, c);
+        }
+      }
+    }
+    em->label[t] = l;
+  }
+  em->nlabels = n;
+
+  // parents of the modified classes
+  for (k=0; k<em->max_height && v->size > 0; k++) {
+    ivector_reset(w);
+    for (i=0; i<v->size; i++) {
+      u = egraph_class_parents(egraph, v->data[i]);
+      for (j=0; j<u->last; j++) {
+        p = u->data[j];
+        if (valid_entry(p)) {
+          t = p->id;
+          exec->mtime[t] = round;
+          c = egraph_term_class(egraph, t);
+          if (int_hset_add(&em->cmark, c)) {
+            ivector_push(w, c);
+          }
+        }
+      }
+    }
+    aux = v; v = w; w = aux;
+  }
+}
+
+/*
+ * Forget the matched roots
+ */
+void ematch_forget_rounds(ematch_globals_t *em) {
+  em->nlabels = 0;
+  em->exec.valid_round = em->round + 1;
+}
@@ -18,6 +18,18 @@
 
 /*
  * E-MATCHING FOR QUANTIFIERS
+ *
+ * Matching is incremental: most of the matches found in a round are
+ * found again in the next rounds. To avoid this, each matching round
+ * starts by computing a modification time for every egraph term
+ * (stored in exec.mtime):
+ * - the terms that are new or whose label changed since the previous
+ *   round get the current round as modification time
+ * - then, up to max_height levels, so do the parents of the classes
+ *   of these terms (as in an inverted path index)
+ * For each constraint and pattern, we record the round in which all
+ * the matches of a root term were found (in quant_cnstr_t.matched).
+ * A root term can be skipped if it has not been modified since then.
  */
 
 #ifndef __QUANT_EMATCHING_H
@@ -42,6 +54,27 @@ typedef struct ematch_globals_s {
   quant_table_t *qtbl;         // link to quant cnstr table
   egraph_t *egraph;            // link to egraph
   context_t *ctx;              // link to context
+
+  /*
+   * Incremental matching:
+   * - round = index of the current round (0 before the first round)
+   * - label[t] = label of eterm t at the start of the previous round
+   *   for t < nlabels, lsize = size of the label array
+   * - max_height = height of the highest pattern
+   * - fdepth, vdepth = matching depths used in the previous round
+   * - cmark = classes already visited in the current round
+   * - aux, aux2 = buffers
+   */
+  uint32_t round;
+  elabel_t *label;
+  uint32_t nlabels;
+  uint32_t lsize;
+  uint32_t max_height;
+  uint32_t fdepth;
+  uint32_t vdepth;
+  int_hset_t cmark;
+  ivector_t aux;
+  ivector_t aux2;
 } ematch_globals_t;
 
 
@@ -87,5 +120,17 @@ extern void ematch_compile_all_patterns(ematch_globals_t *em);
  */
 extern void ematch_execute_all_patterns(ematch_globals_t *em);
 
+/*
+ * Start a new matching round: update the modification times
+ * - em->egraph must be attached
+ */
+extern void ematch_start_round(ematch_globals_t *em);
+
+/*
+ * Forget the matched roots (e.g., after the egraph terms were removed
+ * by pop): all roots are matched again from the next round
+ */
+extern void ematch_forget_rounds(ematch_globals_t *em);
+
 
 #endif /* __QUANT_EMATCHING_H */
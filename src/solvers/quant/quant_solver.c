@@ -32,6 +32,7 @@
 #include "io/tracer.h"
 #include "solvers/quant/quant_solver.h"
 #include "solvers/quant/quant_ematching.h"
+#include "utils/cputime.h"
 #include "utils/hash_functions.h"
 #include "utils/index_vectors.h"
 #include "utils/int_array_sort2.h"
@@ -445,6 +446,10 @@ static void init_quant_solver_statistics(quant_solver_stats_t *stat) {
 
   stat->num_rounds = 0;
 
+  stat->num_roots_matched = 0;
+  stat->num_roots_skipped = 0;
+  stat->ematch_time = 0.0;
+
   stat->max_instances = DEFAULT_MAX_INSTANCES;
   stat->max_instances_per_search = DEFAULT_MAX_INSTANCES_PER_SEARCH;
   stat->max_instances_per_round = DEFAULT_MAX_INSTANCES_PER_ROUND;
@@ -769,6 +774,8 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
   ivector_t *matches;
   smt_status_t status;
   uint32_t oldcount, nadded;
+  int_hmap2_rec_t *r;
+  bool new;
 
   em = &solver->em;
   exec =  &em->exec;
@@ -796,7 +803,10 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
       yices_pp_term(stdout, pat->p, 120, 1, 0);
 #endif
 
+      exec->matched = &cnstr->matched;
+      exec->pidx = j;
       ematch_exec_pattern(exec, pat, &cnstr->instances, solver->stats.max_instances_per_round);
+      exec->matched = NULL;
 
       matches = &pat->matches;
       n = matches->size;
@@ -820,6 +830,13 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
 	  solver->stats.num_instances++;
         }
       }
+
+      // all matches are learnt: record the roots that were fully matched
+      n = exec->roots.size;
+      for (i=0; i<n; i++) {
+        r = int_hmap2_get(&cnstr->matched, j, exec->roots.data[i], &new);
+        r->val = em->round;
+      }
     }
   }
 
@@ -968,8 +985,16 @@ static void ematch_process_cnstr_epsilon_greedy(quant_solver_t *solver) {
  * Match and learn instances
  */
 static void ematch_process_all_cnstr(quant_solver_t *solver) {
+  ematch_exec_t *exec;
   uint32_t i, n;
   smt_status_t status;
+  double start;
+
+  start = get_cpu_time();
+  exec = &solver->em.exec;
+  exec->num_roots = 0;
+  exec->num_skipped = 0;
+  ematch_start_round(&solver->em);
 
   term_learner_update_last_round(&solver->term_learner, true);
   term_learner_reset_latest(&solver->term_learner);
@@ -1018,6 +1043,10 @@ static void ematch_process_all_cnstr(quant_solver_t *solver) {
 
   context_disable_quant(solver->em.ctx);
 
+  solver->stats.num_roots_matched += exec->num_roots;
+  solver->stats.num_roots_skipped += exec->num_skipped;
+  solver->stats.ematch_time += time_diff(get_cpu_time(), start);
+
   term_learner_reset_round(&solver->term_learner, false);
   cnstr_learner_reset_round(&solver->cnstr_learner, false);
 
@@ -1188,6 +1217,7 @@ void quant_solver_pop(quant_solver_t *solver) {
   solver->base_level --;
 
   quant_solver_backtrack(solver, solver->base_level);
+  ematch_forget_rounds(&solver->em);
 }
 
 
@@ -57,6 +57,10 @@ typedef struct quant_solver_stats_s {
 
   uint32_t num_rounds;                // total number of rounds
 
+  uint32_t num_roots_matched;         // number of root terms matched (total)
+  uint32_t num_roots_skipped;         // number of root terms skipped since they were not modified
+  double ematch_time;                 // CPU time spent in matching rounds (in seconds)
+
   uint32_t max_instances;             // max number of instances generated (total)
   uint32_t max_instances_per_search;  // max number of instances generated per search
   uint32_t max_instances_per_round;   // max number of instanced generated in each call to final_check
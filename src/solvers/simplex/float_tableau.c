@@ -0,0 +1,505 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * FLOATING-POINT SHADOW OF THE SIMPLEX TABLEAU
+ */
+
+#include <math.h>
+
+#include "solvers/simplex/float_tableau.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * ROWS
+ */
+
+#define DEF_FROW_SIZE 8
+
+static frow_t *new_frow(uint32_t n) {
+  frow_t *r;
+
+  if (n < DEF_FROW_SIZE) {
+    n = DEF_FROW_SIZE;
+  }
+  if (n >= MAX_FROW_SIZE) {
+    out_of_memory();
+  }
+  r = (frow_t *) safe_malloc(sizeof(frow_t) + n * sizeof(frow_elem_t));
+  r->size = 0;
+  r->capacity = n;
+
+  return r;
+}
+
+/*
+ * Add element (x, a) at the end of r
+ * - return the new row (r may be reallocated)
+ */
+static frow_t *frow_push(frow_t *r, int32_t x, double a) {
+  uint32_t i, n;
+
+  i = r->size;
+  if (i == r->capacity) {
+    n = i + (i >> 1) + 1;
+    if (n >= MAX_FROW_SIZE) {
+      out_of_memory();
+    }
+    r = (frow_t *) safe_realloc(r, sizeof(frow_t) + n * sizeof(frow_elem_t));
+    r->capacity = n;
+  }
+  r->data[i].col = x;
+  r->data[i].coeff = a;
+  r->size = i + 1;
+
+  return r;
+}
+
+/*
+ * Index of x in r or -1
+ */
+static int32_t frow_find(frow_t *r, int32_t x) {
+  uint32_t i, n;
+
+  n = r->size;
+  for (i=0; i<n; i++) {
+    if (r->data[i].col == x) return i;
+  }
+  return -1;
+}
+
+
+
+/*
+ * TABLEAU
+ */
+void init_ftableau(ftableau_t *ft) {
+  ft->nrows = 0;
+  ft->ncols = 0;
+  ft->row = NULL;
+  ft->basic_var = NULL;
+  ft->basic_row = NULL;
+  ft->col = NULL;
+  ft->value = NULL;
+  ft->lb = NULL;
+  ft->ub = NULL;
+  ft->has_lb = NULL;
+  ft->has_ub = NULL;
+  ft->status = NULL;
+  ft->where = NULL;
+  ft->npivots = 0;
+  ft->rows_size = 0;
+  ft->cols_size = 0;
+}
+
+static void ftableau_delete_rows(ftableau_t *ft) {
+  uint32_t i, n;
+
+  n = ft->nrows;
+  for (i=0; i<n; i++) {
+    safe_free(ft->row[i]);
+  }
+  ft->nrows = 0;
+}
+
+void delete_ftableau(ftableau_t *ft) {
+  uint32_t i, n;
+
+  ftableau_delete_rows(ft);
+  n = ft->cols_size;
+  for (i=0; i<n; i++) {
+    delete_ivector(ft->col + i);
+  }
+
+  safe_free(ft->row);
+  safe_free(ft->basic_var);
+  safe_free(ft->basic_row);
+  safe_free(ft->col);
+  safe_free(ft->value);
+  safe_free(ft->lb);
+  safe_free(ft->ub);
+  safe_free(ft->has_lb);
+  safe_free(ft->has_ub);
+  safe_free(ft->status);
+  safe_free(ft->where);
+  init_ftableau(ft);
+}
+
+
+/*
+ * Make the column arrays large enough for n columns
+ */
+static void ftableau_resize_columns(ftableau_t *ft, uint32_t n) {
+  uint32_t i;
+
+  if (n > ft->cols_size) {
+    ft->basic_row = (int32_t *) safe_realloc(ft->basic_row, n * sizeof(int32_t));
+    ft->col = (ivector_t *) safe_realloc(ft->col, n * sizeof(ivector_t));
+    ft->value = (double *) safe_realloc(ft->value, n * sizeof(double));
+    ft->lb = (double *) safe_realloc(ft->lb, n * sizeof(double));
+    ft->ub = (double *) safe_realloc(ft->ub, n * sizeof(double));
+    ft->has_lb = (uint8_t *) safe_realloc(ft->has_lb, n * sizeof(uint8_t));
+    ft->has_ub = (uint8_t *) safe_realloc(ft->has_ub, n * sizeof(uint8_t));
+    ft->status = (uint8_t *) safe_realloc(ft->status, n * sizeof(uint8_t));
+    ft->where = (int32_t *) safe_realloc(ft->where, n * sizeof(int32_t));
+    for (i=ft->cols_size; i<n; i++) {
+      init_ivector(ft->col + i, 0);
+    }
+    ft->cols_size = n;
+  }
+}
+
+void reset_ftableau(ftableau_t *ft, uint32_t ncols) {
+  uint32_t i;
+
+  ftableau_delete_rows(ft);
+  ftableau_resize_columns(ft, ncols);
+  for (i=0; i<ncols; i++) {
+    ft->basic_row[i] = -1;
+    ivector_reset(ft->col + i);
+    ft->value[i] = 0.0;
+    ft->has_lb[i] = false;
+    ft->has_ub[i] = false;
+    ft->status[i] = FVAR_FREE;
+    ft->where[i] = -1;
+  }
+  ft->ncols = ncols;
+  ft->npivots = 0;
+}
+
+
+void ftableau_add_row(ftableau_t *ft, int32_t basic, uint32_t n, const int32_t *x, const double *a) {
+  frow_t *r;
+  uint32_t i, k;
+
+  assert(0 <= basic && (uint32_t) basic < ft->ncols && ft->basic_row[basic] < 0);
+
+  k = ft->nrows;
+  if (k == ft->rows_size) {
+    i = k + (k >> 1) + 8;
+    if (i >= UINT32_MAX/sizeof(frow_t *)) {
+      out_of_memory();
+    }
+    ft->row = (frow_t **) safe_realloc(ft->row, i * sizeof(frow_t *));
+    ft->basic_var = (int32_t *) safe_realloc(ft->basic_var, i * sizeof(int32_t));
+    ft->rows_size = i;
+  }
+
+  r = new_frow(n);
+  for (i=0; i<n; i++) {
+    assert(0 <= x[i] && (uint32_t) x[i] < ft->ncols);
+    if (a[i] != 0.0) {
+      r = frow_push(r, x[i], a[i]);
+      ivector_push(ft->col + x[i], k);
+    }
+  }
+  assert(frow_find(r, basic) >= 0);
+
+  ft->row[k] = r;
+  ft->basic_var[k] = basic;
+  ft->basic_row[basic] = k;
+  ft->nrows = k+1;
+}
+
+
+
+/*
+ * PIVOTING
+ */
+
+/*
+ * Subtract b * row0 from row i where b = coefficient of x in row i
+ * - row0 must contain x with coefficient 1
+ * - x is removed from row i, and so are the coefficients that become
+ *   smaller than FTABLEAU_DROP_TOL
+ */
+static void ftableau_eliminate(ftableau_t *ft, uint32_t i, frow_t *row0, int32_t x) {
+  frow_t *r;
+  int32_t *where;
+  double b;
+  uint32_t j, k, n;
+  int32_t c, p;
+
+  r = ft->row[i];
+  p = frow_find(r, x);
+  if (p < 0) return; // stale entry in column x
+
+  where = ft->where;
+  b = r->data[p].coeff;
+  n = r->size;
+  for (j=0; j<n; j++) {
+    where[r->data[j].col] = j;
+  }
+
+  n = row0->size;
+  for (j=0; j<n; j++) {
+    c = row0->data[j].col;
+    if (where[c] >= 0) {
+      r->data[where[c]].coeff -= b * row0->data[j].coeff;
+    } else {
+      // fill-in
+      where[c] = r->size;
+      r = frow_push(r, c, - b * row0->data[j].coeff);
+      ivector_push(ft->col + c, i);
+    }
+  }
+
+  // cleanup and compact
+  k = 0;
+  n = r->size;
+  for (j=0; j<n; j++) {
+    c = r->data[j].col;
+    where[c] = -1;
+    if (c != x && fabs(r->data[j].coeff) >= FTABLEAU_DROP_TOL) {
+      r->data[k] = r->data[j];
+      k ++;
+    }
+  }
+  r->size = k;
+  ft->row[i] = r;
+}
+
+
+/*
+ * Make x basic in row r0
+ */
+static void ftableau_pivot(ftableau_t *ft, uint32_t r0, int32_t x) {
+  frow_t *row0;
+  ivector_t *v;
+  double a;
+  uint32_t j, n;
+  int32_t k, y;
+
+  row0 = ft->row[r0];
+  k = frow_find(row0, x);
+  assert(k >= 0);
+
+  // scale so that x has coefficient 1
+  a = row0->data[k].coeff;
+  n = row0->size;
+  for (j=0; j<n; j++) {
+    row0->data[j].coeff /= a;
+  }
+  row0->data[k].coeff = 1.0;
+
+  y = ft->basic_var[r0];
+  ft->basic_row[y] = -1;
+  ft->basic_var[r0] = x;
+  ft->basic_row[x] = r0;
+
+  // eliminate x from all other rows
+  v = ft->col + x;
+  n = v->size;
+  for (j=0; j<n; j++) {
+    if (v->data[j] != (int32_t) r0) {
+      ftableau_eliminate(ft, v->data[j], row0, x);
+    }
+  }
+  ivector_reset(v);
+  ivector_push(v, r0);
+
+  ft->npivots ++;
+}
+
+
+
+/*
+ * VALUES AND BOUNDS
+ */
+
+/*
+ * Recompute the value of the basic variable of row i
+ */
+static void ftableau_set_basic_value(ftableau_t *ft, uint32_t i) {
+  frow_t *r;
+  double s;
+  uint32_t j, n;
+  int32_t x, c;
+
+  r = ft->row[i];
+  x = ft->basic_var[i];
+  s = 0.0;
+  n = r->size;
+  for (j=0; j<n; j++) {
+    c = r->data[j].col;
+    if (c != x) {
+      s -= r->data[j].coeff * ft->value[c];
+    }
+  }
+  ft->value[x] = s;
+}
+
+static void ftableau_set_all_basic_values(ftableau_t *ft) {
+  uint32_t i, n;
+
+  n = ft->nrows;
+  for (i=0; i<n; i++) {
+    ftableau_set_basic_value(ft, i);
+  }
+}
+
+/*
+ * Set the value of non-basic variable x to v and update the
+ * basic variables that depend on x.
+ */
+static void ftableau_update_nonbasic(ftableau_t *ft, int32_t x, double v) {
+  ivector_t *col;
+  uint32_t j, n;
+
+  assert(! ftableau_is_basic(ft, x));
+
+  ft->value[x] = v;
+  col = ft->col + x;
+  n = col->size;
+  for (j=0; j<n; j++) {
+    ftableau_set_basic_value(ft, col->data[j]);
+  }
+}
+
+
+static inline double feas_tol(double b) {
+  return FTABLEAU_FEAS_TOL * (1.0 + fabs(b));
+}
+
+static bool below_lb(ftableau_t *ft, int32_t x) {
+  return ft->has_lb[x] && ft->value[x] < ft->lb[x] - feas_tol(ft->lb[x]);
+}
+
+static bool above_ub(ftableau_t *ft, int32_t x) {
+  return ft->has_ub[x] && ft->value[x] > ft->ub[x] + feas_tol(ft->ub[x]);
+}
+
+static bool can_decrease(ftableau_t *ft, int32_t x) {
+  return !ft->has_lb[x] || ft->value[x] > ft->lb[x] + feas_tol(ft->lb[x]);
+}
+
+static bool can_increase(ftableau_t *ft, int32_t x) {
+  return !ft->has_ub[x] || ft->value[x] < ft->ub[x] - feas_tol(ft->ub[x]);
+}
+
+
+
+/*
+ * SEARCH
+ */
+
+/*
+ * Leaving variable: basic variable of smallest index that's out of bounds
+ * - return the row index or -1
+ */
+static int32_t ftableau_leaving_row(ftableau_t *ft) {
+  uint32_t i, n;
+  int32_t x, best_x, best_r;
+
+  best_x = INT32_MAX;
+  best_r = -1;
+  n = ft->nrows;
+  for (i=0; i<n; i++) {
+    x = ft->basic_var[i];
+    if (x < best_x && (below_lb(ft, x) || above_ub(ft, x))) {
+      best_x = x;
+      best_r = i;
+    }
+  }
+  return best_r;
+}
+
+/*
+ * Entering variable for row r where x = basic variable
+ * - increase = true if x must increase, false if it must decrease
+ * - x = - sum of a_i y_i so x increases if y_i decreases and a_i > 0
+ *   or if y_i increases and a_i < 0
+ * - we pick the variable with the largest coefficient (for stability)
+ *   or the one with smallest index in Bland mode
+ * - return -1 if there's no candidate
+ */
+static int32_t ftableau_entering_var(ftableau_t *ft, uint32_t r, int32_t x, bool increase, bool bland) {
+  frow_t *row;
+  double a, best_a;
+  uint32_t j, n;
+  int32_t y, best_y;
+  bool ok;
+
+  row = ft->row[r];
+  best_y = -1;
+  best_a = 0.0;
+  n = row->size;
+  for (j=0; j<n; j++) {
+    y = row->data[j].col;
+    a = row->data[j].coeff;
+    if (y == x || y == 0 || fabs(a) < FTABLEAU_PIVOT_TOL) continue;
+
+    if ((a > 0) == increase) {
+      ok = can_decrease(ft, y);
+    } else {
+      ok = can_increase(ft, y);
+    }
+    if (ok) {
+      if (bland) {
+	if (best_y < 0 || y < best_y) best_y = y;
+      } else if (fabs(a) > best_a) {
+	best_a = fabs(a);
+	best_y = y;
+      }
+    }
+  }
+
+  return best_y;
+}
+
+
+ftableau_result_t ftableau_make_feasible(ftableau_t *ft, uint32_t max_pivots, const bool *interrupted) {
+  int32_t r, x, y;
+  bool increase, bland;
+
+  ft->npivots = 0;
+  ftableau_set_all_basic_values(ft);
+  bland = false;
+
+  for (;;) {
+    if (*interrupted) return FTABLEAU_UNKNOWN;
+
+    r = ftableau_leaving_row(ft);
+    if (r < 0) return FTABLEAU_FEASIBLE;
+    if (ft->npivots >= max_pivots) return FTABLEAU_UNKNOWN;
+
+    x = ft->basic_var[r];
+    increase = below_lb(ft, x);
+    y = ftableau_entering_var(ft, r, x, increase, bland);
+    if (y < 0) return FTABLEAU_INFEASIBLE;
+
+    ftableau_pivot(ft, r, y);
+    if (increase) {
+      ft->status[x] = FVAR_AT_LB;
+      ftableau_update_nonbasic(ft, x, ft->lb[x]);
+    } else {
+      ft->status[x] = FVAR_AT_UB;
+      ftableau_update_nonbasic(ft, x, ft->ub[x]);
+    }
+
+    // refresh all values from time to time to limit error accumulation
+    if ((ft->npivots & 0x3F) == 0) {
+      ftableau_set_all_basic_values(ft);
+    }
+    // use Bland's rule in the second half to prevent cycling
+    if (ft->npivots > (max_pivots >> 1)) {
+      bland = true;
+    }
+  }
+}
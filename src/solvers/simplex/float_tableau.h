@@ -0,0 +1,193 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * FLOATING-POINT SHADOW OF THE SIMPLEX TABLEAU
+ *
+ * This is an approximate copy of the simplex tableau where all
+ * coefficients, bounds, and values are doubles. It's used to search
+ * for a good basis cheaply: the simplex solver copies its tableau and
+ * bounds here, runs the same pivoting algorithm in floating point,
+ * then installs the resulting basis in the exact tableau. The exact
+ * solver always has the last word: the floating-point result is only
+ * a hint, so rounding errors can cost pivots but never soundness.
+ *
+ * Each row has the same form as in the exact matrix: a list of pairs
+ * (coeff, column) that sum to zero, and the basic variable of the row
+ * has coefficient 1. Rows are stored without holes. For each column,
+ * we keep a list of rows that may contain it. The list may contain
+ * stale entries (rows where the column was cancelled) but it includes
+ * all rows that contain the column.
+ */
+
+#ifndef __FLOAT_TABLEAU_H
+#define __FLOAT_TABLEAU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "utils/int_vectors.h"
+
+
+/*
+ * Row element and row
+ */
+typedef struct frow_elem_s {
+  int32_t col;
+  double coeff;
+} frow_elem_t;
+
+typedef struct frow_s {
+  uint32_t size;
+  uint32_t capacity;
+  frow_elem_t data[0]; // real size = capacity
+} frow_t;
+
+#define MAX_FROW_SIZE (((uint32_t)(UINT32_MAX-sizeof(frow_t)))/sizeof(frow_elem_t))
+
+
+/*
+ * Status of a non-basic variable after the search
+ */
+typedef enum fbound_status {
+  FVAR_FREE,       // value unchanged
+  FVAR_AT_LB,      // value was set to the lower bound
+  FVAR_AT_UB,      // value was set to the upper bound
+} fbound_status_t;
+
+
+/*
+ * Tableau:
+ * - nrows = number of rows
+ * - ncols = number of columns (variables)
+ * - row[i] = row i
+ * - basic_var[i] = basic variable of row i
+ * - basic_row[x] = row where x is basic or -1 if x is not basic
+ * - col[x] = rows that may contain x
+ * - value[x] = current value of x
+ * - lb[x], ub[x] = bounds on x (valid if has_lb[x]/has_ub[x] is true)
+ * - status[x] = how the value of a non-basic variable was set
+ * - where = buffer for row operations (where[x] = index of x in a row or -1)
+ * - npivots = number of pivots in the last search
+ * - rows_size/cols_size = size of the arrays indexed by rows/columns
+ */
+typedef struct ftableau_s {
+  uint32_t nrows;
+  uint32_t ncols;
+  frow_t **row;
+  int32_t *basic_var;
+  int32_t *basic_row;
+  ivector_t *col;
+  double *value;
+  double *lb;
+  double *ub;
+  uint8_t *has_lb;
+  uint8_t *has_ub;
+  uint8_t *status;
+  int32_t *where;
+  uint32_t npivots;
+  uint32_t rows_size;
+  uint32_t cols_size;
+} ftableau_t;
+
+
+/*
+ * Result of the search
+ */
+typedef enum ftableau_result {
+  FTABLEAU_FEASIBLE,    // all basic variables are within bounds
+  FTABLEAU_INFEASIBLE,  // a row has no entering variable
+  FTABLEAU_UNKNOWN,     // pivot limit reached or interrupted
+} ftableau_result_t;
+
+
+/*
+ * Tolerances
+ * - FTABLEAU_PIVOT_TOL: smallest coefficient accepted as pivot
+ * - FTABLEAU_DROP_TOL: coefficients smaller than this are removed from rows
+ * - FTABLEAU_FEAS_TOL: relative tolerance for bound checks
+ */
+#define FTABLEAU_PIVOT_TOL 1e-7
+#define FTABLEAU_DROP_TOL  1e-11
+#define FTABLEAU_FEAS_TOL  1e-9
+
+
+/*
+ * Initialize/delete
+ */
+extern void init_ftableau(ftableau_t *ft);
+extern void delete_ftableau(ftableau_t *ft);
+
+/*
+ * Prepare to build a tableau with ncols variables
+ * - all rows are removed
+ * - all variables are non-basic, with value 0 and no bounds
+ */
+extern void reset_ftableau(ftableau_t *ft, uint32_t ncols);
+
+/*
+ * Add a row: a[0] x[0] + ... + a[n-1] x[n-1] = 0
+ * - basic = basic variable for the row. It must occur in x with coefficient 1.
+ * - no variable in x is basic in another row
+ */
+extern void ftableau_add_row(ftableau_t *ft, int32_t basic, uint32_t n, const int32_t *x, const double *a);
+
+/*
+ * Set the value/bounds of x
+ */
+static inline void ftableau_set_value(ftableau_t *ft, int32_t x, double v) {
+  assert(0 <= x && (uint32_t) x < ft->ncols);
+  ft->value[x] = v;
+}
+
+static inline void ftableau_set_lb(ftableau_t *ft, int32_t x, double v) {
+  assert(0 <= x && (uint32_t) x < ft->ncols);
+  ft->lb[x] = v;
+  ft->has_lb[x] = true;
+}
+
+static inline void ftableau_set_ub(ftableau_t *ft, int32_t x, double v) {
+  assert(0 <= x && (uint32_t) x < ft->ncols);
+  ft->ub[x] = v;
+  ft->has_ub[x] = true;
+}
+
+static inline bool ftableau_is_basic(ftableau_t *ft, int32_t x) {
+  assert(0 <= x && (uint32_t) x < ft->ncols);
+  return ft->basic_row[x] >= 0;
+}
+
+static inline fbound_status_t ftableau_status(ftableau_t *ft, int32_t x) {
+  assert(0 <= x && (uint32_t) x < ft->ncols);
+  return (fbound_status_t) ft->status[x];
+}
+
+
+/*
+ * Search for a basis where all variables are within their bounds
+ * - the values of the non-basic variables must be set first
+ *   (and they must be within bounds)
+ * - variable 0 is the constant: it's never selected for pivoting
+ * - max_pivots = bound on the number of pivots
+ * - interrupted = pointer to a flag checked at every iteration
+ */
+extern ftableau_result_t ftableau_make_feasible(ftableau_t *ft, uint32_t max_pivots, const bool *interrupted);
+
+
+#endif /* __FLOAT_TABLEAU_H */
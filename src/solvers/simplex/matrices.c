@@ -52,6 +52,7 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "solvers/simplex/matrices.h"
 #include "utils/memalloc.h"
@@ -86,10 +87,25 @@ static column_t *new_column(uint32_t n) {
 }
 
 
+/*
+ * Check whether column v is stored in the matrix's packed block
+ */
+static inline bool packed_column(matrix_t *matrix, column_t *v) {
+  char *p;
+
+  p = (char *) v;
+  return matrix->col_block != NULL && matrix->col_block <= p && p < matrix->col_block + matrix->col_block_size;
+}
+
+
 /*
  * Return a column equal to v but 50% larger
+ * - if v is in the packed block, it's copied to a fresh
+ *   column: the space it used in the block is lost until the
+ *   next call to matrix_pack.
  */
-static column_t *extend_column(column_t *v) {
+static column_t *extend_column(matrix_t *matrix, column_t *v) {
+  column_t *w;
   uint32_t n;
 
   n = v->capacity + 1;
@@ -97,7 +113,13 @@ static column_t *extend_column(column_t *v) {
   if (n >= MAX_MATRIX_COL_SIZE) {
     out_of_memory();
   }
-  v = (column_t *) safe_realloc(v, sizeof(column_t) + n * sizeof(col_elem_t));
+  if (packed_column(matrix, v)) {
+    w = (column_t *) safe_malloc(sizeof(column_t) + n * sizeof(col_elem_t));
+    memcpy(w, v, sizeof(column_t) + v->size * sizeof(col_elem_t));
+    v = w;
+  } else {
+    v = (column_t *) safe_realloc(v, sizeof(column_t) + n * sizeof(col_elem_t));
+  }
   v->capacity = n;
 
   return v;
@@ -111,7 +133,7 @@ static column_t *extend_column(column_t *v) {
  * If any allocation or reallocation happens, *v is updated.
  * - return the index of the element in v->data
  */
-static uint32_t alloc_column_elem(column_t **v) {
+static uint32_t alloc_column_elem(matrix_t *matrix, column_t **v) {
   column_t *c;
   int32_t i;
 
@@ -129,7 +151,7 @@ static uint32_t alloc_column_elem(column_t **v) {
     } else {
       i = c->size;
       if (i == c->capacity) {
-        c = extend_column(c);
+        c = extend_column(matrix, c);
         *v = c;
       }
       assert(i < c->capacity);
@@ -166,8 +188,10 @@ static void free_column_elem(column_t *v, int32_t i) {
 /*
  * Delete column v
  */
-static inline void delete_column(column_t *v) {
-  safe_free(v);
+static inline void delete_column(matrix_t *matrix, column_t *v) {
+  if (! packed_column(matrix, v)) {
+    safe_free(v);
+  }
 }
 
 
@@ -199,9 +223,22 @@ static row_t *new_row(uint32_t n) {
 
 
 /*
- * Return a column equal to v but 50% larger
+ * Check whether row v is stored in the packed block
  */
-static row_t *extend_row(row_t *v) {
+static inline bool packed_row(matrix_t *matrix, row_t *v) {
+  char *p;
+
+  p = (char *) v;
+  return matrix->row_block != NULL && matrix->row_block <= p && p < matrix->row_block + matrix->row_block_size;
+}
+
+
+/*
+ * Return a row equal to v but 50% larger
+ * - if v is in the packed block, it's copied (the rationals are moved)
+ */
+static row_t *extend_row(matrix_t *matrix, row_t *v) {
+  row_t *w;
   uint32_t n;
 
   n = v->capacity + 1;
@@ -209,7 +246,13 @@ static row_t *extend_row(row_t *v) {
   if (n >= MAX_MATRIX_ROW_SIZE) {
     out_of_memory();
   }
-  v = (row_t *) safe_realloc(v, sizeof(row_t) + n * sizeof(row_elem_t));
+  if (packed_row(matrix, v)) {
+    w = (row_t *) safe_malloc(sizeof(row_t) + n * sizeof(row_elem_t));
+    memcpy(w, v, sizeof(row_t) + v->size * sizeof(row_elem_t));
+    v = w;
+  } else {
+    v = (row_t *) safe_realloc(v, sizeof(row_t) + n * sizeof(row_elem_t));
+  }
   v->capacity = n;
 
   return v;
@@ -224,7 +267,7 @@ static row_t *extend_row(row_t *v) {
  * - return the index of the element in v->data
  * - initialize v->data[i].coeff if required
  */
-static uint32_t alloc_row_elem(row_t **v) {
+static uint32_t alloc_row_elem(matrix_t *matrix, row_t **v) {
   row_t *r;
   int32_t i;
 
@@ -241,7 +284,7 @@ static uint32_t alloc_row_elem(row_t **v) {
     } else {
       i = r->size;
       if (i == r->capacity) {
-        r = extend_row(r);
+        r = extend_row(matrix, r);
         *v = r;
       }
       assert(i < r->capacity);
@@ -280,13 +323,15 @@ static void free_row_elem(row_t *v, int32_t i) {
 /*
  * Delete row v
  */
-static void delete_row(row_t *v) {
+static void delete_row(matrix_t *matrix, row_t *v) {
   uint32_t i, n;
   n = v->size;
   for (i=0; i<n; i++) {
     q_clear(&v->data[i].coeff);
   }
-  safe_free(v);
+  if (! packed_row(matrix, v)) {
+    safe_free(v);
+  }
 }
 
 
@@ -331,6 +376,13 @@ void init_matrix(matrix_t *matrix, uint32_t n, uint32_t m) {
 
   // constant is not allocated here
   matrix->constant = NULL;
+
+  // no packed blocks
+  matrix->row_block = NULL;
+  matrix->col_block = NULL;
+  matrix->row_block_size = 0;
+  matrix->col_block_size = 0;
+  matrix->npivots = 0;
 }
 
 
@@ -342,12 +394,12 @@ void delete_matrix(matrix_t *matrix) {
 
   n = matrix->nrows;
   for (i=0; i<n; i++) {
-    delete_row(matrix->row[i]);
+    delete_row(matrix, matrix->row[i]);
   }
 
   n = matrix->ncolumns;
   for (i=0; i<n; i++) {
-    delete_column(matrix->column[i]);
+    delete_column(matrix, matrix->column[i]);
   }
 
   safe_free(matrix->row);
@@ -356,6 +408,8 @@ void delete_matrix(matrix_t *matrix) {
   safe_free(matrix->constant);
   safe_free(matrix->base_var);
   safe_free(matrix->base_row);
+  safe_free(matrix->row_block);
+  safe_free(matrix->col_block);
   delete_bitvector(matrix->marks);
 
   q_clear(&matrix->factor);
@@ -366,6 +420,8 @@ void delete_matrix(matrix_t *matrix) {
   matrix->constant = NULL;
   matrix->base_var = NULL;
   matrix->base_row = NULL;
+  matrix->row_block = NULL;
+  matrix->col_block = NULL;
   matrix->marks = NULL;
 }
 
@@ -379,18 +435,26 @@ void reset_matrix(matrix_t *matrix) {
 
   n = matrix->nrows;
   for (i=0; i<n; i++) {
-    delete_row(matrix->row[i]);
+    delete_row(matrix, matrix->row[i]);
     matrix->row[i] = NULL;  // this is redundant but it helps debugging
   }
 
   n = matrix->ncolumns;
   for (i=0; i<n; i++) {
-    delete_column(matrix->column[i]);
+    delete_column(matrix, matrix->column[i]);
     matrix->column[i] = NULL;
   }
 
   q_clear(&matrix->factor);
 
+  safe_free(matrix->row_block);
+  safe_free(matrix->col_block);
+  matrix->row_block = NULL;
+  matrix->col_block = NULL;
+  matrix->row_block_size = 0;
+  matrix->col_block_size = 0;
+  matrix->npivots = 0;
+
   matrix->nrows = 0;
   matrix->ncolumns = 0;
 }
@@ -409,7 +473,7 @@ void reset_matrix(matrix_t *matrix) {
  */
 static inline uint32_t get_column_elem(matrix_t *matrix, uint32_t j) {
   assert(j < matrix->ncolumns);
-  return alloc_column_elem(matrix->column + j);
+  return alloc_column_elem(matrix, matrix->column + j);
 }
 
 /*
@@ -625,9 +689,6 @@ void matrix_add_columns(matrix_t *matrix, uint32_t m) {
 
 
 
-#if 0
-// not used
-
 /*
  * Remove the empty elements from column c
  * - update the corresponding row elements
@@ -659,8 +720,6 @@ static void matrix_compact_column(matrix_t *matrix, uint32_t c) {
   column->free = -1;
 }
 
-#endif
-
 
 
 /*
@@ -955,7 +1014,7 @@ static void compact_matrix(matrix_t *matrix) {
     if (row != NULL) {
       if (row->nelems == 0) {
         // delete the row
-        delete_row(row);
+        delete_row(matrix, row);
       } else {
         if (j < i) {
           matrix_change_row_index(matrix, row, j);
@@ -996,7 +1055,7 @@ static void matrix_remove_rows(matrix_t *matrix, uint32_t n) {
   for (i=n; i<p; i++) {
     row = matrix->row[i];
     matrix_detach_row(matrix, row);
-    delete_row(row);
+    delete_row(matrix, row);
     matrix->row[i] = NULL;
   }
 
@@ -1018,7 +1077,7 @@ static void matrix_remove_columns(matrix_t *matrix, uint32_t n) {
     col = matrix->column[i];
     if (col != NULL) {
       assert(col->nelems == 0);
-      delete_column(col);
+      delete_column(matrix, col);
       matrix->column[i] = NULL;
     }
   }
@@ -1134,7 +1193,7 @@ void matrix_eliminate_fixed_variable(matrix_t *matrix, int32_t x, rational_t *a)
   }
 
   // remove column x
-  delete_column(col);
+  delete_column(matrix, col);
   matrix->column[x] = NULL;
 }
 
@@ -1431,7 +1490,7 @@ static void markowitz_init_rows(markowitz_t *d, matrix_t *matrix) {
     row = matrix->row[i];
     switch (row->nelems) {
     case 0:
-      delete_row(row);
+      delete_row(matrix, row);
       matrix->row[i] = NULL;
       break;
     case 1:
@@ -1695,6 +1754,29 @@ void matrix_scale_row(row_t *r, uint32_t k) {
 }
 
 
+/*
+ * Compute r1 := r1 - r2 * r3
+ * - most coefficients in the tableau are small integers: we do the
+ *   operation inline if r1, r2, r3 are small integers and the result
+ *   is in the same range as rat32 numerators (cf. MAX_NUMERATOR in rationals.c).
+ *   Otherwise, we call q_submul.
+ */
+#define MATRIX_MAX_SMALLINT (INT32_MAX>>1)
+
+static inline void submul_coeff(rational_t *r1, rational_t *r2, rational_t *r3) {
+  int64_t num;
+
+  if (q_is_smallint(r1) && q_is_smallint(r2) && q_is_smallint(r3)) {
+    num = (int64_t) get_num(r1) - ((int64_t) get_num(r2)) * get_num(r3);
+    if (-MATRIX_MAX_SMALLINT <= num && num <= MATRIX_MAX_SMALLINT) {
+      r1->s.num = (int32_t) num;
+      return;
+    }
+  }
+  q_submul(r1, r2, r3);
+}
+
+
 /*
  * Auxiliary function for variable elimination. This is the common
  * part of Gaussian elimination and pivoting.
@@ -1744,7 +1826,7 @@ void matrix_submul_row(matrix_t *matrix, uint32_t r, uint32_t k, row_t *row0) {
         j = index[x];
         if (j < 0) {
           // x does not occur in row r: create a new element
-          j = alloc_row_elem(&row);
+          j = alloc_row_elem(matrix, &row);
           row->data[j].c_idx = x;
           row->data[j].c_ptr = add_column_elem(matrix, x, r, j);
           q_set_neg(&row->data[j].coeff, &row0->data[i].coeff);
@@ -1765,7 +1847,7 @@ void matrix_submul_row(matrix_t *matrix, uint32_t r, uint32_t k, row_t *row0) {
         j = index[x];
         if (j < 0) {
           // x does not occur in row r
-          j = alloc_row_elem(&row);
+          j = alloc_row_elem(matrix, &row);
           row->data[j].c_idx = x;
           row->data[j].c_ptr = add_column_elem(matrix, x, r, j);
           q_set(&row->data[j].coeff, &row0->data[i].coeff);
@@ -1786,14 +1868,14 @@ void matrix_submul_row(matrix_t *matrix, uint32_t r, uint32_t k, row_t *row0) {
         j = index[x];
         if (j < 0) {
           // x does not occur in row r: create a new element
-          j = alloc_row_elem(&row);
+          j = alloc_row_elem(matrix, &row);
           row->data[j].c_idx = x;
           row->data[j].c_ptr = add_column_elem(matrix, x, r, j);
           q_set_neg(&row->data[j].coeff, a);
           q_mul(&row->data[j].coeff, &row0->data[i].coeff);
         } else {
           // x occurs in element j of row r
-          q_submul(&row->data[j].coeff, a, &row0->data[i].coeff);
+          submul_coeff(&row->data[j].coeff, a, &row0->data[i].coeff);
         }
       }
     }
@@ -1868,7 +1950,7 @@ void matrix_pivot(matrix_t *matrix, uint32_t r0, uint32_t k) {
   // reset the column: it contains a single element
   if (col->capacity >= MATRIX_SHRINK_COLUMN_THRESHOLD) {
     // attempt to save memory: replace column[x] by a smaller column
-    delete_column(col);
+    delete_column(matrix, col);
     col = new_column(DEF_MATRIX_COL_SIZE);
     matrix->column[x] = col;
   }
@@ -1887,6 +1969,134 @@ void matrix_pivot(matrix_t *matrix, uint32_t r0, uint32_t k) {
   }
   matrix->base_var[r0] = x;
   matrix->base_row[x] = r0;
+
+  matrix->npivots ++;
+}
+
+
+
+
+/*
+ * PACKED STORAGE
+ */
+
+/*
+ * Capacity of a row or column of size n in a packed block:
+ * we leave some room for fill-in.
+ */
+static inline uint32_t packed_capacity(uint32_t n) {
+  return n + (n >> 2) + 2;
+}
+
+
+/*
+ * Copy all the rows into a new block
+ * - the rows must not have holes
+ */
+static void matrix_pack_rows(matrix_t *matrix) {
+  row_t *row, *new;
+  char *block, *p;
+  size_t size;
+  uint32_t i, n, cap;
+
+  n = matrix->nrows;
+  size = 0;
+  for (i=0; i<n; i++) {
+    assert(matrix->row[i]->free < 0);
+    size += sizeof(row_t) + packed_capacity(matrix->row[i]->size) * sizeof(row_elem_t);
+  }
+
+  block = NULL;
+  if (size > 0) {
+    block = (char *) safe_malloc(size);
+  }
+  p = block;
+  for (i=0; i<n; i++) {
+    row = matrix->row[i];
+    cap = packed_capacity(row->size);
+    new = (row_t *) p;
+    // this moves the rationals to the new row
+    memcpy(new, row, sizeof(row_t) + row->size * sizeof(row_elem_t));
+    new->capacity = cap;
+    if (! packed_row(matrix, row)) {
+      safe_free(row);
+    }
+    matrix->row[i] = new;
+    p += sizeof(row_t) + cap * sizeof(row_elem_t);
+  }
+
+  safe_free(matrix->row_block);
+  matrix->row_block = block;
+  matrix->row_block_size = size;
+}
+
+
+/*
+ * Copy all the non-null columns into a new block
+ * - the columns must not have holes
+ */
+static void matrix_pack_columns(matrix_t *matrix) {
+  column_t *col, *new;
+  char *block, *p;
+  size_t size;
+  uint32_t i, n, cap;
+
+  n = matrix->ncolumns;
+  size = 0;
+  for (i=0; i<n; i++) {
+    col = matrix->column[i];
+    if (col != NULL) {
+      assert(col->free < 0);
+      size += sizeof(column_t) + packed_capacity(col->size) * sizeof(col_elem_t);
+    }
+  }
+
+  block = NULL;
+  if (size > 0) {
+    block = (char *) safe_malloc(size);
+  }
+  p = block;
+  for (i=0; i<n; i++) {
+    col = matrix->column[i];
+    if (col != NULL) {
+      cap = packed_capacity(col->size);
+      new = (column_t *) p;
+      memcpy(new, col, sizeof(column_t) + col->size * sizeof(col_elem_t));
+      new->capacity = cap;
+      if (! packed_column(matrix, col)) {
+        safe_free(col);
+      }
+      matrix->column[i] = new;
+      p += sizeof(column_t) + cap * sizeof(col_elem_t);
+    }
+  }
+
+  safe_free(matrix->col_block);
+  matrix->col_block = block;
+  matrix->col_block_size = size;
+}
+
+
+/*
+ * Remove all holes then rebuild the two blocks
+ */
+void matrix_pack(matrix_t *matrix) {
+  uint32_t i, n;
+
+  n = matrix->nrows;
+  for (i=0; i<n; i++) {
+    matrix_compact_row(matrix, i);
+  }
+  n = matrix->ncolumns;
+  for (i=0; i<n; i++) {
+    matrix_compact_column(matrix, i);
+  }
+
+  matrix_pack_rows(matrix);
+  matrix_pack_columns(matrix);
+  matrix->npivots = 0;
+
+  assert(good_matrix(matrix));
 }
 
 
@@ -1932,7 +2142,7 @@ static void matrix_eliminate_zero_variable(matrix_t *matrix, markowitz_t *d, int
   }
 
   // delete column[x]
-  delete_column(col);
+  delete_column(matrix, col);
   matrix->column[x] = NULL;
 }
 
@@ -2018,7 +2228,7 @@ static void matrix_substitute_variable(matrix_t *matrix, markowitz_t *d, int32_t
   }
 
   // delete column[x]
-  delete_column(col);
+  delete_column(matrix, col);
   matrix->column[x] = NULL;
 }
 
@@ -2395,7 +2605,7 @@ static void gauss_elim_simple_row(matrix_t *matrix, markowitz_t *d, byte_t *i_fl
    */
   matrix_detach_row(matrix, row0);
   matrix_substitute_variable(matrix, d, x, row0->data + i);
-  delete_row(row0);
+  delete_row(matrix, row0);
   matrix->row[r0] = NULL;
 }
 
@@ -2475,10 +2685,10 @@ static void gauss_elim_row(matrix_t *matrix, markowitz_t *d, byte_t *i_flag,
   }
 
   // delete column x and row r0
-  delete_column(col);
+  delete_column(matrix, col);
   matrix->column[x] = NULL;
 
-  delete_row(row0);
+  delete_row(matrix, row0);
   matrix->row[r0] = NULL;
 }
 
@@ -2528,7 +2738,7 @@ static void gaussian_elimination(matrix_t *matrix, markowitz_t *d, byte_t *i_fla
       abort();
     case 1:
       matrix_detach_row(matrix, row0); // must be done before elim_zero_var
-      delete_row(row0);
+      delete_row(matrix, row0);
       matrix->row[r0] = NULL;
       fvar_vector_add0(fvars, x); // record the assignment x := 0
       matrix_eliminate_zero_variable(matrix, d, x); // remove x
@@ -2643,7 +2853,7 @@ static void tableau_remove_singleton_row(matrix_t *matrix, markowitz_t *d,
   matrix_eliminate_zero_variable(matrix, d, x);
 
   // delete the row
-  delete_row(row0);
+  delete_row(matrix, row0);
   matrix->row[r0] = NULL;
 }
 
@@ -2674,7 +2884,7 @@ static void tableau_remove_simple_row(matrix_t *matrix, markowitz_t *d,
   matrix_substitute_variable(matrix, d, x, e);
 
   // remove row0
-  delete_row(row0);
+  delete_row(matrix, row0);
   matrix->row[r0] = NULL;
 
 }
@@ -2801,7 +3011,7 @@ void simple_tableau_construction(matrix_t *matrix, fvar_vector_t *fvars) {
     row = matrix->row[i];
     switch (row->nelems) {
     case 0:
-      delete_row(row);
+      delete_row(matrix, row);
       matrix->row[i] = NULL;
       need_compact = true;
       break;
@@ -2900,9 +3110,9 @@ static void markowitz_tableau_revisit_simple_row(matrix_t *matrix, row_t *row0,
     fvar_vector_add_neg(fvars, x, &row0->data[i].coeff);
 
     free_column_elem(matrix->column[const_idx], row0->data[i].c_ptr);
-    delete_row(row0);
+    delete_row(matrix, row0);
     matrix->row[r0] = NULL;
-    delete_column(matrix->column[x]);
+    delete_column(matrix, matrix->column[x]);
     matrix->column[x] = NULL;
     matrix->base_row[x] = -1;
   }
@@ -2970,9 +3180,9 @@ void markowitz_tableau_construction(matrix_t *matrix, fvar_vector_t *fvars) {
 
         // store x := 0 to fvars then delete the row and column
         fvar_vector_add0(fvars, x);
-        delete_row(row0);
+        delete_row(matrix, row0);
         matrix->row[r0] = NULL;
-        delete_column(matrix->column[x]);
+        delete_column(matrix, matrix->column[x]);
         matrix->column[x] = NULL;
 
         // x is no longer basic
@@ -149,6 +149,13 @@ typedef struct column_s {
  *   constant in row i. If constant[i] = k >= 0, then row[i][k] is
  *   <b, x_0, ..>.  If constant[i] = -1, then there's no constant in row i.
  *
+ * Packed storage (optional, cf. matrix_pack):
+ * - row_block = a single block that stores rows 0 to nrows-1 in order,
+ *   without holes (plus some spare capacity at the end of each row)
+ * - col_block = same thing for the columns
+ * - a row or column that grows beyond its capacity is moved out of
+ *   the block; matrix_pack rebuilds both blocks.
+ * - npivots = number of pivots since the last call to matrix_pack
  */
 typedef struct matrix_s {
   uint32_t nrows;        // number of rows
@@ -169,6 +176,13 @@ typedef struct matrix_s {
 
   // optional components
   int32_t *constant;    // maps rows to constant
+
+  // packed storage
+  char *row_block;
+  char *col_block;
+  size_t row_block_size;
+  size_t col_block_size;
+  uint32_t npivots;
 } matrix_t;
 
 
@@ -191,6 +205,14 @@ typedef struct matrix_s {
 #define MATRIX_SHRINK_COLUMN_THRESHOLD 100
 
 
+/*
+ * Packing period: matrix_needs_packing returns true after
+ * MATRIX_PACK_MIN_PIVOTS + nrows/MATRIX_PACK_ROW_DIVISOR pivots
+ */
+#define MATRIX_PACK_MIN_PIVOTS 200
+#define MATRIX_PACK_ROW_DIVISOR 4
+
+
 /*
  * Default and maximal number of rows/columns in a matrix
  * - we set the max to UINT32_MAX/8 == UINT32_MAX/sizeof(pointer on 64bit machines)
@@ -583,6 +605,30 @@ extern void matrix_pivot(matrix_t *matrix, uint32_t r0, uint32_t k);
 
 
 
+/*
+ * PACKED STORAGE
+ */
+
+/*
+ * Copy all rows (in order) into a single block and all columns into
+ * another block, removing the holes. This improves locality for
+ * pivoting on large tableaus.
+ * - all row and column pointers change: the caller must not keep
+ *   any row_t or column_t pointer across this call
+ * - the element indices within rows and columns also change
+ */
+extern void matrix_pack(matrix_t *matrix);
+
+/*
+ * Check whether enough pivots were done since the last packing
+ */
+static inline bool matrix_needs_packing(matrix_t *matrix) {
+  return matrix->npivots >= MATRIX_PACK_MIN_PIVOTS + matrix->nrows/MATRIX_PACK_ROW_DIVISOR;
+}
+
+
+
+
 /*
  * ELIMINATION MATRICES
  */
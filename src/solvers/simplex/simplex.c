@@ -626,6 +626,11 @@ static void init_simplex_statistics(simplex_stats_t *stat) {
   stat->num_pivots = 0;
   stat->num_blands = 0;
   stat->num_conflicts = 0;
+  stat->num_float_checks = 0;
+  stat->num_float_pivots = 0;
+  stat->num_float_confirmed = 0;
+  stat->num_float_failures = 0;
+  stat->num_matrix_packs = 0;
 
   stat->num_make_intfeasible = 0;
   stat->num_bound_conflicts = 0;
@@ -1599,6 +1604,7 @@ void init_simplex_solver(simplex_solver_t *solver, smt_core_t *core, gate_manage
   solver->dsolver = NULL;     // allocated later if needed
 
   solver->cache = NULL;       // allocated later if needed
+  solver->ftableau = NULL;    // allocated later if needed
 
   init_simplex_statistics(&solver->stats);
 
@@ -3394,6 +3400,10 @@ static void simplex_init_tableau(simplex_solver_t *solver) {
   assert(solver->matrix_ready);
 
   markowitz_tableau_construction(&solver->matrix, &solver->fvars);
+  if (simplex_option_enabled(solver, SIMPLEX_PACKED_MATRIX)) {
+    matrix_pack(&solver->matrix);
+    solver->stats.num_matrix_packs ++;
+  }
   solver->stats.num_rows = solver->matrix.nrows;
   solver->stats.num_fixed_vars = solver->fvars.nvars;
 
@@ -4720,6 +4730,219 @@ static void simplex_expand_th_explanation(simplex_solver_t *solver, thvar_t x1,
 
 
 
+/***************************
+ *  FLOATING-POINT PHASE   *
+ **************************/
+
+/*
+ * Get the floating-point tableau: allocate it if needed
+ */
+static ftableau_t *simplex_get_ftableau(simplex_solver_t *solver) {
+  ftableau_t *ft;
+
+  ft = solver->ftableau;
+  if (ft == NULL) {
+    ft = (ftableau_t *) safe_malloc(sizeof(ftableau_t));
+    init_ftableau(ft);
+    solver->ftableau = ft;
+  }
+  return ft;
+}
+
+
+/*
+ * Copy the matrix, bounds, and current assignment into ft
+ */
+static void simplex_build_ftableau(simplex_solver_t *solver, ftableau_t *ft) {
+  matrix_t *matrix;
+  arith_vartable_t *vtbl;
+  xrational_t *bound;
+  row_t *row;
+  int32_t *x;
+  double *a;
+  uint32_t i, j, n, m, nvars, size;
+  int32_t k;
+  thvar_t y;
+
+  matrix = &solver->matrix;
+  vtbl = &solver->vtbl;
+  bound = solver->bstack.bound;
+  nvars = vtbl->nvars;
+
+  reset_ftableau(ft, nvars);
+  for (y=0; y<nvars; y++) {
+    ftableau_set_value(ft, y, q_get_double(&arith_var_value(vtbl, y)->main));
+    k = arith_var_lower_index(vtbl, y);
+    if (k >= 0) {
+      ftableau_set_lb(ft, y, q_get_double(&bound[k].main));
+    }
+    k = arith_var_upper_index(vtbl, y);
+    if (k >= 0) {
+      ftableau_set_ub(ft, y, q_get_double(&bound[k].main));
+    }
+  }
+  // the constant is fixed
+  ftableau_set_lb(ft, const_idx, 1.0);
+  ftableau_set_ub(ft, const_idx, 1.0);
+
+  size = 0;
+  x = NULL;
+  a = NULL;
+  m = matrix->nrows;
+  for (i=0; i<m; i++) {
+    row = matrix_row(matrix, i);
+    if (row->size > size) {
+      size = row->size;
+      x = (int32_t *) safe_realloc(x, size * sizeof(int32_t));
+      a = (double *) safe_realloc(a, size * sizeof(double));
+    }
+    n = 0;
+    for (j=0; j<row->size; j++) {
+      if (row->data[j].c_idx >= 0) {
+        x[n] = row->data[j].c_idx;
+        a[n] = q_get_double(&row->data[j].coeff);
+        n ++;
+      }
+    }
+    ftableau_add_row(ft, matrix_basic_var(matrix, i), n, x, a);
+  }
+  safe_free(x);
+  safe_free(a);
+}
+
+
+/*
+ * Make the exact basis match the one found in ft (as much as possible)
+ * - for every row r whose basic variable is non-basic in ft, we pivot
+ *   in a variable of r that's basic in ft but not in the matrix
+ * - return the number of pivots
+ */
+static uint32_t simplex_install_fbasis(simplex_solver_t *solver, ftableau_t *ft) {
+  matrix_t *matrix;
+  row_t *row;
+  uint32_t r, k, n, npivots;
+  thvar_t x, y;
+
+  matrix = &solver->matrix;
+  npivots = 0;
+  n = matrix->nrows;
+  for (r=0; r<n; r++) {
+    x = matrix_basic_var(matrix, r);
+    if (! ftableau_is_basic(ft, x)) {
+      row = matrix_row(matrix, r);
+      for (k=0; k<row->size; k++) {
+        y = row->data[k].c_idx;
+        if (y > const_idx && ftableau_is_basic(ft, y) && matrix_is_nonbasic_var(matrix, y)) {
+          matrix_pivot(matrix, r, k);
+          npivots ++;
+          break;
+        }
+      }
+    }
+  }
+
+  return npivots;
+}
+
+
+/*
+ * Restore the invariants after the basis has changed:
+ * - the non-basic variables are moved to the bound chosen in ft (or clamped
+ *   to their bounds) and their bound flags are updated
+ * - all basic variables are recomputed and the infeasible ones are
+ *   added to the heap
+ */
+static void simplex_reset_assignment_from_ftableau(simplex_solver_t *solver, ftableau_t *ft) {
+  matrix_t *matrix;
+  arith_vartable_t *vtbl;
+  xrational_t *bound;
+  uint32_t i, n;
+  int32_t k;
+  thvar_t x;
+
+  matrix = &solver->matrix;
+  vtbl = &solver->vtbl;
+  bound = solver->bstack.bound;
+
+  n = vtbl->nvars;
+  for (x=1; x<n; x++) {
+    if (matrix_is_nonbasic_var(matrix, x)) {
+      k = -1;
+      switch (ftableau_status(ft, x)) {
+      case FVAR_AT_LB:
+        k = arith_var_lower_index(vtbl, x);
+        break;
+      case FVAR_AT_UB:
+        k = arith_var_upper_index(vtbl, x);
+        break;
+      default:
+        break;
+      }
+      if (k < 0) {
+        if (variable_below_lower_bound(solver, x)) {
+          k = arith_var_lower_index(vtbl, x);
+        } else if (variable_above_upper_bound(solver, x)) {
+          k = arith_var_upper_index(vtbl, x);
+        }
+      }
+      if (k >= 0) {
+        xq_set(arith_var_value(vtbl, x), bound + k);
+      }
+      simplex_set_bound_flags(solver, x);
+    }
+  }
+
+  reset_int_heap(&solver->infeasible_vars);
+  n = matrix->nrows;
+  for (i=0; i<n; i++) {
+    x = matrix_basic_var(matrix, i);
+    simplex_set_basic_var_value(solver, x, matrix_row(matrix, i));
+  }
+}
+
+
+/*
+ * Floating-point phase: search for a feasible basis in floating point
+ * then install it in the exact tableau.
+ * - this is just a heuristic: simplex_check_feasibility must be called
+ *   next to confirm the result (or to finish the search)
+ * - nothing is done if the float search gives up or is interrupted
+ * - if the float search reports infeasibility, we still install the
+ *   basis: the exact check is likely to find the conflict quickly
+ */
+static void simplex_float_phase(simplex_solver_t *solver) {
+  ftableau_t *ft;
+  ftableau_result_t result;
+  uint32_t max_pivots, n;
+
+  solver->stats.num_float_checks ++;
+
+  ft = simplex_get_ftableau(solver);
+  simplex_build_ftableau(solver, ft);
+
+  max_pivots = SIMPLEX_FLOAT_PIVOT_FACTOR * solver->matrix.nrows + SIMPLEX_FLOAT_MIN_PIVOTS;
+  result = ftableau_make_feasible(ft, max_pivots, &solver->interrupted);
+  solver->stats.num_float_pivots += ft->npivots;
+
+  if (result == FTABLEAU_UNKNOWN) {
+    solver->stats.num_float_failures ++;
+    return;
+  }
+
+  n = simplex_install_fbasis(solver, ft);
+  solver->stats.num_pivots += n;
+  simplex_reset_assignment_from_ftableau(solver, ft);
+
+  if (result == FTABLEAU_FEASIBLE && int_heap_is_empty(&solver->infeasible_vars)) {
+    solver->stats.num_float_confirmed ++;
+  }
+
+  trace_printf(solver->core->trace, 15, "(float phase: %"PRIu32" float pivots, %"PRIu32" exact pivots, %"PRIu32" infeasible vars)\n",
+               ft->npivots, n, int_heap_nelems(&solver->infeasible_vars));
+}
+
+
+
 /*********************************
  *  TOP-LEVEL FEASIBILITY CHECK  *
  ********************************/
@@ -4744,6 +4967,14 @@ static bool simplex_make_feasible(simplex_solver_t *solver) {
 #endif
 
   solver->stats.num_make_feasible ++;
+  if (simplex_option_enabled(solver, SIMPLEX_PACKED_MATRIX) && matrix_needs_packing(&solver->matrix)) {
+    matrix_pack(&solver->matrix);
+    solver->stats.num_matrix_packs ++;
+  }
+  if (simplex_option_enabled(solver, SIMPLEX_FLOAT_FIRST) &&
+      int_heap_nelems(&solver->infeasible_vars) >= SIMPLEX_FLOAT_MIN_INFEASIBLE) {
+    simplex_float_phase(solver);
+  }
   feasible = simplex_check_feasibility(solver);
   if (!feasible) {
     simplex_report_conflict(solver);
@@ -10882,6 +11113,12 @@ void delete_simplex_solver(simplex_solver_t *solver) {
     solver->cache = NULL;
   }
 
+  if (solver->ftableau != NULL) {
+    delete_ftableau(solver->ftableau);
+    safe_free(solver->ftableau);
+    solver->ftableau = NULL;
+  }
+
   delete_matrix(&solver->matrix);
   delete_int_heap(&solver->infeasible_vars);
   delete_arith_bstack(&solver->bstack);
@@ -183,6 +183,22 @@ static inline void simplex_disable_adjust_model(simplex_solver_t *solver) {
   simplex_disable_options(solver, SIMPLEX_ADJUST_MODEL);
 }
 
+static inline void simplex_enable_float_first(simplex_solver_t *solver) {
+  simplex_enable_options(solver, SIMPLEX_FLOAT_FIRST);
+}
+
+static inline void simplex_disable_float_first(simplex_solver_t *solver) {
+  simplex_disable_options(solver, SIMPLEX_FLOAT_FIRST);
+}
+
+static inline void simplex_enable_packed_matrix(simplex_solver_t *solver) {
+  simplex_enable_options(solver, SIMPLEX_PACKED_MATRIX);
+}
+
+static inline void simplex_disable_packed_matrix(simplex_solver_t *solver) {
+  simplex_disable_options(solver, SIMPLEX_PACKED_MATRIX);
+}
+
 
 /*
  * Enable/disable the equality propagator
@@ -143,6 +143,7 @@
 #include "solvers/simplex/arith_atomtable.h"
 #include "solvers/simplex/arith_vartable.h"
 #include "solvers/simplex/diophantine_systems.h"
+#include "solvers/simplex/float_tableau.h"
 #include "solvers/simplex/matrices.h"
 #include "solvers/simplex/offset_equalities.h"
 #include "terms/extended_rationals.h"
@@ -639,6 +640,14 @@ typedef struct simplex_stats_s {
   uint32_t num_blands;         // number of activations of bland's rule
   uint32_t num_conflicts;
 
+  // floating-point phase (option FLOAT_FIRST)
+  uint32_t num_float_checks;     // calls to the floating-point search
+  uint32_t num_float_pivots;     // pivots in floating point
+  uint32_t num_float_confirmed;  // float result confirmed without exact pivots
+  uint32_t num_float_failures;   // float search gave up (pivot limit)
+
+  uint32_t num_matrix_packs;     // calls to matrix_pack (option PACKED_MATRIX)
+
   // stats on integer arithmetic solver
   uint32_t num_make_intfeasible;        // calls to make_integer_feasible
   uint32_t num_bound_conflicts;         // unsat by ordinary bound strengthening
@@ -732,6 +741,11 @@ typedef struct simplex_solver_s {
    */
   cache_t *cache;
 
+  /*
+   * Optional floating-point copy of the tableau: allocated when needed
+   */
+  ftableau_t *ftableau;
+
   /*
    * Statistics
    */
@@ -888,6 +902,10 @@ typedef struct simplex_solver_s {
  * - ADJUST_MODEL: attempt to modify the variable assignment to
  *   make the simplex model consistent with the egraph (as much as possible).
  * - EQPROP: enable propagation of equalities to the egraph
+ * - FLOAT_FIRST: before a large feasibility check, search for a good
+ *   basis using a floating-point copy of the tableau (cf. float_tableau.h)
+ * - PACKED_MATRIX: store the tableau rows and columns in packed blocks
+ *   and repack them periodically (cf. matrix_pack in matrices.h)
  *
  * Bland's rule threshold: based on the count of repeat
  * leaving variable. The counter is incremented whenever
@@ -902,6 +920,8 @@ typedef struct simplex_solver_s {
 #define SIMPLEX_ICHECK              0x4
 #define SIMPLEX_ADJUST_MODEL        0x8
 #define SIMPLEX_EQPROP              0x10
+#define SIMPLEX_FLOAT_FIRST         0x20
+#define SIMPLEX_PACKED_MATRIX       0x40
 
 #define SIMPLEX_DISABLE_ALL_OPTIONS 0x0
 
@@ -909,6 +929,16 @@ typedef struct simplex_solver_s {
 #define SIMPLEX_DEFAULT_PROP_ROW_SIZE        30
 #define SIMPLEX_DEFAULT_CHECK_PERIOD   99999999
 
+/*
+ * Floating-point phase: it's used only if make_feasible starts with at
+ * least SIMPLEX_FLOAT_MIN_INFEASIBLE infeasible variables. The number of
+ * floating-point pivots is bounded by SIMPLEX_FLOAT_PIVOT_FACTOR * number
+ * of rows (plus SIMPLEX_FLOAT_MIN_PIVOTS).
+ */
+#define SIMPLEX_FLOAT_MIN_INFEASIBLE 10
+#define SIMPLEX_FLOAT_PIVOT_FACTOR   10
+#define SIMPLEX_FLOAT_MIN_PIVOTS     1000
+
 // default options
 #define SIMPLEX_DEFAULT_OPTIONS (SIMPLEX_DISABLE_ALL_OPTIONS)
 
@@ -0,0 +1,193 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CONTROL BYTES FOR OPEN-ADDRESSING HASH TABLES
+ *
+ * A hash table of size n (a power of 2) is paired with an array ctrl
+ * of control bytes, one per slot:
+ * - ctrl[i] = HCTRL_EMPTY if slot i is empty
+ * - otherwise ctrl[i] = 7-bit tag computed from the hash code of
+ *   the element stored in slot i (so ctrl[i] < 128)
+ *
+ * The tables use linear probing. A probe examines HCTRL_GROUP
+ * consecutive control bytes at once: it returns a bit mask of the
+ * slots whose tag matches and a bit mask of the empty slots. Full
+ * comparisons are done only on the slots whose tag matches (about
+ * one in 128 of the non-matching elements has the same tag).
+ *
+ * To avoid special cases when a group wraps around the end of the
+ * table, the array has n + HCTRL_GROUP - 1 bytes: the last
+ * HCTRL_GROUP - 1 bytes are copies of ctrl[0 ... HCTRL_GROUP - 2].
+ * So a group can be loaded at any index i < n. The table size must
+ * be at least HCTRL_GROUP.
+ *
+ * There are no tombstones: on deletion, the tables shift the elements
+ * that follow the deleted slot in the probe sequence backward.
+ *
+ * The group operations use SSE2 when available, and a plain loop
+ * otherwise.
+ */
+
+#ifndef __HASH_CTRL_BYTES_H
+#define __HASH_CTRL_BYTES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "utils/memalloc.h"
+
+
+#define HCTRL_GROUP 16
+#define HCTRL_EMPTY ((uint8_t) 0x80)
+
+/*
+ * Maximal table size: we want n + HCTRL_GROUP to fit in 32bits
+ */
+#define HCTRL_MAX_SIZE (UINT32_MAX - HCTRL_GROUP)
+
+
+/*
+ * Tag for hash code h: we use the high-order bits since the
+ * low-order bits select the initial slot.
+ */
+static inline uint8_t hctrl_tag(uint32_t h) {
+  return (uint8_t) (h >> 25);
+}
+
+
+/*
+ * Bit mask of the bytes equal to b in ctrl[0 ... HCTRL_GROUP-1]
+ * - bit i is set if ctrl[i] == b
+ */
+static inline uint32_t hctrl_match(const uint8_t *ctrl, uint8_t b) {
+#if defined(__SSE2__)
+  __m128i g;
+
+  g = _mm_loadu_si128((const __m128i *) ctrl);
+  return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char) b)));
+#else
+  uint32_t i, m;
+
+  m = 0;
+  for (i=0; i<HCTRL_GROUP; i++) {
+    m |= ((uint32_t) (ctrl[i] == b)) << i;
+  }
+  return m;
+#endif
+}
+
+
+/*
+ * Bit mask of the empty slots in ctrl[0 ... HCTRL_GROUP-1]
+ * - tags are less than 128 so we just collect the high-order bits
+ */
+static inline uint32_t hctrl_match_empty(const uint8_t *ctrl) {
+#if defined(__SSE2__)
+  return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) ctrl));
+#else
+  uint32_t i, m;
+
+  m = 0;
+  for (i=0; i<HCTRL_GROUP; i++) {
+    m |= ((uint32_t) (ctrl[i] >> 7)) << i;
+  }
+  return m;
+#endif
+}
+
+
+/*
+ * Keep the bits of m that are before the first bit of empty
+ * - if empty is 0, return m unchanged
+ */
+static inline uint32_t hctrl_before_empty(uint32_t m, uint32_t empty) {
+  if (empty != 0) {
+    m &= (empty & (- empty)) - 1;
+  }
+  return m;
+}
+
+
+/*
+ * Hint that *p will be read soon: the tables use this to load the
+ * record at the initial slot while the control bytes are examined
+ * (otherwise a successful search has two serialized cache misses).
+ */
+static inline void hctrl_prefetch(const void *p) {
+#if defined(__GNUC__)
+  __builtin_prefetch(p);
+#else
+  (void) p;
+#endif
+}
+
+
+/*
+ * Allocate a control array for a table of size n: all slots are empty
+ */
+static inline uint8_t *hctrl_alloc(uint32_t n) {
+  uint8_t *ctrl;
+
+  assert(n >= HCTRL_GROUP && n <= HCTRL_MAX_SIZE);
+  ctrl = (uint8_t *) safe_malloc(n + HCTRL_GROUP - 1);
+  memset(ctrl, HCTRL_EMPTY, n + HCTRL_GROUP - 1);
+  return ctrl;
+}
+
+
+/*
+ * Mark all slots as empty
+ */
+static inline void hctrl_clear(uint8_t *ctrl, uint32_t n) {
+  memset(ctrl, HCTRL_EMPTY, n + HCTRL_GROUP - 1);
+}
+
+
+/*
+ * Set the control byte of slot i to b
+ * - n = table size
+ */
+static inline void hctrl_set(uint8_t *ctrl, uint32_t n, uint32_t i, uint8_t b) {
+  assert(i < n);
+  ctrl[i] = b;
+  if (i < HCTRL_GROUP - 1) {
+    ctrl[n + i] = b;
+  }
+}
+
+
+/*
+ * Backward-shift deletion: slot j has just been emptied and slot i
+ * follows j in the probe sequence. The element in slot i can move
+ * to slot j if j is in the cyclic interval [h, i] where h is the
+ * element's initial slot.
+ * - mask = table size - 1
+ */
+static inline bool hctrl_can_shift(uint32_t h, uint32_t i, uint32_t j, uint32_t mask) {
+  return ((i - h) & mask) >= ((i - j) & mask);
+}
+
+
+#endif /* __HASH_CTRL_BYTES_H */
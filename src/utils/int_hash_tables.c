@@ -23,6 +23,8 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "utils/bit_tricks.h"
+#include "utils/hash_ctrl_bytes.h"
 #include "utils/int_hash_tables.h"
 #include "utils/memalloc.h"
 
@@ -43,12 +45,12 @@ static bool is_power_of_two(uint32_t n) {
  * If n = 0 set size = default value
  */
 void init_int_htbl(int_htbl_t *table, uint32_t n) {
-  uint32_t i;
-  int_hrec_t *tmp;
-
   if (n == 0) {
     n = INT_HTBL_DEFAULT_SIZE;
   }
+  if (n < HCTRL_GROUP) {
+    n = HCTRL_GROUP;
+  }
 
   if (n >= MAX_HTBL_SIZE) {
     out_of_memory(); // abort
@@ -56,18 +58,11 @@ void init_int_htbl(int_htbl_t *table, uint32_t n) {
 
   assert(is_power_of_two(n));
 
-  tmp = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
-  for (i=0; i<n; i++) {
-    tmp[i].value = NULL_VALUE;
-  }
-
-  table->records = tmp;
+  table->records = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
+  table->ctrl = hctrl_alloc(n);
   table->size = n;
   table->nelems = 0;
-  table->ndeleted = 0;
-
   table->resize_threshold = (uint32_t)(n * RESIZE_RATIO);
-  table->cleanup_threshold = (uint32_t)(n * CLEANUP_RATIO);
 }
 
 
@@ -76,7 +71,9 @@ void init_int_htbl(int_htbl_t *table, uint32_t n) {
  */
 void delete_int_htbl(int_htbl_t *table) {
   safe_free(table->records);
+  safe_free(table->ctrl);
   table->records = NULL;
+  table->ctrl = NULL;
 }
 
 
@@ -84,82 +81,48 @@ void delete_int_htbl(int_htbl_t *table) {
  * Reset table: remove all elements
  */
 void reset_int_htbl(int_htbl_t *table) {
-  uint32_t i, n;
-
-  n = table->size;
-  for (i=0; i<n; i++) {
-    table->records[i].value = NULL_VALUE;
-  }
-
+  hctrl_clear(table->ctrl, table->size);
   table->nelems = 0;
-  table->ndeleted = 0;
 }
 
 
 
 
 /*
- * Copy record <k, v> into a clean record array t.
- * t contains no DELETED_VALUE and must have at least one empty slot
- * <k, v> must not be present in t.
- * mask must be 2^n - 1 and (size of t) = 2^n
+ * Index of the first empty slot at or after slot j
+ * - mask = size - 1
  */
-static void int_htbl_copy_record(int_hrec_t *t, uint32_t k, int32_t v, uint32_t mask) {
-  uint32_t j;
-  int_hrec_t *r;
+static uint32_t int_htbl_empty_slot(const uint8_t *ctrl, uint32_t j, uint32_t mask) {
+  uint32_t e;
 
-  j = k & mask;
   for (;;) {
-    r = t + j;
-    if (r->value == NULL_VALUE) {
-      r->value = v;
-      r->key = k;
-      return;
+    e = hctrl_match_empty(ctrl + j);
+    if (e != 0) {
+      return (j + ctz(e)) & mask;
     }
-    j ++;
-    j &= mask;
+    j = (j + HCTRL_GROUP) & mask;
   }
 }
 
 
 /*
- * Remove deleted elements
+ * Store record <k, v> in slot j
  */
-static void int_htbl_cleanup(int_htbl_t *table) {
-  int_hrec_t *tmp;
-  uint32_t j, n;
-  uint32_t mask;
-  int32_t v;
-
-  n = table->size;
-  tmp = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
-  for (j=0; j<n; j++) {
-    tmp[j].value = NULL_VALUE;
-  }
-
-  mask = n - 1;
-  for (j=0; j<n; j++) {
-    v = table->records[j].value;
-    if (v >= 0) {
-      int_htbl_copy_record(tmp, table->records[j].key, v, mask);
-    }
-  }
-
-  safe_free(table->records);
-  table->records = tmp;
-  table->ndeleted = 0;
+static inline void int_htbl_store(int_htbl_t *table, uint32_t j, uint32_t k, int32_t v) {
+  table->records[j].key = k;
+  table->records[j].value = v;
+  hctrl_set(table->ctrl, table->size, j, hctrl_tag(k));
 }
 
 
-
 /*
- * Remove deleted elements and make table twice as large
+ * Make the table twice as large
  */
 static void int_htbl_extend(int_htbl_t *table) {
-  int_hrec_t *tmp;
-  uint32_t j, n, n2;
+  int_hrec_t *tmp, *old;
+  uint8_t *ctrl, *old_ctrl;
+  uint32_t i, j, n, n2;
   uint32_t mask;
-  int32_t v;
 
   n = table->size;
   n2 = n<<1;
@@ -169,56 +132,76 @@ static void int_htbl_extend(int_htbl_t *table) {
   }
 
   tmp = (int_hrec_t *) safe_malloc(n2 * sizeof(int_hrec_t));
-  for (j=0; j<n2; j++) {
-    tmp[j].value = NULL_VALUE;
-  }
+  ctrl = hctrl_alloc(n2);
   mask = n2 - 1;
 
-  for (j=0; j<n; j++) {
-    v = table->records[j].value;
-    if (v >= 0) {
-      int_htbl_copy_record(tmp, table->records[j].key, v, mask);
+  old = table->records;
+  old_ctrl = table->ctrl;
+  for (i=0; i<n; i++) {
+    if (old_ctrl[i] != HCTRL_EMPTY) {
+      j = int_htbl_empty_slot(ctrl, old[i].key & mask, mask);
+      tmp[j] = old[i];
+      hctrl_set(ctrl, n2, j, old_ctrl[i]);
     }
   }
 
-  safe_free(table->records);
+  safe_free(old);
+  safe_free(old_ctrl);
   table->records = tmp;
-  table->ndeleted = 0;
+  table->ctrl = ctrl;
   table->size = n2;
 
-  // keep same fill/cleanup ratios
+  // keep the same fill ratio
   table->resize_threshold = (uint32_t) (n2 * RESIZE_RATIO);
-  table->cleanup_threshold = (uint32_t) (n2 * CLEANUP_RATIO);
 }
 
 
 /*
  * Erase <k, v>
+ * - the records that follow it in the probe sequence are shifted backward
+ *   so that every record stays reachable from its initial slot
  */
 void int_htbl_erase_record(int_htbl_t *table, uint32_t k, int32_t v) {
-  uint32_t mask, j;
   int_hrec_t *r;
+  uint8_t *ctrl;
+  uint32_t mask, i, j, m, e;
+  uint8_t tag;
 
   // table must not be full, otherwise the function loops
-  assert(table->size > table->nelems + table->ndeleted);
+  assert(table->size > table->nelems);
 
   mask = table->size - 1;
+  ctrl = table->ctrl;
+  r = table->records;
+  tag = hctrl_tag(k);
   j = k & mask;
   for (;;) {
-    r = table->records + j;
-    if (r->value == v) break;
-    if (r->value == NULL_VALUE) return;
-    j ++;
-    j &= mask;
+    e = hctrl_match_empty(ctrl + j);
+    m = hctrl_before_empty(hctrl_match(ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      if (r[i].value == v) goto found;
+      m &= m - 1;
+    }
+    if (e != 0) return;
+    j = (j + HCTRL_GROUP) & mask;
   }
 
-  assert(r->key == k && r->value == v);
+ found:
+  assert(r[i].key == k && r[i].value == v);
   table->nelems --;
-  table->ndeleted ++;
-  r->value = DELETED_VALUE;
-  if (table->ndeleted > table->cleanup_threshold) {
-    int_htbl_cleanup(table);
+
+  j = i;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (ctrl[j] == HCTRL_EMPTY) break;
+    if (hctrl_can_shift(r[j].key & mask, j, i, mask)) {
+      r[i] = r[j];
+      hctrl_set(ctrl, table->size, i, ctrl[j]);
+      i = j;
+    }
   }
+  hctrl_set(ctrl, table->size, i, HCTRL_EMPTY);
 }
 
 
@@ -228,31 +211,14 @@ void int_htbl_erase_record(int_htbl_t *table, uint32_t k, int32_t v) {
  */
 void int_htbl_add_record(int_htbl_t *table, uint32_t k, int32_t v) {
   uint32_t mask, j;
-  int_hrec_t *r;
 
-  assert(table->size > table->nelems + table->ndeleted);
+  assert(table->size > table->nelems);
 
   mask = table->size - 1;
-  j = k & mask;
-  for (;;) {
-    r = table->records + j;
-    if (r->value == NULL_VALUE) goto add;
-    if (r->value == DELETED_VALUE) break;
-    assert(r->value != v);
-    j ++;
-    j &= mask;
-  }
-
-  assert(table->ndeleted > 0);
-  table->ndeleted --;
-
- add:
-  // add <k, v> into record r
+  j = int_htbl_empty_slot(table->ctrl, k & mask, mask);
+  int_htbl_store(table, j, k, v);
   table->nelems ++;
-  r->key = k;
-  r->value = v;
-
-  if (table->nelems + table->ndeleted > table->resize_threshold) {
+  if (table->nelems > table->resize_threshold) {
     int_htbl_extend(table);
   }
 }
@@ -262,49 +228,34 @@ void int_htbl_add_record(int_htbl_t *table, uint32_t k, int32_t v) {
  * Find index of object equal to o or return -1 if no such index is in the hash table.
  */
 int32_t int_htbl_find_obj(const int_htbl_t *table, const int_hobj_t *o) {
-  uint32_t mask, j, k;
-  int32_t v;
-  int_hrec_t *r;
+  const int_hrec_t *r;
+  const uint8_t *ctrl;
+  uint32_t mask, i, j, k, m, e;
+  uint8_t tag;
 
   // the table must not be full, otherwise, the function loops
-  assert(table->size > table->nelems + table->ndeleted);
+  assert(table->size > table->nelems);
 
   mask = table->size - 1;
+  ctrl = table->ctrl;
+  r = table->records;
   k = o->hash(o);
+  tag = hctrl_tag(k);
   j = k & mask;
+  hctrl_prefetch(r + j);
   for (;;) {
-    r = table->records + j;
-    v = r->value;
-    if ((v >= 0 && r->key == k && o->eq(o, v)) || v == NULL_VALUE) {
-      return v;
-    }
-    j ++;
-    j &= mask;
-  }
-}
-
-
-/*
- * Allocate an index for o (by calling build) then store this index and k in
- * record r. k must be the hash code of o.
- */
-static int32_t int_htbl_store_new_obj(int_htbl_t *table, int_hrec_t *r, uint32_t k, const int_hobj_t *o) {
-  int32_t v;
-
-  v = o->build(o);
-
-  // error in build is signaled by returning v < 0
-  if (v >= 0) {
-    table->nelems ++;
-    r->key = k;
-    r->value = v;
-
-    if (table->nelems + table->ndeleted > table->resize_threshold) {
-      int_htbl_extend(table);
+    e = hctrl_match_empty(ctrl + j);
+    m = hctrl_before_empty(hctrl_match(ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      if (r[i].key == k && o->eq(o, r[i].value)) {
+        return r[i].value;
+      }
+      m &= m - 1;
     }
+    if (e != 0) return NULL_VALUE;
+    j = (j + HCTRL_GROUP) & mask;
   }
-
-  return v;
 }
 
 
@@ -314,40 +265,47 @@ static int32_t int_htbl_store_new_obj(int_htbl_t *table, int_hrec_t *r, uint32_t
  * in the table.
  */
 int32_t int_htbl_get_obj(int_htbl_t *table, const int_hobj_t *o) {
-  uint32_t mask, j, k;
+  const int_hrec_t *r;
+  const uint8_t *ctrl;
+  uint32_t mask, i, j, k, m, e;
   int32_t v;
-  int_hrec_t *r;
-  int_hrec_t *aux;
+  uint8_t tag;
 
-  assert(table->size > table->nelems + table->ndeleted);
+  assert(table->size > table->nelems);
 
   mask = table->size - 1;
+  ctrl = table->ctrl;
+  r = table->records;
   k = o->hash(o);
+  tag = hctrl_tag(k);
   j = k & mask;
-
+  hctrl_prefetch(r + j);
   for (;;) {
-    r = table->records + j;
-    v = r->value;
-    if (v == NULL_VALUE) return int_htbl_store_new_obj(table, r, k, o);
-    if (v == DELETED_VALUE) break;
-    if (r->key == k && o->eq(o, v)) return v;
-    j ++;
-    j &= mask;
+    e = hctrl_match_empty(ctrl + j);
+    m = hctrl_before_empty(hctrl_match(ctrl + j, tag), e);
+    while (m != 0) {
+      i = (j + ctz(m)) & mask;
+      if (r[i].key == k && o->eq(o, r[i].value)) {
+        return r[i].value;
+      }
+      m &= m - 1;
+    }
+    if (e != 0) break;
+    j = (j + HCTRL_GROUP) & mask;
   }
 
-  // aux will be used to store the new index if needed
-  aux = r;
-  for (;;) {
-    j ++;
-    j &= mask;
-    r = table->records + j;
-    v = r->value;
-    if (v == NULL_VALUE) {
-      table->ndeleted --;
-      return int_htbl_store_new_obj(table, aux, k, o);
+  // the new object goes into the first empty slot
+  i = (j + ctz(e)) & mask;
+  v = o->build(o);
+
+  // error in build is signaled by returning v < 0
+  if (v >= 0) {
+    int_htbl_store(table, i, k, v);
+    table->nelems ++;
+    if (table->nelems > table->resize_threshold) {
+      int_htbl_extend(table);
     }
-    if (v >= 0 && r->key == k && o->eq(o, v)) return v;
   }
-}
-
 
+  return v;
+}
@@ -35,20 +35,20 @@
 
 
 /*
- * Hash table = array of records
+ * Hash table = array of records + array of control bytes
  * - each record is a pair <key, value> (key = hash code, value = index)
- * - an empty record has value = NULL_VALUE
- * - a deleted record has value = DELETED_VALUE
- * - other records have a non-negative value
+ * - the control bytes tell which records are in use
+ *   (cf. utils/hash_ctrl_bytes.h): ctrl[i] is HCTRL_EMPTY if record i
+ *   is empty or a 7-bit tag derived from records[i].key otherwise
+ * - records in use have a non-negative value
  * Other fields:
  * - size = size of the record array
  * - nelems = number of elements actually stored
- * - ndeleted = number of deleted elements
- *
  * - resize_threshold: the table is resized when
- *    nelems + ndeleted > resize_threshold
- * - cleanup_threshold: deleted elements are removed when
- *    ndeleted > cleanup_threshold
+ *    nelems > resize_threshold
+ *
+ * Deletion does not leave tombstones (deleted records are filled by
+ * shifting the records that follow them backward).
  */
 typedef struct int_hrec_s {
   uint32_t key;
@@ -56,17 +56,15 @@ typedef struct int_hrec_s {
 } int_hrec_t;
 
 enum {
-  DELETED_VALUE = -2,
   NULL_VALUE = -1,
 };
 
 typedef struct int_htbl_s {
   int_hrec_t *records;
+  uint8_t *ctrl;
   uint32_t size;
   uint32_t nelems;
-  uint32_t ndeleted;
   uint32_t resize_threshold;
-  uint32_t cleanup_threshold;
 } int_htbl_t;
 
 /*
@@ -82,11 +80,9 @@ typedef struct int_htbl_s {
 
 
 /*
- * Ratios: resize_threshold = size * RESIZE_RATIO
- *         cleanup_threshold = size * CLEANUP_RATIO
+ * Ratio: resize_threshold = size * RESIZE_RATIO
  */
 #define RESIZE_RATIO 0.6
-#define CLEANUP_RATIO 0.2
 
 
 /*
@@ -116,6 +112,7 @@ typedef struct int_hobj_s {
 /*
  * Initialize: empty table of size n (n must be a power of 2)
  * If n = 0, the default initial size is used = 64.
+ * If n is less than HCTRL_GROUP (16), the size is HCTRL_GROUP.
  */
 extern void init_int_htbl(int_htbl_t *table, uint32_t n);
 
@@ -0,0 +1,4513 @@
+(set-logic QF_IDL)
+(set-info :source |Random job-shop problem: 100 jobs, 10 tasks per job, 200 machines, seed 2, horizon 64.
+With 1000 variables, it is solved by the sparse IDL solver.|)
+(set-info :smt-lib-version 2.6)
+(set-info :category "crafted")
+(set-info :status unsat)
+(declare-fun t_0_0 () Int)
+(declare-fun t_0_1 () Int)
+(declare-fun t_0_2 () Int)
+(declare-fun t_0_3 () Int)
+(declare-fun t_0_4 () Int)
+(declare-fun t_0_5 () Int)
+(declare-fun t_0_6 () Int)
+(declare-fun t_0_7 () Int)
+(declare-fun t_0_8 () Int)
+(declare-fun t_0_9 () Int)
+(declare-fun t_1_0 () Int)
+(declare-fun t_1_1 () Int)
+(declare-fun t_1_2 () Int)
+(declare-fun t_1_3 () Int)
+(declare-fun t_1_4 () Int)
+(declare-fun t_1_5 () Int)
+(declare-fun t_1_6 () Int)
+(declare-fun t_1_7 () Int)
+(declare-fun t_1_8 () Int)
+(declare-fun t_1_9 () Int)
+(declare-fun t_2_0 () Int)
+(declare-fun t_2_1 () Int)
+(declare-fun t_2_2 () Int)
+(declare-fun t_2_3 () Int)
+(declare-fun t_2_4 () Int)
+(declare-fun t_2_5 () Int)
+(declare-fun t_2_6 () Int)
+(declare-fun t_2_7 () Int)
+(declare-fun t_2_8 () Int)
+(declare-fun t_2_9 () Int)
+(declare-fun t_3_0 () Int)
+(declare-fun t_3_1 () Int)
+(declare-fun t_3_2 () Int)
+(declare-fun t_3_3 () Int)
+(declare-fun t_3_4 () Int)
+(declare-fun t_3_5 () Int)
+(declare-fun t_3_6 () Int)
+(declare-fun t_3_7 () Int)
+(declare-fun t_3_8 () Int)
+(declare-fun t_3_9 () Int)
+(declare-fun t_4_0 () Int)
+(declare-fun t_4_1 () Int)
+(declare-fun t_4_2 () Int)
+(declare-fun t_4_3 () Int)
+(declare-fun t_4_4 () Int)
+(declare-fun t_4_5 () Int)
+(declare-fun t_4_6 () Int)
+(declare-fun t_4_7 () Int)
+(declare-fun t_4_8 () Int)
+(declare-fun t_4_9 () Int)
+(declare-fun t_5_0 () Int)
+(declare-fun t_5_1 () Int)
+(declare-fun t_5_2 () Int)
+(declare-fun t_5_3 () Int)
+(declare-fun t_5_4 () Int)
+(declare-fun t_5_5 () Int)
+(declare-fun t_5_6 () Int)
+(declare-fun t_5_7 () Int)
+(declare-fun t_5_8 () Int)
+(declare-fun t_5_9 () Int)
+(declare-fun t_6_0 () Int)
+(declare-fun t_6_1 () Int)
+(declare-fun t_6_2 () Int)
+(declare-fun t_6_3 () Int)
+(declare-fun t_6_4 () Int)
+(declare-fun t_6_5 () Int)
+(declare-fun t_6_6 () Int)
+(declare-fun t_6_7 () Int)
+(declare-fun t_6_8 () Int)
+(declare-fun t_6_9 () Int)
+(declare-fun t_7_0 () Int)
+(declare-fun t_7_1 () Int)
+(declare-fun t_7_2 () Int)
+(declare-fun t_7_3 () Int)
+(declare-fun t_7_4 () Int)
+(declare-fun t_7_5 () Int)
+(declare-fun t_7_6 () Int)
+(declare-fun t_7_7 () Int)
+(declare-fun t_7_8 () Int)
+(declare-fun t_7_9 () Int)
+(declare-fun t_8_0 () Int)
+(declare-fun t_8_1 () Int)
+(declare-fun t_8_2 () Int)
+(declare-fun t_8_3 () Int)
+(declare-fun t_8_4 () Int)
+(declare-fun t_8_5 () Int)
+(declare-fun t_8_6 () Int)
+(declare-fun t_8_7 () Int)
+(declare-fun t_8_8 () Int)
+(declare-fun t_8_9 () Int)
+(declare-fun t_9_0 () Int)
+(declare-fun t_9_1 () Int)
+(declare-fun t_9_2 () Int)
+(declare-fun t_9_3 () Int)
+(declare-fun t_9_4 () Int)
+(declare-fun t_9_5 () Int)
+(declare-fun t_9_6 () Int)
+(declare-fun t_9_7 () Int)
+(declare-fun t_9_8 () Int)
+(declare-fun t_9_9 () Int)
+(declare-fun t_10_0 () Int)
+(declare-fun t_10_1 () Int)
+(declare-fun t_10_2 () Int)
+(declare-fun t_10_3 () Int)
+(declare-fun t_10_4 () Int)
+(declare-fun t_10_5 () Int)
+(declare-fun t_10_6 () Int)
+(declare-fun t_10_7 () Int)
+(declare-fun t_10_8 () Int)
+(declare-fun t_10_9 () Int)
+(declare-fun t_11_0 () Int)
+(declare-fun t_11_1 () Int)
+(declare-fun t_11_2 () Int)
+(declare-fun t_11_3 () Int)
+(declare-fun t_11_4 () Int)
+(declare-fun t_11_5 () Int)
+(declare-fun t_11_6 () Int)
+(declare-fun t_11_7 () Int)
+(declare-fun t_11_8 () Int)
+(declare-fun t_11_9 () Int)
+(declare-fun t_12_0 () Int)
+(declare-fun t_12_1 () Int)
+(declare-fun t_12_2 () Int)
+(declare-fun t_12_3 () Int)
+(declare-fun t_12_4 () Int)
+(declare-fun t_12_5 () Int)
+(declare-fun t_12_6 () Int)
+(declare-fun t_12_7 () Int)
+(declare-fun t_12_8 () Int)
+(declare-fun t_12_9 () Int)
+(declare-fun t_13_0 () Int)
+(declare-fun t_13_1 () Int)
+(declare-fun t_13_2 () Int)
+(declare-fun t_13_3 () Int)
+(declare-fun t_13_4 () Int)
+(declare-fun t_13_5 () Int)
+(declare-fun t_13_6 () Int)
+(declare-fun t_13_7 () Int)
+(declare-fun t_13_8 () Int)
+(declare-fun t_13_9 () Int)
+(declare-fun t_14_0 () Int)
+(declare-fun t_14_1 () Int)
+(declare-fun t_14_2 () Int)
+(declare-fun t_14_3 () Int)
+(declare-fun t_14_4 () Int)
+(declare-fun t_14_5 () Int)
+(declare-fun t_14_6 () Int)
+(declare-fun t_14_7 () Int)
+(declare-fun t_14_8 () Int)
+(declare-fun t_14_9 () Int)
+(declare-fun t_15_0 () Int)
+(declare-fun t_15_1 () Int)
+(declare-fun t_15_2 () Int)
+(declare-fun t_15_3 () Int)
+(declare-fun t_15_4 () Int)
+(declare-fun t_15_5 () Int)
+(declare-fun t_15_6 () Int)
+(declare-fun t_15_7 () Int)
+(declare-fun t_15_8 () Int)
+(declare-fun t_15_9 () Int)
+(declare-fun t_16_0 () Int)
+(declare-fun t_16_1 () Int)
+(declare-fun t_16_2 () Int)
+(declare-fun t_16_3 () Int)
+(declare-fun t_16_4 () Int)
+(declare-fun t_16_5 () Int)
+(declare-fun t_16_6 () Int)
+(declare-fun t_16_7 () Int)
+(declare-fun t_16_8 () Int)
+(declare-fun t_16_9 () Int)
+(declare-fun t_17_0 () Int)
+(declare-fun t_17_1 () Int)
+(declare-fun t_17_2 () Int)
+(declare-fun t_17_3 () Int)
+(declare-fun t_17_4 () Int)
+(declare-fun t_17_5 () Int)
+(declare-fun t_17_6 () Int)
+(declare-fun t_17_7 () Int)
+(declare-fun t_17_8 () Int)
+(declare-fun t_17_9 () Int)
+(declare-fun t_18_0 () Int)
+(declare-fun t_18_1 () Int)
+(declare-fun t_18_2 () Int)
+(declare-fun t_18_3 () Int)
+(declare-fun t_18_4 () Int)
+(declare-fun t_18_5 () Int)
+(declare-fun t_18_6 () Int)
+(declare-fun t_18_7 () Int)
+(declare-fun t_18_8 () Int)
+(declare-fun t_18_9 () Int)
+(declare-fun t_19_0 () Int)
+(declare-fun t_19_1 () Int)
+(declare-fun t_19_2 () Int)
+(declare-fun t_19_3 () Int)
+(declare-fun t_19_4 () Int)
+(declare-fun t_19_5 () Int)
+(declare-fun t_19_6 () Int)
+(declare-fun t_19_7 () Int)
+(declare-fun t_19_8 () Int)
+(declare-fun t_19_9 () Int)
+(declare-fun t_20_0 () Int)
+(declare-fun t_20_1 () Int)
+(declare-fun t_20_2 () Int)
+(declare-fun t_20_3 () Int)
+(declare-fun t_20_4 () Int)
+(declare-fun t_20_5 () Int)
+(declare-fun t_20_6 () Int)
+(declare-fun t_20_7 () Int)
+(declare-fun t_20_8 () Int)
+(declare-fun t_20_9 () Int)
+(declare-fun t_21_0 () Int)
+(declare-fun t_21_1 () Int)
+(declare-fun t_21_2 () Int)
+(declare-fun t_21_3 () Int)
+(declare-fun t_21_4 () Int)
+(declare-fun t_21_5 () Int)
+(declare-fun t_21_6 () Int)
+(declare-fun t_21_7 () Int)
+(declare-fun t_21_8 () Int)
+(declare-fun t_21_9 () Int)
+(declare-fun t_22_0 () Int)
+(declare-fun t_22_1 () Int)
+(declare-fun t_22_2 () Int)
+(declare-fun t_22_3 () Int)
+(declare-fun t_22_4 () Int)
+(declare-fun t_22_5 () Int)
+(declare-fun t_22_6 () Int)
+(declare-fun t_22_7 () Int)
+(declare-fun t_22_8 () Int)
+(declare-fun t_22_9 () Int)
+(declare-fun t_23_0 () Int)
+(declare-fun t_23_1 () Int)
+(declare-fun t_23_2 () Int)
+(declare-fun t_23_3 () Int)
+(declare-fun t_23_4 () Int)
+(declare-fun t_23_5 () Int)
+(declare-fun t_23_6 () Int)
+(declare-fun t_23_7 () Int)
+(declare-fun t_23_8 () Int)
+(declare-fun t_23_9 () Int)
+(declare-fun t_24_0 () Int)
+(declare-fun t_24_1 () Int)
+(declare-fun t_24_2 () Int)
+(declare-fun t_24_3 () Int)
+(declare-fun t_24_4 () Int)
+(declare-fun t_24_5 () Int)
+(declare-fun t_24_6 () Int)
+(declare-fun t_24_7 () Int)
+(declare-fun t_24_8 () Int)
+(declare-fun t_24_9 () Int)
+(declare-fun t_25_0 () Int)
+(declare-fun t_25_1 () Int)
+(declare-fun t_25_2 () Int)
+(declare-fun t_25_3 () Int)
+(declare-fun t_25_4 () Int)
+(declare-fun t_25_5 () Int)
+(declare-fun t_25_6 () Int)
+(declare-fun t_25_7 () Int)
+(declare-fun t_25_8 () Int)
+(declare-fun t_25_9 () Int)
+(declare-fun t_26_0 () Int)
+(declare-fun t_26_1 () Int)
+(declare-fun t_26_2 () Int)
+(declare-fun t_26_3 () Int)
+(declare-fun t_26_4 () Int)
+(declare-fun t_26_5 () Int)
+(declare-fun t_26_6 () Int)
+(declare-fun t_26_7 () Int)
+(declare-fun t_26_8 () Int)
+(declare-fun t_26_9 () Int)
+(declare-fun t_27_0 () Int)
+(declare-fun t_27_1 () Int)
+(declare-fun t_27_2 () Int)
+(declare-fun t_27_3 () Int)
+(declare-fun t_27_4 () Int)
+(declare-fun t_27_5 () Int)
+(declare-fun t_27_6 () Int)
+(declare-fun t_27_7 () Int)
+(declare-fun t_27_8 () Int)
+(declare-fun t_27_9 () Int)
+(declare-fun t_28_0 () Int)
+(declare-fun t_28_1 () Int)
+(declare-fun t_28_2 () Int)
+(declare-fun t_28_3 () Int)
+(declare-fun t_28_4 () Int)
+(declare-fun t_28_5 () Int)
+(declare-fun t_28_6 () Int)
+(declare-fun t_28_7 () Int)
+(declare-fun t_28_8 () Int)
+(declare-fun t_28_9 () Int)
+(declare-fun t_29_0 () Int)
+(declare-fun t_29_1 () Int)
+(declare-fun t_29_2 () Int)
+(declare-fun t_29_3 () Int)
+(declare-fun t_29_4 () Int)
+(declare-fun t_29_5 () Int)
+(declare-fun t_29_6 () Int)
+(declare-fun t_29_7 () Int)
+(declare-fun t_29_8 () Int)
+(declare-fun t_29_9 () Int)
+(declare-fun t_30_0 () Int)
+(declare-fun t_30_1 () Int)
+(declare-fun t_30_2 () Int)
+(declare-fun t_30_3 () Int)
+(declare-fun t_30_4 () Int)
+(declare-fun t_30_5 () Int)
+(declare-fun t_30_6 () Int)
+(declare-fun t_30_7 () Int)
+(declare-fun t_30_8 () Int)
+(declare-fun t_30_9 () Int)
+(declare-fun t_31_0 () Int)
+(declare-fun t_31_1 () Int)
+(declare-fun t_31_2 () Int)
+(declare-fun t_31_3 () Int)
+(declare-fun t_31_4 () Int)
+(declare-fun t_31_5 () Int)
+(declare-fun t_31_6 () Int)
+(declare-fun t_31_7 () Int)
+(declare-fun t_31_8 () Int)
+(declare-fun t_31_9 () Int)
+(declare-fun t_32_0 () Int)
+(declare-fun t_32_1 () Int)
+(declare-fun t_32_2 () Int)
+(declare-fun t_32_3 () Int)
+(declare-fun t_32_4 () Int)
+(declare-fun t_32_5 () Int)
+(declare-fun t_32_6 () Int)
+(declare-fun t_32_7 () Int)
+(declare-fun t_32_8 () Int)
+(declare-fun t_32_9 () Int)
+(declare-fun t_33_0 () Int)
+(declare-fun t_33_1 () Int)
+(declare-fun t_33_2 () Int)
+(declare-fun t_33_3 () Int)
+(declare-fun t_33_4 () Int)
+(declare-fun t_33_5 () Int)
+(declare-fun t_33_6 () Int)
+(declare-fun t_33_7 () Int)
+(declare-fun t_33_8 () Int)
+(declare-fun t_33_9 () Int)
+(declare-fun t_34_0 () Int)
+(declare-fun t_34_1 () Int)
+(declare-fun t_34_2 () Int)
+(declare-fun t_34_3 () Int)
+(declare-fun t_34_4 () Int)
+(declare-fun t_34_5 () Int)
+(declare-fun t_34_6 () Int)
+(declare-fun t_34_7 () Int)
+(declare-fun t_34_8 () Int)
+(declare-fun t_34_9 () Int)
+(declare-fun t_35_0 () Int)
+(declare-fun t_35_1 () Int)
+(declare-fun t_35_2 () Int)
+(declare-fun t_35_3 () Int)
+(declare-fun t_35_4 () Int)
+(declare-fun t_35_5 () Int)
+(declare-fun t_35_6 () Int)
+(declare-fun t_35_7 () Int)
+(declare-fun t_35_8 () Int)
+(declare-fun t_35_9 () Int)
+(declare-fun t_36_0 () Int)
+(declare-fun t_36_1 () Int)
+(declare-fun t_36_2 () Int)
+(declare-fun t_36_3 () Int)
+(declare-fun t_36_4 () Int)
+(declare-fun t_36_5 () Int)
+(declare-fun t_36_6 () Int)
+(declare-fun t_36_7 () Int)
+(declare-fun t_36_8 () Int)
+(declare-fun t_36_9 () Int)
+(declare-fun t_37_0 () Int)
+(declare-fun t_37_1 () Int)
+(declare-fun t_37_2 () Int)
+(declare-fun t_37_3 () Int)
+(declare-fun t_37_4 () Int)
+(declare-fun t_37_5 () Int)
+(declare-fun t_37_6 () Int)
+(declare-fun t_37_7 () Int)
+(declare-fun t_37_8 () Int)
+(declare-fun t_37_9 () Int)
+(declare-fun t_38_0 () Int)
+(declare-fun t_38_1 () Int)
+(declare-fun t_38_2 () Int)
+(declare-fun t_38_3 () Int)
+(declare-fun t_38_4 () Int)
+(declare-fun t_38_5 () Int)
+(declare-fun t_38_6 () Int)
+(declare-fun t_38_7 () Int)
+(declare-fun t_38_8 () Int)
+(declare-fun t_38_9 () Int)
+(declare-fun t_39_0 () Int)
+(declare-fun t_39_1 () Int)
+(declare-fun t_39_2 () Int)
+(declare-fun t_39_3 () Int)
+(declare-fun t_39_4 () Int)
+(declare-fun t_39_5 () Int)
+(declare-fun t_39_6 () Int)
+(declare-fun t_39_7 () Int)
+(declare-fun t_39_8 () Int)
+(declare-fun t_39_9 () Int)
+(declare-fun t_40_0 () Int)
+(declare-fun t_40_1 () Int)
+(declare-fun t_40_2 () Int)
+(declare-fun t_40_3 () Int)
+(declare-fun t_40_4 () Int)
+(declare-fun t_40_5 () Int)
+(declare-fun t_40_6 () Int)
+(declare-fun t_40_7 () Int)
+(declare-fun t_40_8 () Int)
+(declare-fun t_40_9 () Int)
+(declare-fun t_41_0 () Int)
+(declare-fun t_41_1 () Int)
+(declare-fun t_41_2 () Int)
+(declare-fun t_41_3 () Int)
+(declare-fun t_41_4 () Int)
+(declare-fun t_41_5 () Int)
+(declare-fun t_41_6 () Int)
+(declare-fun t_41_7 () Int)
+(declare-fun t_41_8 () Int)
+(declare-fun t_41_9 () Int)
+(declare-fun t_42_0 () Int)
+(declare-fun t_42_1 () Int)
+(declare-fun t_42_2 () Int)
+(declare-fun t_42_3 () Int)
+(declare-fun t_42_4 () Int)
+(declare-fun t_42_5 () Int)
+(declare-fun t_42_6 () Int)
+(declare-fun t_42_7 () Int)
+(declare-fun t_42_8 () Int)
+(declare-fun t_42_9 () Int)
+(declare-fun t_43_0 () Int)
+(declare-fun t_43_1 () Int)
+(declare-fun t_43_2 () Int)
+(declare-fun t_43_3 () Int)
+(declare-fun t_43_4 () Int)
+(declare-fun t_43_5 () Int)
+(declare-fun t_43_6 () Int)
+(declare-fun t_43_7 () Int)
+(declare-fun t_43_8 () Int)
+(declare-fun t_43_9 () Int)
+(declare-fun t_44_0 () Int)
+(declare-fun t_44_1 () Int)
+(declare-fun t_44_2 () Int)
+(declare-fun t_44_3 () Int)
+(declare-fun t_44_4 () Int)
+(declare-fun t_44_5 () Int)
+(declare-fun t_44_6 () Int)
+(declare-fun t_44_7 () Int)
+(declare-fun t_44_8 () Int)
+(declare-fun t_44_9 () Int)
+(declare-fun t_45_0 () Int)
+(declare-fun t_45_1 () Int)
+(declare-fun t_45_2 () Int)
+(declare-fun t_45_3 () Int)
+(declare-fun t_45_4 () Int)
+(declare-fun t_45_5 () Int)
+(declare-fun t_45_6 () Int)
+(declare-fun t_45_7 () Int)
+(declare-fun t_45_8 () Int)
+(declare-fun t_45_9 () Int)
+(declare-fun t_46_0 () Int)
+(declare-fun t_46_1 () Int)
+(declare-fun t_46_2 () Int)
+(declare-fun t_46_3 () Int)
+(declare-fun t_46_4 () Int)
+(declare-fun t_46_5 () Int)
+(declare-fun t_46_6 () Int)
+(declare-fun t_46_7 () Int)
+(declare-fun t_46_8 () Int)
+(declare-fun t_46_9 () Int)
+(declare-fun t_47_0 () Int)
+(declare-fun t_47_1 () Int)
+(declare-fun t_47_2 () Int)
+(declare-fun t_47_3 () Int)
+(declare-fun t_47_4 () Int)
+(declare-fun t_47_5 () Int)
+(declare-fun t_47_6 () Int)
+(declare-fun t_47_7 () Int)
+(declare-fun t_47_8 () Int)
+(declare-fun t_47_9 () Int)
+(declare-fun t_48_0 () Int)
+(declare-fun t_48_1 () Int)
+(declare-fun t_48_2 () Int)
+(declare-fun t_48_3 () Int)
+(declare-fun t_48_4 () Int)
+(declare-fun t_48_5 () Int)
+(declare-fun t_48_6 () Int)
+(declare-fun t_48_7 () Int)
+(declare-fun t_48_8 () Int)
+(declare-fun t_48_9 () Int)
+(declare-fun t_49_0 () Int)
+(declare-fun t_49_1 () Int)
+(declare-fun t_49_2 () Int)
+(declare-fun t_49_3 () Int)
+(declare-fun t_49_4 () Int)
+(declare-fun t_49_5 () Int)
+(declare-fun t_49_6 () Int)
+(declare-fun t_49_7 () Int)
+(declare-fun t_49_8 () Int)
+(declare-fun t_49_9 () Int)
+(declare-fun t_50_0 () Int)
+(declare-fun t_50_1 () Int)
+(declare-fun t_50_2 () Int)
+(declare-fun t_50_3 () Int)
+(declare-fun t_50_4 () Int)
+(declare-fun t_50_5 () Int)
+(declare-fun t_50_6 () Int)
+(declare-fun t_50_7 () Int)
+(declare-fun t_50_8 () Int)
+(declare-fun t_50_9 () Int)
+(declare-fun t_51_0 () Int)
+(declare-fun t_51_1 () Int)
+(declare-fun t_51_2 () Int)
+(declare-fun t_51_3 () Int)
+(declare-fun t_51_4 () Int)
+(declare-fun t_51_5 () Int)
+(declare-fun t_51_6 () Int)
+(declare-fun t_51_7 () Int)
+(declare-fun t_51_8 () Int)
+(declare-fun t_51_9 () Int)
+(declare-fun t_52_0 () Int)
+(declare-fun t_52_1 () Int)
+(declare-fun t_52_2 () Int)
+(declare-fun t_52_3 () Int)
+(declare-fun t_52_4 () Int)
+(declare-fun t_52_5 () Int)
+(declare-fun t_52_6 () Int)
+(declare-fun t_52_7 () Int)
+(declare-fun t_52_8 () Int)
+(declare-fun t_52_9 () Int)
+(declare-fun t_53_0 () Int)
+(declare-fun t_53_1 () Int)
+(declare-fun t_53_2 () Int)
+(declare-fun t_53_3 () Int)
+(declare-fun t_53_4 () Int)
+(declare-fun t_53_5 () Int)
+(declare-fun t_53_6 () Int)
+(declare-fun t_53_7 () Int)
+(declare-fun t_53_8 () Int)
+(declare-fun t_53_9 () Int)
+(declare-fun t_54_0 () Int)
+(declare-fun t_54_1 () Int)
+(declare-fun t_54_2 () Int)
+(declare-fun t_54_3 () Int)
+(declare-fun t_54_4 () Int)
+(declare-fun t_54_5 () Int)
+(declare-fun t_54_6 () Int)
+(declare-fun t_54_7 () Int)
+(declare-fun t_54_8 () Int)
+(declare-fun t_54_9 () Int)
+(declare-fun t_55_0 () Int)
+(declare-fun t_55_1 () Int)
+(declare-fun t_55_2 () Int)
+(declare-fun t_55_3 () Int)
+(declare-fun t_55_4 () Int)
+(declare-fun t_55_5 () Int)
+(declare-fun t_55_6 () Int)
+(declare-fun t_55_7 () Int)
+(declare-fun t_55_8 () Int)
+(declare-fun t_55_9 () Int)
+(declare-fun t_56_0 () Int)
+(declare-fun t_56_1 () Int)
+(declare-fun t_56_2 () Int)
+(declare-fun t_56_3 () Int)
+(declare-fun t_56_4 () Int)
+(declare-fun t_56_5 () Int)
+(declare-fun t_56_6 () Int)
+(declare-fun t_56_7 () Int)
+(declare-fun t_56_8 () Int)
+(declare-fun t_56_9 () Int)
+(declare-fun t_57_0 () Int)
+(declare-fun t_57_1 () Int)
+(declare-fun t_57_2 () Int)
+(declare-fun t_57_3 () Int)
+(declare-fun t_57_4 () Int)
+(declare-fun t_57_5 () Int)
+(declare-fun t_57_6 () Int)
+(declare-fun t_57_7 () Int)
+(declare-fun t_57_8 () Int)
+(declare-fun t_57_9 () Int)
+(declare-fun t_58_0 () Int)
+(declare-fun t_58_1 () Int)
+(declare-fun t_58_2 () Int)
+(declare-fun t_58_3 () Int)
+(declare-fun t_58_4 () Int)
+(declare-fun t_58_5 () Int)
+(declare-fun t_58_6 () Int)
+(declare-fun t_58_7 () Int)
+(declare-fun t_58_8 () Int)
+(declare-fun t_58_9 () Int)
+(declare-fun t_59_0 () Int)
+(declare-fun t_59_1 () Int)
+(declare-fun t_59_2 () Int)
+(declare-fun t_59_3 () Int)
+(declare-fun t_59_4 () Int)
+(declare-fun t_59_5 () Int)
+(declare-fun t_59_6 () Int)
+(declare-fun t_59_7 () Int)
+(declare-fun t_59_8 () Int)
+(declare-fun t_59_9 () Int)
+(declare-fun t_60_0 () Int)
+(declare-fun t_60_1 () Int)
+(declare-fun t_60_2 () Int)
+(declare-fun t_60_3 () Int)
+(declare-fun t_60_4 () Int)
+(declare-fun t_60_5 () Int)
+(declare-fun t_60_6 () Int)
+(declare-fun t_60_7 () Int)
+(declare-fun t_60_8 () Int)
+(declare-fun t_60_9 () Int)
+(declare-fun t_61_0 () Int)
+(declare-fun t_61_1 () Int)
+(declare-fun t_61_2 () Int)
+(declare-fun t_61_3 () Int)
+(declare-fun t_61_4 () Int)
+(declare-fun t_61_5 () Int)
+(declare-fun t_61_6 () Int)
+(declare-fun t_61_7 () Int)
+(declare-fun t_61_8 () Int)
+(declare-fun t_61_9 () Int)
+(declare-fun t_62_0 () Int)
+(declare-fun t_62_1 () Int)
+(declare-fun t_62_2 () Int)
+(declare-fun t_62_3 () Int)
+(declare-fun t_62_4 () Int)
+(declare-fun t_62_5 () Int)
+(declare-fun t_62_6 () Int)
+(declare-fun t_62_7 () Int)
+(declare-fun t_62_8 () Int)
+(declare-fun t_62_9 () Int)
+(declare-fun t_63_0 () Int)
+(declare-fun t_63_1 () Int)
+(declare-fun t_63_2 () Int)
+(declare-fun t_63_3 () Int)
+(declare-fun t_63_4 () Int)
+(declare-fun t_63_5 () Int)
+(declare-fun t_63_6 () Int)
+(declare-fun t_63_7 () Int)
+(declare-fun t_63_8 () Int)
+(declare-fun t_63_9 () Int)
+(declare-fun t_64_0 () Int)
+(declare-fun t_64_1 () Int)
+(declare-fun t_64_2 () Int)
+(declare-fun t_64_3 () Int)
+(declare-fun t_64_4 () Int)
+(declare-fun t_64_5 () Int)
+(declare-fun t_64_6 () Int)
+(declare-fun t_64_7 () Int)
+(declare-fun t_64_8 () Int)
+(declare-fun t_64_9 () Int)
+(declare-fun t_65_0 () Int)
+(declare-fun t_65_1 () Int)
+(declare-fun t_65_2 () Int)
+(declare-fun t_65_3 () Int)
+(declare-fun t_65_4 () Int)
+(declare-fun t_65_5 () Int)
+(declare-fun t_65_6 () Int)
+(declare-fun t_65_7 () Int)
+(declare-fun t_65_8 () Int)
+(declare-fun t_65_9 () Int)
+(declare-fun t_66_0 () Int)
+(declare-fun t_66_1 () Int)
+(declare-fun t_66_2 () Int)
+(declare-fun t_66_3 () Int)
+(declare-fun t_66_4 () Int)
+(declare-fun t_66_5 () Int)
+(declare-fun t_66_6 () Int)
+(declare-fun t_66_7 () Int)
+(declare-fun t_66_8 () Int)
+(declare-fun t_66_9 () Int)
+(declare-fun t_67_0 () Int)
+(declare-fun t_67_1 () Int)
+(declare-fun t_67_2 () Int)
+(declare-fun t_67_3 () Int)
+(declare-fun t_67_4 () Int)
+(declare-fun t_67_5 () Int)
+(declare-fun t_67_6 () Int)
+(declare-fun t_67_7 () Int)
+(declare-fun t_67_8 () Int)
+(declare-fun t_67_9 () Int)
+(declare-fun t_68_0 () Int)
+(declare-fun t_68_1 () Int)
+(declare-fun t_68_2 () Int)
+(declare-fun t_68_3 () Int)
+(declare-fun t_68_4 () Int)
+(declare-fun t_68_5 () Int)
+(declare-fun t_68_6 () Int)
+(declare-fun t_68_7 () Int)
+(declare-fun t_68_8 () Int)
+(declare-fun t_68_9 () Int)
+(declare-fun t_69_0 () Int)
+(declare-fun t_69_1 () Int)
+(declare-fun t_69_2 () Int)
+(declare-fun t_69_3 () Int)
+(declare-fun t_69_4 () Int)
+(declare-fun t_69_5 () Int)
+(declare-fun t_69_6 () Int)
+(declare-fun t_69_7 () Int)
+(declare-fun t_69_8 () Int)
+(declare-fun t_69_9 () Int)
+(declare-fun t_70_0 () Int)
+(declare-fun t_70_1 () Int)
+(declare-fun t_70_2 () Int)
+(declare-fun t_70_3 () Int)
+(declare-fun t_70_4 () Int)
+(declare-fun t_70_5 () Int)
+(declare-fun t_70_6 () Int)
+(declare-fun t_70_7 () Int)
+(declare-fun t_70_8 () Int)
+(declare-fun t_70_9 () Int)
+(declare-fun t_71_0 () Int)
+(declare-fun t_71_1 () Int)
+(declare-fun t_71_2 () Int)
+(declare-fun t_71_3 () Int)
+(declare-fun t_71_4 () Int)
+(declare-fun t_71_5 () Int)
+(declare-fun t_71_6 () Int)
+(declare-fun t_71_7 () Int)
+(declare-fun t_71_8 () Int)
+(declare-fun t_71_9 () Int)
+(declare-fun t_72_0 () Int)
+(declare-fun t_72_1 () Int)
+(declare-fun t_72_2 () Int)
+(declare-fun t_72_3 () Int)
+(declare-fun t_72_4 () Int)
+(declare-fun t_72_5 () Int)
+(declare-fun t_72_6 () Int)
+(declare-fun t_72_7 () Int)
+(declare-fun t_72_8 () Int)
+(declare-fun t_72_9 () Int)
+(declare-fun t_73_0 () Int)
+(declare-fun t_73_1 () Int)
+(declare-fun t_73_2 () Int)
+(declare-fun t_73_3 () Int)
+(declare-fun t_73_4 () Int)
+(declare-fun t_73_5 () Int)
+(declare-fun t_73_6 () Int)
+(declare-fun t_73_7 () Int)
+(declare-fun t_73_8 () Int)
+(declare-fun t_73_9 () Int)
+(declare-fun t_74_0 () Int)
+(declare-fun t_74_1 () Int)
+(declare-fun t_74_2 () Int)
+(declare-fun t_74_3 () Int)
+(declare-fun t_74_4 () Int)
+(declare-fun t_74_5 () Int)
+(declare-fun t_74_6 () Int)
+(declare-fun t_74_7 () Int)
+(declare-fun t_74_8 () Int)
+(declare-fun t_74_9 () Int)
+(declare-fun t_75_0 () Int)
+(declare-fun t_75_1 () Int)
+(declare-fun t_75_2 () Int)
+(declare-fun t_75_3 () Int)
+(declare-fun t_75_4 () Int)
+(declare-fun t_75_5 () Int)
+(declare-fun t_75_6 () Int)
+(declare-fun t_75_7 () Int)
+(declare-fun t_75_8 () Int)
+(declare-fun t_75_9 () Int)
+(declare-fun t_76_0 () Int)
+(declare-fun t_76_1 () Int)
+(declare-fun t_76_2 () Int)
+(declare-fun t_76_3 () Int)
+(declare-fun t_76_4 () Int)
+(declare-fun t_76_5 () Int)
+(declare-fun t_76_6 () Int)
+(declare-fun t_76_7 () Int)
+(declare-fun t_76_8 () Int)
+(declare-fun t_76_9 () Int)
+(declare-fun t_77_0 () Int)
+(declare-fun t_77_1 () Int)
+(declare-fun t_77_2 () Int)
+(declare-fun t_77_3 () Int)
+(declare-fun t_77_4 () Int)
+(declare-fun t_77_5 () Int)
+(declare-fun t_77_6 () Int)
+(declare-fun t_77_7 () Int)
+(declare-fun t_77_8 () Int)
+(declare-fun t_77_9 () Int)
+(declare-fun t_78_0 () Int)
+(declare-fun t_78_1 () Int)
+(declare-fun t_78_2 () Int)
+(declare-fun t_78_3 () Int)
+(declare-fun t_78_4 () Int)
+(declare-fun t_78_5 () Int)
+(declare-fun t_78_6 () Int)
+(declare-fun t_78_7 () Int)
+(declare-fun t_78_8 () Int)
+(declare-fun t_78_9 () Int)
+(declare-fun t_79_0 () Int)
+(declare-fun t_79_1 () Int)
+(declare-fun t_79_2 () Int)
+(declare-fun t_79_3 () Int)
+(declare-fun t_79_4 () Int)
+(declare-fun t_79_5 () Int)
+(declare-fun t_79_6 () Int)
+(declare-fun t_79_7 () Int)
+(declare-fun t_79_8 () Int)
+(declare-fun t_79_9 () Int)
+(declare-fun t_80_0 () Int)
+(declare-fun t_80_1 () Int)
+(declare-fun t_80_2 () Int)
+(declare-fun t_80_3 () Int)
+(declare-fun t_80_4 () Int)
+(declare-fun t_80_5 () Int)
+(declare-fun t_80_6 () Int)
+(declare-fun t_80_7 () Int)
+(declare-fun t_80_8 () Int)
+(declare-fun t_80_9 () Int)
+(declare-fun t_81_0 () Int)
+(declare-fun t_81_1 () Int)
+(declare-fun t_81_2 () Int)
+(declare-fun t_81_3 () Int)
+(declare-fun t_81_4 () Int)
+(declare-fun t_81_5 () Int)
+(declare-fun t_81_6 () Int)
+(declare-fun t_81_7 () Int)
+(declare-fun t_81_8 () Int)
+(declare-fun t_81_9 () Int)
+(declare-fun t_82_0 () Int)
+(declare-fun t_82_1 () Int)
+(declare-fun t_82_2 () Int)
+(declare-fun t_82_3 () Int)
+(declare-fun t_82_4 () Int)
+(declare-fun t_82_5 () Int)
+(declare-fun t_82_6 () Int)
+(declare-fun t_82_7 () Int)
+(declare-fun t_82_8 () Int)
+(declare-fun t_82_9 () Int)
+(declare-fun t_83_0 () Int)
+(declare-fun t_83_1 () Int)
+(declare-fun t_83_2 () Int)
+(declare-fun t_83_3 () Int)
+(declare-fun t_83_4 () Int)
+(declare-fun t_83_5 () Int)
+(declare-fun t_83_6 () Int)
+(declare-fun t_83_7 () Int)
+(declare-fun t_83_8 () Int)
+(declare-fun t_83_9 () Int)
+(declare-fun t_84_0 () Int)
+(declare-fun t_84_1 () Int)
+(declare-fun t_84_2 () Int)
+(declare-fun t_84_3 () Int)
+(declare-fun t_84_4 () Int)
+(declare-fun t_84_5 () Int)
+(declare-fun t_84_6 () Int)
+(declare-fun t_84_7 () Int)
+(declare-fun t_84_8 () Int)
+(declare-fun t_84_9 () Int)
+(declare-fun t_85_0 () Int)
+(declare-fun t_85_1 () Int)
+(declare-fun t_85_2 () Int)
+(declare-fun t_85_3 () Int)
+(declare-fun t_85_4 () Int)
+(declare-fun t_85_5 () Int)
+(declare-fun t_85_6 () Int)
+(declare-fun t_85_7 () Int)
+(declare-fun t_85_8 () Int)
+(declare-fun t_85_9 () Int)
+(declare-fun t_86_0 () Int)
+(declare-fun t_86_1 () Int)
+(declare-fun t_86_2 () Int)
+(declare-fun t_86_3 () Int)
+(declare-fun t_86_4 () Int)
+(declare-fun t_86_5 () Int)
+(declare-fun t_86_6 () Int)
+(declare-fun t_86_7 () Int)
+(declare-fun t_86_8 () Int)
+(declare-fun t_86_9 () Int)
+(declare-fun t_87_0 () Int)
+(declare-fun t_87_1 () Int)
+(declare-fun t_87_2 () Int)
+(declare-fun t_87_3 () Int)
+(declare-fun t_87_4 () Int)
+(declare-fun t_87_5 () Int)
+(declare-fun t_87_6 () Int)
+(declare-fun t_87_7 () Int)
+(declare-fun t_87_8 () Int)
+(declare-fun t_87_9 () Int)
+(declare-fun t_88_0 () Int)
+(declare-fun t_88_1 () Int)
+(declare-fun t_88_2 () Int)
+(declare-fun t_88_3 () Int)
+(declare-fun t_88_4 () Int)
+(declare-fun t_88_5 () Int)
+(declare-fun t_88_6 () Int)
+(declare-fun t_88_7 () Int)
+(declare-fun t_88_8 () Int)
+(declare-fun t_88_9 () Int)
+(declare-fun t_89_0 () Int)
+(declare-fun t_89_1 () Int)
+(declare-fun t_89_2 () Int)
+(declare-fun t_89_3 () Int)
+(declare-fun t_89_4 () Int)
+(declare-fun t_89_5 () Int)
+(declare-fun t_89_6 () Int)
+(declare-fun t_89_7 () Int)
+(declare-fun t_89_8 () Int)
+(declare-fun t_89_9 () Int)
+(declare-fun t_90_0 () Int)
+(declare-fun t_90_1 () Int)
+(declare-fun t_90_2 () Int)
+(declare-fun t_90_3 () Int)
+(declare-fun t_90_4 () Int)
+(declare-fun t_90_5 () Int)
+(declare-fun t_90_6 () Int)
+(declare-fun t_90_7 () Int)
+(declare-fun t_90_8 () Int)
+(declare-fun t_90_9 () Int)
+(declare-fun t_91_0 () Int)
+(declare-fun t_91_1 () Int)
+(declare-fun t_91_2 () Int)
+(declare-fun t_91_3 () Int)
+(declare-fun t_91_4 () Int)
+(declare-fun t_91_5 () Int)
+(declare-fun t_91_6 () Int)
+(declare-fun t_91_7 () Int)
+(declare-fun t_91_8 () Int)
+(declare-fun t_91_9 () Int)
+(declare-fun t_92_0 () Int)
+(declare-fun t_92_1 () Int)
+(declare-fun t_92_2 () Int)
+(declare-fun t_92_3 () Int)
+(declare-fun t_92_4 () Int)
+(declare-fun t_92_5 () Int)
+(declare-fun t_92_6 () Int)
+(declare-fun t_92_7 () Int)
+(declare-fun t_92_8 () Int)
+(declare-fun t_92_9 () Int)
+(declare-fun t_93_0 () Int)
+(declare-fun t_93_1 () Int)
+(declare-fun t_93_2 () Int)
+(declare-fun t_93_3 () Int)
+(declare-fun t_93_4 () Int)
+(declare-fun t_93_5 () Int)
+(declare-fun t_93_6 () Int)
+(declare-fun t_93_7 () Int)
+(declare-fun t_93_8 () Int)
+(declare-fun t_93_9 () Int)
+(declare-fun t_94_0 () Int)
+(declare-fun t_94_1 () Int)
+(declare-fun t_94_2 () Int)
+(declare-fun t_94_3 () Int)
+(declare-fun t_94_4 () Int)
+(declare-fun t_94_5 () Int)
+(declare-fun t_94_6 () Int)
+(declare-fun t_94_7 () Int)
+(declare-fun t_94_8 () Int)
+(declare-fun t_94_9 () Int)
+(declare-fun t_95_0 () Int)
+(declare-fun t_95_1 () Int)
+(declare-fun t_95_2 () Int)
+(declare-fun t_95_3 () Int)
+(declare-fun t_95_4 () Int)
+(declare-fun t_95_5 () Int)
+(declare-fun t_95_6 () Int)
+(declare-fun t_95_7 () Int)
+(declare-fun t_95_8 () Int)
+(declare-fun t_95_9 () Int)
+(declare-fun t_96_0 () Int)
+(declare-fun t_96_1 () Int)
+(declare-fun t_96_2 () Int)
+(declare-fun t_96_3 () Int)
+(declare-fun t_96_4 () Int)
+(declare-fun t_96_5 () Int)
+(declare-fun t_96_6 () Int)
+(declare-fun t_96_7 () Int)
+(declare-fun t_96_8 () Int)
+(declare-fun t_96_9 () Int)
+(declare-fun t_97_0 () Int)
+(declare-fun t_97_1 () Int)
+(declare-fun t_97_2 () Int)
+(declare-fun t_97_3 () Int)
+(declare-fun t_97_4 () Int)
+(declare-fun t_97_5 () Int)
+(declare-fun t_97_6 () Int)
+(declare-fun t_97_7 () Int)
+(declare-fun t_97_8 () Int)
+(declare-fun t_97_9 () Int)
+(declare-fun t_98_0 () Int)
+(declare-fun t_98_1 () Int)
+(declare-fun t_98_2 () Int)
+(declare-fun t_98_3 () Int)
+(declare-fun t_98_4 () Int)
+(declare-fun t_98_5 () Int)
+(declare-fun t_98_6 () Int)
+(declare-fun t_98_7 () Int)
+(declare-fun t_98_8 () Int)
+(declare-fun t_98_9 () Int)
+(declare-fun t_99_0 () Int)
+(declare-fun t_99_1 () Int)
+(declare-fun t_99_2 () Int)
+(declare-fun t_99_3 () Int)
+(declare-fun t_99_4 () Int)
+(declare-fun t_99_5 () Int)
+(declare-fun t_99_6 () Int)
+(declare-fun t_99_7 () Int)
+(declare-fun t_99_8 () Int)
+(declare-fun t_99_9 () Int)
+(assert (>= t_0_0 0))
+(assert (>= (- t_0_1 t_0_0) 1))
+(assert (>= (- t_0_2 t_0_1) 1))
+(assert (>= (- t_0_3 t_0_2) 1))
+(assert (>= (- t_0_4 t_0_3) 3))
+(assert (>= (- t_0_5 t_0_4) 2))
+(assert (>= (- t_0_6 t_0_5) 3))
+(assert (>= (- t_0_7 t_0_6) 3))
+(assert (>= (- t_0_8 t_0_7) 5))
+(assert (>= (- t_0_9 t_0_8) 2))
+(assert (<= t_0_9 59))
+(assert (>= t_1_0 0))
+(assert (>= (- t_1_1 t_1_0) 1))
+(assert (>= (- t_1_2 t_1_1) 5))
+(assert (>= (- t_1_3 t_1_2) 2))
+(assert (>= (- t_1_4 t_1_3) 4))
+(assert (>= (- t_1_5 t_1_4) 4))
+(assert (>= (- t_1_6 t_1_5) 5))
+(assert (>= (- t_1_7 t_1_6) 3))
+(assert (>= (- t_1_8 t_1_7) 5))
+(assert (>= (- t_1_9 t_1_8) 4))
+(assert (<= t_1_9 59))
+(assert (>= t_2_0 0))
+(assert (>= (- t_2_1 t_2_0) 3))
+(assert (>= (- t_2_2 t_2_1) 1))
+(assert (>= (- t_2_3 t_2_2) 1))
+(assert (>= (- t_2_4 t_2_3) 3))
+(assert (>= (- t_2_5 t_2_4) 4))
+(assert (>= (- t_2_6 t_2_5) 3))
+(assert (>= (- t_2_7 t_2_6) 4))
+(assert (>= (- t_2_8 t_2_7) 4))
+(assert (>= (- t_2_9 t_2_8) 5))
+(assert (<= t_2_9 62))
+(assert (>= t_3_0 0))
+(assert (>= (- t_3_1 t_3_0) 5))
+(assert (>= (- t_3_2 t_3_1) 2))
+(assert (>= (- t_3_3 t_3_2) 2))
+(assert (>= (- t_3_4 t_3_3) 2))
+(assert (>= (- t_3_5 t_3_4) 1))
+(assert (>= (- t_3_6 t_3_5) 2))
+(assert (>= (- t_3_7 t_3_6) 3))
+(assert (>= (- t_3_8 t_3_7) 2))
+(assert (>= (- t_3_9 t_3_8) 2))
+(assert (<= t_3_9 59))
+(assert (>= t_4_0 0))
+(assert (>= (- t_4_1 t_4_0) 5))
+(assert (>= (- t_4_2 t_4_1) 3))
+(assert (>= (- t_4_3 t_4_2) 5))
+(assert (>= (- t_4_4 t_4_3) 5))
+(assert (>= (- t_4_5 t_4_4) 2))
+(assert (>= (- t_4_6 t_4_5) 4))
+(assert (>= (- t_4_7 t_4_6) 4))
+(assert (>= (- t_4_8 t_4_7) 5))
+(assert (>= (- t_4_9 t_4_8) 3))
+(assert (<= t_4_9 59))
+(assert (>= t_5_0 0))
+(assert (>= (- t_5_1 t_5_0) 3))
+(assert (>= (- t_5_2 t_5_1) 3))
+(assert (>= (- t_5_3 t_5_2) 4))
+(assert (>= (- t_5_4 t_5_3) 2))
+(assert (>= (- t_5_5 t_5_4) 4))
+(assert (>= (- t_5_6 t_5_5) 4))
+(assert (>= (- t_5_7 t_5_6) 5))
+(assert (>= (- t_5_8 t_5_7) 2))
+(assert (>= (- t_5_9 t_5_8) 4))
+(assert (<= t_5_9 61))
+(assert (>= t_6_0 0))
+(assert (>= (- t_6_1 t_6_0) 4))
+(assert (>= (- t_6_2 t_6_1) 5))
+(assert (>= (- t_6_3 t_6_2) 5))
+(assert (>= (- t_6_4 t_6_3) 3))
+(assert (>= (- t_6_5 t_6_4) 4))
+(assert (>= (- t_6_6 t_6_5) 4))
+(assert (>= (- t_6_7 t_6_6) 3))
+(assert (>= (- t_6_8 t_6_7) 5))
+(assert (>= (- t_6_9 t_6_8) 5))
+(assert (<= t_6_9 60))
+(assert (>= t_7_0 0))
+(assert (>= (- t_7_1 t_7_0) 4))
+(assert (>= (- t_7_2 t_7_1) 2))
+(assert (>= (- t_7_3 t_7_2) 3))
+(assert (>= (- t_7_4 t_7_3) 2))
+(assert (>= (- t_7_5 t_7_4) 5))
+(assert (>= (- t_7_6 t_7_5) 3))
+(assert (>= (- t_7_7 t_7_6) 4))
+(assert (>= (- t_7_8 t_7_7) 3))
+(assert (>= (- t_7_9 t_7_8) 3))
+(assert (<= t_7_9 59))
+(assert (>= t_8_0 0))
+(assert (>= (- t_8_1 t_8_0) 5))
+(assert (>= (- t_8_2 t_8_1) 5))
+(assert (>= (- t_8_3 t_8_2) 5))
+(assert (>= (- t_8_4 t_8_3) 5))
+(assert (>= (- t_8_5 t_8_4) 5))
+(assert (>= (- t_8_6 t_8_5) 4))
+(assert (>= (- t_8_7 t_8_6) 3))
+(assert (>= (- t_8_8 t_8_7) 2))
+(assert (>= (- t_8_9 t_8_8) 4))
+(assert (<= t_8_9 59))
+(assert (>= t_9_0 0))
+(assert (>= (- t_9_1 t_9_0) 3))
+(assert (>= (- t_9_2 t_9_1) 5))
+(assert (>= (- t_9_3 t_9_2) 1))
+(assert (>= (- t_9_4 t_9_3) 3))
+(assert (>= (- t_9_5 t_9_4) 1))
+(assert (>= (- t_9_6 t_9_5) 2))
+(assert (>= (- t_9_7 t_9_6) 1))
+(assert (>= (- t_9_8 t_9_7) 1))
+(assert (>= (- t_9_9 t_9_8) 5))
+(assert (<= t_9_9 63))
+(assert (>= t_10_0 0))
+(assert (>= (- t_10_1 t_10_0) 3))
+(assert (>= (- t_10_2 t_10_1) 5))
+(assert (>= (- t_10_3 t_10_2) 2))
+(assert (>= (- t_10_4 t_10_3) 1))
+(assert (>= (- t_10_5 t_10_4) 5))
+(assert (>= (- t_10_6 t_10_5) 2))
+(assert (>= (- t_10_7 t_10_6) 3))
+(assert (>= (- t_10_8 t_10_7) 2))
+(assert (>= (- t_10_9 t_10_8) 2))
+(assert (<= t_10_9 63))
+(assert (>= t_11_0 0))
+(assert (>= (- t_11_1 t_11_0) 4))
+(assert (>= (- t_11_2 t_11_1) 1))
+(assert (>= (- t_11_3 t_11_2) 1))
+(assert (>= (- t_11_4 t_11_3) 3))
+(assert (>= (- t_11_5 t_11_4) 3))
+(assert (>= (- t_11_6 t_11_5) 2))
+(assert (>= (- t_11_7 t_11_6) 2))
+(assert (>= (- t_11_8 t_11_7) 1))
+(assert (>= (- t_11_9 t_11_8) 1))
+(assert (<= t_11_9 63))
+(assert (>= t_12_0 0))
+(assert (>= (- t_12_1 t_12_0) 1))
+(assert (>= (- t_12_2 t_12_1) 1))
+(assert (>= (- t_12_3 t_12_2) 1))
+(assert (>= (- t_12_4 t_12_3) 1))
+(assert (>= (- t_12_5 t_12_4) 3))
+(assert (>= (- t_12_6 t_12_5) 3))
+(assert (>= (- t_12_7 t_12_6) 2))
+(assert (>= (- t_12_8 t_12_7) 2))
+(assert (>= (- t_12_9 t_12_8) 2))
+(assert (<= t_12_9 59))
+(assert (>= t_13_0 0))
+(assert (>= (- t_13_1 t_13_0) 1))
+(assert (>= (- t_13_2 t_13_1) 4))
+(assert (>= (- t_13_3 t_13_2) 5))
+(assert (>= (- t_13_4 t_13_3) 1))
+(assert (>= (- t_13_5 t_13_4) 2))
+(assert (>= (- t_13_6 t_13_5) 2))
+(assert (>= (- t_13_7 t_13_6) 1))
+(assert (>= (- t_13_8 t_13_7) 1))
+(assert (>= (- t_13_9 t_13_8) 3))
+(assert (<= t_13_9 59))
+(assert (>= t_14_0 0))
+(assert (>= (- t_14_1 t_14_0) 1))
+(assert (>= (- t_14_2 t_14_1) 3))
+(assert (>= (- t_14_3 t_14_2) 3))
+(assert (>= (- t_14_4 t_14_3) 4))
+(assert (>= (- t_14_5 t_14_4) 1))
+(assert (>= (- t_14_6 t_14_5) 3))
+(assert (>= (- t_14_7 t_14_6) 4))
+(assert (>= (- t_14_8 t_14_7) 5))
+(assert (>= (- t_14_9 t_14_8) 5))
+(assert (<= t_14_9 63))
+(assert (>= t_15_0 0))
+(assert (>= (- t_15_1 t_15_0) 3))
+(assert (>= (- t_15_2 t_15_1) 4))
+(assert (>= (- t_15_3 t_15_2) 5))
+(assert (>= (- t_15_4 t_15_3) 2))
+(assert (>= (- t_15_5 t_15_4) 4))
+(assert (>= (- t_15_6 t_15_5) 2))
+(assert (>= (- t_15_7 t_15_6) 1))
+(assert (>= (- t_15_8 t_15_7) 3))
+(assert (>= (- t_15_9 t_15_8) 1))
+(assert (<= t_15_9 63))
+(assert (>= t_16_0 0))
+(assert (>= (- t_16_1 t_16_0) 4))
+(assert (>= (- t_16_2 t_16_1) 2))
+(assert (>= (- t_16_3 t_16_2) 5))
+(assert (>= (- t_16_4 t_16_3) 5))
+(assert (>= (- t_16_5 t_16_4) 4))
+(assert (>= (- t_16_6 t_16_5) 4))
+(assert (>= (- t_16_7 t_16_6) 5))
+(assert (>= (- t_16_8 t_16_7) 3))
+(assert (>= (- t_16_9 t_16_8) 2))
+(assert (<= t_16_9 61))
+(assert (>= t_17_0 0))
+(assert (>= (- t_17_1 t_17_0) 3))
+(assert (>= (- t_17_2 t_17_1) 3))
+(assert (>= (- t_17_3 t_17_2) 5))
+(assert (>= (- t_17_4 t_17_3) 4))
+(assert (>= (- t_17_5 t_17_4) 1))
+(assert (>= (- t_17_6 t_17_5) 5))
+(assert (>= (- t_17_7 t_17_6) 2))
+(assert (>= (- t_17_8 t_17_7) 1))
+(assert (>= (- t_17_9 t_17_8) 3))
+(assert (<= t_17_9 63))
+(assert (>= t_18_0 0))
+(assert (>= (- t_18_1 t_18_0) 2))
+(assert (>= (- t_18_2 t_18_1) 2))
+(assert (>= (- t_18_3 t_18_2) 2))
+(assert (>= (- t_18_4 t_18_3) 1))
+(assert (>= (- t_18_5 t_18_4) 4))
+(assert (>= (- t_18_6 t_18_5) 2))
+(assert (>= (- t_18_7 t_18_6) 5))
+(assert (>= (- t_18_8 t_18_7) 1))
+(assert (>= (- t_18_9 t_18_8) 2))
+(assert (<= t_18_9 62))
+(assert (>= t_19_0 0))
+(assert (>= (- t_19_1 t_19_0) 4))
+(assert (>= (- t_19_2 t_19_1) 1))
+(assert (>= (- t_19_3 t_19_2) 3))
+(assert (>= (- t_19_4 t_19_3) 1))
+(assert (>= (- t_19_5 t_19_4) 5))
+(assert (>= (- t_19_6 t_19_5) 2))
+(assert (>= (- t_19_7 t_19_6) 5))
+(assert (>= (- t_19_8 t_19_7) 5))
+(assert (>= (- t_19_9 t_19_8) 3))
+(assert (<= t_19_9 61))
+(assert (>= t_20_0 0))
+(assert (>= (- t_20_1 t_20_0) 4))
+(assert (>= (- t_20_2 t_20_1) 3))
+(assert (>= (- t_20_3 t_20_2) 5))
+(assert (>= (- t_20_4 t_20_3) 1))
+(assert (>= (- t_20_5 t_20_4) 2))
+(assert (>= (- t_20_6 t_20_5) 1))
+(assert (>= (- t_20_7 t_20_6) 4))
+(assert (>= (- t_20_8 t_20_7) 4))
+(assert (>= (- t_20_9 t_20_8) 2))
+(assert (<= t_20_9 63))
+(assert (>= t_21_0 0))
+(assert (>= (- t_21_1 t_21_0) 5))
+(assert (>= (- t_21_2 t_21_1) 1))
+(assert (>= (- t_21_3 t_21_2) 2))
+(assert (>= (- t_21_4 t_21_3) 1))
+(assert (>= (- t_21_5 t_21_4) 1))
+(assert (>= (- t_21_6 t_21_5) 1))
+(assert (>= (- t_21_7 t_21_6) 2))
+(assert (>= (- t_21_8 t_21_7) 2))
+(assert (>= (- t_21_9 t_21_8) 1))
+(assert (<= t_21_9 62))
+(assert (>= t_22_0 0))
+(assert (>= (- t_22_1 t_22_0) 1))
+(assert (>= (- t_22_2 t_22_1) 5))
+(assert (>= (- t_22_3 t_22_2) 4))
+(assert (>= (- t_22_4 t_22_3) 4))
+(assert (>= (- t_22_5 t_22_4) 3))
+(assert (>= (- t_22_6 t_22_5) 5))
+(assert (>= (- t_22_7 t_22_6) 4))
+(assert (>= (- t_22_8 t_22_7) 2))
+(assert (>= (- t_22_9 t_22_8) 2))
+(assert (<= t_22_9 60))
+(assert (>= t_23_0 0))
+(assert (>= (- t_23_1 t_23_0) 4))
+(assert (>= (- t_23_2 t_23_1) 5))
+(assert (>= (- t_23_3 t_23_2) 1))
+(assert (>= (- t_23_4 t_23_3) 5))
+(assert (>= (- t_23_5 t_23_4) 5))
+(assert (>= (- t_23_6 t_23_5) 1))
+(assert (>= (- t_23_7 t_23_6) 4))
+(assert (>= (- t_23_8 t_23_7) 5))
+(assert (>= (- t_23_9 t_23_8) 5))
+(assert (<= t_23_9 62))
+(assert (>= t_24_0 0))
+(assert (>= (- t_24_1 t_24_0) 1))
+(assert (>= (- t_24_2 t_24_1) 4))
+(assert (>= (- t_24_3 t_24_2) 3))
+(assert (>= (- t_24_4 t_24_3) 1))
+(assert (>= (- t_24_5 t_24_4) 5))
+(assert (>= (- t_24_6 t_24_5) 1))
+(assert (>= (- t_24_7 t_24_6) 5))
+(assert (>= (- t_24_8 t_24_7) 3))
+(assert (>= (- t_24_9 t_24_8) 3))
+(assert (<= t_24_9 61))
+(assert (>= t_25_0 0))
+(assert (>= (- t_25_1 t_25_0) 3))
+(assert (>= (- t_25_2 t_25_1) 1))
+(assert (>= (- t_25_3 t_25_2) 4))
+(assert (>= (- t_25_4 t_25_3) 1))
+(assert (>= (- t_25_5 t_25_4) 1))
+(assert (>= (- t_25_6 t_25_5) 3))
+(assert (>= (- t_25_7 t_25_6) 2))
+(assert (>= (- t_25_8 t_25_7) 1))
+(assert (>= (- t_25_9 t_25_8) 4))
+(assert (<= t_25_9 63))
+(assert (>= t_26_0 0))
+(assert (>= (- t_26_1 t_26_0) 4))
+(assert (>= (- t_26_2 t_26_1) 4))
+(assert (>= (- t_26_3 t_26_2) 4))
+(assert (>= (- t_26_4 t_26_3) 2))
+(assert (>= (- t_26_5 t_26_4) 5))
+(assert (>= (- t_26_6 t_26_5) 5))
+(assert (>= (- t_26_7 t_26_6) 1))
+(assert (>= (- t_26_8 t_26_7) 1))
+(assert (>= (- t_26_9 t_26_8) 3))
+(assert (<= t_26_9 63))
+(assert (>= t_27_0 0))
+(assert (>= (- t_27_1 t_27_0) 3))
+(assert (>= (- t_27_2 t_27_1) 3))
+(assert (>= (- t_27_3 t_27_2) 1))
+(assert (>= (- t_27_4 t_27_3) 2))
+(assert (>= (- t_27_5 t_27_4) 4))
+(assert (>= (- t_27_6 t_27_5) 2))
+(assert (>= (- t_27_7 t_27_6) 1))
+(assert (>= (- t_27_8 t_27_7) 5))
+(assert (>= (- t_27_9 t_27_8) 3))
+(assert (<= t_27_9 60))
+(assert (>= t_28_0 0))
+(assert (>= (- t_28_1 t_28_0) 4))
+(assert (>= (- t_28_2 t_28_1) 2))
+(assert (>= (- t_28_3 t_28_2) 3))
+(assert (>= (- t_28_4 t_28_3) 4))
+(assert (>= (- t_28_5 t_28_4) 1))
+(assert (>= (- t_28_6 t_28_5) 3))
+(assert (>= (- t_28_7 t_28_6) 1))
+(assert (>= (- t_28_8 t_28_7) 1))
+(assert (>= (- t_28_9 t_28_8) 1))
+(assert (<= t_28_9 59))
+(assert (>= t_29_0 0))
+(assert (>= (- t_29_1 t_29_0) 3))
+(assert (>= (- t_29_2 t_29_1) 4))
+(assert (>= (- t_29_3 t_29_2) 2))
+(assert (>= (- t_29_4 t_29_3) 1))
+(assert (>= (- t_29_5 t_29_4) 1))
+(assert (>= (- t_29_6 t_29_5) 5))
+(assert (>= (- t_29_7 t_29_6) 4))
+(assert (>= (- t_29_8 t_29_7) 1))
+(assert (>= (- t_29_9 t_29_8) 4))
+(assert (<= t_29_9 61))
+(assert (>= t_30_0 0))
+(assert (>= (- t_30_1 t_30_0) 3))
+(assert (>= (- t_30_2 t_30_1) 4))
+(assert (>= (- t_30_3 t_30_2) 2))
+(assert (>= (- t_30_4 t_30_3) 3))
+(assert (>= (- t_30_5 t_30_4) 3))
+(assert (>= (- t_30_6 t_30_5) 4))
+(assert (>= (- t_30_7 t_30_6) 5))
+(assert (>= (- t_30_8 t_30_7) 4))
+(assert (>= (- t_30_9 t_30_8) 4))
+(assert (<= t_30_9 60))
+(assert (>= t_31_0 0))
+(assert (>= (- t_31_1 t_31_0) 3))
+(assert (>= (- t_31_2 t_31_1) 4))
+(assert (>= (- t_31_3 t_31_2) 2))
+(assert (>= (- t_31_4 t_31_3) 2))
+(assert (>= (- t_31_5 t_31_4) 4))
+(assert (>= (- t_31_6 t_31_5) 5))
+(assert (>= (- t_31_7 t_31_6) 3))
+(assert (>= (- t_31_8 t_31_7) 5))
+(assert (>= (- t_31_9 t_31_8) 4))
+(assert (<= t_31_9 63))
+(assert (>= t_32_0 0))
+(assert (>= (- t_32_1 t_32_0) 5))
+(assert (>= (- t_32_2 t_32_1) 5))
+(assert (>= (- t_32_3 t_32_2) 1))
+(assert (>= (- t_32_4 t_32_3) 1))
+(assert (>= (- t_32_5 t_32_4) 3))
+(assert (>= (- t_32_6 t_32_5) 2))
+(assert (>= (- t_32_7 t_32_6) 5))
+(assert (>= (- t_32_8 t_32_7) 2))
+(assert (>= (- t_32_9 t_32_8) 4))
+(assert (<= t_32_9 63))
+(assert (>= t_33_0 0))
+(assert (>= (- t_33_1 t_33_0) 1))
+(assert (>= (- t_33_2 t_33_1) 1))
+(assert (>= (- t_33_3 t_33_2) 2))
+(assert (>= (- t_33_4 t_33_3) 3))
+(assert (>= (- t_33_5 t_33_4) 4))
+(assert (>= (- t_33_6 t_33_5) 2))
+(assert (>= (- t_33_7 t_33_6) 3))
+(assert (>= (- t_33_8 t_33_7) 4))
+(assert (>= (- t_33_9 t_33_8) 2))
+(assert (<= t_33_9 59))
+(assert (>= t_34_0 0))
+(assert (>= (- t_34_1 t_34_0) 3))
+(assert (>= (- t_34_2 t_34_1) 1))
+(assert (>= (- t_34_3 t_34_2) 2))
+(assert (>= (- t_34_4 t_34_3) 5))
+(assert (>= (- t_34_5 t_34_4) 4))
+(assert (>= (- t_34_6 t_34_5) 1))
+(assert (>= (- t_34_7 t_34_6) 3))
+(assert (>= (- t_34_8 t_34_7) 5))
+(assert (>= (- t_34_9 t_34_8) 2))
+(assert (<= t_34_9 59))
+(assert (>= t_35_0 0))
+(assert (>= (- t_35_1 t_35_0) 3))
+(assert (>= (- t_35_2 t_35_1) 2))
+(assert (>= (- t_35_3 t_35_2) 2))
+(assert (>= (- t_35_4 t_35_3) 4))
+(assert (>= (- t_35_5 t_35_4) 2))
+(assert (>= (- t_35_6 t_35_5) 4))
+(assert (>= (- t_35_7 t_35_6) 3))
+(assert (>= (- t_35_8 t_35_7) 5))
+(assert (>= (- t_35_9 t_35_8) 2))
+(assert (<= t_35_9 60))
+(assert (>= t_36_0 0))
+(assert (>= (- t_36_1 t_36_0) 4))
+(assert (>= (- t_36_2 t_36_1) 1))
+(assert (>= (- t_36_3 t_36_2) 5))
+(assert (>= (- t_36_4 t_36_3) 4))
+(assert (>= (- t_36_5 t_36_4) 2))
+(assert (>= (- t_36_6 t_36_5) 4))
+(assert (>= (- t_36_7 t_36_6) 5))
+(assert (>= (- t_36_8 t_36_7) 1))
+(assert (>= (- t_36_9 t_36_8) 4))
+(assert (<= t_36_9 61))
+(assert (>= t_37_0 0))
+(assert (>= (- t_37_1 t_37_0) 4))
+(assert (>= (- t_37_2 t_37_1) 3))
+(assert (>= (- t_37_3 t_37_2) 4))
+(assert (>= (- t_37_4 t_37_3) 4))
+(assert (>= (- t_37_5 t_37_4) 3))
+(assert (>= (- t_37_6 t_37_5) 5))
+(assert (>= (- t_37_7 t_37_6) 3))
+(assert (>= (- t_37_8 t_37_7) 1))
+(assert (>= (- t_37_9 t_37_8) 2))
+(assert (<= t_37_9 59))
+(assert (>= t_38_0 0))
+(assert (>= (- t_38_1 t_38_0) 5))
+(assert (>= (- t_38_2 t_38_1) 2))
+(assert (>= (- t_38_3 t_38_2) 4))
+(assert (>= (- t_38_4 t_38_3) 4))
+(assert (>= (- t_38_5 t_38_4) 1))
+(assert (>= (- t_38_6 t_38_5) 3))
+(assert (>= (- t_38_7 t_38_6) 4))
+(assert (>= (- t_38_8 t_38_7) 5))
+(assert (>= (- t_38_9 t_38_8) 4))
+(assert (<= t_38_9 62))
+(assert (>= t_39_0 0))
+(assert (>= (- t_39_1 t_39_0) 1))
+(assert (>= (- t_39_2 t_39_1) 1))
+(assert (>= (- t_39_3 t_39_2) 4))
+(assert (>= (- t_39_4 t_39_3) 2))
+(assert (>= (- t_39_5 t_39_4) 5))
+(assert (>= (- t_39_6 t_39_5) 5))
+(assert (>= (- t_39_7 t_39_6) 4))
+(assert (>= (- t_39_8 t_39_7) 2))
+(assert (>= (- t_39_9 t_39_8) 1))
+(assert (<= t_39_9 60))
+(assert (>= t_40_0 0))
+(assert (>= (- t_40_1 t_40_0) 5))
+(assert (>= (- t_40_2 t_40_1) 2))
+(assert (>= (- t_40_3 t_40_2) 3))
+(assert (>= (- t_40_4 t_40_3) 5))
+(assert (>= (- t_40_5 t_40_4) 5))
+(assert (>= (- t_40_6 t_40_5) 2))
+(assert (>= (- t_40_7 t_40_6) 4))
+(assert (>= (- t_40_8 t_40_7) 5))
+(assert (>= (- t_40_9 t_40_8) 2))
+(assert (<= t_40_9 63))
+(assert (>= t_41_0 0))
+(assert (>= (- t_41_1 t_41_0) 5))
+(assert (>= (- t_41_2 t_41_1) 4))
+(assert (>= (- t_41_3 t_41_2) 4))
+(assert (>= (- t_41_4 t_41_3) 3))
+(assert (>= (- t_41_5 t_41_4) 5))
+(assert (>= (- t_41_6 t_41_5) 5))
+(assert (>= (- t_41_7 t_41_6) 2))
+(assert (>= (- t_41_8 t_41_7) 4))
+(assert (>= (- t_41_9 t_41_8) 2))
+(assert (<= t_41_9 63))
+(assert (>= t_42_0 0))
+(assert (>= (- t_42_1 t_42_0) 3))
+(assert (>= (- t_42_2 t_42_1) 1))
+(assert (>= (- t_42_3 t_42_2) 4))
+(assert (>= (- t_42_4 t_42_3) 5))
+(assert (>= (- t_42_5 t_42_4) 1))
+(assert (>= (- t_42_6 t_42_5) 5))
+(assert (>= (- t_42_7 t_42_6) 4))
+(assert (>= (- t_42_8 t_42_7) 3))
+(assert (>= (- t_42_9 t_42_8) 4))
+(assert (<= t_42_9 61))
+(assert (>= t_43_0 0))
+(assert (>= (- t_43_1 t_43_0) 5))
+(assert (>= (- t_43_2 t_43_1) 4))
+(assert (>= (- t_43_3 t_43_2) 1))
+(assert (>= (- t_43_4 t_43_3) 1))
+(assert (>= (- t_43_5 t_43_4) 5))
+(assert (>= (- t_43_6 t_43_5) 3))
+(assert (>= (- t_43_7 t_43_6) 2))
+(assert (>= (- t_43_8 t_43_7) 4))
+(assert (>= (- t_43_9 t_43_8) 3))
+(assert (<= t_43_9 62))
+(assert (>= t_44_0 0))
+(assert (>= (- t_44_1 t_44_0) 1))
+(assert (>= (- t_44_2 t_44_1) 2))
+(assert (>= (- t_44_3 t_44_2) 4))
+(assert (>= (- t_44_4 t_44_3) 4))
+(assert (>= (- t_44_5 t_44_4) 4))
+(assert (>= (- t_44_6 t_44_5) 3))
+(assert (>= (- t_44_7 t_44_6) 2))
+(assert (>= (- t_44_8 t_44_7) 1))
+(assert (>= (- t_44_9 t_44_8) 3))
+(assert (<= t_44_9 59))
+(assert (>= t_45_0 0))
+(assert (>= (- t_45_1 t_45_0) 4))
+(assert (>= (- t_45_2 t_45_1) 1))
+(assert (>= (- t_45_3 t_45_2) 3))
+(assert (>= (- t_45_4 t_45_3) 1))
+(assert (>= (- t_45_5 t_45_4) 5))
+(assert (>= (- t_45_6 t_45_5) 4))
+(assert (>= (- t_45_7 t_45_6) 5))
+(assert (>= (- t_45_8 t_45_7) 4))
+(assert (>= (- t_45_9 t_45_8) 2))
+(assert (<= t_45_9 61))
+(assert (>= t_46_0 0))
+(assert (>= (- t_46_1 t_46_0) 4))
+(assert (>= (- t_46_2 t_46_1) 2))
+(assert (>= (- t_46_3 t_46_2) 4))
+(assert (>= (- t_46_4 t_46_3) 5))
+(assert (>= (- t_46_5 t_46_4) 3))
+(assert (>= (- t_46_6 t_46_5) 1))
+(assert (>= (- t_46_7 t_46_6) 3))
+(assert (>= (- t_46_8 t_46_7) 3))
+(assert (>= (- t_46_9 t_46_8) 3))
+(assert (<= t_46_9 61))
+(assert (>= t_47_0 0))
+(assert (>= (- t_47_1 t_47_0) 3))
+(assert (>= (- t_47_2 t_47_1) 4))
+(assert (>= (- t_47_3 t_47_2) 5))
+(assert (>= (- t_47_4 t_47_3) 1))
+(assert (>= (- t_47_5 t_47_4) 5))
+(assert (>= (- t_47_6 t_47_5) 2))
+(assert (>= (- t_47_7 t_47_6) 4))
+(assert (>= (- t_47_8 t_47_7) 5))
+(assert (>= (- t_47_9 t_47_8) 5))
+(assert (<= t_47_9 62))
+(assert (>= t_48_0 0))
+(assert (>= (- t_48_1 t_48_0) 5))
+(assert (>= (- t_48_2 t_48_1) 1))
+(assert (>= (- t_48_3 t_48_2) 3))
+(assert (>= (- t_48_4 t_48_3) 1))
+(assert (>= (- t_48_5 t_48_4) 2))
+(assert (>= (- t_48_6 t_48_5) 4))
+(assert (>= (- t_48_7 t_48_6) 5))
+(assert (>= (- t_48_8 t_48_7) 2))
+(assert (>= (- t_48_9 t_48_8) 5))
+(assert (<= t_48_9 61))
+(assert (>= t_49_0 0))
+(assert (>= (- t_49_1 t_49_0) 1))
+(assert (>= (- t_49_2 t_49_1) 1))
+(assert (>= (- t_49_3 t_49_2) 1))
+(assert (>= (- t_49_4 t_49_3) 4))
+(assert (>= (- t_49_5 t_49_4) 3))
+(assert (>= (- t_49_6 t_49_5) 2))
+(assert (>= (- t_49_7 t_49_6) 3))
+(assert (>= (- t_49_8 t_49_7) 3))
+(assert (>= (- t_49_9 t_49_8) 1))
+(assert (<= t_49_9 61))
+(assert (>= t_50_0 0))
+(assert (>= (- t_50_1 t_50_0) 4))
+(assert (>= (- t_50_2 t_50_1) 3))
+(assert (>= (- t_50_3 t_50_2) 2))
+(assert (>= (- t_50_4 t_50_3) 4))
+(assert (>= (- t_50_5 t_50_4) 4))
+(assert (>= (- t_50_6 t_50_5) 3))
+(assert (>= (- t_50_7 t_50_6) 4))
+(assert (>= (- t_50_8 t_50_7) 2))
+(assert (>= (- t_50_9 t_50_8) 4))
+(assert (<= t_50_9 62))
+(assert (>= t_51_0 0))
+(assert (>= (- t_51_1 t_51_0) 3))
+(assert (>= (- t_51_2 t_51_1) 3))
+(assert (>= (- t_51_3 t_51_2) 2))
+(assert (>= (- t_51_4 t_51_3) 1))
+(assert (>= (- t_51_5 t_51_4) 2))
+(assert (>= (- t_51_6 t_51_5) 4))
+(assert (>= (- t_51_7 t_51_6) 2))
+(assert (>= (- t_51_8 t_51_7) 3))
+(assert (>= (- t_51_9 t_51_8) 2))
+(assert (<= t_51_9 61))
+(assert (>= t_52_0 0))
+(assert (>= (- t_52_1 t_52_0) 2))
+(assert (>= (- t_52_2 t_52_1) 2))
+(assert (>= (- t_52_3 t_52_2) 2))
+(assert (>= (- t_52_4 t_52_3) 3))
+(assert (>= (- t_52_5 t_52_4) 5))
+(assert (>= (- t_52_6 t_52_5) 4))
+(assert (>= (- t_52_7 t_52_6) 4))
+(assert (>= (- t_52_8 t_52_7) 3))
+(assert (>= (- t_52_9 t_52_8) 3))
+(assert (<= t_52_9 59))
+(assert (>= t_53_0 0))
+(assert (>= (- t_53_1 t_53_0) 5))
+(assert (>= (- t_53_2 t_53_1) 5))
+(assert (>= (- t_53_3 t_53_2) 3))
+(assert (>= (- t_53_4 t_53_3) 4))
+(assert (>= (- t_53_5 t_53_4) 3))
+(assert (>= (- t_53_6 t_53_5) 5))
+(assert (>= (- t_53_7 t_53_6) 5))
+(assert (>= (- t_53_8 t_53_7) 1))
+(assert (>= (- t_53_9 t_53_8) 3))
+(assert (<= t_53_9 61))
+(assert (>= t_54_0 0))
+(assert (>= (- t_54_1 t_54_0) 4))
+(assert (>= (- t_54_2 t_54_1) 4))
+(assert (>= (- t_54_3 t_54_2) 2))
+(assert (>= (- t_54_4 t_54_3) 3))
+(assert (>= (- t_54_5 t_54_4) 3))
+(assert (>= (- t_54_6 t_54_5) 4))
+(assert (>= (- t_54_7 t_54_6) 4))
+(assert (>= (- t_54_8 t_54_7) 1))
+(assert (>= (- t_54_9 t_54_8) 2))
+(assert (<= t_54_9 61))
+(assert (>= t_55_0 0))
+(assert (>= (- t_55_1 t_55_0) 4))
+(assert (>= (- t_55_2 t_55_1) 2))
+(assert (>= (- t_55_3 t_55_2) 1))
+(assert (>= (- t_55_4 t_55_3) 1))
+(assert (>= (- t_55_5 t_55_4) 3))
+(assert (>= (- t_55_6 t_55_5) 2))
+(assert (>= (- t_55_7 t_55_6) 3))
+(assert (>= (- t_55_8 t_55_7) 1))
+(assert (>= (- t_55_9 t_55_8) 4))
+(assert (<= t_55_9 63))
+(assert (>= t_56_0 0))
+(assert (>= (- t_56_1 t_56_0) 5))
+(assert (>= (- t_56_2 t_56_1) 3))
+(assert (>= (- t_56_3 t_56_2) 2))
+(assert (>= (- t_56_4 t_56_3) 5))
+(assert (>= (- t_56_5 t_56_4) 4))
+(assert (>= (- t_56_6 t_56_5) 5))
+(assert (>= (- t_56_7 t_56_6) 3))
+(assert (>= (- t_56_8 t_56_7) 4))
+(assert (>= (- t_56_9 t_56_8) 2))
+(assert (<= t_56_9 61))
+(assert (>= t_57_0 0))
+(assert (>= (- t_57_1 t_57_0) 3))
+(assert (>= (- t_57_2 t_57_1) 2))
+(assert (>= (- t_57_3 t_57_2) 4))
+(assert (>= (- t_57_4 t_57_3) 1))
+(assert (>= (- t_57_5 t_57_4) 2))
+(assert (>= (- t_57_6 t_57_5) 2))
+(assert (>= (- t_57_7 t_57_6) 3))
+(assert (>= (- t_57_8 t_57_7) 3))
+(assert (>= (- t_57_9 t_57_8) 2))
+(assert (<= t_57_9 60))
+(assert (>= t_58_0 0))
+(assert (>= (- t_58_1 t_58_0) 3))
+(assert (>= (- t_58_2 t_58_1) 3))
+(assert (>= (- t_58_3 t_58_2) 1))
+(assert (>= (- t_58_4 t_58_3) 3))
+(assert (>= (- t_58_5 t_58_4) 2))
+(assert (>= (- t_58_6 t_58_5) 2))
+(assert (>= (- t_58_7 t_58_6) 2))
+(assert (>= (- t_58_8 t_58_7) 5))
+(assert (>= (- t_58_9 t_58_8) 1))
+(assert (<= t_58_9 61))
+(assert (>= t_59_0 0))
+(assert (>= (- t_59_1 t_59_0) 3))
+(assert (>= (- t_59_2 t_59_1) 5))
+(assert (>= (- t_59_3 t_59_2) 1))
+(assert (>= (- t_59_4 t_59_3) 2))
+(assert (>= (- t_59_5 t_59_4) 2))
+(assert (>= (- t_59_6 t_59_5) 1))
+(assert (>= (- t_59_7 t_59_6) 4))
+(assert (>= (- t_59_8 t_59_7) 4))
+(assert (>= (- t_59_9 t_59_8) 3))
+(assert (<= t_59_9 62))
+(assert (>= t_60_0 0))
+(assert (>= (- t_60_1 t_60_0) 3))
+(assert (>= (- t_60_2 t_60_1) 5))
+(assert (>= (- t_60_3 t_60_2) 5))
+(assert (>= (- t_60_4 t_60_3) 1))
+(assert (>= (- t_60_5 t_60_4) 3))
+(assert (>= (- t_60_6 t_60_5) 5))
+(assert (>= (- t_60_7 t_60_6) 4))
+(assert (>= (- t_60_8 t_60_7) 2))
+(assert (>= (- t_60_9 t_60_8) 1))
+(assert (<= t_60_9 60))
+(assert (>= t_61_0 0))
+(assert (>= (- t_61_1 t_61_0) 4))
+(assert (>= (- t_61_2 t_61_1) 4))
+(assert (>= (- t_61_3 t_61_2) 5))
+(assert (>= (- t_61_4 t_61_3) 3))
+(assert (>= (- t_61_5 t_61_4) 5))
+(assert (>= (- t_61_6 t_61_5) 5))
+(assert (>= (- t_61_7 t_61_6) 5))
+(assert (>= (- t_61_8 t_61_7) 1))
+(assert (>= (- t_61_9 t_61_8) 5))
+(assert (<= t_61_9 59))
+(assert (>= t_62_0 0))
+(assert (>= (- t_62_1 t_62_0) 5))
+(assert (>= (- t_62_2 t_62_1) 4))
+(assert (>= (- t_62_3 t_62_2) 4))
+(assert (>= (- t_62_4 t_62_3) 4))
+(assert (>= (- t_62_5 t_62_4) 2))
+(assert (>= (- t_62_6 t_62_5) 4))
+(assert (>= (- t_62_7 t_62_6) 4))
+(assert (>= (- t_62_8 t_62_7) 5))
+(assert (>= (- t_62_9 t_62_8) 4))
+(assert (<= t_62_9 63))
+(assert (>= t_63_0 0))
+(assert (>= (- t_63_1 t_63_0) 1))
+(assert (>= (- t_63_2 t_63_1) 4))
+(assert (>= (- t_63_3 t_63_2) 5))
+(assert (>= (- t_63_4 t_63_3) 2))
+(assert (>= (- t_63_5 t_63_4) 1))
+(assert (>= (- t_63_6 t_63_5) 5))
+(assert (>= (- t_63_7 t_63_6) 2))
+(assert (>= (- t_63_8 t_63_7) 1))
+(assert (>= (- t_63_9 t_63_8) 4))
+(assert (<= t_63_9 61))
+(assert (>= t_64_0 0))
+(assert (>= (- t_64_1 t_64_0) 4))
+(assert (>= (- t_64_2 t_64_1) 1))
+(assert (>= (- t_64_3 t_64_2) 3))
+(assert (>= (- t_64_4 t_64_3) 1))
+(assert (>= (- t_64_5 t_64_4) 3))
+(assert (>= (- t_64_6 t_64_5) 2))
+(assert (>= (- t_64_7 t_64_6) 2))
+(assert (>= (- t_64_8 t_64_7) 1))
+(assert (>= (- t_64_9 t_64_8) 2))
+(assert (<= t_64_9 60))
+(assert (>= t_65_0 0))
+(assert (>= (- t_65_1 t_65_0) 1))
+(assert (>= (- t_65_2 t_65_1) 3))
+(assert (>= (- t_65_3 t_65_2) 4))
+(assert (>= (- t_65_4 t_65_3) 1))
+(assert (>= (- t_65_5 t_65_4) 4))
+(assert (>= (- t_65_6 t_65_5) 2))
+(assert (>= (- t_65_7 t_65_6) 1))
+(assert (>= (- t_65_8 t_65_7) 4))
+(assert (>= (- t_65_9 t_65_8) 2))
+(assert (<= t_65_9 59))
+(assert (>= t_66_0 0))
+(assert (>= (- t_66_1 t_66_0) 1))
+(assert (>= (- t_66_2 t_66_1) 2))
+(assert (>= (- t_66_3 t_66_2) 5))
+(assert (>= (- t_66_4 t_66_3) 5))
+(assert (>= (- t_66_5 t_66_4) 1))
+(assert (>= (- t_66_6 t_66_5) 1))
+(assert (>= (- t_66_7 t_66_6) 2))
+(assert (>= (- t_66_8 t_66_7) 5))
+(assert (>= (- t_66_9 t_66_8) 1))
+(assert (<= t_66_9 59))
+(assert (>= t_67_0 0))
+(assert (>= (- t_67_1 t_67_0) 3))
+(assert (>= (- t_67_2 t_67_1) 5))
+(assert (>= (- t_67_3 t_67_2) 2))
+(assert (>= (- t_67_4 t_67_3) 2))
+(assert (>= (- t_67_5 t_67_4) 3))
+(assert (>= (- t_67_6 t_67_5) 4))
+(assert (>= (- t_67_7 t_67_6) 1))
+(assert (>= (- t_67_8 t_67_7) 2))
+(assert (>= (- t_67_9 t_67_8) 5))
+(assert (<= t_67_9 63))
+(assert (>= t_68_0 0))
+(assert (>= (- t_68_1 t_68_0) 2))
+(assert (>= (- t_68_2 t_68_1) 1))
+(assert (>= (- t_68_3 t_68_2) 4))
+(assert (>= (- t_68_4 t_68_3) 2))
+(assert (>= (- t_68_5 t_68_4) 1))
+(assert (>= (- t_68_6 t_68_5) 5))
+(assert (>= (- t_68_7 t_68_6) 2))
+(assert (>= (- t_68_8 t_68_7) 4))
+(assert (>= (- t_68_9 t_68_8) 3))
+(assert (<= t_68_9 59))
+(assert (>= t_69_0 0))
+(assert (>= (- t_69_1 t_69_0) 4))
+(assert (>= (- t_69_2 t_69_1) 5))
+(assert (>= (- t_69_3 t_69_2) 5))
+(assert (>= (- t_69_4 t_69_3) 2))
+(assert (>= (- t_69_5 t_69_4) 5))
+(assert (>= (- t_69_6 t_69_5) 1))
+(assert (>= (- t_69_7 t_69_6) 2))
+(assert (>= (- t_69_8 t_69_7) 2))
+(assert (>= (- t_69_9 t_69_8) 2))
+(assert (<= t_69_9 60))
+(assert (>= t_70_0 0))
+(assert (>= (- t_70_1 t_70_0) 2))
+(assert (>= (- t_70_2 t_70_1) 3))
+(assert (>= (- t_70_3 t_70_2) 3))
+(assert (>= (- t_70_4 t_70_3) 4))
+(assert (>= (- t_70_5 t_70_4) 2))
+(assert (>= (- t_70_6 t_70_5) 4))
+(assert (>= (- t_70_7 t_70_6) 2))
+(assert (>= (- t_70_8 t_70_7) 4))
+(assert (>= (- t_70_9 t_70_8) 3))
+(assert (<= t_70_9 61))
+(assert (>= t_71_0 0))
+(assert (>= (- t_71_1 t_71_0) 1))
+(assert (>= (- t_71_2 t_71_1) 5))
+(assert (>= (- t_71_3 t_71_2) 1))
+(assert (>= (- t_71_4 t_71_3) 4))
+(assert (>= (- t_71_5 t_71_4) 3))
+(assert (>= (- t_71_6 t_71_5) 3))
+(assert (>= (- t_71_7 t_71_6) 5))
+(assert (>= (- t_71_8 t_71_7) 4))
+(assert (>= (- t_71_9 t_71_8) 3))
+(assert (<= t_71_9 62))
+(assert (>= t_72_0 0))
+(assert (>= (- t_72_1 t_72_0) 4))
+(assert (>= (- t_72_2 t_72_1) 2))
+(assert (>= (- t_72_3 t_72_2) 5))
+(assert (>= (- t_72_4 t_72_3) 1))
+(assert (>= (- t_72_5 t_72_4) 1))
+(assert (>= (- t_72_6 t_72_5) 5))
+(assert (>= (- t_72_7 t_72_6) 5))
+(assert (>= (- t_72_8 t_72_7) 2))
+(assert (>= (- t_72_9 t_72_8) 2))
+(assert (<= t_72_9 62))
+(assert (>= t_73_0 0))
+(assert (>= (- t_73_1 t_73_0) 4))
+(assert (>= (- t_73_2 t_73_1) 5))
+(assert (>= (- t_73_3 t_73_2) 1))
+(assert (>= (- t_73_4 t_73_3) 2))
+(assert (>= (- t_73_5 t_73_4) 1))
+(assert (>= (- t_73_6 t_73_5) 3))
+(assert (>= (- t_73_7 t_73_6) 4))
+(assert (>= (- t_73_8 t_73_7) 5))
+(assert (>= (- t_73_9 t_73_8) 1))
+(assert (<= t_73_9 62))
+(assert (>= t_74_0 0))
+(assert (>= (- t_74_1 t_74_0) 2))
+(assert (>= (- t_74_2 t_74_1) 5))
+(assert (>= (- t_74_3 t_74_2) 3))
+(assert (>= (- t_74_4 t_74_3) 1))
+(assert (>= (- t_74_5 t_74_4) 2))
+(assert (>= (- t_74_6 t_74_5) 1))
+(assert (>= (- t_74_7 t_74_6) 2))
+(assert (>= (- t_74_8 t_74_7) 5))
+(assert (>= (- t_74_9 t_74_8) 2))
+(assert (<= t_74_9 63))
+(assert (>= t_75_0 0))
+(assert (>= (- t_75_1 t_75_0) 4))
+(assert (>= (- t_75_2 t_75_1) 3))
+(assert (>= (- t_75_3 t_75_2) 2))
+(assert (>= (- t_75_4 t_75_3) 2))
+(assert (>= (- t_75_5 t_75_4) 3))
+(assert (>= (- t_75_6 t_75_5) 3))
+(assert (>= (- t_75_7 t_75_6) 5))
+(assert (>= (- t_75_8 t_75_7) 5))
+(assert (>= (- t_75_9 t_75_8) 1))
+(assert (<= t_75_9 60))
+(assert (>= t_76_0 0))
+(assert (>= (- t_76_1 t_76_0) 4))
+(assert (>= (- t_76_2 t_76_1) 1))
+(assert (>= (- t_76_3 t_76_2) 4))
+(assert (>= (- t_76_4 t_76_3) 3))
+(assert (>= (- t_76_5 t_76_4) 1))
+(assert (>= (- t_76_6 t_76_5) 3))
+(assert (>= (- t_76_7 t_76_6) 1))
+(assert (>= (- t_76_8 t_76_7) 2))
+(assert (>= (- t_76_9 t_76_8) 4))
+(assert (<= t_76_9 61))
+(assert (>= t_77_0 0))
+(assert (>= (- t_77_1 t_77_0) 3))
+(assert (>= (- t_77_2 t_77_1) 5))
+(assert (>= (- t_77_3 t_77_2) 4))
+(assert (>= (- t_77_4 t_77_3) 5))
+(assert (>= (- t_77_5 t_77_4) 5))
+(assert (>= (- t_77_6 t_77_5) 2))
+(assert (>= (- t_77_7 t_77_6) 4))
+(assert (>= (- t_77_8 t_77_7) 2))
+(assert (>= (- t_77_9 t_77_8) 2))
+(assert (<= t_77_9 60))
+(assert (>= t_78_0 0))
+(assert (>= (- t_78_1 t_78_0) 4))
+(assert (>= (- t_78_2 t_78_1) 3))
+(assert (>= (- t_78_3 t_78_2) 4))
+(assert (>= (- t_78_4 t_78_3) 4))
+(assert (>= (- t_78_5 t_78_4) 5))
+(assert (>= (- t_78_6 t_78_5) 3))
+(assert (>= (- t_78_7 t_78_6) 5))
+(assert (>= (- t_78_8 t_78_7) 2))
+(assert (>= (- t_78_9 t_78_8) 5))
+(assert (<= t_78_9 60))
+(assert (>= t_79_0 0))
+(assert (>= (- t_79_1 t_79_0) 4))
+(assert (>= (- t_79_2 t_79_1) 2))
+(assert (>= (- t_79_3 t_79_2) 4))
+(assert (>= (- t_79_4 t_79_3) 5))
+(assert (>= (- t_79_5 t_79_4) 3))
+(assert (>= (- t_79_6 t_79_5) 3))
+(assert (>= (- t_79_7 t_79_6) 1))
+(assert (>= (- t_79_8 t_79_7) 2))
+(assert (>= (- t_79_9 t_79_8) 3))
+(assert (<= t_79_9 59))
+(assert (>= t_80_0 0))
+(assert (>= (- t_80_1 t_80_0) 4))
+(assert (>= (- t_80_2 t_80_1) 2))
+(assert (>= (- t_80_3 t_80_2) 5))
+(assert (>= (- t_80_4 t_80_3) 5))
+(assert (>= (- t_80_5 t_80_4) 2))
+(assert (>= (- t_80_6 t_80_5) 3))
+(assert (>= (- t_80_7 t_80_6) 2))
+(assert (>= (- t_80_8 t_80_7) 5))
+(assert (>= (- t_80_9 t_80_8) 3))
+(assert (<= t_80_9 63))
+(assert (>= t_81_0 0))
+(assert (>= (- t_81_1 t_81_0) 1))
+(assert (>= (- t_81_2 t_81_1) 1))
+(assert (>= (- t_81_3 t_81_2) 2))
+(assert (>= (- t_81_4 t_81_3) 3))
+(assert (>= (- t_81_5 t_81_4) 1))
+(assert (>= (- t_81_6 t_81_5) 3))
+(assert (>= (- t_81_7 t_81_6) 5))
+(assert (>= (- t_81_8 t_81_7) 3))
+(assert (>= (- t_81_9 t_81_8) 3))
+(assert (<= t_81_9 60))
+(assert (>= t_82_0 0))
+(assert (>= (- t_82_1 t_82_0) 1))
+(assert (>= (- t_82_2 t_82_1) 4))
+(assert (>= (- t_82_3 t_82_2) 4))
+(assert (>= (- t_82_4 t_82_3) 1))
+(assert (>= (- t_82_5 t_82_4) 3))
+(assert (>= (- t_82_6 t_82_5) 5))
+(assert (>= (- t_82_7 t_82_6) 5))
+(assert (>= (- t_82_8 t_82_7) 2))
+(assert (>= (- t_82_9 t_82_8) 2))
+(assert (<= t_82_9 62))
+(assert (>= t_83_0 0))
+(assert (>= (- t_83_1 t_83_0) 2))
+(assert (>= (- t_83_2 t_83_1) 5))
+(assert (>= (- t_83_3 t_83_2) 4))
+(assert (>= (- t_83_4 t_83_3) 1))
+(assert (>= (- t_83_5 t_83_4) 5))
+(assert (>= (- t_83_6 t_83_5) 4))
+(assert (>= (- t_83_7 t_83_6) 3))
+(assert (>= (- t_83_8 t_83_7) 1))
+(assert (>= (- t_83_9 t_83_8) 4))
+(assert (<= t_83_9 60))
+(assert (>= t_84_0 0))
+(assert (>= (- t_84_1 t_84_0) 2))
+(assert (>= (- t_84_2 t_84_1) 2))
+(assert (>= (- t_84_3 t_84_2) 5))
+(assert (>= (- t_84_4 t_84_3) 3))
+(assert (>= (- t_84_5 t_84_4) 2))
+(assert (>= (- t_84_6 t_84_5) 2))
+(assert (>= (- t_84_7 t_84_6) 5))
+(assert (>= (- t_84_8 t_84_7) 3))
+(assert (>= (- t_84_9 t_84_8) 5))
+(assert (<= t_84_9 59))
+(assert (>= t_85_0 0))
+(assert (>= (- t_85_1 t_85_0) 4))
+(assert (>= (- t_85_2 t_85_1) 5))
+(assert (>= (- t_85_3 t_85_2) 4))
+(assert (>= (- t_85_4 t_85_3) 2))
+(assert (>= (- t_85_5 t_85_4) 2))
+(assert (>= (- t_85_6 t_85_5) 5))
+(assert (>= (- t_85_7 t_85_6) 1))
+(assert (>= (- t_85_8 t_85_7) 3))
+(assert (>= (- t_85_9 t_85_8) 2))
+(assert (<= t_85_9 62))
+(assert (>= t_86_0 0))
+(assert (>= (- t_86_1 t_86_0) 5))
+(assert (>= (- t_86_2 t_86_1) 4))
+(assert (>= (- t_86_3 t_86_2) 4))
+(assert (>= (- t_86_4 t_86_3) 1))
+(assert (>= (- t_86_5 t_86_4) 4))
+(assert (>= (- t_86_6 t_86_5) 4))
+(assert (>= (- t_86_7 t_86_6) 4))
+(assert (>= (- t_86_8 t_86_7) 4))
+(assert (>= (- t_86_9 t_86_8) 4))
+(assert (<= t_86_9 61))
+(assert (>= t_87_0 0))
+(assert (>= (- t_87_1 t_87_0) 2))
+(assert (>= (- t_87_2 t_87_1) 2))
+(assert (>= (- t_87_3 t_87_2) 2))
+(assert (>= (- t_87_4 t_87_3) 1))
+(assert (>= (- t_87_5 t_87_4) 5))
+(assert (>= (- t_87_6 t_87_5) 5))
+(assert (>= (- t_87_7 t_87_6) 1))
+(assert (>= (- t_87_8 t_87_7) 5))
+(assert (>= (- t_87_9 t_87_8) 5))
+(assert (<= t_87_9 63))
+(assert (>= t_88_0 0))
+(assert (>= (- t_88_1 t_88_0) 1))
+(assert (>= (- t_88_2 t_88_1) 4))
+(assert (>= (- t_88_3 t_88_2) 4))
+(assert (>= (- t_88_4 t_88_3) 4))
+(assert (>= (- t_88_5 t_88_4) 2))
+(assert (>= (- t_88_6 t_88_5) 5))
+(assert (>= (- t_88_7 t_88_6) 3))
+(assert (>= (- t_88_8 t_88_7) 1))
+(assert (>= (- t_88_9 t_88_8) 3))
+(assert (<= t_88_9 59))
+(assert (>= t_89_0 0))
+(assert (>= (- t_89_1 t_89_0) 3))
+(assert (>= (- t_89_2 t_89_1) 5))
+(assert (>= (- t_89_3 t_89_2) 4))
+(assert (>= (- t_89_4 t_89_3) 5))
+(assert (>= (- t_89_5 t_89_4) 1))
+(assert (>= (- t_89_6 t_89_5) 4))
+(assert (>= (- t_89_7 t_89_6) 2))
+(assert (>= (- t_89_8 t_89_7) 3))
+(assert (>= (- t_89_9 t_89_8) 1))
+(assert (<= t_89_9 63))
+(assert (>= t_90_0 0))
+(assert (>= (- t_90_1 t_90_0) 4))
+(assert (>= (- t_90_2 t_90_1) 1))
+(assert (>= (- t_90_3 t_90_2) 2))
+(assert (>= (- t_90_4 t_90_3) 2))
+(assert (>= (- t_90_5 t_90_4) 2))
+(assert (>= (- t_90_6 t_90_5) 3))
+(assert (>= (- t_90_7 t_90_6) 2))
+(assert (>= (- t_90_8 t_90_7) 5))
+(assert (>= (- t_90_9 t_90_8) 1))
+(assert (<= t_90_9 59))
+(assert (>= t_91_0 0))
+(assert (>= (- t_91_1 t_91_0) 2))
+(assert (>= (- t_91_2 t_91_1) 3))
+(assert (>= (- t_91_3 t_91_2) 1))
+(assert (>= (- t_91_4 t_91_3) 5))
+(assert (>= (- t_91_5 t_91_4) 5))
+(assert (>= (- t_91_6 t_91_5) 1))
+(assert (>= (- t_91_7 t_91_6) 2))
+(assert (>= (- t_91_8 t_91_7) 4))
+(assert (>= (- t_91_9 t_91_8) 2))
+(assert (<= t_91_9 63))
+(assert (>= t_92_0 0))
+(assert (>= (- t_92_1 t_92_0) 3))
+(assert (>= (- t_92_2 t_92_1) 5))
+(assert (>= (- t_92_3 t_92_2) 3))
+(assert (>= (- t_92_4 t_92_3) 4))
+(assert (>= (- t_92_5 t_92_4) 1))
+(assert (>= (- t_92_6 t_92_5) 5))
+(assert (>= (- t_92_7 t_92_6) 3))
+(assert (>= (- t_92_8 t_92_7) 3))
+(assert (>= (- t_92_9 t_92_8) 1))
+(assert (<= t_92_9 59))
+(assert (>= t_93_0 0))
+(assert (>= (- t_93_1 t_93_0) 3))
+(assert (>= (- t_93_2 t_93_1) 1))
+(assert (>= (- t_93_3 t_93_2) 5))
+(assert (>= (- t_93_4 t_93_3) 3))
+(assert (>= (- t_93_5 t_93_4) 3))
+(assert (>= (- t_93_6 t_93_5) 3))
+(assert (>= (- t_93_7 t_93_6) 4))
+(assert (>= (- t_93_8 t_93_7) 3))
+(assert (>= (- t_93_9 t_93_8) 5))
+(assert (<= t_93_9 59))
+(assert (>= t_94_0 0))
+(assert (>= (- t_94_1 t_94_0) 2))
+(assert (>= (- t_94_2 t_94_1) 1))
+(assert (>= (- t_94_3 t_94_2) 1))
+(assert (>= (- t_94_4 t_94_3) 3))
+(assert (>= (- t_94_5 t_94_4) 4))
+(assert (>= (- t_94_6 t_94_5) 1))
+(assert (>= (- t_94_7 t_94_6) 3))
+(assert (>= (- t_94_8 t_94_7) 5))
+(assert (>= (- t_94_9 t_94_8) 1))
+(assert (<= t_94_9 63))
+(assert (>= t_95_0 0))
+(assert (>= (- t_95_1 t_95_0) 5))
+(assert (>= (- t_95_2 t_95_1) 5))
+(assert (>= (- t_95_3 t_95_2) 5))
+(assert (>= (- t_95_4 t_95_3) 4))
+(assert (>= (- t_95_5 t_95_4) 4))
+(assert (>= (- t_95_6 t_95_5) 4))
+(assert (>= (- t_95_7 t_95_6) 2))
+(assert (>= (- t_95_8 t_95_7) 2))
+(assert (>= (- t_95_9 t_95_8) 2))
+(assert (<= t_95_9 59))
+(assert (>= t_96_0 0))
+(assert (>= (- t_96_1 t_96_0) 1))
+(assert (>= (- t_96_2 t_96_1) 1))
+(assert (>= (- t_96_3 t_96_2) 5))
+(assert (>= (- t_96_4 t_96_3) 3))
+(assert (>= (- t_96_5 t_96_4) 2))
+(assert (>= (- t_96_6 t_96_5) 3))
+(assert (>= (- t_96_7 t_96_6) 1))
+(assert (>= (- t_96_8 t_96_7) 1))
+(assert (>= (- t_96_9 t_96_8) 2))
+(assert (<= t_96_9 59))
+(assert (>= t_97_0 0))
+(assert (>= (- t_97_1 t_97_0) 2))
+(assert (>= (- t_97_2 t_97_1) 4))
+(assert (>= (- t_97_3 t_97_2) 1))
+(assert (>= (- t_97_4 t_97_3) 3))
+(assert (>= (- t_97_5 t_97_4) 1))
+(assert (>= (- t_97_6 t_97_5) 5))
+(assert (>= (- t_97_7 t_97_6) 1))
+(assert (>= (- t_97_8 t_97_7) 2))
+(assert (>= (- t_97_9 t_97_8) 2))
+(assert (<= t_97_9 59))
+(assert (>= t_98_0 0))
+(assert (>= (- t_98_1 t_98_0) 2))
+(assert (>= (- t_98_2 t_98_1) 1))
+(assert (>= (- t_98_3 t_98_2) 1))
+(assert (>= (- t_98_4 t_98_3) 4))
+(assert (>= (- t_98_5 t_98_4) 1))
+(assert (>= (- t_98_6 t_98_5) 5))
+(assert (>= (- t_98_7 t_98_6) 3))
+(assert (>= (- t_98_8 t_98_7) 5))
+(assert (>= (- t_98_9 t_98_8) 2))
+(assert (<= t_98_9 63))
+(assert (>= t_99_0 0))
+(assert (>= (- t_99_1 t_99_0) 5))
+(assert (>= (- t_99_2 t_99_1) 5))
+(assert (>= (- t_99_3 t_99_2) 5))
+(assert (>= (- t_99_4 t_99_3) 4))
+(assert (>= (- t_99_5 t_99_4) 4))
+(assert (>= (- t_99_6 t_99_5) 2))
+(assert (>= (- t_99_7 t_99_6) 2))
+(assert (>= (- t_99_8 t_99_7) 4))
+(assert (>= (- t_99_9 t_99_8) 2))
+(assert (<= t_99_9 60))
+(assert (or (>= (- t_23_2 t_21_0) 5) (>= (- t_21_0 t_23_2) 1)))
+(assert (or (>= (- t_46_1 t_21_0) 5) (>= (- t_21_0 t_46_1) 2)))
+(assert (or (>= (- t_46_7 t_21_0) 5) (>= (- t_21_0 t_46_7) 3)))
+(assert (or (>= (- t_69_0 t_21_0) 5) (>= (- t_21_0 t_69_0) 4)))
+(assert (or (>= (- t_71_6 t_21_0) 5) (>= (- t_21_0 t_71_6) 5)))
+(assert (or (>= (- t_78_2 t_21_0) 5) (>= (- t_21_0 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_21_0) 5) (>= (- t_21_0 t_84_4) 2)))
+(assert (or (>= (- t_46_1 t_23_2) 1) (>= (- t_23_2 t_46_1) 2)))
+(assert (or (>= (- t_46_7 t_23_2) 1) (>= (- t_23_2 t_46_7) 3)))
+(assert (or (>= (- t_69_0 t_23_2) 1) (>= (- t_23_2 t_69_0) 4)))
+(assert (or (>= (- t_71_6 t_23_2) 1) (>= (- t_23_2 t_71_6) 5)))
+(assert (or (>= (- t_78_2 t_23_2) 1) (>= (- t_23_2 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_23_2) 1) (>= (- t_23_2 t_84_4) 2)))
+(assert (or (>= (- t_46_7 t_46_1) 2) (>= (- t_46_1 t_46_7) 3)))
+(assert (or (>= (- t_69_0 t_46_1) 2) (>= (- t_46_1 t_69_0) 4)))
+(assert (or (>= (- t_71_6 t_46_1) 2) (>= (- t_46_1 t_71_6) 5)))
+(assert (or (>= (- t_78_2 t_46_1) 2) (>= (- t_46_1 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_46_1) 2) (>= (- t_46_1 t_84_4) 2)))
+(assert (or (>= (- t_69_0 t_46_7) 3) (>= (- t_46_7 t_69_0) 4)))
+(assert (or (>= (- t_71_6 t_46_7) 3) (>= (- t_46_7 t_71_6) 5)))
+(assert (or (>= (- t_78_2 t_46_7) 3) (>= (- t_46_7 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_46_7) 3) (>= (- t_46_7 t_84_4) 2)))
+(assert (or (>= (- t_71_6 t_69_0) 4) (>= (- t_69_0 t_71_6) 5)))
+(assert (or (>= (- t_78_2 t_69_0) 4) (>= (- t_69_0 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_69_0) 4) (>= (- t_69_0 t_84_4) 2)))
+(assert (or (>= (- t_78_2 t_71_6) 5) (>= (- t_71_6 t_78_2) 4)))
+(assert (or (>= (- t_84_4 t_71_6) 5) (>= (- t_71_6 t_84_4) 2)))
+(assert (or (>= (- t_84_4 t_78_2) 4) (>= (- t_78_2 t_84_4) 2)))
+(assert (or (>= (- t_22_6 t_16_4) 4) (>= (- t_16_4 t_22_6) 4)))
+(assert (or (>= (- t_34_8 t_16_4) 4) (>= (- t_16_4 t_34_8) 2)))
+(assert (or (>= (- t_45_8 t_16_4) 4) (>= (- t_16_4 t_45_8) 2)))
+(assert (or (>= (- t_64_0 t_16_4) 4) (>= (- t_16_4 t_64_0) 4)))
+(assert (or (>= (- t_78_5 t_16_4) 4) (>= (- t_16_4 t_78_5) 3)))
+(assert (or (>= (- t_83_5 t_16_4) 4) (>= (- t_16_4 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_16_4) 4) (>= (- t_16_4 t_95_3) 4)))
+(assert (or (>= (- t_34_8 t_22_6) 4) (>= (- t_22_6 t_34_8) 2)))
+(assert (or (>= (- t_45_8 t_22_6) 4) (>= (- t_22_6 t_45_8) 2)))
+(assert (or (>= (- t_64_0 t_22_6) 4) (>= (- t_22_6 t_64_0) 4)))
+(assert (or (>= (- t_78_5 t_22_6) 4) (>= (- t_22_6 t_78_5) 3)))
+(assert (or (>= (- t_83_5 t_22_6) 4) (>= (- t_22_6 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_22_6) 4) (>= (- t_22_6 t_95_3) 4)))
+(assert (or (>= (- t_45_8 t_34_8) 2) (>= (- t_34_8 t_45_8) 2)))
+(assert (or (>= (- t_64_0 t_34_8) 2) (>= (- t_34_8 t_64_0) 4)))
+(assert (or (>= (- t_78_5 t_34_8) 2) (>= (- t_34_8 t_78_5) 3)))
+(assert (or (>= (- t_83_5 t_34_8) 2) (>= (- t_34_8 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_34_8) 2) (>= (- t_34_8 t_95_3) 4)))
+(assert (or (>= (- t_64_0 t_45_8) 2) (>= (- t_45_8 t_64_0) 4)))
+(assert (or (>= (- t_78_5 t_45_8) 2) (>= (- t_45_8 t_78_5) 3)))
+(assert (or (>= (- t_83_5 t_45_8) 2) (>= (- t_45_8 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_45_8) 2) (>= (- t_45_8 t_95_3) 4)))
+(assert (or (>= (- t_78_5 t_64_0) 4) (>= (- t_64_0 t_78_5) 3)))
+(assert (or (>= (- t_83_5 t_64_0) 4) (>= (- t_64_0 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_64_0) 4) (>= (- t_64_0 t_95_3) 4)))
+(assert (or (>= (- t_83_5 t_78_5) 3) (>= (- t_78_5 t_83_5) 4)))
+(assert (or (>= (- t_95_3 t_78_5) 3) (>= (- t_78_5 t_95_3) 4)))
+(assert (or (>= (- t_95_3 t_83_5) 4) (>= (- t_83_5 t_95_3) 4)))
+(assert (or (>= (- t_12_9 t_12_1) 1) (>= (- t_12_1 t_12_9) 5)))
+(assert (or (>= (- t_15_8 t_12_1) 1) (>= (- t_12_1 t_15_8) 1)))
+(assert (or (>= (- t_24_5 t_12_1) 1) (>= (- t_12_1 t_24_5) 1)))
+(assert (or (>= (- t_50_3 t_12_1) 1) (>= (- t_12_1 t_50_3) 4)))
+(assert (or (>= (- t_59_9 t_12_1) 1) (>= (- t_12_1 t_59_9) 2)))
+(assert (or (>= (- t_66_8 t_12_1) 1) (>= (- t_12_1 t_66_8) 1)))
+(assert (or (>= (- t_15_8 t_12_9) 5) (>= (- t_12_9 t_15_8) 1)))
+(assert (or (>= (- t_24_5 t_12_9) 5) (>= (- t_12_9 t_24_5) 1)))
+(assert (or (>= (- t_50_3 t_12_9) 5) (>= (- t_12_9 t_50_3) 4)))
+(assert (or (>= (- t_59_9 t_12_9) 5) (>= (- t_12_9 t_59_9) 2)))
+(assert (or (>= (- t_66_8 t_12_9) 5) (>= (- t_12_9 t_66_8) 1)))
+(assert (or (>= (- t_24_5 t_15_8) 1) (>= (- t_15_8 t_24_5) 1)))
+(assert (or (>= (- t_50_3 t_15_8) 1) (>= (- t_15_8 t_50_3) 4)))
+(assert (or (>= (- t_59_9 t_15_8) 1) (>= (- t_15_8 t_59_9) 2)))
+(assert (or (>= (- t_66_8 t_15_8) 1) (>= (- t_15_8 t_66_8) 1)))
+(assert (or (>= (- t_50_3 t_24_5) 1) (>= (- t_24_5 t_50_3) 4)))
+(assert (or (>= (- t_59_9 t_24_5) 1) (>= (- t_24_5 t_59_9) 2)))
+(assert (or (>= (- t_66_8 t_24_5) 1) (>= (- t_24_5 t_66_8) 1)))
+(assert (or (>= (- t_59_9 t_50_3) 4) (>= (- t_50_3 t_59_9) 2)))
+(assert (or (>= (- t_66_8 t_50_3) 4) (>= (- t_50_3 t_66_8) 1)))
+(assert (or (>= (- t_66_8 t_59_9) 2) (>= (- t_59_9 t_66_8) 1)))
+(assert (or (>= (- t_32_4 t_14_9) 1) (>= (- t_14_9 t_32_4) 3)))
+(assert (or (>= (- t_43_3 t_14_9) 1) (>= (- t_14_9 t_43_3) 1)))
+(assert (or (>= (- t_65_4 t_14_9) 1) (>= (- t_14_9 t_65_4) 4)))
+(assert (or (>= (- t_84_1 t_14_9) 1) (>= (- t_14_9 t_84_1) 2)))
+(assert (or (>= (- t_96_8 t_14_9) 1) (>= (- t_14_9 t_96_8) 2)))
+(assert (or (>= (- t_43_3 t_32_4) 3) (>= (- t_32_4 t_43_3) 1)))
+(assert (or (>= (- t_65_4 t_32_4) 3) (>= (- t_32_4 t_65_4) 4)))
+(assert (or (>= (- t_84_1 t_32_4) 3) (>= (- t_32_4 t_84_1) 2)))
+(assert (or (>= (- t_96_8 t_32_4) 3) (>= (- t_32_4 t_96_8) 2)))
+(assert (or (>= (- t_65_4 t_43_3) 1) (>= (- t_43_3 t_65_4) 4)))
+(assert (or (>= (- t_84_1 t_43_3) 1) (>= (- t_43_3 t_84_1) 2)))
+(assert (or (>= (- t_96_8 t_43_3) 1) (>= (- t_43_3 t_96_8) 2)))
+(assert (or (>= (- t_84_1 t_65_4) 4) (>= (- t_65_4 t_84_1) 2)))
+(assert (or (>= (- t_96_8 t_65_4) 4) (>= (- t_65_4 t_96_8) 2)))
+(assert (or (>= (- t_96_8 t_84_1) 2) (>= (- t_84_1 t_96_8) 2)))
+(assert (or (>= (- t_24_4 t_1_7) 5) (>= (- t_1_7 t_24_4) 5)))
+(assert (or (>= (- t_32_2 t_1_7) 5) (>= (- t_1_7 t_32_2) 1)))
+(assert (or (>= (- t_62_2 t_1_7) 5) (>= (- t_1_7 t_62_2) 4)))
+(assert (or (>= (- t_64_3 t_1_7) 5) (>= (- t_1_7 t_64_3) 1)))
+(assert (or (>= (- t_65_7 t_1_7) 5) (>= (- t_1_7 t_65_7) 4)))
+(assert (or (>= (- t_32_2 t_24_4) 5) (>= (- t_24_4 t_32_2) 1)))
+(assert (or (>= (- t_62_2 t_24_4) 5) (>= (- t_24_4 t_62_2) 4)))
+(assert (or (>= (- t_64_3 t_24_4) 5) (>= (- t_24_4 t_64_3) 1)))
+(assert (or (>= (- t_65_7 t_24_4) 5) (>= (- t_24_4 t_65_7) 4)))
+(assert (or (>= (- t_62_2 t_32_2) 1) (>= (- t_32_2 t_62_2) 4)))
+(assert (or (>= (- t_64_3 t_32_2) 1) (>= (- t_32_2 t_64_3) 1)))
+(assert (or (>= (- t_65_7 t_32_2) 1) (>= (- t_32_2 t_65_7) 4)))
+(assert (or (>= (- t_64_3 t_62_2) 4) (>= (- t_62_2 t_64_3) 1)))
+(assert (or (>= (- t_65_7 t_62_2) 4) (>= (- t_62_2 t_65_7) 4)))
+(assert (or (>= (- t_65_7 t_64_3) 1) (>= (- t_64_3 t_65_7) 4)))
+(assert (or (>= (- t_27_2 t_4_5) 4) (>= (- t_4_5 t_27_2) 1)))
+(assert (or (>= (- t_56_6 t_4_5) 4) (>= (- t_4_5 t_56_6) 3)))
+(assert (or (>= (- t_79_8 t_4_5) 4) (>= (- t_4_5 t_79_8) 3)))
+(assert (or (>= (- t_80_8 t_4_5) 4) (>= (- t_4_5 t_80_8) 3)))
+(assert (or (>= (- t_81_1 t_4_5) 4) (>= (- t_4_5 t_81_1) 1)))
+(assert (or (>= (- t_56_6 t_27_2) 1) (>= (- t_27_2 t_56_6) 3)))
+(assert (or (>= (- t_79_8 t_27_2) 1) (>= (- t_27_2 t_79_8) 3)))
+(assert (or (>= (- t_80_8 t_27_2) 1) (>= (- t_27_2 t_80_8) 3)))
+(assert (or (>= (- t_81_1 t_27_2) 1) (>= (- t_27_2 t_81_1) 1)))
+(assert (or (>= (- t_79_8 t_56_6) 3) (>= (- t_56_6 t_79_8) 3)))
+(assert (or (>= (- t_80_8 t_56_6) 3) (>= (- t_56_6 t_80_8) 3)))
+(assert (or (>= (- t_81_1 t_56_6) 3) (>= (- t_56_6 t_81_1) 1)))
+(assert (or (>= (- t_80_8 t_79_8) 3) (>= (- t_79_8 t_80_8) 3)))
+(assert (or (>= (- t_81_1 t_79_8) 3) (>= (- t_79_8 t_81_1) 1)))
+(assert (or (>= (- t_81_1 t_80_8) 3) (>= (- t_80_8 t_81_1) 1)))
+(assert (or (>= (- t_15_1 t_4_2) 5) (>= (- t_4_2 t_15_1) 4)))
+(assert (or (>= (- t_30_1 t_4_2) 5) (>= (- t_4_2 t_30_1) 4)))
+(assert (or (>= (- t_62_3 t_4_2) 5) (>= (- t_4_2 t_62_3) 4)))
+(assert (or (>= (- t_64_8 t_4_2) 5) (>= (- t_4_2 t_64_8) 2)))
+(assert (or (>= (- t_65_0 t_4_2) 5) (>= (- t_4_2 t_65_0) 1)))
+(assert (or (>= (- t_76_0 t_4_2) 5) (>= (- t_4_2 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_4_2) 5) (>= (- t_4_2 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_4_2) 5) (>= (- t_4_2 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_4_2) 5) (>= (- t_4_2 t_99_4) 4)))
+(assert (or (>= (- t_30_1 t_15_1) 4) (>= (- t_15_1 t_30_1) 4)))
+(assert (or (>= (- t_62_3 t_15_1) 4) (>= (- t_15_1 t_62_3) 4)))
+(assert (or (>= (- t_64_8 t_15_1) 4) (>= (- t_15_1 t_64_8) 2)))
+(assert (or (>= (- t_65_0 t_15_1) 4) (>= (- t_15_1 t_65_0) 1)))
+(assert (or (>= (- t_76_0 t_15_1) 4) (>= (- t_15_1 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_15_1) 4) (>= (- t_15_1 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_15_1) 4) (>= (- t_15_1 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_15_1) 4) (>= (- t_15_1 t_99_4) 4)))
+(assert (or (>= (- t_62_3 t_30_1) 4) (>= (- t_30_1 t_62_3) 4)))
+(assert (or (>= (- t_64_8 t_30_1) 4) (>= (- t_30_1 t_64_8) 2)))
+(assert (or (>= (- t_65_0 t_30_1) 4) (>= (- t_30_1 t_65_0) 1)))
+(assert (or (>= (- t_76_0 t_30_1) 4) (>= (- t_30_1 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_30_1) 4) (>= (- t_30_1 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_30_1) 4) (>= (- t_30_1 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_30_1) 4) (>= (- t_30_1 t_99_4) 4)))
+(assert (or (>= (- t_64_8 t_62_3) 4) (>= (- t_62_3 t_64_8) 2)))
+(assert (or (>= (- t_65_0 t_62_3) 4) (>= (- t_62_3 t_65_0) 1)))
+(assert (or (>= (- t_76_0 t_62_3) 4) (>= (- t_62_3 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_62_3) 4) (>= (- t_62_3 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_62_3) 4) (>= (- t_62_3 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_62_3) 4) (>= (- t_62_3 t_99_4) 4)))
+(assert (or (>= (- t_65_0 t_64_8) 2) (>= (- t_64_8 t_65_0) 1)))
+(assert (or (>= (- t_76_0 t_64_8) 2) (>= (- t_64_8 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_64_8) 2) (>= (- t_64_8 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_64_8) 2) (>= (- t_64_8 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_64_8) 2) (>= (- t_64_8 t_99_4) 4)))
+(assert (or (>= (- t_76_0 t_65_0) 1) (>= (- t_65_0 t_76_0) 4)))
+(assert (or (>= (- t_83_4 t_65_0) 1) (>= (- t_65_0 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_65_0) 1) (>= (- t_65_0 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_65_0) 1) (>= (- t_65_0 t_99_4) 4)))
+(assert (or (>= (- t_83_4 t_76_0) 4) (>= (- t_76_0 t_83_4) 5)))
+(assert (or (>= (- t_91_5 t_76_0) 4) (>= (- t_76_0 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_76_0) 4) (>= (- t_76_0 t_99_4) 4)))
+(assert (or (>= (- t_91_5 t_83_4) 5) (>= (- t_83_4 t_91_5) 1)))
+(assert (or (>= (- t_99_4 t_83_4) 5) (>= (- t_83_4 t_99_4) 4)))
+(assert (or (>= (- t_99_4 t_91_5) 1) (>= (- t_91_5 t_99_4) 4)))
+(assert (or (>= (- t_46_4 t_3_9) 5) (>= (- t_3_9 t_46_4) 3)))
+(assert (or (>= (- t_54_6 t_3_9) 5) (>= (- t_3_9 t_54_6) 4)))
+(assert (or (>= (- t_67_6 t_3_9) 5) (>= (- t_3_9 t_67_6) 1)))
+(assert (or (>= (- t_79_7 t_3_9) 5) (>= (- t_3_9 t_79_7) 2)))
+(assert (or (>= (- t_92_4 t_3_9) 5) (>= (- t_3_9 t_92_4) 1)))
+(assert (or (>= (- t_54_6 t_46_4) 3) (>= (- t_46_4 t_54_6) 4)))
+(assert (or (>= (- t_67_6 t_46_4) 3) (>= (- t_46_4 t_67_6) 1)))
+(assert (or (>= (- t_79_7 t_46_4) 3) (>= (- t_46_4 t_79_7) 2)))
+(assert (or (>= (- t_92_4 t_46_4) 3) (>= (- t_46_4 t_92_4) 1)))
+(assert (or (>= (- t_67_6 t_54_6) 4) (>= (- t_54_6 t_67_6) 1)))
+(assert (or (>= (- t_79_7 t_54_6) 4) (>= (- t_54_6 t_79_7) 2)))
+(assert (or (>= (- t_92_4 t_54_6) 4) (>= (- t_54_6 t_92_4) 1)))
+(assert (or (>= (- t_79_7 t_67_6) 1) (>= (- t_67_6 t_79_7) 2)))
+(assert (or (>= (- t_92_4 t_67_6) 1) (>= (- t_67_6 t_92_4) 1)))
+(assert (or (>= (- t_92_4 t_79_7) 2) (>= (- t_79_7 t_92_4) 1)))
+(assert (or (>= (- t_37_6 t_24_9) 3) (>= (- t_24_9 t_37_6) 3)))
+(assert (or (>= (- t_93_3 t_24_9) 3) (>= (- t_24_9 t_93_3) 3)))
+(assert (or (>= (- t_96_9 t_24_9) 3) (>= (- t_24_9 t_96_9) 5)))
+(assert (or (>= (- t_93_3 t_37_6) 3) (>= (- t_37_6 t_93_3) 3)))
+(assert (or (>= (- t_96_9 t_37_6) 3) (>= (- t_37_6 t_96_9) 5)))
+(assert (or (>= (- t_96_9 t_93_3) 3) (>= (- t_93_3 t_96_9) 5)))
+(assert (or (>= (- t_28_4 t_12_4) 3) (>= (- t_12_4 t_28_4) 1)))
+(assert (or (>= (- t_38_7 t_12_4) 3) (>= (- t_12_4 t_38_7) 5)))
+(assert (or (>= (- t_54_3 t_12_4) 3) (>= (- t_12_4 t_54_3) 3)))
+(assert (or (>= (- t_72_8 t_12_4) 3) (>= (- t_12_4 t_72_8) 2)))
+(assert (or (>= (- t_88_2 t_12_4) 3) (>= (- t_12_4 t_88_2) 4)))
+(assert (or (>= (- t_38_7 t_28_4) 1) (>= (- t_28_4 t_38_7) 5)))
+(assert (or (>= (- t_54_3 t_28_4) 1) (>= (- t_28_4 t_54_3) 3)))
+(assert (or (>= (- t_72_8 t_28_4) 1) (>= (- t_28_4 t_72_8) 2)))
+(assert (or (>= (- t_88_2 t_28_4) 1) (>= (- t_28_4 t_88_2) 4)))
+(assert (or (>= (- t_54_3 t_38_7) 5) (>= (- t_38_7 t_54_3) 3)))
+(assert (or (>= (- t_72_8 t_38_7) 5) (>= (- t_38_7 t_72_8) 2)))
+(assert (or (>= (- t_88_2 t_38_7) 5) (>= (- t_38_7 t_88_2) 4)))
+(assert (or (>= (- t_72_8 t_54_3) 3) (>= (- t_54_3 t_72_8) 2)))
+(assert (or (>= (- t_88_2 t_54_3) 3) (>= (- t_54_3 t_88_2) 4)))
+(assert (or (>= (- t_88_2 t_72_8) 2) (>= (- t_72_8 t_88_2) 4)))
+(assert (or (>= (- t_58_1 t_44_4) 4) (>= (- t_44_4 t_58_1) 3)))
+(assert (or (>= (- t_78_4 t_44_4) 4) (>= (- t_44_4 t_78_4) 5)))
+(assert (or (>= (- t_93_0 t_44_4) 4) (>= (- t_44_4 t_93_0) 3)))
+(assert (or (>= (- t_78_4 t_58_1) 3) (>= (- t_58_1 t_78_4) 5)))
+(assert (or (>= (- t_93_0 t_58_1) 3) (>= (- t_58_1 t_93_0) 3)))
+(assert (or (>= (- t_93_0 t_78_4) 5) (>= (- t_78_4 t_93_0) 3)))
+(assert (or (>= (- t_42_9 t_33_2) 2) (>= (- t_33_2 t_42_9) 3)))
+(assert (or (>= (- t_58_6 t_33_2) 2) (>= (- t_33_2 t_58_6) 2)))
+(assert (or (>= (- t_59_6 t_33_2) 2) (>= (- t_33_2 t_59_6) 4)))
+(assert (or (>= (- t_68_3 t_33_2) 2) (>= (- t_33_2 t_68_3) 2)))
+(assert (or (>= (- t_58_6 t_42_9) 3) (>= (- t_42_9 t_58_6) 2)))
+(assert (or (>= (- t_59_6 t_42_9) 3) (>= (- t_42_9 t_59_6) 4)))
+(assert (or (>= (- t_68_3 t_42_9) 3) (>= (- t_42_9 t_68_3) 2)))
+(assert (or (>= (- t_59_6 t_58_6) 2) (>= (- t_58_6 t_59_6) 4)))
+(assert (or (>= (- t_68_3 t_58_6) 2) (>= (- t_58_6 t_68_3) 2)))
+(assert (or (>= (- t_68_3 t_59_6) 4) (>= (- t_59_6 t_68_3) 2)))
+(assert (or (>= (- t_15_7 t_0_2) 1) (>= (- t_0_2 t_15_7) 3)))
+(assert (or (>= (- t_57_2 t_0_2) 1) (>= (- t_0_2 t_57_2) 4)))
+(assert (or (>= (- t_61_6 t_0_2) 1) (>= (- t_0_2 t_61_6) 5)))
+(assert (or (>= (- t_99_7 t_0_2) 1) (>= (- t_0_2 t_99_7) 4)))
+(assert (or (>= (- t_57_2 t_15_7) 3) (>= (- t_15_7 t_57_2) 4)))
+(assert (or (>= (- t_61_6 t_15_7) 3) (>= (- t_15_7 t_61_6) 5)))
+(assert (or (>= (- t_99_7 t_15_7) 3) (>= (- t_15_7 t_99_7) 4)))
+(assert (or (>= (- t_61_6 t_57_2) 4) (>= (- t_57_2 t_61_6) 5)))
+(assert (or (>= (- t_99_7 t_57_2) 4) (>= (- t_57_2 t_99_7) 4)))
+(assert (or (>= (- t_99_7 t_61_6) 5) (>= (- t_61_6 t_99_7) 4)))
+(assert (or (>= (- t_78_9 t_57_3) 1) (>= (- t_57_3 t_78_9) 4)))
+(assert (or (>= (- t_89_5 t_57_3) 1) (>= (- t_57_3 t_89_5) 4)))
+(assert (or (>= (- t_95_8 t_57_3) 1) (>= (- t_57_3 t_95_8) 2)))
+(assert (or (>= (- t_89_5 t_78_9) 4) (>= (- t_78_9 t_89_5) 4)))
+(assert (or (>= (- t_95_8 t_78_9) 4) (>= (- t_78_9 t_95_8) 2)))
+(assert (or (>= (- t_95_8 t_89_5) 4) (>= (- t_89_5 t_95_8) 2)))
+(assert (or (>= (- t_88_0 t_28_8) 1) (>= (- t_28_8 t_88_0) 1)))
+(assert (or (>= (- t_93_1 t_28_8) 1) (>= (- t_28_8 t_93_1) 1)))
+(assert (or (>= (- t_93_1 t_88_0) 1) (>= (- t_88_0 t_93_1) 1)))
+(assert (or (>= (- t_34_3 t_26_2) 4) (>= (- t_26_2 t_34_3) 5)))
+(assert (or (>= (- t_61_8 t_26_2) 4) (>= (- t_26_2 t_61_8) 5)))
+(assert (or (>= (- t_75_4 t_26_2) 4) (>= (- t_26_2 t_75_4) 3)))
+(assert (or (>= (- t_61_8 t_34_3) 5) (>= (- t_34_3 t_61_8) 5)))
+(assert (or (>= (- t_75_4 t_34_3) 5) (>= (- t_34_3 t_75_4) 3)))
+(assert (or (>= (- t_75_4 t_61_8) 5) (>= (- t_61_8 t_75_4) 3)))
+(assert (or (>= (- t_32_9 t_30_8) 4) (>= (- t_30_8 t_32_9) 1)))
+(assert (or (>= (- t_41_4 t_30_8) 4) (>= (- t_30_8 t_41_4) 5)))
+(assert (or (>= (- t_50_1 t_30_8) 4) (>= (- t_30_8 t_50_1) 3)))
+(assert (or (>= (- t_53_0 t_30_8) 4) (>= (- t_30_8 t_53_0) 5)))
+(assert (or (>= (- t_61_2 t_30_8) 4) (>= (- t_30_8 t_61_2) 5)))
+(assert (or (>= (- t_84_9 t_30_8) 4) (>= (- t_30_8 t_84_9) 5)))
+(assert (or (>= (- t_41_4 t_32_9) 1) (>= (- t_32_9 t_41_4) 5)))
+(assert (or (>= (- t_50_1 t_32_9) 1) (>= (- t_32_9 t_50_1) 3)))
+(assert (or (>= (- t_53_0 t_32_9) 1) (>= (- t_32_9 t_53_0) 5)))
+(assert (or (>= (- t_61_2 t_32_9) 1) (>= (- t_32_9 t_61_2) 5)))
+(assert (or (>= (- t_84_9 t_32_9) 1) (>= (- t_32_9 t_84_9) 5)))
+(assert (or (>= (- t_50_1 t_41_4) 5) (>= (- t_41_4 t_50_1) 3)))
+(assert (or (>= (- t_53_0 t_41_4) 5) (>= (- t_41_4 t_53_0) 5)))
+(assert (or (>= (- t_61_2 t_41_4) 5) (>= (- t_41_4 t_61_2) 5)))
+(assert (or (>= (- t_84_9 t_41_4) 5) (>= (- t_41_4 t_84_9) 5)))
+(assert (or (>= (- t_53_0 t_50_1) 3) (>= (- t_50_1 t_53_0) 5)))
+(assert (or (>= (- t_61_2 t_50_1) 3) (>= (- t_50_1 t_61_2) 5)))
+(assert (or (>= (- t_84_9 t_50_1) 3) (>= (- t_50_1 t_84_9) 5)))
+(assert (or (>= (- t_61_2 t_53_0) 5) (>= (- t_53_0 t_61_2) 5)))
+(assert (or (>= (- t_84_9 t_53_0) 5) (>= (- t_53_0 t_84_9) 5)))
+(assert (or (>= (- t_84_9 t_61_2) 5) (>= (- t_61_2 t_84_9) 5)))
+(assert (or (>= (- t_26_7 t_25_5) 3) (>= (- t_25_5 t_26_7) 1)))
+(assert (or (>= (- t_27_6 t_25_5) 3) (>= (- t_25_5 t_27_6) 1)))
+(assert (or (>= (- t_64_1 t_25_5) 3) (>= (- t_25_5 t_64_1) 1)))
+(assert (or (>= (- t_79_6 t_25_5) 3) (>= (- t_25_5 t_79_6) 1)))
+(assert (or (>= (- t_27_6 t_26_7) 1) (>= (- t_26_7 t_27_6) 1)))
+(assert (or (>= (- t_64_1 t_26_7) 1) (>= (- t_26_7 t_64_1) 1)))
+(assert (or (>= (- t_79_6 t_26_7) 1) (>= (- t_26_7 t_79_6) 1)))
+(assert (or (>= (- t_64_1 t_27_6) 1) (>= (- t_27_6 t_64_1) 1)))
+(assert (or (>= (- t_79_6 t_27_6) 1) (>= (- t_27_6 t_79_6) 1)))
+(assert (or (>= (- t_79_6 t_64_1) 1) (>= (- t_64_1 t_79_6) 1)))
+(assert (or (>= (- t_75_6 t_13_9) 5) (>= (- t_13_9 t_75_6) 5)))
+(assert (or (>= (- t_81_6 t_13_9) 5) (>= (- t_13_9 t_81_6) 5)))
+(assert (or (>= (- t_81_6 t_75_6) 5) (>= (- t_75_6 t_81_6) 5)))
+(assert (or (>= (- t_23_4 t_18_5) 2) (>= (- t_18_5 t_23_4) 5)))
+(assert (or (>= (- t_70_0 t_18_5) 2) (>= (- t_18_5 t_70_0) 2)))
+(assert (or (>= (- t_71_7 t_18_5) 2) (>= (- t_18_5 t_71_7) 4)))
+(assert (or (>= (- t_85_7 t_18_5) 2) (>= (- t_18_5 t_85_7) 3)))
+(assert (or (>= (- t_94_3 t_18_5) 2) (>= (- t_18_5 t_94_3) 3)))
+(assert (or (>= (- t_70_0 t_23_4) 5) (>= (- t_23_4 t_70_0) 2)))
+(assert (or (>= (- t_71_7 t_23_4) 5) (>= (- t_23_4 t_71_7) 4)))
+(assert (or (>= (- t_85_7 t_23_4) 5) (>= (- t_23_4 t_85_7) 3)))
+(assert (or (>= (- t_94_3 t_23_4) 5) (>= (- t_23_4 t_94_3) 3)))
+(assert (or (>= (- t_71_7 t_70_0) 2) (>= (- t_70_0 t_71_7) 4)))
+(assert (or (>= (- t_85_7 t_70_0) 2) (>= (- t_70_0 t_85_7) 3)))
+(assert (or (>= (- t_94_3 t_70_0) 2) (>= (- t_70_0 t_94_3) 3)))
+(assert (or (>= (- t_85_7 t_71_7) 4) (>= (- t_71_7 t_85_7) 3)))
+(assert (or (>= (- t_94_3 t_71_7) 4) (>= (- t_71_7 t_94_3) 3)))
+(assert (or (>= (- t_94_3 t_85_7) 3) (>= (- t_85_7 t_94_3) 3)))
+(assert (or (>= (- t_40_3 t_36_0) 4) (>= (- t_36_0 t_40_3) 5)))
+(assert (or (>= (- t_50_9 t_36_0) 4) (>= (- t_36_0 t_50_9) 2)))
+(assert (or (>= (- t_73_1 t_36_0) 4) (>= (- t_36_0 t_73_1) 5)))
+(assert (or (>= (- t_83_1 t_36_0) 4) (>= (- t_36_0 t_83_1) 5)))
+(assert (or (>= (- t_50_9 t_40_3) 5) (>= (- t_40_3 t_50_9) 2)))
+(assert (or (>= (- t_73_1 t_40_3) 5) (>= (- t_40_3 t_73_1) 5)))
+(assert (or (>= (- t_83_1 t_40_3) 5) (>= (- t_40_3 t_83_1) 5)))
+(assert (or (>= (- t_73_1 t_50_9) 2) (>= (- t_50_9 t_73_1) 5)))
+(assert (or (>= (- t_83_1 t_50_9) 2) (>= (- t_50_9 t_83_1) 5)))
+(assert (or (>= (- t_83_1 t_73_1) 5) (>= (- t_73_1 t_83_1) 5)))
+(assert (or (>= (- t_34_9 t_8_5) 4) (>= (- t_8_5 t_34_9) 5)))
+(assert (or (>= (- t_36_8 t_8_5) 4) (>= (- t_8_5 t_36_8) 4)))
+(assert (or (>= (- t_53_6 t_8_5) 4) (>= (- t_8_5 t_53_6) 5)))
+(assert (or (>= (- t_36_8 t_34_9) 5) (>= (- t_34_9 t_36_8) 4)))
+(assert (or (>= (- t_53_6 t_34_9) 5) (>= (- t_34_9 t_53_6) 5)))
+(assert (or (>= (- t_53_6 t_36_8) 4) (>= (- t_36_8 t_53_6) 5)))
+(assert (or (>= (- t_46_3 t_14_7) 5) (>= (- t_14_7 t_46_3) 5)))
+(assert (or (>= (- t_74_5 t_12_7) 2) (>= (- t_12_7 t_74_5) 1)))
+(assert (or (>= (- t_97_8 t_12_7) 2) (>= (- t_12_7 t_97_8) 2)))
+(assert (or (>= (- t_97_8 t_74_5) 1) (>= (- t_74_5 t_97_8) 2)))
+(assert (or (>= (- t_45_2 t_30_5) 4) (>= (- t_30_5 t_45_2) 3)))
+(assert (or (>= (- t_63_9 t_30_5) 4) (>= (- t_30_5 t_63_9) 3)))
+(assert (or (>= (- t_67_9 t_30_5) 4) (>= (- t_30_5 t_67_9) 1)))
+(assert (or (>= (- t_77_1 t_30_5) 4) (>= (- t_30_5 t_77_1) 5)))
+(assert (or (>= (- t_83_7 t_30_5) 4) (>= (- t_30_5 t_83_7) 1)))
+(assert (or (>= (- t_94_9 t_30_5) 4) (>= (- t_30_5 t_94_9) 1)))
+(assert (or (>= (- t_63_9 t_45_2) 3) (>= (- t_45_2 t_63_9) 3)))
+(assert (or (>= (- t_67_9 t_45_2) 3) (>= (- t_45_2 t_67_9) 1)))
+(assert (or (>= (- t_77_1 t_45_2) 3) (>= (- t_45_2 t_77_1) 5)))
+(assert (or (>= (- t_83_7 t_45_2) 3) (>= (- t_45_2 t_83_7) 1)))
+(assert (or (>= (- t_94_9 t_45_2) 3) (>= (- t_45_2 t_94_9) 1)))
+(assert (or (>= (- t_67_9 t_63_9) 3) (>= (- t_63_9 t_67_9) 1)))
+(assert (or (>= (- t_77_1 t_63_9) 3) (>= (- t_63_9 t_77_1) 5)))
+(assert (or (>= (- t_83_7 t_63_9) 3) (>= (- t_63_9 t_83_7) 1)))
+(assert (or (>= (- t_94_9 t_63_9) 3) (>= (- t_63_9 t_94_9) 1)))
+(assert (or (>= (- t_77_1 t_67_9) 1) (>= (- t_67_9 t_77_1) 5)))
+(assert (or (>= (- t_83_7 t_67_9) 1) (>= (- t_67_9 t_83_7) 1)))
+(assert (or (>= (- t_94_9 t_67_9) 1) (>= (- t_67_9 t_94_9) 1)))
+(assert (or (>= (- t_83_7 t_77_1) 5) (>= (- t_77_1 t_83_7) 1)))
+(assert (or (>= (- t_94_9 t_77_1) 5) (>= (- t_77_1 t_94_9) 1)))
+(assert (or (>= (- t_94_9 t_83_7) 1) (>= (- t_83_7 t_94_9) 1)))
+(assert (or (>= (- t_42_6 t_29_7) 1) (>= (- t_29_7 t_42_6) 4)))
+(assert (or (>= (- t_43_1 t_29_7) 1) (>= (- t_29_7 t_43_1) 4)))
+(assert (or (>= (- t_51_9 t_29_7) 1) (>= (- t_29_7 t_51_9) 3)))
+(assert (or (>= (- t_66_0 t_29_7) 1) (>= (- t_29_7 t_66_0) 1)))
+(assert (or (>= (- t_70_7 t_29_7) 1) (>= (- t_29_7 t_70_7) 4)))
+(assert (or (>= (- t_43_1 t_42_6) 4) (>= (- t_42_6 t_43_1) 4)))
+(assert (or (>= (- t_51_9 t_42_6) 4) (>= (- t_42_6 t_51_9) 3)))
+(assert (or (>= (- t_66_0 t_42_6) 4) (>= (- t_42_6 t_66_0) 1)))
+(assert (or (>= (- t_70_7 t_42_6) 4) (>= (- t_42_6 t_70_7) 4)))
+(assert (or (>= (- t_51_9 t_43_1) 4) (>= (- t_43_1 t_51_9) 3)))
+(assert (or (>= (- t_66_0 t_43_1) 4) (>= (- t_43_1 t_66_0) 1)))
+(assert (or (>= (- t_70_7 t_43_1) 4) (>= (- t_43_1 t_70_7) 4)))
+(assert (or (>= (- t_66_0 t_51_9) 3) (>= (- t_51_9 t_66_0) 1)))
+(assert (or (>= (- t_70_7 t_51_9) 3) (>= (- t_51_9 t_70_7) 4)))
+(assert (or (>= (- t_70_7 t_66_0) 1) (>= (- t_66_0 t_70_7) 4)))
+(assert (or (>= (- t_45_9 t_7_0) 4) (>= (- t_7_0 t_45_9) 3)))
+(assert (or (>= (- t_79_9 t_7_0) 4) (>= (- t_7_0 t_79_9) 5)))
+(assert (or (>= (- t_80_1 t_7_0) 4) (>= (- t_7_0 t_80_1) 2)))
+(assert (or (>= (- t_87_4 t_7_0) 4) (>= (- t_7_0 t_87_4) 5)))
+(assert (or (>= (- t_79_9 t_45_9) 3) (>= (- t_45_9 t_79_9) 5)))
+(assert (or (>= (- t_80_1 t_45_9) 3) (>= (- t_45_9 t_80_1) 2)))
+(assert (or (>= (- t_87_4 t_45_9) 3) (>= (- t_45_9 t_87_4) 5)))
+(assert (or (>= (- t_80_1 t_79_9) 5) (>= (- t_79_9 t_80_1) 2)))
+(assert (or (>= (- t_87_4 t_79_9) 5) (>= (- t_79_9 t_87_4) 5)))
+(assert (or (>= (- t_87_4 t_80_1) 2) (>= (- t_80_1 t_87_4) 5)))
+(assert (or (>= (- t_12_8 t_7_8) 3) (>= (- t_7_8 t_12_8) 2)))
+(assert (or (>= (- t_24_7 t_7_8) 3) (>= (- t_7_8 t_24_7) 3)))
+(assert (or (>= (- t_34_7 t_7_8) 3) (>= (- t_7_8 t_34_7) 5)))
+(assert (or (>= (- t_43_5 t_7_8) 3) (>= (- t_7_8 t_43_5) 3)))
+(assert (or (>= (- t_78_6 t_7_8) 3) (>= (- t_7_8 t_78_6) 5)))
+(assert (or (>= (- t_82_2 t_7_8) 3) (>= (- t_7_8 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_7_8) 3) (>= (- t_7_8 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_7_8) 3) (>= (- t_7_8 t_86_1) 4)))
+(assert (or (>= (- t_24_7 t_12_8) 2) (>= (- t_12_8 t_24_7) 3)))
+(assert (or (>= (- t_34_7 t_12_8) 2) (>= (- t_12_8 t_34_7) 5)))
+(assert (or (>= (- t_43_5 t_12_8) 2) (>= (- t_12_8 t_43_5) 3)))
+(assert (or (>= (- t_78_6 t_12_8) 2) (>= (- t_12_8 t_78_6) 5)))
+(assert (or (>= (- t_82_2 t_12_8) 2) (>= (- t_12_8 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_12_8) 2) (>= (- t_12_8 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_12_8) 2) (>= (- t_12_8 t_86_1) 4)))
+(assert (or (>= (- t_34_7 t_24_7) 3) (>= (- t_24_7 t_34_7) 5)))
+(assert (or (>= (- t_43_5 t_24_7) 3) (>= (- t_24_7 t_43_5) 3)))
+(assert (or (>= (- t_78_6 t_24_7) 3) (>= (- t_24_7 t_78_6) 5)))
+(assert (or (>= (- t_82_2 t_24_7) 3) (>= (- t_24_7 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_24_7) 3) (>= (- t_24_7 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_24_7) 3) (>= (- t_24_7 t_86_1) 4)))
+(assert (or (>= (- t_43_5 t_34_7) 5) (>= (- t_34_7 t_43_5) 3)))
+(assert (or (>= (- t_78_6 t_34_7) 5) (>= (- t_34_7 t_78_6) 5)))
+(assert (or (>= (- t_82_2 t_34_7) 5) (>= (- t_34_7 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_34_7) 5) (>= (- t_34_7 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_34_7) 5) (>= (- t_34_7 t_86_1) 4)))
+(assert (or (>= (- t_78_6 t_43_5) 3) (>= (- t_43_5 t_78_6) 5)))
+(assert (or (>= (- t_82_2 t_43_5) 3) (>= (- t_43_5 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_43_5) 3) (>= (- t_43_5 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_43_5) 3) (>= (- t_43_5 t_86_1) 4)))
+(assert (or (>= (- t_82_2 t_78_6) 5) (>= (- t_78_6 t_82_2) 4)))
+(assert (or (>= (- t_85_4 t_78_6) 5) (>= (- t_78_6 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_78_6) 5) (>= (- t_78_6 t_86_1) 4)))
+(assert (or (>= (- t_85_4 t_82_2) 4) (>= (- t_82_2 t_85_4) 2)))
+(assert (or (>= (- t_86_1 t_82_2) 4) (>= (- t_82_2 t_86_1) 4)))
+(assert (or (>= (- t_86_1 t_85_4) 2) (>= (- t_85_4 t_86_1) 4)))
+(assert (or (>= (- t_38_5 t_30_3) 3) (>= (- t_30_3 t_38_5) 3)))
+(assert (or (>= (- t_65_3 t_30_3) 3) (>= (- t_30_3 t_65_3) 1)))
+(assert (or (>= (- t_90_0 t_30_3) 3) (>= (- t_30_3 t_90_0) 4)))
+(assert (or (>= (- t_91_3 t_30_3) 3) (>= (- t_30_3 t_91_3) 5)))
+(assert (or (>= (- t_65_3 t_38_5) 3) (>= (- t_38_5 t_65_3) 1)))
+(assert (or (>= (- t_90_0 t_38_5) 3) (>= (- t_38_5 t_90_0) 4)))
+(assert (or (>= (- t_91_3 t_38_5) 3) (>= (- t_38_5 t_91_3) 5)))
+(assert (or (>= (- t_90_0 t_65_3) 1) (>= (- t_65_3 t_90_0) 4)))
+(assert (or (>= (- t_91_3 t_65_3) 1) (>= (- t_65_3 t_91_3) 5)))
+(assert (or (>= (- t_91_3 t_90_0) 4) (>= (- t_90_0 t_91_3) 5)))
+(assert (or (>= (- t_40_2 t_25_4) 1) (>= (- t_25_4 t_40_2) 3)))
+(assert (or (>= (- t_69_2 t_25_4) 1) (>= (- t_25_4 t_69_2) 5)))
+(assert (or (>= (- t_81_3 t_25_4) 1) (>= (- t_25_4 t_81_3) 3)))
+(assert (or (>= (- t_99_1 t_25_4) 1) (>= (- t_25_4 t_99_1) 5)))
+(assert (or (>= (- t_69_2 t_40_2) 3) (>= (- t_40_2 t_69_2) 5)))
+(assert (or (>= (- t_81_3 t_40_2) 3) (>= (- t_40_2 t_81_3) 3)))
+(assert (or (>= (- t_99_1 t_40_2) 3) (>= (- t_40_2 t_99_1) 5)))
+(assert (or (>= (- t_81_3 t_69_2) 5) (>= (- t_69_2 t_81_3) 3)))
+(assert (or (>= (- t_99_1 t_69_2) 5) (>= (- t_69_2 t_99_1) 5)))
+(assert (or (>= (- t_99_1 t_81_3) 3) (>= (- t_81_3 t_99_1) 5)))
+(assert (or (>= (- t_27_8 t_1_4) 4) (>= (- t_1_4 t_27_8) 3)))
+(assert (or (>= (- t_38_8 t_1_4) 4) (>= (- t_1_4 t_38_8) 4)))
+(assert (or (>= (- t_52_4 t_1_4) 4) (>= (- t_1_4 t_52_4) 5)))
+(assert (or (>= (- t_91_9 t_1_4) 4) (>= (- t_1_4 t_91_9) 1)))
+(assert (or (>= (- t_38_8 t_27_8) 3) (>= (- t_27_8 t_38_8) 4)))
+(assert (or (>= (- t_52_4 t_27_8) 3) (>= (- t_27_8 t_52_4) 5)))
+(assert (or (>= (- t_91_9 t_27_8) 3) (>= (- t_27_8 t_91_9) 1)))
+(assert (or (>= (- t_52_4 t_38_8) 4) (>= (- t_38_8 t_52_4) 5)))
+(assert (or (>= (- t_91_9 t_38_8) 4) (>= (- t_38_8 t_91_9) 1)))
+(assert (or (>= (- t_91_9 t_52_4) 5) (>= (- t_52_4 t_91_9) 1)))
+(assert (or (>= (- t_35_9 t_31_4) 4) (>= (- t_31_4 t_35_9) 4)))
+(assert (or (>= (- t_41_7 t_31_4) 4) (>= (- t_31_4 t_41_7) 4)))
+(assert (or (>= (- t_44_7 t_31_4) 4) (>= (- t_31_4 t_44_7) 1)))
+(assert (or (>= (- t_70_4 t_31_4) 4) (>= (- t_31_4 t_70_4) 2)))
+(assert (or (>= (- t_75_3 t_31_4) 4) (>= (- t_31_4 t_75_3) 2)))
+(assert (or (>= (- t_41_7 t_35_9) 4) (>= (- t_35_9 t_41_7) 4)))
+(assert (or (>= (- t_44_7 t_35_9) 4) (>= (- t_35_9 t_44_7) 1)))
+(assert (or (>= (- t_70_4 t_35_9) 4) (>= (- t_35_9 t_70_4) 2)))
+(assert (or (>= (- t_75_3 t_35_9) 4) (>= (- t_35_9 t_75_3) 2)))
+(assert (or (>= (- t_44_7 t_41_7) 4) (>= (- t_41_7 t_44_7) 1)))
+(assert (or (>= (- t_70_4 t_41_7) 4) (>= (- t_41_7 t_70_4) 2)))
+(assert (or (>= (- t_75_3 t_41_7) 4) (>= (- t_41_7 t_75_3) 2)))
+(assert (or (>= (- t_70_4 t_44_7) 1) (>= (- t_44_7 t_70_4) 2)))
+(assert (or (>= (- t_75_3 t_44_7) 1) (>= (- t_44_7 t_75_3) 2)))
+(assert (or (>= (- t_75_3 t_70_4) 2) (>= (- t_70_4 t_75_3) 2)))
+(assert (or (>= (- t_31_2 t_22_8) 2) (>= (- t_22_8 t_31_2) 2)))
+(assert (or (>= (- t_60_8 t_22_8) 2) (>= (- t_22_8 t_60_8) 1)))
+(assert (or (>= (- t_76_8 t_22_8) 2) (>= (- t_22_8 t_76_8) 4)))
+(assert (or (>= (- t_92_7 t_22_8) 2) (>= (- t_22_8 t_92_7) 3)))
+(assert (or (>= (- t_60_8 t_31_2) 2) (>= (- t_31_2 t_60_8) 1)))
+(assert (or (>= (- t_76_8 t_31_2) 2) (>= (- t_31_2 t_76_8) 4)))
+(assert (or (>= (- t_92_7 t_31_2) 2) (>= (- t_31_2 t_92_7) 3)))
+(assert (or (>= (- t_76_8 t_60_8) 1) (>= (- t_60_8 t_76_8) 4)))
+(assert (or (>= (- t_92_7 t_60_8) 1) (>= (- t_60_8 t_92_7) 3)))
+(assert (or (>= (- t_92_7 t_76_8) 4) (>= (- t_76_8 t_92_7) 3)))
+(assert (or (>= (- t_33_3 t_15_4) 4) (>= (- t_15_4 t_33_3) 3)))
+(assert (or (>= (- t_44_5 t_15_4) 4) (>= (- t_15_4 t_44_5) 3)))
+(assert (or (>= (- t_73_5 t_15_4) 4) (>= (- t_15_4 t_73_5) 3)))
+(assert (or (>= (- t_77_6 t_15_4) 4) (>= (- t_15_4 t_77_6) 4)))
+(assert (or (>= (- t_44_5 t_33_3) 3) (>= (- t_33_3 t_44_5) 3)))
+(assert (or (>= (- t_73_5 t_33_3) 3) (>= (- t_33_3 t_73_5) 3)))
+(assert (or (>= (- t_77_6 t_33_3) 3) (>= (- t_33_3 t_77_6) 4)))
+(assert (or (>= (- t_73_5 t_44_5) 3) (>= (- t_44_5 t_73_5) 3)))
+(assert (or (>= (- t_77_6 t_44_5) 3) (>= (- t_44_5 t_77_6) 4)))
+(assert (or (>= (- t_77_6 t_73_5) 3) (>= (- t_73_5 t_77_6) 4)))
+(assert (or (>= (- t_35_0 t_25_8) 4) (>= (- t_25_8 t_35_0) 3)))
+(assert (or (>= (- t_53_3 t_25_8) 4) (>= (- t_25_8 t_53_3) 4)))
+(assert (or (>= (- t_75_8 t_25_8) 4) (>= (- t_25_8 t_75_8) 1)))
+(assert (or (>= (- t_53_3 t_35_0) 3) (>= (- t_35_0 t_53_3) 4)))
+(assert (or (>= (- t_75_8 t_35_0) 3) (>= (- t_35_0 t_75_8) 1)))
+(assert (or (>= (- t_75_8 t_53_3) 4) (>= (- t_53_3 t_75_8) 1)))
+(assert (or (>= (- t_9_8 t_1_6) 3) (>= (- t_1_6 t_9_8) 5)))
+(assert (or (>= (- t_26_4 t_1_6) 3) (>= (- t_1_6 t_26_4) 5)))
+(assert (or (>= (- t_39_1 t_1_6) 3) (>= (- t_1_6 t_39_1) 1)))
+(assert (or (>= (- t_86_5 t_1_6) 3) (>= (- t_1_6 t_86_5) 4)))
+(assert (or (>= (- t_98_8 t_1_6) 3) (>= (- t_1_6 t_98_8) 2)))
+(assert (or (>= (- t_26_4 t_9_8) 5) (>= (- t_9_8 t_26_4) 5)))
+(assert (or (>= (- t_39_1 t_9_8) 5) (>= (- t_9_8 t_39_1) 1)))
+(assert (or (>= (- t_86_5 t_9_8) 5) (>= (- t_9_8 t_86_5) 4)))
+(assert (or (>= (- t_98_8 t_9_8) 5) (>= (- t_9_8 t_98_8) 2)))
+(assert (or (>= (- t_39_1 t_26_4) 5) (>= (- t_26_4 t_39_1) 1)))
+(assert (or (>= (- t_86_5 t_26_4) 5) (>= (- t_26_4 t_86_5) 4)))
+(assert (or (>= (- t_98_8 t_26_4) 5) (>= (- t_26_4 t_98_8) 2)))
+(assert (or (>= (- t_86_5 t_39_1) 1) (>= (- t_39_1 t_86_5) 4)))
+(assert (or (>= (- t_98_8 t_39_1) 1) (>= (- t_39_1 t_98_8) 2)))
+(assert (or (>= (- t_98_8 t_86_5) 4) (>= (- t_86_5 t_98_8) 2)))
+(assert (or (>= (- t_32_7 t_2_1) 1) (>= (- t_2_1 t_32_7) 2)))
+(assert (or (>= (- t_34_5 t_2_1) 1) (>= (- t_2_1 t_34_5) 1)))
+(assert (or (>= (- t_45_1 t_2_1) 1) (>= (- t_2_1 t_45_1) 1)))
+(assert (or (>= (- t_76_1 t_2_1) 1) (>= (- t_2_1 t_76_1) 1)))
+(assert (or (>= (- t_34_5 t_32_7) 2) (>= (- t_32_7 t_34_5) 1)))
+(assert (or (>= (- t_45_1 t_32_7) 2) (>= (- t_32_7 t_45_1) 1)))
+(assert (or (>= (- t_76_1 t_32_7) 2) (>= (- t_32_7 t_76_1) 1)))
+(assert (or (>= (- t_45_1 t_34_5) 1) (>= (- t_34_5 t_45_1) 1)))
+(assert (or (>= (- t_76_1 t_34_5) 1) (>= (- t_34_5 t_76_1) 1)))
+(assert (or (>= (- t_76_1 t_45_1) 1) (>= (- t_45_1 t_76_1) 1)))
+(assert (or (>= (- t_29_9 t_28_9) 5) (>= (- t_28_9 t_29_9) 3)))
+(assert (or (>= (- t_35_3 t_28_9) 5) (>= (- t_28_9 t_35_3) 4)))
+(assert (or (>= (- t_47_1 t_28_9) 5) (>= (- t_28_9 t_47_1) 4)))
+(assert (or (>= (- t_62_1 t_28_9) 5) (>= (- t_28_9 t_62_1) 4)))
+(assert (or (>= (- t_64_9 t_28_9) 5) (>= (- t_28_9 t_64_9) 4)))
+(assert (or (>= (- t_35_3 t_29_9) 3) (>= (- t_29_9 t_35_3) 4)))
+(assert (or (>= (- t_47_1 t_29_9) 3) (>= (- t_29_9 t_47_1) 4)))
+(assert (or (>= (- t_62_1 t_29_9) 3) (>= (- t_29_9 t_62_1) 4)))
+(assert (or (>= (- t_64_9 t_29_9) 3) (>= (- t_29_9 t_64_9) 4)))
+(assert (or (>= (- t_47_1 t_35_3) 4) (>= (- t_35_3 t_47_1) 4)))
+(assert (or (>= (- t_62_1 t_35_3) 4) (>= (- t_35_3 t_62_1) 4)))
+(assert (or (>= (- t_64_9 t_35_3) 4) (>= (- t_35_3 t_64_9) 4)))
+(assert (or (>= (- t_62_1 t_47_1) 4) (>= (- t_47_1 t_62_1) 4)))
+(assert (or (>= (- t_64_9 t_47_1) 4) (>= (- t_47_1 t_64_9) 4)))
+(assert (or (>= (- t_64_9 t_62_1) 4) (>= (- t_62_1 t_64_9) 4)))
+(assert (or (>= (- t_51_6 t_6_4) 4) (>= (- t_6_4 t_51_6) 2)))
+(assert (or (>= (- t_56_5 t_6_4) 4) (>= (- t_6_4 t_56_5) 5)))
+(assert (or (>= (- t_93_9 t_6_4) 4) (>= (- t_6_4 t_93_9) 5)))
+(assert (or (>= (- t_56_5 t_51_6) 2) (>= (- t_51_6 t_56_5) 5)))
+(assert (or (>= (- t_93_9 t_51_6) 2) (>= (- t_51_6 t_93_9) 5)))
+(assert (or (>= (- t_93_9 t_56_5) 5) (>= (- t_56_5 t_93_9) 5)))
+(assert (or (>= (- t_20_9 t_1_1) 5) (>= (- t_1_1 t_20_9) 1)))
+(assert (or (>= (- t_52_9 t_1_1) 5) (>= (- t_1_1 t_52_9) 5)))
+(assert (or (>= (- t_55_2 t_1_1) 5) (>= (- t_1_1 t_55_2) 1)))
+(assert (or (>= (- t_67_1 t_1_1) 5) (>= (- t_1_1 t_67_1) 5)))
+(assert (or (>= (- t_94_8 t_1_1) 5) (>= (- t_1_1 t_94_8) 1)))
+(assert (or (>= (- t_52_9 t_20_9) 1) (>= (- t_20_9 t_52_9) 5)))
+(assert (or (>= (- t_55_2 t_20_9) 1) (>= (- t_20_9 t_55_2) 1)))
+(assert (or (>= (- t_67_1 t_20_9) 1) (>= (- t_20_9 t_67_1) 5)))
+(assert (or (>= (- t_94_8 t_20_9) 1) (>= (- t_20_9 t_94_8) 1)))
+(assert (or (>= (- t_55_2 t_52_9) 5) (>= (- t_52_9 t_55_2) 1)))
+(assert (or (>= (- t_67_1 t_52_9) 5) (>= (- t_52_9 t_67_1) 5)))
+(assert (or (>= (- t_94_8 t_52_9) 5) (>= (- t_52_9 t_94_8) 1)))
+(assert (or (>= (- t_67_1 t_55_2) 1) (>= (- t_55_2 t_67_1) 5)))
+(assert (or (>= (- t_94_8 t_55_2) 1) (>= (- t_55_2 t_94_8) 1)))
+(assert (or (>= (- t_94_8 t_67_1) 5) (>= (- t_67_1 t_94_8) 1)))
+(assert (or (>= (- t_17_3 t_9_7) 1) (>= (- t_9_7 t_17_3) 4)))
+(assert (or (>= (- t_44_6 t_9_7) 1) (>= (- t_9_7 t_44_6) 2)))
+(assert (or (>= (- t_91_0 t_9_7) 1) (>= (- t_9_7 t_91_0) 2)))
+(assert (or (>= (- t_44_6 t_17_3) 4) (>= (- t_17_3 t_44_6) 2)))
+(assert (or (>= (- t_91_0 t_17_3) 4) (>= (- t_17_3 t_91_0) 2)))
+(assert (or (>= (- t_91_0 t_44_6) 2) (>= (- t_44_6 t_91_0) 2)))
+(assert (or (>= (- t_69_1 t_44_9) 5) (>= (- t_44_9 t_69_1) 5)))
+(assert (or (>= (- t_85_5 t_44_9) 5) (>= (- t_44_9 t_85_5) 5)))
+(assert (or (>= (- t_98_3 t_44_9) 5) (>= (- t_44_9 t_98_3) 4)))
+(assert (or (>= (- t_85_5 t_69_1) 5) (>= (- t_69_1 t_85_5) 5)))
+(assert (or (>= (- t_98_3 t_69_1) 5) (>= (- t_69_1 t_98_3) 4)))
+(assert (or (>= (- t_98_3 t_85_5) 5) (>= (- t_85_5 t_98_3) 4)))
+(assert (or (>= (- t_10_8 t_10_2) 2) (>= (- t_10_2 t_10_8) 2)))
+(assert (or (>= (- t_47_2 t_10_2) 2) (>= (- t_10_2 t_47_2) 5)))
+(assert (or (>= (- t_48_9 t_10_2) 2) (>= (- t_10_2 t_48_9) 3)))
+(assert (or (>= (- t_61_4 t_10_2) 2) (>= (- t_10_2 t_61_4) 5)))
+(assert (or (>= (- t_81_2 t_10_2) 2) (>= (- t_10_2 t_81_2) 2)))
+(assert (or (>= (- t_98_5 t_10_2) 2) (>= (- t_10_2 t_98_5) 5)))
+(assert (or (>= (- t_47_2 t_10_8) 2) (>= (- t_10_8 t_47_2) 5)))
+(assert (or (>= (- t_48_9 t_10_8) 2) (>= (- t_10_8 t_48_9) 3)))
+(assert (or (>= (- t_61_4 t_10_8) 2) (>= (- t_10_8 t_61_4) 5)))
+(assert (or (>= (- t_81_2 t_10_8) 2) (>= (- t_10_8 t_81_2) 2)))
+(assert (or (>= (- t_98_5 t_10_8) 2) (>= (- t_10_8 t_98_5) 5)))
+(assert (or (>= (- t_48_9 t_47_2) 5) (>= (- t_47_2 t_48_9) 3)))
+(assert (or (>= (- t_61_4 t_47_2) 5) (>= (- t_47_2 t_61_4) 5)))
+(assert (or (>= (- t_81_2 t_47_2) 5) (>= (- t_47_2 t_81_2) 2)))
+(assert (or (>= (- t_98_5 t_47_2) 5) (>= (- t_47_2 t_98_5) 5)))
+(assert (or (>= (- t_61_4 t_48_9) 3) (>= (- t_48_9 t_61_4) 5)))
+(assert (or (>= (- t_81_2 t_48_9) 3) (>= (- t_48_9 t_81_2) 2)))
+(assert (or (>= (- t_98_5 t_48_9) 3) (>= (- t_48_9 t_98_5) 5)))
+(assert (or (>= (- t_81_2 t_61_4) 5) (>= (- t_61_4 t_81_2) 2)))
+(assert (or (>= (- t_98_5 t_61_4) 5) (>= (- t_61_4 t_98_5) 5)))
+(assert (or (>= (- t_98_5 t_81_2) 2) (>= (- t_81_2 t_98_5) 5)))
+(assert (or (>= (- t_25_7 t_13_6) 1) (>= (- t_13_6 t_25_7) 1)))
+(assert (or (>= (- t_40_8 t_13_6) 1) (>= (- t_13_6 t_40_8) 2)))
+(assert (or (>= (- t_68_8 t_13_6) 1) (>= (- t_13_6 t_68_8) 3)))
+(assert (or (>= (- t_83_2 t_13_6) 1) (>= (- t_13_6 t_83_2) 4)))
+(assert (or (>= (- t_40_8 t_25_7) 1) (>= (- t_25_7 t_40_8) 2)))
+(assert (or (>= (- t_68_8 t_25_7) 1) (>= (- t_25_7 t_68_8) 3)))
+(assert (or (>= (- t_83_2 t_25_7) 1) (>= (- t_25_7 t_83_2) 4)))
+(assert (or (>= (- t_68_8 t_40_8) 2) (>= (- t_40_8 t_68_8) 3)))
+(assert (or (>= (- t_83_2 t_40_8) 2) (>= (- t_40_8 t_83_2) 4)))
+(assert (or (>= (- t_83_2 t_68_8) 3) (>= (- t_68_8 t_83_2) 4)))
+(assert (or (>= (- t_19_3 t_0_4) 2) (>= (- t_0_4 t_19_3) 1)))
+(assert (or (>= (- t_21_7 t_0_4) 2) (>= (- t_0_4 t_21_7) 2)))
+(assert (or (>= (- t_22_3 t_0_4) 2) (>= (- t_0_4 t_22_3) 4)))
+(assert (or (>= (- t_60_3 t_0_4) 2) (>= (- t_0_4 t_60_3) 1)))
+(assert (or (>= (- t_82_4 t_0_4) 2) (>= (- t_0_4 t_82_4) 3)))
+(assert (or (>= (- t_93_8 t_0_4) 2) (>= (- t_0_4 t_93_8) 5)))
+(assert (or (>= (- t_21_7 t_19_3) 1) (>= (- t_19_3 t_21_7) 2)))
+(assert (or (>= (- t_22_3 t_19_3) 1) (>= (- t_19_3 t_22_3) 4)))
+(assert (or (>= (- t_60_3 t_19_3) 1) (>= (- t_19_3 t_60_3) 1)))
+(assert (or (>= (- t_82_4 t_19_3) 1) (>= (- t_19_3 t_82_4) 3)))
+(assert (or (>= (- t_93_8 t_19_3) 1) (>= (- t_19_3 t_93_8) 5)))
+(assert (or (>= (- t_22_3 t_21_7) 2) (>= (- t_21_7 t_22_3) 4)))
+(assert (or (>= (- t_60_3 t_21_7) 2) (>= (- t_21_7 t_60_3) 1)))
+(assert (or (>= (- t_82_4 t_21_7) 2) (>= (- t_21_7 t_82_4) 3)))
+(assert (or (>= (- t_93_8 t_21_7) 2) (>= (- t_21_7 t_93_8) 5)))
+(assert (or (>= (- t_60_3 t_22_3) 4) (>= (- t_22_3 t_60_3) 1)))
+(assert (or (>= (- t_82_4 t_22_3) 4) (>= (- t_22_3 t_82_4) 3)))
+(assert (or (>= (- t_93_8 t_22_3) 4) (>= (- t_22_3 t_93_8) 5)))
+(assert (or (>= (- t_82_4 t_60_3) 1) (>= (- t_60_3 t_82_4) 3)))
+(assert (or (>= (- t_93_8 t_60_3) 1) (>= (- t_60_3 t_93_8) 5)))
+(assert (or (>= (- t_93_8 t_82_4) 3) (>= (- t_82_4 t_93_8) 5)))
+(assert (or (>= (- t_24_0 t_2_0) 3) (>= (- t_2_0 t_24_0) 1)))
+(assert (or (>= (- t_27_9 t_2_0) 3) (>= (- t_2_0 t_27_9) 4)))
+(assert (or (>= (- t_36_9 t_2_0) 3) (>= (- t_2_0 t_36_9) 3)))
+(assert (or (>= (- t_38_3 t_2_0) 3) (>= (- t_2_0 t_38_3) 4)))
+(assert (or (>= (- t_54_0 t_2_0) 3) (>= (- t_2_0 t_54_0) 4)))
+(assert (or (>= (- t_58_4 t_2_0) 3) (>= (- t_2_0 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_2_0) 3) (>= (- t_2_0 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_2_0) 3) (>= (- t_2_0 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_2_0) 3) (>= (- t_2_0 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_2_0) 3) (>= (- t_2_0 t_99_3) 4)))
+(assert (or (>= (- t_27_9 t_24_0) 1) (>= (- t_24_0 t_27_9) 4)))
+(assert (or (>= (- t_36_9 t_24_0) 1) (>= (- t_24_0 t_36_9) 3)))
+(assert (or (>= (- t_38_3 t_24_0) 1) (>= (- t_24_0 t_38_3) 4)))
+(assert (or (>= (- t_54_0 t_24_0) 1) (>= (- t_24_0 t_54_0) 4)))
+(assert (or (>= (- t_58_4 t_24_0) 1) (>= (- t_24_0 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_24_0) 1) (>= (- t_24_0 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_24_0) 1) (>= (- t_24_0 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_24_0) 1) (>= (- t_24_0 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_24_0) 1) (>= (- t_24_0 t_99_3) 4)))
+(assert (or (>= (- t_36_9 t_27_9) 4) (>= (- t_27_9 t_36_9) 3)))
+(assert (or (>= (- t_38_3 t_27_9) 4) (>= (- t_27_9 t_38_3) 4)))
+(assert (or (>= (- t_54_0 t_27_9) 4) (>= (- t_27_9 t_54_0) 4)))
+(assert (or (>= (- t_58_4 t_27_9) 4) (>= (- t_27_9 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_27_9) 4) (>= (- t_27_9 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_27_9) 4) (>= (- t_27_9 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_27_9) 4) (>= (- t_27_9 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_27_9) 4) (>= (- t_27_9 t_99_3) 4)))
+(assert (or (>= (- t_38_3 t_36_9) 3) (>= (- t_36_9 t_38_3) 4)))
+(assert (or (>= (- t_54_0 t_36_9) 3) (>= (- t_36_9 t_54_0) 4)))
+(assert (or (>= (- t_58_4 t_36_9) 3) (>= (- t_36_9 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_36_9) 3) (>= (- t_36_9 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_36_9) 3) (>= (- t_36_9 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_36_9) 3) (>= (- t_36_9 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_36_9) 3) (>= (- t_36_9 t_99_3) 4)))
+(assert (or (>= (- t_54_0 t_38_3) 4) (>= (- t_38_3 t_54_0) 4)))
+(assert (or (>= (- t_58_4 t_38_3) 4) (>= (- t_38_3 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_38_3) 4) (>= (- t_38_3 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_38_3) 4) (>= (- t_38_3 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_38_3) 4) (>= (- t_38_3 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_38_3) 4) (>= (- t_38_3 t_99_3) 4)))
+(assert (or (>= (- t_58_4 t_54_0) 4) (>= (- t_54_0 t_58_4) 2)))
+(assert (or (>= (- t_66_6 t_54_0) 4) (>= (- t_54_0 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_54_0) 4) (>= (- t_54_0 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_54_0) 4) (>= (- t_54_0 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_54_0) 4) (>= (- t_54_0 t_99_3) 4)))
+(assert (or (>= (- t_66_6 t_58_4) 2) (>= (- t_58_4 t_66_6) 2)))
+(assert (or (>= (- t_71_1 t_58_4) 2) (>= (- t_58_4 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_58_4) 2) (>= (- t_58_4 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_58_4) 2) (>= (- t_58_4 t_99_3) 4)))
+(assert (or (>= (- t_71_1 t_66_6) 2) (>= (- t_66_6 t_71_1) 5)))
+(assert (or (>= (- t_74_7 t_66_6) 2) (>= (- t_66_6 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_66_6) 2) (>= (- t_66_6 t_99_3) 4)))
+(assert (or (>= (- t_74_7 t_71_1) 5) (>= (- t_71_1 t_74_7) 5)))
+(assert (or (>= (- t_99_3 t_71_1) 5) (>= (- t_71_1 t_99_3) 4)))
+(assert (or (>= (- t_99_3 t_74_7) 5) (>= (- t_74_7 t_99_3) 4)))
+(assert (or (>= (- t_29_8 t_3_0) 5) (>= (- t_3_0 t_29_8) 4)))
+(assert (or (>= (- t_46_5 t_3_0) 5) (>= (- t_3_0 t_46_5) 1)))
+(assert (or (>= (- t_52_6 t_3_0) 5) (>= (- t_3_0 t_52_6) 4)))
+(assert (or (>= (- t_76_3 t_3_0) 5) (>= (- t_3_0 t_76_3) 3)))
+(assert (or (>= (- t_46_5 t_29_8) 4) (>= (- t_29_8 t_46_5) 1)))
+(assert (or (>= (- t_52_6 t_29_8) 4) (>= (- t_29_8 t_52_6) 4)))
+(assert (or (>= (- t_76_3 t_29_8) 4) (>= (- t_29_8 t_76_3) 3)))
+(assert (or (>= (- t_52_6 t_46_5) 1) (>= (- t_46_5 t_52_6) 4)))
+(assert (or (>= (- t_76_3 t_46_5) 1) (>= (- t_46_5 t_76_3) 3)))
+(assert (or (>= (- t_76_3 t_52_6) 4) (>= (- t_52_6 t_76_3) 3)))
+(assert (or (>= (- t_57_5 t_46_8) 3) (>= (- t_46_8 t_57_5) 2)))
+(assert (or (>= (- t_85_6 t_46_8) 3) (>= (- t_46_8 t_85_6) 1)))
+(assert (or (>= (- t_85_6 t_57_5) 2) (>= (- t_57_5 t_85_6) 1)))
+(assert (or (>= (- t_23_8 t_21_9) 2) (>= (- t_21_9 t_23_8) 5)))
+(assert (or (>= (- t_28_3 t_21_9) 2) (>= (- t_21_9 t_28_3) 4)))
+(assert (or (>= (- t_31_8 t_21_9) 2) (>= (- t_21_9 t_31_8) 4)))
+(assert (or (>= (- t_40_9 t_21_9) 2) (>= (- t_21_9 t_40_9) 1)))
+(assert (or (>= (- t_82_8 t_21_9) 2) (>= (- t_21_9 t_82_8) 2)))
+(assert (or (>= (- t_87_1 t_21_9) 2) (>= (- t_21_9 t_87_1) 2)))
+(assert (or (>= (- t_28_3 t_23_8) 5) (>= (- t_23_8 t_28_3) 4)))
+(assert (or (>= (- t_31_8 t_23_8) 5) (>= (- t_23_8 t_31_8) 4)))
+(assert (or (>= (- t_40_9 t_23_8) 5) (>= (- t_23_8 t_40_9) 1)))
+(assert (or (>= (- t_82_8 t_23_8) 5) (>= (- t_23_8 t_82_8) 2)))
+(assert (or (>= (- t_87_1 t_23_8) 5) (>= (- t_23_8 t_87_1) 2)))
+(assert (or (>= (- t_31_8 t_28_3) 4) (>= (- t_28_3 t_31_8) 4)))
+(assert (or (>= (- t_40_9 t_28_3) 4) (>= (- t_28_3 t_40_9) 1)))
+(assert (or (>= (- t_82_8 t_28_3) 4) (>= (- t_28_3 t_82_8) 2)))
+(assert (or (>= (- t_87_1 t_28_3) 4) (>= (- t_28_3 t_87_1) 2)))
+(assert (or (>= (- t_40_9 t_31_8) 4) (>= (- t_31_8 t_40_9) 1)))
+(assert (or (>= (- t_82_8 t_31_8) 4) (>= (- t_31_8 t_82_8) 2)))
+(assert (or (>= (- t_87_1 t_31_8) 4) (>= (- t_31_8 t_87_1) 2)))
+(assert (or (>= (- t_82_8 t_40_9) 1) (>= (- t_40_9 t_82_8) 2)))
+(assert (or (>= (- t_87_1 t_40_9) 1) (>= (- t_40_9 t_87_1) 2)))
+(assert (or (>= (- t_87_1 t_82_8) 2) (>= (- t_82_8 t_87_1) 2)))
+(assert (or (>= (- t_69_4 t_55_6) 3) (>= (- t_55_6 t_69_4) 5)))
+(assert (or (>= (- t_77_0 t_55_6) 3) (>= (- t_55_6 t_77_0) 3)))
+(assert (or (>= (- t_81_4 t_55_6) 3) (>= (- t_55_6 t_81_4) 1)))
+(assert (or (>= (- t_77_0 t_69_4) 5) (>= (- t_69_4 t_77_0) 3)))
+(assert (or (>= (- t_81_4 t_69_4) 5) (>= (- t_69_4 t_81_4) 1)))
+(assert (or (>= (- t_81_4 t_77_0) 3) (>= (- t_77_0 t_81_4) 1)))
+(assert (or (>= (- t_16_8 t_12_5) 3) (>= (- t_12_5 t_16_8) 2)))
+(assert (or (>= (- t_20_7 t_12_5) 3) (>= (- t_12_5 t_20_7) 4)))
+(assert (or (>= (- t_64_2 t_12_5) 3) (>= (- t_12_5 t_64_2) 3)))
+(assert (or (>= (- t_70_2 t_12_5) 3) (>= (- t_12_5 t_70_2) 3)))
+(assert (or (>= (- t_79_4 t_12_5) 3) (>= (- t_12_5 t_79_4) 3)))
+(assert (or (>= (- t_93_2 t_12_5) 3) (>= (- t_12_5 t_93_2) 5)))
+(assert (or (>= (- t_20_7 t_16_8) 2) (>= (- t_16_8 t_20_7) 4)))
+(assert (or (>= (- t_64_2 t_16_8) 2) (>= (- t_16_8 t_64_2) 3)))
+(assert (or (>= (- t_70_2 t_16_8) 2) (>= (- t_16_8 t_70_2) 3)))
+(assert (or (>= (- t_79_4 t_16_8) 2) (>= (- t_16_8 t_79_4) 3)))
+(assert (or (>= (- t_93_2 t_16_8) 2) (>= (- t_16_8 t_93_2) 5)))
+(assert (or (>= (- t_64_2 t_20_7) 4) (>= (- t_20_7 t_64_2) 3)))
+(assert (or (>= (- t_70_2 t_20_7) 4) (>= (- t_20_7 t_70_2) 3)))
+(assert (or (>= (- t_79_4 t_20_7) 4) (>= (- t_20_7 t_79_4) 3)))
+(assert (or (>= (- t_93_2 t_20_7) 4) (>= (- t_20_7 t_93_2) 5)))
+(assert (or (>= (- t_70_2 t_64_2) 3) (>= (- t_64_2 t_70_2) 3)))
+(assert (or (>= (- t_79_4 t_64_2) 3) (>= (- t_64_2 t_79_4) 3)))
+(assert (or (>= (- t_93_2 t_64_2) 3) (>= (- t_64_2 t_93_2) 5)))
+(assert (or (>= (- t_79_4 t_70_2) 3) (>= (- t_70_2 t_79_4) 3)))
+(assert (or (>= (- t_93_2 t_70_2) 3) (>= (- t_70_2 t_93_2) 5)))
+(assert (or (>= (- t_93_2 t_79_4) 3) (>= (- t_79_4 t_93_2) 5)))
+(assert (or (>= (- t_22_9 t_20_0) 4) (>= (- t_20_0 t_22_9) 4)))
+(assert (or (>= (- t_27_5 t_20_0) 4) (>= (- t_20_0 t_27_5) 2)))
+(assert (or (>= (- t_37_2 t_20_0) 4) (>= (- t_20_0 t_37_2) 4)))
+(assert (or (>= (- t_58_7 t_20_0) 4) (>= (- t_20_0 t_58_7) 5)))
+(assert (or (>= (- t_71_2 t_20_0) 4) (>= (- t_20_0 t_71_2) 1)))
+(assert (or (>= (- t_78_7 t_20_0) 4) (>= (- t_20_0 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_20_0) 4) (>= (- t_20_0 t_95_5) 4)))
+(assert (or (>= (- t_27_5 t_22_9) 4) (>= (- t_22_9 t_27_5) 2)))
+(assert (or (>= (- t_37_2 t_22_9) 4) (>= (- t_22_9 t_37_2) 4)))
+(assert (or (>= (- t_58_7 t_22_9) 4) (>= (- t_22_9 t_58_7) 5)))
+(assert (or (>= (- t_71_2 t_22_9) 4) (>= (- t_22_9 t_71_2) 1)))
+(assert (or (>= (- t_78_7 t_22_9) 4) (>= (- t_22_9 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_22_9) 4) (>= (- t_22_9 t_95_5) 4)))
+(assert (or (>= (- t_37_2 t_27_5) 2) (>= (- t_27_5 t_37_2) 4)))
+(assert (or (>= (- t_58_7 t_27_5) 2) (>= (- t_27_5 t_58_7) 5)))
+(assert (or (>= (- t_71_2 t_27_5) 2) (>= (- t_27_5 t_71_2) 1)))
+(assert (or (>= (- t_78_7 t_27_5) 2) (>= (- t_27_5 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_27_5) 2) (>= (- t_27_5 t_95_5) 4)))
+(assert (or (>= (- t_58_7 t_37_2) 4) (>= (- t_37_2 t_58_7) 5)))
+(assert (or (>= (- t_71_2 t_37_2) 4) (>= (- t_37_2 t_71_2) 1)))
+(assert (or (>= (- t_78_7 t_37_2) 4) (>= (- t_37_2 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_37_2) 4) (>= (- t_37_2 t_95_5) 4)))
+(assert (or (>= (- t_71_2 t_58_7) 5) (>= (- t_58_7 t_71_2) 1)))
+(assert (or (>= (- t_78_7 t_58_7) 5) (>= (- t_58_7 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_58_7) 5) (>= (- t_58_7 t_95_5) 4)))
+(assert (or (>= (- t_78_7 t_71_2) 1) (>= (- t_71_2 t_78_7) 2)))
+(assert (or (>= (- t_95_5 t_71_2) 1) (>= (- t_71_2 t_95_5) 4)))
+(assert (or (>= (- t_95_5 t_78_7) 2) (>= (- t_78_7 t_95_5) 4)))
+(assert (or (>= (- t_52_2 t_18_7) 1) (>= (- t_18_7 t_52_2) 2)))
+(assert (or (>= (- t_62_5 t_18_7) 1) (>= (- t_18_7 t_62_5) 4)))
+(assert (or (>= (- t_71_3 t_18_7) 1) (>= (- t_18_7 t_71_3) 4)))
+(assert (or (>= (- t_62_5 t_52_2) 2) (>= (- t_52_2 t_62_5) 4)))
+(assert (or (>= (- t_71_3 t_52_2) 2) (>= (- t_52_2 t_71_3) 4)))
+(assert (or (>= (- t_71_3 t_62_5) 4) (>= (- t_62_5 t_71_3) 4)))
+(assert (or (>= (- t_51_7 t_23_1) 5) (>= (- t_23_1 t_51_7) 3)))
+(assert (or (>= (- t_67_0 t_23_1) 5) (>= (- t_23_1 t_67_0) 3)))
+(assert (or (>= (- t_68_4 t_23_1) 5) (>= (- t_23_1 t_68_4) 1)))
+(assert (or (>= (- t_96_0 t_23_1) 5) (>= (- t_23_1 t_96_0) 1)))
+(assert (or (>= (- t_97_6 t_23_1) 5) (>= (- t_23_1 t_97_6) 1)))
+(assert (or (>= (- t_67_0 t_51_7) 3) (>= (- t_51_7 t_67_0) 3)))
+(assert (or (>= (- t_68_4 t_51_7) 3) (>= (- t_51_7 t_68_4) 1)))
+(assert (or (>= (- t_96_0 t_51_7) 3) (>= (- t_51_7 t_96_0) 1)))
+(assert (or (>= (- t_97_6 t_51_7) 3) (>= (- t_51_7 t_97_6) 1)))
+(assert (or (>= (- t_68_4 t_67_0) 3) (>= (- t_67_0 t_68_4) 1)))
+(assert (or (>= (- t_96_0 t_67_0) 3) (>= (- t_67_0 t_96_0) 1)))
+(assert (or (>= (- t_97_6 t_67_0) 3) (>= (- t_67_0 t_97_6) 1)))
+(assert (or (>= (- t_96_0 t_68_4) 1) (>= (- t_68_4 t_96_0) 1)))
+(assert (or (>= (- t_97_6 t_68_4) 1) (>= (- t_68_4 t_97_6) 1)))
+(assert (or (>= (- t_97_6 t_96_0) 1) (>= (- t_96_0 t_97_6) 1)))
+(assert (or (>= (- t_30_0 t_3_5) 2) (>= (- t_3_5 t_30_0) 3)))
+(assert (or (>= (- t_52_1 t_3_5) 2) (>= (- t_3_5 t_52_1) 2)))
+(assert (or (>= (- t_54_1 t_3_5) 2) (>= (- t_3_5 t_54_1) 4)))
+(assert (or (>= (- t_55_5 t_3_5) 2) (>= (- t_3_5 t_55_5) 2)))
+(assert (or (>= (- t_86_8 t_3_5) 2) (>= (- t_3_5 t_86_8) 4)))
+(assert (or (>= (- t_52_1 t_30_0) 3) (>= (- t_30_0 t_52_1) 2)))
+(assert (or (>= (- t_54_1 t_30_0) 3) (>= (- t_30_0 t_54_1) 4)))
+(assert (or (>= (- t_55_5 t_30_0) 3) (>= (- t_30_0 t_55_5) 2)))
+(assert (or (>= (- t_86_8 t_30_0) 3) (>= (- t_30_0 t_86_8) 4)))
+(assert (or (>= (- t_54_1 t_52_1) 2) (>= (- t_52_1 t_54_1) 4)))
+(assert (or (>= (- t_55_5 t_52_1) 2) (>= (- t_52_1 t_55_5) 2)))
+(assert (or (>= (- t_86_8 t_52_1) 2) (>= (- t_52_1 t_86_8) 4)))
+(assert (or (>= (- t_55_5 t_54_1) 4) (>= (- t_54_1 t_55_5) 2)))
+(assert (or (>= (- t_86_8 t_54_1) 4) (>= (- t_54_1 t_86_8) 4)))
+(assert (or (>= (- t_86_8 t_55_5) 2) (>= (- t_55_5 t_86_8) 4)))
+(assert (or (>= (- t_19_9 t_16_9) 3) (>= (- t_16_9 t_19_9) 3)))
+(assert (or (>= (- t_39_6 t_16_9) 3) (>= (- t_16_9 t_39_6) 4)))
+(assert (or (>= (- t_60_2 t_16_9) 3) (>= (- t_16_9 t_60_2) 5)))
+(assert (or (>= (- t_79_3 t_16_9) 3) (>= (- t_16_9 t_79_3) 5)))
+(assert (or (>= (- t_81_5 t_16_9) 3) (>= (- t_16_9 t_81_5) 3)))
+(assert (or (>= (- t_87_0 t_16_9) 3) (>= (- t_16_9 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_16_9) 3) (>= (- t_16_9 t_95_9) 5)))
+(assert (or (>= (- t_39_6 t_19_9) 3) (>= (- t_19_9 t_39_6) 4)))
+(assert (or (>= (- t_60_2 t_19_9) 3) (>= (- t_19_9 t_60_2) 5)))
+(assert (or (>= (- t_79_3 t_19_9) 3) (>= (- t_19_9 t_79_3) 5)))
+(assert (or (>= (- t_81_5 t_19_9) 3) (>= (- t_19_9 t_81_5) 3)))
+(assert (or (>= (- t_87_0 t_19_9) 3) (>= (- t_19_9 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_19_9) 3) (>= (- t_19_9 t_95_9) 5)))
+(assert (or (>= (- t_60_2 t_39_6) 4) (>= (- t_39_6 t_60_2) 5)))
+(assert (or (>= (- t_79_3 t_39_6) 4) (>= (- t_39_6 t_79_3) 5)))
+(assert (or (>= (- t_81_5 t_39_6) 4) (>= (- t_39_6 t_81_5) 3)))
+(assert (or (>= (- t_87_0 t_39_6) 4) (>= (- t_39_6 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_39_6) 4) (>= (- t_39_6 t_95_9) 5)))
+(assert (or (>= (- t_79_3 t_60_2) 5) (>= (- t_60_2 t_79_3) 5)))
+(assert (or (>= (- t_81_5 t_60_2) 5) (>= (- t_60_2 t_81_5) 3)))
+(assert (or (>= (- t_87_0 t_60_2) 5) (>= (- t_60_2 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_60_2) 5) (>= (- t_60_2 t_95_9) 5)))
+(assert (or (>= (- t_81_5 t_79_3) 5) (>= (- t_79_3 t_81_5) 3)))
+(assert (or (>= (- t_87_0 t_79_3) 5) (>= (- t_79_3 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_79_3) 5) (>= (- t_79_3 t_95_9) 5)))
+(assert (or (>= (- t_87_0 t_81_5) 3) (>= (- t_81_5 t_87_0) 2)))
+(assert (or (>= (- t_95_9 t_81_5) 3) (>= (- t_81_5 t_95_9) 5)))
+(assert (or (>= (- t_95_9 t_87_0) 2) (>= (- t_87_0 t_95_9) 5)))
+(assert (or (>= (- t_36_1 t_29_0) 3) (>= (- t_29_0 t_36_1) 1)))
+(assert (or (>= (- t_36_6 t_29_0) 3) (>= (- t_29_0 t_36_6) 5)))
+(assert (or (>= (- t_44_3 t_29_0) 3) (>= (- t_29_0 t_44_3) 4)))
+(assert (or (>= (- t_55_8 t_29_0) 3) (>= (- t_29_0 t_55_8) 4)))
+(assert (or (>= (- t_71_8 t_29_0) 3) (>= (- t_29_0 t_71_8) 3)))
+(assert (or (>= (- t_84_5 t_29_0) 3) (>= (- t_29_0 t_84_5) 2)))
+(assert (or (>= (- t_36_6 t_36_1) 1) (>= (- t_36_1 t_36_6) 5)))
+(assert (or (>= (- t_44_3 t_36_1) 1) (>= (- t_36_1 t_44_3) 4)))
+(assert (or (>= (- t_55_8 t_36_1) 1) (>= (- t_36_1 t_55_8) 4)))
+(assert (or (>= (- t_71_8 t_36_1) 1) (>= (- t_36_1 t_71_8) 3)))
+(assert (or (>= (- t_84_5 t_36_1) 1) (>= (- t_36_1 t_84_5) 2)))
+(assert (or (>= (- t_44_3 t_36_6) 5) (>= (- t_36_6 t_44_3) 4)))
+(assert (or (>= (- t_55_8 t_36_6) 5) (>= (- t_36_6 t_55_8) 4)))
+(assert (or (>= (- t_71_8 t_36_6) 5) (>= (- t_36_6 t_71_8) 3)))
+(assert (or (>= (- t_84_5 t_36_6) 5) (>= (- t_36_6 t_84_5) 2)))
+(assert (or (>= (- t_55_8 t_44_3) 4) (>= (- t_44_3 t_55_8) 4)))
+(assert (or (>= (- t_71_8 t_44_3) 4) (>= (- t_44_3 t_71_8) 3)))
+(assert (or (>= (- t_84_5 t_44_3) 4) (>= (- t_44_3 t_84_5) 2)))
+(assert (or (>= (- t_71_8 t_55_8) 4) (>= (- t_55_8 t_71_8) 3)))
+(assert (or (>= (- t_84_5 t_55_8) 4) (>= (- t_55_8 t_84_5) 2)))
+(assert (or (>= (- t_84_5 t_71_8) 3) (>= (- t_71_8 t_84_5) 2)))
+(assert (or (>= (- t_42_8 t_9_9) 1) (>= (- t_9_9 t_42_8) 4)))
+(assert (or (>= (- t_47_7 t_9_9) 1) (>= (- t_9_9 t_47_7) 5)))
+(assert (or (>= (- t_55_1 t_9_9) 1) (>= (- t_9_9 t_55_1) 2)))
+(assert (or (>= (- t_75_0 t_9_9) 1) (>= (- t_9_9 t_75_0) 4)))
+(assert (or (>= (- t_47_7 t_42_8) 4) (>= (- t_42_8 t_47_7) 5)))
+(assert (or (>= (- t_55_1 t_42_8) 4) (>= (- t_42_8 t_55_1) 2)))
+(assert (or (>= (- t_75_0 t_42_8) 4) (>= (- t_42_8 t_75_0) 4)))
+(assert (or (>= (- t_55_1 t_47_7) 5) (>= (- t_47_7 t_55_1) 2)))
+(assert (or (>= (- t_75_0 t_47_7) 5) (>= (- t_47_7 t_75_0) 4)))
+(assert (or (>= (- t_75_0 t_55_1) 2) (>= (- t_55_1 t_75_0) 4)))
+(assert (or (>= (- t_20_3 t_14_5) 3) (>= (- t_14_5 t_20_3) 1)))
+(assert (or (>= (- t_41_9 t_14_5) 3) (>= (- t_14_5 t_41_9) 1)))
+(assert (or (>= (- t_42_0 t_14_5) 3) (>= (- t_14_5 t_42_0) 3)))
+(assert (or (>= (- t_66_9 t_14_5) 3) (>= (- t_14_5 t_66_9) 5)))
+(assert (or (>= (- t_68_6 t_14_5) 3) (>= (- t_14_5 t_68_6) 2)))
+(assert (or (>= (- t_41_9 t_20_3) 1) (>= (- t_20_3 t_41_9) 1)))
+(assert (or (>= (- t_42_0 t_20_3) 1) (>= (- t_20_3 t_42_0) 3)))
+(assert (or (>= (- t_66_9 t_20_3) 1) (>= (- t_20_3 t_66_9) 5)))
+(assert (or (>= (- t_68_6 t_20_3) 1) (>= (- t_20_3 t_68_6) 2)))
+(assert (or (>= (- t_42_0 t_41_9) 1) (>= (- t_41_9 t_42_0) 3)))
+(assert (or (>= (- t_66_9 t_41_9) 1) (>= (- t_41_9 t_66_9) 5)))
+(assert (or (>= (- t_68_6 t_41_9) 1) (>= (- t_41_9 t_68_6) 2)))
+(assert (or (>= (- t_66_9 t_42_0) 3) (>= (- t_42_0 t_66_9) 5)))
+(assert (or (>= (- t_68_6 t_42_0) 3) (>= (- t_42_0 t_68_6) 2)))
+(assert (or (>= (- t_68_6 t_66_9) 5) (>= (- t_66_9 t_68_6) 2)))
+(assert (or (>= (- t_19_4 t_19_0) 4) (>= (- t_19_0 t_19_4) 5)))
+(assert (or (>= (- t_44_0 t_19_0) 4) (>= (- t_19_0 t_44_0) 1)))
+(assert (or (>= (- t_68_0 t_19_0) 4) (>= (- t_19_0 t_68_0) 2)))
+(assert (or (>= (- t_69_6 t_19_0) 4) (>= (- t_19_0 t_69_6) 2)))
+(assert (or (>= (- t_85_0 t_19_0) 4) (>= (- t_19_0 t_85_0) 4)))
+(assert (or (>= (- t_88_9 t_19_0) 4) (>= (- t_19_0 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_19_0) 4) (>= (- t_19_0 t_90_6) 2)))
+(assert (or (>= (- t_44_0 t_19_4) 5) (>= (- t_19_4 t_44_0) 1)))
+(assert (or (>= (- t_68_0 t_19_4) 5) (>= (- t_19_4 t_68_0) 2)))
+(assert (or (>= (- t_69_6 t_19_4) 5) (>= (- t_19_4 t_69_6) 2)))
+(assert (or (>= (- t_85_0 t_19_4) 5) (>= (- t_19_4 t_85_0) 4)))
+(assert (or (>= (- t_88_9 t_19_4) 5) (>= (- t_19_4 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_19_4) 5) (>= (- t_19_4 t_90_6) 2)))
+(assert (or (>= (- t_68_0 t_44_0) 1) (>= (- t_44_0 t_68_0) 2)))
+(assert (or (>= (- t_69_6 t_44_0) 1) (>= (- t_44_0 t_69_6) 2)))
+(assert (or (>= (- t_85_0 t_44_0) 1) (>= (- t_44_0 t_85_0) 4)))
+(assert (or (>= (- t_88_9 t_44_0) 1) (>= (- t_44_0 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_44_0) 1) (>= (- t_44_0 t_90_6) 2)))
+(assert (or (>= (- t_69_6 t_68_0) 2) (>= (- t_68_0 t_69_6) 2)))
+(assert (or (>= (- t_85_0 t_68_0) 2) (>= (- t_68_0 t_85_0) 4)))
+(assert (or (>= (- t_88_9 t_68_0) 2) (>= (- t_68_0 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_68_0) 2) (>= (- t_68_0 t_90_6) 2)))
+(assert (or (>= (- t_85_0 t_69_6) 2) (>= (- t_69_6 t_85_0) 4)))
+(assert (or (>= (- t_88_9 t_69_6) 2) (>= (- t_69_6 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_69_6) 2) (>= (- t_69_6 t_90_6) 2)))
+(assert (or (>= (- t_88_9 t_85_0) 4) (>= (- t_85_0 t_88_9) 5)))
+(assert (or (>= (- t_90_6 t_85_0) 4) (>= (- t_85_0 t_90_6) 2)))
+(assert (or (>= (- t_90_6 t_88_9) 5) (>= (- t_88_9 t_90_6) 2)))
+(assert (or (>= (- t_68_2 t_7_3) 2) (>= (- t_7_3 t_68_2) 4)))
+(assert (or (>= (- t_79_5 t_7_3) 2) (>= (- t_7_3 t_79_5) 3)))
+(assert (or (>= (- t_91_2 t_7_3) 2) (>= (- t_7_3 t_91_2) 1)))
+(assert (or (>= (- t_95_2 t_7_3) 2) (>= (- t_7_3 t_95_2) 5)))
+(assert (or (>= (- t_79_5 t_68_2) 4) (>= (- t_68_2 t_79_5) 3)))
+(assert (or (>= (- t_91_2 t_68_2) 4) (>= (- t_68_2 t_91_2) 1)))
+(assert (or (>= (- t_95_2 t_68_2) 4) (>= (- t_68_2 t_95_2) 5)))
+(assert (or (>= (- t_91_2 t_79_5) 3) (>= (- t_79_5 t_91_2) 1)))
+(assert (or (>= (- t_95_2 t_79_5) 3) (>= (- t_79_5 t_95_2) 5)))
+(assert (or (>= (- t_95_2 t_91_2) 1) (>= (- t_91_2 t_95_2) 5)))
+(assert (or (>= (- t_6_1 t_5_2) 4) (>= (- t_5_2 t_6_1) 5)))
+(assert (or (>= (- t_70_6 t_5_2) 4) (>= (- t_5_2 t_70_6) 2)))
+(assert (or (>= (- t_77_7 t_5_2) 4) (>= (- t_5_2 t_77_7) 2)))
+(assert (or (>= (- t_70_6 t_6_1) 5) (>= (- t_6_1 t_70_6) 2)))
+(assert (or (>= (- t_77_7 t_6_1) 5) (>= (- t_6_1 t_77_7) 2)))
+(assert (or (>= (- t_77_7 t_70_6) 2) (>= (- t_70_6 t_77_7) 2)))
+(assert (or (>= (- t_2_6 t_1_8) 4) (>= (- t_1_8 t_2_6) 4)))
+(assert (or (>= (- t_59_5 t_1_8) 4) (>= (- t_1_8 t_59_5) 1)))
+(assert (or (>= (- t_59_5 t_2_6) 4) (>= (- t_2_6 t_59_5) 1)))
+(assert (or (>= (- t_50_4 t_47_5) 2) (>= (- t_47_5 t_50_4) 4)))
+(assert (or (>= (- t_56_0 t_47_5) 2) (>= (- t_47_5 t_56_0) 5)))
+(assert (or (>= (- t_58_9 t_47_5) 2) (>= (- t_47_5 t_58_9) 3)))
+(assert (or (>= (- t_65_2 t_47_5) 2) (>= (- t_47_5 t_65_2) 4)))
+(assert (or (>= (- t_93_5 t_47_5) 2) (>= (- t_47_5 t_93_5) 3)))
+(assert (or (>= (- t_56_0 t_50_4) 4) (>= (- t_50_4 t_56_0) 5)))
+(assert (or (>= (- t_58_9 t_50_4) 4) (>= (- t_50_4 t_58_9) 3)))
+(assert (or (>= (- t_65_2 t_50_4) 4) (>= (- t_50_4 t_65_2) 4)))
+(assert (or (>= (- t_93_5 t_50_4) 4) (>= (- t_50_4 t_93_5) 3)))
+(assert (or (>= (- t_58_9 t_56_0) 5) (>= (- t_56_0 t_58_9) 3)))
+(assert (or (>= (- t_65_2 t_56_0) 5) (>= (- t_56_0 t_65_2) 4)))
+(assert (or (>= (- t_93_5 t_56_0) 5) (>= (- t_56_0 t_93_5) 3)))
+(assert (or (>= (- t_65_2 t_58_9) 3) (>= (- t_58_9 t_65_2) 4)))
+(assert (or (>= (- t_93_5 t_58_9) 3) (>= (- t_58_9 t_93_5) 3)))
+(assert (or (>= (- t_93_5 t_65_2) 4) (>= (- t_65_2 t_93_5) 3)))
+(assert (or (>= (- t_43_7 t_4_9) 5) (>= (- t_4_9 t_43_7) 4)))
+(assert (or (>= (- t_77_9 t_4_9) 5) (>= (- t_4_9 t_77_9) 4)))
+(assert (or (>= (- t_77_9 t_43_7) 4) (>= (- t_43_7 t_77_9) 4)))
+(assert (or (>= (- t_11_7 t_11_0) 4) (>= (- t_11_0 t_11_7) 1)))
+(assert (or (>= (- t_56_4 t_11_0) 4) (>= (- t_11_0 t_56_4) 4)))
+(assert (or (>= (- t_59_2 t_11_0) 4) (>= (- t_11_0 t_59_2) 1)))
+(assert (or (>= (- t_56_4 t_11_7) 1) (>= (- t_11_7 t_56_4) 4)))
+(assert (or (>= (- t_59_2 t_11_7) 1) (>= (- t_11_7 t_59_2) 1)))
+(assert (or (>= (- t_59_2 t_56_4) 4) (>= (- t_56_4 t_59_2) 1)))
+(assert (or (>= (- t_20_5 t_3_3) 2) (>= (- t_3_3 t_20_5) 1)))
+(assert (or (>= (- t_26_3 t_3_3) 2) (>= (- t_3_3 t_26_3) 2)))
+(assert (or (>= (- t_39_8 t_3_3) 2) (>= (- t_3_3 t_39_8) 1)))
+(assert (or (>= (- t_47_3 t_3_3) 2) (>= (- t_3_3 t_47_3) 1)))
+(assert (or (>= (- t_47_4 t_3_3) 2) (>= (- t_3_3 t_47_4) 5)))
+(assert (or (>= (- t_82_1 t_3_3) 2) (>= (- t_3_3 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_3_3) 2) (>= (- t_3_3 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_3_3) 2) (>= (- t_3_3 t_95_7) 2)))
+(assert (or (>= (- t_26_3 t_20_5) 1) (>= (- t_20_5 t_26_3) 2)))
+(assert (or (>= (- t_39_8 t_20_5) 1) (>= (- t_20_5 t_39_8) 1)))
+(assert (or (>= (- t_47_3 t_20_5) 1) (>= (- t_20_5 t_47_3) 1)))
+(assert (or (>= (- t_47_4 t_20_5) 1) (>= (- t_20_5 t_47_4) 5)))
+(assert (or (>= (- t_82_1 t_20_5) 1) (>= (- t_20_5 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_20_5) 1) (>= (- t_20_5 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_20_5) 1) (>= (- t_20_5 t_95_7) 2)))
+(assert (or (>= (- t_39_8 t_26_3) 2) (>= (- t_26_3 t_39_8) 1)))
+(assert (or (>= (- t_47_3 t_26_3) 2) (>= (- t_26_3 t_47_3) 1)))
+(assert (or (>= (- t_47_4 t_26_3) 2) (>= (- t_26_3 t_47_4) 5)))
+(assert (or (>= (- t_82_1 t_26_3) 2) (>= (- t_26_3 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_26_3) 2) (>= (- t_26_3 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_26_3) 2) (>= (- t_26_3 t_95_7) 2)))
+(assert (or (>= (- t_47_3 t_39_8) 1) (>= (- t_39_8 t_47_3) 1)))
+(assert (or (>= (- t_47_4 t_39_8) 1) (>= (- t_39_8 t_47_4) 5)))
+(assert (or (>= (- t_82_1 t_39_8) 1) (>= (- t_39_8 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_39_8) 1) (>= (- t_39_8 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_39_8) 1) (>= (- t_39_8 t_95_7) 2)))
+(assert (or (>= (- t_47_4 t_47_3) 1) (>= (- t_47_3 t_47_4) 5)))
+(assert (or (>= (- t_82_1 t_47_3) 1) (>= (- t_47_3 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_47_3) 1) (>= (- t_47_3 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_47_3) 1) (>= (- t_47_3 t_95_7) 2)))
+(assert (or (>= (- t_82_1 t_47_4) 5) (>= (- t_47_4 t_82_1) 4)))
+(assert (or (>= (- t_89_9 t_47_4) 5) (>= (- t_47_4 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_47_4) 5) (>= (- t_47_4 t_95_7) 2)))
+(assert (or (>= (- t_89_9 t_82_1) 4) (>= (- t_82_1 t_89_9) 1)))
+(assert (or (>= (- t_95_7 t_82_1) 4) (>= (- t_82_1 t_95_7) 2)))
+(assert (or (>= (- t_95_7 t_89_9) 1) (>= (- t_89_9 t_95_7) 2)))
+(assert (or (>= (- t_24_1 t_5_1) 3) (>= (- t_5_1 t_24_1) 4)))
+(assert (or (>= (- t_30_4 t_5_1) 3) (>= (- t_5_1 t_30_4) 3)))
+(assert (or (>= (- t_86_2 t_5_1) 3) (>= (- t_5_1 t_86_2) 4)))
+(assert (or (>= (- t_30_4 t_24_1) 4) (>= (- t_24_1 t_30_4) 3)))
+(assert (or (>= (- t_86_2 t_24_1) 4) (>= (- t_24_1 t_86_2) 4)))
+(assert (or (>= (- t_86_2 t_30_4) 3) (>= (- t_30_4 t_86_2) 4)))
+(assert (or (>= (- t_67_8 t_65_9) 5) (>= (- t_65_9 t_67_8) 5)))
+(assert (or (>= (- t_85_9 t_65_9) 5) (>= (- t_65_9 t_85_9) 2)))
+(assert (or (>= (- t_91_6 t_65_9) 5) (>= (- t_65_9 t_91_6) 2)))
+(assert (or (>= (- t_85_9 t_67_8) 5) (>= (- t_67_8 t_85_9) 2)))
+(assert (or (>= (- t_91_6 t_67_8) 5) (>= (- t_67_8 t_91_6) 2)))
+(assert (or (>= (- t_91_6 t_85_9) 2) (>= (- t_85_9 t_91_6) 2)))
+(assert (or (>= (- t_51_5 t_18_4) 4) (>= (- t_18_4 t_51_5) 4)))
+(assert (or (>= (- t_56_2 t_18_4) 4) (>= (- t_18_4 t_56_2) 2)))
+(assert (or (>= (- t_81_8 t_18_4) 4) (>= (- t_18_4 t_81_8) 3)))
+(assert (or (>= (- t_85_2 t_18_4) 4) (>= (- t_18_4 t_85_2) 4)))
+(assert (or (>= (- t_56_2 t_51_5) 4) (>= (- t_51_5 t_56_2) 2)))
+(assert (or (>= (- t_81_8 t_51_5) 4) (>= (- t_51_5 t_81_8) 3)))
+(assert (or (>= (- t_85_2 t_51_5) 4) (>= (- t_51_5 t_85_2) 4)))
+(assert (or (>= (- t_81_8 t_56_2) 2) (>= (- t_56_2 t_81_8) 3)))
+(assert (or (>= (- t_85_2 t_56_2) 2) (>= (- t_56_2 t_85_2) 4)))
+(assert (or (>= (- t_85_2 t_81_8) 3) (>= (- t_81_8 t_85_2) 4)))
+(assert (or (>= (- t_71_5 t_69_7) 2) (>= (- t_69_7 t_71_5) 3)))
+(assert (or (>= (- t_27_1 t_6_6) 3) (>= (- t_6_6 t_27_1) 3)))
+(assert (or (>= (- t_73_9 t_6_6) 3) (>= (- t_6_6 t_73_9) 2)))
+(assert (or (>= (- t_90_2 t_6_6) 3) (>= (- t_6_6 t_90_2) 2)))
+(assert (or (>= (- t_95_1 t_6_6) 3) (>= (- t_6_6 t_95_1) 5)))
+(assert (or (>= (- t_73_9 t_27_1) 3) (>= (- t_27_1 t_73_9) 2)))
+(assert (or (>= (- t_90_2 t_27_1) 3) (>= (- t_27_1 t_90_2) 2)))
+(assert (or (>= (- t_95_1 t_27_1) 3) (>= (- t_27_1 t_95_1) 5)))
+(assert (or (>= (- t_90_2 t_73_9) 2) (>= (- t_73_9 t_90_2) 2)))
+(assert (or (>= (- t_95_1 t_73_9) 2) (>= (- t_73_9 t_95_1) 5)))
+(assert (or (>= (- t_95_1 t_90_2) 2) (>= (- t_90_2 t_95_1) 5)))
+(assert (or (>= (- t_57_8 t_27_0) 3) (>= (- t_27_0 t_57_8) 2)))
+(assert (or (>= (- t_72_3 t_27_0) 3) (>= (- t_27_0 t_72_3) 1)))
+(assert (or (>= (- t_72_3 t_57_8) 2) (>= (- t_57_8 t_72_3) 1)))
+(assert (or (>= (- t_48_7 t_34_1) 1) (>= (- t_34_1 t_48_7) 2)))
+(assert (or (>= (- t_49_2 t_34_1) 1) (>= (- t_34_1 t_49_2) 1)))
+(assert (or (>= (- t_61_1 t_34_1) 1) (>= (- t_34_1 t_61_1) 4)))
+(assert (or (>= (- t_65_1 t_34_1) 1) (>= (- t_34_1 t_65_1) 3)))
+(assert (or (>= (- t_78_8 t_34_1) 1) (>= (- t_34_1 t_78_8) 5)))
+(assert (or (>= (- t_49_2 t_48_7) 2) (>= (- t_48_7 t_49_2) 1)))
+(assert (or (>= (- t_61_1 t_48_7) 2) (>= (- t_48_7 t_61_1) 4)))
+(assert (or (>= (- t_65_1 t_48_7) 2) (>= (- t_48_7 t_65_1) 3)))
+(assert (or (>= (- t_78_8 t_48_7) 2) (>= (- t_48_7 t_78_8) 5)))
+(assert (or (>= (- t_61_1 t_49_2) 1) (>= (- t_49_2 t_61_1) 4)))
+(assert (or (>= (- t_65_1 t_49_2) 1) (>= (- t_49_2 t_65_1) 3)))
+(assert (or (>= (- t_78_8 t_49_2) 1) (>= (- t_49_2 t_78_8) 5)))
+(assert (or (>= (- t_65_1 t_61_1) 4) (>= (- t_61_1 t_65_1) 3)))
+(assert (or (>= (- t_78_8 t_61_1) 4) (>= (- t_61_1 t_78_8) 5)))
+(assert (or (>= (- t_78_8 t_65_1) 3) (>= (- t_65_1 t_78_8) 5)))
+(assert (or (>= (- t_34_2 t_11_4) 3) (>= (- t_11_4 t_34_2) 2)))
+(assert (or (>= (- t_35_4 t_11_4) 3) (>= (- t_11_4 t_35_4) 2)))
+(assert (or (>= (- t_45_4 t_11_4) 3) (>= (- t_11_4 t_45_4) 5)))
+(assert (or (>= (- t_98_6 t_11_4) 3) (>= (- t_11_4 t_98_6) 3)))
+(assert (or (>= (- t_35_4 t_34_2) 2) (>= (- t_34_2 t_35_4) 2)))
+(assert (or (>= (- t_45_4 t_34_2) 2) (>= (- t_34_2 t_45_4) 5)))
+(assert (or (>= (- t_98_6 t_34_2) 2) (>= (- t_34_2 t_98_6) 3)))
+(assert (or (>= (- t_45_4 t_35_4) 2) (>= (- t_35_4 t_45_4) 5)))
+(assert (or (>= (- t_98_6 t_35_4) 2) (>= (- t_35_4 t_98_6) 3)))
+(assert (or (>= (- t_98_6 t_45_4) 5) (>= (- t_45_4 t_98_6) 3)))
+(assert (or (>= (- t_15_2 t_4_4) 2) (>= (- t_4_4 t_15_2) 5)))
+(assert (or (>= (- t_17_5 t_4_4) 2) (>= (- t_4_4 t_17_5) 5)))
+(assert (or (>= (- t_55_0 t_4_4) 2) (>= (- t_4_4 t_55_0) 4)))
+(assert (or (>= (- t_82_7 t_4_4) 2) (>= (- t_4_4 t_82_7) 2)))
+(assert (or (>= (- t_90_3 t_4_4) 2) (>= (- t_4_4 t_90_3) 2)))
+(assert (or (>= (- t_17_5 t_15_2) 5) (>= (- t_15_2 t_17_5) 5)))
+(assert (or (>= (- t_55_0 t_15_2) 5) (>= (- t_15_2 t_55_0) 4)))
+(assert (or (>= (- t_82_7 t_15_2) 5) (>= (- t_15_2 t_82_7) 2)))
+(assert (or (>= (- t_90_3 t_15_2) 5) (>= (- t_15_2 t_90_3) 2)))
+(assert (or (>= (- t_55_0 t_17_5) 5) (>= (- t_17_5 t_55_0) 4)))
+(assert (or (>= (- t_82_7 t_17_5) 5) (>= (- t_17_5 t_82_7) 2)))
+(assert (or (>= (- t_90_3 t_17_5) 5) (>= (- t_17_5 t_90_3) 2)))
+(assert (or (>= (- t_82_7 t_55_0) 4) (>= (- t_55_0 t_82_7) 2)))
+(assert (or (>= (- t_90_3 t_55_0) 4) (>= (- t_55_0 t_90_3) 2)))
+(assert (or (>= (- t_90_3 t_82_7) 2) (>= (- t_82_7 t_90_3) 2)))
+(assert (or (>= (- t_28_1 t_24_8) 3) (>= (- t_24_8 t_28_1) 2)))
+(assert (or (>= (- t_29_4 t_24_8) 3) (>= (- t_24_8 t_29_4) 1)))
+(assert (or (>= (- t_53_1 t_24_8) 3) (>= (- t_24_8 t_53_1) 5)))
+(assert (or (>= (- t_72_0 t_24_8) 3) (>= (- t_24_8 t_72_0) 4)))
+(assert (or (>= (- t_77_4 t_24_8) 3) (>= (- t_24_8 t_77_4) 5)))
+(assert (or (>= (- t_29_4 t_28_1) 2) (>= (- t_28_1 t_29_4) 1)))
+(assert (or (>= (- t_53_1 t_28_1) 2) (>= (- t_28_1 t_53_1) 5)))
+(assert (or (>= (- t_72_0 t_28_1) 2) (>= (- t_28_1 t_72_0) 4)))
+(assert (or (>= (- t_77_4 t_28_1) 2) (>= (- t_28_1 t_77_4) 5)))
+(assert (or (>= (- t_53_1 t_29_4) 1) (>= (- t_29_4 t_53_1) 5)))
+(assert (or (>= (- t_72_0 t_29_4) 1) (>= (- t_29_4 t_72_0) 4)))
+(assert (or (>= (- t_77_4 t_29_4) 1) (>= (- t_29_4 t_77_4) 5)))
+(assert (or (>= (- t_72_0 t_53_1) 5) (>= (- t_53_1 t_72_0) 4)))
+(assert (or (>= (- t_77_4 t_53_1) 5) (>= (- t_53_1 t_77_4) 5)))
+(assert (or (>= (- t_77_4 t_72_0) 4) (>= (- t_72_0 t_77_4) 5)))
+(assert (or (>= (- t_47_9 t_31_9) 1) (>= (- t_31_9 t_47_9) 2)))
+(assert (or (>= (- t_48_0 t_31_9) 1) (>= (- t_31_9 t_48_0) 5)))
+(assert (or (>= (- t_72_6 t_31_9) 1) (>= (- t_31_9 t_72_6) 5)))
+(assert (or (>= (- t_73_0 t_31_9) 1) (>= (- t_31_9 t_73_0) 4)))
+(assert (or (>= (- t_97_0 t_31_9) 1) (>= (- t_31_9 t_97_0) 2)))
+(assert (or (>= (- t_48_0 t_47_9) 2) (>= (- t_47_9 t_48_0) 5)))
+(assert (or (>= (- t_72_6 t_47_9) 2) (>= (- t_47_9 t_72_6) 5)))
+(assert (or (>= (- t_73_0 t_47_9) 2) (>= (- t_47_9 t_73_0) 4)))
+(assert (or (>= (- t_97_0 t_47_9) 2) (>= (- t_47_9 t_97_0) 2)))
+(assert (or (>= (- t_72_6 t_48_0) 5) (>= (- t_48_0 t_72_6) 5)))
+(assert (or (>= (- t_73_0 t_48_0) 5) (>= (- t_48_0 t_73_0) 4)))
+(assert (or (>= (- t_97_0 t_48_0) 5) (>= (- t_48_0 t_97_0) 2)))
+(assert (or (>= (- t_73_0 t_72_6) 5) (>= (- t_72_6 t_73_0) 4)))
+(assert (or (>= (- t_97_0 t_72_6) 5) (>= (- t_72_6 t_97_0) 2)))
+(assert (or (>= (- t_97_0 t_73_0) 4) (>= (- t_73_0 t_97_0) 2)))
+(assert (or (>= (- t_11_9 t_11_1) 1) (>= (- t_11_1 t_11_9) 1)))
+(assert (or (>= (- t_41_6 t_11_1) 1) (>= (- t_11_1 t_41_6) 2)))
+(assert (or (>= (- t_42_7 t_11_1) 1) (>= (- t_11_1 t_42_7) 3)))
+(assert (or (>= (- t_47_0 t_11_1) 1) (>= (- t_11_1 t_47_0) 3)))
+(assert (or (>= (- t_41_6 t_11_9) 1) (>= (- t_11_9 t_41_6) 2)))
+(assert (or (>= (- t_42_7 t_11_9) 1) (>= (- t_11_9 t_42_7) 3)))
+(assert (or (>= (- t_47_0 t_11_9) 1) (>= (- t_11_9 t_47_0) 3)))
+(assert (or (>= (- t_42_7 t_41_6) 2) (>= (- t_41_6 t_42_7) 3)))
+(assert (or (>= (- t_47_0 t_41_6) 2) (>= (- t_41_6 t_47_0) 3)))
+(assert (or (>= (- t_47_0 t_42_7) 3) (>= (- t_42_7 t_47_0) 3)))
+(assert (or (>= (- t_87_8 t_13_3) 1) (>= (- t_13_3 t_87_8) 5)))
+(assert (or (>= (- t_30_2 t_13_1) 4) (>= (- t_13_1 t_30_2) 2)))
+(assert (or (>= (- t_49_9 t_13_1) 4) (>= (- t_13_1 t_49_9) 3)))
+(assert (or (>= (- t_57_7 t_13_1) 4) (>= (- t_13_1 t_57_7) 3)))
+(assert (or (>= (- t_59_8 t_13_1) 4) (>= (- t_13_1 t_59_8) 3)))
+(assert (or (>= (- t_86_6 t_13_1) 4) (>= (- t_13_1 t_86_6) 4)))
+(assert (or (>= (- t_49_9 t_30_2) 2) (>= (- t_30_2 t_49_9) 3)))
+(assert (or (>= (- t_57_7 t_30_2) 2) (>= (- t_30_2 t_57_7) 3)))
+(assert (or (>= (- t_59_8 t_30_2) 2) (>= (- t_30_2 t_59_8) 3)))
+(assert (or (>= (- t_86_6 t_30_2) 2) (>= (- t_30_2 t_86_6) 4)))
+(assert (or (>= (- t_57_7 t_49_9) 3) (>= (- t_49_9 t_57_7) 3)))
+(assert (or (>= (- t_59_8 t_49_9) 3) (>= (- t_49_9 t_59_8) 3)))
+(assert (or (>= (- t_86_6 t_49_9) 3) (>= (- t_49_9 t_86_6) 4)))
+(assert (or (>= (- t_59_8 t_57_7) 3) (>= (- t_57_7 t_59_8) 3)))
+(assert (or (>= (- t_86_6 t_57_7) 3) (>= (- t_57_7 t_86_6) 4)))
+(assert (or (>= (- t_86_6 t_59_8) 3) (>= (- t_59_8 t_86_6) 4)))
+(assert (or (>= (- t_17_2 t_13_8) 3) (>= (- t_13_8 t_17_2) 5)))
+(assert (or (>= (- t_78_1 t_13_8) 3) (>= (- t_13_8 t_78_1) 3)))
+(assert (or (>= (- t_78_1 t_17_2) 5) (>= (- t_17_2 t_78_1) 3)))
+(assert (or (>= (- t_63_8 t_15_9) 1) (>= (- t_15_9 t_63_8) 4)))
+(assert (or (>= (- t_69_8 t_15_9) 1) (>= (- t_15_9 t_69_8) 2)))
+(assert (or (>= (- t_84_7 t_15_9) 1) (>= (- t_15_9 t_84_7) 3)))
+(assert (or (>= (- t_69_8 t_63_8) 4) (>= (- t_63_8 t_69_8) 2)))
+(assert (or (>= (- t_84_7 t_63_8) 4) (>= (- t_63_8 t_84_7) 3)))
+(assert (or (>= (- t_84_7 t_69_8) 2) (>= (- t_69_8 t_84_7) 3)))
+(assert (or (>= (- t_36_7 t_17_4) 1) (>= (- t_17_4 t_36_7) 1)))
+(assert (or (>= (- t_37_7 t_17_4) 1) (>= (- t_17_4 t_37_7) 1)))
+(assert (or (>= (- t_58_3 t_17_4) 1) (>= (- t_17_4 t_58_3) 3)))
+(assert (or (>= (- t_99_5 t_17_4) 1) (>= (- t_17_4 t_99_5) 2)))
+(assert (or (>= (- t_37_7 t_36_7) 1) (>= (- t_36_7 t_37_7) 1)))
+(assert (or (>= (- t_58_3 t_36_7) 1) (>= (- t_36_7 t_58_3) 3)))
+(assert (or (>= (- t_99_5 t_36_7) 1) (>= (- t_36_7 t_99_5) 2)))
+(assert (or (>= (- t_58_3 t_37_7) 1) (>= (- t_37_7 t_58_3) 3)))
+(assert (or (>= (- t_99_5 t_37_7) 1) (>= (- t_37_7 t_99_5) 2)))
+(assert (or (>= (- t_99_5 t_58_3) 3) (>= (- t_58_3 t_99_5) 2)))
+(assert (or (>= (- t_44_1 t_28_6) 1) (>= (- t_28_6 t_44_1) 2)))
+(assert (or (>= (- t_77_2 t_28_6) 1) (>= (- t_28_6 t_77_2) 4)))
+(assert (or (>= (- t_77_2 t_44_1) 2) (>= (- t_44_1 t_77_2) 4)))
+(assert (or (>= (- t_77_3 t_32_5) 2) (>= (- t_32_5 t_77_3) 5)))
+(assert (or (>= (- t_38_2 t_15_0) 3) (>= (- t_15_0 t_38_2) 4)))
+(assert (or (>= (- t_43_0 t_15_0) 3) (>= (- t_15_0 t_43_0) 5)))
+(assert (or (>= (- t_43_0 t_38_2) 4) (>= (- t_38_2 t_43_0) 5)))
+(assert (or (>= (- t_9_6 t_1_5) 5) (>= (- t_1_5 t_9_6) 1)))
+(assert (or (>= (- t_29_2 t_1_5) 5) (>= (- t_1_5 t_29_2) 2)))
+(assert (or (>= (- t_31_3 t_1_5) 5) (>= (- t_1_5 t_31_3) 2)))
+(assert (or (>= (- t_65_8 t_1_5) 5) (>= (- t_1_5 t_65_8) 2)))
+(assert (or (>= (- t_94_1 t_1_5) 5) (>= (- t_1_5 t_94_1) 1)))
+(assert (or (>= (- t_29_2 t_9_6) 1) (>= (- t_9_6 t_29_2) 2)))
+(assert (or (>= (- t_31_3 t_9_6) 1) (>= (- t_9_6 t_31_3) 2)))
+(assert (or (>= (- t_65_8 t_9_6) 1) (>= (- t_9_6 t_65_8) 2)))
+(assert (or (>= (- t_94_1 t_9_6) 1) (>= (- t_9_6 t_94_1) 1)))
+(assert (or (>= (- t_31_3 t_29_2) 2) (>= (- t_29_2 t_31_3) 2)))
+(assert (or (>= (- t_65_8 t_29_2) 2) (>= (- t_29_2 t_65_8) 2)))
+(assert (or (>= (- t_94_1 t_29_2) 2) (>= (- t_29_2 t_94_1) 1)))
+(assert (or (>= (- t_65_8 t_31_3) 2) (>= (- t_31_3 t_65_8) 2)))
+(assert (or (>= (- t_94_1 t_31_3) 2) (>= (- t_31_3 t_94_1) 1)))
+(assert (or (>= (- t_94_1 t_65_8) 2) (>= (- t_65_8 t_94_1) 1)))
+(assert (or (>= (- t_35_1 t_3_6) 3) (>= (- t_3_6 t_35_1) 2)))
+(assert (or (>= (- t_43_8 t_3_6) 3) (>= (- t_3_6 t_43_8) 3)))
+(assert (or (>= (- t_73_8 t_3_6) 3) (>= (- t_3_6 t_73_8) 1)))
+(assert (or (>= (- t_43_8 t_35_1) 2) (>= (- t_35_1 t_43_8) 3)))
+(assert (or (>= (- t_73_8 t_35_1) 2) (>= (- t_35_1 t_73_8) 1)))
+(assert (or (>= (- t_73_8 t_43_8) 3) (>= (- t_43_8 t_73_8) 1)))
+(assert (or (>= (- t_9_4 t_6_8) 5) (>= (- t_6_8 t_9_4) 1)))
+(assert (or (>= (- t_13_0 t_6_8) 5) (>= (- t_6_8 t_13_0) 1)))
+(assert (or (>= (- t_19_1 t_6_8) 5) (>= (- t_6_8 t_19_1) 1)))
+(assert (or (>= (- t_21_5 t_6_8) 5) (>= (- t_6_8 t_21_5) 1)))
+(assert (or (>= (- t_24_6 t_6_8) 5) (>= (- t_6_8 t_24_6) 5)))
+(assert (or (>= (- t_70_8 t_6_8) 5) (>= (- t_6_8 t_70_8) 3)))
+(assert (or (>= (- t_13_0 t_9_4) 1) (>= (- t_9_4 t_13_0) 1)))
+(assert (or (>= (- t_19_1 t_9_4) 1) (>= (- t_9_4 t_19_1) 1)))
+(assert (or (>= (- t_21_5 t_9_4) 1) (>= (- t_9_4 t_21_5) 1)))
+(assert (or (>= (- t_24_6 t_9_4) 1) (>= (- t_9_4 t_24_6) 5)))
+(assert (or (>= (- t_70_8 t_9_4) 1) (>= (- t_9_4 t_70_8) 3)))
+(assert (or (>= (- t_19_1 t_13_0) 1) (>= (- t_13_0 t_19_1) 1)))
+(assert (or (>= (- t_21_5 t_13_0) 1) (>= (- t_13_0 t_21_5) 1)))
+(assert (or (>= (- t_24_6 t_13_0) 1) (>= (- t_13_0 t_24_6) 5)))
+(assert (or (>= (- t_70_8 t_13_0) 1) (>= (- t_13_0 t_70_8) 3)))
+(assert (or (>= (- t_21_5 t_19_1) 1) (>= (- t_19_1 t_21_5) 1)))
+(assert (or (>= (- t_24_6 t_19_1) 1) (>= (- t_19_1 t_24_6) 5)))
+(assert (or (>= (- t_70_8 t_19_1) 1) (>= (- t_19_1 t_70_8) 3)))
+(assert (or (>= (- t_24_6 t_21_5) 1) (>= (- t_21_5 t_24_6) 5)))
+(assert (or (>= (- t_70_8 t_21_5) 1) (>= (- t_21_5 t_70_8) 3)))
+(assert (or (>= (- t_70_8 t_24_6) 5) (>= (- t_24_6 t_70_8) 3)))
+(assert (or (>= (- t_18_9 t_5_6) 5) (>= (- t_5_6 t_18_9) 2)))
+(assert (or (>= (- t_25_1 t_5_6) 5) (>= (- t_5_6 t_25_1) 1)))
+(assert (or (>= (- t_62_4 t_5_6) 5) (>= (- t_5_6 t_62_4) 2)))
+(assert (or (>= (- t_25_1 t_18_9) 2) (>= (- t_18_9 t_25_1) 1)))
+(assert (or (>= (- t_62_4 t_18_9) 2) (>= (- t_18_9 t_62_4) 2)))
+(assert (or (>= (- t_62_4 t_25_1) 1) (>= (- t_25_1 t_62_4) 2)))
+(assert (or (>= (- t_58_8 t_51_8) 2) (>= (- t_51_8 t_58_8) 1)))
+(assert (or (>= (- t_19_2 t_0_1) 1) (>= (- t_0_1 t_19_2) 3)))
+(assert (or (>= (- t_30_6 t_0_1) 1) (>= (- t_0_1 t_30_6) 5)))
+(assert (or (>= (- t_53_8 t_0_1) 1) (>= (- t_0_1 t_53_8) 3)))
+(assert (or (>= (- t_72_2 t_0_1) 1) (>= (- t_0_1 t_72_2) 5)))
+(assert (or (>= (- t_76_5 t_0_1) 1) (>= (- t_0_1 t_76_5) 3)))
+(assert (or (>= (- t_30_6 t_19_2) 3) (>= (- t_19_2 t_30_6) 5)))
+(assert (or (>= (- t_53_8 t_19_2) 3) (>= (- t_19_2 t_53_8) 3)))
+(assert (or (>= (- t_72_2 t_19_2) 3) (>= (- t_19_2 t_72_2) 5)))
+(assert (or (>= (- t_76_5 t_19_2) 3) (>= (- t_19_2 t_76_5) 3)))
+(assert (or (>= (- t_53_8 t_30_6) 5) (>= (- t_30_6 t_53_8) 3)))
+(assert (or (>= (- t_72_2 t_30_6) 5) (>= (- t_30_6 t_72_2) 5)))
+(assert (or (>= (- t_76_5 t_30_6) 5) (>= (- t_30_6 t_76_5) 3)))
+(assert (or (>= (- t_72_2 t_53_8) 3) (>= (- t_53_8 t_72_2) 5)))
+(assert (or (>= (- t_76_5 t_53_8) 3) (>= (- t_53_8 t_76_5) 3)))
+(assert (or (>= (- t_76_5 t_72_2) 5) (>= (- t_72_2 t_76_5) 3)))
+(assert (or (>= (- t_76_2 t_39_0) 1) (>= (- t_39_0 t_76_2) 4)))
+(assert (or (>= (- t_86_7 t_39_0) 1) (>= (- t_39_0 t_86_7) 4)))
+(assert (or (>= (- t_86_7 t_76_2) 4) (>= (- t_76_2 t_86_7) 4)))
+(assert (or (>= (- t_46_9 t_25_3) 1) (>= (- t_25_3 t_46_9) 3)))
+(assert (or (>= (- t_60_4 t_48_5) 4) (>= (- t_48_5 t_60_4) 3)))
+(assert (or (>= (- t_8_7 t_7_7) 3) (>= (- t_7_7 t_8_7) 2)))
+(assert (or (>= (- t_52_8 t_7_7) 3) (>= (- t_7_7 t_52_8) 3)))
+(assert (or (>= (- t_66_1 t_7_7) 3) (>= (- t_7_7 t_66_1) 2)))
+(assert (or (>= (- t_71_4 t_7_7) 3) (>= (- t_7_7 t_71_4) 3)))
+(assert (or (>= (- t_80_0 t_7_7) 3) (>= (- t_7_7 t_80_0) 4)))
+(assert (or (>= (- t_92_0 t_7_7) 3) (>= (- t_7_7 t_92_0) 3)))
+(assert (or (>= (- t_52_8 t_8_7) 2) (>= (- t_8_7 t_52_8) 3)))
+(assert (or (>= (- t_66_1 t_8_7) 2) (>= (- t_8_7 t_66_1) 2)))
+(assert (or (>= (- t_71_4 t_8_7) 2) (>= (- t_8_7 t_71_4) 3)))
+(assert (or (>= (- t_80_0 t_8_7) 2) (>= (- t_8_7 t_80_0) 4)))
+(assert (or (>= (- t_92_0 t_8_7) 2) (>= (- t_8_7 t_92_0) 3)))
+(assert (or (>= (- t_66_1 t_52_8) 3) (>= (- t_52_8 t_66_1) 2)))
+(assert (or (>= (- t_71_4 t_52_8) 3) (>= (- t_52_8 t_71_4) 3)))
+(assert (or (>= (- t_80_0 t_52_8) 3) (>= (- t_52_8 t_80_0) 4)))
+(assert (or (>= (- t_92_0 t_52_8) 3) (>= (- t_52_8 t_92_0) 3)))
+(assert (or (>= (- t_71_4 t_66_1) 2) (>= (- t_66_1 t_71_4) 3)))
+(assert (or (>= (- t_80_0 t_66_1) 2) (>= (- t_66_1 t_80_0) 4)))
+(assert (or (>= (- t_92_0 t_66_1) 2) (>= (- t_66_1 t_92_0) 3)))
+(assert (or (>= (- t_80_0 t_71_4) 3) (>= (- t_71_4 t_80_0) 4)))
+(assert (or (>= (- t_92_0 t_71_4) 3) (>= (- t_71_4 t_92_0) 3)))
+(assert (or (>= (- t_92_0 t_80_0) 4) (>= (- t_80_0 t_92_0) 3)))
+(assert (or (>= (- t_43_2 t_17_7) 1) (>= (- t_17_7 t_43_2) 1)))
+(assert (or (>= (- t_45_0 t_17_7) 1) (>= (- t_17_7 t_45_0) 4)))
+(assert (or (>= (- t_48_8 t_17_7) 1) (>= (- t_17_7 t_48_8) 5)))
+(assert (or (>= (- t_54_7 t_17_7) 1) (>= (- t_17_7 t_54_7) 1)))
+(assert (or (>= (- t_87_6 t_17_7) 1) (>= (- t_17_7 t_87_6) 1)))
+(assert (or (>= (- t_45_0 t_43_2) 1) (>= (- t_43_2 t_45_0) 4)))
+(assert (or (>= (- t_48_8 t_43_2) 1) (>= (- t_43_2 t_48_8) 5)))
+(assert (or (>= (- t_54_7 t_43_2) 1) (>= (- t_43_2 t_54_7) 1)))
+(assert (or (>= (- t_87_6 t_43_2) 1) (>= (- t_43_2 t_87_6) 1)))
+(assert (or (>= (- t_48_8 t_45_0) 4) (>= (- t_45_0 t_48_8) 5)))
+(assert (or (>= (- t_54_7 t_45_0) 4) (>= (- t_45_0 t_54_7) 1)))
+(assert (or (>= (- t_87_6 t_45_0) 4) (>= (- t_45_0 t_87_6) 1)))
+(assert (or (>= (- t_54_7 t_48_8) 5) (>= (- t_48_8 t_54_7) 1)))
+(assert (or (>= (- t_87_6 t_48_8) 5) (>= (- t_48_8 t_87_6) 1)))
+(assert (or (>= (- t_87_6 t_54_7) 1) (>= (- t_54_7 t_87_6) 1)))
+(assert (or (>= (- t_20_4 t_4_0) 5) (>= (- t_4_0 t_20_4) 2)))
+(assert (or (>= (- t_24_2 t_4_0) 5) (>= (- t_4_0 t_24_2) 3)))
+(assert (or (>= (- t_24_2 t_20_4) 2) (>= (- t_20_4 t_24_2) 3)))
+(assert (or (>= (- t_14_3 t_12_2) 1) (>= (- t_12_2 t_14_3) 4)))
+(assert (or (>= (- t_55_4 t_12_2) 1) (>= (- t_12_2 t_55_4) 3)))
+(assert (or (>= (- t_56_9 t_12_2) 1) (>= (- t_12_2 t_56_9) 3)))
+(assert (or (>= (- t_55_4 t_14_3) 4) (>= (- t_14_3 t_55_4) 3)))
+(assert (or (>= (- t_56_9 t_14_3) 4) (>= (- t_14_3 t_56_9) 3)))
+(assert (or (>= (- t_56_9 t_55_4) 3) (>= (- t_55_4 t_56_9) 3)))
+(assert (or (>= (- t_13_5 t_11_3) 3) (>= (- t_11_3 t_13_5) 2)))
+(assert (or (>= (- t_16_0 t_11_3) 3) (>= (- t_11_3 t_16_0) 4)))
+(assert (or (>= (- t_21_1 t_11_3) 3) (>= (- t_11_3 t_21_1) 1)))
+(assert (or (>= (- t_42_4 t_11_3) 3) (>= (- t_11_3 t_42_4) 1)))
+(assert (or (>= (- t_89_8 t_11_3) 3) (>= (- t_11_3 t_89_8) 1)))
+(assert (or (>= (- t_16_0 t_13_5) 2) (>= (- t_13_5 t_16_0) 4)))
+(assert (or (>= (- t_21_1 t_13_5) 2) (>= (- t_13_5 t_21_1) 1)))
+(assert (or (>= (- t_42_4 t_13_5) 2) (>= (- t_13_5 t_42_4) 1)))
+(assert (or (>= (- t_89_8 t_13_5) 2) (>= (- t_13_5 t_89_8) 1)))
+(assert (or (>= (- t_21_1 t_16_0) 4) (>= (- t_16_0 t_21_1) 1)))
+(assert (or (>= (- t_42_4 t_16_0) 4) (>= (- t_16_0 t_42_4) 1)))
+(assert (or (>= (- t_89_8 t_16_0) 4) (>= (- t_16_0 t_89_8) 1)))
+(assert (or (>= (- t_42_4 t_21_1) 1) (>= (- t_21_1 t_42_4) 1)))
+(assert (or (>= (- t_89_8 t_21_1) 1) (>= (- t_21_1 t_89_8) 1)))
+(assert (or (>= (- t_89_8 t_42_4) 1) (>= (- t_42_4 t_89_8) 1)))
+(assert (or (>= (- t_10_9 t_10_3) 1) (>= (- t_10_3 t_10_9) 1)))
+(assert (or (>= (- t_89_1 t_10_3) 1) (>= (- t_10_3 t_89_1) 5)))
+(assert (or (>= (- t_97_1 t_10_3) 1) (>= (- t_10_3 t_97_1) 4)))
+(assert (or (>= (- t_89_1 t_10_9) 1) (>= (- t_10_9 t_89_1) 5)))
+(assert (or (>= (- t_97_1 t_10_9) 1) (>= (- t_10_9 t_97_1) 4)))
+(assert (or (>= (- t_97_1 t_89_1) 5) (>= (- t_89_1 t_97_1) 4)))
+(assert (or (>= (- t_37_3 t_2_3) 3) (>= (- t_2_3 t_37_3) 4)))
+(assert (or (>= (- t_50_5 t_2_3) 3) (>= (- t_2_3 t_50_5) 3)))
+(assert (or (>= (- t_66_7 t_2_3) 3) (>= (- t_2_3 t_66_7) 5)))
+(assert (or (>= (- t_50_5 t_37_3) 4) (>= (- t_37_3 t_50_5) 3)))
+(assert (or (>= (- t_66_7 t_37_3) 4) (>= (- t_37_3 t_66_7) 5)))
+(assert (or (>= (- t_66_7 t_50_5) 3) (>= (- t_50_5 t_66_7) 5)))
+(assert (or (>= (- t_33_6 t_27_7) 5) (>= (- t_27_7 t_33_6) 3)))
+(assert (or (>= (- t_48_2 t_27_7) 5) (>= (- t_27_7 t_48_2) 3)))
+(assert (or (>= (- t_60_0 t_27_7) 5) (>= (- t_27_7 t_60_0) 3)))
+(assert (or (>= (- t_80_2 t_27_7) 5) (>= (- t_27_7 t_80_2) 5)))
+(assert (or (>= (- t_95_0 t_27_7) 5) (>= (- t_27_7 t_95_0) 5)))
+(assert (or (>= (- t_48_2 t_33_6) 3) (>= (- t_33_6 t_48_2) 3)))
+(assert (or (>= (- t_60_0 t_33_6) 3) (>= (- t_33_6 t_60_0) 3)))
+(assert (or (>= (- t_80_2 t_33_6) 3) (>= (- t_33_6 t_80_2) 5)))
+(assert (or (>= (- t_95_0 t_33_6) 3) (>= (- t_33_6 t_95_0) 5)))
+(assert (or (>= (- t_60_0 t_48_2) 3) (>= (- t_48_2 t_60_0) 3)))
+(assert (or (>= (- t_80_2 t_48_2) 3) (>= (- t_48_2 t_80_2) 5)))
+(assert (or (>= (- t_95_0 t_48_2) 3) (>= (- t_48_2 t_95_0) 5)))
+(assert (or (>= (- t_80_2 t_60_0) 3) (>= (- t_60_0 t_80_2) 5)))
+(assert (or (>= (- t_95_0 t_60_0) 3) (>= (- t_60_0 t_95_0) 5)))
+(assert (or (>= (- t_95_0 t_80_2) 5) (>= (- t_80_2 t_95_0) 5)))
+(assert (or (>= (- t_39_2 t_6_9) 4) (>= (- t_6_9 t_39_2) 4)))
+(assert (or (>= (- t_49_1 t_6_9) 4) (>= (- t_6_9 t_49_1) 1)))
+(assert (or (>= (- t_61_7 t_6_9) 4) (>= (- t_6_9 t_61_7) 1)))
+(assert (or (>= (- t_90_5 t_6_9) 4) (>= (- t_6_9 t_90_5) 3)))
+(assert (or (>= (- t_49_1 t_39_2) 4) (>= (- t_39_2 t_49_1) 1)))
+(assert (or (>= (- t_61_7 t_39_2) 4) (>= (- t_39_2 t_61_7) 1)))
+(assert (or (>= (- t_90_5 t_39_2) 4) (>= (- t_39_2 t_90_5) 3)))
+(assert (or (>= (- t_61_7 t_49_1) 1) (>= (- t_49_1 t_61_7) 1)))
+(assert (or (>= (- t_90_5 t_49_1) 1) (>= (- t_49_1 t_90_5) 3)))
+(assert (or (>= (- t_90_5 t_61_7) 1) (>= (- t_61_7 t_90_5) 3)))
+(assert (or (>= (- t_31_5 t_3_1) 2) (>= (- t_3_1 t_31_5) 5)))
+(assert (or (>= (- t_44_2 t_3_1) 2) (>= (- t_3_1 t_44_2) 4)))
+(assert (or (>= (- t_46_0 t_3_1) 2) (>= (- t_3_1 t_46_0) 4)))
+(assert (or (>= (- t_49_6 t_3_1) 2) (>= (- t_3_1 t_49_6) 3)))
+(assert (or (>= (- t_60_9 t_3_1) 2) (>= (- t_3_1 t_60_9) 4)))
+(assert (or (>= (- t_74_1 t_3_1) 2) (>= (- t_3_1 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_3_1) 2) (>= (- t_3_1 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_3_1) 2) (>= (- t_3_1 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_3_1) 2) (>= (- t_3_1 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_3_1) 2) (>= (- t_3_1 t_97_7) 2)))
+(assert (or (>= (- t_44_2 t_31_5) 5) (>= (- t_31_5 t_44_2) 4)))
+(assert (or (>= (- t_46_0 t_31_5) 5) (>= (- t_31_5 t_46_0) 4)))
+(assert (or (>= (- t_49_6 t_31_5) 5) (>= (- t_31_5 t_49_6) 3)))
+(assert (or (>= (- t_60_9 t_31_5) 5) (>= (- t_31_5 t_60_9) 4)))
+(assert (or (>= (- t_74_1 t_31_5) 5) (>= (- t_31_5 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_31_5) 5) (>= (- t_31_5 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_31_5) 5) (>= (- t_31_5 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_31_5) 5) (>= (- t_31_5 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_31_5) 5) (>= (- t_31_5 t_97_7) 2)))
+(assert (or (>= (- t_46_0 t_44_2) 4) (>= (- t_44_2 t_46_0) 4)))
+(assert (or (>= (- t_49_6 t_44_2) 4) (>= (- t_44_2 t_49_6) 3)))
+(assert (or (>= (- t_60_9 t_44_2) 4) (>= (- t_44_2 t_60_9) 4)))
+(assert (or (>= (- t_74_1 t_44_2) 4) (>= (- t_44_2 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_44_2) 4) (>= (- t_44_2 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_44_2) 4) (>= (- t_44_2 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_44_2) 4) (>= (- t_44_2 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_44_2) 4) (>= (- t_44_2 t_97_7) 2)))
+(assert (or (>= (- t_49_6 t_46_0) 4) (>= (- t_46_0 t_49_6) 3)))
+(assert (or (>= (- t_60_9 t_46_0) 4) (>= (- t_46_0 t_60_9) 4)))
+(assert (or (>= (- t_74_1 t_46_0) 4) (>= (- t_46_0 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_46_0) 4) (>= (- t_46_0 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_46_0) 4) (>= (- t_46_0 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_46_0) 4) (>= (- t_46_0 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_46_0) 4) (>= (- t_46_0 t_97_7) 2)))
+(assert (or (>= (- t_60_9 t_49_6) 3) (>= (- t_49_6 t_60_9) 4)))
+(assert (or (>= (- t_74_1 t_49_6) 3) (>= (- t_49_6 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_49_6) 3) (>= (- t_49_6 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_49_6) 3) (>= (- t_49_6 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_49_6) 3) (>= (- t_49_6 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_49_6) 3) (>= (- t_49_6 t_97_7) 2)))
+(assert (or (>= (- t_74_1 t_60_9) 4) (>= (- t_60_9 t_74_1) 5)))
+(assert (or (>= (- t_74_3 t_60_9) 4) (>= (- t_60_9 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_60_9) 4) (>= (- t_60_9 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_60_9) 4) (>= (- t_60_9 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_60_9) 4) (>= (- t_60_9 t_97_7) 2)))
+(assert (or (>= (- t_74_3 t_74_1) 5) (>= (- t_74_1 t_74_3) 1)))
+(assert (or (>= (- t_80_5 t_74_1) 5) (>= (- t_74_1 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_74_1) 5) (>= (- t_74_1 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_74_1) 5) (>= (- t_74_1 t_97_7) 2)))
+(assert (or (>= (- t_80_5 t_74_3) 1) (>= (- t_74_3 t_80_5) 3)))
+(assert (or (>= (- t_85_8 t_74_3) 1) (>= (- t_74_3 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_74_3) 1) (>= (- t_74_3 t_97_7) 2)))
+(assert (or (>= (- t_85_8 t_80_5) 3) (>= (- t_80_5 t_85_8) 2)))
+(assert (or (>= (- t_97_7 t_80_5) 3) (>= (- t_80_5 t_97_7) 2)))
+(assert (or (>= (- t_97_7 t_85_8) 2) (>= (- t_85_8 t_97_7) 2)))
+(assert (or (>= (- t_37_8 t_4_3) 5) (>= (- t_4_3 t_37_8) 2)))
+(assert (or (>= (- t_45_6 t_4_3) 5) (>= (- t_4_3 t_45_6) 5)))
+(assert (or (>= (- t_88_3 t_4_3) 5) (>= (- t_4_3 t_88_3) 4)))
+(assert (or (>= (- t_45_6 t_37_8) 2) (>= (- t_37_8 t_45_6) 5)))
+(assert (or (>= (- t_88_3 t_37_8) 2) (>= (- t_37_8 t_88_3) 4)))
+(assert (or (>= (- t_88_3 t_45_6) 5) (>= (- t_45_6 t_88_3) 4)))
+(assert (or (>= (- t_52_3 t_7_9) 5) (>= (- t_7_9 t_52_3) 3)))
+(assert (or (>= (- t_63_2 t_7_9) 5) (>= (- t_7_9 t_63_2) 5)))
+(assert (or (>= (- t_76_9 t_7_9) 5) (>= (- t_7_9 t_76_9) 3)))
+(assert (or (>= (- t_92_1 t_7_9) 5) (>= (- t_7_9 t_92_1) 5)))
+(assert (or (>= (- t_94_5 t_7_9) 5) (>= (- t_7_9 t_94_5) 1)))
+(assert (or (>= (- t_63_2 t_52_3) 3) (>= (- t_52_3 t_63_2) 5)))
+(assert (or (>= (- t_76_9 t_52_3) 3) (>= (- t_52_3 t_76_9) 3)))
+(assert (or (>= (- t_92_1 t_52_3) 3) (>= (- t_52_3 t_92_1) 5)))
+(assert (or (>= (- t_94_5 t_52_3) 3) (>= (- t_52_3 t_94_5) 1)))
+(assert (or (>= (- t_76_9 t_63_2) 5) (>= (- t_63_2 t_76_9) 3)))
+(assert (or (>= (- t_92_1 t_63_2) 5) (>= (- t_63_2 t_92_1) 5)))
+(assert (or (>= (- t_94_5 t_63_2) 5) (>= (- t_63_2 t_94_5) 1)))
+(assert (or (>= (- t_92_1 t_76_9) 3) (>= (- t_76_9 t_92_1) 5)))
+(assert (or (>= (- t_94_5 t_76_9) 3) (>= (- t_76_9 t_94_5) 1)))
+(assert (or (>= (- t_94_5 t_92_1) 5) (>= (- t_92_1 t_94_5) 1)))
+(assert (or (>= (- t_3_2 t_0_7) 5) (>= (- t_0_7 t_3_2) 2)))
+(assert (or (>= (- t_37_1 t_0_7) 5) (>= (- t_0_7 t_37_1) 3)))
+(assert (or (>= (- t_46_6 t_0_7) 5) (>= (- t_0_7 t_46_6) 3)))
+(assert (or (>= (- t_54_4 t_0_7) 5) (>= (- t_0_7 t_54_4) 3)))
+(assert (or (>= (- t_67_4 t_0_7) 5) (>= (- t_0_7 t_67_4) 3)))
+(assert (or (>= (- t_77_5 t_0_7) 5) (>= (- t_0_7 t_77_5) 2)))
+(assert (or (>= (- t_37_1 t_3_2) 2) (>= (- t_3_2 t_37_1) 3)))
+(assert (or (>= (- t_46_6 t_3_2) 2) (>= (- t_3_2 t_46_6) 3)))
+(assert (or (>= (- t_54_4 t_3_2) 2) (>= (- t_3_2 t_54_4) 3)))
+(assert (or (>= (- t_67_4 t_3_2) 2) (>= (- t_3_2 t_67_4) 3)))
+(assert (or (>= (- t_77_5 t_3_2) 2) (>= (- t_3_2 t_77_5) 2)))
+(assert (or (>= (- t_46_6 t_37_1) 3) (>= (- t_37_1 t_46_6) 3)))
+(assert (or (>= (- t_54_4 t_37_1) 3) (>= (- t_37_1 t_54_4) 3)))
+(assert (or (>= (- t_67_4 t_37_1) 3) (>= (- t_37_1 t_67_4) 3)))
+(assert (or (>= (- t_77_5 t_37_1) 3) (>= (- t_37_1 t_77_5) 2)))
+(assert (or (>= (- t_54_4 t_46_6) 3) (>= (- t_46_6 t_54_4) 3)))
+(assert (or (>= (- t_67_4 t_46_6) 3) (>= (- t_46_6 t_67_4) 3)))
+(assert (or (>= (- t_77_5 t_46_6) 3) (>= (- t_46_6 t_77_5) 2)))
+(assert (or (>= (- t_67_4 t_54_4) 3) (>= (- t_54_4 t_67_4) 3)))
+(assert (or (>= (- t_77_5 t_54_4) 3) (>= (- t_54_4 t_77_5) 2)))
+(assert (or (>= (- t_77_5 t_67_4) 3) (>= (- t_67_4 t_77_5) 2)))
+(assert (or (>= (- t_14_6 t_2_7) 4) (>= (- t_2_7 t_14_6) 4)))
+(assert (or (>= (- t_59_1 t_2_7) 4) (>= (- t_2_7 t_59_1) 5)))
+(assert (or (>= (- t_79_0 t_2_7) 4) (>= (- t_2_7 t_79_0) 4)))
+(assert (or (>= (- t_87_3 t_2_7) 4) (>= (- t_2_7 t_87_3) 1)))
+(assert (or (>= (- t_59_1 t_14_6) 4) (>= (- t_14_6 t_59_1) 5)))
+(assert (or (>= (- t_79_0 t_14_6) 4) (>= (- t_14_6 t_79_0) 4)))
+(assert (or (>= (- t_87_3 t_14_6) 4) (>= (- t_14_6 t_87_3) 1)))
+(assert (or (>= (- t_79_0 t_59_1) 5) (>= (- t_59_1 t_79_0) 4)))
+(assert (or (>= (- t_87_3 t_59_1) 5) (>= (- t_59_1 t_87_3) 1)))
+(assert (or (>= (- t_87_3 t_79_0) 4) (>= (- t_79_0 t_87_3) 1)))
+(assert (or (>= (- t_58_5 t_1_0) 1) (>= (- t_1_0 t_58_5) 2)))
+(assert (or (>= (- t_10_4 t_8_8) 4) (>= (- t_8_8 t_10_4) 5)))
+(assert (or (>= (- t_90_1 t_8_8) 4) (>= (- t_8_8 t_90_1) 1)))
+(assert (or (>= (- t_96_6 t_8_8) 4) (>= (- t_8_8 t_96_6) 1)))
+(assert (or (>= (- t_90_1 t_10_4) 5) (>= (- t_10_4 t_90_1) 1)))
+(assert (or (>= (- t_96_6 t_10_4) 5) (>= (- t_10_4 t_96_6) 1)))
+(assert (or (>= (- t_96_6 t_90_1) 1) (>= (- t_90_1 t_96_6) 1)))
+(assert (or (>= (- t_8_4 t_5_5) 4) (>= (- t_5_5 t_8_4) 5)))
+(assert (or (>= (- t_12_6 t_5_5) 4) (>= (- t_5_5 t_12_6) 2)))
+(assert (or (>= (- t_23_5 t_5_5) 4) (>= (- t_5_5 t_23_5) 1)))
+(assert (or (>= (- t_26_0 t_5_5) 4) (>= (- t_5_5 t_26_0) 4)))
+(assert (or (>= (- t_42_2 t_5_5) 4) (>= (- t_5_5 t_42_2) 4)))
+(assert (or (>= (- t_42_5 t_5_5) 4) (>= (- t_5_5 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_5_5) 4) (>= (- t_5_5 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_5_5) 4) (>= (- t_5_5 t_97_9) 5)))
+(assert (or (>= (- t_12_6 t_8_4) 5) (>= (- t_8_4 t_12_6) 2)))
+(assert (or (>= (- t_23_5 t_8_4) 5) (>= (- t_8_4 t_23_5) 1)))
+(assert (or (>= (- t_26_0 t_8_4) 5) (>= (- t_8_4 t_26_0) 4)))
+(assert (or (>= (- t_42_2 t_8_4) 5) (>= (- t_8_4 t_42_2) 4)))
+(assert (or (>= (- t_42_5 t_8_4) 5) (>= (- t_8_4 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_8_4) 5) (>= (- t_8_4 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_8_4) 5) (>= (- t_8_4 t_97_9) 5)))
+(assert (or (>= (- t_23_5 t_12_6) 2) (>= (- t_12_6 t_23_5) 1)))
+(assert (or (>= (- t_26_0 t_12_6) 2) (>= (- t_12_6 t_26_0) 4)))
+(assert (or (>= (- t_42_2 t_12_6) 2) (>= (- t_12_6 t_42_2) 4)))
+(assert (or (>= (- t_42_5 t_12_6) 2) (>= (- t_12_6 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_12_6) 2) (>= (- t_12_6 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_12_6) 2) (>= (- t_12_6 t_97_9) 5)))
+(assert (or (>= (- t_26_0 t_23_5) 1) (>= (- t_23_5 t_26_0) 4)))
+(assert (or (>= (- t_42_2 t_23_5) 1) (>= (- t_23_5 t_42_2) 4)))
+(assert (or (>= (- t_42_5 t_23_5) 1) (>= (- t_23_5 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_23_5) 1) (>= (- t_23_5 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_23_5) 1) (>= (- t_23_5 t_97_9) 5)))
+(assert (or (>= (- t_42_2 t_26_0) 4) (>= (- t_26_0 t_42_2) 4)))
+(assert (or (>= (- t_42_5 t_26_0) 4) (>= (- t_26_0 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_26_0) 4) (>= (- t_26_0 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_26_0) 4) (>= (- t_26_0 t_97_9) 5)))
+(assert (or (>= (- t_42_5 t_42_2) 4) (>= (- t_42_2 t_42_5) 5)))
+(assert (or (>= (- t_53_2 t_42_2) 4) (>= (- t_42_2 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_42_2) 4) (>= (- t_42_2 t_97_9) 5)))
+(assert (or (>= (- t_53_2 t_42_5) 5) (>= (- t_42_5 t_53_2) 3)))
+(assert (or (>= (- t_97_9 t_42_5) 5) (>= (- t_42_5 t_97_9) 5)))
+(assert (or (>= (- t_97_9 t_53_2) 3) (>= (- t_53_2 t_97_9) 5)))
+(assert (or (>= (- t_28_7 t_6_5) 4) (>= (- t_6_5 t_28_7) 1)))
+(assert (or (>= (- t_49_4 t_6_5) 4) (>= (- t_6_5 t_49_4) 3)))
+(assert (or (>= (- t_50_7 t_6_5) 4) (>= (- t_6_5 t_50_7) 2)))
+(assert (or (>= (- t_83_9 t_6_5) 4) (>= (- t_6_5 t_83_9) 4)))
+(assert (or (>= (- t_88_1 t_6_5) 4) (>= (- t_6_5 t_88_1) 4)))
+(assert (or (>= (- t_88_4 t_6_5) 4) (>= (- t_6_5 t_88_4) 2)))
+(assert (or (>= (- t_49_4 t_28_7) 1) (>= (- t_28_7 t_49_4) 3)))
+(assert (or (>= (- t_50_7 t_28_7) 1) (>= (- t_28_7 t_50_7) 2)))
+(assert (or (>= (- t_83_9 t_28_7) 1) (>= (- t_28_7 t_83_9) 4)))
+(assert (or (>= (- t_88_1 t_28_7) 1) (>= (- t_28_7 t_88_1) 4)))
+(assert (or (>= (- t_88_4 t_28_7) 1) (>= (- t_28_7 t_88_4) 2)))
+(assert (or (>= (- t_50_7 t_49_4) 3) (>= (- t_49_4 t_50_7) 2)))
+(assert (or (>= (- t_83_9 t_49_4) 3) (>= (- t_49_4 t_83_9) 4)))
+(assert (or (>= (- t_88_1 t_49_4) 3) (>= (- t_49_4 t_88_1) 4)))
+(assert (or (>= (- t_88_4 t_49_4) 3) (>= (- t_49_4 t_88_4) 2)))
+(assert (or (>= (- t_83_9 t_50_7) 2) (>= (- t_50_7 t_83_9) 4)))
+(assert (or (>= (- t_88_1 t_50_7) 2) (>= (- t_50_7 t_88_1) 4)))
+(assert (or (>= (- t_88_4 t_50_7) 2) (>= (- t_50_7 t_88_4) 2)))
+(assert (or (>= (- t_88_1 t_83_9) 4) (>= (- t_83_9 t_88_1) 4)))
+(assert (or (>= (- t_88_4 t_83_9) 4) (>= (- t_83_9 t_88_4) 2)))
+(assert (or (>= (- t_88_4 t_88_1) 4) (>= (- t_88_1 t_88_4) 2)))
+(assert (or (>= (- t_5_9 t_2_9) 2) (>= (- t_2_9 t_5_9) 3)))
+(assert (or (>= (- t_8_1 t_2_9) 2) (>= (- t_2_9 t_8_1) 5)))
+(assert (or (>= (- t_25_6 t_2_9) 2) (>= (- t_2_9 t_25_6) 2)))
+(assert (or (>= (- t_28_2 t_2_9) 2) (>= (- t_2_9 t_28_2) 3)))
+(assert (or (>= (- t_45_7 t_2_9) 2) (>= (- t_2_9 t_45_7) 4)))
+(assert (or (>= (- t_75_5 t_2_9) 2) (>= (- t_2_9 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_2_9) 2) (>= (- t_2_9 t_98_0) 2)))
+(assert (or (>= (- t_8_1 t_5_9) 3) (>= (- t_5_9 t_8_1) 5)))
+(assert (or (>= (- t_25_6 t_5_9) 3) (>= (- t_5_9 t_25_6) 2)))
+(assert (or (>= (- t_28_2 t_5_9) 3) (>= (- t_5_9 t_28_2) 3)))
+(assert (or (>= (- t_45_7 t_5_9) 3) (>= (- t_5_9 t_45_7) 4)))
+(assert (or (>= (- t_75_5 t_5_9) 3) (>= (- t_5_9 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_5_9) 3) (>= (- t_5_9 t_98_0) 2)))
+(assert (or (>= (- t_25_6 t_8_1) 5) (>= (- t_8_1 t_25_6) 2)))
+(assert (or (>= (- t_28_2 t_8_1) 5) (>= (- t_8_1 t_28_2) 3)))
+(assert (or (>= (- t_45_7 t_8_1) 5) (>= (- t_8_1 t_45_7) 4)))
+(assert (or (>= (- t_75_5 t_8_1) 5) (>= (- t_8_1 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_8_1) 5) (>= (- t_8_1 t_98_0) 2)))
+(assert (or (>= (- t_28_2 t_25_6) 2) (>= (- t_25_6 t_28_2) 3)))
+(assert (or (>= (- t_45_7 t_25_6) 2) (>= (- t_25_6 t_45_7) 4)))
+(assert (or (>= (- t_75_5 t_25_6) 2) (>= (- t_25_6 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_25_6) 2) (>= (- t_25_6 t_98_0) 2)))
+(assert (or (>= (- t_45_7 t_28_2) 3) (>= (- t_28_2 t_45_7) 4)))
+(assert (or (>= (- t_75_5 t_28_2) 3) (>= (- t_28_2 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_28_2) 3) (>= (- t_28_2 t_98_0) 2)))
+(assert (or (>= (- t_75_5 t_45_7) 4) (>= (- t_45_7 t_75_5) 3)))
+(assert (or (>= (- t_98_0 t_45_7) 4) (>= (- t_45_7 t_98_0) 2)))
+(assert (or (>= (- t_98_0 t_75_5) 3) (>= (- t_75_5 t_98_0) 2)))
+(assert (or (>= (- t_18_2 t_5_3) 2) (>= (- t_5_3 t_18_2) 2)))
+(assert (or (>= (- t_20_2 t_5_3) 2) (>= (- t_5_3 t_20_2) 5)))
+(assert (or (>= (- t_58_2 t_5_3) 2) (>= (- t_5_3 t_58_2) 1)))
+(assert (or (>= (- t_84_0 t_5_3) 2) (>= (- t_5_3 t_84_0) 2)))
+(assert (or (>= (- t_20_2 t_18_2) 2) (>= (- t_18_2 t_20_2) 5)))
+(assert (or (>= (- t_58_2 t_18_2) 2) (>= (- t_18_2 t_58_2) 1)))
+(assert (or (>= (- t_84_0 t_18_2) 2) (>= (- t_18_2 t_84_0) 2)))
+(assert (or (>= (- t_58_2 t_20_2) 5) (>= (- t_20_2 t_58_2) 1)))
+(assert (or (>= (- t_84_0 t_20_2) 5) (>= (- t_20_2 t_84_0) 2)))
+(assert (or (>= (- t_84_0 t_58_2) 1) (>= (- t_58_2 t_84_0) 2)))
+(assert (or (>= (- t_25_2 t_2_8) 5) (>= (- t_2_8 t_25_2) 4)))
+(assert (or (>= (- t_51_2 t_2_8) 5) (>= (- t_2_8 t_51_2) 2)))
+(assert (or (>= (- t_78_0 t_2_8) 5) (>= (- t_2_8 t_78_0) 4)))
+(assert (or (>= (- t_51_2 t_25_2) 4) (>= (- t_25_2 t_51_2) 2)))
+(assert (or (>= (- t_78_0 t_25_2) 4) (>= (- t_25_2 t_78_0) 4)))
+(assert (or (>= (- t_78_0 t_51_2) 2) (>= (- t_51_2 t_78_0) 4)))
+(assert (or (>= (- t_63_1 t_21_3) 1) (>= (- t_21_3 t_63_1) 4)))
+(assert (or (>= (- t_73_2 t_21_3) 1) (>= (- t_21_3 t_73_2) 1)))
+(assert (or (>= (- t_73_2 t_63_1) 4) (>= (- t_63_1 t_73_2) 1)))
+(assert (or (>= (- t_14_2 t_4_7) 5) (>= (- t_4_7 t_14_2) 3)))
+(assert (or (>= (- t_16_1 t_4_7) 5) (>= (- t_4_7 t_16_1) 2)))
+(assert (or (>= (- t_75_9 t_4_7) 5) (>= (- t_4_7 t_75_9) 4)))
+(assert (or (>= (- t_76_4 t_4_7) 5) (>= (- t_4_7 t_76_4) 1)))
+(assert (or (>= (- t_16_1 t_14_2) 3) (>= (- t_14_2 t_16_1) 2)))
+(assert (or (>= (- t_75_9 t_14_2) 3) (>= (- t_14_2 t_75_9) 4)))
+(assert (or (>= (- t_76_4 t_14_2) 3) (>= (- t_14_2 t_76_4) 1)))
+(assert (or (>= (- t_75_9 t_16_1) 2) (>= (- t_16_1 t_75_9) 4)))
+(assert (or (>= (- t_76_4 t_16_1) 2) (>= (- t_16_1 t_76_4) 1)))
+(assert (or (>= (- t_76_4 t_75_9) 4) (>= (- t_75_9 t_76_4) 1)))
+(assert (or (>= (- t_26_5 t_16_5) 4) (>= (- t_16_5 t_26_5) 5)))
+(assert (or (>= (- t_33_9 t_16_5) 4) (>= (- t_16_5 t_33_9) 5)))
+(assert (or (>= (- t_48_4 t_16_5) 4) (>= (- t_16_5 t_48_4) 2)))
+(assert (or (>= (- t_60_7 t_16_5) 4) (>= (- t_16_5 t_60_7) 2)))
+(assert (or (>= (- t_96_2 t_16_5) 4) (>= (- t_16_5 t_96_2) 5)))
+(assert (or (>= (- t_33_9 t_26_5) 5) (>= (- t_26_5 t_33_9) 5)))
+(assert (or (>= (- t_48_4 t_26_5) 5) (>= (- t_26_5 t_48_4) 2)))
+(assert (or (>= (- t_60_7 t_26_5) 5) (>= (- t_26_5 t_60_7) 2)))
+(assert (or (>= (- t_96_2 t_26_5) 5) (>= (- t_26_5 t_96_2) 5)))
+(assert (or (>= (- t_48_4 t_33_9) 5) (>= (- t_33_9 t_48_4) 2)))
+(assert (or (>= (- t_60_7 t_33_9) 5) (>= (- t_33_9 t_60_7) 2)))
+(assert (or (>= (- t_96_2 t_33_9) 5) (>= (- t_33_9 t_96_2) 5)))
+(assert (or (>= (- t_60_7 t_48_4) 2) (>= (- t_48_4 t_60_7) 2)))
+(assert (or (>= (- t_96_2 t_48_4) 2) (>= (- t_48_4 t_96_2) 5)))
+(assert (or (>= (- t_96_2 t_60_7) 2) (>= (- t_60_7 t_96_2) 5)))
+(assert (or (>= (- t_22_4 t_18_1) 2) (>= (- t_18_1 t_22_4) 3)))
+(assert (or (>= (- t_87_5 t_18_1) 2) (>= (- t_18_1 t_87_5) 5)))
+(assert (or (>= (- t_87_5 t_22_4) 3) (>= (- t_22_4 t_87_5) 5)))
+(assert (or (>= (- t_70_9 t_57_4) 2) (>= (- t_57_4 t_70_9) 3)))
+(assert (or (>= (- t_87_2 t_57_4) 2) (>= (- t_57_4 t_87_2) 2)))
+(assert (or (>= (- t_96_5 t_57_4) 2) (>= (- t_57_4 t_96_5) 3)))
+(assert (or (>= (- t_87_2 t_70_9) 3) (>= (- t_70_9 t_87_2) 2)))
+(assert (or (>= (- t_96_5 t_70_9) 3) (>= (- t_70_9 t_96_5) 3)))
+(assert (or (>= (- t_96_5 t_87_2) 2) (>= (- t_87_2 t_96_5) 3)))
+(assert (or (>= (- t_15_3 t_1_2) 2) (>= (- t_1_2 t_15_3) 2)))
+(assert (or (>= (- t_33_5 t_1_2) 2) (>= (- t_1_2 t_33_5) 2)))
+(assert (or (>= (- t_86_0 t_1_2) 2) (>= (- t_1_2 t_86_0) 5)))
+(assert (or (>= (- t_33_5 t_15_3) 2) (>= (- t_15_3 t_33_5) 2)))
+(assert (or (>= (- t_86_0 t_15_3) 2) (>= (- t_15_3 t_86_0) 5)))
+(assert (or (>= (- t_86_0 t_33_5) 2) (>= (- t_33_5 t_86_0) 5)))
+(assert (or (>= (- t_37_9 t_10_5) 2) (>= (- t_10_5 t_37_9) 5)))
+(assert (or (>= (- t_48_3 t_10_5) 2) (>= (- t_10_5 t_48_3) 1)))
+(assert (or (>= (- t_94_0 t_10_5) 2) (>= (- t_10_5 t_94_0) 2)))
+(assert (or (>= (- t_48_3 t_37_9) 5) (>= (- t_37_9 t_48_3) 1)))
+(assert (or (>= (- t_94_0 t_37_9) 5) (>= (- t_37_9 t_94_0) 2)))
+(assert (or (>= (- t_94_0 t_48_3) 1) (>= (- t_48_3 t_94_0) 2)))
+(assert (or (>= (- t_41_8 t_18_6) 5) (>= (- t_18_6 t_41_8) 2)))
+(assert (or (>= (- t_51_0 t_18_6) 5) (>= (- t_18_6 t_51_0) 3)))
+(assert (or (>= (- t_55_9 t_18_6) 5) (>= (- t_18_6 t_55_9) 1)))
+(assert (or (>= (- t_59_4 t_18_6) 5) (>= (- t_18_6 t_59_4) 2)))
+(assert (or (>= (- t_73_3 t_18_6) 5) (>= (- t_18_6 t_73_3) 2)))
+(assert (or (>= (- t_79_1 t_18_6) 5) (>= (- t_18_6 t_79_1) 2)))
+(assert (or (>= (- t_51_0 t_41_8) 2) (>= (- t_41_8 t_51_0) 3)))
+(assert (or (>= (- t_55_9 t_41_8) 2) (>= (- t_41_8 t_55_9) 1)))
+(assert (or (>= (- t_59_4 t_41_8) 2) (>= (- t_41_8 t_59_4) 2)))
+(assert (or (>= (- t_73_3 t_41_8) 2) (>= (- t_41_8 t_73_3) 2)))
+(assert (or (>= (- t_79_1 t_41_8) 2) (>= (- t_41_8 t_79_1) 2)))
+(assert (or (>= (- t_55_9 t_51_0) 3) (>= (- t_51_0 t_55_9) 1)))
+(assert (or (>= (- t_59_4 t_51_0) 3) (>= (- t_51_0 t_59_4) 2)))
+(assert (or (>= (- t_73_3 t_51_0) 3) (>= (- t_51_0 t_73_3) 2)))
+(assert (or (>= (- t_79_1 t_51_0) 3) (>= (- t_51_0 t_79_1) 2)))
+(assert (or (>= (- t_59_4 t_55_9) 1) (>= (- t_55_9 t_59_4) 2)))
+(assert (or (>= (- t_73_3 t_55_9) 1) (>= (- t_55_9 t_73_3) 2)))
+(assert (or (>= (- t_79_1 t_55_9) 1) (>= (- t_55_9 t_79_1) 2)))
+(assert (or (>= (- t_73_3 t_59_4) 2) (>= (- t_59_4 t_73_3) 2)))
+(assert (or (>= (- t_79_1 t_59_4) 2) (>= (- t_59_4 t_79_1) 2)))
+(assert (or (>= (- t_79_1 t_73_3) 2) (>= (- t_73_3 t_79_1) 2)))
+(assert (or (>= (- t_30_9 t_7_1) 2) (>= (- t_7_1 t_30_9) 4)))
+(assert (or (>= (- t_52_7 t_7_1) 2) (>= (- t_7_1 t_52_7) 3)))
+(assert (or (>= (- t_52_7 t_30_9) 4) (>= (- t_30_9 t_52_7) 3)))
+(assert (or (>= (- t_52_5 t_20_8) 2) (>= (- t_20_8 t_52_5) 4)))
+(assert (or (>= (- t_53_5 t_40_4) 5) (>= (- t_40_4 t_53_5) 5)))
+(assert (or (>= (- t_57_0 t_40_4) 5) (>= (- t_40_4 t_57_0) 3)))
+(assert (or (>= (- t_80_7 t_40_4) 5) (>= (- t_40_4 t_80_7) 5)))
+(assert (or (>= (- t_57_0 t_53_5) 5) (>= (- t_53_5 t_57_0) 3)))
+(assert (or (>= (- t_80_7 t_53_5) 5) (>= (- t_53_5 t_80_7) 5)))
+(assert (or (>= (- t_80_7 t_57_0) 3) (>= (- t_57_0 t_80_7) 5)))
+(assert (or (>= (- t_47_8 t_0_5) 3) (>= (- t_0_5 t_47_8) 5)))
+(assert (or (>= (- t_81_9 t_0_5) 3) (>= (- t_0_5 t_81_9) 4)))
+(assert (or (>= (- t_99_2 t_0_5) 3) (>= (- t_0_5 t_99_2) 5)))
+(assert (or (>= (- t_81_9 t_47_8) 5) (>= (- t_47_8 t_81_9) 4)))
+(assert (or (>= (- t_99_2 t_47_8) 5) (>= (- t_47_8 t_99_2) 5)))
+(assert (or (>= (- t_99_2 t_81_9) 4) (>= (- t_81_9 t_99_2) 5)))
+(assert (or (>= (- t_8_3 t_5_7) 2) (>= (- t_5_7 t_8_3) 5)))
+(assert (or (>= (- t_76_6 t_5_7) 2) (>= (- t_5_7 t_76_6) 1)))
+(assert (or (>= (- t_76_6 t_8_3) 5) (>= (- t_8_3 t_76_6) 1)))
+(assert (or (>= (- t_26_8 t_14_0) 1) (>= (- t_14_0 t_26_8) 3)))
+(assert (or (>= (- t_38_4 t_14_0) 1) (>= (- t_14_0 t_38_4) 1)))
+(assert (or (>= (- t_49_5 t_14_0) 1) (>= (- t_14_0 t_49_5) 2)))
+(assert (or (>= (- t_51_3 t_14_0) 1) (>= (- t_14_0 t_51_3) 1)))
+(assert (or (>= (- t_64_7 t_14_0) 1) (>= (- t_14_0 t_64_7) 1)))
+(assert (or (>= (- t_96_3 t_14_0) 1) (>= (- t_14_0 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_14_0) 1) (>= (- t_14_0 t_98_1) 1)))
+(assert (or (>= (- t_38_4 t_26_8) 3) (>= (- t_26_8 t_38_4) 1)))
+(assert (or (>= (- t_49_5 t_26_8) 3) (>= (- t_26_8 t_49_5) 2)))
+(assert (or (>= (- t_51_3 t_26_8) 3) (>= (- t_26_8 t_51_3) 1)))
+(assert (or (>= (- t_64_7 t_26_8) 3) (>= (- t_26_8 t_64_7) 1)))
+(assert (or (>= (- t_96_3 t_26_8) 3) (>= (- t_26_8 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_26_8) 3) (>= (- t_26_8 t_98_1) 1)))
+(assert (or (>= (- t_49_5 t_38_4) 1) (>= (- t_38_4 t_49_5) 2)))
+(assert (or (>= (- t_51_3 t_38_4) 1) (>= (- t_38_4 t_51_3) 1)))
+(assert (or (>= (- t_64_7 t_38_4) 1) (>= (- t_38_4 t_64_7) 1)))
+(assert (or (>= (- t_96_3 t_38_4) 1) (>= (- t_38_4 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_38_4) 1) (>= (- t_38_4 t_98_1) 1)))
+(assert (or (>= (- t_51_3 t_49_5) 2) (>= (- t_49_5 t_51_3) 1)))
+(assert (or (>= (- t_64_7 t_49_5) 2) (>= (- t_49_5 t_64_7) 1)))
+(assert (or (>= (- t_96_3 t_49_5) 2) (>= (- t_49_5 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_49_5) 2) (>= (- t_49_5 t_98_1) 1)))
+(assert (or (>= (- t_64_7 t_51_3) 1) (>= (- t_51_3 t_64_7) 1)))
+(assert (or (>= (- t_96_3 t_51_3) 1) (>= (- t_51_3 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_51_3) 1) (>= (- t_51_3 t_98_1) 1)))
+(assert (or (>= (- t_96_3 t_64_7) 1) (>= (- t_64_7 t_96_3) 3)))
+(assert (or (>= (- t_98_1 t_64_7) 1) (>= (- t_64_7 t_98_1) 1)))
+(assert (or (>= (- t_98_1 t_96_3) 3) (>= (- t_96_3 t_98_1) 1)))
+(assert (or (>= (- t_89_7 t_64_5) 2) (>= (- t_64_5 t_89_7) 3)))
+(assert (or (>= (- t_97_2 t_64_5) 2) (>= (- t_64_5 t_97_2) 1)))
+(assert (or (>= (- t_97_5 t_64_5) 2) (>= (- t_64_5 t_97_5) 5)))
+(assert (or (>= (- t_97_2 t_89_7) 3) (>= (- t_89_7 t_97_2) 1)))
+(assert (or (>= (- t_97_5 t_89_7) 3) (>= (- t_89_7 t_97_5) 5)))
+(assert (or (>= (- t_97_5 t_97_2) 1) (>= (- t_97_2 t_97_5) 5)))
+(assert (or (>= (- t_61_9 t_6_3) 3) (>= (- t_6_3 t_61_9) 5)))
+(assert (or (>= (- t_35_8 t_26_6) 1) (>= (- t_26_6 t_35_8) 2)))
+(assert (or (>= (- t_41_5 t_26_6) 1) (>= (- t_26_6 t_41_5) 5)))
+(assert (or (>= (- t_63_0 t_26_6) 1) (>= (- t_26_6 t_63_0) 1)))
+(assert (or (>= (- t_74_6 t_26_6) 1) (>= (- t_26_6 t_74_6) 2)))
+(assert (or (>= (- t_82_0 t_26_6) 1) (>= (- t_26_6 t_82_0) 1)))
+(assert (or (>= (- t_91_7 t_26_6) 1) (>= (- t_26_6 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_26_6) 1) (>= (- t_26_6 t_93_6) 4)))
+(assert (or (>= (- t_41_5 t_35_8) 2) (>= (- t_35_8 t_41_5) 5)))
+(assert (or (>= (- t_63_0 t_35_8) 2) (>= (- t_35_8 t_63_0) 1)))
+(assert (or (>= (- t_74_6 t_35_8) 2) (>= (- t_35_8 t_74_6) 2)))
+(assert (or (>= (- t_82_0 t_35_8) 2) (>= (- t_35_8 t_82_0) 1)))
+(assert (or (>= (- t_91_7 t_35_8) 2) (>= (- t_35_8 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_35_8) 2) (>= (- t_35_8 t_93_6) 4)))
+(assert (or (>= (- t_63_0 t_41_5) 5) (>= (- t_41_5 t_63_0) 1)))
+(assert (or (>= (- t_74_6 t_41_5) 5) (>= (- t_41_5 t_74_6) 2)))
+(assert (or (>= (- t_82_0 t_41_5) 5) (>= (- t_41_5 t_82_0) 1)))
+(assert (or (>= (- t_91_7 t_41_5) 5) (>= (- t_41_5 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_41_5) 5) (>= (- t_41_5 t_93_6) 4)))
+(assert (or (>= (- t_74_6 t_63_0) 1) (>= (- t_63_0 t_74_6) 2)))
+(assert (or (>= (- t_82_0 t_63_0) 1) (>= (- t_63_0 t_82_0) 1)))
+(assert (or (>= (- t_91_7 t_63_0) 1) (>= (- t_63_0 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_63_0) 1) (>= (- t_63_0 t_93_6) 4)))
+(assert (or (>= (- t_82_0 t_74_6) 2) (>= (- t_74_6 t_82_0) 1)))
+(assert (or (>= (- t_91_7 t_74_6) 2) (>= (- t_74_6 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_74_6) 2) (>= (- t_74_6 t_93_6) 4)))
+(assert (or (>= (- t_91_7 t_82_0) 1) (>= (- t_82_0 t_91_7) 4)))
+(assert (or (>= (- t_93_6 t_82_0) 1) (>= (- t_82_0 t_93_6) 4)))
+(assert (or (>= (- t_93_6 t_91_7) 4) (>= (- t_91_7 t_93_6) 4)))
+(assert (or (>= (- t_40_0 t_19_5) 2) (>= (- t_19_5 t_40_0) 5)))
+(assert (or (>= (- t_50_0 t_19_5) 2) (>= (- t_19_5 t_50_0) 4)))
+(assert (or (>= (- t_51_1 t_19_5) 2) (>= (- t_19_5 t_51_1) 3)))
+(assert (or (>= (- t_72_4 t_19_5) 2) (>= (- t_19_5 t_72_4) 1)))
+(assert (or (>= (- t_50_0 t_40_0) 5) (>= (- t_40_0 t_50_0) 4)))
+(assert (or (>= (- t_51_1 t_40_0) 5) (>= (- t_40_0 t_51_1) 3)))
+(assert (or (>= (- t_72_4 t_40_0) 5) (>= (- t_40_0 t_72_4) 1)))
+(assert (or (>= (- t_51_1 t_50_0) 4) (>= (- t_50_0 t_51_1) 3)))
+(assert (or (>= (- t_72_4 t_50_0) 4) (>= (- t_50_0 t_72_4) 1)))
+(assert (or (>= (- t_72_4 t_51_1) 3) (>= (- t_51_1 t_72_4) 1)))
+(assert (or (>= (- t_54_8 t_33_0) 1) (>= (- t_33_0 t_54_8) 2)))
+(assert (or (>= (- t_67_5 t_33_0) 1) (>= (- t_33_0 t_67_5) 4)))
+(assert (or (>= (- t_99_0 t_33_0) 1) (>= (- t_33_0 t_99_0) 5)))
+(assert (or (>= (- t_67_5 t_54_8) 2) (>= (- t_54_8 t_67_5) 4)))
+(assert (or (>= (- t_99_0 t_54_8) 2) (>= (- t_54_8 t_99_0) 5)))
+(assert (or (>= (- t_99_0 t_67_5) 4) (>= (- t_67_5 t_99_0) 5)))
+(assert (or (>= (- t_27_3 t_4_6) 4) (>= (- t_4_6 t_27_3) 2)))
+(assert (or (>= (- t_43_9 t_32_0) 5) (>= (- t_32_0 t_43_9) 2)))
+(assert (or (>= (- t_54_2 t_32_0) 5) (>= (- t_32_0 t_54_2) 2)))
+(assert (or (>= (- t_56_1 t_32_0) 5) (>= (- t_32_0 t_56_1) 3)))
+(assert (or (>= (- t_57_6 t_32_0) 5) (>= (- t_32_0 t_57_6) 3)))
+(assert (or (>= (- t_89_0 t_32_0) 5) (>= (- t_32_0 t_89_0) 3)))
+(assert (or (>= (- t_89_2 t_32_0) 5) (>= (- t_32_0 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_32_0) 5) (>= (- t_32_0 t_94_6) 3)))
+(assert (or (>= (- t_54_2 t_43_9) 2) (>= (- t_43_9 t_54_2) 2)))
+(assert (or (>= (- t_56_1 t_43_9) 2) (>= (- t_43_9 t_56_1) 3)))
+(assert (or (>= (- t_57_6 t_43_9) 2) (>= (- t_43_9 t_57_6) 3)))
+(assert (or (>= (- t_89_0 t_43_9) 2) (>= (- t_43_9 t_89_0) 3)))
+(assert (or (>= (- t_89_2 t_43_9) 2) (>= (- t_43_9 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_43_9) 2) (>= (- t_43_9 t_94_6) 3)))
+(assert (or (>= (- t_56_1 t_54_2) 2) (>= (- t_54_2 t_56_1) 3)))
+(assert (or (>= (- t_57_6 t_54_2) 2) (>= (- t_54_2 t_57_6) 3)))
+(assert (or (>= (- t_89_0 t_54_2) 2) (>= (- t_54_2 t_89_0) 3)))
+(assert (or (>= (- t_89_2 t_54_2) 2) (>= (- t_54_2 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_54_2) 2) (>= (- t_54_2 t_94_6) 3)))
+(assert (or (>= (- t_57_6 t_56_1) 3) (>= (- t_56_1 t_57_6) 3)))
+(assert (or (>= (- t_89_0 t_56_1) 3) (>= (- t_56_1 t_89_0) 3)))
+(assert (or (>= (- t_89_2 t_56_1) 3) (>= (- t_56_1 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_56_1) 3) (>= (- t_56_1 t_94_6) 3)))
+(assert (or (>= (- t_89_0 t_57_6) 3) (>= (- t_57_6 t_89_0) 3)))
+(assert (or (>= (- t_89_2 t_57_6) 3) (>= (- t_57_6 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_57_6) 3) (>= (- t_57_6 t_94_6) 3)))
+(assert (or (>= (- t_89_2 t_89_0) 3) (>= (- t_89_0 t_89_2) 4)))
+(assert (or (>= (- t_94_6 t_89_0) 3) (>= (- t_89_0 t_94_6) 3)))
+(assert (or (>= (- t_94_6 t_89_2) 4) (>= (- t_89_2 t_94_6) 3)))
+(assert (or (>= (- t_9_5 t_6_2) 5) (>= (- t_6_2 t_9_5) 2)))
+(assert (or (>= (- t_98_4 t_6_2) 5) (>= (- t_6_2 t_98_4) 1)))
+(assert (or (>= (- t_98_4 t_9_5) 2) (>= (- t_9_5 t_98_4) 1)))
+(assert (or (>= (- t_38_1 t_27_4) 4) (>= (- t_27_4 t_38_1) 2)))
+(assert (or (>= (- t_54_5 t_27_4) 4) (>= (- t_27_4 t_54_5) 4)))
+(assert (or (>= (- t_54_5 t_38_1) 2) (>= (- t_38_1 t_54_5) 4)))
+(assert (or (>= (- t_48_1 t_43_4) 5) (>= (- t_43_4 t_48_1) 1)))
+(assert (or (>= (- t_50_2 t_43_4) 5) (>= (- t_43_4 t_50_2) 2)))
+(assert (or (>= (- t_62_8 t_43_4) 5) (>= (- t_43_4 t_62_8) 4)))
+(assert (or (>= (- t_71_9 t_43_4) 5) (>= (- t_43_4 t_71_9) 2)))
+(assert (or (>= (- t_80_3 t_43_4) 5) (>= (- t_43_4 t_80_3) 5)))
+(assert (or (>= (- t_50_2 t_48_1) 1) (>= (- t_48_1 t_50_2) 2)))
+(assert (or (>= (- t_62_8 t_48_1) 1) (>= (- t_48_1 t_62_8) 4)))
+(assert (or (>= (- t_71_9 t_48_1) 1) (>= (- t_48_1 t_71_9) 2)))
+(assert (or (>= (- t_80_3 t_48_1) 1) (>= (- t_48_1 t_80_3) 5)))
+(assert (or (>= (- t_62_8 t_50_2) 2) (>= (- t_50_2 t_62_8) 4)))
+(assert (or (>= (- t_71_9 t_50_2) 2) (>= (- t_50_2 t_71_9) 2)))
+(assert (or (>= (- t_80_3 t_50_2) 2) (>= (- t_50_2 t_80_3) 5)))
+(assert (or (>= (- t_71_9 t_62_8) 4) (>= (- t_62_8 t_71_9) 2)))
+(assert (or (>= (- t_80_3 t_62_8) 4) (>= (- t_62_8 t_80_3) 5)))
+(assert (or (>= (- t_80_3 t_71_9) 2) (>= (- t_71_9 t_80_3) 5)))
+(assert (or (>= (- t_4_8 t_2_4) 4) (>= (- t_2_4 t_4_8) 3)))
+(assert (or (>= (- t_17_8 t_2_4) 4) (>= (- t_2_4 t_17_8) 3)))
+(assert (or (>= (- t_35_6 t_2_4) 4) (>= (- t_2_4 t_35_6) 3)))
+(assert (or (>= (- t_47_6 t_2_4) 4) (>= (- t_2_4 t_47_6) 4)))
+(assert (or (>= (- t_70_5 t_2_4) 4) (>= (- t_2_4 t_70_5) 4)))
+(assert (or (>= (- t_73_7 t_2_4) 4) (>= (- t_2_4 t_73_7) 5)))
+(assert (or (>= (- t_17_8 t_4_8) 3) (>= (- t_4_8 t_17_8) 3)))
+(assert (or (>= (- t_35_6 t_4_8) 3) (>= (- t_4_8 t_35_6) 3)))
+(assert (or (>= (- t_47_6 t_4_8) 3) (>= (- t_4_8 t_47_6) 4)))
+(assert (or (>= (- t_70_5 t_4_8) 3) (>= (- t_4_8 t_70_5) 4)))
+(assert (or (>= (- t_73_7 t_4_8) 3) (>= (- t_4_8 t_73_7) 5)))
+(assert (or (>= (- t_35_6 t_17_8) 3) (>= (- t_17_8 t_35_6) 3)))
+(assert (or (>= (- t_47_6 t_17_8) 3) (>= (- t_17_8 t_47_6) 4)))
+(assert (or (>= (- t_70_5 t_17_8) 3) (>= (- t_17_8 t_70_5) 4)))
+(assert (or (>= (- t_73_7 t_17_8) 3) (>= (- t_17_8 t_73_7) 5)))
+(assert (or (>= (- t_47_6 t_35_6) 3) (>= (- t_35_6 t_47_6) 4)))
+(assert (or (>= (- t_70_5 t_35_6) 3) (>= (- t_35_6 t_70_5) 4)))
+(assert (or (>= (- t_73_7 t_35_6) 3) (>= (- t_35_6 t_73_7) 5)))
+(assert (or (>= (- t_70_5 t_47_6) 4) (>= (- t_47_6 t_70_5) 4)))
+(assert (or (>= (- t_73_7 t_47_6) 4) (>= (- t_47_6 t_73_7) 5)))
+(assert (or (>= (- t_73_7 t_70_5) 4) (>= (- t_70_5 t_73_7) 5)))
+(assert (or (>= (- t_11_2 t_0_3) 3) (>= (- t_0_3 t_11_2) 1)))
+(assert (or (>= (- t_18_8 t_0_3) 3) (>= (- t_0_3 t_18_8) 2)))
+(assert (or (>= (- t_25_0 t_0_3) 3) (>= (- t_0_3 t_25_0) 3)))
+(assert (or (>= (- t_36_2 t_0_3) 3) (>= (- t_0_3 t_36_2) 5)))
+(assert (or (>= (- t_40_5 t_0_3) 3) (>= (- t_0_3 t_40_5) 2)))
+(assert (or (>= (- t_55_7 t_0_3) 3) (>= (- t_0_3 t_55_7) 1)))
+(assert (or (>= (- t_18_8 t_11_2) 1) (>= (- t_11_2 t_18_8) 2)))
+(assert (or (>= (- t_25_0 t_11_2) 1) (>= (- t_11_2 t_25_0) 3)))
+(assert (or (>= (- t_36_2 t_11_2) 1) (>= (- t_11_2 t_36_2) 5)))
+(assert (or (>= (- t_40_5 t_11_2) 1) (>= (- t_11_2 t_40_5) 2)))
+(assert (or (>= (- t_55_7 t_11_2) 1) (>= (- t_11_2 t_55_7) 1)))
+(assert (or (>= (- t_25_0 t_18_8) 2) (>= (- t_18_8 t_25_0) 3)))
+(assert (or (>= (- t_36_2 t_18_8) 2) (>= (- t_18_8 t_36_2) 5)))
+(assert (or (>= (- t_40_5 t_18_8) 2) (>= (- t_18_8 t_40_5) 2)))
+(assert (or (>= (- t_55_7 t_18_8) 2) (>= (- t_18_8 t_55_7) 1)))
+(assert (or (>= (- t_36_2 t_25_0) 3) (>= (- t_25_0 t_36_2) 5)))
+(assert (or (>= (- t_40_5 t_25_0) 3) (>= (- t_25_0 t_40_5) 2)))
+(assert (or (>= (- t_55_7 t_25_0) 3) (>= (- t_25_0 t_55_7) 1)))
+(assert (or (>= (- t_40_5 t_36_2) 5) (>= (- t_36_2 t_40_5) 2)))
+(assert (or (>= (- t_55_7 t_36_2) 5) (>= (- t_36_2 t_55_7) 1)))
+(assert (or (>= (- t_55_7 t_40_5) 2) (>= (- t_40_5 t_55_7) 1)))
+(assert (or (>= (- t_49_3 t_16_7) 3) (>= (- t_16_7 t_49_3) 4)))
+(assert (or (>= (- t_49_7 t_16_7) 3) (>= (- t_16_7 t_49_7) 3)))
+(assert (or (>= (- t_67_7 t_16_7) 3) (>= (- t_16_7 t_67_7) 2)))
+(assert (or (>= (- t_49_7 t_49_3) 4) (>= (- t_49_3 t_49_7) 3)))
+(assert (or (>= (- t_67_7 t_49_3) 4) (>= (- t_49_3 t_67_7) 2)))
+(assert (or (>= (- t_67_7 t_49_7) 3) (>= (- t_49_7 t_67_7) 2)))
+(assert (or (>= (- t_68_1 t_50_6) 4) (>= (- t_50_6 t_68_1) 1)))
+(assert (or (>= (- t_69_3 t_50_6) 4) (>= (- t_50_6 t_69_3) 2)))
+(assert (or (>= (- t_92_2 t_50_6) 4) (>= (- t_50_6 t_92_2) 3)))
+(assert (or (>= (- t_69_3 t_68_1) 1) (>= (- t_68_1 t_69_3) 2)))
+(assert (or (>= (- t_92_2 t_68_1) 1) (>= (- t_68_1 t_92_2) 3)))
+(assert (or (>= (- t_92_2 t_69_3) 2) (>= (- t_69_3 t_92_2) 3)))
+(assert (or (>= (- t_20_6 t_20_1) 3) (>= (- t_20_1 t_20_6) 4)))
+(assert (or (>= (- t_28_0 t_20_1) 3) (>= (- t_20_1 t_28_0) 4)))
+(assert (or (>= (- t_63_7 t_20_1) 3) (>= (- t_20_1 t_63_7) 1)))
+(assert (or (>= (- t_65_6 t_20_1) 3) (>= (- t_20_1 t_65_6) 1)))
+(assert (or (>= (- t_77_8 t_20_1) 3) (>= (- t_20_1 t_77_8) 2)))
+(assert (or (>= (- t_84_3 t_20_1) 3) (>= (- t_20_1 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_20_1) 3) (>= (- t_20_1 t_86_9) 3)))
+(assert (or (>= (- t_28_0 t_20_6) 4) (>= (- t_20_6 t_28_0) 4)))
+(assert (or (>= (- t_63_7 t_20_6) 4) (>= (- t_20_6 t_63_7) 1)))
+(assert (or (>= (- t_65_6 t_20_6) 4) (>= (- t_20_6 t_65_6) 1)))
+(assert (or (>= (- t_77_8 t_20_6) 4) (>= (- t_20_6 t_77_8) 2)))
+(assert (or (>= (- t_84_3 t_20_6) 4) (>= (- t_20_6 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_20_6) 4) (>= (- t_20_6 t_86_9) 3)))
+(assert (or (>= (- t_63_7 t_28_0) 4) (>= (- t_28_0 t_63_7) 1)))
+(assert (or (>= (- t_65_6 t_28_0) 4) (>= (- t_28_0 t_65_6) 1)))
+(assert (or (>= (- t_77_8 t_28_0) 4) (>= (- t_28_0 t_77_8) 2)))
+(assert (or (>= (- t_84_3 t_28_0) 4) (>= (- t_28_0 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_28_0) 4) (>= (- t_28_0 t_86_9) 3)))
+(assert (or (>= (- t_65_6 t_63_7) 1) (>= (- t_63_7 t_65_6) 1)))
+(assert (or (>= (- t_77_8 t_63_7) 1) (>= (- t_63_7 t_77_8) 2)))
+(assert (or (>= (- t_84_3 t_63_7) 1) (>= (- t_63_7 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_63_7) 1) (>= (- t_63_7 t_86_9) 3)))
+(assert (or (>= (- t_77_8 t_65_6) 1) (>= (- t_65_6 t_77_8) 2)))
+(assert (or (>= (- t_84_3 t_65_6) 1) (>= (- t_65_6 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_65_6) 1) (>= (- t_65_6 t_86_9) 3)))
+(assert (or (>= (- t_84_3 t_77_8) 2) (>= (- t_77_8 t_84_3) 3)))
+(assert (or (>= (- t_86_9 t_77_8) 2) (>= (- t_77_8 t_86_9) 3)))
+(assert (or (>= (- t_86_9 t_84_3) 3) (>= (- t_84_3 t_86_9) 3)))
+(assert (or (>= (- t_80_4 t_12_3) 1) (>= (- t_12_3 t_80_4) 2)))
+(assert (or (>= (- t_74_2 t_1_3) 4) (>= (- t_1_3 t_74_2) 3)))
+(assert (or (>= (- t_82_6 t_1_3) 4) (>= (- t_1_3 t_82_6) 5)))
+(assert (or (>= (- t_86_3 t_1_3) 4) (>= (- t_1_3 t_86_3) 1)))
+(assert (or (>= (- t_82_6 t_74_2) 3) (>= (- t_74_2 t_82_6) 5)))
+(assert (or (>= (- t_86_3 t_74_2) 3) (>= (- t_74_2 t_86_3) 1)))
+(assert (or (>= (- t_86_3 t_82_6) 5) (>= (- t_82_6 t_86_3) 1)))
+(assert (or (>= (- t_8_0 t_0_8) 2) (>= (- t_0_8 t_8_0) 5)))
+(assert (or (>= (- t_14_1 t_0_8) 2) (>= (- t_0_8 t_14_1) 3)))
+(assert (or (>= (- t_17_9 t_0_8) 2) (>= (- t_0_8 t_17_9) 1)))
+(assert (or (>= (- t_14_1 t_8_0) 5) (>= (- t_8_0 t_14_1) 3)))
+(assert (or (>= (- t_17_9 t_8_0) 5) (>= (- t_8_0 t_17_9) 1)))
+(assert (or (>= (- t_17_9 t_14_1) 3) (>= (- t_14_1 t_17_9) 1)))
+(assert (or (>= (- t_14_8 t_13_2) 5) (>= (- t_13_2 t_14_8) 5)))
+(assert (or (>= (- t_74_9 t_13_2) 5) (>= (- t_13_2 t_74_9) 1)))
+(assert (or (>= (- t_74_9 t_14_8) 5) (>= (- t_14_8 t_74_9) 1)))
+(assert (or (>= (- t_56_3 t_22_2) 4) (>= (- t_22_2 t_56_3) 5)))
+(assert (or (>= (- t_73_6 t_22_2) 4) (>= (- t_22_2 t_73_6) 4)))
+(assert (or (>= (- t_75_7 t_22_2) 4) (>= (- t_22_2 t_75_7) 5)))
+(assert (or (>= (- t_83_0 t_22_2) 4) (>= (- t_22_2 t_83_0) 2)))
+(assert (or (>= (- t_73_6 t_56_3) 5) (>= (- t_56_3 t_73_6) 4)))
+(assert (or (>= (- t_75_7 t_56_3) 5) (>= (- t_56_3 t_75_7) 5)))
+(assert (or (>= (- t_83_0 t_56_3) 5) (>= (- t_56_3 t_83_0) 2)))
+(assert (or (>= (- t_75_7 t_73_6) 4) (>= (- t_73_6 t_75_7) 5)))
+(assert (or (>= (- t_83_0 t_73_6) 4) (>= (- t_73_6 t_83_0) 2)))
+(assert (or (>= (- t_83_0 t_75_7) 5) (>= (- t_75_7 t_83_0) 2)))
+(assert (or (>= (- t_63_5 t_17_1) 3) (>= (- t_17_1 t_63_5) 5)))
+(assert (or (>= (- t_94_7 t_17_1) 3) (>= (- t_17_1 t_94_7) 5)))
+(assert (or (>= (- t_99_8 t_17_1) 3) (>= (- t_17_1 t_99_8) 2)))
+(assert (or (>= (- t_94_7 t_63_5) 5) (>= (- t_63_5 t_94_7) 5)))
+(assert (or (>= (- t_99_8 t_63_5) 5) (>= (- t_63_5 t_99_8) 2)))
+(assert (or (>= (- t_99_8 t_94_7) 5) (>= (- t_94_7 t_99_8) 2)))
+(assert (or (>= (- t_16_3 t_8_9) 5) (>= (- t_8_9 t_16_3) 5)))
+(assert (or (>= (- t_22_5 t_8_9) 5) (>= (- t_8_9 t_22_5) 5)))
+(assert (or (>= (- t_24_3 t_8_9) 5) (>= (- t_8_9 t_24_3) 1)))
+(assert (or (>= (- t_31_1 t_8_9) 5) (>= (- t_8_9 t_31_1) 4)))
+(assert (or (>= (- t_39_9 t_8_9) 5) (>= (- t_8_9 t_39_9) 4)))
+(assert (or (>= (- t_98_7 t_8_9) 5) (>= (- t_8_9 t_98_7) 5)))
+(assert (or (>= (- t_22_5 t_16_3) 5) (>= (- t_16_3 t_22_5) 5)))
+(assert (or (>= (- t_24_3 t_16_3) 5) (>= (- t_16_3 t_24_3) 1)))
+(assert (or (>= (- t_31_1 t_16_3) 5) (>= (- t_16_3 t_31_1) 4)))
+(assert (or (>= (- t_39_9 t_16_3) 5) (>= (- t_16_3 t_39_9) 4)))
+(assert (or (>= (- t_98_7 t_16_3) 5) (>= (- t_16_3 t_98_7) 5)))
+(assert (or (>= (- t_24_3 t_22_5) 5) (>= (- t_22_5 t_24_3) 1)))
+(assert (or (>= (- t_31_1 t_22_5) 5) (>= (- t_22_5 t_31_1) 4)))
+(assert (or (>= (- t_39_9 t_22_5) 5) (>= (- t_22_5 t_39_9) 4)))
+(assert (or (>= (- t_98_7 t_22_5) 5) (>= (- t_22_5 t_98_7) 5)))
+(assert (or (>= (- t_31_1 t_24_3) 1) (>= (- t_24_3 t_31_1) 4)))
+(assert (or (>= (- t_39_9 t_24_3) 1) (>= (- t_24_3 t_39_9) 4)))
+(assert (or (>= (- t_98_7 t_24_3) 1) (>= (- t_24_3 t_98_7) 5)))
+(assert (or (>= (- t_39_9 t_31_1) 4) (>= (- t_31_1 t_39_9) 4)))
+(assert (or (>= (- t_98_7 t_31_1) 4) (>= (- t_31_1 t_98_7) 5)))
+(assert (or (>= (- t_98_7 t_39_9) 4) (>= (- t_39_9 t_98_7) 5)))
+(assert (or (>= (- t_14_4 t_5_8) 4) (>= (- t_5_8 t_14_4) 1)))
+(assert (or (>= (- t_29_1 t_5_8) 4) (>= (- t_5_8 t_29_1) 4)))
+(assert (or (>= (- t_40_7 t_5_8) 4) (>= (- t_5_8 t_40_7) 5)))
+(assert (or (>= (- t_56_8 t_5_8) 4) (>= (- t_5_8 t_56_8) 2)))
+(assert (or (>= (- t_67_2 t_5_8) 4) (>= (- t_5_8 t_67_2) 2)))
+(assert (or (>= (- t_29_1 t_14_4) 1) (>= (- t_14_4 t_29_1) 4)))
+(assert (or (>= (- t_40_7 t_14_4) 1) (>= (- t_14_4 t_40_7) 5)))
+(assert (or (>= (- t_56_8 t_14_4) 1) (>= (- t_14_4 t_56_8) 2)))
+(assert (or (>= (- t_67_2 t_14_4) 1) (>= (- t_14_4 t_67_2) 2)))
+(assert (or (>= (- t_40_7 t_29_1) 4) (>= (- t_29_1 t_40_7) 5)))
+(assert (or (>= (- t_56_8 t_29_1) 4) (>= (- t_29_1 t_56_8) 2)))
+(assert (or (>= (- t_67_2 t_29_1) 4) (>= (- t_29_1 t_67_2) 2)))
+(assert (or (>= (- t_56_8 t_40_7) 5) (>= (- t_40_7 t_56_8) 2)))
+(assert (or (>= (- t_67_2 t_40_7) 5) (>= (- t_40_7 t_67_2) 2)))
+(assert (or (>= (- t_67_2 t_56_8) 2) (>= (- t_56_8 t_67_2) 2)))
+(assert (or (>= (- t_8_2 t_4_1) 3) (>= (- t_4_1 t_8_2) 5)))
+(assert (or (>= (- t_19_8 t_4_1) 3) (>= (- t_4_1 t_19_8) 3)))
+(assert (or (>= (- t_23_3 t_4_1) 3) (>= (- t_4_1 t_23_3) 5)))
+(assert (or (>= (- t_41_1 t_4_1) 3) (>= (- t_4_1 t_41_1) 4)))
+(assert (or (>= (- t_68_9 t_4_1) 3) (>= (- t_4_1 t_68_9) 5)))
+(assert (or (>= (- t_74_0 t_4_1) 3) (>= (- t_4_1 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_4_1) 3) (>= (- t_4_1 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_4_1) 3) (>= (- t_4_1 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_4_1) 3) (>= (- t_4_1 t_97_3) 3)))
+(assert (or (>= (- t_19_8 t_8_2) 5) (>= (- t_8_2 t_19_8) 3)))
+(assert (or (>= (- t_23_3 t_8_2) 5) (>= (- t_8_2 t_23_3) 5)))
+(assert (or (>= (- t_41_1 t_8_2) 5) (>= (- t_8_2 t_41_1) 4)))
+(assert (or (>= (- t_68_9 t_8_2) 5) (>= (- t_8_2 t_68_9) 5)))
+(assert (or (>= (- t_74_0 t_8_2) 5) (>= (- t_8_2 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_8_2) 5) (>= (- t_8_2 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_8_2) 5) (>= (- t_8_2 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_8_2) 5) (>= (- t_8_2 t_97_3) 3)))
+(assert (or (>= (- t_23_3 t_19_8) 3) (>= (- t_19_8 t_23_3) 5)))
+(assert (or (>= (- t_41_1 t_19_8) 3) (>= (- t_19_8 t_41_1) 4)))
+(assert (or (>= (- t_68_9 t_19_8) 3) (>= (- t_19_8 t_68_9) 5)))
+(assert (or (>= (- t_74_0 t_19_8) 3) (>= (- t_19_8 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_19_8) 3) (>= (- t_19_8 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_19_8) 3) (>= (- t_19_8 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_19_8) 3) (>= (- t_19_8 t_97_3) 3)))
+(assert (or (>= (- t_41_1 t_23_3) 5) (>= (- t_23_3 t_41_1) 4)))
+(assert (or (>= (- t_68_9 t_23_3) 5) (>= (- t_23_3 t_68_9) 5)))
+(assert (or (>= (- t_74_0 t_23_3) 5) (>= (- t_23_3 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_23_3) 5) (>= (- t_23_3 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_23_3) 5) (>= (- t_23_3 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_23_3) 5) (>= (- t_23_3 t_97_3) 3)))
+(assert (or (>= (- t_68_9 t_41_1) 4) (>= (- t_41_1 t_68_9) 5)))
+(assert (or (>= (- t_74_0 t_41_1) 4) (>= (- t_41_1 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_41_1) 4) (>= (- t_41_1 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_41_1) 4) (>= (- t_41_1 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_41_1) 4) (>= (- t_41_1 t_97_3) 3)))
+(assert (or (>= (- t_74_0 t_68_9) 5) (>= (- t_68_9 t_74_0) 2)))
+(assert (or (>= (- t_75_1 t_68_9) 5) (>= (- t_68_9 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_68_9) 5) (>= (- t_68_9 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_68_9) 5) (>= (- t_68_9 t_97_3) 3)))
+(assert (or (>= (- t_75_1 t_74_0) 2) (>= (- t_74_0 t_75_1) 3)))
+(assert (or (>= (- t_86_4 t_74_0) 2) (>= (- t_74_0 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_74_0) 2) (>= (- t_74_0 t_97_3) 3)))
+(assert (or (>= (- t_86_4 t_75_1) 3) (>= (- t_75_1 t_86_4) 4)))
+(assert (or (>= (- t_97_3 t_75_1) 3) (>= (- t_75_1 t_97_3) 3)))
+(assert (or (>= (- t_97_3 t_86_4) 4) (>= (- t_86_4 t_97_3) 3)))
+(assert (or (>= (- t_80_6 t_34_4) 4) (>= (- t_34_4 t_80_6) 2)))
+(assert (or (>= (- t_3_8 t_2_5) 3) (>= (- t_2_5 t_3_8) 2)))
+(assert (or (>= (- t_95_4 t_2_5) 3) (>= (- t_2_5 t_95_4) 4)))
+(assert (or (>= (- t_95_4 t_3_8) 2) (>= (- t_3_8 t_95_4) 4)))
+(assert (or (>= (- t_39_7 t_29_3) 1) (>= (- t_29_3 t_39_7) 2)))
+(assert (or (>= (- t_66_4 t_29_3) 1) (>= (- t_29_3 t_66_4) 1)))
+(assert (or (>= (- t_70_3 t_29_3) 1) (>= (- t_29_3 t_70_3) 4)))
+(assert (or (>= (- t_75_2 t_29_3) 1) (>= (- t_29_3 t_75_2) 2)))
+(assert (or (>= (- t_66_4 t_39_7) 2) (>= (- t_39_7 t_66_4) 1)))
+(assert (or (>= (- t_70_3 t_39_7) 2) (>= (- t_39_7 t_70_3) 4)))
+(assert (or (>= (- t_75_2 t_39_7) 2) (>= (- t_39_7 t_75_2) 2)))
+(assert (or (>= (- t_70_3 t_66_4) 1) (>= (- t_66_4 t_70_3) 4)))
+(assert (or (>= (- t_75_2 t_66_4) 1) (>= (- t_66_4 t_75_2) 2)))
+(assert (or (>= (- t_75_2 t_70_3) 4) (>= (- t_70_3 t_75_2) 2)))
+(assert (or (>= (- t_16_6 t_2_2) 1) (>= (- t_2_2 t_16_6) 5)))
+(assert (or (>= (- t_23_7 t_2_2) 1) (>= (- t_2_2 t_23_7) 5)))
+(assert (or (>= (- t_32_6 t_2_2) 1) (>= (- t_2_2 t_32_6) 5)))
+(assert (or (>= (- t_51_4 t_2_2) 1) (>= (- t_2_2 t_51_4) 2)))
+(assert (or (>= (- t_23_7 t_16_6) 5) (>= (- t_16_6 t_23_7) 5)))
+(assert (or (>= (- t_32_6 t_16_6) 5) (>= (- t_16_6 t_32_6) 5)))
+(assert (or (>= (- t_51_4 t_16_6) 5) (>= (- t_16_6 t_51_4) 2)))
+(assert (or (>= (- t_32_6 t_23_7) 5) (>= (- t_23_7 t_32_6) 5)))
+(assert (or (>= (- t_51_4 t_23_7) 5) (>= (- t_23_7 t_51_4) 2)))
+(assert (or (>= (- t_51_4 t_32_6) 5) (>= (- t_32_6 t_51_4) 2)))
+(assert (or (>= (- t_65_5 t_26_1) 4) (>= (- t_26_1 t_65_5) 2)))
+(assert (or (>= (- t_84_2 t_26_1) 4) (>= (- t_26_1 t_84_2) 5)))
+(assert (or (>= (- t_89_3 t_26_1) 4) (>= (- t_26_1 t_89_3) 5)))
+(assert (or (>= (- t_92_9 t_26_1) 4) (>= (- t_26_1 t_92_9) 5)))
+(assert (or (>= (- t_84_2 t_65_5) 2) (>= (- t_65_5 t_84_2) 5)))
+(assert (or (>= (- t_89_3 t_65_5) 2) (>= (- t_65_5 t_89_3) 5)))
+(assert (or (>= (- t_92_9 t_65_5) 2) (>= (- t_65_5 t_92_9) 5)))
+(assert (or (>= (- t_89_3 t_84_2) 5) (>= (- t_84_2 t_89_3) 5)))
+(assert (or (>= (- t_92_9 t_84_2) 5) (>= (- t_84_2 t_92_9) 5)))
+(assert (or (>= (- t_92_9 t_89_3) 5) (>= (- t_89_3 t_92_9) 5)))
+(assert (or (>= (- t_11_5 t_0_9) 5) (>= (- t_0_9 t_11_5) 2)))
+(assert (or (>= (- t_29_6 t_0_9) 5) (>= (- t_0_9 t_29_6) 4)))
+(assert (or (>= (- t_45_3 t_0_9) 5) (>= (- t_0_9 t_45_3) 1)))
+(assert (or (>= (- t_56_7 t_0_9) 5) (>= (- t_0_9 t_56_7) 4)))
+(assert (or (>= (- t_58_0 t_0_9) 5) (>= (- t_0_9 t_58_0) 3)))
+(assert (or (>= (- t_69_5 t_0_9) 5) (>= (- t_0_9 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_0_9) 5) (>= (- t_0_9 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_0_9) 5) (>= (- t_0_9 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_0_9) 5) (>= (- t_0_9 t_74_8) 2)))
+(assert (or (>= (- t_29_6 t_11_5) 2) (>= (- t_11_5 t_29_6) 4)))
+(assert (or (>= (- t_45_3 t_11_5) 2) (>= (- t_11_5 t_45_3) 1)))
+(assert (or (>= (- t_56_7 t_11_5) 2) (>= (- t_11_5 t_56_7) 4)))
+(assert (or (>= (- t_58_0 t_11_5) 2) (>= (- t_11_5 t_58_0) 3)))
+(assert (or (>= (- t_69_5 t_11_5) 2) (>= (- t_11_5 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_11_5) 2) (>= (- t_11_5 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_11_5) 2) (>= (- t_11_5 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_11_5) 2) (>= (- t_11_5 t_74_8) 2)))
+(assert (or (>= (- t_45_3 t_29_6) 4) (>= (- t_29_6 t_45_3) 1)))
+(assert (or (>= (- t_56_7 t_29_6) 4) (>= (- t_29_6 t_56_7) 4)))
+(assert (or (>= (- t_58_0 t_29_6) 4) (>= (- t_29_6 t_58_0) 3)))
+(assert (or (>= (- t_69_5 t_29_6) 4) (>= (- t_29_6 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_29_6) 4) (>= (- t_29_6 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_29_6) 4) (>= (- t_29_6 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_29_6) 4) (>= (- t_29_6 t_74_8) 2)))
+(assert (or (>= (- t_56_7 t_45_3) 1) (>= (- t_45_3 t_56_7) 4)))
+(assert (or (>= (- t_58_0 t_45_3) 1) (>= (- t_45_3 t_58_0) 3)))
+(assert (or (>= (- t_69_5 t_45_3) 1) (>= (- t_45_3 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_45_3) 1) (>= (- t_45_3 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_45_3) 1) (>= (- t_45_3 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_45_3) 1) (>= (- t_45_3 t_74_8) 2)))
+(assert (or (>= (- t_58_0 t_56_7) 4) (>= (- t_56_7 t_58_0) 3)))
+(assert (or (>= (- t_69_5 t_56_7) 4) (>= (- t_56_7 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_56_7) 4) (>= (- t_56_7 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_56_7) 4) (>= (- t_56_7 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_56_7) 4) (>= (- t_56_7 t_74_8) 2)))
+(assert (or (>= (- t_69_5 t_58_0) 3) (>= (- t_58_0 t_69_5) 1)))
+(assert (or (>= (- t_70_1 t_58_0) 3) (>= (- t_58_0 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_58_0) 3) (>= (- t_58_0 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_58_0) 3) (>= (- t_58_0 t_74_8) 2)))
+(assert (or (>= (- t_70_1 t_69_5) 1) (>= (- t_69_5 t_70_1) 3)))
+(assert (or (>= (- t_74_4 t_69_5) 1) (>= (- t_69_5 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_69_5) 1) (>= (- t_69_5 t_74_8) 2)))
+(assert (or (>= (- t_74_4 t_70_1) 3) (>= (- t_70_1 t_74_4) 2)))
+(assert (or (>= (- t_74_8 t_70_1) 3) (>= (- t_70_1 t_74_8) 2)))
+(assert (or (>= (- t_74_8 t_74_4) 2) (>= (- t_74_4 t_74_8) 2)))
+(assert (or (>= (- t_16_2 t_10_1) 5) (>= (- t_10_1 t_16_2) 5)))
+(assert (or (>= (- t_19_6 t_10_1) 5) (>= (- t_10_1 t_19_6) 5)))
+(assert (or (>= (- t_21_6 t_10_1) 5) (>= (- t_10_1 t_21_6) 2)))
+(assert (or (>= (- t_37_4 t_10_1) 5) (>= (- t_10_1 t_37_4) 3)))
+(assert (or (>= (- t_62_7 t_10_1) 5) (>= (- t_10_1 t_62_7) 5)))
+(assert (or (>= (- t_76_7 t_10_1) 5) (>= (- t_10_1 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_10_1) 5) (>= (- t_10_1 t_97_4) 1)))
+(assert (or (>= (- t_19_6 t_16_2) 5) (>= (- t_16_2 t_19_6) 5)))
+(assert (or (>= (- t_21_6 t_16_2) 5) (>= (- t_16_2 t_21_6) 2)))
+(assert (or (>= (- t_37_4 t_16_2) 5) (>= (- t_16_2 t_37_4) 3)))
+(assert (or (>= (- t_62_7 t_16_2) 5) (>= (- t_16_2 t_62_7) 5)))
+(assert (or (>= (- t_76_7 t_16_2) 5) (>= (- t_16_2 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_16_2) 5) (>= (- t_16_2 t_97_4) 1)))
+(assert (or (>= (- t_21_6 t_19_6) 5) (>= (- t_19_6 t_21_6) 2)))
+(assert (or (>= (- t_37_4 t_19_6) 5) (>= (- t_19_6 t_37_4) 3)))
+(assert (or (>= (- t_62_7 t_19_6) 5) (>= (- t_19_6 t_62_7) 5)))
+(assert (or (>= (- t_76_7 t_19_6) 5) (>= (- t_19_6 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_19_6) 5) (>= (- t_19_6 t_97_4) 1)))
+(assert (or (>= (- t_37_4 t_21_6) 2) (>= (- t_21_6 t_37_4) 3)))
+(assert (or (>= (- t_62_7 t_21_6) 2) (>= (- t_21_6 t_62_7) 5)))
+(assert (or (>= (- t_76_7 t_21_6) 2) (>= (- t_21_6 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_21_6) 2) (>= (- t_21_6 t_97_4) 1)))
+(assert (or (>= (- t_62_7 t_37_4) 3) (>= (- t_37_4 t_62_7) 5)))
+(assert (or (>= (- t_76_7 t_37_4) 3) (>= (- t_37_4 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_37_4) 3) (>= (- t_37_4 t_97_4) 1)))
+(assert (or (>= (- t_76_7 t_62_7) 5) (>= (- t_62_7 t_76_7) 2)))
+(assert (or (>= (- t_97_4 t_62_7) 5) (>= (- t_62_7 t_97_4) 1)))
+(assert (or (>= (- t_97_4 t_76_7) 2) (>= (- t_76_7 t_97_4) 1)))
+(assert (or (>= (- t_38_0 t_7_5) 3) (>= (- t_7_5 t_38_0) 5)))
+(assert (or (>= (- t_49_0 t_7_5) 3) (>= (- t_7_5 t_49_0) 1)))
+(assert (or (>= (- t_60_1 t_7_5) 3) (>= (- t_7_5 t_60_1) 5)))
+(assert (or (>= (- t_72_1 t_7_5) 3) (>= (- t_7_5 t_72_1) 2)))
+(assert (or (>= (- t_83_8 t_7_5) 3) (>= (- t_7_5 t_83_8) 4)))
+(assert (or (>= (- t_87_7 t_7_5) 3) (>= (- t_7_5 t_87_7) 5)))
+(assert (or (>= (- t_49_0 t_38_0) 5) (>= (- t_38_0 t_49_0) 1)))
+(assert (or (>= (- t_60_1 t_38_0) 5) (>= (- t_38_0 t_60_1) 5)))
+(assert (or (>= (- t_72_1 t_38_0) 5) (>= (- t_38_0 t_72_1) 2)))
+(assert (or (>= (- t_83_8 t_38_0) 5) (>= (- t_38_0 t_83_8) 4)))
+(assert (or (>= (- t_87_7 t_38_0) 5) (>= (- t_38_0 t_87_7) 5)))
+(assert (or (>= (- t_60_1 t_49_0) 1) (>= (- t_49_0 t_60_1) 5)))
+(assert (or (>= (- t_72_1 t_49_0) 1) (>= (- t_49_0 t_72_1) 2)))
+(assert (or (>= (- t_83_8 t_49_0) 1) (>= (- t_49_0 t_83_8) 4)))
+(assert (or (>= (- t_87_7 t_49_0) 1) (>= (- t_49_0 t_87_7) 5)))
+(assert (or (>= (- t_72_1 t_60_1) 5) (>= (- t_60_1 t_72_1) 2)))
+(assert (or (>= (- t_83_8 t_60_1) 5) (>= (- t_60_1 t_83_8) 4)))
+(assert (or (>= (- t_87_7 t_60_1) 5) (>= (- t_60_1 t_87_7) 5)))
+(assert (or (>= (- t_83_8 t_72_1) 2) (>= (- t_72_1 t_83_8) 4)))
+(assert (or (>= (- t_87_7 t_72_1) 2) (>= (- t_72_1 t_87_7) 5)))
+(assert (or (>= (- t_87_7 t_83_8) 4) (>= (- t_83_8 t_87_7) 5)))
+(assert (or (>= (- t_37_5 t_7_6) 4) (>= (- t_7_6 t_37_5) 5)))
+(assert (or (>= (- t_38_6 t_7_6) 4) (>= (- t_7_6 t_38_6) 4)))
+(assert (or (>= (- t_61_3 t_7_6) 4) (>= (- t_7_6 t_61_3) 3)))
+(assert (or (>= (- t_66_5 t_7_6) 4) (>= (- t_7_6 t_66_5) 1)))
+(assert (or (>= (- t_73_4 t_7_6) 4) (>= (- t_7_6 t_73_4) 1)))
+(assert (or (>= (- t_89_6 t_7_6) 4) (>= (- t_7_6 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_7_6) 4) (>= (- t_7_6 t_98_2) 1)))
+(assert (or (>= (- t_38_6 t_37_5) 5) (>= (- t_37_5 t_38_6) 4)))
+(assert (or (>= (- t_61_3 t_37_5) 5) (>= (- t_37_5 t_61_3) 3)))
+(assert (or (>= (- t_66_5 t_37_5) 5) (>= (- t_37_5 t_66_5) 1)))
+(assert (or (>= (- t_73_4 t_37_5) 5) (>= (- t_37_5 t_73_4) 1)))
+(assert (or (>= (- t_89_6 t_37_5) 5) (>= (- t_37_5 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_37_5) 5) (>= (- t_37_5 t_98_2) 1)))
+(assert (or (>= (- t_61_3 t_38_6) 4) (>= (- t_38_6 t_61_3) 3)))
+(assert (or (>= (- t_66_5 t_38_6) 4) (>= (- t_38_6 t_66_5) 1)))
+(assert (or (>= (- t_73_4 t_38_6) 4) (>= (- t_38_6 t_73_4) 1)))
+(assert (or (>= (- t_89_6 t_38_6) 4) (>= (- t_38_6 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_38_6) 4) (>= (- t_38_6 t_98_2) 1)))
+(assert (or (>= (- t_66_5 t_61_3) 3) (>= (- t_61_3 t_66_5) 1)))
+(assert (or (>= (- t_73_4 t_61_3) 3) (>= (- t_61_3 t_73_4) 1)))
+(assert (or (>= (- t_89_6 t_61_3) 3) (>= (- t_61_3 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_61_3) 3) (>= (- t_61_3 t_98_2) 1)))
+(assert (or (>= (- t_73_4 t_66_5) 1) (>= (- t_66_5 t_73_4) 1)))
+(assert (or (>= (- t_89_6 t_66_5) 1) (>= (- t_66_5 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_66_5) 1) (>= (- t_66_5 t_98_2) 1)))
+(assert (or (>= (- t_89_6 t_73_4) 1) (>= (- t_73_4 t_89_6) 2)))
+(assert (or (>= (- t_98_2 t_73_4) 1) (>= (- t_73_4 t_98_2) 1)))
+(assert (or (>= (- t_98_2 t_89_6) 2) (>= (- t_89_6 t_98_2) 1)))
+(assert (or (>= (- t_34_0 t_6_0) 4) (>= (- t_6_0 t_34_0) 3)))
+(assert (or (>= (- t_41_0 t_6_0) 4) (>= (- t_6_0 t_41_0) 5)))
+(assert (or (>= (- t_72_7 t_6_0) 4) (>= (- t_6_0 t_72_7) 2)))
+(assert (or (>= (- t_41_0 t_34_0) 3) (>= (- t_34_0 t_41_0) 5)))
+(assert (or (>= (- t_72_7 t_34_0) 3) (>= (- t_34_0 t_72_7) 2)))
+(assert (or (>= (- t_72_7 t_41_0) 5) (>= (- t_41_0 t_72_7) 2)))
+(assert (or (>= (- t_12_0 t_10_0) 3) (>= (- t_10_0 t_12_0) 1)))
+(assert (or (>= (- t_37_0 t_10_0) 3) (>= (- t_10_0 t_37_0) 4)))
+(assert (or (>= (- t_66_2 t_10_0) 3) (>= (- t_10_0 t_66_2) 5)))
+(assert (or (>= (- t_88_6 t_10_0) 3) (>= (- t_10_0 t_88_6) 3)))
+(assert (or (>= (- t_37_0 t_12_0) 1) (>= (- t_12_0 t_37_0) 4)))
+(assert (or (>= (- t_66_2 t_12_0) 1) (>= (- t_12_0 t_66_2) 5)))
+(assert (or (>= (- t_88_6 t_12_0) 1) (>= (- t_12_0 t_88_6) 3)))
+(assert (or (>= (- t_66_2 t_37_0) 4) (>= (- t_37_0 t_66_2) 5)))
+(assert (or (>= (- t_88_6 t_37_0) 4) (>= (- t_37_0 t_88_6) 3)))
+(assert (or (>= (- t_88_6 t_66_2) 5) (>= (- t_66_2 t_88_6) 3)))
+(assert (or (>= (- t_63_3 t_11_8) 1) (>= (- t_11_8 t_63_3) 2)))
+(assert (or (>= (- t_66_3 t_11_8) 1) (>= (- t_11_8 t_66_3) 5)))
+(assert (or (>= (- t_68_5 t_11_8) 1) (>= (- t_11_8 t_68_5) 5)))
+(assert (or (>= (- t_83_6 t_11_8) 1) (>= (- t_11_8 t_83_6) 3)))
+(assert (or (>= (- t_66_3 t_63_3) 2) (>= (- t_63_3 t_66_3) 5)))
+(assert (or (>= (- t_68_5 t_63_3) 2) (>= (- t_63_3 t_68_5) 5)))
+(assert (or (>= (- t_83_6 t_63_3) 2) (>= (- t_63_3 t_83_6) 3)))
+(assert (or (>= (- t_68_5 t_66_3) 5) (>= (- t_66_3 t_68_5) 5)))
+(assert (or (>= (- t_83_6 t_66_3) 5) (>= (- t_66_3 t_83_6) 3)))
+(assert (or (>= (- t_83_6 t_68_5) 5) (>= (- t_68_5 t_83_6) 3)))
+(assert (or (>= (- t_42_3 t_41_2) 4) (>= (- t_41_2 t_42_3) 5)))
+(assert (or (>= (- t_59_3 t_41_2) 4) (>= (- t_41_2 t_59_3) 2)))
+(assert (or (>= (- t_84_8 t_41_2) 4) (>= (- t_41_2 t_84_8) 5)))
+(assert (or (>= (- t_94_2 t_41_2) 4) (>= (- t_41_2 t_94_2) 1)))
+(assert (or (>= (- t_59_3 t_42_3) 5) (>= (- t_42_3 t_59_3) 2)))
+(assert (or (>= (- t_84_8 t_42_3) 5) (>= (- t_42_3 t_84_8) 5)))
+(assert (or (>= (- t_94_2 t_42_3) 5) (>= (- t_42_3 t_94_2) 1)))
+(assert (or (>= (- t_84_8 t_59_3) 2) (>= (- t_59_3 t_84_8) 5)))
+(assert (or (>= (- t_94_2 t_59_3) 2) (>= (- t_59_3 t_94_2) 1)))
+(assert (or (>= (- t_94_2 t_84_8) 5) (>= (- t_84_8 t_94_2) 1)))
+(assert (or (>= (- t_33_7 t_21_8) 1) (>= (- t_21_8 t_33_7) 4)))
+(assert (or (>= (- t_35_7 t_21_8) 1) (>= (- t_21_8 t_35_7) 5)))
+(assert (or (>= (- t_42_1 t_21_8) 1) (>= (- t_21_8 t_42_1) 1)))
+(assert (or (>= (- t_53_9 t_21_8) 1) (>= (- t_21_8 t_53_9) 3)))
+(assert (or (>= (- t_90_8 t_21_8) 1) (>= (- t_21_8 t_90_8) 1)))
+(assert (or (>= (- t_92_5 t_21_8) 1) (>= (- t_21_8 t_92_5) 5)))
+(assert (or (>= (- t_35_7 t_33_7) 4) (>= (- t_33_7 t_35_7) 5)))
+(assert (or (>= (- t_42_1 t_33_7) 4) (>= (- t_33_7 t_42_1) 1)))
+(assert (or (>= (- t_53_9 t_33_7) 4) (>= (- t_33_7 t_53_9) 3)))
+(assert (or (>= (- t_90_8 t_33_7) 4) (>= (- t_33_7 t_90_8) 1)))
+(assert (or (>= (- t_92_5 t_33_7) 4) (>= (- t_33_7 t_92_5) 5)))
+(assert (or (>= (- t_42_1 t_35_7) 5) (>= (- t_35_7 t_42_1) 1)))
+(assert (or (>= (- t_53_9 t_35_7) 5) (>= (- t_35_7 t_53_9) 3)))
+(assert (or (>= (- t_90_8 t_35_7) 5) (>= (- t_35_7 t_90_8) 1)))
+(assert (or (>= (- t_92_5 t_35_7) 5) (>= (- t_35_7 t_92_5) 5)))
+(assert (or (>= (- t_53_9 t_42_1) 1) (>= (- t_42_1 t_53_9) 3)))
+(assert (or (>= (- t_90_8 t_42_1) 1) (>= (- t_42_1 t_90_8) 1)))
+(assert (or (>= (- t_92_5 t_42_1) 1) (>= (- t_42_1 t_92_5) 5)))
+(assert (or (>= (- t_90_8 t_53_9) 3) (>= (- t_53_9 t_90_8) 1)))
+(assert (or (>= (- t_92_5 t_53_9) 3) (>= (- t_53_9 t_92_5) 5)))
+(assert (or (>= (- t_92_5 t_90_8) 1) (>= (- t_90_8 t_92_5) 5)))
+(assert (or (>= (- t_62_6 t_60_6) 4) (>= (- t_60_6 t_62_6) 4)))
+(assert (or (>= (- t_68_7 t_60_6) 4) (>= (- t_60_6 t_68_7) 4)))
+(assert (or (>= (- t_83_3 t_60_6) 4) (>= (- t_60_6 t_83_3) 1)))
+(assert (or (>= (- t_68_7 t_62_6) 4) (>= (- t_62_6 t_68_7) 4)))
+(assert (or (>= (- t_83_3 t_62_6) 4) (>= (- t_62_6 t_83_3) 1)))
+(assert (or (>= (- t_83_3 t_68_7) 4) (>= (- t_68_7 t_83_3) 1)))
+(assert (or (>= (- t_7_2 t_5_0) 3) (>= (- t_5_0 t_7_2) 3)))
+(assert (or (>= (- t_38_9 t_5_0) 3) (>= (- t_5_0 t_38_9) 2)))
+(assert (or (>= (- t_92_6 t_5_0) 3) (>= (- t_5_0 t_92_6) 3)))
+(assert (or (>= (- t_96_1 t_5_0) 3) (>= (- t_5_0 t_96_1) 1)))
+(assert (or (>= (- t_38_9 t_7_2) 3) (>= (- t_7_2 t_38_9) 2)))
+(assert (or (>= (- t_92_6 t_7_2) 3) (>= (- t_7_2 t_92_6) 3)))
+(assert (or (>= (- t_96_1 t_7_2) 3) (>= (- t_7_2 t_96_1) 1)))
+(assert (or (>= (- t_92_6 t_38_9) 2) (>= (- t_38_9 t_92_6) 3)))
+(assert (or (>= (- t_96_1 t_38_9) 2) (>= (- t_38_9 t_96_1) 1)))
+(assert (or (>= (- t_96_1 t_92_6) 3) (>= (- t_92_6 t_96_1) 1)))
+(assert (or (>= (- t_49_8 t_46_2) 4) (>= (- t_46_2 t_49_8) 1)))
+(assert (or (>= (- t_60_5 t_46_2) 4) (>= (- t_46_2 t_60_5) 5)))
+(assert (or (>= (- t_63_6 t_46_2) 4) (>= (- t_46_2 t_63_6) 2)))
+(assert (or (>= (- t_69_9 t_46_2) 4) (>= (- t_46_2 t_69_9) 4)))
+(assert (or (>= (- t_91_1 t_46_2) 4) (>= (- t_46_2 t_91_1) 3)))
+(assert (or (>= (- t_60_5 t_49_8) 1) (>= (- t_49_8 t_60_5) 5)))
+(assert (or (>= (- t_63_6 t_49_8) 1) (>= (- t_49_8 t_63_6) 2)))
+(assert (or (>= (- t_69_9 t_49_8) 1) (>= (- t_49_8 t_69_9) 4)))
+(assert (or (>= (- t_91_1 t_49_8) 1) (>= (- t_49_8 t_91_1) 3)))
+(assert (or (>= (- t_63_6 t_60_5) 5) (>= (- t_60_5 t_63_6) 2)))
+(assert (or (>= (- t_69_9 t_60_5) 5) (>= (- t_60_5 t_69_9) 4)))
+(assert (or (>= (- t_91_1 t_60_5) 5) (>= (- t_60_5 t_91_1) 3)))
+(assert (or (>= (- t_69_9 t_63_6) 2) (>= (- t_63_6 t_69_9) 4)))
+(assert (or (>= (- t_91_1 t_63_6) 2) (>= (- t_63_6 t_91_1) 3)))
+(assert (or (>= (- t_91_1 t_69_9) 4) (>= (- t_69_9 t_91_1) 3)))
+(assert (or (>= (- t_71_0 t_61_0) 4) (>= (- t_61_0 t_71_0) 1)))
+(assert (or (>= (- t_85_1 t_61_0) 4) (>= (- t_61_0 t_85_1) 5)))
+(assert (or (>= (- t_88_8 t_61_0) 4) (>= (- t_61_0 t_88_8) 3)))
+(assert (or (>= (- t_85_1 t_71_0) 1) (>= (- t_71_0 t_85_1) 5)))
+(assert (or (>= (- t_88_8 t_71_0) 1) (>= (- t_71_0 t_88_8) 3)))
+(assert (or (>= (- t_88_8 t_85_1) 5) (>= (- t_85_1 t_88_8) 3)))
+(assert (or (>= (- t_28_5 t_9_2) 1) (>= (- t_9_2 t_28_5) 3)))
+(assert (or (>= (- t_29_5 t_22_1) 5) (>= (- t_22_1 t_29_5) 5)))
+(assert (or (>= (- t_40_1 t_22_1) 5) (>= (- t_22_1 t_40_1) 2)))
+(assert (or (>= (- t_84_6 t_22_1) 5) (>= (- t_22_1 t_84_6) 5)))
+(assert (or (>= (- t_91_8 t_22_1) 5) (>= (- t_22_1 t_91_8) 2)))
+(assert (or (>= (- t_40_1 t_29_5) 5) (>= (- t_29_5 t_40_1) 2)))
+(assert (or (>= (- t_84_6 t_29_5) 5) (>= (- t_29_5 t_84_6) 5)))
+(assert (or (>= (- t_91_8 t_29_5) 5) (>= (- t_29_5 t_91_8) 2)))
+(assert (or (>= (- t_84_6 t_40_1) 2) (>= (- t_40_1 t_84_6) 5)))
+(assert (or (>= (- t_91_8 t_40_1) 2) (>= (- t_40_1 t_91_8) 2)))
+(assert (or (>= (- t_91_8 t_84_6) 5) (>= (- t_84_6 t_91_8) 2)))
+(assert (or (>= (- t_23_0 t_1_9) 5) (>= (- t_1_9 t_23_0) 4)))
+(assert (or (>= (- t_92_8 t_1_9) 5) (>= (- t_1_9 t_92_8) 1)))
+(assert (or (>= (- t_94_4 t_1_9) 5) (>= (- t_1_9 t_94_4) 4)))
+(assert (or (>= (- t_92_8 t_23_0) 4) (>= (- t_23_0 t_92_8) 1)))
+(assert (or (>= (- t_94_4 t_23_0) 4) (>= (- t_23_0 t_94_4) 4)))
+(assert (or (>= (- t_94_4 t_92_8) 1) (>= (- t_92_8 t_94_4) 4)))
+(assert (or (>= (- t_15_6 t_10_6) 3) (>= (- t_10_6 t_15_6) 1)))
+(assert (or (>= (- t_26_9 t_10_6) 3) (>= (- t_10_6 t_26_9) 1)))
+(assert (or (>= (- t_41_3 t_10_6) 3) (>= (- t_10_6 t_41_3) 3)))
+(assert (or (>= (- t_88_7 t_10_6) 3) (>= (- t_10_6 t_88_7) 1)))
+(assert (or (>= (- t_26_9 t_15_6) 1) (>= (- t_15_6 t_26_9) 1)))
+(assert (or (>= (- t_41_3 t_15_6) 1) (>= (- t_15_6 t_41_3) 3)))
+(assert (or (>= (- t_88_7 t_15_6) 1) (>= (- t_15_6 t_88_7) 1)))
+(assert (or (>= (- t_41_3 t_26_9) 1) (>= (- t_26_9 t_41_3) 3)))
+(assert (or (>= (- t_88_7 t_26_9) 1) (>= (- t_26_9 t_88_7) 1)))
+(assert (or (>= (- t_88_7 t_41_3) 3) (>= (- t_41_3 t_88_7) 1)))
+(assert (or (>= (- t_9_1 t_5_4) 4) (>= (- t_5_4 t_9_1) 5)))
+(assert (or (>= (- t_11_6 t_5_4) 4) (>= (- t_5_4 t_11_6) 2)))
+(assert (or (>= (- t_15_5 t_5_4) 4) (>= (- t_5_4 t_15_5) 2)))
+(assert (or (>= (- t_35_2 t_5_4) 4) (>= (- t_5_4 t_35_2) 2)))
+(assert (or (>= (- t_81_7 t_5_4) 4) (>= (- t_5_4 t_81_7) 3)))
+(assert (or (>= (- t_87_9 t_5_4) 4) (>= (- t_5_4 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_5_4) 4) (>= (- t_5_4 t_93_4) 3)))
+(assert (or (>= (- t_11_6 t_9_1) 5) (>= (- t_9_1 t_11_6) 2)))
+(assert (or (>= (- t_15_5 t_9_1) 5) (>= (- t_9_1 t_15_5) 2)))
+(assert (or (>= (- t_35_2 t_9_1) 5) (>= (- t_9_1 t_35_2) 2)))
+(assert (or (>= (- t_81_7 t_9_1) 5) (>= (- t_9_1 t_81_7) 3)))
+(assert (or (>= (- t_87_9 t_9_1) 5) (>= (- t_9_1 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_9_1) 5) (>= (- t_9_1 t_93_4) 3)))
+(assert (or (>= (- t_15_5 t_11_6) 2) (>= (- t_11_6 t_15_5) 2)))
+(assert (or (>= (- t_35_2 t_11_6) 2) (>= (- t_11_6 t_35_2) 2)))
+(assert (or (>= (- t_81_7 t_11_6) 2) (>= (- t_11_6 t_81_7) 3)))
+(assert (or (>= (- t_87_9 t_11_6) 2) (>= (- t_11_6 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_11_6) 2) (>= (- t_11_6 t_93_4) 3)))
+(assert (or (>= (- t_35_2 t_15_5) 2) (>= (- t_15_5 t_35_2) 2)))
+(assert (or (>= (- t_81_7 t_15_5) 2) (>= (- t_15_5 t_81_7) 3)))
+(assert (or (>= (- t_87_9 t_15_5) 2) (>= (- t_15_5 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_15_5) 2) (>= (- t_15_5 t_93_4) 3)))
+(assert (or (>= (- t_81_7 t_35_2) 2) (>= (- t_35_2 t_81_7) 3)))
+(assert (or (>= (- t_87_9 t_35_2) 2) (>= (- t_35_2 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_35_2) 2) (>= (- t_35_2 t_93_4) 3)))
+(assert (or (>= (- t_87_9 t_81_7) 3) (>= (- t_81_7 t_87_9) 1)))
+(assert (or (>= (- t_93_4 t_81_7) 3) (>= (- t_81_7 t_93_4) 3)))
+(assert (or (>= (- t_93_4 t_87_9) 1) (>= (- t_87_9 t_93_4) 3)))
+(assert (or (>= (- t_57_1 t_31_0) 3) (>= (- t_31_0 t_57_1) 2)))
+(assert (or (>= (- t_67_3 t_31_0) 3) (>= (- t_31_0 t_67_3) 2)))
+(assert (or (>= (- t_98_9 t_31_0) 3) (>= (- t_31_0 t_98_9) 1)))
+(assert (or (>= (- t_67_3 t_57_1) 2) (>= (- t_57_1 t_67_3) 2)))
+(assert (or (>= (- t_98_9 t_57_1) 2) (>= (- t_57_1 t_98_9) 1)))
+(assert (or (>= (- t_98_9 t_67_3) 2) (>= (- t_67_3 t_98_9) 1)))
+(assert (or (>= (- t_19_7 t_10_7) 2) (>= (- t_10_7 t_19_7) 5)))
+(assert (or (>= (- t_32_8 t_10_7) 2) (>= (- t_10_7 t_32_8) 4)))
+(assert (or (>= (- t_40_6 t_10_7) 2) (>= (- t_10_7 t_40_6) 4)))
+(assert (or (>= (- t_59_7 t_10_7) 2) (>= (- t_10_7 t_59_7) 4)))
+(assert (or (>= (- t_64_4 t_10_7) 2) (>= (- t_10_7 t_64_4) 3)))
+(assert (or (>= (- t_32_8 t_19_7) 5) (>= (- t_19_7 t_32_8) 4)))
+(assert (or (>= (- t_40_6 t_19_7) 5) (>= (- t_19_7 t_40_6) 4)))
+(assert (or (>= (- t_59_7 t_19_7) 5) (>= (- t_19_7 t_59_7) 4)))
+(assert (or (>= (- t_64_4 t_19_7) 5) (>= (- t_19_7 t_64_4) 3)))
+(assert (or (>= (- t_40_6 t_32_8) 4) (>= (- t_32_8 t_40_6) 4)))
+(assert (or (>= (- t_59_7 t_32_8) 4) (>= (- t_32_8 t_59_7) 4)))
+(assert (or (>= (- t_64_4 t_32_8) 4) (>= (- t_32_8 t_64_4) 3)))
+(assert (or (>= (- t_59_7 t_40_6) 4) (>= (- t_40_6 t_59_7) 4)))
+(assert (or (>= (- t_64_4 t_40_6) 4) (>= (- t_40_6 t_64_4) 3)))
+(assert (or (>= (- t_64_4 t_59_7) 4) (>= (- t_59_7 t_64_4) 3)))
+(assert (or (>= (- t_36_3 t_18_0) 2) (>= (- t_18_0 t_36_3) 4)))
+(assert (or (>= (- t_50_8 t_18_0) 2) (>= (- t_18_0 t_50_8) 4)))
+(assert (or (>= (- t_88_5 t_18_0) 2) (>= (- t_18_0 t_88_5) 5)))
+(assert (or (>= (- t_99_6 t_18_0) 2) (>= (- t_18_0 t_99_6) 2)))
+(assert (or (>= (- t_50_8 t_36_3) 4) (>= (- t_36_3 t_50_8) 4)))
+(assert (or (>= (- t_88_5 t_36_3) 4) (>= (- t_36_3 t_88_5) 5)))
+(assert (or (>= (- t_99_6 t_36_3) 4) (>= (- t_36_3 t_99_6) 2)))
+(assert (or (>= (- t_88_5 t_50_8) 4) (>= (- t_50_8 t_88_5) 5)))
+(assert (or (>= (- t_99_6 t_50_8) 4) (>= (- t_50_8 t_99_6) 2)))
+(assert (or (>= (- t_99_6 t_88_5) 5) (>= (- t_88_5 t_99_6) 2)))
+(assert (or (>= (- t_44_8 t_22_0) 1) (>= (- t_22_0 t_44_8) 3)))
+(assert (or (>= (- t_55_3 t_22_0) 1) (>= (- t_22_0 t_55_3) 1)))
+(assert (or (>= (- t_78_3 t_22_0) 1) (>= (- t_22_0 t_78_3) 4)))
+(assert (or (>= (- t_55_3 t_44_8) 3) (>= (- t_44_8 t_55_3) 1)))
+(assert (or (>= (- t_78_3 t_44_8) 3) (>= (- t_44_8 t_78_3) 4)))
+(assert (or (>= (- t_78_3 t_55_3) 1) (>= (- t_55_3 t_78_3) 4)))
+(assert (or (>= (- t_22_7 t_13_4) 2) (>= (- t_13_4 t_22_7) 2)))
+(assert (or (>= (- t_31_6 t_13_4) 2) (>= (- t_13_4 t_31_6) 3)))
+(assert (or (>= (- t_57_9 t_13_4) 2) (>= (- t_13_4 t_57_9) 4)))
+(assert (or (>= (- t_92_3 t_13_4) 2) (>= (- t_13_4 t_92_3) 4)))
+(assert (or (>= (- t_31_6 t_22_7) 2) (>= (- t_22_7 t_31_6) 3)))
+(assert (or (>= (- t_57_9 t_22_7) 2) (>= (- t_22_7 t_57_9) 4)))
+(assert (or (>= (- t_92_3 t_22_7) 2) (>= (- t_22_7 t_92_3) 4)))
+(assert (or (>= (- t_57_9 t_31_6) 3) (>= (- t_31_6 t_57_9) 4)))
+(assert (or (>= (- t_92_3 t_31_6) 3) (>= (- t_31_6 t_92_3) 4)))
+(assert (or (>= (- t_92_3 t_57_9) 4) (>= (- t_57_9 t_92_3) 4)))
+(assert (or (>= (- t_33_4 t_0_0) 1) (>= (- t_0_0 t_33_4) 4)))
+(assert (or (>= (- t_39_5 t_0_0) 1) (>= (- t_0_0 t_39_5) 5)))
+(assert (or (>= (- t_52_0 t_0_0) 1) (>= (- t_0_0 t_52_0) 2)))
+(assert (or (>= (- t_53_7 t_0_0) 1) (>= (- t_0_0 t_53_7) 1)))
+(assert (or (>= (- t_82_9 t_0_0) 1) (>= (- t_0_0 t_82_9) 2)))
+(assert (or (>= (- t_39_5 t_33_4) 4) (>= (- t_33_4 t_39_5) 5)))
+(assert (or (>= (- t_52_0 t_33_4) 4) (>= (- t_33_4 t_52_0) 2)))
+(assert (or (>= (- t_53_7 t_33_4) 4) (>= (- t_33_4 t_53_7) 1)))
+(assert (or (>= (- t_82_9 t_33_4) 4) (>= (- t_33_4 t_82_9) 2)))
+(assert (or (>= (- t_52_0 t_39_5) 5) (>= (- t_39_5 t_52_0) 2)))
+(assert (or (>= (- t_53_7 t_39_5) 5) (>= (- t_39_5 t_53_7) 1)))
+(assert (or (>= (- t_82_9 t_39_5) 5) (>= (- t_39_5 t_82_9) 2)))
+(assert (or (>= (- t_53_7 t_52_0) 2) (>= (- t_52_0 t_53_7) 1)))
+(assert (or (>= (- t_82_9 t_52_0) 2) (>= (- t_52_0 t_82_9) 2)))
+(assert (or (>= (- t_82_9 t_53_7) 1) (>= (- t_53_7 t_82_9) 2)))
+(assert (or (>= (- t_9_3 t_8_6) 3) (>= (- t_8_6 t_9_3) 3)))
+(assert (or (>= (- t_17_0 t_8_6) 3) (>= (- t_8_6 t_17_0) 3)))
+(assert (or (>= (- t_21_4 t_8_6) 3) (>= (- t_8_6 t_21_4) 1)))
+(assert (or (>= (- t_23_9 t_8_6) 3) (>= (- t_8_6 t_23_9) 2)))
+(assert (or (>= (- t_34_6 t_8_6) 3) (>= (- t_8_6 t_34_6) 3)))
+(assert (or (>= (- t_17_0 t_9_3) 3) (>= (- t_9_3 t_17_0) 3)))
+(assert (or (>= (- t_21_4 t_9_3) 3) (>= (- t_9_3 t_21_4) 1)))
+(assert (or (>= (- t_23_9 t_9_3) 3) (>= (- t_9_3 t_23_9) 2)))
+(assert (or (>= (- t_34_6 t_9_3) 3) (>= (- t_9_3 t_34_6) 3)))
+(assert (or (>= (- t_21_4 t_17_0) 3) (>= (- t_17_0 t_21_4) 1)))
+(assert (or (>= (- t_23_9 t_17_0) 3) (>= (- t_17_0 t_23_9) 2)))
+(assert (or (>= (- t_34_6 t_17_0) 3) (>= (- t_17_0 t_34_6) 3)))
+(assert (or (>= (- t_23_9 t_21_4) 1) (>= (- t_21_4 t_23_9) 2)))
+(assert (or (>= (- t_34_6 t_21_4) 1) (>= (- t_21_4 t_34_6) 3)))
+(assert (or (>= (- t_34_6 t_23_9) 2) (>= (- t_23_9 t_34_6) 3)))
+(assert (or (>= (- t_36_5 t_31_7) 5) (>= (- t_31_7 t_36_5) 4)))
+(assert (or (>= (- t_59_0 t_31_7) 5) (>= (- t_31_7 t_59_0) 3)))
+(assert (or (>= (- t_81_0 t_31_7) 5) (>= (- t_31_7 t_81_0) 1)))
+(assert (or (>= (- t_99_9 t_31_7) 5) (>= (- t_31_7 t_99_9) 4)))
+(assert (or (>= (- t_59_0 t_36_5) 4) (>= (- t_36_5 t_59_0) 3)))
+(assert (or (>= (- t_81_0 t_36_5) 4) (>= (- t_36_5 t_81_0) 1)))
+(assert (or (>= (- t_99_9 t_36_5) 4) (>= (- t_36_5 t_99_9) 4)))
+(assert (or (>= (- t_81_0 t_59_0) 3) (>= (- t_59_0 t_81_0) 1)))
+(assert (or (>= (- t_99_9 t_59_0) 3) (>= (- t_59_0 t_99_9) 4)))
+(assert (or (>= (- t_99_9 t_81_0) 1) (>= (- t_81_0 t_99_9) 4)))
+(assert (or (>= (- t_13_7 t_7_4) 5) (>= (- t_7_4 t_13_7) 1)))
+(assert (or (>= (- t_43_6 t_7_4) 5) (>= (- t_7_4 t_43_6) 2)))
+(assert (or (>= (- t_90_4 t_7_4) 5) (>= (- t_7_4 t_90_4) 2)))
+(assert (or (>= (- t_96_4 t_7_4) 5) (>= (- t_7_4 t_96_4) 2)))
+(assert (or (>= (- t_43_6 t_13_7) 1) (>= (- t_13_7 t_43_6) 2)))
+(assert (or (>= (- t_90_4 t_13_7) 1) (>= (- t_13_7 t_90_4) 2)))
+(assert (or (>= (- t_96_4 t_13_7) 1) (>= (- t_13_7 t_96_4) 2)))
+(assert (or (>= (- t_90_4 t_43_6) 2) (>= (- t_43_6 t_90_4) 2)))
+(assert (or (>= (- t_96_4 t_43_6) 2) (>= (- t_43_6 t_96_4) 2)))
+(assert (or (>= (- t_96_4 t_90_4) 2) (>= (- t_90_4 t_96_4) 2)))
+(assert (or (>= (- t_32_3 t_3_7) 2) (>= (- t_3_7 t_32_3) 1)))
+(assert (or (>= (- t_33_1 t_3_7) 2) (>= (- t_3_7 t_33_1) 1)))
+(assert (or (>= (- t_53_4 t_3_7) 2) (>= (- t_3_7 t_53_4) 3)))
+(assert (or (>= (- t_80_9 t_3_7) 2) (>= (- t_3_7 t_80_9) 1)))
+(assert (or (>= (- t_89_4 t_3_7) 2) (>= (- t_3_7 t_89_4) 1)))
+(assert (or (>= (- t_91_4 t_3_7) 2) (>= (- t_3_7 t_91_4) 5)))
+(assert (or (>= (- t_33_1 t_32_3) 1) (>= (- t_32_3 t_33_1) 1)))
+(assert (or (>= (- t_53_4 t_32_3) 1) (>= (- t_32_3 t_53_4) 3)))
+(assert (or (>= (- t_80_9 t_32_3) 1) (>= (- t_32_3 t_80_9) 1)))
+(assert (or (>= (- t_89_4 t_32_3) 1) (>= (- t_32_3 t_89_4) 1)))
+(assert (or (>= (- t_91_4 t_32_3) 1) (>= (- t_32_3 t_91_4) 5)))
+(assert (or (>= (- t_53_4 t_33_1) 1) (>= (- t_33_1 t_53_4) 3)))
+(assert (or (>= (- t_80_9 t_33_1) 1) (>= (- t_33_1 t_80_9) 1)))
+(assert (or (>= (- t_89_4 t_33_1) 1) (>= (- t_33_1 t_89_4) 1)))
+(assert (or (>= (- t_91_4 t_33_1) 1) (>= (- t_33_1 t_91_4) 5)))
+(assert (or (>= (- t_80_9 t_53_4) 3) (>= (- t_53_4 t_80_9) 1)))
+(assert (or (>= (- t_89_4 t_53_4) 3) (>= (- t_53_4 t_89_4) 1)))
+(assert (or (>= (- t_91_4 t_53_4) 3) (>= (- t_53_4 t_91_4) 5)))
+(assert (or (>= (- t_89_4 t_80_9) 1) (>= (- t_80_9 t_89_4) 1)))
+(assert (or (>= (- t_91_4 t_80_9) 1) (>= (- t_80_9 t_91_4) 5)))
+(assert (or (>= (- t_91_4 t_89_4) 1) (>= (- t_89_4 t_91_4) 5)))
+(assert (or (>= (- t_90_7 t_6_7) 5) (>= (- t_6_7 t_90_7) 5)))
+(assert (or (>= (- t_62_9 t_32_1) 5) (>= (- t_32_1 t_62_9) 1)))
+(assert (or (>= (- t_79_2 t_32_1) 5) (>= (- t_32_1 t_79_2) 4)))
+(assert (or (>= (- t_85_3 t_32_1) 5) (>= (- t_32_1 t_85_3) 2)))
+(assert (or (>= (- t_96_7 t_32_1) 5) (>= (- t_32_1 t_96_7) 1)))
+(assert (or (>= (- t_79_2 t_62_9) 1) (>= (- t_62_9 t_79_2) 4)))
+(assert (or (>= (- t_85_3 t_62_9) 1) (>= (- t_62_9 t_85_3) 2)))
+(assert (or (>= (- t_96_7 t_62_9) 1) (>= (- t_62_9 t_96_7) 1)))
+(assert (or (>= (- t_85_3 t_79_2) 4) (>= (- t_79_2 t_85_3) 2)))
+(assert (or (>= (- t_96_7 t_79_2) 4) (>= (- t_79_2 t_96_7) 1)))
+(assert (or (>= (- t_96_7 t_85_3) 2) (>= (- t_85_3 t_96_7) 1)))
+(assert (or (>= (- t_39_4 t_18_3) 1) (>= (- t_18_3 t_39_4) 5)))
+(assert (or (>= (- t_45_5 t_18_3) 1) (>= (- t_18_3 t_45_5) 4)))
+(assert (or (>= (- t_54_9 t_18_3) 1) (>= (- t_18_3 t_54_9) 3)))
+(assert (or (>= (- t_61_5 t_18_3) 1) (>= (- t_18_3 t_61_5) 5)))
+(assert (or (>= (- t_72_9 t_18_3) 1) (>= (- t_18_3 t_72_9) 2)))
+(assert (or (>= (- t_90_9 t_18_3) 1) (>= (- t_18_3 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_18_3) 1) (>= (- t_18_3 t_93_7) 3)))
+(assert (or (>= (- t_45_5 t_39_4) 5) (>= (- t_39_4 t_45_5) 4)))
+(assert (or (>= (- t_54_9 t_39_4) 5) (>= (- t_39_4 t_54_9) 3)))
+(assert (or (>= (- t_61_5 t_39_4) 5) (>= (- t_39_4 t_61_5) 5)))
+(assert (or (>= (- t_72_9 t_39_4) 5) (>= (- t_39_4 t_72_9) 2)))
+(assert (or (>= (- t_90_9 t_39_4) 5) (>= (- t_39_4 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_39_4) 5) (>= (- t_39_4 t_93_7) 3)))
+(assert (or (>= (- t_54_9 t_45_5) 4) (>= (- t_45_5 t_54_9) 3)))
+(assert (or (>= (- t_61_5 t_45_5) 4) (>= (- t_45_5 t_61_5) 5)))
+(assert (or (>= (- t_72_9 t_45_5) 4) (>= (- t_45_5 t_72_9) 2)))
+(assert (or (>= (- t_90_9 t_45_5) 4) (>= (- t_45_5 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_45_5) 4) (>= (- t_45_5 t_93_7) 3)))
+(assert (or (>= (- t_61_5 t_54_9) 3) (>= (- t_54_9 t_61_5) 5)))
+(assert (or (>= (- t_72_9 t_54_9) 3) (>= (- t_54_9 t_72_9) 2)))
+(assert (or (>= (- t_90_9 t_54_9) 3) (>= (- t_54_9 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_54_9) 3) (>= (- t_54_9 t_93_7) 3)))
+(assert (or (>= (- t_72_9 t_61_5) 5) (>= (- t_61_5 t_72_9) 2)))
+(assert (or (>= (- t_90_9 t_61_5) 5) (>= (- t_61_5 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_61_5) 5) (>= (- t_61_5 t_93_7) 3)))
+(assert (or (>= (- t_90_9 t_72_9) 2) (>= (- t_72_9 t_90_9) 5)))
+(assert (or (>= (- t_93_7 t_72_9) 2) (>= (- t_72_9 t_93_7) 3)))
+(assert (or (>= (- t_93_7 t_90_9) 5) (>= (- t_90_9 t_93_7) 3)))
+(assert (or (>= (- t_21_2 t_9_0) 3) (>= (- t_9_0 t_21_2) 2)))
+(assert (or (>= (- t_39_3 t_9_0) 3) (>= (- t_9_0 t_39_3) 2)))
+(assert (or (>= (- t_48_6 t_9_0) 3) (>= (- t_9_0 t_48_6) 5)))
+(assert (or (>= (- t_39_3 t_21_2) 2) (>= (- t_21_2 t_39_3) 2)))
+(assert (or (>= (- t_48_6 t_21_2) 2) (>= (- t_21_2 t_48_6) 5)))
+(assert (or (>= (- t_48_6 t_39_3) 2) (>= (- t_39_3 t_48_6) 5)))
+(assert (or (>= (- t_64_6 t_25_9) 1) (>= (- t_25_9 t_64_6) 2)))
+(assert (or (>= (- t_82_3 t_25_9) 1) (>= (- t_25_9 t_82_3) 1)))
+(assert (or (>= (- t_82_5 t_25_9) 1) (>= (- t_25_9 t_82_5) 5)))
+(assert (or (>= (- t_95_6 t_25_9) 1) (>= (- t_25_9 t_95_6) 2)))
+(assert (or (>= (- t_82_3 t_64_6) 2) (>= (- t_64_6 t_82_3) 1)))
+(assert (or (>= (- t_82_5 t_64_6) 2) (>= (- t_64_6 t_82_5) 5)))
+(assert (or (>= (- t_95_6 t_64_6) 2) (>= (- t_64_6 t_95_6) 2)))
+(assert (or (>= (- t_82_5 t_82_3) 1) (>= (- t_82_3 t_82_5) 5)))
+(assert (or (>= (- t_95_6 t_82_3) 1) (>= (- t_82_3 t_95_6) 2)))
+(assert (or (>= (- t_95_6 t_82_5) 5) (>= (- t_82_5 t_95_6) 2)))
+(assert (or (>= (- t_30_7 t_3_4) 1) (>= (- t_3_4 t_30_7) 4)))
+(assert (or (>= (- t_35_5 t_3_4) 1) (>= (- t_3_4 t_35_5) 4)))
+(assert (or (>= (- t_63_4 t_3_4) 1) (>= (- t_3_4 t_63_4) 1)))
+(assert (or (>= (- t_72_5 t_3_4) 1) (>= (- t_3_4 t_72_5) 5)))
+(assert (or (>= (- t_35_5 t_30_7) 4) (>= (- t_30_7 t_35_5) 4)))
+(assert (or (>= (- t_63_4 t_30_7) 4) (>= (- t_30_7 t_63_4) 1)))
+(assert (or (>= (- t_72_5 t_30_7) 4) (>= (- t_30_7 t_72_5) 5)))
+(assert (or (>= (- t_63_4 t_35_5) 4) (>= (- t_35_5 t_63_4) 1)))
+(assert (or (>= (- t_72_5 t_35_5) 4) (>= (- t_35_5 t_72_5) 5)))
+(assert (or (>= (- t_72_5 t_63_4) 1) (>= (- t_63_4 t_72_5) 5)))
+(assert (or (>= (- t_23_6 t_17_6) 2) (>= (- t_17_6 t_23_6) 4)))
+(assert (or (>= (- t_36_4 t_17_6) 2) (>= (- t_17_6 t_36_4) 2)))
+(assert (or (>= (- t_36_4 t_23_6) 4) (>= (- t_23_6 t_36_4) 2)))
+(assert (and (>= t_0_5 16) (<= t_0_5 24)))
+(assert (and (>= t_1_5 16) (<= t_1_5 24)))
+(assert (and (>= t_2_5 16) (<= t_2_5 24)))
+(assert (and (>= t_3_5 16) (<= t_3_5 24)))
+(assert (or (>= (- t_1_5 t_0_5) 3) (>= (- t_0_5 t_1_5) 3)))
+(assert (or (>= (- t_2_5 t_0_5) 3) (>= (- t_0_5 t_2_5) 3)))
+(assert (or (>= (- t_3_5 t_0_5) 3) (>= (- t_0_5 t_3_5) 3)))
+(assert (or (>= (- t_2_5 t_1_5) 3) (>= (- t_1_5 t_2_5) 3)))
+(assert (or (>= (- t_3_5 t_1_5) 3) (>= (- t_1_5 t_3_5) 3)))
+(assert (or (>= (- t_3_5 t_2_5) 3) (>= (- t_2_5 t_3_5) 3)))
+(check-sat)
+(exit)
@@ -0,0 +1,9 @@
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun p (U) Bool)
+(declare-fun c0 () U)
+(assert (forall ((x U)) (! (=> (p x) (p (f x))) :pattern ((p (f x))) )))
+(assert (p c0))
+(assert (not (p (f (f (f (f (f (f (f (f c0)))))))))))
+(check-sat)
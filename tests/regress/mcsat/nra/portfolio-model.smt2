@@ -0,0 +1,12 @@
+(set-option :produce-models true)
+(set-logic QF_NRA)
+
+(declare-const x Real)
+(declare-const y Real)
+
+(assert (= (* x x) 2))
+(assert (< x 0))
+(assert (= (* y y y) x))
+
+(check-sat)
+(get-value (x y))
@@ -0,0 +1,10 @@
+(set-logic QF_NRA)
+
+(declare-const x Real)
+(declare-const y Real)
+
+(assert (> (* x y) 1))
+(assert (< x 0))
+(assert (> y 0))
+
+(check-sat)
@@ -0,0 +1,181 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * SHARED FIXTURE FOR THE SMT_CORE TESTS ON RANDOM 3-SAT PROBLEMS
+ *
+ * - smt_core with a null theory
+ * - random 3-SAT problems (optionally with a planted solution)
+ * - Minisat-like search: restarts + clause deletion
+ *
+ * This is included by the tests (each test in this directory is
+ * a single source file) so everything is static.
+ */
+
+#ifndef __RANDOM_CNF_H
+#define __RANDOM_CNF_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "solvers/cdcl/smt_core.h"
+
+
+/*
+ * Null theory
+ */
+static void do_nothing(void *t) {
+}
+
+static void null_backtrack(void *t, uint32_t back_level) {
+}
+
+static fcheck_code_t null_final_check(void *t) {
+  return FCHECK_SAT;
+}
+
+static bool empty_propagate(void *t) {
+  return true;
+}
+
+static th_ctrl_interface_t null_theory_ctrl = {
+  do_nothing,       // start_internalization
+  do_nothing,       // start_search
+  empty_propagate,  // propagate
+  null_final_check, // final_check
+  do_nothing,       // increase_dlevel
+  null_backtrack,   // backtrack
+  do_nothing,       // push
+  do_nothing,       // pop
+  do_nothing,       // reset
+  do_nothing,       // clear
+};
+
+static th_smt_interface_t null_theory_smt = {
+  NULL,            // assert_atom
+  NULL,            // expand explanation
+  NULL,            // select polarity
+  NULL,            // delete_atom
+  NULL,            // end_deletion
+};
+
+
+/*
+ * Random 3-SAT problem with nvars variables and nclauses clauses
+ * - the clauses are stored in a[0 ... 3 * nclauses - 1]
+ * - if planted is true, all clauses are true for the assignment
+ *   where all variables are true
+ */
+static literal_t *random_problem(uint32_t nvars, uint32_t nclauses, bool planted) {
+  literal_t *a;
+  uint32_t i, j;
+  bvar_t x;
+
+  a = (literal_t *) malloc(3 * nclauses * sizeof(literal_t));
+  if (a == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+
+  for (i=0; i<nclauses; i++) {
+    do {
+      for (j=0; j<3; j++) {
+        x = 1 + (random() % nvars);
+        a[3*i + j] = mk_lit(x, random() & 1);
+      }
+    } while (a[3*i] == a[3*i+1] || a[3*i] == a[3*i+2] || a[3*i+1] == a[3*i+2] ||
+             a[3*i] == not(a[3*i+1]) || a[3*i] == not(a[3*i+2]) || a[3*i+1] == not(a[3*i+2]) ||
+             (planted && is_neg(a[3*i]) && is_neg(a[3*i+1]) && is_neg(a[3*i+2])));
+  }
+
+  return a;
+}
+
+
+/*
+ * Initialize core for the problem a (as built by random_problem)
+ */
+static void init_random_problem_core(smt_core_t *core, uint32_t nvars, uint32_t nclauses, literal_t *a) {
+  uint32_t i;
+
+  init_smt_core(core, nvars+1, NULL, &null_theory_ctrl, &null_theory_smt, SMT_MODE_BASIC);
+  add_boolean_variables(core, nvars);
+  for (i=0; i<nclauses; i++) {
+    add_clause(core, 3, a + 3*i);
+  }
+}
+
+
+/*
+ * Search with Minisat-like restarts and clause deletion
+ * - reduce_threshold = number of learned clauses that triggers the
+ *   first clause deletion (it then grows by 5% after each deletion)
+ * - reduce = function called to delete clauses: if it's NULL, we just
+ *   call reduce_clause_database; otherwise reduce(core, aux) is called
+ *   and it must call reduce_clause_database
+ */
+typedef void (*reduce_fun_t)(smt_core_t *core, void *aux);
+
+static smt_status_t search_random_problem(smt_core_t *core, uint32_t reduce_threshold, reduce_fun_t reduce, void *aux) {
+  uint64_t max_conflicts;
+  uint32_t c_threshold;
+  literal_t l;
+
+  c_threshold = 100;
+  start_search(core, 0, NULL);
+  while (smt_status(core) == STATUS_SEARCHING) {
+    max_conflicts = num_conflicts(core) + c_threshold;
+    smt_process(core);
+    while (smt_status(core) == STATUS_SEARCHING && num_conflicts(core) <= max_conflicts) {
+      if (num_learned_clauses(core) >= reduce_threshold) {
+        if (reduce == NULL) {
+          reduce_clause_database(core);
+        } else {
+          reduce(core, aux);
+        }
+        reduce_threshold += reduce_threshold/20;
+      }
+      l = select_unassigned_literal(core);
+      if (l == null_literal) {
+        end_search_sat(core);
+        break;
+      }
+      decide_literal(core, l);
+      smt_process(core);
+    }
+    if (smt_status(core) != STATUS_SEARCHING) break;
+    smt_restart(core);
+    c_threshold += c_threshold/10;
+  }
+
+  return smt_status(core);
+}
+
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  default: return "unknown";
+  }
+}
+
+
+#endif /* __RANDOM_CNF_H */
@@ -74,6 +74,8 @@ static void show_params(param_t *params) {
   printf("  clause-decay  = %.4f\n", (double) params->clause_decay);
   printf("  cache-tclause = %s\n", bool2string(params->cache_tclauses));
   printf("  tclause-size  = %"PRIu32"\n", params->tclause_size);
+  printf("  inprocessing  = %s\n", bool2string(params->inprocessing));
+  printf("  chrono-levels = %"PRIu32"\n", params->chrono_levels);
   printf("--- egraph ---\n");
   printf("  use_dyn_ack            = %s\n", bool2string(params->use_dyn_ack));
   printf("  use_bool_dyn_ack       = %s\n", bool2string(params->use_bool_dyn_ack));
@@ -87,13 +89,19 @@ static void show_params(param_t *params) {
   printf("--- simplex ---\n");
   printf("  use_simplex_prop       = %s\n", bool2string(params->use_simplex_prop));
   printf("  adjust_simplex_model   = %s\n", bool2string(params->adjust_simplex_model));
+  printf("  simplex_float_first    = %s\n", bool2string(params->simplex_float_first));
   printf("  integer_check          = %s\n", bool2string(params->integer_check));
   printf("  max_prop_row_size      = %"PRIu32"\n", params->max_prop_row_size);
   printf("  bland_threshold        = %"PRIu32"\n", params->bland_threshold);
   printf("  integer_check_period   = %"PRIu32"\n", params->integer_check_period);
+  printf("--- sparse idl ---\n");
+  printf("  isdl_prop              = %s\n", bool2string(params->isdl_prop));
   printf("--- array solver ---\n");
   printf("  max_update_conflicts   = %"PRIu32"\n", params->max_update_conflicts);
   printf("  max_extensionality     = %"PRIu32"\n", params->max_extensionality);
+  printf("  eager_array_lemmas     = %s\n", bool2string(params->eager_array_lemmas));
+  printf("--- bitvector solver ---\n");
+  printf("  bv_lazy_blast          = %s\n", bool2string(params->bv_lazy_blast));
   printf("\n");
   fflush(stdout);
 }
@@ -255,12 +263,17 @@ static void test_set_branching(param_t *params, const char *name) {
  * Tests of set_param
  */
 static void test_set_params(param_t *params) {
+  test_set_bool_param(params, "bv-lazy-blast");
   test_set_bool_param(params, "cache-tclauses");
   test_set_bool_param(params, "dyn-ack");
   test_set_bool_param(params, "dyn-bool-ack");
+  test_set_bool_param(params, "eager-array-lemmas");
   test_set_bool_param(params, "fast-restarts");
   test_set_bool_param(params, "icheck");
+  test_set_bool_param(params, "isdl-prop");
+  test_set_bool_param(params, "inprocessing");
   test_set_bool_param(params, "simplex-adjust");
+  test_set_bool_param(params, "simplex-float");
   test_set_bool_param(params, "simplex-prop");
 
   test_set_posint_param(params, "aux-eq-quota");
@@ -278,6 +291,7 @@ static void test_set_params(param_t *params) {
   test_set_posint2_param(params, "tclause-size");
 
   test_set_nonnegint_param(params, "prop-threshold");
+  test_set_nonnegint_param(params, "chrono-levels");
 
   test_set_posint16_param(params, "dyn-ack-threshold");
   test_set_posint16_param(params, "dyn-bool-ack-threshold");
@@ -0,0 +1,271 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE BATCH EVALUATOR: evaluate random Boolean and bitvector
+ * terms in many random models. The results must be the same as the
+ * values computed by eval_in_model.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "api/yices_globals.h"
+#include "model/batch_eval.h"
+#include "model/model_eval.h"
+#include "yices.h"
+
+#define NUM_BOOLS 4
+#define NUM_BV8 4
+#define NUM_BV64 3
+#define NUM_TERMS 400
+#define NUM_MODELS 600
+
+/*
+ * Variables: x[i] = bitvectors of 8 bits, y[i] = bitvectors of 64 bits
+ * - z is an integer variable: atoms on z are leaves
+ * - q is a Boolean variable with no value in the models
+ * - r is a free variable: eval_in_model fails on terms that depend on r
+ */
+static term_t p[NUM_BOOLS];
+static term_t x[NUM_BV8];
+static term_t y[NUM_BV64];
+static term_t z, q, r;
+
+static term_t terms[NUM_TERMS];
+static model_t *models[NUM_MODELS];
+
+static uint32_t seed = 4321;
+
+static uint32_t random_index(uint32_t n) {
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static uint64_t random_uint64(void) {
+  uint64_t c;
+
+  c = random_index(0x10000);
+  c = (c << 16) | random_index(0x10000);
+  c = (c << 16) | random_index(0x10000);
+  c = (c << 16) | random_index(0x10000);
+  // small values are more interesting for division and shifts
+  if (random_index(3) == 0) {
+    c &= 0x7;
+  }
+  return c;
+}
+
+static term_t random_bool(uint32_t depth);
+
+/*
+ * Random bitvector term of n bits (n is 8 or 64)
+ */
+static term_t random_bv(uint32_t n, uint32_t depth) {
+  term_t a, b;
+
+  if (depth == 0 || random_index(4) == 0) {
+    switch (random_index(4)) {
+    case 0:
+      return yices_bvconst_uint64(n, random_uint64());
+    default:
+      return n == 8 ? x[random_index(NUM_BV8)] : y[random_index(NUM_BV64)];
+    }
+  }
+
+  a = random_bv(n, depth - 1);
+  b = random_bv(n, depth - 1);
+  switch (random_index(20)) {
+  case 0: return yices_bvadd(a, b);
+  case 1: return yices_bvsub(a, b);
+  case 2: return yices_bvmul(a, b);
+  case 3: return yices_bvneg(a);
+  case 4: return yices_bvpower(a, 1 + random_index(5));
+  case 5: return yices_bvdiv(a, b);
+  case 6: return yices_bvrem(a, b);
+  case 7: return yices_bvsdiv(a, b);
+  case 8: return yices_bvsrem(a, b);
+  case 9: return yices_bvsmod(a, b);
+  case 10: return yices_bvshl(a, b);
+  case 11: return yices_bvlshr(a, b);
+  case 12: return yices_bvashr(a, b);
+  case 13: return yices_bvand2(a, b);
+  case 14: return yices_bvor2(a, b);
+  case 15: return yices_bvxor2(a, b);
+  case 16: return yices_ite(random_bool(depth - 1), a, b);
+  case 17: return yices_bvnot(a);
+  case 18: return yices_rotate_left(a, random_index(n));
+  default:
+    if (n == 8) {
+      return yices_bvextract(y[random_index(NUM_BV64)], 3, 10);
+    }
+    return yices_bvconcat2(yices_bvextract(a, 0, 31), yices_bvextract(b, 32, 63));
+  }
+}
+
+
+/*
+ * Random Boolean term
+ */
+static term_t random_bool(uint32_t depth) {
+  term_t a, b;
+  uint32_t n;
+
+  if (depth == 0 || random_index(5) == 0) {
+    switch (random_index(12)) {
+    case 0: return yices_true();
+    case 1: return yices_arith_geq_atom(z, yices_int32((int32_t) random_index(10)));
+    case 2: return q;
+    case 3: return r;
+    default: return p[random_index(NUM_BOOLS)];
+    }
+  }
+
+  n = random_index(2) == 0 ? 8 : 64;
+  switch (random_index(12)) {
+  case 0: return yices_not(random_bool(depth - 1));
+  case 1: return yices_or2(random_bool(depth - 1), random_bool(depth - 1));
+  case 2: return yices_and2(random_bool(depth - 1), random_bool(depth - 1));
+  case 3: return yices_xor2(random_bool(depth - 1), random_bool(depth - 1));
+  case 4: return yices_iff(random_bool(depth - 1), random_bool(depth - 1));
+  case 5: return yices_ite(random_bool(depth - 1), random_bool(depth - 1), random_bool(depth - 1));
+  case 6: return yices_bitextract(random_bv(n, depth - 1), random_index(n));
+  case 7: return yices_bveq_atom(random_bv(n, depth - 1), random_bv(n, depth - 1));
+  case 8: return yices_bvge_atom(random_bv(n, depth - 1), random_bv(n, depth - 1));
+  case 9: return yices_bvsge_atom(random_bv(n, depth - 1), random_bv(n, depth - 1));
+  case 10: return yices_bvslt_atom(random_bv(n, depth - 1), random_bv(n, depth - 1));
+  default:
+    a = random_bv(n, depth - 1);
+    b = random_bv(n, depth - 1);
+    return yices_bvle_atom(a, b);
+  }
+}
+
+
+/*
+ * Random model: all variables except q get a value
+ */
+static model_t *random_model(void) {
+  term_t var[NUM_BOOLS + NUM_BV8 + NUM_BV64 + 1];
+  term_t val[NUM_BOOLS + NUM_BV8 + NUM_BV64 + 1];
+  uint32_t i, n;
+
+  n = 0;
+  for (i=0; i<NUM_BOOLS; i++) {
+    var[n] = p[i];
+    val[n] = random_index(2) == 0 ? yices_true() : yices_false();
+    n ++;
+  }
+  for (i=0; i<NUM_BV8; i++) {
+    var[n] = x[i];
+    val[n] = yices_bvconst_uint64(8, random_uint64());
+    n ++;
+  }
+  for (i=0; i<NUM_BV64; i++) {
+    var[n] = y[i];
+    val[n] = yices_bvconst_uint64(64, random_uint64());
+    n ++;
+  }
+  var[n] = z;
+  val[n] = yices_int32((int32_t) random_index(10));
+  n ++;
+
+  return yices_model_from_map(n, var, val);
+}
+
+
+int main(void) {
+  batch_evaluator_t batch;
+  evaluator_t eval;
+  value_t *val;
+  value_t v;
+  uint32_t i, j, k, errors, failed;
+  type_t bv8, bv64;
+
+  yices_init();
+
+  bv8 = yices_bv_type(8);
+  bv64 = yices_bv_type(64);
+  for (i=0; i<NUM_BOOLS; i++) p[i] = yices_new_uninterpreted_term(yices_bool_type());
+  for (i=0; i<NUM_BV8; i++) x[i] = yices_new_uninterpreted_term(bv8);
+  for (i=0; i<NUM_BV64; i++) y[i] = yices_new_uninterpreted_term(bv64);
+  z = yices_new_uninterpreted_term(yices_int_type());
+  q = yices_new_uninterpreted_term(yices_bool_type());
+  r = yices_new_variable(yices_bool_type());
+
+  for (i=0; i<NUM_TERMS; i++) {
+    switch (i % 3) {
+    case 0: terms[i] = random_bool(4); break;
+    case 1: terms[i] = random_bv(8, 4); break;
+    default: terms[i] = random_bv(64, 4); break;
+    }
+  }
+  for (j=0; j<NUM_MODELS; j++) {
+    models[j] = random_model();
+  }
+
+  init_batch_evaluator(&batch, __yices_globals.terms);
+  // add the terms in two steps
+  batch_eval_add_terms(&batch, terms, NUM_TERMS/2);
+  batch_eval_add_terms(&batch, terms + NUM_TERMS/2, NUM_TERMS - NUM_TERMS/2);
+  printf("%"PRIu32" terms: %"PRIu32" instructions\n", batch_eval_num_terms(&batch), batch.ninstr);
+
+  val = (value_t *) malloc(NUM_TERMS * NUM_MODELS * sizeof(value_t));
+  if (val == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  batch_eval_in_models(&batch, models, NUM_MODELS, val);
+
+  errors = 0;
+  failed = 0;
+  for (j=0; j<NUM_MODELS; j++) {
+    init_evaluator(&eval, models[j]);
+    for (i=0; i<NUM_TERMS; i++) {
+      k = i * NUM_MODELS + j;
+      v = eval_in_model(&eval, terms[i]);
+      if (v < 0) failed ++;
+      if (v != val[k]) {
+        if (errors < 10) {
+          printf("BUG: term %"PRIu32", model %"PRIu32": eval = %"PRId32", batch = %"PRId32"\n", i, j, v, val[k]);
+          yices_pp_term(stdout, terms[i], 120, 10, 0);
+        }
+        errors ++;
+      }
+    }
+    delete_evaluator(&eval);
+  }
+
+  printf("%"PRIu32" values checked (%"PRIu32" evaluation errors)\n", NUM_TERMS * NUM_MODELS, failed);
+
+  free(val);
+  delete_batch_evaluator(&batch);
+  for (j=0; j<NUM_MODELS; j++) {
+    yices_free_model(models[j]);
+  }
+  yices_exit();
+
+  if (errors > 0) {
+    printf("%"PRIu32" errors\n", errors);
+    return 1;
+  }
+  printf("all values agree\n");
+  return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE TWO-LEVEL AND REWRITING IN THE BIT BLASTER
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "solvers/bv/bit_blaster.h"
+#include "solvers/bv/remap_table.h"
+#include "solvers/cdcl/smt_core.h"
+
+
+/*
+ * Null theory for a pure SAT core
+ */
+static void do_nothing(void *t) {
+}
+
+static void null_backtrack(void *t, uint32_t back_level) {
+}
+
+static fcheck_code_t null_final_check(void *t) {
+  return FCHECK_SAT;
+}
+
+static bool empty_propagate(void *t) {
+  return true;
+}
+
+static th_ctrl_interface_t null_theory_ctrl = {
+  do_nothing,       // start_internalization
+  do_nothing,       // start_search
+  empty_propagate,  // propagate
+  null_final_check, // final_check
+  do_nothing,       // increase_dlevel
+  null_backtrack,   // backtrack
+  do_nothing,       // push
+  do_nothing,       // pop
+  do_nothing,       // reset
+  do_nothing,       // clear
+};
+
+static th_smt_interface_t null_theory_smt = {
+  NULL,            // assert_atom
+  NULL,            // expand explanation
+  NULL,            // select polarity
+  NULL,            // delete_atom
+  NULL,            // end_deletion
+};
+
+
+static smt_core_t core;
+static remap_table_t remap;
+static bit_blaster_t blaster;
+
+static literal_t new_lit(void) {
+  return bit_blaster_fresh_literal(&blaster);
+}
+
+static literal_t and2(literal_t a, literal_t b) {
+  return bit_blaster_make_and2(&blaster, a, b);
+}
+
+static void check(const char *rule, literal_t got, literal_t expected) {
+  printf("%-14s: got %"PRId32", expected %"PRId32"\n", rule, got, expected);
+  if (got != expected) {
+    printf("BUG: %s rule failed\n", rule);
+    exit(1);
+  }
+}
+
+static void test_rules(void) {
+  literal_t x, y, z, g, h;
+  uint32_t nvars;
+
+  x = new_lit();
+  y = new_lit();
+  z = new_lit();
+  g = and2(x, y);
+
+  check("contradiction", and2(g, not(x)), false_literal);
+  check("contradiction", and2(not(y), g), false_literal);
+  check("contradiction", and2(g, and2(not(x), z)), false_literal);
+  check("idempotence", and2(g, x), g);
+  check("idempotence", and2(y, g), g);
+  check("subsumption", and2(not(g), not(x)), not(x));
+  h = and2(not(y), z);
+  check("subsumption", and2(not(g), h), h);
+
+  // substitution creates (and x (not y)): new gate
+  nvars = num_vars(&core);
+  h = and2(not(g), x);
+  check("substitution", h, and2(x, not(y)));
+  check("new gates", num_vars(&core), nvars + 1);
+
+  // resolution: (and (not (and x y)) (not (and x (not y)))) = (not x)
+  check("resolution", and2(not(g), not(h)), not(x));
+
+  // hash consing is not affected
+  check("hash consing", and2(y, x), g);
+}
+
+/*
+ * Gates created after a push are removed on pop. The variable
+ * index can then be reused, so the rewriting must not use the
+ * stale definition.
+ */
+static void test_push_pop(void) {
+  literal_t x, y, g, l;
+
+  x = new_lit();
+  y = new_lit();
+
+  smt_push(&core);
+  g = and2(x, y);
+  check("before pop", and2(g, not(x)), false_literal);
+  smt_pop(&core);
+
+  l = new_lit();
+  if (var_of(l) != var_of(g)) {
+    printf("(variable index not reused)\n");
+  }
+  check("after pop", and2(l, not(x)) == false_literal, false);
+}
+
+int main(void) {
+  init_smt_core(&core, 0, NULL, &null_theory_ctrl, &null_theory_smt, SMT_MODE_PUSHPOP);
+  init_remap_table(&remap);
+  init_bit_blaster(&blaster, &core, &remap);
+
+  test_rules();
+  test_push_pop();
+
+  delete_bit_blaster(&blaster);
+  delete_remap_table(&remap);
+  delete_smt_core(&core);
+
+  printf("All tests passed\n");
+  return 0;
+}
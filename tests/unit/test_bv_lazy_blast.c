@@ -0,0 +1,203 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST LAZY BIT-BLASTING: solve problems with wide multiplications
+ * and divisions with and without the bv-lazy-blast parameter. The
+ * results must agree and every model must satisfy the assertions.
+ * Some problems are solved under push/pop to check that the
+ * refinements are undone properly.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+#define NUM_PROBLEMS 10
+
+static term_t x, y, z;
+static term_t problem[NUM_PROBLEMS];
+
+static term_t bvconst(uint32_t n, uint64_t c) {
+  return yices_bvconst_uint64(n, c);
+}
+
+static void build_problems(uint32_t n) {
+  type_t tau;
+
+  tau = yices_bv_type(n);
+  x = yices_new_uninterpreted_term(tau);
+  y = yices_new_uninterpreted_term(tau);
+  z = yices_new_uninterpreted_term(tau);
+
+  // factoring: x * y = 123456 with x, y > 16 (sat)
+  problem[0] = yices_and3(yices_bveq_atom(yices_bvmul(x, y), bvconst(n, 123456)),
+                          yices_bvgt_atom(x, bvconst(n, 16)),
+                          yices_bvgt_atom(y, bvconst(n, 16)));
+  // x * y = y * x is valid: negation is unsat
+  problem[1] = yices_bvneq_atom(yices_bvmul(x, y), yices_bvmul(y, x));
+  // quotient and remainder of 12345 by 100 (unsat)
+  problem[2] = yices_and3(yices_bveq_atom(x, bvconst(n, 12345)),
+                          yices_and2(yices_bvgt_atom(y, bvconst(n, 99)), yices_bvlt_atom(y, bvconst(n, 101))),
+                          yices_or2(yices_bvneq_atom(yices_bvdiv(x, y), bvconst(n, 123)),
+                                    yices_bvneq_atom(yices_bvrem(x, y), bvconst(n, 45))));
+  // remainder is smaller than the divisor (unsat)
+  problem[3] = yices_and3(yices_bveq_atom(x, bvconst(n, 12345)),
+                          yices_bvneq_atom(y, bvconst(n, 0)),
+                          yices_bvge_atom(yices_bvrem(x, y), y));
+  // quotient and remainder constraints (sat)
+  problem[4] = yices_and3(yices_bveq_atom(yices_bvdiv(x, y), bvconst(n, 7)),
+                          yices_bveq_atom(yices_bvrem(x, y), bvconst(n, 3)),
+                          yices_bvgt_atom(y, bvconst(n, 100)));
+  // division by zero (sat)
+  problem[5] = yices_and2(yices_bveq_atom(y, bvconst(n, 0)),
+                          yices_bveq_atom(z, yices_bvdiv(x, y)));
+  // signed remainder with a negative divisor (sat)
+  problem[6] = yices_and2(yices_bveq_atom(yices_bvsrem(x, y), bvconst(n, 5)),
+                          yices_bvslt_atom(y, bvconst(n, 0)));
+  // signed remainder has the sign of the dividend (unsat)
+  problem[7] = yices_and3(yices_bvsgt_atom(yices_bvsrem(x, y), bvconst(n, 0)),
+                          yices_bveq_atom(x, yices_bvneg(bvconst(n, 12345))),
+                          yices_bvneq_atom(y, bvconst(n, 0)));
+  // distributivity (unsat)
+  problem[8] = yices_bvneq_atom(yices_bvmul(x, yices_bvadd(y, z)),
+                                yices_bvadd(yices_bvmul(x, y), yices_bvmul(x, z)));
+  // square root of a constant (sat)
+  problem[9] = yices_and2(yices_bveq_atom(yices_bvmul(x, x), bvconst(n, 1369)),
+                          yices_bvlt_atom(x, bvconst(n, 100)));
+}
+
+/*
+ * Check problem i in ctx using params
+ * - if sat, check the model
+ */
+static smt_status_t check_problem(context_t *ctx, param_t *params, uint32_t i) {
+  model_t *mdl;
+  smt_status_t stat;
+
+  stat = yices_check_context(ctx, params);
+  if (stat == STATUS_SAT) {
+    mdl = yices_get_model(ctx, true);
+    if (yices_formula_true_in_model(mdl, problem[i]) != 1) {
+      printf("BUG: incorrect model for problem %"PRIu32"\n", i);
+      yices_print_model(stdout, mdl);
+      exit(1);
+    }
+    yices_free_model(mdl);
+  } else if (stat != STATUS_UNSAT) {
+    printf("BUG: unexpected status for problem %"PRIu32"\n", i);
+    exit(1);
+  }
+
+  return stat;
+}
+
+static smt_status_t solve(uint32_t i, bool lazy) {
+  ctx_config_t *config;
+  context_t *ctx;
+  param_t *params;
+  smt_status_t stat;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, "QF_BV");
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+
+  params = yices_new_param_record();
+  yices_default_params_for_context(ctx, params);
+  yices_set_param(params, "bv-lazy-blast", lazy ? "true" : "false");
+
+  yices_assert_formula(ctx, problem[i]);
+  stat = check_problem(ctx, params, i);
+
+  yices_free_param_record(params);
+  yices_free_context(ctx);
+
+  return stat;
+}
+
+/*
+ * Solve all problems in sequence in the same context
+ * using push/pop. Compare with the expected status.
+ */
+static void solve_incremental(const smt_status_t *expected) {
+  ctx_config_t *config;
+  context_t *ctx;
+  param_t *params;
+  smt_status_t stat;
+  uint32_t i;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, "QF_BV");
+  yices_set_config(config, "mode", "push-pop");
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+
+  params = yices_new_param_record();
+  yices_default_params_for_context(ctx, params);
+  yices_set_param(params, "bv-lazy-blast", "true");
+
+  for (i=0; i<NUM_PROBLEMS; i++) {
+    yices_push(ctx);
+    yices_assert_formula(ctx, problem[i]);
+    stat = check_problem(ctx, params, i);
+    if (stat != expected[i]) {
+      printf("BUG: incremental status differs for problem %"PRIu32"\n", i);
+      exit(1);
+    }
+    yices_pop(ctx);
+  }
+
+  yices_free_param_record(params);
+  yices_free_context(ctx);
+}
+
+static void test_width(uint32_t n) {
+  smt_status_t eager[NUM_PROBLEMS];
+  smt_status_t lazy;
+  uint32_t i;
+
+  printf("--- bitvector width %"PRIu32" ---\n", n);
+  build_problems(n);
+  for (i=0; i<NUM_PROBLEMS; i++) {
+    eager[i] = solve(i, false);
+    lazy = solve(i, true);
+    printf("problem %"PRIu32": %s\n", i, lazy == STATUS_SAT ? "sat" : "unsat");
+    if (eager[i] != lazy) {
+      printf("BUG: lazy and eager bit-blasting disagree on problem %"PRIu32"\n", i);
+      exit(1);
+    }
+  }
+  solve_incremental(eager);
+}
+
+int main(void) {
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  test_width(16);
+  test_width(24);
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
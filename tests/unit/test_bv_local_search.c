@@ -0,0 +1,146 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE WORD-LEVEL LOCAL SEARCH: easy satisfiable problems must
+ * be solved and the model must satisfy the assertions. Unsatisfiable
+ * problems and problems with unsupported terms must fail.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "api/yices_extensions.h"
+#include "yices.h"
+
+#define MAX_MOVES 10000
+
+static term_t bvconst(uint32_t n, uint64_t c) {
+  return yices_bvconst_uint64(n, c);
+}
+
+static term_t bvvar(uint32_t n) {
+  return yices_new_uninterpreted_term(yices_bv_type(n));
+}
+
+/*
+ * Run local search on a[0 ... n-1]: check the result
+ */
+static void test_problem(const char *name, uint32_t n, term_t *a, bool expected) {
+  model_t *mdl;
+  uint32_t i;
+  bool found;
+
+  printf("%-24s: ", name);
+  mdl = NULL;
+  found = local_search_assertions(a, n, MAX_MOVES, &mdl);
+  printf("%s\n", found ? "model found" : "no model");
+  if (found != expected) {
+    printf("BUG: unexpected result\n");
+    exit(1);
+  }
+  if (found) {
+    for (i=0; i<n; i++) {
+      if (yices_formula_true_in_model(mdl, a[i]) != 1) {
+        printf("BUG: assertion %"PRIu32" is false in the model\n", i);
+        yices_print_model(stdout, mdl);
+        exit(1);
+      }
+    }
+    yices_free_model(mdl);
+  }
+}
+
+static void test_sat(void) {
+  term_t x, y, z, p;
+  term_t a[4];
+
+  x = bvvar(32);
+  y = bvvar(32);
+  z = bvvar(16);
+  p = yices_new_uninterpreted_term(yices_bool_type());
+
+  // linear equations
+  a[0] = yices_bveq_atom(yices_bvadd(x, y), bvconst(32, 1000));
+  a[1] = yices_bveq_atom(yices_bvmul(bvconst(32, 3), x), bvconst(32, 12));
+  test_problem("linear", 2, a, true);
+
+  // even coefficient
+  a[0] = yices_bveq_atom(yices_bvmul(bvconst(32, 12), x), bvconst(32, 48));
+  a[1] = yices_bvgt_atom(x, bvconst(32, 4));
+  test_problem("even coefficient", 2, a, true);
+
+  // product and comparisons
+  a[0] = yices_bveq_atom(yices_bvmul(x, y), bvconst(32, 77));
+  a[1] = yices_bvlt_atom(x, bvconst(32, 100));
+  a[2] = yices_bvslt_atom(y, bvconst(32, 0));
+  test_problem("product", 3, a, true);
+
+  // bit extraction and concatenation
+  a[0] = yices_bveq_atom(yices_bvconcat2(z, yices_bvextract(x, 0, 15)), bvconst(32, 0xABCD1234));
+  a[1] = yices_bitextract(y, 7);
+  test_problem("extract/concat", 2, a, true);
+
+  // Boolean structure, ite, shifts, division
+  a[0] = yices_or2(p, yices_bveq_atom(z, bvconst(16, 5)));
+  a[1] = yices_not(p);
+  a[2] = yices_bveq_atom(yices_ite(p, x, yices_bvshl(y, bvconst(32, 4))), bvconst(32, 0x340));
+  a[3] = yices_bveq_atom(yices_bvdiv(x, bvconst(32, 10)), bvconst(32, 9));
+  test_problem("mixed", 4, a, true);
+}
+
+static void test_no_model(void) {
+  term_t x, u, i;
+  term_t a[2];
+
+  x = bvvar(8);
+
+  // unsat: search must give up
+  a[0] = yices_bvgt_atom(x, bvconst(8, 200));
+  a[1] = yices_bvlt_atom(x, bvconst(8, 100));
+  test_problem("unsat", 2, a, false);
+
+  // false assertion
+  a[0] = yices_false();
+  test_problem("false", 1, a, false);
+
+  // wide bitvectors are not supported
+  u = bvvar(100);
+  a[0] = yices_bveq_atom(u, yices_bvconst_one(100));
+  test_problem("wide bitvector", 1, a, false);
+
+  // arithmetic is not supported
+  i = yices_new_uninterpreted_term(yices_int_type());
+  a[0] = yices_arith_gt0_atom(i);
+  test_problem("arithmetic", 1, a, false);
+}
+
+int main(void) {
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  test_sat();
+  test_no_model();
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
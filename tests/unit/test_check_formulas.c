@@ -79,6 +79,7 @@ int main(void) {
   test("cadical");
   test("cryptominisat");
   test("y2sat");
+  test("y2sat-cubes");
   test(NULL);
   yices_exit();
   return 0;
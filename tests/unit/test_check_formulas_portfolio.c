@@ -0,0 +1,150 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST PORTFOLIO CHECK: yices_check_formulas_portfolio must agree
+ * with yices_check_formulas for any number of workers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+#define NUM_FORMULAS 3
+static term_t formula[NUM_FORMULAS];
+
+static term_t new_var(type_t tau, const char *name) {
+  term_t t = yices_new_uninterpreted_term(tau);
+  yices_set_term_name(t, name);
+  return t;
+}
+
+// same formulas as in test_check_formulas.c
+static void build_bv_formulas(void) {
+  type_t bv = yices_bv_type(20);
+  term_t x = new_var(bv, "x");
+  term_t y = new_var(bv, "y");
+  term_t z = new_var(bv, "z");
+
+  formula[0] = yices_bveq_atom(yices_bvmul(x, y), yices_bvconst_uint32(20, 12289));
+  formula[1] = yices_bveq_atom(yices_bvmul(y, z), yices_bvconst_uint32(20, 20031));
+  formula[2] = yices_bveq_atom(yices_bvmul(x, z), yices_bvconst_uint32(20, 10227));
+}
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_UNKNOWN: return "unknown";
+  case YICES_STATUS_INTERRUPTED: return "interrupted";
+  case STATUS_ERROR: return "error";
+  default: return "other";
+  }
+}
+
+/*
+ * Check f[0 ... n-1] with nworkers and compare with the sequential check
+ * - if the result is sat, check that the model satisfies all formulas
+ */
+static void test_portfolio(const term_t *f, uint32_t n, const char *logic, uint32_t nworkers) {
+  smt_status_t expected, status;
+  model_t *model;
+
+  expected = yices_check_formulas(f, n, logic, NULL, NULL);
+  model = NULL;
+  status = yices_check_formulas_portfolio(f, n, logic, &model, nworkers);
+  printf("%s: %"PRIu32" formulas, %"PRIu32" workers: %s (expected %s)\n",
+	 logic, n, nworkers, status2string(status), status2string(expected));
+  fflush(stdout);
+
+  if (status != expected) {
+    printf("BUG: portfolio and sequential check disagree\n");
+    exit(1);
+  }
+  if (status == STATUS_SAT) {
+    if (model == NULL) {
+      printf("BUG: no model\n");
+      exit(1);
+    }
+    if (yices_formulas_true_in_model(model, n, f) != 1) {
+      printf("BUG: invalid model\n");
+      exit(1);
+    }
+    yices_free_model(model);
+  }
+}
+
+static void test_errors(void) {
+  smt_status_t status;
+
+  status = yices_check_formulas_portfolio(formula, 1, "QF_BV", NULL, 0);
+  if (status != STATUS_ERROR || yices_error_code() != CTX_INVALID_PARAMETER_VALUE) {
+    printf("BUG: expected error for 0 workers\n");
+    exit(1);
+  }
+  status = yices_check_formulas_portfolio(formula, 1, "QF_BV", NULL, 100);
+  if (status != STATUS_ERROR || yices_error_code() != CTX_INVALID_PARAMETER_VALUE) {
+    printf("BUG: expected error for 100 workers\n");
+    exit(1);
+  }
+  status = yices_check_formulas_portfolio(formula, 1, "NOT_A_LOGIC", NULL, 2);
+  if (status != STATUS_ERROR || yices_error_code() != CTX_UNKNOWN_LOGIC) {
+    printf("BUG: expected error for unknown logic\n");
+    exit(1);
+  }
+  yices_clear_error();
+}
+
+int main(void) {
+  uint32_t n, w;
+  type_t int_type;
+  term_t a, b, lia[3];
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  printf("Thread safe: %s\n", yices_is_thread_safe() ? "yes" : "no");
+  yices_init();
+
+  build_bv_formulas();
+  for (n=1; n<=NUM_FORMULAS; n++) {
+    for (w=1; w<=8; w *= 2) {
+      test_portfolio(formula, n, "QF_BV", w);
+    }
+  }
+
+  // small LIA problem: 2a + 4b = 7 is unsat over the integers
+  int_type = yices_int_type();
+  a = new_var(int_type, "a");
+  b = new_var(int_type, "b");
+  lia[0] = yices_arith_geq0_atom(a);
+  lia[1] = yices_arith_geq0_atom(b);
+  lia[2] = yices_arith_eq_atom(yices_add(yices_mul(yices_int32(2), a), yices_mul(yices_int32(4), b)), yices_int32(7));
+  for (w=1; w<=8; w *= 2) {
+    test_portfolio(lia, 2, "QF_LIA", w);
+    test_portfolio(lia, 3, "QF_LIA", w);
+  }
+
+  test_errors();
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST CLAUSE EXCHANGE (single-threaded)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "solvers/cdcl/clause_exchange.h"
+
+static void check(bool cond, const char *msg) {
+  if (! cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static bool same_clause(ivector_t *v, uint32_t n, const literal_t *a) {
+  uint32_t i;
+
+  if (v->size != n) return false;
+  for (i=0; i<n; i++) {
+    if (v->data[i] != a[i]) return false;
+  }
+  return true;
+}
+
+
+/*
+ * Three workers: worker 0 exports, 1 and 2 import
+ */
+static void test_basic(void) {
+  clause_exchange_t x;
+  clause_port_t port[3];
+  ivector_t v;
+  literal_t a[3] = { 4, 7, 11 };
+  literal_t b[1] = { 9 };
+  uint32_t i;
+
+  init_clause_exchange(&x, 3);
+  for (i=0; i<3; i++) {
+    init_clause_port(port + i, &x, i);
+  }
+  init_ivector(&v, 10);
+
+  // not active until all workers registered
+  clause_port_register(port + 0, 100);
+  clause_port_register(port + 1, 100);
+  check(! clause_port_is_active(port + 0), "active before registration");
+  clause_port_register(port + 2, 100);
+  for (i=0; i<3; i++) {
+    check(clause_port_is_active(port + i), "not active after registration");
+  }
+
+  check(clause_port_var_is_shared(port, 99), "var 99 not shared");
+  check(! clause_port_var_is_shared(port, 100), "var 100 shared");
+  check(clause_port_accepts(port, 3, 2), "short clause rejected");
+  check(! clause_port_accepts(port, DEF_SHARE_MAX_LENGTH + 1, 2), "long clause accepted");
+  check(! clause_port_accepts(port, 3, DEF_SHARE_MAX_LBD + 1), "high lbd accepted");
+
+  clause_port_export(port + 0, 3, a);
+  clause_port_export(port + 0, 1, b);
+
+  // worker 0 doesn't see its own clauses
+  check(! clause_port_import(port + 0, &v), "self import");
+
+  for (i=1; i<3; i++) {
+    check(clause_port_import(port + i, &v) && same_clause(&v, 3, a), "bad first clause");
+    check(clause_port_import(port + i, &v) && same_clause(&v, 1, b), "bad second clause");
+    check(! clause_port_import(port + i, &v), "extra clause");
+    check(port[i].imported == 2, "bad import count");
+  }
+  check(port[0].exported == 2, "bad export count");
+
+  delete_ivector(&v);
+  for (i=0; i<3; i++) {
+    delete_clause_port(port + i);
+  }
+  delete_clause_exchange(&x);
+}
+
+
+/*
+ * Workers that disagree on the number of variables don't share
+ */
+static void test_mismatch(void) {
+  clause_exchange_t x;
+  clause_port_t port[2];
+
+  init_clause_exchange(&x, 2);
+  init_clause_port(port + 0, &x, 0);
+  init_clause_port(port + 1, &x, 1);
+  clause_port_register(port + 0, 100);
+  clause_port_register(port + 1, 101);
+  check(! clause_port_is_active(port + 0) && ! clause_port_is_active(port + 1), "active after mismatch");
+  delete_clause_port(port + 0);
+  delete_clause_port(port + 1);
+  delete_clause_exchange(&x);
+}
+
+
+/*
+ * A reader that falls behind loses clauses but gets the new ones
+ */
+static void test_overflow(void) {
+  clause_exchange_t x;
+  clause_port_t port[2];
+  ivector_t v;
+  literal_t a[4];
+  uint32_t i, n;
+
+  init_clause_exchange(&x, 2);
+  init_clause_port(port + 0, &x, 0);
+  init_clause_port(port + 1, &x, 1);
+  clause_port_register(port + 0, 1000);
+  clause_port_register(port + 1, 1000);
+  check(clause_port_is_active(port + 0), "not active");
+  check(clause_port_is_active(port + 1), "not active");
+  init_ivector(&v, 10);
+
+  // each clause takes 5 words: write more than the capacity
+  n = CLAUSE_RING_CAPACITY/5 + 10;
+  for (i=0; i<n; i++) {
+    a[0] = 2*i; a[1] = 2*i+1; a[2] = 2*i+2; a[3] = 2*i+3;
+    clause_port_export(port + 0, 4, a);
+  }
+  check(! clause_port_import(port + 1, &v), "import after overflow");
+  check(port[1].dropped == 1, "overflow not detected");
+
+  a[0] = 1; a[1] = 3; a[2] = 5; a[3] = 7;
+  clause_port_export(port + 0, 4, a);
+  check(clause_port_import(port + 1, &v) && same_clause(&v, 4, a), "bad clause after overflow");
+
+  delete_ivector(&v);
+  delete_clause_port(port + 0);
+  delete_clause_port(port + 1);
+  delete_clause_exchange(&x);
+}
+
+
+int main(void) {
+  test_basic();
+  test_mismatch();
+  test_overflow();
+  printf("All tests passed\n");
+  return 0;
+}
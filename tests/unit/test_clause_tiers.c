@@ -0,0 +1,145 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST OF TIER-BASED CLAUSE DELETION IN SMT_CORE
+ * - random 3-SAT problems are solved with frequent calls to reduce_clause_database
+ * - clauses in the core tier must survive all reductions
+ * - the models must satisfy all clauses
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "random_cnf.h"
+#include "utils/pointer_vectors.h"
+
+
+/*
+ * Header of a learned clause
+ */
+static learned_clause_t *header(clause_t *cl) {
+  return (learned_clause_t *)(((char *) cl) - offsetof(learned_clause_t, clause));
+}
+
+
+/*
+ * Collect the core-tier clauses of core into v
+ */
+static void collect_core_tier(smt_core_t *core, pvector_t *v) {
+  clause_t **lc;
+  uint32_t i, n;
+
+  pvector_reset(v);
+  lc = core->learned_clauses;
+  n = get_cv_size(lc);
+  for (i=0; i<n; i++) {
+    if (header(lc[i])->lbd <= TIER_CORE_LBD) {
+      pvector_push(v, lc[i]);
+    }
+  }
+}
+
+/*
+ * Check that all clauses in v are still in the learned clauses
+ */
+static void check_core_tier(smt_core_t *core, pvector_t *v) {
+  clause_t **lc;
+  uint32_t i, j, n;
+
+  lc = core->learned_clauses;
+  n = get_cv_size(lc);
+  for (i=0; i<v->size; i++) {
+    for (j=0; j<n; j++) {
+      if (lc[j] == v->data[i]) break;
+    }
+    if (j == n) {
+      printf("BUG: core-tier clause deleted\n");
+      exit(1);
+    }
+  }
+}
+
+
+/*
+ * Clause deletion: check that the core-tier clauses survive
+ */
+typedef struct reduce_state_s {
+  pvector_t kept;
+  uint32_t reductions;
+} reduce_state_t;
+
+static void reduce_and_check(smt_core_t *core, void *aux) {
+  reduce_state_t *r;
+
+  r = aux;
+  collect_core_tier(core, &r->kept);
+  reduce_clause_database(core);
+  check_core_tier(core, &r->kept);
+  r->reductions ++;
+}
+
+
+/*
+ * Solve with Minisat-like restarts and frequent reductions
+ */
+static void test_problem(uint32_t nvars, uint32_t nclauses) {
+  smt_core_t core;
+  reduce_state_t state;
+  literal_t *a;
+  smt_status_t stat;
+
+  a = random_problem(nvars, nclauses, false);
+  init_random_problem_core(&core, nvars, nclauses, a);
+  init_pvector(&state.kept, 0);
+  state.reductions = 0;
+
+  stat = search_random_problem(&core, 100, reduce_and_check, &state);
+
+  printf("%"PRIu32" vars, %"PRIu32" clauses: %s, %"PRIu64" conflicts, %"PRIu32" reductions, "
+         "%"PRIu32" learned clauses, %"PRIu64" LBD updates\n",
+         nvars, nclauses, status2string(stat), num_conflicts(&core),
+         state.reductions, num_learned_clauses(&core), core.stats.lbd_updates);
+  fflush(stdout);
+
+  if (stat == STATUS_SAT && !all_clauses_true(&core)) {
+    printf("BUG: invalid model\n");
+    exit(1);
+  }
+
+  delete_pvector(&state.kept);
+  delete_smt_core(&core);
+  free(a);
+}
+
+
+int main(void) {
+  uint32_t i;
+
+  srandom(2468);
+  for (i=0; i<10; i++) {
+    test_problem(150, 640);
+  }
+
+  printf("All tests passed\n");
+  return 0;
+}
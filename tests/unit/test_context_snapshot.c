@@ -0,0 +1,319 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST CONTEXT SNAPSHOTS: assert formulas in a QF_BV context, save it
+ * with yices_save_context_snapshot, restore it in a new context with
+ * yices_load_context_snapshot, and check that both contexts give the
+ * same result. The model of the restored context must satisfy the
+ * restored formulas.
+ *
+ * Also check the error codes and that corrupted snapshots with a
+ * valid checksum are either rejected or restored into a context that
+ * can be checked.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "utils/hash_functions.h"
+#include "yices.h"
+
+#define SNAPSHOT_FILE "test_context_snapshot.snap"
+
+#define NUM_SAT 5
+#define NUM_UNSAT 3
+static term_t sat_formula[NUM_SAT];
+static term_t unsat_formula[NUM_UNSAT];
+
+static void build_formulas(void) {
+  type_t bv8;
+  term_t x, y, z, b;
+
+  bv8 = yices_bv_type(8);
+  x = yices_new_uninterpreted_term(bv8);
+  yices_set_term_name(x, "x");
+  y = yices_new_uninterpreted_term(bv8);
+  yices_set_term_name(y, "y");
+  z = yices_new_uninterpreted_term(bv8);
+  yices_set_term_name(z, "z");
+  b = yices_new_uninterpreted_term(yices_bool_type());
+  yices_set_term_name(b, "b");
+
+  // x + y = z, x < y, z /= 0, b => x[0], x * 3 = y or b
+  sat_formula[0] = yices_eq(yices_bvadd(x, y), z);
+  sat_formula[1] = yices_bvlt_atom(x, y);
+  sat_formula[2] = yices_neq(z, yices_bvconst_uint32(8, 0));
+  sat_formula[3] = yices_implies(b, yices_bitextract(x, 0));
+  sat_formula[4] = yices_or2(yices_eq(yices_bvmul(x, yices_bvconst_uint32(8, 3)), y), b);
+
+  // x < y, y < z, z < x
+  unsat_formula[0] = yices_bvlt_atom(x, y);
+  unsat_formula[1] = yices_bvlt_atom(y, z);
+  unsat_formula[2] = yices_bvlt_atom(z, x);
+}
+
+static context_t *new_context(const char *logic, const char *mode) {
+  ctx_config_t *config;
+  context_t *ctx;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, logic);
+  if (mode != NULL) {
+    yices_set_config(config, "mode", mode);
+  }
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL) {
+    printf("BUG: failed to create a context for %s\n", logic);
+    yices_print_error(stdout);
+    exit(1);
+  }
+  return ctx;
+}
+
+static void expect_error(int32_t code, error_code_t expected, const char *msg) {
+  if (code >= 0 || yices_error_code() != expected) {
+    printf("BUG: %s\n", msg);
+    yices_print_error(stdout);
+    exit(1);
+  }
+  yices_clear_error();
+}
+
+static void save_context(context_t *ctx, uint32_t n, const term_t *f) {
+  if (yices_assert_formulas(ctx, n, f) < 0 ||
+      yices_save_context_snapshot(ctx, SNAPSHOT_FILE, n, f) < 0) {
+    printf("BUG: failed to save the context\n");
+    yices_print_error(stdout);
+    exit(1);
+  }
+}
+
+/*
+ * Save then restore the context for f[0 ... n-1]
+ */
+static void test_round_trip(uint32_t n, const term_t *f, smt_status_t expected) {
+  context_t *ctx, *copy;
+  term_vector_t v;
+  model_t *mdl;
+  smt_status_t s1, s2;
+  uint32_t i;
+
+  ctx = new_context("QF_BV", NULL);
+  save_context(ctx, n, f);
+
+  copy = new_context("QF_BV", NULL);
+  yices_init_term_vector(&v);
+  if (yices_load_context_snapshot(copy, SNAPSHOT_FILE, &v) < 0) {
+    printf("BUG: failed to load the context\n");
+    yices_print_error(stdout);
+    exit(1);
+  }
+  if (v.size != n) {
+    printf("BUG: expected %"PRIu32" formulas, got %"PRIu32"\n", n, v.size);
+    exit(1);
+  }
+
+  s1 = yices_check_context(ctx, NULL);
+  s2 = yices_check_context(copy, NULL);
+  printf("original: %d, restored: %d\n", (int) s1, (int) s2);
+  if (s1 != expected || s2 != expected) {
+    printf("BUG: unexpected status\n");
+    exit(1);
+  }
+
+  if (s2 == STATUS_SAT) {
+    mdl = yices_get_model(copy, true);
+    for (i=0; i<n; i++) {
+      if (yices_formula_true_in_model(mdl, v.data[i]) != 1) {
+        printf("BUG: restored formula %"PRIu32" is false in the model\n", i);
+        exit(1);
+      }
+    }
+    yices_free_model(mdl);
+  }
+
+  yices_delete_term_vector(&v);
+  yices_free_context(copy);
+  yices_free_context(ctx);
+}
+
+static void test_errors(void) {
+  context_t *ctx;
+  term_vector_t v;
+
+  yices_init_term_vector(&v);
+
+  // contexts that can't be saved
+  ctx = new_context("QF_LIA", NULL);
+  expect_error(yices_save_context_snapshot(ctx, SNAPSHOT_FILE, 0, NULL), SNAPSHOT_UNSUPPORTED_CONTEXT,
+               "saved a QF_LIA context");
+  yices_free_context(ctx);
+
+  ctx = new_context("QF_BV", NULL);
+  yices_assert_formulas(ctx, NUM_SAT, sat_formula);
+  yices_check_context(ctx, NULL);
+  expect_error(yices_save_context_snapshot(ctx, SNAPSHOT_FILE, NUM_SAT, sat_formula), SNAPSHOT_UNSUPPORTED_CONTEXT,
+               "saved a context after check");
+  yices_free_context(ctx);
+
+  // configuration mismatch or non-empty context
+  ctx = new_context("QF_BV", NULL);
+  save_context(ctx, NUM_SAT, sat_formula);
+  yices_free_context(ctx);
+
+  ctx = new_context("QF_BV", "one-shot");
+  expect_error(yices_load_context_snapshot(ctx, SNAPSHOT_FILE, &v), SNAPSHOT_UNSUPPORTED_CONTEXT,
+               "loaded into a context with a different mode");
+  yices_free_context(ctx);
+
+  ctx = new_context("QF_BV", NULL);
+  yices_assert_formula(ctx, unsat_formula[0]);
+  expect_error(yices_load_context_snapshot(ctx, SNAPSHOT_FILE, &v), SNAPSHOT_UNSUPPORTED_CONTEXT,
+               "loaded into a non-empty context");
+  yices_free_context(ctx);
+
+  // term-only snapshot
+  if (yices_save_snapshot(SNAPSHOT_FILE, NUM_SAT, sat_formula) < 0) {
+    printf("BUG: failed to save a term snapshot\n");
+    exit(1);
+  }
+  ctx = new_context("QF_BV", NULL);
+  expect_error(yices_load_context_snapshot(ctx, SNAPSHOT_FILE, &v), SNAPSHOT_FORMAT_ERROR,
+               "loaded a term snapshot as a context snapshot");
+  yices_free_context(ctx);
+
+  if (v.size != 0) {
+    printf("BUG: formulas restored on error\n");
+    exit(1);
+  }
+  yices_delete_term_vector(&v);
+}
+
+/*
+ * Mutations of a snapshot (as in test_term_snapshot): change each word
+ * of the body, fix the checksum, and load into a new context.
+ */
+#define HEADER_SIZE 11
+#define NUM_MUTATIONS 5
+
+static uint32_t mutate(uint32_t x, uint32_t k) {
+  switch (k) {
+  case 0: return x + 1;
+  case 1: return x - 1;
+  case 2: return 0;
+  case 3: return 2;
+  default: return UINT32_MAX;
+  }
+}
+
+static void write_words(const uint32_t *a, uint32_t n) {
+  FILE *f;
+
+  f = fopen(SNAPSHOT_FILE, "w");
+  if (f == NULL || fwrite(a, sizeof(uint32_t), n, f) != n) {
+    perror(SNAPSHOT_FILE);
+    exit(1);
+  }
+  fclose(f);
+}
+
+static void test_malformed(void) {
+  context_t *ctx;
+  term_vector_t v;
+  uint32_t *a;
+  uint32_t i, k, n, x, nok;
+  smt_status_t status;
+  long size;
+  FILE *f;
+
+  ctx = new_context("QF_BV", NULL);
+  save_context(ctx, NUM_SAT, sat_formula);
+  yices_free_context(ctx);
+
+  f = fopen(SNAPSHOT_FILE, "r");
+  if (f == NULL) {
+    perror(SNAPSHOT_FILE);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  rewind(f);
+  n = size/sizeof(uint32_t);
+  a = (uint32_t *) malloc(n * sizeof(uint32_t));
+  if (a == NULL || fread(a, sizeof(uint32_t), n, f) != n || n <= HEADER_SIZE || a[9] != n - HEADER_SIZE) {
+    printf("BUG: can't read the snapshot\n");
+    exit(1);
+  }
+  fclose(f);
+
+  nok = 0;
+  yices_init_term_vector(&v);
+  for (i=HEADER_SIZE; i<n; i++) {
+    x = a[i];
+    for (k=0; k<NUM_MUTATIONS; k++) {
+      a[i] = mutate(x, k);
+      a[10] = jenkins_hash_array(a + HEADER_SIZE, n - HEADER_SIZE, 0x1234);
+      write_words(a, n);
+      ctx = new_context("QF_BV", NULL);
+      if (yices_load_context_snapshot(ctx, SNAPSHOT_FILE, &v) == 0) {
+        nok ++;
+        status = yices_check_context(ctx, NULL);
+        if (status != STATUS_SAT && status != STATUS_UNSAT) {
+          printf("BUG: bad status for a restored context\n");
+          yices_print_error(stdout);
+          exit(1);
+        }
+      } else if (yices_error_code() != SNAPSHOT_FORMAT_ERROR && yices_error_code() != SNAPSHOT_UNSUPPORTED_CONTEXT) {
+        printf("BUG: unexpected error code for a corrupted snapshot\n");
+        yices_print_error(stdout);
+        exit(1);
+      }
+      yices_clear_error();
+      yices_free_context(ctx);
+    }
+    a[i] = x;
+  }
+  yices_delete_term_vector(&v);
+  free(a);
+
+  printf("%"PRIu32" mutations: %"PRIu32" restored, %"PRIu32" rejected\n",
+         (n - HEADER_SIZE) * NUM_MUTATIONS, nok, (n - HEADER_SIZE) * NUM_MUTATIONS - nok);
+}
+
+int main(void) {
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  build_formulas();
+  test_round_trip(NUM_SAT, sat_formula, STATUS_SAT);
+  test_round_trip(NUM_UNSAT, unsat_formula, STATUS_UNSAT);
+  test_round_trip(0, NULL, STATUS_SAT);
+  test_errors();
+  test_malformed();
+  remove(SNAPSHOT_FILE);
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
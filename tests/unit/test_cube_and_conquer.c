@@ -0,0 +1,178 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST CUBE AND CONQUER: nsat_cube_and_conquer must agree with nsat_solve
+ * on random 3-SAT problems.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "solvers/cdcl/cube_and_conquer.h"
+#include "solvers/cdcl/new_sat_solver.h"
+#include "utils/int_vectors.h"
+
+static void check(bool cond, const char *msg) {
+  if (! cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static const char *status2string(solver_status_t s) {
+  switch (s) {
+  case STAT_SAT: return "sat";
+  case STAT_UNSAT: return "unsat";
+  default: return "unknown";
+  }
+}
+
+
+/*
+ * Random 3-SAT problem: nvars variables, nclauses clauses
+ * - all clauses are stored in v as 3 literals each
+ */
+static void random_problem(ivector_t *v, uint32_t nvars, uint32_t nclauses) {
+  uint32_t i, j;
+  bvar_t x;
+
+  ivector_reset(v);
+  for (i=0; i<nclauses; i++) {
+    for (j=0; j<3; j++) {
+      x = 1 + random() % nvars;
+      ivector_push(v, (random() & 1) ? pos_lit(x) : neg_lit(x));
+    }
+  }
+}
+
+static void add_problem(sat_solver_t *solver, ivector_t *v, uint32_t nvars) {
+  literal_t a[3];
+  uint32_t i;
+
+  nsat_solver_add_vars(solver, nvars);
+  for (i=0; i<v->size; i += 3) {
+    a[0] = v->data[i];
+    a[1] = v->data[i+1];
+    a[2] = v->data[i+2];
+    nsat_solver_simplify_and_add_clause(solver, 3, a);
+  }
+}
+
+static bool model_is_correct(sat_solver_t *solver, ivector_t *v) {
+  uint32_t i;
+
+  for (i=0; i<v->size; i += 3) {
+    if (! lit_is_true(solver, v->data[i]) &&
+	! lit_is_true(solver, v->data[i+1]) &&
+	! lit_is_true(solver, v->data[i+2])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/*
+ * Solve problem v sequentially then with cube and conquer
+ */
+static void test_problem(ivector_t *v, uint32_t nvars, uint32_t nworkers, bool pp) {
+  sat_solver_t solver;
+  solver_status_t expected, status;
+
+  init_nsat_solver(&solver, nvars + 1, pp);
+  add_problem(&solver, v, nvars);
+  expected = nsat_solve(&solver);
+  delete_nsat_solver(&solver);
+
+  init_nsat_solver(&solver, nvars + 1, pp);
+  add_problem(&solver, v, nvars);
+  status = nsat_cube_and_conquer(&solver, nworkers, 0);
+  printf("%"PRIu32" vars, %"PRIu32" clauses, %"PRIu32" workers%s: %s (expected %s)\n",
+	 nvars, v->size/3, nworkers, pp ? ", preprocessing" : "", status2string(status), status2string(expected));
+  fflush(stdout);
+
+  check(status == expected, "cube and conquer and sequential solver disagree");
+  if (status == STAT_SAT) {
+    check(model_is_correct(&solver, v), "invalid model");
+  }
+  delete_nsat_solver(&solver);
+}
+
+
+/*
+ * Assumptions: (x1 or x2) and (not x1 or x2) and (x3 or x4)
+ * - under x3, not x2, the problem is unsat and the failed prefix is 2
+ * - under not x2, x3, the failed prefix is 1
+ * - under x3, the problem is sat
+ */
+static void test_assumptions(void) {
+  sat_solver_t solver;
+  literal_t a[2];
+  solver_status_t status;
+
+  init_nsat_solver(&solver, 5, false);
+  nsat_solver_add_vars(&solver, 4);
+  a[0] = pos_lit(1); a[1] = pos_lit(2);
+  nsat_solver_simplify_and_add_clause(&solver, 2, a);
+  a[0] = neg_lit(1); a[1] = pos_lit(2);
+  nsat_solver_simplify_and_add_clause(&solver, 2, a);
+  a[0] = pos_lit(3); a[1] = pos_lit(4);
+  nsat_solver_simplify_and_add_clause(&solver, 2, a);
+
+  a[0] = pos_lit(3); a[1] = neg_lit(2);
+  status = nsat_solve_with_assumptions(&solver, 2, a);
+  check(status == STAT_UNSAT && solver.failed_prefix == 2, "bad result for x3, not x2");
+
+  a[0] = neg_lit(2); a[1] = pos_lit(3);
+  status = nsat_solve_with_assumptions(&solver, 2, a);
+  check(status == STAT_UNSAT && solver.failed_prefix == 1, "bad result for not x2, x3");
+
+  a[0] = pos_lit(3);
+  status = nsat_solve_with_assumptions(&solver, 1, a);
+  check(status == STAT_SAT && lit_is_true(&solver, pos_lit(3)) && lit_is_true(&solver, pos_lit(2)),
+	"bad result for x3");
+
+  delete_nsat_solver(&solver);
+  printf("assumptions: ok\n");
+}
+
+
+int main(void) {
+  ivector_t v;
+  uint32_t i, n, w;
+
+  test_assumptions();
+
+  init_ivector(&v, 0);
+  srandom(1234);
+  for (i=0; i<10; i++) {
+    n = 60 + 10 * i;
+    random_problem(&v, n, (n * 426)/100);
+    for (w=1; w<=4; w *= 2) {
+      test_problem(&v, n, w, false);
+      test_problem(&v, n, w, true);
+    }
+  }
+  delete_ivector(&v);
+
+  printf("All tests passed\n");
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST EAGER ARRAY LEMMAS: solve array problems with and without the
+ * eager-array-lemmas parameter. The results must agree, every model
+ * must satisfy the assertions, and the eager search must generate
+ * update lemmas in propagate (and none when it's disabled).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "context/context_types.h"
+#include "solvers/funs/fun_solver.h"
+#include "yices.h"
+
+#define NUM_PROBLEMS 7
+#define CHAIN 12
+
+static term_t problem[NUM_PROBLEMS];
+static smt_status_t expected[NUM_PROBLEMS] = {
+  STATUS_UNSAT, STATUS_UNSAT, STATUS_SAT, STATUS_UNSAT, STATUS_UNSAT, STATUS_SAT, STATUS_UNSAT,
+};
+
+static term_t new_const(type_t tau) {
+  return yices_new_uninterpreted_term(tau);
+}
+
+static void build_problems(void) {
+  type_t idx, val, arr;
+  term_t a, b, c, i, j, k, v, w;
+  term_t store[CHAIN+1], index[CHAIN], aux[CHAIN+2];
+  uint32_t n;
+
+  idx = yices_new_uninterpreted_type();
+  val = yices_new_uninterpreted_type();
+  arr = yices_function_type1(idx, val);
+
+  a = new_const(arr);
+  b = new_const(arr);
+  c = new_const(arr);
+  i = new_const(idx);
+  j = new_const(idx);
+  k = new_const(idx);
+  v = new_const(val);
+  w = new_const(val);
+
+  // b = a[i := v], j /= i, b[j] /= a[j] (unsat)
+  problem[0] = yices_and3(yices_eq(b, yices_update1(a, i, v)),
+                          yices_neq(j, i),
+                          yices_neq(yices_application1(b, j), yices_application1(a, j)));
+
+  // c = a[i := v][k := w], j /= i, j /= k, c[j] /= a[j] (unsat)
+  aux[0] = yices_eq(c, yices_update1(yices_update1(a, i, v), k, w));
+  aux[1] = yices_neq(j, i);
+  aux[2] = yices_neq(j, k);
+  aux[3] = yices_neq(yices_application1(c, j), yices_application1(a, j));
+  problem[1] = yices_and(4, aux);
+
+  // b = a[i := v], b[j] /= a[j] (sat with j = i)
+  problem[2] = yices_and2(yices_eq(b, yices_update1(a, i, v)),
+                          yices_neq(yices_application1(b, j), yices_application1(a, j)));
+
+  // b = a[i := v], b[i] /= v (unsat)
+  problem[3] = yices_and2(yices_eq(b, yices_update1(a, i, v)),
+                          yices_neq(yices_application1(b, i), v));
+
+  // chain of CHAIN updates at indices distinct from j (unsat)
+  store[0] = a;
+  for (n=0; n<CHAIN; n++) {
+    index[n] = new_const(idx);
+    store[n+1] = yices_update1(store[n], index[n], new_const(val));
+    aux[n] = yices_neq(j, index[n]);
+  }
+  aux[CHAIN] = yices_eq(b, store[CHAIN]);
+  aux[CHAIN+1] = yices_neq(yices_application1(b, j), yices_application1(a, j));
+  problem[4] = yices_and(CHAIN+2, aux);
+
+  // same chain but j may be equal to the last index (sat)
+  aux[CHAIN-1] = yices_true();
+  problem[5] = yices_and(CHAIN+2, aux);
+
+  // the distinctions are in disjunctions: the search must pick them (unsat)
+  for (n=0; n<CHAIN; n++) {
+    aux[n] = yices_or2(yices_neq(j, index[n]), yices_eq(yices_application1(b, j), yices_application1(c, j)));
+  }
+  aux[CHAIN] = yices_eq(b, store[CHAIN]);
+  aux[CHAIN+1] = yices_and2(yices_eq(c, a),
+                            yices_neq(yices_application1(b, j), yices_application1(a, j)));
+  problem[6] = yices_and(CHAIN+2, aux);
+}
+
+/*
+ * Solve problem i with eager lemmas enabled or disabled
+ * - add the number of eager lemmas to *lemmas
+ */
+static smt_status_t solve(uint32_t i, bool eager, uint32_t *lemmas) {
+  ctx_config_t *config;
+  context_t *ctx;
+  param_t *params;
+  model_t *mdl;
+  fun_solver_t *solver;
+  smt_status_t stat;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, "QF_AX");
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+
+  params = yices_new_param_record();
+  yices_default_params_for_context(ctx, params);
+  yices_set_param(params, "eager-array-lemmas", eager ? "true" : "false");
+
+  yices_assert_formula(ctx, problem[i]);
+  stat = yices_check_context(ctx, params);
+  if (stat == STATUS_SAT) {
+    mdl = yices_get_model(ctx, true);
+    if (yices_formula_true_in_model(mdl, problem[i]) != 1) {
+      printf("BUG: incorrect model for problem %"PRIu32"\n", i);
+      yices_print_model(stdout, mdl);
+      exit(1);
+    }
+    yices_free_model(mdl);
+  }
+
+  solver = ctx->fun_solver;
+  if (solver == NULL) {
+    printf("BUG: no array solver in a QF_AX context\n");
+    exit(1);
+  }
+  if (!eager && solver->stats.num_eager_checks > 0) {
+    printf("BUG: eager checks done when eager-array-lemmas is false\n");
+    exit(1);
+  }
+  *lemmas += solver->stats.num_eager_axiom2;
+
+  yices_free_param_record(params);
+  yices_free_context(ctx);
+
+  return stat;
+}
+
+int main(void) {
+  smt_status_t s1, s2;
+  uint32_t i, lazy_lemmas, eager_lemmas;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  build_problems();
+  lazy_lemmas = 0;
+  eager_lemmas = 0;
+  for (i=0; i<NUM_PROBLEMS; i++) {
+    s1 = solve(i, false, &lazy_lemmas);
+    s2 = solve(i, true, &eager_lemmas);
+    printf("problem %"PRIu32": %s\n", i, s2 == STATUS_SAT ? "sat" : "unsat");
+    if (s1 != expected[i] || s2 != expected[i]) {
+      printf("BUG: unexpected status for problem %"PRIu32"\n", i);
+      exit(1);
+    }
+  }
+
+  printf("eager lemmas: %"PRIu32"\n", eager_lemmas);
+  if (lazy_lemmas != 0 || eager_lemmas == 0) {
+    printf("BUG: the eager search was not used\n");
+    exit(1);
+  }
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
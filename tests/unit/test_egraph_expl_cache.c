@@ -0,0 +1,115 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE EGRAPH EXPLANATION CACHE
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "solvers/egraph/egraph_expl_cache.h"
+
+
+static expl_cache_t cache;
+
+/*
+ * Explanation for pair (i, i+1): literals 2i, 2i+1, ... (i % 5 literals)
+ */
+static void add_pair(int32_t i, uint32_t level) {
+  literal_t a[5];
+  uint32_t j, n;
+
+  n = i % 5;
+  for (j=0; j<n; j++) {
+    a[j] = 2 * i + j;
+  }
+  // use the reversed pair: the cache must normalize it
+  expl_cache_add(&cache, i + 1, i, i, level, a, n);
+}
+
+static void check_pair(int32_t i, int32_t id, bool expected) {
+  literal_t *a;
+  uint32_t j, n;
+
+  a = expl_cache_find(&cache, i, i + 1, id, &n);
+  if ((a != NULL) != expected) {
+    printf("BUG: pair %"PRId32" (id = %"PRId32"): %s\n", i, id, expected ? "missing" : "unexpected");
+    exit(1);
+  }
+  if (a != NULL) {
+    if (n != i % 5) {
+      printf("BUG: pair %"PRId32": wrong explanation size\n", i);
+      exit(1);
+    }
+    for (j=0; j<n; j++) {
+      if (a[j] != 2 * i + j) {
+        printf("BUG: pair %"PRId32": wrong explanation\n", i);
+        exit(1);
+      }
+    }
+  }
+}
+
+int main(void) {
+  int32_t i;
+
+  init_expl_cache(&cache);
+
+  // 1000 pairs per level, for levels 0 to 9
+  for (i=0; i<10000; i++) {
+    add_pair(i, i/1000);
+  }
+  for (i=0; i<10000; i++) {
+    check_pair(i, i, true);
+    check_pair(i, i + 10, true);
+    check_pair(i, i - 1, false);
+  }
+
+  // duplicate pair: ignored
+  expl_cache_add(&cache, 3, 4, 0, 9, NULL, 0);
+  check_pair(3, 3, true);
+
+  // backtrack to level 4: pairs of level 5 and above are removed
+  expl_cache_backtrack(&cache, 4);
+  for (i=0; i<10000; i++) {
+    check_pair(i, 20000, i < 5000);
+  }
+
+  // add again and backtrack many times: deleted slots are reused
+  for (i=5000; i<8000; i++) {
+    add_pair(i, 5);
+    if (i % 100 == 99) {
+      expl_cache_backtrack(&cache, 4);
+    }
+  }
+  for (i=0; i<10000; i++) {
+    check_pair(i, 20000, i < 5000);
+  }
+
+  reset_expl_cache(&cache);
+  check_pair(0, 20000, false);
+  check_pair(4999, 20000, false);
+
+  delete_expl_cache(&cache);
+
+  printf("All tests passed\n");
+  return 0;
+}
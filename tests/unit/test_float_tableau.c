@@ -0,0 +1,212 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE FLOATING-POINT TABLEAU
+ * - random systems with a known solution must be found feasible
+ * - the final assignment must satisfy all rows and bounds
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <math.h>
+
+#include "solvers/simplex/float_tableau.h"
+
+static void check(bool cond, const char *msg) {
+  if (! cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static bool interrupted = false;
+
+static double random_coeff(void) {
+  return (double) ((int32_t) (random() % 21) - 10);
+}
+
+
+/*
+ * Check that every row sums to (almost) zero and that all variables
+ * are within their bounds
+ */
+static void check_assignment(ftableau_t *ft) {
+  frow_t *r;
+  double sum, norm;
+  uint32_t i, j;
+  int32_t x;
+
+  for (i=0; i<ft->nrows; i++) {
+    r = ft->row[i];
+    sum = 0.0;
+    norm = 1.0;
+    for (j=0; j<r->size; j++) {
+      sum += r->data[j].coeff * ft->value[r->data[j].col];
+      norm += fabs(r->data[j].coeff * ft->value[r->data[j].col]);
+    }
+    check(fabs(sum) <= 1e-6 * norm, "row not satisfied");
+  }
+
+  for (x=0; x<ft->ncols; x++) {
+    if (ft->has_lb[x]) {
+      check(ft->value[x] >= ft->lb[x] - 1e-6 * (1.0 + fabs(ft->lb[x])), "lower bound violated");
+    }
+    if (ft->has_ub[x]) {
+      check(ft->value[x] <= ft->ub[x] + 1e-6 * (1.0 + fabs(ft->ub[x])), "upper bound violated");
+    }
+  }
+}
+
+
+/*
+ * Random feasible problem:
+ * - variable 0 is the constant
+ * - variables 1 to nx are the original variables
+ * - variables nx+1 to nx+nrows are slack variables (initially basic)
+ * - we pick a random point p and set bounds around p, so the
+ *   system is feasible. The initial values are at the lower bounds.
+ */
+static void test_random(ftableau_t *ft, uint32_t nx, uint32_t nrows, uint32_t density) {
+  double *p, *a;
+  int32_t *x;
+  double v;
+  uint32_t i, j, n, ncols;
+  int32_t s;
+  ftableau_result_t result;
+
+  ncols = 1 + nx + nrows;
+  p = (double *) malloc(ncols * sizeof(double));
+  a = (double *) malloc((nx + 2) * sizeof(double));
+  x = (int32_t *) malloc((nx + 2) * sizeof(int32_t));
+  check(p != NULL && a != NULL && x != NULL, "out of memory");
+
+  reset_ftableau(ft, ncols);
+  ftableau_set_value(ft, 0, 1.0);
+  ftableau_set_lb(ft, 0, 1.0);
+  ftableau_set_ub(ft, 0, 1.0);
+
+  p[0] = 1.0;
+  for (j=1; j<=nx; j++) {
+    p[j] = (double) (random() % 100);
+    ftableau_set_lb(ft, j, p[j] - (double) (random() % 50));
+    ftableau_set_ub(ft, j, p[j] + (double) (random() % 50));
+    ftableau_set_value(ft, j, ft->lb[j]);
+  }
+
+  for (i=0; i<nrows; i++) {
+    // row: s - a_1 y_1 - ... - a_k y_k - c = 0
+    s = 1 + nx + i;
+    n = 0;
+    x[n] = s;
+    a[n] = 1.0;
+    n ++;
+    v = 0.0;
+    for (j=1; j<=nx; j++) {
+      if (random() % 100 < density) {
+        x[n] = j;
+        a[n] = random_coeff();
+        v -= a[n] * p[j];
+        n ++;
+      }
+    }
+    x[n] = 0;
+    a[n] = random_coeff();
+    v -= a[n];
+    n ++;
+    ftableau_add_row(ft, s, n, x, a);
+
+    // v = value of s at point p
+    p[s] = v;
+    ftableau_set_lb(ft, s, v - (double) (random() % 3));
+    ftableau_set_ub(ft, s, v + (double) (random() % 3));
+  }
+
+  result = ftableau_make_feasible(ft, 100000, &interrupted);
+  printf("%"PRIu32" vars, %"PRIu32" rows: %s after %"PRIu32" pivots\n", nx, nrows,
+         result == FTABLEAU_FEASIBLE ? "feasible" : result == FTABLEAU_INFEASIBLE ? "infeasible" : "unknown",
+         ft->npivots);
+  fflush(stdout);
+
+  check(result == FTABLEAU_FEASIBLE, "feasible problem not solved");
+  check_assignment(ft);
+
+  // the basic variables are all distinct
+  for (i=0; i<ft->nrows; i++) {
+    check(ft->basic_row[ft->basic_var[i]] == (int32_t) i, "bad basis");
+  }
+  check(!ftableau_is_basic(ft, 0), "the constant is basic");
+
+  free(p);
+  free(a);
+  free(x);
+}
+
+
+/*
+ * Infeasible problem: s = y + z with 0 <= y <= 1, 0 <= z <= 1, 3 <= s
+ */
+static void test_infeasible(ftableau_t *ft) {
+  int32_t x[3];
+  double a[3];
+  ftableau_result_t result;
+
+  reset_ftableau(ft, 4);
+  ftableau_set_value(ft, 0, 1.0);
+  ftableau_set_lb(ft, 0, 1.0);
+  ftableau_set_ub(ft, 0, 1.0);
+  ftableau_set_lb(ft, 1, 0.0);
+  ftableau_set_ub(ft, 1, 1.0);
+  ftableau_set_lb(ft, 2, 0.0);
+  ftableau_set_ub(ft, 2, 1.0);
+  ftableau_set_lb(ft, 3, 3.0);
+
+  x[0] = 3; a[0] = 1.0;
+  x[1] = 1; a[1] = -1.0;
+  x[2] = 2; a[2] = -1.0;
+  ftableau_add_row(ft, 3, 3, x, a);
+
+  result = ftableau_make_feasible(ft, 100, &interrupted);
+  check(result == FTABLEAU_INFEASIBLE, "infeasible problem not detected");
+  // s left the basis at its lower bound
+  check(!ftableau_is_basic(ft, 3) && ftableau_status(ft, 3) == FVAR_AT_LB, "bad final status");
+  printf("infeasible: ok\n");
+}
+
+
+int main(void) {
+  ftableau_t ft;
+  uint32_t i;
+
+  init_ftableau(&ft);
+  test_infeasible(&ft);
+
+  srandom(4321);
+  for (i=0; i<20; i++) {
+    test_random(&ft, 10 + 10 * i, 5 + 8 * i, 30);
+  }
+  for (i=0; i<5; i++) {
+    test_random(&ft, 300, 200, 5);
+  }
+  delete_ftableau(&ft);
+
+  printf("All tests passed\n");
+  return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST OF INPROCESSING IN SMT_CORE
+ * - random 3-SAT problems are solved with and without inprocessing
+ * - the two results must agree and the models must satisfy all clauses
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "random_cnf.h"
+
+
+static void test_problem(uint32_t nvars, uint32_t nclauses, bool planted) {
+  smt_core_t core;
+  literal_t *a;
+  smt_status_t s1, s2;
+
+  a = random_problem(nvars, nclauses, planted);
+
+  init_random_problem_core(&core, nvars, nclauses, a);
+  s1 = search_random_problem(&core, nclauses/4, NULL, NULL);
+  if (s1 == STATUS_SAT && !all_clauses_true(&core)) {
+    printf("BUG: invalid model (no inprocessing)\n");
+    exit(1);
+  }
+  delete_smt_core(&core);
+
+  init_random_problem_core(&core, nvars, nclauses, a);
+  enable_inprocessing(&core);
+  s2 = search_random_problem(&core, nclauses/4, NULL, NULL);
+  printf("%"PRIu32" vars, %"PRIu32" clauses: %s, %"PRIu32" passes, %"PRIu64" subsumed, "
+         "%"PRIu64" vivified (%"PRIu64" literals removed)\n",
+         nvars, nclauses, status2string(s2), core.stats.inprocess_calls, core.stats.subsumed_clauses,
+         core.stats.vivified_clauses, core.stats.vivified_literals);
+  fflush(stdout);
+  if (s2 == STATUS_SAT && !all_clauses_true(&core)) {
+    printf("BUG: invalid model (with inprocessing)\n");
+    exit(1);
+  }
+  delete_smt_core(&core);
+
+  if (s1 != s2) {
+    printf("BUG: results differ (%s without inprocessing, %s with)\n", status2string(s1), status2string(s2));
+    exit(1);
+  }
+  if (planted && s1 != STATUS_SAT) {
+    printf("BUG: planted problem not satisfiable\n");
+    exit(1);
+  }
+
+  free(a);
+}
+
+
+int main(void) {
+  uint32_t i;
+
+  srandom(12345);
+  for (i=0; i<10; i++) {
+    test_problem(200, 852, false);
+  }
+  for (i=0; i<5; i++) {
+    test_problem(300, 1250, true);
+  }
+
+  printf("All tests passed\n");
+  return 0;
+}
@@ -0,0 +1,484 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST AND BENCHMARK FOR THE HASH-CONSING TABLES
+ *
+ * Usage: test_int_hash_tables [n]
+ * - n = number of entries (default 1000000)
+ *
+ * The table stores n objects (random 32bit keys). The benchmark
+ * measures the time to insert them with int_htbl_get_obj, to find them
+ * (hits and misses) with int_htbl_find_obj, and to erase half of them.
+ * The same operations are timed on a copy of the previous
+ * implementation (linear probing on the records, with tombstones) for
+ * comparison. Then the test checks int_htbl against a reference
+ * table on a random mix of operations.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "utils/cputime.h"
+#include "utils/hash_ctrl_bytes.h"
+#include "utils/hash_functions.h"
+#include "utils/int_hash_tables.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Objects: key[i] = key of object i for i in [0, 2n)
+ * - the first n objects are added to the tables
+ * - the others are used for lookups that fail
+ */
+static uint32_t *key;
+
+/*
+ * The hash code of an object is jenkins_hash_uint32(key) & hash_mask:
+ * the random test uses a mask with few bits to get many collisions
+ * (on the tags and on the initial slots).
+ */
+static uint32_t hash_mask = 0xFFFFFFFF;
+
+static inline uint32_t key_hash(int32_t i) {
+  return jenkins_hash_uint32(key[i]) & hash_mask;
+}
+
+typedef struct test_obj_s {
+  int_hobj_t m;
+  uint32_t key;
+  int32_t index;
+} test_obj_t;
+
+static uint32_t hash_obj(const test_obj_t *o) {
+  return jenkins_hash_uint32(o->key) & hash_mask;
+}
+
+static bool eq_obj(const test_obj_t *o, int32_t i) {
+  return key[i] == o->key;
+}
+
+static int32_t build_obj(const test_obj_t *o) {
+  return o->index;
+}
+
+static test_obj_t obj = {
+  { (hobj_hash_t) hash_obj, (hobj_eq_t) eq_obj, (hobj_build_t) build_obj },
+  0, 0,
+};
+
+static inline const int_hobj_t *mk_obj(int32_t i) {
+  obj.key = key[i];
+  obj.index = i;
+  return (int_hobj_t *) &obj;
+}
+
+
+static uint32_t seed = 12345;
+
+static uint32_t random_uint32(void) {
+  seed = seed * 1664525 + 1013904223;
+  return seed ^ (seed >> 15);
+}
+
+/*
+ * Distinct random keys: i -> (i * odd constant) is a bijection on uint32
+ */
+static void init_keys(uint32_t n) {
+  uint32_t i, r;
+
+  key = (uint32_t *) safe_malloc(2 * n * sizeof(uint32_t));
+  r = random_uint32() | 1;
+  for (i=0; i<2*n; i++) {
+    key[i] = i * 0x9E3779B1u + r;
+  }
+}
+
+
+
+/*
+ * PREVIOUS IMPLEMENTATION (for the benchmark)
+ */
+typedef struct lp_htbl_s {
+  int_hrec_t *records;
+  uint32_t size;
+  uint32_t nelems;
+  uint32_t ndeleted;
+  uint32_t resize_threshold;
+  uint32_t cleanup_threshold;
+} lp_htbl_t;
+
+#define LP_DELETED_VALUE (-2)
+
+static void init_lp_htbl(lp_htbl_t *table, uint32_t n) {
+  uint32_t i;
+
+  table->records = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
+  for (i=0; i<n; i++) {
+    table->records[i].value = NULL_VALUE;
+  }
+  table->size = n;
+  table->nelems = 0;
+  table->ndeleted = 0;
+  table->resize_threshold = (uint32_t) (n * 0.6);
+  table->cleanup_threshold = (uint32_t) (n * 0.2);
+}
+
+static void delete_lp_htbl(lp_htbl_t *table) {
+  safe_free(table->records);
+  table->records = NULL;
+}
+
+static void lp_htbl_copy_record(int_hrec_t *t, uint32_t k, int32_t v, uint32_t mask) {
+  uint32_t j;
+
+  j = k & mask;
+  while (t[j].value != NULL_VALUE) {
+    j = (j + 1) & mask;
+  }
+  t[j].key = k;
+  t[j].value = v;
+}
+
+// rebuild the table with size n
+static void lp_htbl_rebuild(lp_htbl_t *table, uint32_t n) {
+  int_hrec_t *tmp;
+  uint32_t j;
+
+  tmp = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
+  for (j=0; j<n; j++) {
+    tmp[j].value = NULL_VALUE;
+  }
+  for (j=0; j<table->size; j++) {
+    if (table->records[j].value >= 0) {
+      lp_htbl_copy_record(tmp, table->records[j].key, table->records[j].value, n - 1);
+    }
+  }
+  safe_free(table->records);
+  table->records = tmp;
+  table->ndeleted = 0;
+  table->size = n;
+  table->resize_threshold = (uint32_t) (n * 0.6);
+  table->cleanup_threshold = (uint32_t) (n * 0.2);
+}
+
+static void lp_htbl_erase_record(lp_htbl_t *table, uint32_t k, int32_t v) {
+  uint32_t mask, j;
+  int_hrec_t *r;
+
+  mask = table->size - 1;
+  j = k & mask;
+  for (;;) {
+    r = table->records + j;
+    if (r->value == v) break;
+    if (r->value == NULL_VALUE) return;
+    j = (j + 1) & mask;
+  }
+  table->nelems --;
+  table->ndeleted ++;
+  r->value = LP_DELETED_VALUE;
+  if (table->ndeleted > table->cleanup_threshold) {
+    lp_htbl_rebuild(table, table->size);
+  }
+}
+
+static int32_t lp_htbl_find_obj(const lp_htbl_t *table, const int_hobj_t *o) {
+  uint32_t mask, j, k;
+  int32_t v;
+  int_hrec_t *r;
+
+  mask = table->size - 1;
+  k = o->hash(o);
+  j = k & mask;
+  for (;;) {
+    r = table->records + j;
+    v = r->value;
+    if ((v >= 0 && r->key == k && o->eq(o, v)) || v == NULL_VALUE) {
+      return v;
+    }
+    j = (j + 1) & mask;
+  }
+}
+
+static int32_t lp_htbl_store_new_obj(lp_htbl_t *table, int_hrec_t *r, uint32_t k, const int_hobj_t *o) {
+  int32_t v;
+
+  v = o->build(o);
+  if (v >= 0) {
+    table->nelems ++;
+    r->key = k;
+    r->value = v;
+    if (table->nelems + table->ndeleted > table->resize_threshold) {
+      lp_htbl_rebuild(table, table->size << 1);
+    }
+  }
+  return v;
+}
+
+static int32_t lp_htbl_get_obj(lp_htbl_t *table, const int_hobj_t *o) {
+  uint32_t mask, j, k;
+  int32_t v;
+  int_hrec_t *r, *aux;
+
+  mask = table->size - 1;
+  k = o->hash(o);
+  j = k & mask;
+  for (;;) {
+    r = table->records + j;
+    v = r->value;
+    if (v == NULL_VALUE) return lp_htbl_store_new_obj(table, r, k, o);
+    if (v == LP_DELETED_VALUE) break;
+    if (r->key == k && o->eq(o, v)) return v;
+    j = (j + 1) & mask;
+  }
+
+  aux = r;
+  for (;;) {
+    j = (j + 1) & mask;
+    r = table->records + j;
+    v = r->value;
+    if (v == NULL_VALUE) {
+      table->ndeleted --;
+      return lp_htbl_store_new_obj(table, aux, k, o);
+    }
+    if (v >= 0 && r->key == k && o->eq(o, v)) return v;
+  }
+}
+
+
+
+/*
+ * BENCHMARK
+ */
+
+/*
+ * Print the time per operation in ns
+ */
+static void show_time(const char *what, double t0, double t1, uint32_t n) {
+  printf("  %-16s %8.3f s  %7.1f ns/op\n", what, t1 - t0, 1e9 * (t1 - t0)/n);
+  fflush(stdout);
+}
+
+static int32_t sink;
+
+static void bench_int_htbl(uint32_t n) {
+  int_htbl_t table;
+  double t0, t1;
+  int32_t i, s;
+
+  printf("int_htbl (control bytes, group size %d)\n", HCTRL_GROUP);
+  init_int_htbl(&table, 0);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    int_htbl_get_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("insert", t0, t1, n);
+
+  s = 0;
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    s += int_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (hit)", t0, t1, n);
+
+  t0 = get_cpu_time();
+  for (i=n; i<2*n; i++) {
+    s += int_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (miss)", t0, t1, n);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i+=2) {
+    int_htbl_erase_record(&table, key_hash(i), i);
+  }
+  t1 = get_cpu_time();
+  show_time("erase", t0, t1, n/2);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    s += int_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (mixed)", t0, t1, n);
+
+  sink += s;
+  delete_int_htbl(&table);
+}
+
+static void bench_lp_htbl(uint32_t n) {
+  lp_htbl_t table;
+  double t0, t1;
+  int32_t i, s;
+
+  printf("previous table (linear probing with tombstones)\n");
+  init_lp_htbl(&table, INT_HTBL_DEFAULT_SIZE);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    lp_htbl_get_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("insert", t0, t1, n);
+
+  s = 0;
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    s += lp_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (hit)", t0, t1, n);
+
+  t0 = get_cpu_time();
+  for (i=n; i<2*n; i++) {
+    s += lp_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (miss)", t0, t1, n);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i+=2) {
+    lp_htbl_erase_record(&table, key_hash(i), i);
+  }
+  t1 = get_cpu_time();
+  show_time("erase", t0, t1, n/2);
+
+  t0 = get_cpu_time();
+  for (i=0; i<n; i++) {
+    s += lp_htbl_find_obj(&table, mk_obj(i));
+  }
+  t1 = get_cpu_time();
+  show_time("lookup (mixed)", t0, t1, n);
+
+  sink += s;
+  delete_lp_htbl(&table);
+}
+
+
+
+/*
+ * RANDOM TEST: compare int_htbl with a reference table
+ * - present[i] = true if object i is in the table
+ */
+static void random_test(uint32_t n, uint32_t nops) {
+  int_htbl_t table;
+  bool *present;
+  uint32_t i, op, count;
+  int32_t v, x;
+
+  present = (bool *) safe_malloc(n * sizeof(bool));
+  for (i=0; i<n; i++) {
+    present[i] = false;
+  }
+
+  init_int_htbl(&table, 0);
+  count = 0;
+  for (op=0; op<nops; op++) {
+    i = random_uint32() % n;
+    switch (random_uint32() % 4) {
+    case 0:
+    case 1:
+      v = int_htbl_get_obj(&table, mk_obj(i));
+      if (v != (int32_t) i) {
+	printf("BUG: get_obj %"PRIu32" returned %"PRId32"\n", i, v);
+	exit(1);
+      }
+      if (!present[i]) count ++;
+      present[i] = true;
+      break;
+
+    case 2:
+      int_htbl_erase_record(&table, key_hash(i), i);
+      if (present[i]) count --;
+      present[i] = false;
+      break;
+
+    default:
+      v = int_htbl_find_obj(&table, mk_obj(i));
+      x = present[i] ? (int32_t) i : NULL_VALUE;
+      if (v != x) {
+	printf("BUG: find_obj %"PRIu32" returned %"PRId32" (expected %"PRId32")\n", i, v, x);
+	exit(1);
+      }
+      break;
+    }
+
+    if (table.nelems != count) {
+      printf("BUG: nelems = %"PRIu32" (expected %"PRIu32")\n", table.nelems, count);
+      exit(1);
+    }
+  }
+
+  for (i=0; i<n; i++) {
+    v = int_htbl_find_obj(&table, mk_obj(i));
+    x = present[i] ? (int32_t) i : NULL_VALUE;
+    if (v != x) {
+      printf("BUG: final find_obj %"PRIu32" returned %"PRId32" (expected %"PRId32")\n", i, v, x);
+      exit(1);
+    }
+  }
+
+  reset_int_htbl(&table);
+  for (i=0; i<n; i++) {
+    if (int_htbl_find_obj(&table, mk_obj(i)) != NULL_VALUE) {
+      printf("BUG: object %"PRIu32" found after reset\n", i);
+      exit(1);
+    }
+  }
+
+  delete_int_htbl(&table);
+  safe_free(present);
+
+  printf("random test: %"PRIu32" operations on %"PRIu32" objects: ok\n", nops, n);
+}
+
+
+int main(int argc, char *argv[]) {
+  uint32_t n;
+  long x;
+
+  n = 1000000;
+  if (argc >= 2) {
+    x = atol(argv[1]);
+    if (x <= 0 || x > 200000000) {
+      fprintf(stderr, "Usage: %s [number of entries (at most 200000000)]\n", argv[0]);
+      exit(1);
+    }
+    n = (uint32_t) x;
+  }
+
+  init_keys(n);
+  printf("%"PRIu32" entries\n", n);
+  bench_int_htbl(n);
+  bench_lp_htbl(n);
+  safe_free(key);
+
+  // random tests: 4 tags and 256 initial slots in the second one
+  init_keys(5000);
+  random_test(5000, 2000000);
+  hash_mask = 0x060000FF;
+  random_test(5000, 2000000);
+  safe_free(key);
+
+  return 0;
+}
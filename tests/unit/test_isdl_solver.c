@@ -0,0 +1,180 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE SPARSE IDL SOLVER: solve random difference-logic problems
+ * with the sparse solver (with and without theory propagation) and
+ * with the simplex solver. The results must agree and every model
+ * must satisfy the problem.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+#define NUM_VARS 40
+#define NUM_CLAUSES 120
+
+static term_t var[NUM_VARS];
+
+static uint32_t seed = 1234;
+
+static uint32_t random_index(uint32_t n) {
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+/*
+ * Random atom: (x - y <= c), (x - y >= c), (x - y = c), or (x <= c)
+ */
+static term_t random_atom(void) {
+  term_t x, y, d, c;
+
+  x = var[random_index(NUM_VARS)];
+  y = var[random_index(NUM_VARS)];
+  c = yices_int32((int32_t) random_index(21) - 10);
+  d = yices_sub(x, y);
+
+  switch (random_index(4)) {
+  case 0: return yices_arith_leq_atom(d, c);
+  case 1: return yices_arith_geq_atom(d, c);
+  case 2: return yices_arith_eq_atom(d, c);
+  default: return yices_arith_leq_atom(x, c);
+  }
+}
+
+/*
+ * Random problem: conjunction of n clauses of 1 to 3 atoms
+ */
+static term_t random_problem(uint32_t n) {
+  term_t *clause;
+  term_t a[3];
+  term_t f;
+  uint32_t i, j, k;
+
+  clause = (term_t *) malloc(n * sizeof(term_t));
+  if (clause == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  for (i=0; i<n; i++) {
+    k = 1 + random_index(3);
+    for (j=0; j<k; j++) {
+      a[j] = random_atom();
+      if (random_index(4) == 0) {
+        a[j] = yices_not(a[j]);
+      }
+    }
+    clause[i] = yices_or(k, a);
+  }
+  f = yices_and(n, clause);
+  free(clause);
+
+  return f;
+}
+
+/*
+ * Solve f using the given arith-solver
+ * - prop is the value of parameter isdl-prop
+ */
+static smt_status_t solve(term_t f, const char *solver, bool prop) {
+  ctx_config_t *config;
+  context_t *ctx;
+  param_t *params;
+  model_t *mdl;
+  smt_status_t stat;
+
+  config = yices_new_config();
+  yices_set_config(config, "mode", "one-shot");
+  yices_set_config(config, "solver-type", "dpllt");
+  yices_set_config(config, "uf-solver", "none");
+  yices_set_config(config, "bv-solver", "none");
+  yices_set_config(config, "array-solver", "none");
+  yices_set_config(config, "arith-fragment", "IDL");
+  if (yices_set_config(config, "arith-solver", solver) < 0) {
+    printf("BUG: failed to set arith-solver to %s\n", solver);
+    yices_print_error(stdout);
+    exit(1);
+  }
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL) {
+    printf("BUG: failed to create context with arith-solver %s\n", solver);
+    yices_print_error(stdout);
+    exit(1);
+  }
+
+  params = yices_new_param_record();
+  yices_default_params_for_context(ctx, params);
+  yices_set_param(params, "isdl-prop", prop ? "true" : "false");
+
+  yices_assert_formula(ctx, f);
+  stat = yices_check_context(ctx, params);
+  if (stat == STATUS_SAT) {
+    mdl = yices_get_model(ctx, true);
+    if (yices_formula_true_in_model(mdl, f) != 1) {
+      printf("BUG: incorrect model with arith-solver %s\n", solver);
+      yices_print_model(stdout, mdl);
+      exit(1);
+    }
+    yices_free_model(mdl);
+  } else if (stat != STATUS_UNSAT) {
+    printf("BUG: unexpected status with arith-solver %s\n", solver);
+    exit(1);
+  }
+  yices_free_param_record(params);
+  yices_free_context(ctx);
+
+  return stat;
+}
+
+int main(void) {
+  smt_status_t s1, s2, s3;
+  term_t f;
+  uint32_t i, n, sat;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  for (i=0; i<NUM_VARS; i++) {
+    var[i] = yices_new_uninterpreted_term(yices_int_type());
+  }
+
+  sat = 0;
+  for (i=0; i<200; i++) {
+    n = 20 + random_index(NUM_CLAUSES);
+    f = random_problem(n);
+    s1 = solve(f, "simplex", false);
+    s2 = solve(f, "isdl", false);
+    s3 = solve(f, "isdl", true);
+    if (s1 != s2 || s1 != s3) {
+      printf("BUG: simplex and isdl disagree on problem %"PRIu32"\n", i);
+      exit(1);
+    }
+    if (s1 == STATUS_SAT) sat ++;
+  }
+  printf("%"PRIu32" sat, %"PRIu32" unsat\n", sat, 200 - sat);
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
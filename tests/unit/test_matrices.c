@@ -379,6 +379,110 @@ static void random_pivot(matrix_t *matrix) {
 }
 
 
+/*
+ * Pivot on variable x in row r
+ */
+static void pivot_on_var(matrix_t *matrix, uint32_t r, int32_t x) {
+  row_t *row;
+  uint32_t i, n;
+
+  row = matrix->row[r];
+  n = row->size;
+  for (i=0; i<n; i++) {
+    if (row->data[i].c_idx == x) {
+      matrix_pivot(matrix, r, i);
+      return;
+    }
+  }
+  assert(false);
+}
+
+/*
+ * Check whether row r of m1 and m2 contain the same monomials
+ */
+static bool same_row(matrix_t *m1, matrix_t *m2, uint32_t r) {
+  row_t *row1, *row2;
+  uint32_t i, j;
+  int32_t x;
+
+  row1 = m1->row[r];
+  row2 = m2->row[r];
+  if (row1->nelems != row2->nelems || m1->base_var[r] != m2->base_var[r]) {
+    return false;
+  }
+  for (i=0; i<row1->size; i++) {
+    x = row1->data[i].c_idx;
+    if (x >= 0) {
+      for (j=0; j<row2->size; j++) {
+        if (row2->data[j].c_idx == x) break;
+      }
+      if (j == row2->size || q_neq(&row1->data[i].coeff, &row2->data[j].coeff)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*
+ * Apply the same random pivots to two copies of a random matrix.
+ * The second copy is packed every 10 pivots.
+ */
+static void test_packing(uint32_t n, uint32_t m, uint32_t d, uint32_t npivots) {
+  matrix_t m1, m2;
+  row_t *row;
+  uint32_t i, k, r, j, c;
+  int32_t x;
+
+  init_matrix(&m1, 0, 0);
+  init_matrix(&m2, 0, 0);
+  matrix_add_columns(&m1, m);
+  matrix_add_columns(&m2, m);
+  for (i=0; i<n; i++) {
+    k = make_random_poly(m, d);
+    matrix_add_row(&m1, monarray, k);
+    matrix_add_row(&m2, monarray, k);
+  }
+  matrix_pack(&m2);
+
+  for (i=0; i<npivots; i++) {
+    // random variable x in a random row r
+    r = (uint32_t) (random() % m1.nrows);
+    row = m1.row[r];
+    k = (uint32_t) (random() % row->nelems);
+    x = -1;
+    c = 0;
+    for (j=0; j<row->size; j++) {
+      if (row->data[j].c_idx > const_idx) {
+        if (c == k) {
+          x = row->data[j].c_idx;
+          break;
+        }
+        c ++;
+      }
+    }
+    if (x < 0) continue;
+    pivot_on_var(&m1, r, x);
+    pivot_on_var(&m2, r, x);
+    if (i % 10 == 9) {
+      matrix_pack(&m2);
+    }
+  }
+
+  for (r=0; r<m1.nrows; r++) {
+    if (! same_row(&m1, &m2, r)) {
+      printf("BUG: packed and unpacked matrices differ in row %"PRIu32"\n", r);
+      fflush(stdout);
+      exit(1);
+    }
+  }
+  printf("\n==== PACKING: %"PRIu32" rows, %"PRIu32" columns, %"PRIu32" pivots: ok ====\n", n, m, npivots);
+
+  delete_matrix(&m1);
+  delete_matrix(&m2);
+}
+
+
 int main(void) {
   uint32_t i;
 
@@ -418,6 +522,10 @@ int main(void) {
   }
 
   delete_matrix(&matrix);
+
+  test_packing(300, 500, 5, 200);
+  test_packing(1000, 1200, 8, 300);
+
   for (i=0; i<MAXMONOMIALS; i++) {
     q_clear(&monarray[i].coeff);
   }
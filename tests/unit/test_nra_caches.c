@@ -0,0 +1,342 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE CACHES OF THE NRA PLUGIN
+ * - order-independent hash of libpoly polynomials
+ * - PSC cache: lookups, LRU order, eviction, reset
+ * - atom cache: growth of the hash table and reset
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#if HAVE_MCSAT
+
+#include <poly/poly.h>
+#include <poly/integer.h>
+#include <poly/polynomial.h>
+#include <poly/polynomial_context.h>
+#include <poly/variable_db.h>
+#include <poly/variable_order.h>
+
+#include "mcsat/nra/nra_atom_cache.h"
+#include "mcsat/nra/nra_psc_cache.h"
+#include "mcsat/utils/lp_utils.h"
+
+
+static void check(bool cond, const char *msg) {
+  if (! cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+
+/*
+ * Polynomials over x, y, z
+ */
+static lp_variable_db_t *var_db;
+static lp_variable_order_t *var_order;
+static lp_polynomial_context_t *lp_ctx;
+static lp_variable_t x, y, z;
+
+/*
+ * Variable order: v0 < v1 < v2
+ */
+static void set_order(lp_variable_t v0, lp_variable_t v1, lp_variable_t v2) {
+  lp_variable_order_clear(var_order);
+  lp_variable_order_push(var_order, v0);
+  lp_variable_order_push(var_order, v1);
+  lp_variable_order_push(var_order, v2);
+}
+
+static void init_polynomials(void) {
+  var_db = lp_variable_db_new();
+  var_order = lp_variable_order_new();
+  lp_ctx = lp_polynomial_context_new(lp_Z, var_db, var_order);
+  x = lp_variable_db_new_variable(var_db, "x");
+  y = lp_variable_db_new_variable(var_db, "y");
+  z = lp_variable_db_new_variable(var_db, "z");
+  set_order(x, y, z);
+}
+
+static void delete_polynomials(void) {
+  lp_polynomial_context_detach(lp_ctx);
+  lp_variable_order_detach(var_order);
+  lp_variable_db_detach(var_db);
+}
+
+
+/*
+ * Add a * v^d to p
+ */
+static void add_monomial(lp_polynomial_t *p, long a, lp_variable_t v, unsigned d) {
+  lp_polynomial_t *m;
+  lp_integer_t c;
+
+  lp_integer_construct_from_int(lp_Z, &c, a);
+  m = lp_polynomial_new(lp_ctx);
+  lp_polynomial_construct_simple(m, lp_ctx, &c, v, d);
+  lp_polynomial_add(p, p, m);
+  lp_polynomial_delete(m);
+  lp_integer_destruct(&c);
+}
+
+/*
+ * k * x + y^2 + z (all different for different k)
+ */
+static lp_polynomial_t *make_poly(long k) {
+  lp_polynomial_t *p;
+
+  p = lp_polynomial_new(lp_ctx);
+  add_monomial(p, k, x, 1);
+  add_monomial(p, 1, y, 2);
+  add_monomial(p, 1, z, 1);
+  return p;
+}
+
+/*
+ * x * y^2 + 3 * x^2 * z - 7 (built in the current order)
+ */
+static lp_polynomial_t *make_poly2(void) {
+  lp_polynomial_t *p, *q, *r;
+
+  p = lp_polynomial_new(lp_ctx);
+  q = lp_polynomial_new(lp_ctx);
+  add_monomial(p, 1, x, 1);
+  add_monomial(q, 1, y, 2);
+  lp_polynomial_mul(p, p, q);
+  lp_polynomial_delete(q);
+
+  q = lp_polynomial_new(lp_ctx);
+  add_monomial(q, 3, x, 2);
+  r = lp_polynomial_new(lp_ctx);
+  add_monomial(r, 1, z, 1);
+  lp_polynomial_mul(q, q, r);
+  lp_polynomial_add(p, p, q);
+  lp_polynomial_delete(q);
+  lp_polynomial_delete(r);
+
+  add_monomial(p, -7, x, 0);
+  return p;
+}
+
+
+/*
+ * The hash doesn't depend on the variable order
+ */
+static void test_hash(void) {
+  lp_polynomial_t *p, *q;
+  uint32_t hp, hq;
+
+  printf("Test hash\n");
+  p = make_poly2();
+  hp = lp_polynomial_order_independent_hash(p);
+
+  set_order(z, y, x);
+  q = make_poly2();
+  hq = lp_polynomial_order_independent_hash(q);
+  check(hp == hq, "hash depends on the variable order");
+  check(lp_polynomial_order_independent_hash(p) == hp, "hash changed after reordering");
+  check(lp_polynomial_cmp(p, q) == 0, "same polynomial in different orders");
+
+  lp_polynomial_delete(p);
+  lp_polynomial_delete(q);
+  set_order(x, y, z);
+}
+
+
+/*
+ * PSC cache: entry k is for the pair (poly[k], poly[k+1]), variable x,
+ * and its PSC is { poly[k+2] }
+ */
+#define NPOLYS 64
+
+static lp_polynomial_t *poly[NPOLYS];
+
+static void add_entry(nra_psc_cache_t *cache, uint32_t k) {
+  check(k + 2 < NPOLYS, "bad entry");
+  nra_psc_cache_add(cache, x, poly[k], poly[k+1], poly + k + 2, 1);
+}
+
+static bool has_entry(nra_psc_cache_t *cache, uint32_t k) {
+  lp_polynomial_t **psc;
+  uint32_t n;
+
+  psc = nra_psc_cache_find(cache, x, poly[k], poly[k+1], &n);
+  if (psc == NULL) return false;
+  check(n == 1, "wrong PSC size");
+  check(lp_polynomial_cmp(psc[0], poly[k+2]) == 0, "wrong PSC");
+  return true;
+}
+
+static void test_psc_cache(void) {
+  nra_psc_cache_t cache;
+  lp_polynomial_t **psc;
+  uint32_t i, n;
+
+  printf("Test PSC cache\n");
+  for (i=0; i<NPOLYS; i++) {
+    poly[i] = make_poly(i);
+  }
+
+  nra_psc_cache_construct(&cache, 4);
+  check(! has_entry(&cache, 0), "empty cache");
+
+  for (i=0; i<4; i++) {
+    add_entry(&cache, i);
+  }
+  for (i=0; i<4; i++) {
+    check(has_entry(&cache, i), "missing entry");
+  }
+
+  // the variable is part of the key
+  psc = nra_psc_cache_find(&cache, y, poly[0], poly[1], &n);
+  check(psc == NULL, "wrong variable");
+  // so is the order of the pair
+  psc = nra_psc_cache_find(&cache, x, poly[1], poly[0], &n);
+  check(psc == NULL, "swapped pair");
+
+  // LRU order is now 0 1 2 3: use 0 and 2, then 1 is the least recently used
+  check(has_entry(&cache, 0), "missing entry 0");
+  check(has_entry(&cache, 2), "missing entry 2");
+  add_entry(&cache, 4);
+  check(! has_entry(&cache, 1), "entry 1 not evicted");
+  check(has_entry(&cache, 0) && has_entry(&cache, 2) && has_entry(&cache, 3) && has_entry(&cache, 4),
+        "wrong entry evicted");
+
+  // now the order is 0 2 3 4: 0 goes next
+  add_entry(&cache, 5);
+  check(! has_entry(&cache, 0), "entry 0 not evicted");
+  check(has_entry(&cache, 5), "missing entry 5");
+
+  // many evictions: only the last four entries stay
+  for (i=6; i+2<NPOLYS; i++) {
+    add_entry(&cache, i);
+  }
+  for (i=0; i+2<NPOLYS; i++) {
+    check(has_entry(&cache, i) == (i + 6 >= NPOLYS), "wrong entries after evictions");
+  }
+
+  // the entries are still found after a change of variable order
+  set_order(z, y, x);
+  for (i=NPOLYS-6; i+2<NPOLYS; i++) {
+    check(has_entry(&cache, i), "entry lost after reordering");
+  }
+
+  // reset (as done by the GC): all entries go, and the cache is usable after
+  nra_psc_cache_reset(&cache);
+  check(cache.nentries == 0, "entries after reset");
+  for (i=0; i+2<NPOLYS; i++) {
+    check(! has_entry(&cache, i), "entry after reset");
+  }
+  for (i=0; i<6; i++) {
+    add_entry(&cache, i);
+  }
+  check(! has_entry(&cache, 1) && has_entry(&cache, 2) && has_entry(&cache, 5), "wrong entries after reset");
+
+  nra_psc_cache_destruct(&cache);
+  for (i=0; i<NPOLYS; i++) {
+    lp_polynomial_delete(poly[i]);
+  }
+  set_order(x, y, z);
+}
+
+
+/*
+ * Atom cache: enough entries to grow the hash table several times
+ */
+#define NATOMS 2000
+
+static term_t fake_atom(uint32_t k, lp_sign_condition_t sgn) {
+  return (term_t) (2 * (8 * k + sgn));
+}
+
+static void test_atom_cache(void) {
+  nra_atom_cache_t cache;
+  lp_polynomial_t *p;
+  uint32_t k;
+
+  printf("Test atom cache\n");
+  nra_atom_cache_construct(&cache);
+
+  for (k=0; k<NATOMS; k++) {
+    p = make_poly(k);
+    check(nra_atom_cache_find(&cache, p, LP_SGN_LT_0) == NULL_TERM, "atom already there");
+    nra_atom_cache_add(&cache, p, LP_SGN_LT_0, fake_atom(k, LP_SGN_LT_0));
+    if (k % 3 == 0) {
+      nra_atom_cache_add(&cache, p, LP_SGN_EQ_0, fake_atom(k, LP_SGN_EQ_0));
+    }
+    lp_polynomial_delete(p);
+  }
+  check(cache.hsize >= 2 * cache.nentries, "hash table too full");
+
+  for (k=0; k<NATOMS; k++) {
+    p = make_poly(k);
+    check(nra_atom_cache_find(&cache, p, LP_SGN_LT_0) == fake_atom(k, LP_SGN_LT_0), "wrong atom");
+    if (k % 3 == 0) {
+      check(nra_atom_cache_find(&cache, p, LP_SGN_EQ_0) == fake_atom(k, LP_SGN_EQ_0), "wrong atom");
+    } else {
+      check(nra_atom_cache_find(&cache, p, LP_SGN_EQ_0) == NULL_TERM, "unexpected atom");
+    }
+    check(nra_atom_cache_find(&cache, p, LP_SGN_GT_0) == NULL_TERM, "unexpected atom");
+    lp_polynomial_delete(p);
+  }
+
+  // reset (as done by the GC): all entries go
+  nra_atom_cache_reset(&cache);
+  check(cache.nentries == 0, "entries after reset");
+  for (k=0; k<NATOMS; k++) {
+    p = make_poly(k);
+    check(nra_atom_cache_find(&cache, p, LP_SGN_LT_0) == NULL_TERM, "atom after reset");
+    lp_polynomial_delete(p);
+  }
+
+  // the cache is usable after reset
+  p = make_poly(5);
+  nra_atom_cache_add(&cache, p, LP_SGN_GE_0, fake_atom(5, LP_SGN_GE_0));
+  check(nra_atom_cache_find(&cache, p, LP_SGN_GE_0) == fake_atom(5, LP_SGN_GE_0), "wrong atom after reset");
+  lp_polynomial_delete(p);
+
+  nra_atom_cache_destruct(&cache);
+}
+
+
+int main(void) {
+  init_polynomials();
+  test_hash();
+  test_psc_cache();
+  test_atom_cache();
+  delete_polynomials();
+  printf("All tests passed\n");
+
+  return 0;
+}
+
+#else
+
+int main(void) {
+  printf("MCSAT is not supported\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE RACE BETWEEN CHILD PROCESSES
+ *
+ * process_race doesn't return in the calling process once a winner
+ * is picked, so each scenario runs in a driver process: the winner
+ * exits with code 0 if it's the expected worker with the expected
+ * status, and the driver must exit with the same code.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#ifndef MINGW
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "frontend/common/process_race.h"
+
+
+static void check(bool cond, const char *msg) {
+  if (! cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+
+/*
+ * Scenario: answer[i] = what worker i does
+ * - a status is returned after delay[i] milliseconds
+ * - DIE means exit without reporting
+ */
+#define DIE ((smt_status_t) 100)
+
+typedef struct scenario_s {
+  const char *name;
+  uint32_t n;
+  smt_status_t answer[4];
+  uint32_t delay[4];
+  int32_t winner;          // expected winner (-1 if none)
+  smt_status_t status;     // expected status
+  int exit_code;           // code used by the winner when it's correct
+} scenario_t;
+
+static const scenario_t scenario[] = {
+  { "sat by worker 2", 4,
+    { STATUS_UNKNOWN, STATUS_UNKNOWN, STATUS_SAT, STATUS_UNKNOWN }, { 5000, 5000, 10, 5000 },
+    2, STATUS_SAT, 0 },
+  { "unsat by worker 0", 3,
+    { STATUS_UNSAT, STATUS_SAT, STATUS_SAT }, { 10, 5000, 5000, 0 },
+    0, STATUS_UNSAT, 0 },
+  { "no answer: worker 0 continues", 4,
+    { STATUS_UNKNOWN, STATUS_UNKNOWN, STATUS_UNKNOWN, STATUS_UNKNOWN }, { 100, 10, 50, 0 },
+    0, STATUS_UNKNOWN, 0 },
+  { "worker 0 dies", 3,
+    { DIE, STATUS_UNKNOWN, STATUS_UNKNOWN }, { 0, 50, 10, 0 },
+    1, STATUS_UNKNOWN, 0 },
+  { "all workers die", 2,
+    { DIE, DIE, 0, 0 }, { 0, 10, 0, 0 },
+    -1, STATUS_UNKNOWN, 0 },
+  { "exit code of the winner", 2,
+    { STATUS_UNKNOWN, STATUS_SAT, 0, 0 }, { 5000, 10, 0, 0 },
+    1, STATUS_SAT, 7 },
+};
+
+#define NUM_SCENARIOS (sizeof(scenario)/sizeof(scenario_t))
+
+
+static smt_status_t worker(void *aux, uint32_t i) {
+  const scenario_t *s;
+
+  s = aux;
+  usleep(1000 * s->delay[i]);
+  if (s->answer[i] == DIE) {
+    _exit(99);
+  }
+  return s->answer[i];
+}
+
+
+/*
+ * Driver: run the race for scenario s
+ */
+static void __attribute__((noreturn)) run_scenario(const scenario_t *s) {
+  smt_status_t status;
+  int32_t winner;
+
+  winner = process_race(s->n, worker, (void *) s, &status);
+  if (winner < 0) {
+    // calling process: no child could be used
+    exit(s->winner < 0 ? s->exit_code : 1);
+  }
+  // winning child
+  exit(winner == s->winner && status == s->status ? s->exit_code : 1);
+}
+
+
+static void test_scenario(const scenario_t *s) {
+  int wstatus;
+  pid_t pid;
+
+  printf("Scenario: %s\n", s->name);
+  fflush(stdout);
+
+  pid = fork();
+  check(pid >= 0, "fork failed");
+  if (pid == 0) {
+    run_scenario(s);
+  }
+  check(waitpid(pid, &wstatus, 0) == pid, "waitpid failed");
+  check(WIFEXITED(wstatus), "driver didn't exit");
+  check(WEXITSTATUS(wstatus) == s->exit_code, "wrong winner or exit code");
+}
+
+
+int main(void) {
+  uint32_t i;
+
+  for (i=0; i<NUM_SCENARIOS; i++) {
+    test_scenario(scenario + i);
+  }
+  printf("All tests passed\n");
+
+  return 0;
+}
+
+#else
+
+int main(void) {
+  printf("Not supported on MINGW\n");
+  return 0;
+}
+
+#endif
@@ -16,25 +16,233 @@
  * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/*
+ * TEST READERS
+ *
+ * Usage:
+ *   test_reader <filename>: read the file (use /dev/stdin for stdin)
+ *   test_reader: check that file readers (mapped files) and stream
+ *   readers (pipes, read by blocks) give the same characters, line,
+ *   column, and position as a string reader. The inputs include lines
+ *   and comments that cross block boundaries, and files that don't end
+ *   with a newline.
+ */
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#if !defined(MINGW)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
 
 #include "io/reader.h"
 
 static reader_t reader;
 
+#define TMP_FILE "test_reader.tmp"
+
+
+/*
+ * Compare reader r with the reference string reader ref
+ * - '#' starts a comment that's skipped with reader_skip_to_eol
+ */
+static void compare_readers(reader_t *ref, reader_t *r, const char *what) {
+  int c, d;
+
+  for (;;) {
+    c = reader_current_char(ref);
+    d = reader_current_char(r);
+    if (c != d || reader_line(ref) != reader_line(r) || reader_column(ref) != reader_column(r) ||
+        reader_position(ref) != reader_position(r)) {
+      printf("BUG: %s reader differs at position %"PRIu64" (line %"PRIu32", column %"PRIu32")\n",
+             what, reader_position(ref), reader_line(ref), reader_column(ref));
+      printf("     expected char %d, got %d (line %"PRIu32", column %"PRIu32", position %"PRIu64")\n",
+             c, d, reader_line(r), reader_column(r), reader_position(r));
+      exit(1);
+    }
+    if (c == EOF) break;
+    if (c == '#') {
+      reader_skip_to_eol(ref);
+      reader_skip_to_eol(r);
+    } else {
+      reader_next_char(ref);
+      reader_next_char(r);
+    }
+  }
+}
+
+
+static void write_file(const char *data, size_t n) {
+  FILE *f;
+
+  f = fopen(TMP_FILE, "w");
+  if (f == NULL || fwrite(data, 1, n, f) != n) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  fclose(f);
+}
+
+/*
+ * Read data from a file: non-empty files must be mapped
+ */
+static void test_file(char *data, size_t n) {
+  reader_t ref;
+
+  write_file(data, n);
+  if (init_file_reader(&reader, TMP_FILE) < 0) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  if (reader_is_mapped(&reader) != (n > 0)) {
+    printf("BUG: unexpected mapping for a file of size %zu\n", n);
+    exit(1);
+  }
+  init_string_reader(&ref, data, "ref");
+  compare_readers(&ref, &reader, "file");
+  close_reader(&ref);
+  close_reader(&reader);
+  remove(TMP_FILE);
+}
+
+
+#if !defined(MINGW)
+
+/*
+ * Read data through a pipe: the writer sends chunks of irregular
+ * sizes so that reads return partial blocks.
+ */
+static void test_pipe(char *data, size_t n) {
+  static const size_t chunk[5] = { 1, 7, 4096, 65535, 65537 };
+  reader_t ref;
+  size_t i, k, m;
+  int fd[2];
+  pid_t pid;
+  FILE *f;
+
+  if (pipe(fd) < 0) {
+    perror("pipe");
+    exit(1);
+  }
+  pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    exit(1);
+  }
+  if (pid == 0) {
+    close(fd[0]);
+    i = 0;
+    k = 0;
+    while (i < n) {
+      m = chunk[k % 5];
+      if (m > n - i) m = n - i;
+      if (write(fd[1], data + i, m) != (ssize_t) m) _exit(1);
+      i += m;
+      k ++;
+    }
+    close(fd[1]);
+    _exit(0);
+  }
+
+  close(fd[1]);
+  f = fdopen(fd[0], "r");
+  init_stream_reader(&reader, f, "pipe");
+  if (reader_is_mapped(&reader)) {
+    printf("BUG: pipe is mapped\n");
+    exit(1);
+  }
+  init_string_reader(&ref, data, "ref");
+  compare_readers(&ref, &reader, "pipe");
+  close_reader(&ref);
+  close_reader(&reader);
+  waitpid(pid, NULL, 0);
+}
+
+#else
+
+static void test_pipe(char *data, size_t n) {
+}
+
+#endif
+
+
+/*
+ * Large input: lines of varying lengths with comments. Newlines and
+ * comments are placed across the block boundaries. The last line
+ * doesn't end with a newline.
+ */
+static char *large_input(size_t *n) {
+  char *s;
+  size_t i, len, size;
+
+  size = 3 * READER_BLOCK_SIZE + 123;
+  s = (char *) malloc(size + 1);
+  if (s == NULL) {
+    printf("BUG: out of memory\n");
+    exit(1);
+  }
+  len = 0;
+  for (i=0; i<size; i++) {
+    if (len > (i * 7) % 200) {
+      s[i] = '\n';
+      len = 0;
+    } else if (len == 20 && (i % 3) == 0) {
+      s[i] = '#';
+      len ++;
+    } else {
+      s[i] = 'a' + (i % 26);
+      len ++;
+    }
+  }
+  s[READER_BLOCK_SIZE - 1] = '\n';
+  s[READER_BLOCK_SIZE] = '\n';
+  s[2 * READER_BLOCK_SIZE - 10] = '#';        // comment across the boundary
+  s[3 * READER_BLOCK_SIZE] = '#';             // comment at the start of a block
+  s[size - 1] = 'z';
+  s[size] = '\0';
+  *n = size;
+  return s;
+}
+
+static void run_tests(void) {
+  static char *small[6] = {
+    "", "a", "abc\ndef", "\n\n\n", "# comment without newline", "x\n# comment\ny",
+  };
+  char *s;
+  size_t n;
+  uint32_t i;
+
+  for (i=0; i<6; i++) {
+    test_file(small[i], strlen(small[i]));
+    test_pipe(small[i], strlen(small[i]));
+  }
+
+  s = large_input(&n);
+  test_file(s, n);
+  test_pipe(s, n);
+  free(s);
+
+  printf("All tests passed\n");
+}
+
+
 int main(int argc, char *argv[]) {
   char *filename;
   int c;
 
   if (argc <= 1) {
-    init_stdin_reader(&reader);
-  } else {
-    filename = argv[1];
-    if (init_file_reader(&reader, filename) < 0) {
-      perror(filename);
-      exit(2);
-    }
+    run_tests();
+    return 0;
+  }
+
+  filename = argv[1];
+  if (init_file_reader(&reader, filename) < 0) {
+    perror(filename);
+    exit(2);
   }
 
   c = reader_current_char(&reader);
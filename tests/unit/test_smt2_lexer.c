@@ -22,6 +22,12 @@
 #include <inttypes.h>
 #include <assert.h>
 
+#if !defined(MINGW)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
 #include "frontend/smt2/smt2_lexer.h"
 #include "include/yices_exit_codes.h"
 #include "utils/command_line.h"
@@ -56,6 +62,206 @@ static void print_token(smt2_token_t tk) {
 
 
 
+/*
+ * SELF TEST (no file name): the same input is read from a file (mapped),
+ * a pipe (read by blocks), and a string. The three lexers must give the
+ * same tokens with the same values and positions. The input has tokens
+ * of all kinds at many offsets around the buffer boundaries, and it
+ * doesn't end with a newline.
+ */
+#define TMP_FILE "test_smt2_lexer.tmp"
+
+typedef struct token_rec_s {
+  smt2_token_t tk;
+  uint64_t pos;
+  uint32_t line;
+  uint32_t column;
+  char *value;
+} token_rec_t;
+
+typedef struct token_list_s {
+  token_rec_t *data;
+  uint32_t size;
+  uint32_t capacity;
+} token_list_t;
+
+static void collect_tokens(lexer_t *lex, token_list_t *l) {
+  smt2_token_t tk;
+  token_rec_t *r;
+
+  l->data = NULL;
+  l->size = 0;
+  l->capacity = 0;
+  do {
+    tk = next_smt2_token(lex);
+    if (l->size == l->capacity) {
+      l->capacity = l->capacity == 0 ? 1024 : 2 * l->capacity;
+      l->data = (token_rec_t *) realloc(l->data, l->capacity * sizeof(token_rec_t));
+      if (l->data == NULL) {
+        printf("BUG: out of memory\n");
+        exit(1);
+      }
+    }
+    r = l->data + l->size;
+    r->tk = tk;
+    r->pos = lex->tk_pos;
+    r->line = lex->tk_line;
+    r->column = lex->tk_column;
+    // the value of parentheses and end-of-stream is not set
+    r->value = strdup((tk == SMT2_TK_LP || tk == SMT2_TK_RP || tk == SMT2_TK_EOS) ? "" : current_token_value(lex));
+    l->size ++;
+  } while (tk != SMT2_TK_EOS);
+}
+
+static void delete_tokens(token_list_t *l) {
+  uint32_t i;
+
+  for (i=0; i<l->size; i++) {
+    free(l->data[i].value);
+  }
+  free(l->data);
+}
+
+static void compare_tokens(token_list_t *ref, token_list_t *l, const char *what) {
+  token_rec_t *a, *b;
+  uint32_t i;
+
+  for (i=0; i<ref->size && i<l->size; i++) {
+    a = ref->data + i;
+    b = l->data + i;
+    if (a->tk != b->tk || a->pos != b->pos || a->line != b->line || a->column != b->column ||
+        strcmp(a->value, b->value) != 0) {
+      printf("BUG: %s lexer differs on token %"PRIu32"\n", what, i);
+      printf("     expected %s '%s' at %"PRIu64" (line %"PRIu32", column %"PRIu32")\n",
+             smt2_token_to_string(a->tk), a->value, a->pos, a->line, a->column);
+      printf("     got %s '%s' at %"PRIu64" (line %"PRIu32", column %"PRIu32")\n",
+             smt2_token_to_string(b->tk), b->value, b->pos, b->line, b->column);
+      exit(1);
+    }
+  }
+  if (ref->size != l->size) {
+    printf("BUG: %s lexer: expected %"PRIu32" tokens, got %"PRIu32"\n", what, ref->size, l->size);
+    exit(1);
+  }
+}
+
+/*
+ * Input: items of all token kinds separated by a varying number of
+ * spaces, so that the buffer boundaries fall at many positions inside
+ * tokens. The last item is a symbol with no newline after it.
+ */
+static char *build_input(size_t *n) {
+  static const char *const item[] = {
+    "(assert (= x y))", "|quoted symbol\nwith newline|", "#x0123456789abcdef", "#b1010",
+    ":named", "\"string with \"\" quote\"", "12345678901234567890", "3.14159",
+    "; comment\n", "bvadd", "symbol_with-chars.~!@$%^&*_+=<>?/", "\n",
+  };
+  char *s;
+  size_t size, len, i, k, m;
+
+  size = 4 * 65536;
+  s = (char *) malloc(size + 400);
+  if (s == NULL) {
+    printf("BUG: out of memory\n");
+    exit(1);
+  }
+  len = 0;
+  k = 0;
+  while (len < size) {
+    for (i=0; i<k % 17; i++) {
+      s[len++] = ' ';
+    }
+    if (k % 50 == 49) {
+      // long symbol
+      m = 100 + (k % 200);
+      for (i=0; i<m; i++) {
+        s[len++] = 'a' + (i % 26);
+      }
+    } else {
+      m = strlen(item[k % 12]);
+      memcpy(s + len, item[k % 12], m);
+      len += m;
+    }
+    s[len++] = ' ';
+    k ++;
+  }
+  memcpy(s + len, "last", 4);
+  len += 4;
+  s[len] = '\0';
+  *n = len;
+  return s;
+}
+
+static void run_tests(void) {
+  token_list_t ref, l;
+  lexer_t lex;
+  size_t n;
+  char *s;
+  FILE *f;
+#if !defined(MINGW)
+  size_t i, m;
+  int fd[2];
+  pid_t pid;
+#endif
+
+  s = build_input(&n);
+  init_smt2_string_lexer(&lex, s, "string");
+  collect_tokens(&lex, &ref);
+  close_lexer(&lex);
+
+  f = fopen(TMP_FILE, "w");
+  if (f == NULL || fwrite(s, 1, n, f) != n) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  fclose(f);
+  if (init_smt2_file_lexer(&lex, TMP_FILE) < 0) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  if (!reader_is_mapped(&lex.reader)) {
+    printf("BUG: file is not mapped\n");
+    exit(1);
+  }
+  collect_tokens(&lex, &l);
+  close_lexer(&lex);
+  remove(TMP_FILE);
+  compare_tokens(&ref, &l, "file");
+  delete_tokens(&l);
+
+#if !defined(MINGW)
+  if (pipe(fd) < 0 || (pid = fork()) < 0) {
+    perror("pipe");
+    exit(1);
+  }
+  if (pid == 0) {
+    // write in chunks of irregular sizes
+    close(fd[0]);
+    for (i=0; i<n; i += m) {
+      m = 1 + (i % 9973);
+      if (m > n - i) m = n - i;
+      if (write(fd[1], s + i, m) != (ssize_t) m) _exit(1);
+    }
+    close(fd[1]);
+    _exit(0);
+  }
+  close(fd[1]);
+  init_smt2_stream_lexer(&lex, fdopen(fd[0], "r"), "pipe");
+  collect_tokens(&lex, &l);
+  close_lexer(&lex);
+  waitpid(pid, NULL, 0);
+  compare_tokens(&ref, &l, "pipe");
+  delete_tokens(&l);
+#endif
+
+  printf("%"PRIu32" tokens\n", ref.size);
+  delete_tokens(&ref);
+  free(s);
+  printf("All tests passed\n");
+}
+
+
+
 /*
  * Global variables: input file + logic name
  */
@@ -81,6 +287,7 @@ static option_desc_t options[NUM_OPTIONS] = {
 
 static void print_help(char *progname) {
   printf("Usage: %s [options] <optional filename>\n\n", progname);
+  printf("Runs a self test if there's no filename (use /dev/stdin to read from stdin).\n\n");
   printf("Options:\n"
 	 "  --help, -h            Display this information\n"
 	 "  --logic=name          Select an SMT-LIB logic (e.g., QF_UFLIA)\n"
@@ -171,8 +378,11 @@ int main(int argc, char *argv[]) {
   process_command_line(argc, argv);
 
   if (filename == NULL) {
-    init_smt2_stdin_lexer(&lexer);
-  } else if (init_smt2_file_lexer(&lexer, filename) < 0) {
+    run_tests();
+    return 0;
+  }
+
+  if (init_smt2_file_lexer(&lexer, filename) < 0) {
     perror(filename);
     exit(YICES_EXIT_FILE_NOT_FOUND);
   }
@@ -0,0 +1,254 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE PIPELINED SMT2 LEXER: read the same file with the plain
+ * lexer and through a pipeline. The tokens must be the same, with the
+ * same values and positions.
+ *
+ * The inputs contain commands that span several chunks and several
+ * blocks, a (set-info :smt-lib-version ...) command (where the lexer
+ * thread waits for the parser), and an (exit) command followed by
+ * text that must not be read.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "frontend/smt2/smt2_lexer.h"
+#include "frontend/smt2/smt2_pipeline.h"
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+#define TMP_FILE "test_smt2_pipeline.tmp"
+
+typedef struct token_rec_s {
+  smt2_token_t tk;
+  uint64_t pos;
+  uint32_t line;
+  uint32_t column;
+  char *value;
+} token_rec_t;
+
+typedef struct token_list_s {
+  token_rec_t *data;
+  uint32_t size;
+  uint32_t capacity;
+} token_list_t;
+
+static lexer_t lexer;
+static smt2_pipeline_t pipeline;
+
+
+/*
+ * Read tokens until EOS, either from lex or from pipe if pipe != NULL
+ */
+static void collect_tokens(lexer_t *lex, smt2_pipeline_t *pipe, token_list_t *l) {
+  smt2_token_t tk;
+  token_rec_t *r;
+
+  l->data = NULL;
+  l->size = 0;
+  l->capacity = 0;
+  do {
+    tk = (pipe == NULL) ? next_smt2_token(lex) : smt2_pipeline_next_token(pipe);
+    if (l->size == l->capacity) {
+      l->capacity = l->capacity == 0 ? 1024 : 2 * l->capacity;
+      l->data = (token_rec_t *) realloc(l->data, l->capacity * sizeof(token_rec_t));
+      if (l->data == NULL) {
+        printf("BUG: out of memory\n");
+        exit(1);
+      }
+    }
+    r = l->data + l->size;
+    r->tk = tk;
+    r->pos = lex->tk_pos;
+    r->line = lex->tk_line;
+    r->column = lex->tk_column;
+    // the value of parentheses and end-of-stream is not set
+    r->value = strdup((tk == SMT2_TK_LP || tk == SMT2_TK_RP || tk == SMT2_TK_EOS) ? "" : current_token_value(lex));
+    l->size ++;
+  } while (tk != SMT2_TK_EOS);
+}
+
+static void delete_tokens(token_list_t *l) {
+  uint32_t i;
+
+  for (i=0; i<l->size; i++) {
+    free(l->data[i].value);
+  }
+  free(l->data);
+}
+
+/*
+ * Compare the first n tokens of ref and l
+ */
+static void compare_tokens(token_list_t *ref, token_list_t *l, uint32_t n) {
+  token_rec_t *a, *b;
+  uint32_t i;
+
+  if (ref->size < n || l->size < n) {
+    printf("BUG: expected at least %"PRIu32" tokens, got %"PRIu32" and %"PRIu32"\n", n, ref->size, l->size);
+    exit(1);
+  }
+
+  for (i=0; i<n; i++) {
+    a = ref->data + i;
+    b = l->data + i;
+    if (a->tk != b->tk || a->pos != b->pos || a->line != b->line || a->column != b->column ||
+        strcmp(a->value, b->value) != 0) {
+      printf("BUG: pipeline differs on token %"PRIu32"\n", i);
+      printf("     expected %s '%s' at %"PRIu64" (line %"PRIu32", column %"PRIu32")\n",
+             smt2_token_to_string(a->tk), a->value, a->pos, a->line, a->column);
+      printf("     got %s '%s' at %"PRIu64" (line %"PRIu32", column %"PRIu32")\n",
+             smt2_token_to_string(b->tk), b->value, b->pos, b->line, b->column);
+      exit(1);
+    }
+  }
+}
+
+
+/*
+ * Number of tokens up to the end of the first (exit) command, or all
+ * the tokens if there's no (exit) command
+ */
+static uint32_t tokens_to_exit(token_list_t *l) {
+  uint32_t i;
+
+  for (i=0; i+2<l->size; i++) {
+    if (l->data[i].tk == SMT2_TK_LP && l->data[i+1].tk == SMT2_TK_EXIT && l->data[i+2].tk == SMT2_TK_RP) {
+      return i+3;
+    }
+  }
+  return l->size;
+}
+
+
+/*
+ * Input: n declarations then an assertion with about 8n tokens
+ */
+static char *build_input(uint32_t n, bool with_exit) {
+  char *s;
+  size_t size, len;
+  uint32_t i;
+
+  size = 200 + 100 * (size_t) n;
+  s = (char *) malloc(size);
+  if (s == NULL) {
+    printf("BUG: out of memory\n");
+    exit(1);
+  }
+
+  len = snprintf(s, size, "(set-info :smt-lib-version 2.6)\n(set-logic QF_LIA) ; comment\n");
+  for (i=0; i<n; i++) {
+    len += snprintf(s + len, size - len, "(declare-fun |x %"PRIu32"| () Int)\n", i);
+  }
+  len += snprintf(s + len, size - len, "(assert (and\n");
+  for (i=0; i<n; i++) {
+    len += snprintf(s + len, size - len, "  (<= (+ |x %"PRIu32"| %"PRIu32") #x%02x)", i, i, i % 256);
+    if (i % 7 == 0) {
+      len += snprintf(s + len, size - len, " ; \"line %"PRIu32"\"", i);
+    }
+    s[len ++] = '\n';
+  }
+  len += snprintf(s + len, size - len, "))\n(echo \"a \"\"string\"\"\")\n(check-sat)\n");
+  if (with_exit) {
+    len += snprintf(s + len, size - len, "(exit)\n(check-sat) \"not closed");
+  }
+  return s;
+}
+
+static void write_file(const char *s) {
+  FILE *f;
+
+  f = fopen(TMP_FILE, "w");
+  if (f == NULL || fputs(s, f) == EOF) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  fclose(f);
+}
+
+static void test_input(uint32_t n, bool with_exit) {
+  token_list_t ref, l;
+  uint32_t k;
+  char *s;
+
+  s = build_input(n, with_exit);
+  write_file(s);
+  free(s);
+
+  if (init_smt2_file_lexer(&lexer, TMP_FILE) < 0) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  collect_tokens(&lexer, NULL, &ref);
+  close_lexer(&lexer);
+
+  if (init_smt2_file_lexer(&lexer, TMP_FILE) < 0) {
+    perror(TMP_FILE);
+    exit(1);
+  }
+  if (! start_smt2_pipeline(&pipeline, &lexer)) {
+    printf("BUG: failed to start the pipeline\n");
+    exit(1);
+  }
+  collect_tokens(&lexer, &pipeline, &l);
+  if (smt2_pipeline_next_token(&pipeline) != SMT2_TK_EOS) {
+    printf("BUG: token after end-of-stream\n");
+    exit(1);
+  }
+  stop_smt2_pipeline(&pipeline);
+  close_lexer(&lexer);
+
+  // after (exit), the pipeline gives end-of-stream
+  k = tokens_to_exit(&ref);
+  compare_tokens(&ref, &l, k);
+  if (with_exit != (k < ref.size) || l.size != k + (k < ref.size)) {
+    printf("BUG: pipeline gave %"PRIu32" tokens, expected %"PRIu32"\n", l.size, k + (k < ref.size));
+    exit(1);
+  }
+
+  printf("%"PRIu32" declarations: %"PRIu32" tokens\n", n, l.size);
+  delete_tokens(&ref);
+  delete_tokens(&l);
+  remove(TMP_FILE);
+}
+
+#endif
+
+
+int main(void) {
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  static const uint32_t size[5] = { 0, 1, 30, 600, 6000 };
+  uint32_t i;
+
+  for (i=0; i<5; i++) {
+    test_input(size[i], false);
+    test_input(size[i], true);
+  }
+  printf("All tests passed\n");
+#else
+  printf("Pipelining not supported: no test\n");
+#endif
+
+  return 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST SNAPSHOTS: save terms with yices_save_snapshot then restore
+ * them with yices_load_snapshot. The restored uninterpreted terms are
+ * fresh but they get the original names. Replacing them by the
+ * original terms must give back the original formulas (terms are
+ * hash-consed).
+ *
+ * Also check that corrupted snapshots with a valid checksum are
+ * rejected (or restored as well-typed terms) instead of failing
+ * an assertion.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "utils/hash_functions.h"
+#include "yices.h"
+
+#define SNAPSHOT_FILE "test_term_snapshot.snap"
+
+/*
+ * Formulas 0 ... NUM_SUBST-1 use only variables of
+ * predefined or structural types (so we can substitute).
+ */
+#define NUM_FORMULAS 8
+#define NUM_SUBST 6
+static term_t formula[NUM_FORMULAS];
+
+#define NUM_VARS 5
+static const char *var_name[NUM_VARS] = { "x", "y", "z", "u", "p" };
+static term_t var[NUM_VARS];
+
+static term_t new_var(type_t tau, const char *name) {
+  term_t t = yices_new_uninterpreted_term(tau);
+  yices_set_term_name(t, name);
+  return t;
+}
+
+static void build_formulas(void) {
+  type_t int_type, real_type, bv8, bv100, sort, color, fun, pair;
+  term_t x, y, z, u, v, w, f, c, p, big;
+
+  int_type = yices_int_type();
+  real_type = yices_real_type();
+  bv8 = yices_bv_type(8);
+  bv100 = yices_bv_type(100);
+  sort = yices_new_uninterpreted_type();
+  yices_set_type_name(sort, "S");
+  color = yices_new_scalar_type(3);
+  yices_set_type_name(color, "Color");
+  fun = yices_function_type1(int_type, sort);
+  pair = yices_tuple_type2(int_type, bv8);
+
+  x = new_var(int_type, "x");
+  y = new_var(real_type, "y");
+  z = new_var(bv8, "z");
+  u = new_var(bv100, "u");
+  p = new_var(pair, "p");
+  v = new_var(sort, "v");
+  w = new_var(sort, "w");
+  f = new_var(fun, "f");
+  c = new_var(color, "c");
+
+  var[0] = x;
+  var[1] = y;
+  var[2] = z;
+  var[3] = u;
+  var[4] = p;
+
+  // arithmetic: polynomials, power products, big coefficients
+  big = yices_parse_rational("123456789012345678901234567890/11");
+  formula[0] = yices_arith_geq_atom(yices_add(yices_mul(x, x), yices_mul(big, y)), yices_int32(-3));
+  formula[1] = yices_or2(yices_arith_eq0_atom(yices_idiv(x, yices_int32(4))), yices_not(yices_arith_lt0_atom(y)));
+
+  // bitvectors: 64bit and wide polynomials, bit-extraction, division
+  formula[2] = yices_bveq_atom(yices_bvmul(z, yices_bvadd(z, yices_bvconst_uint32(8, 7))), yices_bvdiv(z, yices_bvconst_uint32(8, 3)));
+  formula[3] = yices_bvsge_atom(yices_bvsub(yices_bvsquare(u), yices_bvconst_int64(100, -5)), u);
+  formula[4] = yices_xor2(yices_bitextract(z, 3), yices_bitextract(u, 99));
+  formula[5] = yices_eq(yices_select(2, p), yices_bvneg(z));
+
+  // uninterpreted functions and types, scalars, ite
+  formula[6] = yices_distinct(3, (term_t[]) { v, w, yices_application1(f, x) });
+  formula[7] = yices_eq(c, yices_ite(yices_bitextract(z, 0), yices_constant(color, 1), yices_constant(color, 2)));
+}
+
+static void check_error(int32_t code, error_code_t expected, const char *msg) {
+  if (code >= 0 || yices_error_code() != expected) {
+    printf("BUG: %s\n", msg);
+    exit(1);
+  }
+  yices_clear_error();
+}
+
+static void check_type_name(term_t t, const char *name) {
+  const char *s;
+
+  s = yices_get_type_name(yices_type_of_term(t));
+  if (s == NULL || strcmp(s, name) != 0) {
+    printf("BUG: expected type name %s\n", name);
+    exit(1);
+  }
+}
+
+static void test_round_trip(void) {
+  term_vector_t v;
+  term_t new_var[NUM_VARS];
+  term_t t;
+  int32_t code;
+  uint32_t i;
+
+  code = yices_save_snapshot(SNAPSHOT_FILE, NUM_FORMULAS, formula);
+  if (code < 0) {
+    printf("BUG: failed to save snapshot\n");
+    yices_print_error(stdout);
+    exit(1);
+  }
+
+  yices_init_term_vector(&v);
+  code = yices_load_snapshot(SNAPSHOT_FILE, &v);
+  if (code < 0) {
+    printf("BUG: failed to load snapshot\n");
+    yices_print_error(stdout);
+    exit(1);
+  }
+  if (v.size != NUM_FORMULAS) {
+    printf("BUG: expected %"PRIu32" terms, got %"PRIu32"\n", (uint32_t) NUM_FORMULAS, v.size);
+    exit(1);
+  }
+
+  // the names now refer to the restored terms
+  for (i=0; i<NUM_VARS; i++) {
+    new_var[i] = yices_get_term_by_name(var_name[i]);
+    if (new_var[i] == NULL_TERM || new_var[i] == var[i]) {
+      printf("BUG: no fresh term for %s\n", var_name[i]);
+      exit(1);
+    }
+  }
+
+  for (i=0; i<NUM_FORMULAS; i++) {
+    printf("restored: ");
+    yices_pp_term(stdout, v.data[i], 120, 10, 10);
+    if (v.data[i] == formula[i]) {
+      printf("BUG: restored formula %"PRIu32" is not fresh\n", i);
+      exit(1);
+    }
+    if (i < NUM_SUBST) {
+      t = yices_subst_term(NUM_VARS, new_var, var, v.data[i]);
+      if (t != formula[i]) {
+        printf("BUG: restored formula %"PRIu32" differs from the original\n", i);
+        exit(1);
+      }
+    }
+  }
+
+  check_type_name(yices_get_term_by_name("v"), "S");
+  check_type_name(yices_get_term_by_name("c"), "Color");
+  yices_delete_term_vector(&v);
+}
+
+static void test_errors(void) {
+  term_vector_t v;
+  term_t bad[1];
+  FILE *f;
+
+  bad[0] = NULL_TERM;
+  check_error(yices_save_snapshot(SNAPSHOT_FILE, 1, bad), INVALID_TERM, "expected INVALID_TERM");
+
+  yices_init_term_vector(&v);
+  check_error(yices_load_snapshot("/no/such/file.snap", &v), INPUT_ERROR, "expected INPUT_ERROR");
+
+  f = fopen(SNAPSHOT_FILE, "w");
+  if (f == NULL) {
+    perror(SNAPSHOT_FILE);
+    exit(1);
+  }
+  fprintf(f, "this is not a snapshot file, just some text...\n");
+  fclose(f);
+  check_error(yices_load_snapshot(SNAPSHOT_FILE, &v), SNAPSHOT_FORMAT_ERROR, "expected SNAPSHOT_FORMAT_ERROR");
+  yices_delete_term_vector(&v);
+}
+
+/*
+ * Mutations of a snapshot: change each word of the body then fix the
+ * checksum. Loading must either succeed or fail with SNAPSHOT_FORMAT_ERROR.
+ * The header has 11 words: word 9 is the body size and word 10 is the
+ * checksum.
+ */
+#define HEADER_SIZE 11
+#define NUM_MUTATIONS 7
+
+static uint32_t mutate(uint32_t x, uint32_t k) {
+  switch (k) {
+  case 0: return x + 1;
+  case 1: return x - 1;
+  case 2: return x ^ 2;
+  case 3: return 0;
+  case 4: return 1;
+  case 5: return 5;
+  default: return UINT32_MAX;
+  }
+}
+
+static void write_words(const uint32_t *a, uint32_t n) {
+  FILE *f;
+
+  f = fopen(SNAPSHOT_FILE, "w");
+  if (f == NULL || fwrite(a, sizeof(uint32_t), n, f) != n) {
+    perror(SNAPSHOT_FILE);
+    exit(1);
+  }
+  fclose(f);
+}
+
+static void test_malformed(void) {
+  term_vector_t v;
+  uint32_t *a;
+  uint32_t i, k, n, x, nok;
+  long size;
+  int32_t code;
+  FILE *f;
+
+  code = yices_save_snapshot(SNAPSHOT_FILE, NUM_FORMULAS, formula);
+  f = fopen(SNAPSHOT_FILE, "r");
+  if (code < 0 || f == NULL) {
+    printf("BUG: failed to save snapshot\n");
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  rewind(f);
+  n = size/sizeof(uint32_t);
+  a = (uint32_t *) malloc(n * sizeof(uint32_t));
+  if (a == NULL || fread(a, sizeof(uint32_t), n, f) != n || n <= HEADER_SIZE || a[9] != n - HEADER_SIZE) {
+    printf("BUG: can't read the snapshot\n");
+    exit(1);
+  }
+  fclose(f);
+
+  nok = 0;
+  yices_init_term_vector(&v);
+  for (i=HEADER_SIZE; i<n; i++) {
+    x = a[i];
+    for (k=0; k<NUM_MUTATIONS; k++) {
+      a[i] = mutate(x, k);
+      a[10] = jenkins_hash_array(a + HEADER_SIZE, n - HEADER_SIZE, 0x1234);
+      write_words(a, n);
+      code = yices_load_snapshot(SNAPSHOT_FILE, &v);
+      if (code == 0) {
+        nok ++;
+      } else if (yices_error_code() != SNAPSHOT_FORMAT_ERROR) {
+        printf("BUG: unexpected error code for a corrupted snapshot\n");
+        yices_print_error(stdout);
+        exit(1);
+      }
+      yices_clear_error();
+    }
+    a[i] = x;
+  }
+  yices_delete_term_vector(&v);
+  free(a);
+
+  printf("%"PRIu32" mutations: %"PRIu32" restored, %"PRIu32" rejected\n",
+         (n - HEADER_SIZE) * NUM_MUTATIONS, nok, (n - HEADER_SIZE) * NUM_MUTATIONS - nok);
+}
+
+int main(void) {
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  build_formulas();
+  test_round_trip();
+  test_errors();
+  test_malformed();
+  remove(SNAPSHOT_FILE);
+
+  printf("All tests passed\n");
+  yices_exit();
+
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include "io/type_printer.h"
 #include "io/yices_pp.h"
 #include "terms/types.h"
+#include "utils/hash_ctrl_bytes.h"
 #include "utils/refcount_strings.h"
 
 /*
@@ -67,33 +68,13 @@ static void print_int_hash_table(FILE *f, int_htbl_t *tbl, uint32_t level) {
   fprintf(f, "hash table %p\n", tbl);
   fprintf(f, "  size = %"PRIu32"\n", tbl->size);
   fprintf(f, "  nelems = %"PRIu32"\n", tbl->nelems);
-  fprintf(f, "  ndeleted = %"PRIu32"\n", tbl->ndeleted);
   fprintf(f, "  resize threshold = %"PRIu32"\n", tbl->resize_threshold);
-  fprintf(f, "  cleanup threshold = %"PRIu32"\n", tbl->cleanup_threshold);
   if (level >= 1) {
     fprintf(f, "  records:\n");
     for (i=0; i<tbl->size; i++) {
       r = tbl->records + i;
-      if (r->value >= 0) {
-	fprintf(f, "    %"PRIu32": [key = %8x, val = %"PRId32"]\n", i, (unsigned) r->key, r->value);
-      }
-    }
-  }
-  if (level >= 2) {
-    fprintf(f, "  deleted:\n");
-    for (i=0; i<tbl->size; i++) {
-      r = tbl->records + i;
-      if (r->value == DELETED_VALUE) {
-	fprintf(f, "    %"PRIu32": [key = %8x, val = %"PRId32"]\n", i, (unsigned) r->key, r->value);
-      }
-    }
-  }
-  if (level >= 100) {
-    fprintf(f, "  free:\n");
-    for (i=0; i<tbl->size; i++) {
-      r = tbl->records + i;
-      if (r->value == NULL_VALUE) {
-	fprintf(f, "    %"PRIu32": [key = %8x, val = %"PRId32"]\n", i, (unsigned) r->key, r->value);
+      if (tbl->ctrl[i] != HCTRL_EMPTY) {
+	fprintf(f, "    %"PRIu32": [key = %8x, val = %"PRId32", tag = %02x]\n", i, (unsigned) r->key, r->value, (unsigned) tbl->ctrl[i]);
       }
     }
   }